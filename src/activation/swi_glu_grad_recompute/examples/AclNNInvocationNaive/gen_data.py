@@ -0,0 +1,65 @@
+#!/usr/bin/python3
+# -*- coding:utf-8 -*-
+# Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+# This file is a part of the CANN Open Software.
+# Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+# ======================================================================================================================
+
+import torch
+import torch.nn.functional as F
+import numpy as np
+import os
+import sys
+
+def swish(x):
+    return x * torch.sigmoid(x)
+
+def swish_grad(x):
+    return torch.sigmoid(x) + x * (1 - torch.sigmoid(x)) * torch.sigmoid(x)
+
+def compress_x(self, x_dtype):
+    # 按前向保存的格式压缩x，int8为逐行对称量化，同时写出逐行的x_scale
+    if x_dtype == "bfloat16":
+        self.to(torch.bfloat16).view(torch.int16).numpy().tofile("./input/input_x.bin")
+    elif x_dtype == "float16":
+        self.to(torch.float16).numpy().tofile("./input/input_x.bin")
+    elif x_dtype == "int8":
+        scale = torch.clamp(self.abs().amax(dim=-1, keepdim=True), min=1e-12) / 127.0
+        x_int8 = torch.clamp(torch.round(self / scale), -127, 127).to(torch.int8)
+        x_int8.numpy().tofile("./input/input_x.bin")
+        scale.reshape(-1).numpy().astype(np.float32).tofile("./input/input_x_scale.bin")
+    else:
+        raise ValueError("unsupported x dtype: {}".format(x_dtype))
+
+
+def gen_golden_data_simple(x_dtype):
+    self = torch.randn(2, 32).to(torch.float32)
+
+    dim = -1
+
+    os.system("mkdir -p input")
+    os.system("mkdir -p output")
+
+    compress_x(self, x_dtype)
+    # 未压缩的fp32 x，供aclnnSwiGluGrad对比运行
+    self.numpy().astype(np.float32).tofile("./input/input_x_fp32.bin")
+    # 标杆用未压缩的fp32输入，与swi_glu_grad的结果一致
+    x = torch.chunk(self, 2, dim=dim)
+    x0 = x[0].type(torch.float32)
+    x1 = x[1].type(torch.float32)
+
+    grad_output = torch.randn(2, 16).to(torch.float32)
+    grad_output.numpy().astype(np.float32).tofile("./input/grad_output.bin")
+
+    grad_x0 = grad_output * x1 * swish_grad(x0)
+    grad_x1 = grad_output * swish(x0)
+    grad_input = torch.cat((grad_x0, grad_x1), dim=dim)
+
+    grad_input.numpy().astype(np.float32).tofile("./output/output_golden_out.bin")
+
+if __name__ == "__main__":
+    gen_golden_data_simple(sys.argv[1] if len(sys.argv) > 1 else "bfloat16")
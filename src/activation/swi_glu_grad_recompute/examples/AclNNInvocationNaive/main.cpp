@@ -0,0 +1,284 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file main.cpp
+ */
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <fstream>
+#include <fcntl.h>
+
+#include "acl/acl.h"
+#include "aclnn_swi_glu_grad_recompute.h"
+#include "aclnn_swi_glu_grad.h"
+
+#define SUCCESS 0
+#define FAILED 1
+
+#define INFO_LOG(fmt, args...) fprintf(stdout, "[INFO]  " fmt "\n", ##args)
+#define WARN_LOG(fmt, args...) fprintf(stdout, "[WARN]  " fmt "\n", ##args)
+#define ERROR_LOG(fmt, args...) fprintf(stderr, "[ERROR]  " fmt "\n", ##args)
+
+#define CHECK_RET(cond, return_expr) \
+    do {                             \
+        if (!(cond)) {               \
+            return_expr;             \
+        }                            \
+    } while (0)
+
+#define LOG_PRINT(message, ...)         \
+    do {                                \
+        printf(message, ##__VA_ARGS__); \
+    } while (0)
+
+bool ReadFile(const std::string &filePath, size_t &fileSize, void *buffer, size_t bufferSize)
+{
+    struct stat sBuf;
+    int fileStatus = stat(filePath.data(), &sBuf);
+    if (fileStatus == -1) {
+        ERROR_LOG("failed to get file %s", filePath.c_str());
+        return false;
+    }
+    if (S_ISREG(sBuf.st_mode) == 0) {
+        ERROR_LOG("%s is not a file, please enter a file", filePath.c_str());
+        return false;
+    }
+
+    std::ifstream file;
+    file.open(filePath, std::ios::binary);
+    if (!file.is_open()) {
+        ERROR_LOG("Open file failed. path = %s", filePath.c_str());
+        return false;
+    }
+
+    std::filebuf *buf = file.rdbuf();
+    size_t size = buf->pubseekoff(0, std::ios::end, std::ios::in);
+    if (size == 0) {
+        ERROR_LOG("file size is 0");
+        file.close();
+        return false;
+    }
+    if (size > bufferSize) {
+        ERROR_LOG("file size is larger than buffer size");
+        file.close();
+        return false;
+    }
+    buf->pubseekpos(0, std::ios::in);
+    buf->sgetn(static_cast<char *>(buffer), size);
+    fileSize = size;
+    file.close();
+    return true;
+}
+
+int64_t GetShapeSize(const std::vector<int64_t>& shape) {
+  int64_t shapeSize = 1;
+  for (auto i : shape) {
+    shapeSize *= i;
+  }
+  return shapeSize;
+}
+
+int Init(int32_t deviceId, aclrtStream* stream) {
+  // 固定写法，AscendCL初始化
+  auto ret = aclInit(nullptr);
+  CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("aclInit failed. ERROR: %d\n", ret); return ret);
+  ret = aclrtSetDevice(deviceId);
+  CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("aclrtSetDevice failed. ERROR: %d\n", ret); return ret);
+  ret = aclrtCreateStream(stream);
+  CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("aclrtCreateStream failed. ERROR: %d\n", ret); return ret);
+  return 0;
+}
+
+template <typename T>
+int CreateAclTensor(const std::vector<T>& hostData, const std::vector<int64_t>& shape, void** deviceAddr,
+                    aclDataType dataType, aclTensor** tensor) {
+  auto size = GetShapeSize(shape) * sizeof(T);
+  // 调用aclrtMalloc申请device侧内存
+  auto ret = aclrtMalloc(deviceAddr, size, ACL_MEM_MALLOC_HUGE_FIRST);
+  CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("aclrtMalloc failed. ERROR: %d\n", ret); return ret);
+  // 调用aclrtMemcpy将host侧数据拷贝到device侧内存上
+  ret = aclrtMemcpy(*deviceAddr, size, hostData.data(), size, ACL_MEMCPY_HOST_TO_DEVICE);
+  CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("aclrtMemcpy failed. ERROR: %d\n", ret); return ret);
+
+  // 计算连续tensor的strides
+  std::vector<int64_t> strides(shape.size(), 1);
+  for (int64_t i = shape.size() - 2; i >= 0; i--) {
+    strides[i] = shape[i + 1] * strides[i + 1];
+  }
+
+  // 调用aclCreateTensor接口创建aclTensor
+  *tensor = aclCreateTensor(shape.data(), shape.size(), dataType, strides.data(), 0, aclFormat::ACL_FORMAT_ND,
+                            shape.data(), shape.size(), *deviceAddr);
+  return 0;
+}
+
+int WriteOutput(const std::string& filePath, const std::vector<int64_t>& shape, void* deviceAddr) {
+  auto size = GetShapeSize(shape);
+  std::vector<float> resultData(size, 0);
+  auto ret = aclrtMemcpy(resultData.data(), resultData.size() * sizeof(resultData[0]), deviceAddr,
+                         size * sizeof(resultData[0]), ACL_MEMCPY_DEVICE_TO_HOST);
+  CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("copy result from device to host failed. ERROR: %d\n", ret); return ret);
+  for (int64_t i = 0; i < size; i++) {
+    LOG_PRINT("result[%ld] is: %f\n", i, resultData[i]);
+  }
+  std::ofstream outFile(filePath, std::ios::binary);
+  if (!outFile) {
+    ERROR_LOG("Failed to open output file %s for writing.", filePath.c_str());
+    return FAILED;
+  }
+  outFile.write(reinterpret_cast<const char*>(resultData.data()), resultData.size() * sizeof(resultData[0]));
+  if (!outFile) {
+    ERROR_LOG("Failed to write data to output file %s.", filePath.c_str());
+    return FAILED;
+  }
+  INFO_LOG("Write output %s success", filePath.c_str());
+  return 0;
+}
+
+int RunWithWorkspace(uint64_t workspaceSize, aclOpExecutor* executor, aclrtStream stream,
+                     aclnnStatus (*launch)(void*, uint64_t, aclOpExecutor*, aclrtStream)) {
+  // 根据第一段接口计算出的workspaceSize申请device内存
+  void* workspaceAddr = nullptr;
+  if (workspaceSize > 0) {
+    auto ret = aclrtMalloc(&workspaceAddr, workspaceSize, ACL_MEM_MALLOC_HUGE_FIRST);
+    CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("allocate workspace failed. ERROR: %d\n", ret); return ret);
+  }
+  // 调用第二段接口并同步等待任务执行结束
+  auto ret = launch(workspaceAddr, workspaceSize, executor, stream);
+  CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("launch failed. ERROR: %d\n", ret); return ret);
+  ret = aclrtSynchronizeStream(stream);
+  CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("aclrtSynchronizeStream failed. ERROR: %d\n", ret); return ret);
+  if (workspaceSize > 0) {
+    aclrtFree(workspaceAddr);
+  }
+  return 0;
+}
+
+int main(int argc, char** argv) {
+  // x的保存格式：bfloat16（默认）、float16或int8，需与gen_data.py的入参一致
+  std::string xDtype = argc > 1 ? argv[1] : "bfloat16";
+  CHECK_RET(xDtype == "bfloat16" || xDtype == "float16" || xDtype == "int8",
+            ERROR_LOG("unsupported x dtype %s", xDtype.c_str()); return FAILED);
+  bool isInt8 = xDtype == "int8";
+
+  // 1. （固定写法）device/stream初始化，参考AscendCL对外接口列表
+  // 根据自己的实际device填写deviceId
+  int32_t deviceId = 0;
+  aclrtStream stream;
+  auto ret = Init(deviceId, &stream);
+  CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("Init acl failed. ERROR: %d\n", ret); return ret);
+
+  // 2. 构造输入与输出，需要根据API的接口自定义构造
+  // 前向为fp32，只保存压缩后的x；反向梯度仍为fp32。xFp32为未压缩的x，供aclnnSwiGluGrad对比
+  std::vector<int64_t> yGradShape = {2, 16};
+  std::vector<int64_t> xShape = {2, 32};
+  std::vector<int64_t> xScaleShape = {2};
+  std::vector<int64_t> outShape = {2, 32};
+  void* yGradDeviceAddr = nullptr;
+  void* xDeviceAddr = nullptr;
+  void* xScaleDeviceAddr = nullptr;
+  void* xFp32DeviceAddr = nullptr;
+  void* outDeviceAddr = nullptr;
+  void* outRefDeviceAddr = nullptr;
+  aclTensor* yGrad = nullptr;
+  aclTensor* x = nullptr;
+  aclTensor* xScale = nullptr;
+  aclTensor* xFp32 = nullptr;
+  aclTensor* out = nullptr;
+  aclTensor* outRef = nullptr;
+  size_t xShapeSize = GetShapeSize(xShape);
+  size_t yShapeSize = GetShapeSize(yGradShape);
+  std::vector<float> yGradHostData(yShapeSize, 0);
+  std::vector<float> xFp32HostData(xShapeSize, 0);
+  std::vector<float> outHostData(GetShapeSize(outShape), 0);
+  // 设定数据
+  size_t fileSize;
+  ReadFile("../input/grad_output.bin", fileSize, yGradHostData.data(), yShapeSize * sizeof(float));
+  ReadFile("../input/input_x_fp32.bin", fileSize, xFp32HostData.data(), xShapeSize * sizeof(float));
+  // 创建yGrad aclTensor
+  ret = CreateAclTensor(yGradHostData, yGradShape, &yGradDeviceAddr, aclDataType::ACL_FLOAT, &yGrad);
+  CHECK_RET(ret == ACL_SUCCESS, return ret);
+  // 创建x aclTensor，int8时同时创建逐行的xScale
+  if (isInt8) {
+    std::vector<int8_t> xHostData(xShapeSize, 0);
+    std::vector<float> xScaleHostData(GetShapeSize(xScaleShape), 0);
+    ReadFile("../input/input_x.bin", fileSize, xHostData.data(), xShapeSize * sizeof(int8_t));
+    ReadFile("../input/input_x_scale.bin", fileSize, xScaleHostData.data(), xScaleHostData.size() * sizeof(float));
+    ret = CreateAclTensor(xHostData, xShape, &xDeviceAddr, aclDataType::ACL_INT8, &x);
+    CHECK_RET(ret == ACL_SUCCESS, return ret);
+    ret = CreateAclTensor(xScaleHostData, xScaleShape, &xScaleDeviceAddr, aclDataType::ACL_FLOAT, &xScale);
+    CHECK_RET(ret == ACL_SUCCESS, return ret);
+  } else {
+    std::vector<uint16_t> xHostData(xShapeSize, 0);
+    ReadFile("../input/input_x.bin", fileSize, xHostData.data(), xShapeSize * sizeof(uint16_t));
+    ret = CreateAclTensor(xHostData, xShape, &xDeviceAddr,
+                          xDtype == "float16" ? aclDataType::ACL_FLOAT16 : aclDataType::ACL_BF16, &x);
+    CHECK_RET(ret == ACL_SUCCESS, return ret);
+  }
+  // 创建xFp32 aclTensor
+  ret = CreateAclTensor(xFp32HostData, xShape, &xFp32DeviceAddr, aclDataType::ACL_FLOAT, &xFp32);
+  CHECK_RET(ret == ACL_SUCCESS, return ret);
+  // 创建out与outRef aclTensor
+  ret = CreateAclTensor(outHostData, outShape, &outDeviceAddr, aclDataType::ACL_FLOAT, &out);
+  CHECK_RET(ret == ACL_SUCCESS, return ret);
+  ret = CreateAclTensor(outHostData, outShape, &outRefDeviceAddr, aclDataType::ACL_FLOAT, &outRef);
+  CHECK_RET(ret == ACL_SUCCESS, return ret);
+
+  // 3. 调用CANN算子库API，需要修改为具体的Api名称
+  uint64_t workspaceSize = 0;
+  aclOpExecutor* executor;
+  // 调用aclnnSwiGluGradRecompute第一段接口，x为浮点时xScale为空
+  ret = aclnnSwiGluGradRecomputeGetWorkspaceSize(yGrad, x, xScale, out, &workspaceSize, &executor);
+  CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("aclnnSwiGluGradRecomputeGetWorkspaceSize failed. ERROR: %d\n", ret); return ret);
+  // 调用aclnnSwiGluGradRecompute第二段接口
+  ret = RunWithWorkspace(workspaceSize, executor, stream, aclnnSwiGluGradRecompute);
+  CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("aclnnSwiGluGradRecompute failed. ERROR: %d\n", ret); return ret);
+
+  // 对比运行：aclnnSwiGluGrad在未压缩的fp32 x上计算，按最后一维切分
+  int64_t dim = -1;
+  ret = aclnnSwiGluGradGetWorkspaceSize(yGrad, xFp32, dim, outRef, &workspaceSize, &executor);
+  CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("aclnnSwiGluGradGetWorkspaceSize failed. ERROR: %d\n", ret); return ret);
+  ret = RunWithWorkspace(workspaceSize, executor, stream, aclnnSwiGluGrad);
+  CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("aclnnSwiGluGrad failed. ERROR: %d\n", ret); return ret);
+
+  // 4. 获取输出的值，将device侧内存上的结果拷贝至host侧并写出到bin文件，由verify_result.py比对
+  ret = WriteOutput("../output/output_out.bin", outShape, outDeviceAddr);
+  CHECK_RET(ret == ACL_SUCCESS, return ret);
+  ret = WriteOutput("../output/output_swi_glu_grad_out.bin", outShape, outRefDeviceAddr);
+  CHECK_RET(ret == ACL_SUCCESS, return ret);
+
+  // 5. 释放aclTensor和aclScalar，需要根据具体API的接口定义修改
+  aclDestroyTensor(yGrad);
+  aclDestroyTensor(x);
+  aclDestroyTensor(xFp32);
+  aclDestroyTensor(out);
+  aclDestroyTensor(outRef);
+  // 6. 释放device资源，需要根据具体API的接口定义修改
+  aclrtFree(yGradDeviceAddr);
+  aclrtFree(xDeviceAddr);
+  aclrtFree(xFp32DeviceAddr);
+  aclrtFree(outDeviceAddr);
+  aclrtFree(outRefDeviceAddr);
+  if (xScale != nullptr) {
+    aclDestroyTensor(xScale);
+    aclrtFree(xScaleDeviceAddr);
+  }
+  aclrtDestroyStream(stream);
+  aclrtResetDevice(deviceId);
+  aclFinalize();
+  return 0;
+}
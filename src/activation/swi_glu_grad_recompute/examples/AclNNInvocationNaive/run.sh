@@ -0,0 +1,77 @@
+#!/bin/bash
+# Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+# This file is a part of the CANN Open Software.
+# Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+# ======================================================================================================================
+
+if [ -n "$ASCEND_INSTALL_PATH" ]; then
+    _ASCEND_INSTALL_PATH=$ASCEND_INSTALL_PATH
+elif [ -n "$ASCEND_HOME_PATH" ]; then
+    _ASCEND_INSTALL_PATH=$ASCEND_HOME_PATH
+else
+    if [ -d "$HOME/Ascend/ascend-toolkit/latest" ]; then
+        _ASCEND_INSTALL_PATH=$HOME/Ascend/ascend-toolkit/latest
+    else
+        _ASCEND_INSTALL_PATH=/usr/local/Ascend/ascend-toolkit/latest
+    fi
+fi
+source $_ASCEND_INSTALL_PATH/bin/setenv.bash
+export DDK_PATH=$_ASCEND_INSTALL_PATH
+export NPU_HOST_LIB=$_ASCEND_INSTALL_PATH/lib64
+
+rm -rf $HOME/ascend/log/*
+
+set -e
+rm -rf build
+mkdir -p build
+cmake -B build
+cmake --build build -j
+set +e
+
+# 依次验证x按bf16、fp16、int8保存的场景，每个场景比对三组结果：
+# 重计算结果 vs fp32标杆、aclnnSwiGluGrad(未压缩x) vs fp32标杆、重计算结果 vs aclnnSwiGluGrad
+verify_pair() {
+    ret=`python3 verify_result.py $1 $2 $3`
+    echo "$4: $ret"
+    if [ "x$ret" != "xtest pass" ]; then
+        fail_num=$((fail_num + 1))
+    fi
+}
+
+fail_num=0
+for x_dtype in bfloat16 float16 int8; do
+    rm -f ./input/*.bin
+    rm -f ./output/*.bin
+    python3 gen_data.py $x_dtype
+    if [ $? -ne 0 ]; then
+        echo "ERROR: generate input data failed!"
+        return 1
+    fi
+    echo "INFO: generate input data for x $x_dtype success!"
+    (
+        cd build
+        ./execute_test_op $x_dtype
+    )
+    if [ $? -ne 0 ]; then
+        echo "ERROR: run x $x_dtype failed!"
+        fail_num=$((fail_num + 1))
+        continue
+    fi
+    verify_pair output/output_out.bin output/output_golden_out.bin $x_dtype "x $x_dtype recompute vs golden"
+    verify_pair output/output_swi_glu_grad_out.bin output/output_golden_out.bin float32 \
+        "x $x_dtype swi_glu_grad vs golden"
+    verify_pair output/output_out.bin output/output_swi_glu_grad_out.bin $x_dtype \
+        "x $x_dtype recompute vs swi_glu_grad"
+done
+
+if [ $fail_num -eq 0 ]; then
+    echo ""
+    echo "#####################################"
+    echo "INFO: you have passed the Precision!"
+    echo "#####################################"
+    echo ""
+fi
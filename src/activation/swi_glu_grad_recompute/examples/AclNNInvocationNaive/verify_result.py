@@ -0,0 +1,46 @@
+#!/usr/bin/python3
+# -*- coding:utf-8 -*-
+# Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+# This file is a part of the CANN Open Software.
+# Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+# ======================================================================================================================
+import os
+import sys
+import numpy as np
+
+# 按x的保存格式区分容忍偏差，绝对误差或相对误差在容忍偏差内即视为通过
+# float32：aclnnSwiGluGrad在未压缩x上的结果，只有计算误差
+# float16/bfloat16：x按半精度保存，误差主要来自x的舍入（分别约2^-11与2^-8）
+# int8：x按行对称量化，误差取决于每行绝对值最大值/127的量化步长
+LOSS_DICT = {
+    "float32": 1e-4,
+    "float16": 1e-3,
+    "bfloat16": 1e-2,
+    "int8": 5e-2,
+}
+MINIMUM = 10e-10
+
+
+def verify_result(real_result, golden, x_dtype="bfloat16"):
+    loss = LOSS_DICT[x_dtype]
+    dtype = np.float32
+    real_result = np.fromfile(real_result, dtype=dtype) # 从bin文件读取实际运算结果
+    golden = np.fromfile(golden, dtype=dtype) # 从bin文件读取预期运算结果
+    result = np.abs(real_result - golden) # 计算运算结果和预期结果偏差
+    deno = np.maximum(np.abs(real_result), np.abs(golden))  # 获取最大值并组成新数组
+    result_atol = np.less_equal(result, loss) # 计算绝对误差
+    result_rtol = np.less_equal(result / np.add(deno, MINIMUM), loss) # 计算相对误差
+    error_num = np.sum(np.logical_not(np.logical_or(result_atol, result_rtol)))
+    if error_num > 0: # 存在绝对误差和相对误差均超出容忍偏差的元素时，返回对比失败
+        print("[ERROR] values result error, {} of {} elements exceed {} for {}".format(
+            error_num, real_result.size, loss, x_dtype))
+        return False
+    print("test pass")
+    return True
+
+if __name__ == '__main__':
+    verify_result(sys.argv[1], sys.argv[2], sys.argv[3] if len(sys.argv) > 3 else "bfloat16")
@@ -0,0 +1,248 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file swi_glu_grad_recompute.cpp
+ * \brief tiling
+ */
+#include <algorithm>
+#include "register/op_def_registry.h"
+#include "tiling/tiling_api.h"
+#include "swi_glu_grad_recompute_tiling.h"
+
+#define OPS_CHECK_NULL_WITH_CONTEXT(context, ptr) \
+    if ((ptr) == nullptr) {                       \
+        std::printf("nullptr error!");            \
+        return ge::GRAPH_FAILED;                  \
+    }
+#define OP_LOGD(nodeName, fmt, ...) std::printf(fmt, ##__VA_ARGS__)
+
+#define VECTOR_INNER_ERR_REPORT_TILIING(op_name, err_msg, ...) std::printf(err_msg, ##__VA_ARGS__)
+#define OP_TILING_CHECK(cond, log_func, expr) \
+    do {                                      \
+        if (cond) {                           \
+            log_func;                         \
+            expr;                             \
+        }                                     \
+    } while (0)
+
+namespace optiling {
+constexpr size_t INPUT_Y_GRAD_INDEX = 0;
+constexpr size_t INPUT_X_INDEX = 1;
+constexpr size_t INPUT_X_SCALE_INDEX = 2;
+constexpr size_t OUTPUT_X_GRAD_INDEX = 0;
+constexpr int64_t SPLIT_NUM = 2;
+constexpr int64_t BUFFER_NUM = 2;
+constexpr int64_t FLOAT_SIZE = 4;
+constexpr int64_t BLOCK_BYTES = 32;
+// fp32中间结果：a、b、sigmoid与临时结果各一份，y_grad非fp32时另需一份转换后的y_grad
+constexpr int64_t FP32_BUF_NUM = 4;
+constexpr int64_t MAX_TILE_ROWS = 4095;
+// 按列切分给更多核时每段至少的列数
+constexpr int64_t MIN_SPLIT_COLS = 1024;
+// 每行一个x_scale，按8个对齐预留
+constexpr int64_t SCALE_ALIGN_NUM = 8;
+// 预留给标量栈与对齐的UB空间
+constexpr int64_t UB_RESERVED_BYTES = 2048;
+constexpr size_t SYS_WORKSPACE_SIZE = 16 * 1024 * 1024;
+
+template <typename T>
+inline T *GetCompileInfoPtr(gert::TilingParseContext *context)
+{
+    return context->GetCompiledInfo<T>();
+}
+
+inline static int64_t CeilDiv(int64_t value, int64_t factor)
+{
+    return factor == 0 ? value : (value + factor - 1) / factor;
+}
+
+inline static int64_t AlignUp(int64_t value, int64_t align)
+{
+    return CeilDiv(value, align) * align;
+}
+
+struct SwiGluGradRecomputeParams {
+    int64_t rowNum = 0;
+    int64_t colLen = 0;
+    int64_t xTypeSize = 0;
+    int64_t gradTypeSize = 0;
+    bool hasScale = false;
+};
+
+static ge::graphStatus CheckShapes(gert::TilingContext *context, SwiGluGradRecomputeParams &params)
+{
+    auto xShape = context->GetInputShape(INPUT_X_INDEX);
+    auto yGradShape = context->GetInputShape(INPUT_Y_GRAD_INDEX);
+    auto xGradShape = context->GetOutputShape(OUTPUT_X_GRAD_INDEX);
+    OPS_CHECK_NULL_WITH_CONTEXT(context, xShape);
+    OPS_CHECK_NULL_WITH_CONTEXT(context, yGradShape);
+    OPS_CHECK_NULL_WITH_CONTEXT(context, xGradShape);
+    const gert::Shape &x = xShape->GetStorageShape();
+    size_t dimNum = x.GetDimNum();
+    OP_TILING_CHECK(dimNum == 0,
+                    VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(), "x must have at least one dim."),
+                    return ge::GRAPH_FAILED);
+    int64_t lastDim = x.GetDim(dimNum - 1);
+    OP_TILING_CHECK(lastDim <= 0 || lastDim % SPLIT_NUM != 0,
+                    VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(),
+                        "The last dim(%ld) of x must be a positive even number.", lastDim),
+                    return ge::GRAPH_FAILED);
+    params.colLen = lastDim / SPLIT_NUM;
+    params.rowNum = x.GetShapeSize() / lastDim;
+    OP_TILING_CHECK(params.rowNum <= 0,
+                    VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(), "Empty x is not supported."),
+                    return ge::GRAPH_FAILED);
+    OP_TILING_CHECK(yGradShape->GetStorageShape().GetShapeSize() != params.rowNum * params.colLen ||
+                    xGradShape->GetStorageShape().GetShapeSize() != x.GetShapeSize(),
+                    VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(),
+                        "y_grad or x_grad shape is inconsistent with x."),
+                    return ge::GRAPH_FAILED);
+
+    // int8的x必须带逐行的x_scale，浮点的x不接受x_scale
+    auto scaleShape = context->GetOptionalInputShape(INPUT_X_SCALE_INDEX);
+    OP_TILING_CHECK(params.hasScale != (scaleShape != nullptr),
+                    VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(),
+                        "x_scale must be given if and only if x is int8."),
+                    return ge::GRAPH_FAILED);
+    OP_TILING_CHECK(params.hasScale && scaleShape->GetStorageShape().GetShapeSize() != params.rowNum,
+                    VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(),
+                        "x_scale size must equal the row num(%ld) of x.", params.rowNum),
+                    return ge::GRAPH_FAILED);
+    return ge::GRAPH_SUCCESS;
+}
+
+/*
+  整行能放进UB时一个任务为tileRows整行；放不下时一行切为colChunkNum段，各段等长，任务为一段。
+  行数少于核数时再按列切分，使小batch也能用满所有核。
+*/
+static ge::graphStatus CalcTileShape(gert::TilingContext *context, const SwiGluGradRecomputeParams &params,
+                                     int64_t coreNum, int64_t ubSize, SwiGluGradRecomputeTilingData &tiling)
+{
+    int64_t ubAvail = ubSize - UB_RESERVED_BYTES - SCALE_ALIGN_NUM * FLOAT_SIZE;
+    // 每个元素：a/b两路输入、y_grad、两路输出的双缓冲，以及fp32中间结果
+    int64_t fp32BufNum = params.gradTypeSize == FLOAT_SIZE ? FP32_BUF_NUM : FP32_BUF_NUM + 1;
+    int64_t perElem = BUFFER_NUM * (SPLIT_NUM * params.xTypeSize + (SPLIT_NUM + 1) * params.gradTypeSize) +
+                      fp32BufNum * FLOAT_SIZE;
+    int64_t perRow = params.hasScale ? FLOAT_SIZE : 0;
+    // UB行距须让各类型的行都32B对齐
+    int64_t elemAlign = BLOCK_BYTES / std::min(params.xTypeSize, params.gradTypeSize);
+    int64_t colLen = params.colLen;
+    int64_t rowsPerCore = CeilDiv(params.rowNum, coreNum);
+
+    int64_t tileRows = 1;
+    int64_t tileCols = colLen;
+    int64_t fitRows = ubAvail / (AlignUp(colLen, elemAlign) * perElem + perRow);
+    if (fitRows >= 1) {
+        tileRows = std::min(std::min(fitRows, MAX_TILE_ROWS), rowsPerCore);
+    } else {
+        int64_t maxCols = (ubAvail - perRow) / perElem / elemAlign * elemAlign;
+        OP_TILING_CHECK(maxCols < elemAlign,
+                        VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(), "UB size is too small."),
+                        return ge::GRAPH_FAILED);
+        tileCols = AlignUp(CeilDiv(colLen, CeilDiv(colLen, maxCols)), elemAlign);
+    }
+    if (params.rowNum < coreNum) {
+        int64_t wantChunks = CeilDiv(coreNum, params.rowNum);
+        int64_t splitCols = std::max(AlignUp(CeilDiv(colLen, wantChunks), elemAlign),
+                                     AlignUp(MIN_SPLIT_COLS, elemAlign));
+        tileCols = std::min(tileCols, splitCols);
+    }
+
+    int64_t colChunkNum = CeilDiv(colLen, tileCols);
+    int64_t rowTileNum = CeilDiv(params.rowNum, tileRows);
+    int64_t unitNum = rowTileNum * colChunkNum;
+    int64_t usedCoreNum = std::max<int64_t>(1, std::min(coreNum, unitNum));
+    tiling.set_rowNum(params.rowNum);
+    tiling.set_colLen(colLen);
+    tiling.set_tileRows(tileRows);
+    tiling.set_tileCols(tileCols);
+    tiling.set_alignCols(AlignUp(tileCols, elemAlign));
+    tiling.set_colChunkNum(colChunkNum);
+    tiling.set_rowTileNum(rowTileNum);
+    tiling.set_hasScale(params.hasScale ? 1 : 0);
+    tiling.set_unitNum(unitNum);
+    tiling.set_usedCoreNum(usedCoreNum);
+    tiling.set_unitsPerCore(unitNum / usedCoreNum);
+    tiling.set_tailCoreNum(unitNum % usedCoreNum);
+    return ge::GRAPH_SUCCESS;
+}
+
+static ge::graphStatus Tiling4SwiGluGradRecompute(gert::TilingContext *context)
+{
+    OP_LOGD(context->GetNodeName(), " Tiling4SwiGluGradRecompute is running.");
+    auto compileInfo = reinterpret_cast<const SwiGluGradRecomputeCompileInfo *>(context->GetCompileInfo());
+    auto ascendcPlatform = platform_ascendc::PlatformAscendC(context->GetPlatformInfo());
+    int64_t coreNum = (compileInfo == nullptr) ? ascendcPlatform.GetCoreNumAiv() : compileInfo->totalCoreNum;
+    uint64_t ubSize = 0;
+    if (compileInfo == nullptr) {
+        ascendcPlatform.GetCoreMemSize(platform_ascendc::CoreMemType::UB, ubSize);
+    } else {
+        ubSize = compileInfo->ubSize;
+    }
+    OP_TILING_CHECK(coreNum <= 0 || ubSize <= static_cast<uint64_t>(UB_RESERVED_BYTES),
+                    VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(), "Get core num or ub size failed."),
+                    return ge::GRAPH_FAILED);
+
+    auto xDesc = context->GetInputDesc(INPUT_X_INDEX);
+    auto yGradDesc = context->GetInputDesc(INPUT_Y_GRAD_INDEX);
+    OPS_CHECK_NULL_WITH_CONTEXT(context, xDesc);
+    OPS_CHECK_NULL_WITH_CONTEXT(context, yGradDesc);
+    SwiGluGradRecomputeParams params;
+    params.xTypeSize = ge::GetSizeByDataType(xDesc->GetDataType());
+    params.gradTypeSize = ge::GetSizeByDataType(yGradDesc->GetDataType());
+    params.hasScale = xDesc->GetDataType() == ge::DT_INT8;
+    OP_TILING_CHECK(params.xTypeSize <= 0 || params.gradTypeSize <= 0,
+                    VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(), "Unsupported dtype of x or y_grad."),
+                    return ge::GRAPH_FAILED);
+    OP_TILING_CHECK(CheckShapes(context, params) != ge::GRAPH_SUCCESS,
+                    VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(), "Input shape invalid."),
+                    return ge::GRAPH_FAILED);
+
+    SwiGluGradRecomputeTilingData tiling;
+    OP_TILING_CHECK(CalcTileShape(context, params, coreNum, static_cast<int64_t>(ubSize), tiling) != ge::GRAPH_SUCCESS,
+                    VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(), "CalcTileShape failed."),
+                    return ge::GRAPH_FAILED);
+
+    context->SetBlockDim(static_cast<uint32_t>(tiling.get_usedCoreNum()));
+    context->SetTilingKey(1);
+    tiling.SaveToBuffer(context->GetRawTilingData()->GetData(), context->GetRawTilingData()->GetCapacity());
+    context->GetRawTilingData()->SetDataSize(tiling.GetDataSize());
+
+    size_t *currentWorkspace = context->GetWorkspaceSizes(1);
+    currentWorkspace[0] = SYS_WORKSPACE_SIZE;
+
+    OP_LOGD(context->GetNodeName(), "rowNum: %ld, colLen: %ld, tileRows: %ld, tileCols: %ld, colChunkNum: %ld, "
+            "usedCoreNum: %ld\n", tiling.get_rowNum(), tiling.get_colLen(), tiling.get_tileRows(),
+            tiling.get_tileCols(), tiling.get_colChunkNum(), tiling.get_usedCoreNum());
+    return ge::GRAPH_SUCCESS;
+}
+
+static ge::graphStatus TilingPrepare4SwiGluGradRecompute(gert::TilingParseContext *context)
+{
+    OP_LOGD(context->GetNodeName(), "TilingPrepare4SwiGluGradRecompute running.");
+    auto compileInfo = GetCompileInfoPtr<SwiGluGradRecomputeCompileInfo>(context);
+    OPS_CHECK_NULL_WITH_CONTEXT(context, compileInfo);
+    auto platformInfo = context->GetPlatformInfo();
+    OPS_CHECK_NULL_WITH_CONTEXT(context, platformInfo);
+    auto ascendcPlatform = platform_ascendc::PlatformAscendC(platformInfo);
+    compileInfo->totalCoreNum = ascendcPlatform.GetCoreNumAiv();
+    ascendcPlatform.GetCoreMemSize(platform_ascendc::CoreMemType::UB, compileInfo->ubSize);
+    OP_TILING_CHECK((compileInfo->totalCoreNum <= 0 || compileInfo->ubSize == 0),
+                    VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(),
+                        "TilingPrepare4SwiGluGradRecompute fail to get core num or ub size."),
+                    return ge::GRAPH_FAILED);
+    return ge::GRAPH_SUCCESS;
+}
+
+IMPL_OP_OPTILING(SwiGluGradRecompute)
+    .Tiling(Tiling4SwiGluGradRecompute)
+    .TilingParse<SwiGluGradRecomputeCompileInfo>(TilingPrepare4SwiGluGradRecompute);
+}  // namespace optiling
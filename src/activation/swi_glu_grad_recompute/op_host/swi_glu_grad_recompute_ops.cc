@@ -0,0 +1,55 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file swi_glu_grad_recompute_ops.cc
+ * \brief
+ */
+#include "register/op_def_registry.h"
+
+#define OP_LOGD(nodeName, fmt, ...)  \
+    std::printf(fmt, ##__VA_ARGS__); \
+    std::printf("\n")
+#define OPS_CHECK_NULL_WITH_CONTEXT(context, ptr) \
+    if ((ptr) == nullptr) {                       \
+        std::printf("nullptr error!");            \
+        return ge::GRAPH_FAILED;                  \
+    }
+
+using namespace ge;
+
+namespace ops {
+constexpr size_t INPUT_Y_GRAD_INDEX = 0;
+constexpr size_t INPUT_X_INDEX = 1;
+constexpr size_t OUTPUT_X_GRAD_INDEX = 0;
+
+// x_grad与x同shape，数据类型与y_grad一致
+static ge::graphStatus InfershapeForSwiGluGradRecompute(gert::InferShapeContext *context)
+{
+    OP_LOGD(context->GetNodeName(), "InfershapeForSwiGluGradRecompute enter");
+    auto xShape = context->GetInputShape(INPUT_X_INDEX);
+    OPS_CHECK_NULL_WITH_CONTEXT(context, xShape);
+    auto xGradShape = context->GetOutputShape(OUTPUT_X_GRAD_INDEX);
+    OPS_CHECK_NULL_WITH_CONTEXT(context, xGradShape);
+    *xGradShape = *xShape;
+    return ge::GRAPH_SUCCESS;
+}
+
+static ge::graphStatus InferDataTypeForSwiGluGradRecompute(gert::InferDataTypeContext *context)
+{
+    context->SetOutputDataType(OUTPUT_X_GRAD_INDEX, context->GetInputDataType(INPUT_Y_GRAD_INDEX));
+    return ge::GRAPH_SUCCESS;
+}
+
+IMPL_OP_INFERSHAPE(SwiGluGradRecompute)
+    .InferShape(InfershapeForSwiGluGradRecompute)
+    .InferDataType(InferDataTypeForSwiGluGradRecompute);
+
+}  // namespace ops
@@ -0,0 +1,257 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file swi_glu_grad_recompute.h
+ * \brief
+ */
+#ifndef SWI_GLU_GRAD_RECOMPUTE_H
+#define SWI_GLU_GRAD_RECOMPUTE_H
+
+#include "kernel_operator.h"
+
+namespace SwiGluGradRecompute {
+using namespace AscendC;
+
+constexpr int64_t BUFFER_NUM = 2;
+constexpr int64_t BLOCK_BYTES = 32;
+
+/*
+  前向只保存压缩后的x（bf16/fp16，或int8加逐行x_scale），反向在UB内还原为fp32后重算sigmoid：
+    sig = 1 / (1 + exp(-a)), silu = a * sig
+    da = y_grad * b * sig * (1 + a - silu)
+    db = y_grad * silu
+  x不写回任何fp32副本，中间结果只占a、b、sig、tmp四块fp32空间，y_grad非fp32时另加一块。
+*/
+template <typename gradDtype, typename xDtype>
+class KernelSwiGluGradRecompute {
+public:
+    __aicore__ inline KernelSwiGluGradRecompute(TPipe *pipe)
+    {
+        Ppipe = pipe;
+    }
+    __aicore__ inline void Init(GM_ADDR y_grad, GM_ADDR x, GM_ADDR x_scale, GM_ADDR x_grad,
+                                const SwiGluGradRecomputeTilingData *tilingData)
+    {
+        tiling = tilingData;
+        colLen = tiling->colLen;
+        alignCols = tiling->alignCols;
+
+        int64_t blockIdx = GetBlockIdx();
+        unitStart = blockIdx * tiling->unitsPerCore +
+                    (blockIdx < tiling->tailCoreNum ? blockIdx : tiling->tailCoreNum);
+        unitEnd = unitStart + tiling->unitsPerCore + (blockIdx < tiling->tailCoreNum ? 1 : 0);
+
+        yGradGm.SetGlobalBuffer((__gm__ gradDtype *)y_grad);
+        xGm.SetGlobalBuffer((__gm__ xDtype *)x);
+        xGradGm.SetGlobalBuffer((__gm__ gradDtype *)x_grad);
+
+        int64_t maxElems = tiling->tileRows * alignCols;
+        Ppipe->InitBuffer(inQueueA, BUFFER_NUM, maxElems * sizeof(xDtype));
+        Ppipe->InitBuffer(inQueueB, BUFFER_NUM, maxElems * sizeof(xDtype));
+        Ppipe->InitBuffer(inQueueG, BUFFER_NUM, maxElems * sizeof(gradDtype));
+        Ppipe->InitBuffer(outQueueA, BUFFER_NUM, maxElems * sizeof(gradDtype));
+        Ppipe->InitBuffer(outQueueB, BUFFER_NUM, maxElems * sizeof(gradDtype));
+        Ppipe->InitBuffer(aBuf, maxElems * sizeof(float));
+        Ppipe->InitBuffer(bBuf, maxElems * sizeof(float));
+        Ppipe->InitBuffer(sigBuf, maxElems * sizeof(float));
+        Ppipe->InitBuffer(tmpBuf, maxElems * sizeof(float));
+        if constexpr (!IsSameType<gradDtype, float>::value) {
+            Ppipe->InitBuffer(gradBuf, maxElems * sizeof(float));
+        }
+        if (tiling->hasScale) {
+            xScaleGm.SetGlobalBuffer((__gm__ float *)x_scale, tiling->rowNum);
+            Ppipe->InitBuffer(scaleBuf, (tiling->tileRows * sizeof(float) + BLOCK_BYTES - 1) / BLOCK_BYTES *
+                                        BLOCK_BYTES);
+        }
+    }
+
+    __aicore__ inline void Process()
+    {
+        for (int64_t unit = unitStart; unit < unitEnd; unit++) {
+            int64_t rowStart = unit / tiling->colChunkNum * tiling->tileRows;
+            int64_t colStart = unit % tiling->colChunkNum * tiling->tileCols;
+            int64_t rows = tiling->rowNum - rowStart;
+            rows = rows > tiling->tileRows ? tiling->tileRows : rows;
+            int64_t cols = colLen - colStart;
+            cols = cols > tiling->tileCols ? tiling->tileCols : cols;
+            CopyIn(rowStart, rows, colStart, cols);
+            Compute(rows);
+            CopyOut(rowStart, rows, colStart, cols);
+        }
+    }
+
+private:
+    template <HardEvent event>
+    __aicore__ inline void PipeSync()
+    {
+        event_t eventId = static_cast<event_t>(GetTPipePtr()->FetchEventID(event));
+        SetFlag<event>(eventId);
+        WaitFlag<event>(eventId);
+    }
+
+    // a、b与y_grad各搬rows行，UB行距为alignCols个元素
+    __aicore__ inline void CopyIn(int64_t rowStart, int64_t rows, int64_t colStart, int64_t cols)
+    {
+        int64_t xColBytes = cols * sizeof(xDtype);
+        int64_t xPadBytes = (xColBytes + BLOCK_BYTES - 1) / BLOCK_BYTES * BLOCK_BYTES;
+        DataCopyExtParams xParams{static_cast<uint16_t>(rows), static_cast<uint32_t>(xColBytes),
+                                  static_cast<uint32_t>((2 * colLen - cols) * sizeof(xDtype)),
+                                  static_cast<uint32_t>((alignCols * sizeof(xDtype) - xPadBytes) / BLOCK_BYTES), 0};
+        DataCopyPadExtParams<xDtype> xPadParams{false, 0, 0, 0};
+        int64_t xOffset = rowStart * 2 * colLen + colStart;
+        LocalTensor<xDtype> aLocal = inQueueA.AllocTensor<xDtype>();
+        DataCopyPad(aLocal, xGm[xOffset], xParams, xPadParams);
+        inQueueA.EnQue(aLocal);
+        LocalTensor<xDtype> bLocal = inQueueB.AllocTensor<xDtype>();
+        DataCopyPad(bLocal, xGm[xOffset + colLen], xParams, xPadParams);
+        inQueueB.EnQue(bLocal);
+
+        int64_t gColBytes = cols * sizeof(gradDtype);
+        int64_t gPadBytes = (gColBytes + BLOCK_BYTES - 1) / BLOCK_BYTES * BLOCK_BYTES;
+        DataCopyExtParams gParams{static_cast<uint16_t>(rows), static_cast<uint32_t>(gColBytes),
+                                  static_cast<uint32_t>((colLen - cols) * sizeof(gradDtype)),
+                                  static_cast<uint32_t>((alignCols * sizeof(gradDtype) - gPadBytes) / BLOCK_BYTES), 0};
+        DataCopyPadExtParams<gradDtype> gPadParams{false, 0, 0, 0};
+        LocalTensor<gradDtype> gLocal = inQueueG.AllocTensor<gradDtype>();
+        DataCopyPad(gLocal, yGradGm[rowStart * colLen + colStart], gParams, gPadParams);
+        inQueueG.EnQue(gLocal);
+
+        if (tiling->hasScale) {
+            LocalTensor<float> scaleLocal = scaleBuf.Get<float>();
+            DataCopyExtParams scaleParams{1, static_cast<uint32_t>(rows * sizeof(float)), 0, 0, 0};
+            DataCopyPadExtParams<float> scalePadParams{false, 0, 0, 0};
+            DataCopyPad(scaleLocal, xScaleGm[rowStart], scaleParams, scalePadParams);
+            PipeSync<HardEvent::MTE2_S>();
+        }
+    }
+
+    // 压缩的x还原为fp32：浮点直接转换，int8经half转换后逐行乘x_scale
+    __aicore__ inline void Decompress(const LocalTensor<float> &dst, TQue<QuePosition::VECIN, BUFFER_NUM> &queue,
+                                      int64_t rows)
+    {
+        int64_t count = rows * alignCols;
+        LocalTensor<xDtype> src = queue.DeQue<xDtype>();
+        if constexpr (IsSameType<xDtype, int8_t>::value) {
+            LocalTensor<half> stage = tmpBuf.Get<half>();
+            Cast(stage, src, RoundMode::CAST_NONE, count);
+            PipeBarrier<PIPE_V>();
+            Cast(dst, stage, RoundMode::CAST_NONE, count);
+            PipeBarrier<PIPE_V>();
+            LocalTensor<float> scaleLocal = scaleBuf.Get<float>();
+            for (int64_t r = 0; r < rows; r++) {
+                Muls(dst[r * alignCols], dst[r * alignCols], scaleLocal.GetValue(r), alignCols);
+            }
+        } else {
+            Cast(dst, src, RoundMode::CAST_NONE, count);
+        }
+        PipeBarrier<PIPE_V>();
+        queue.FreeTensor(src);
+    }
+
+    __aicore__ inline void Compute(int64_t rows)
+    {
+        int64_t count = rows * alignCols;
+        LocalTensor<float> aLocal = aBuf.Get<float>();
+        LocalTensor<float> bLocal = bBuf.Get<float>();
+        LocalTensor<float> sigLocal = sigBuf.Get<float>();
+        LocalTensor<float> tmpLocal = tmpBuf.Get<float>();
+        Decompress(aLocal, inQueueA, rows);
+        Decompress(bLocal, inQueueB, rows);
+
+        // sig = 1 / (1 + exp(-a))
+        Muls(sigLocal, aLocal, -1.0f, count);
+        PipeBarrier<PIPE_V>();
+        Exp(sigLocal, sigLocal, count);
+        PipeBarrier<PIPE_V>();
+        Adds(sigLocal, sigLocal, 1.0f, count);
+        Duplicate(tmpLocal, 1.0f, count);
+        PipeBarrier<PIPE_V>();
+        Div(sigLocal, tmpLocal, sigLocal, count);
+        PipeBarrier<PIPE_V>();
+
+        // tmp = silu, a <- sig * (1 + a - silu) * b
+        Mul(tmpLocal, aLocal, sigLocal, count);
+        PipeBarrier<PIPE_V>();
+        Sub(aLocal, aLocal, tmpLocal, count);
+        PipeBarrier<PIPE_V>();
+        Adds(aLocal, aLocal, 1.0f, count);
+        PipeBarrier<PIPE_V>();
+        Mul(aLocal, aLocal, sigLocal, count);
+        PipeBarrier<PIPE_V>();
+        Mul(aLocal, aLocal, bLocal, count);
+        PipeBarrier<PIPE_V>();
+
+        LocalTensor<gradDtype> gLocal = inQueueG.DeQue<gradDtype>();
+        LocalTensor<gradDtype> daLocal = outQueueA.AllocTensor<gradDtype>();
+        LocalTensor<gradDtype> dbLocal = outQueueB.AllocTensor<gradDtype>();
+        if constexpr (IsSameType<gradDtype, float>::value) {
+            Mul(daLocal, aLocal, gLocal, count);
+            Mul(dbLocal, tmpLocal, gLocal, count);
+            PipeBarrier<PIPE_V>();
+        } else {
+            LocalTensor<float> gradLocal = gradBuf.Get<float>();
+            Cast(gradLocal, gLocal, RoundMode::CAST_NONE, count);
+            PipeBarrier<PIPE_V>();
+            Mul(aLocal, aLocal, gradLocal, count);
+            Mul(tmpLocal, tmpLocal, gradLocal, count);
+            PipeBarrier<PIPE_V>();
+            Cast(daLocal, aLocal, RoundMode::CAST_RINT, count);
+            Cast(dbLocal, tmpLocal, RoundMode::CAST_RINT, count);
+            PipeBarrier<PIPE_V>();
+        }
+        inQueueG.FreeTensor(gLocal);
+        outQueueA.EnQue(daLocal);
+        outQueueB.EnQue(dbLocal);
+    }
+
+    __aicore__ inline void CopyOut(int64_t rowStart, int64_t rows, int64_t colStart, int64_t cols)
+    {
+        int64_t colBytes = cols * sizeof(gradDtype);
+        int64_t padBytes = (colBytes + BLOCK_BYTES - 1) / BLOCK_BYTES * BLOCK_BYTES;
+        DataCopyExtParams copyParams{static_cast<uint16_t>(rows), static_cast<uint32_t>(colBytes),
+                                     static_cast<uint32_t>((alignCols * sizeof(gradDtype) - padBytes) / BLOCK_BYTES),
+                                     static_cast<uint32_t>((2 * colLen - cols) * sizeof(gradDtype)), 0};
+        int64_t offset = rowStart * 2 * colLen + colStart;
+        LocalTensor<gradDtype> daLocal = outQueueA.DeQue<gradDtype>();
+        DataCopyPad(xGradGm[offset], daLocal, copyParams);
+        outQueueA.FreeTensor(daLocal);
+        LocalTensor<gradDtype> dbLocal = outQueueB.DeQue<gradDtype>();
+        DataCopyPad(xGradGm[offset + colLen], dbLocal, copyParams);
+        outQueueB.FreeTensor(dbLocal);
+    }
+
+private:
+    TPipe *Ppipe = nullptr;
+    const SwiGluGradRecomputeTilingData *tiling = nullptr;
+    TQue<QuePosition::VECIN, BUFFER_NUM> inQueueA;
+    TQue<QuePosition::VECIN, BUFFER_NUM> inQueueB;
+    TQue<QuePosition::VECIN, BUFFER_NUM> inQueueG;
+    TQue<QuePosition::VECOUT, BUFFER_NUM> outQueueA;
+    TQue<QuePosition::VECOUT, BUFFER_NUM> outQueueB;
+    TBuf<TPosition::VECCALC> aBuf;
+    TBuf<TPosition::VECCALC> bBuf;
+    TBuf<TPosition::VECCALC> sigBuf;
+    TBuf<TPosition::VECCALC> tmpBuf;
+    TBuf<TPosition::VECCALC> gradBuf;
+    TBuf<TPosition::VECCALC> scaleBuf;
+
+    GlobalTensor<gradDtype> yGradGm;
+    GlobalTensor<xDtype> xGm;
+    GlobalTensor<float> xScaleGm;
+    GlobalTensor<gradDtype> xGradGm;
+
+    int64_t colLen = 0;
+    int64_t alignCols = 0;
+    int64_t unitStart = 0;
+    int64_t unitEnd = 0;
+};
+}  // namespace SwiGluGradRecompute
+#endif  // SWI_GLU_GRAD_RECOMPUTE_H
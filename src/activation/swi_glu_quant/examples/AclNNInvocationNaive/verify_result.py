@@ -0,0 +1,46 @@
+#!/usr/bin/python3
+# -*- coding:utf-8 -*-
+# Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+# This file is a part of the CANN Open Software.
+# Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+# ======================================================================================================================
+import os
+import sys
+import numpy as np
+
+LOSS = 1e-3 # 容忍偏差，一般fp16要求绝对误差和相对误差均不超过千分之一
+MINIMUM = 10e-10
+QUANT_LOSS = 1 # 量化结果允许的最大绝对误差
+
+
+def verify_result(real_result, golden):
+    dtype = np.float32
+    real_result = np.fromfile(real_result, dtype=dtype) # 从bin文件读取实际运算结果
+    golden = np.fromfile(golden, dtype=dtype) # 从bin文件读取预期运算结果
+    result = np.abs(real_result - golden) # 计算运算结果和预期结果偏差
+    deno = np.maximum(np.abs(real_result), np.abs(golden))  # 获取最大值并组成新数组
+    result_atol = np.less_equal(result, LOSS) # 计算绝对误差
+    result_rtol = np.less_equal(result / np.add(deno, MINIMUM), LOSS) # 计算相对误差
+    if not result_rtol.all() and not result_atol.all():
+        if np.sum(result_rtol == False) > real_result.size * LOSS and \
+           np.sum(result_atol == False) > real_result.size * LOSS: # 误差超出预期时返回打印错误，返回对比失败
+            return False
+    return True
+
+
+def verify_quant_result(real_result, golden):
+    real_result = np.fromfile(real_result, dtype=np.int8).astype(np.int32)
+    golden = np.fromfile(golden, dtype=np.int8).astype(np.int32)
+    # 舍入位置附近的值允许相差1
+    return np.max(np.abs(real_result - golden)) <= QUANT_LOSS
+
+
+if __name__ == '__main__':
+    if verify_quant_result(sys.argv[1], sys.argv[2]) and verify_result(sys.argv[3], sys.argv[4]):
+        print("test pass")
+    else:
+        print("[ERROR] values result error")
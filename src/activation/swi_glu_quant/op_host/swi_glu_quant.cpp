@@ -0,0 +1,296 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file swi_glu_quant.cpp
+ * \brief tiling
+ */
+#include <algorithm>
+#include "register/op_def_registry.h"
+#include "tiling/tiling_api.h"
+#include "swi_glu_quant_tiling.h"
+
+#define OPS_CHECK_NULL_WITH_CONTEXT(context, ptr) \
+    if ((ptr) == nullptr) {                       \
+        std::printf("nullptr error!");            \
+        return ge::GRAPH_FAILED;                  \
+    }
+#define OP_LOGD(nodeName, fmt, ...) std::printf(fmt, ##__VA_ARGS__)
+
+#define VECTOR_INNER_ERR_REPORT_TILIING(op_name, err_msg, ...) std::printf(err_msg, ##__VA_ARGS__)
+#define OP_TILING_CHECK(cond, log_func, expr) \
+    do {                                      \
+        if (cond) {                           \
+            log_func;                         \
+            expr;                             \
+        }                                     \
+    } while (0)
+
+namespace optiling {
+constexpr size_t INPUT_X_INDEX = 0;
+constexpr size_t INPUT_SMOOTH_INDEX = 1;
+constexpr size_t OUTPUT_Y_INDEX = 0;
+constexpr size_t OUTPUT_SCALE_INDEX = 1;
+constexpr size_t ATTR_DST_TYPE_INDEX = 0;
+constexpr size_t ATTR_GROUP_SIZE_INDEX = 1;
+constexpr int64_t SPLIT_NUM = 2;
+constexpr int64_t BUFFER_NUM = 2;
+constexpr int64_t FLOAT_SIZE = 4;
+// UB行距按输出对齐：int8为32个元素，int4为64个元素，同时满足输入与fp32中间结果的32B对齐
+constexpr int64_t ELEM_ALIGN_INT8 = 32;
+constexpr int64_t ELEM_ALIGN_INT4 = 64;
+constexpr int64_t MAX_GROUP_SIZE = 1024;
+// 单行求最大值时一条Max指令的repeat上限为255，行长不超过256 * 64个fp32
+constexpr int64_t MAX_REDUCE_LEN = 16384;
+constexpr int64_t MAX_TILE_ROWS = 4095;
+// 按列切分给更多核时每段至少的列数
+constexpr int64_t MIN_SPLIT_COLS = 1024;
+// 每行：scale双缓冲；每个分组：scale双缓冲 + max + brcb(8个fp32)
+constexpr int64_t UB_PER_ROW = 2 * FLOAT_SIZE;
+constexpr int64_t UB_PER_GROUP = 2 * FLOAT_SIZE + FLOAT_SIZE + 8 * FLOAT_SIZE;
+// scale类缓冲按8个对齐，按多出的8组预留
+constexpr int64_t SCALE_ALIGN_NUM = 8;
+// 预留给标量栈与对齐的UB空间
+constexpr int64_t UB_RESERVED_BYTES = 2048;
+constexpr size_t SYS_WORKSPACE_SIZE = 16 * 1024 * 1024;
+
+template <typename T>
+inline T *GetCompileInfoPtr(gert::TilingParseContext *context)
+{
+    return context->GetCompiledInfo<T>();
+}
+
+inline static int64_t CeilDiv(int64_t value, int64_t factor)
+{
+    return factor == 0 ? value : (value + factor - 1) / factor;
+}
+
+inline static int64_t AlignUp(int64_t value, int64_t align)
+{
+    return CeilDiv(value, align) * align;
+}
+
+struct SwiGluQuantParams {
+    int64_t rowNum = 0;
+    int64_t colLen = 0;
+    int64_t groupSize = 0;
+    int64_t typeSize = 0;
+    int64_t elemAlign = ELEM_ALIGN_INT8;
+    bool hasSmooth = false;
+};
+
+static ge::graphStatus CheckShapes(gert::TilingContext *context, SwiGluQuantParams &params)
+{
+    auto xShape = context->GetInputShape(INPUT_X_INDEX);
+    OPS_CHECK_NULL_WITH_CONTEXT(context, xShape);
+    const gert::Shape &x = xShape->GetStorageShape();
+    size_t dimNum = x.GetDimNum();
+    OP_TILING_CHECK(dimNum == 0,
+                    VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(), "x must have at least one dim."),
+                    return ge::GRAPH_FAILED);
+    int64_t lastDim = x.GetDim(dimNum - 1);
+    OP_TILING_CHECK(lastDim <= 0 || lastDim % SPLIT_NUM != 0,
+                    VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(),
+                        "The last dim(%ld) of x must be a positive even number.", lastDim),
+                    return ge::GRAPH_FAILED);
+    params.colLen = lastDim / SPLIT_NUM;
+    params.rowNum = x.GetShapeSize() / lastDim;
+    OP_TILING_CHECK(params.rowNum <= 0,
+                    VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(), "Empty x is not supported."),
+                    return ge::GRAPH_FAILED);
+    OP_TILING_CHECK(params.elemAlign == ELEM_ALIGN_INT4 && params.colLen % SPLIT_NUM != 0,
+                    VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(),
+                        "The output last dim(%ld) must be even when y is int4.", params.colLen),
+                    return ge::GRAPH_FAILED);
+
+    if (params.groupSize > 0) {
+        OP_TILING_CHECK(params.groupSize % params.elemAlign != 0 || params.groupSize > MAX_GROUP_SIZE ||
+                        params.colLen % params.groupSize != 0,
+                        VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(),
+                            "group_size(%ld) must be a multiple of %ld, no more than %ld and divide the output "
+                            "last dim(%ld).", params.groupSize, params.elemAlign, MAX_GROUP_SIZE, params.colLen),
+                        return ge::GRAPH_FAILED);
+    }
+
+    auto smoothShape = context->GetOptionalInputShape(INPUT_SMOOTH_INDEX);
+    params.hasSmooth = smoothShape != nullptr;
+    OP_TILING_CHECK(params.hasSmooth && smoothShape->GetStorageShape().GetShapeSize() != params.colLen,
+                    VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(),
+                        "smooth_scales size must equal the output last dim(%ld).", params.colLen),
+                    return ge::GRAPH_FAILED);
+
+    auto yShape = context->GetOutputShape(OUTPUT_Y_INDEX);
+    auto scaleShape = context->GetOutputShape(OUTPUT_SCALE_INDEX);
+    OPS_CHECK_NULL_WITH_CONTEXT(context, yShape);
+    OPS_CHECK_NULL_WITH_CONTEXT(context, scaleShape);
+    int64_t scalePerRow = params.groupSize > 0 ? params.colLen / params.groupSize : 1;
+    OP_TILING_CHECK(yShape->GetStorageShape().GetShapeSize() != params.rowNum * params.colLen ||
+                    scaleShape->GetStorageShape().GetShapeSize() != params.rowNum * scalePerRow,
+                    VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(), "y or scale shape is inconsistent with x."),
+                    return ge::GRAPH_FAILED);
+    return ge::GRAPH_SUCCESS;
+}
+
+/*
+  per-token：整行能放进UB时一个任务为tileRows整行；放不下时一行切为colChunkNum段，各段等长，任务为一行。
+  per-group：整行放得下时同上；放不下，或行数少于核数时，按整组切列，任务为(行, 列段)。
+*/
+static ge::graphStatus CalcTileShape(gert::TilingContext *context, const SwiGluQuantParams &params,
+                                     int64_t coreNum, int64_t ubSize, SwiGluQuantTilingData &tiling)
+{
+    int64_t ubAvail = ubSize - UB_RESERVED_BYTES - SCALE_ALIGN_NUM * UB_PER_GROUP;
+    // 每个元素：a/b两路输入与int8输出的双缓冲，fp32结果与中间结果各一份
+    int64_t perElem = BUFFER_NUM * (SPLIT_NUM * params.typeSize + 1) + SPLIT_NUM * FLOAT_SIZE;
+    int64_t perCol = params.hasSmooth ? FLOAT_SIZE : 0;
+    int64_t colLen = params.colLen;
+    int64_t groupSize = params.groupSize;
+    int64_t rowsPerCore = CeilDiv(params.rowNum, coreNum);
+
+    int64_t tileRows = 1;
+    int64_t tileCols = colLen;
+    if (groupSize > 0) {
+        int64_t rowBytes = colLen * perElem + colLen / groupSize * UB_PER_GROUP;
+        int64_t fitRows = (ubAvail - colLen * perCol) / rowBytes;
+        if (fitRows >= 1) {
+            tileRows = std::min(std::min(fitRows, MAX_TILE_ROWS), rowsPerCore);
+        } else {
+            int64_t fitGroups = ubAvail / (groupSize * (perElem + perCol) + UB_PER_GROUP);
+            OP_TILING_CHECK(fitGroups < 1,
+                            VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(),
+                                "group_size(%ld) exceeds ub.", groupSize),
+                            return ge::GRAPH_FAILED);
+            tileCols = fitGroups * groupSize;
+        }
+        // 行数不够分给所有核时再按列切分
+        if (params.rowNum < coreNum) {
+            int64_t wantChunks = CeilDiv(coreNum, params.rowNum);
+            int64_t splitCols = std::max(AlignUp(CeilDiv(colLen, wantChunks), groupSize),
+                                         AlignUp(MIN_SPLIT_COLS, groupSize));
+            tileCols = std::min(tileCols, splitCols);
+        }
+    } else {
+        int64_t alignCols = AlignUp(colLen, params.elemAlign);
+        int64_t fitRows = (ubAvail - alignCols * perCol) / (alignCols * perElem + UB_PER_ROW);
+        if (alignCols <= MAX_REDUCE_LEN && fitRows >= 1) {
+            tileRows = std::min(std::min(fitRows, MAX_TILE_ROWS), rowsPerCore);
+        } else {
+            int64_t maxCols = (ubAvail - UB_PER_ROW) / (perElem + perCol) / params.elemAlign * params.elemAlign;
+            maxCols = std::min(maxCols, MAX_REDUCE_LEN);
+            OP_TILING_CHECK(maxCols < params.elemAlign,
+                            VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(), "UB size is too small."),
+                            return ge::GRAPH_FAILED);
+            tileCols = AlignUp(CeilDiv(colLen, CeilDiv(colLen, maxCols)), params.elemAlign);
+        }
+    }
+
+    int64_t colChunkNum = CeilDiv(colLen, tileCols);
+    int64_t rowTileNum = CeilDiv(params.rowNum, tileRows);
+    int64_t unitNum = groupSize > 0 ? rowTileNum * colChunkNum : rowTileNum;
+    int64_t usedCoreNum = std::max<int64_t>(1, std::min(coreNum, unitNum));
+    tiling.set_rowNum(params.rowNum);
+    tiling.set_colLen(colLen);
+    tiling.set_groupSize(groupSize);
+    tiling.set_groupPerRow(groupSize > 0 ? colLen / groupSize : 1);
+    tiling.set_tileRows(tileRows);
+    tiling.set_tileCols(tileCols);
+    tiling.set_alignCols(AlignUp(tileCols, params.elemAlign));
+    tiling.set_colChunkNum(colChunkNum);
+    tiling.set_rowTileNum(rowTileNum);
+    tiling.set_hasSmooth(params.hasSmooth ? 1 : 0);
+    tiling.set_unitNum(unitNum);
+    tiling.set_usedCoreNum(usedCoreNum);
+    tiling.set_unitsPerCore(unitNum / usedCoreNum);
+    tiling.set_tailCoreNum(unitNum % usedCoreNum);
+    return ge::GRAPH_SUCCESS;
+}
+
+static ge::graphStatus Tiling4SwiGluQuant(gert::TilingContext *context)
+{
+    OP_LOGD(context->GetNodeName(), " Tiling4SwiGluQuant is running.");
+    auto compileInfo = reinterpret_cast<const SwiGluQuantCompileInfo *>(context->GetCompileInfo());
+    auto ascendcPlatform = platform_ascendc::PlatformAscendC(context->GetPlatformInfo());
+    int64_t coreNum = (compileInfo == nullptr) ? ascendcPlatform.GetCoreNumAiv() : compileInfo->totalCoreNum;
+    uint64_t ubSize = 0;
+    if (compileInfo == nullptr) {
+        ascendcPlatform.GetCoreMemSize(platform_ascendc::CoreMemType::UB, ubSize);
+    } else {
+        ubSize = compileInfo->ubSize;
+    }
+    OP_TILING_CHECK(coreNum <= 0 || ubSize <= static_cast<uint64_t>(UB_RESERVED_BYTES + SCALE_ALIGN_NUM * UB_PER_GROUP),
+                    VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(), "Get core num or ub size failed."),
+                    return ge::GRAPH_FAILED);
+
+    auto attrs = context->GetAttrs();
+    OPS_CHECK_NULL_WITH_CONTEXT(context, attrs);
+    const int64_t *dstTypePtr = attrs->GetAttrPointer<int64_t>(ATTR_DST_TYPE_INDEX);
+    const int64_t *groupSizePtr = attrs->GetAttrPointer<int64_t>(ATTR_GROUP_SIZE_INDEX);
+    int64_t dstType = dstTypePtr == nullptr ? ge::DT_INT8 : *dstTypePtr;
+    auto xDesc = context->GetInputDesc(INPUT_X_INDEX);
+    auto yDesc = context->GetOutputDesc(OUTPUT_Y_INDEX);
+    OPS_CHECK_NULL_WITH_CONTEXT(context, xDesc);
+    OPS_CHECK_NULL_WITH_CONTEXT(context, yDesc);
+    ge::DataType yDtype = yDesc->GetDataType();
+    OP_TILING_CHECK((dstType != ge::DT_INT8 && dstType != ge::DT_INT4) || dstType != yDtype,
+                    VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(),
+                        "dst_type(%ld) must be int8 or int4 and equal to y dtype(%d).", dstType, yDtype),
+                    return ge::GRAPH_FAILED);
+
+    SwiGluQuantParams params;
+    params.groupSize = groupSizePtr == nullptr ? 0 : *groupSizePtr;
+    params.typeSize = ge::GetSizeByDataType(xDesc->GetDataType());
+    params.elemAlign = yDtype == ge::DT_INT4 ? ELEM_ALIGN_INT4 : ELEM_ALIGN_INT8;
+    OP_TILING_CHECK(params.groupSize < 0 || params.typeSize <= 0,
+                    VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(),
+                        "group_size(%ld) must not be negative.", params.groupSize),
+                    return ge::GRAPH_FAILED);
+    OP_TILING_CHECK(CheckShapes(context, params) != ge::GRAPH_SUCCESS,
+                    VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(), "Input shape invalid."),
+                    return ge::GRAPH_FAILED);
+
+    SwiGluQuantTilingData tiling;
+    OP_TILING_CHECK(CalcTileShape(context, params, coreNum, static_cast<int64_t>(ubSize), tiling) != ge::GRAPH_SUCCESS,
+                    VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(), "CalcTileShape failed."),
+                    return ge::GRAPH_FAILED);
+
+    context->SetBlockDim(static_cast<uint32_t>(tiling.get_usedCoreNum()));
+    context->SetTilingKey(1);
+    tiling.SaveToBuffer(context->GetRawTilingData()->GetData(), context->GetRawTilingData()->GetCapacity());
+    context->GetRawTilingData()->SetDataSize(tiling.GetDataSize());
+
+    size_t *currentWorkspace = context->GetWorkspaceSizes(1);
+    currentWorkspace[0] = SYS_WORKSPACE_SIZE;
+
+    OP_LOGD(context->GetNodeName(), "rowNum: %ld, colLen: %ld, groupSize: %ld, tileRows: %ld, tileCols: %ld, "
+            "colChunkNum: %ld, usedCoreNum: %ld\n", tiling.get_rowNum(), tiling.get_colLen(), tiling.get_groupSize(),
+            tiling.get_tileRows(), tiling.get_tileCols(), tiling.get_colChunkNum(), tiling.get_usedCoreNum());
+    return ge::GRAPH_SUCCESS;
+}
+
+static ge::graphStatus TilingPrepare4SwiGluQuant(gert::TilingParseContext *context)
+{
+    OP_LOGD(context->GetNodeName(), "TilingPrepare4SwiGluQuant running.");
+    auto compileInfo = GetCompileInfoPtr<SwiGluQuantCompileInfo>(context);
+    OPS_CHECK_NULL_WITH_CONTEXT(context, compileInfo);
+    auto platformInfo = context->GetPlatformInfo();
+    OPS_CHECK_NULL_WITH_CONTEXT(context, platformInfo);
+    auto ascendcPlatform = platform_ascendc::PlatformAscendC(platformInfo);
+    compileInfo->totalCoreNum = ascendcPlatform.GetCoreNumAiv();
+    ascendcPlatform.GetCoreMemSize(platform_ascendc::CoreMemType::UB, compileInfo->ubSize);
+    OP_TILING_CHECK((compileInfo->totalCoreNum <= 0 || compileInfo->ubSize == 0),
+                    VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(),
+                        "TilingPrepare4SwiGluQuant fail to get core num or ub size."),
+                    return ge::GRAPH_FAILED);
+    return ge::GRAPH_SUCCESS;
+}
+
+IMPL_OP_OPTILING(SwiGluQuant)
+    .Tiling(Tiling4SwiGluQuant)
+    .TilingParse<SwiGluQuantCompileInfo>(TilingPrepare4SwiGluQuant);
+}  // namespace optiling
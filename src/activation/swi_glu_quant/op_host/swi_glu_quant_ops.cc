@@ -0,0 +1,97 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file swi_glu_quant_ops.cc
+ * \brief
+ */
+#include "register/op_def_registry.h"
+
+#define OP_LOGD(nodeName, fmt, ...)  \
+    std::printf(fmt, ##__VA_ARGS__); \
+    std::printf("\n")
+#define OPS_CHECK_NULL_WITH_CONTEXT(context, ptr) \
+    if ((ptr) == nullptr) {                       \
+        std::printf("nullptr error!");            \
+        return ge::GRAPH_FAILED;                  \
+    }
+
+using namespace ge;
+
+namespace ops {
+constexpr size_t INPUT_X_INDEX = 0;
+constexpr size_t OUTPUT_Y_INDEX = 0;
+constexpr size_t OUTPUT_SCALE_INDEX = 1;
+constexpr size_t ATTR_DST_TYPE_INDEX = 0;
+constexpr size_t ATTR_GROUP_SIZE_INDEX = 1;
+constexpr int64_t SPLIT_NUM = 2;
+
+// y为x末维减半；scale逐行时为x[:-1]，分块时为x[:-1] + [colLen / group_size]
+static ge::graphStatus InfershapeForSwiGluQuant(gert::InferShapeContext *context)
+{
+    OP_LOGD(context->GetNodeName(), "InfershapeForSwiGluQuant enter");
+    auto xShape = context->GetInputShape(INPUT_X_INDEX);
+    OPS_CHECK_NULL_WITH_CONTEXT(context, xShape);
+    auto yShape = context->GetOutputShape(OUTPUT_Y_INDEX);
+    OPS_CHECK_NULL_WITH_CONTEXT(context, yShape);
+    auto scaleShape = context->GetOutputShape(OUTPUT_SCALE_INDEX);
+    OPS_CHECK_NULL_WITH_CONTEXT(context, scaleShape);
+    auto attrs = context->GetAttrs();
+    OPS_CHECK_NULL_WITH_CONTEXT(context, attrs);
+    const int64_t *groupSizePtr = attrs->GetAttrPointer<int64_t>(ATTR_GROUP_SIZE_INDEX);
+    int64_t groupSize = groupSizePtr == nullptr ? 0 : *groupSizePtr;
+
+    size_t dimNum = xShape->GetDimNum();
+    if (dimNum == 0) {
+        return ge::GRAPH_FAILED;
+    }
+    int64_t lastDim = xShape->GetDim(dimNum - 1);
+    *yShape = *xShape;
+    scaleShape->SetDimNum(0);
+    for (size_t i = 0; i + 1 < dimNum; i++) {
+        scaleShape->AppendDim(xShape->GetDim(i));
+    }
+    // dynamic shape
+    if (lastDim == -1) {
+        if (groupSize > 0) {
+            scaleShape->AppendDim(-1);
+        }
+        return ge::GRAPH_SUCCESS;
+    }
+    if (lastDim < 0 || lastDim % SPLIT_NUM != 0) {
+        return ge::GRAPH_FAILED;
+    }
+    int64_t colLen = lastDim / SPLIT_NUM;
+    yShape->SetDim(dimNum - 1, colLen);
+    if (groupSize > 0) {
+        if (colLen % groupSize != 0) {
+            return ge::GRAPH_FAILED;
+        }
+        scaleShape->AppendDim(colLen / groupSize);
+    }
+    return ge::GRAPH_SUCCESS;
+}
+
+static ge::graphStatus InferDataTypeForSwiGluQuant(gert::InferDataTypeContext *context)
+{
+    auto attrs = context->GetAttrs();
+    OPS_CHECK_NULL_WITH_CONTEXT(context, attrs);
+    const int64_t *dstTypePtr = attrs->GetAttrPointer<int64_t>(ATTR_DST_TYPE_INDEX);
+    ge::DataType yDtype = dstTypePtr == nullptr ? ge::DT_INT8 : static_cast<ge::DataType>(*dstTypePtr);
+    context->SetOutputDataType(OUTPUT_Y_INDEX, yDtype);
+    context->SetOutputDataType(OUTPUT_SCALE_INDEX, ge::DT_FLOAT);
+    return ge::GRAPH_SUCCESS;
+}
+
+IMPL_OP_INFERSHAPE(SwiGluQuant)
+    .InferShape(InfershapeForSwiGluQuant)
+    .InferDataType(InferDataTypeForSwiGluQuant);
+
+}  // namespace ops
@@ -0,0 +1,50 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file swi_glu_quant_tiling.h
+ * \brief
+ */
+#ifndef OPS_BUILT_IN_OP_TILING_RUNTIME_SWI_GLU_QUANT_H
+#define OPS_BUILT_IN_OP_TILING_RUNTIME_SWI_GLU_QUANT_H
+
+#include "register/tilingdata_base.h"
+
+namespace optiling {
+// x按末维对半切为[rowNum, 2 * colLen]，输出y为[rowNum, colLen]
+// 一个UB块为tileRows行、每行tileCols列，行距alignCols；tileRows大于1时tileCols等于colLen
+// groupSize为0时逐行（per-token）量化，任务为一个行块，colChunkNum大于1时一行分段算两遍（先求最大值，再重算并量化）
+// groupSize大于0时按1 x groupSize分块量化，任务为(行块, 列段)
+BEGIN_TILING_DATA_DEF(SwiGluQuantTilingData)
+    TILING_DATA_FIELD_DEF(int64_t, rowNum);
+    TILING_DATA_FIELD_DEF(int64_t, colLen);
+    TILING_DATA_FIELD_DEF(int64_t, groupSize);
+    TILING_DATA_FIELD_DEF(int64_t, groupPerRow);
+    TILING_DATA_FIELD_DEF(int64_t, tileRows);
+    TILING_DATA_FIELD_DEF(int64_t, tileCols);
+    TILING_DATA_FIELD_DEF(int64_t, alignCols);
+    TILING_DATA_FIELD_DEF(int64_t, colChunkNum);
+    TILING_DATA_FIELD_DEF(int64_t, rowTileNum);
+    TILING_DATA_FIELD_DEF(int64_t, hasSmooth);
+    TILING_DATA_FIELD_DEF(int64_t, unitNum);
+    TILING_DATA_FIELD_DEF(int64_t, usedCoreNum);
+    TILING_DATA_FIELD_DEF(int64_t, unitsPerCore);
+    TILING_DATA_FIELD_DEF(int64_t, tailCoreNum);
+END_TILING_DATA_DEF;
+
+REGISTER_TILING_DATA_CLASS(SwiGluQuant, SwiGluQuantTilingData)
+
+struct SwiGluQuantCompileInfo {
+    int32_t totalCoreNum = 0;
+    uint64_t ubSize = 0;
+};
+}  // namespace optiling
+
+#endif  // OPS_BUILT_IN_OP_TILING_RUNTIME_SWI_GLU_QUANT_H
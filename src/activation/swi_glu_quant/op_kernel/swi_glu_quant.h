@@ -0,0 +1,447 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file swi_glu_quant.h
+ * \brief
+ */
+#ifndef SWI_GLU_QUANT_H
+#define SWI_GLU_QUANT_H
+
+#include "kernel_operator.h"
+
+namespace SwiGluQuant {
+using namespace AscendC;
+
+constexpr int64_t BUFFER_NUM = 2;
+constexpr int64_t BLOCK_BYTES = 32;
+constexpr int64_t EIGHT = 8;
+constexpr int64_t ELEM_PER_REP_FP32 = 64;
+constexpr int64_t MAX_REPEAT = 255;
+constexpr int64_t BRCB_MAX_NUM = MAX_REPEAT * EIGHT;
+constexpr float QUANT_INT8_SYM_SCALE = 127.0;
+constexpr float QUANT_INT4_SYM_SCALE = 7.0;
+constexpr float QUANT_EPSINON = 1e-12;
+
+/*
+  y = silu(x[..., :colLen]) * x[..., colLen:]，在fp32上计算后直接做对称动态量化，中间结果不落GM。
+  SwiGLU按a * b / (1 + exp(-a))计算，只需dataBuf与tmpBuf两块fp32空间。
+  per-token：整行在UB内时求每行绝对值最大值；一行放不下时分段算两遍，第一遍只求最大值，第二遍重算并量化。
+  per-group：每个1 x groupSize块一个scale，此时UB内各行连续存放（alignCols等于cols）。
+*/
+template <typename xDtype, typename yDtype>
+class KernelSwiGluQuant {
+public:
+    __aicore__ inline KernelSwiGluQuant(TPipe *pipe)
+    {
+        Ppipe = pipe;
+    }
+    __aicore__ inline void Init(GM_ADDR x, GM_ADDR smooth_scales, GM_ADDR y, GM_ADDR scale,
+                                const SwiGluQuantTilingData *tilingData)
+    {
+        tiling = tilingData;
+        colLen = tiling->colLen;
+        groupSize = tiling->groupSize;
+        alignCols = tiling->alignCols;
+        quantMax = IsSameType<yDtype, int4b_t>::value ? QUANT_INT4_SYM_SCALE : QUANT_INT8_SYM_SCALE;
+
+        int64_t blockIdx = GetBlockIdx();
+        unitStart = blockIdx * tiling->unitsPerCore +
+                    (blockIdx < tiling->tailCoreNum ? blockIdx : tiling->tailCoreNum);
+        unitEnd = unitStart + tiling->unitsPerCore + (blockIdx < tiling->tailCoreNum ? 1 : 0);
+
+        xGm.SetGlobalBuffer((__gm__ xDtype *)x);
+        yGm.SetGlobalBuffer((__gm__ yDtype *)y);
+        scaleGm.SetGlobalBuffer((__gm__ float *)scale);
+
+        int64_t maxElems = tiling->tileRows * alignCols;
+        int64_t maxScales = groupSize > 0 ? maxElems / groupSize : tiling->tileRows;
+        maxScales = (maxScales + EIGHT - 1) / EIGHT * EIGHT;
+        if (tiling->hasSmooth) {
+            smoothGm.SetGlobalBuffer((__gm__ xDtype *)smooth_scales, colLen);
+            Ppipe->InitBuffer(smoothBuf, alignCols * sizeof(float));
+        }
+        Ppipe->InitBuffer(inQueueA, BUFFER_NUM, maxElems * sizeof(xDtype));
+        Ppipe->InitBuffer(inQueueB, BUFFER_NUM, maxElems * sizeof(xDtype));
+        Ppipe->InitBuffer(outQueue, BUFFER_NUM, maxElems * sizeof(int8_t));
+        Ppipe->InitBuffer(scaleQueue, BUFFER_NUM, maxScales * sizeof(float));
+        Ppipe->InitBuffer(dataBuf, maxElems * sizeof(float));
+        Ppipe->InitBuffer(tmpBuf, maxElems * sizeof(float));
+        if (groupSize > 0) {
+            Ppipe->InitBuffer(maxBuf, maxScales * sizeof(float));
+            Ppipe->InitBuffer(brcbBuf, maxScales * EIGHT * sizeof(float));
+        }
+    }
+
+    __aicore__ inline void Process()
+    {
+        for (int64_t unit = unitStart; unit < unitEnd; unit++) {
+            if (groupSize > 0) {
+                ProcessGroupUnit(unit);
+            } else if (tiling->colChunkNum > 1) {
+                ProcessSplitRow(unit);
+            } else {
+                ProcessRowTile(unit);
+            }
+        }
+    }
+
+private:
+    template <HardEvent event>
+    __aicore__ inline void PipeSync()
+    {
+        event_t eventId = static_cast<event_t>(GetTPipePtr()->FetchEventID(event));
+        SetFlag<event>(eventId);
+        WaitFlag<event>(eventId);
+    }
+
+    // per-token，整行在UB内：一个任务为tileRows行
+    __aicore__ inline void ProcessRowTile(int64_t unit)
+    {
+        int64_t rowStart = unit * tiling->tileRows;
+        int64_t rows = tiling->rowNum - rowStart;
+        rows = rows > tiling->tileRows ? tiling->tileRows : rows;
+        LoadSmooth(0, colLen);
+        CopyIn(rowStart, rows, 0, colLen);
+        ComputeSwiGlu(rows);
+
+        LocalTensor<float> dataLocal = dataBuf.Get<float>();
+        LocalTensor<float> tmpLocal = tmpBuf.Get<float>();
+        Abs(tmpLocal, dataLocal, rows * alignCols);
+        PipeBarrier<PIPE_V>();
+        for (int64_t r = 0; r < rows; r++) {
+            ReduceMaxInplace(tmpLocal[r * alignCols], colLen);
+        }
+        PipeSync<HardEvent::V_S>();
+        LocalTensor<float> scaleLocal = scaleQueue.AllocTensor<float>();
+        for (int64_t r = 0; r < rows; r++) {
+            float maxValue = tmpLocal.GetValue(r * alignCols);
+            maxValue = maxValue > QUANT_EPSINON ? maxValue : QUANT_EPSINON;
+            scaleLocal.SetValue(r, maxValue / quantMax);
+            Muls(dataLocal[r * alignCols], dataLocal[r * alignCols], quantMax / maxValue, colLen);
+        }
+        PipeBarrier<PIPE_V>();
+        scaleQueue.EnQue(scaleLocal);
+        CastOut(rows);
+        CopyOut(rowStart, rows, 0, colLen);
+        CopyOutScale(rowStart, rows);
+    }
+
+    // per-token，一行放不下：第一遍求整行最大值，第二遍逐段重算并量化
+    __aicore__ inline void ProcessSplitRow(int64_t row)
+    {
+        LocalTensor<float> dataLocal = dataBuf.Get<float>();
+        LocalTensor<float> tmpLocal = tmpBuf.Get<float>();
+        float maxValue = QUANT_EPSINON;
+        for (int64_t colStart = 0; colStart < colLen; colStart += tiling->tileCols) {
+            int64_t cols = ChunkCols(colStart);
+            LoadSmooth(colStart, cols);
+            CopyIn(row, 1, colStart, cols);
+            ComputeSwiGlu(1);
+            Abs(tmpLocal, dataLocal, cols);
+            PipeBarrier<PIPE_V>();
+            ReduceMaxInplace(tmpLocal, cols);
+            PipeSync<HardEvent::V_S>();
+            float chunkMax = tmpLocal.GetValue(0);
+            maxValue = chunkMax > maxValue ? chunkMax : maxValue;
+        }
+
+        LocalTensor<float> scaleLocal = scaleQueue.AllocTensor<float>();
+        scaleLocal.SetValue(0, maxValue / quantMax);
+        scaleQueue.EnQue(scaleLocal);
+        CopyOutScale(row, 1);
+
+        float factor = quantMax / maxValue;
+        for (int64_t colStart = 0; colStart < colLen; colStart += tiling->tileCols) {
+            int64_t cols = ChunkCols(colStart);
+            LoadSmooth(colStart, cols);
+            CopyIn(row, 1, colStart, cols);
+            ComputeSwiGlu(1);
+            Muls(dataLocal, dataLocal, factor, cols);
+            PipeBarrier<PIPE_V>();
+            CastOut(1);
+            CopyOut(row, 1, colStart, cols);
+        }
+    }
+
+    // per-group：任务为(行块, 列段)，每个1 x groupSize块一个scale
+    __aicore__ inline void ProcessGroupUnit(int64_t unit)
+    {
+        int64_t rowStart = unit / tiling->colChunkNum * tiling->tileRows;
+        int64_t colStart = unit % tiling->colChunkNum * tiling->tileCols;
+        int64_t rows = tiling->rowNum - rowStart;
+        rows = rows > tiling->tileRows ? tiling->tileRows : rows;
+        int64_t cols = ChunkCols(colStart);
+        int64_t groups = rows * cols / groupSize;
+        LoadSmooth(colStart, cols);
+        CopyIn(rowStart, rows, colStart, cols);
+        ComputeSwiGlu(rows);
+
+        LocalTensor<float> dataLocal = dataBuf.Get<float>();
+        LocalTensor<float> tmpLocal = tmpBuf.Get<float>();
+        LocalTensor<float> maxLocal = maxBuf.Get<float>();
+        Abs(tmpLocal, dataLocal, rows * cols);
+        PipeBarrier<PIPE_V>();
+        ReduceMaxGroups(maxLocal, tmpLocal, groups);
+        Maxs(maxLocal, maxLocal, QUANT_EPSINON, groups);
+        PipeBarrier<PIPE_V>();
+
+        // scale = max / quantMax, data * (quantMax / max)
+        LocalTensor<float> scaleLocal = scaleQueue.AllocTensor<float>();
+        Muls(scaleLocal, maxLocal, 1.0f / quantMax, groups);
+        Duplicate(tmpLocal, quantMax, groups);
+        PipeBarrier<PIPE_V>();
+        Div(maxLocal, tmpLocal, maxLocal, groups);
+        PipeBarrier<PIPE_V>();
+        scaleQueue.EnQue(scaleLocal);
+        GroupScalarMul(dataLocal, maxLocal, groups);
+
+        CastOut(rows);
+        CopyOut(rowStart, rows, colStart, cols);
+        // rows大于1时cols等于colLen，各行的scale在GM上连续
+        CopyOutScale(rowStart * tiling->groupPerRow + colStart / groupSize, groups);
+    }
+
+    __aicore__ inline int64_t ChunkCols(int64_t colStart)
+    {
+        int64_t cols = colLen - colStart;
+        return cols > tiling->tileCols ? tiling->tileCols : cols;
+    }
+
+    __aicore__ inline void LoadSmooth(int64_t colStart, int64_t cols)
+    {
+        if (!tiling->hasSmooth || (smoothLoadedCol == colStart && smoothLoadedLen == cols)) {
+            return;
+        }
+        LocalTensor<float> smoothLocal = smoothBuf.Get<float>();
+        DataCopyExtParams copyParams{1, static_cast<uint32_t>(cols * sizeof(xDtype)), 0, 0, 0};
+        DataCopyPadExtParams<xDtype> padParams{false, 0, 0, 0};
+        PipeSync<HardEvent::V_MTE2>();
+        if constexpr (IsSameType<xDtype, float>::value) {
+            DataCopyPad(smoothLocal, smoothGm[colStart], copyParams, padParams);
+            PipeSync<HardEvent::MTE2_V>();
+        } else {
+            LocalTensor<xDtype> stage = tmpBuf.Get<xDtype>();
+            DataCopyPad(stage, smoothGm[colStart], copyParams, padParams);
+            PipeSync<HardEvent::MTE2_V>();
+            Cast(smoothLocal, stage, RoundMode::CAST_NONE, cols);
+            PipeBarrier<PIPE_V>();
+        }
+        smoothLoadedCol = colStart;
+        smoothLoadedLen = cols;
+    }
+
+    // a、b两半各搬rows行，UB行距为alignCols个元素
+    __aicore__ inline void CopyIn(int64_t rowStart, int64_t rows, int64_t colStart, int64_t cols)
+    {
+        int64_t colBytes = cols * sizeof(xDtype);
+        int64_t padBytes = (colBytes + BLOCK_BYTES - 1) / BLOCK_BYTES * BLOCK_BYTES;
+        DataCopyExtParams copyParams{static_cast<uint16_t>(rows), static_cast<uint32_t>(colBytes),
+                                     static_cast<uint32_t>((2 * colLen - cols) * sizeof(xDtype)),
+                                     static_cast<uint32_t>((alignCols * sizeof(xDtype) - padBytes) / BLOCK_BYTES), 0};
+        DataCopyPadExtParams<xDtype> padParams{false, 0, 0, 0};
+        int64_t offset = rowStart * 2 * colLen + colStart;
+        LocalTensor<xDtype> aLocal = inQueueA.AllocTensor<xDtype>();
+        DataCopyPad(aLocal, xGm[offset], copyParams, padParams);
+        inQueueA.EnQue(aLocal);
+        LocalTensor<xDtype> bLocal = inQueueB.AllocTensor<xDtype>();
+        DataCopyPad(bLocal, xGm[offset + colLen], copyParams, padParams);
+        inQueueB.EnQue(bLocal);
+    }
+
+    // dataBuf <- silu(a) * b (* smooth)，按a * b / (1 + exp(-a))计算
+    __aicore__ inline void ComputeSwiGlu(int64_t rows)
+    {
+        int64_t count = rows * alignCols;
+        LocalTensor<float> dataLocal = dataBuf.Get<float>();
+        LocalTensor<float> tmpLocal = tmpBuf.Get<float>();
+        LocalTensor<xDtype> aLocal = inQueueA.DeQue<xDtype>();
+        LocalTensor<xDtype> bLocal = inQueueB.DeQue<xDtype>();
+        if constexpr (IsSameType<xDtype, float>::value) {
+            Mul(tmpLocal, aLocal, bLocal, count);
+            Muls(dataLocal, aLocal, -1.0f, count);
+        } else {
+            Cast(dataLocal, aLocal, RoundMode::CAST_NONE, count);
+            Cast(tmpLocal, bLocal, RoundMode::CAST_NONE, count);
+            PipeBarrier<PIPE_V>();
+            Mul(tmpLocal, dataLocal, tmpLocal, count);
+            Muls(dataLocal, dataLocal, -1.0f, count);
+        }
+        PipeBarrier<PIPE_V>();
+        inQueueA.FreeTensor(aLocal);
+        inQueueB.FreeTensor(bLocal);
+        Exp(dataLocal, dataLocal, count);
+        PipeBarrier<PIPE_V>();
+        Adds(dataLocal, dataLocal, 1.0f, count);
+        PipeBarrier<PIPE_V>();
+        Div(dataLocal, tmpLocal, dataLocal, count);
+        PipeBarrier<PIPE_V>();
+        if (tiling->hasSmooth) {
+            RowBroadcastMul(dataLocal, smoothBuf.Get<float>(), rows, alignCols);
+        }
+    }
+
+    __aicore__ inline void CastOut(int64_t rows)
+    {
+        int64_t count = rows * alignCols;
+        LocalTensor<float> dataLocal = dataBuf.Get<float>();
+        LocalTensor<int32_t> dataInt32 = dataBuf.Get<int32_t>();
+        LocalTensor<half> dataHalf = dataBuf.Get<half>();
+        LocalTensor<yDtype> outLocal = outQueue.AllocTensor<yDtype>();
+        Cast(dataInt32, dataLocal, RoundMode::CAST_RINT, count);
+        PipeBarrier<PIPE_V>();
+        SetDeqScale(static_cast<half>(1.0));
+        PipeBarrier<PIPE_V>();
+        Cast(dataHalf, dataInt32, RoundMode::CAST_ROUND, count);
+        PipeBarrier<PIPE_V>();
+        Cast(outLocal, dataHalf, RoundMode::CAST_TRUNC, count);
+        outQueue.EnQue<yDtype>(outLocal);
+    }
+
+    __aicore__ inline void CopyOut(int64_t rowStart, int64_t rows, int64_t colStart, int64_t cols)
+    {
+        int64_t colBytes = cols * sizeof(int8_t);
+        int64_t rowBytes = alignCols * sizeof(int8_t);
+        int64_t gapBytes = (colLen - cols) * sizeof(int8_t);
+        if constexpr (IsSameType<yDtype, int4b_t>::value) {
+            colBytes = colBytes >> 1;
+            rowBytes = rowBytes >> 1;
+            gapBytes = gapBytes >> 1;
+        }
+        int64_t padBytes = (colBytes + BLOCK_BYTES - 1) / BLOCK_BYTES * BLOCK_BYTES;
+        LocalTensor<yDtype> outLocal = outQueue.DeQue<yDtype>();
+        DataCopyExtParams copyParams{static_cast<uint16_t>(rows), static_cast<uint32_t>(colBytes),
+                                     static_cast<uint32_t>((rowBytes - padBytes) / BLOCK_BYTES),
+                                     static_cast<uint32_t>(gapBytes), 0};
+        DataCopyPad(yGm[rowStart * colLen + colStart], outLocal, copyParams);
+        outQueue.FreeTensor(outLocal);
+    }
+
+    __aicore__ inline void CopyOutScale(int64_t scaleStart, int64_t num)
+    {
+        LocalTensor<float> scaleLocal = scaleQueue.DeQue<float>();
+        DataCopyExtParams copyParams{1, static_cast<uint32_t>(num * sizeof(float)), 0, 0, 0};
+        DataCopyPad(scaleGm[scaleStart], scaleLocal, copyParams);
+        scaleQueue.FreeTensor(scaleLocal);
+    }
+
+    // src[0] = max(src[0 : count])，count不超过256 * 64
+    __aicore__ inline void ReduceMaxInplace(const LocalTensor<float> &src, int64_t count)
+    {
+        int64_t reps = count / ELEM_PER_REP_FP32;
+        int64_t offset = reps * ELEM_PER_REP_FP32;
+        int64_t rems = count - offset;
+        if (reps > 1) {
+            Max(src, src[ELEM_PER_REP_FP32], src, ELEM_PER_REP_FP32, reps - 1, {1, 1, 1, 0, 8, 0});
+            PipeBarrier<PIPE_V>();
+        }
+        if (rems > 0 && offset > 0) {
+            Max(src, src[offset], src, rems, 1, {1, 1, 1, 0, 8, 0});
+            PipeBarrier<PIPE_V>();
+        }
+        uint64_t mask = reps > 0 ? ELEM_PER_REP_FP32 : count;
+        WholeReduceMax(src, src, mask, 1, 8, 1, 8);
+        PipeBarrier<PIPE_V>();
+    }
+
+    // dst[i] = max(src[i * groupSize : (i + 1) * groupSize])，src被原地折叠
+    __aicore__ inline void ReduceMaxGroups(const LocalTensor<float> &dst, const LocalTensor<float> &src,
+                                           int64_t groups)
+    {
+        uint8_t repStride = groupSize / EIGHT;
+        uint64_t headMask = groupSize > ELEM_PER_REP_FP32 ? ELEM_PER_REP_FP32 : groupSize;
+        for (int64_t i = 0; i < groups; i += MAX_REPEAT) {
+            uint8_t repeat = (groups - i) > MAX_REPEAT ? MAX_REPEAT : (groups - i);
+            int64_t offset = i * groupSize;
+            for (int64_t c = ELEM_PER_REP_FP32; c < groupSize; c += ELEM_PER_REP_FP32) {
+                uint64_t mask = (groupSize - c) > ELEM_PER_REP_FP32 ? ELEM_PER_REP_FP32 : (groupSize - c);
+                Max(src[offset], src[offset + c], src[offset], mask, repeat,
+                    {1, 1, 1, repStride, repStride, repStride});
+                PipeBarrier<PIPE_V>();
+            }
+            WholeReduceMax(dst[i], src[offset], headMask, repeat, 1, 1, repStride, ReduceOrder::ORDER_ONLY_VALUE);
+        }
+        PipeBarrier<PIPE_V>();
+    }
+
+    // data[i * groupSize + j] *= factor[i]，factor经Brcb铺满一个block后以block stride 0读取
+    __aicore__ inline void GroupScalarMul(const LocalTensor<float> &data, const LocalTensor<float> &factor,
+                                          int64_t groups)
+    {
+        LocalTensor<float> brcbLocal = brcbBuf.Get<float>();
+        for (int64_t i = 0; i < groups; i += BRCB_MAX_NUM) {
+            int64_t num = (groups - i) > BRCB_MAX_NUM ? BRCB_MAX_NUM : (groups - i);
+            Brcb(brcbLocal[i * EIGHT], factor[i], (num + EIGHT - 1) / EIGHT, {1, EIGHT});
+        }
+        PipeBarrier<PIPE_V>();
+        uint8_t repStride = groupSize / EIGHT;
+        for (int64_t i = 0; i < groups; i += MAX_REPEAT) {
+            uint8_t repeat = (groups - i) > MAX_REPEAT ? MAX_REPEAT : (groups - i);
+            for (int64_t c = 0; c < groupSize; c += ELEM_PER_REP_FP32) {
+                uint64_t mask = (groupSize - c) > ELEM_PER_REP_FP32 ? ELEM_PER_REP_FP32 : (groupSize - c);
+                int64_t offset = i * groupSize + c;
+                Mul(data[offset], data[offset], brcbLocal[i * EIGHT], mask, repeat, {1, 1, 0, repStride, repStride, 1});
+            }
+        }
+        PipeBarrier<PIPE_V>();
+    }
+
+    // data[r, :] *= row[:]，行距为cols
+    __aicore__ inline void RowBroadcastMul(const LocalTensor<float> &data, const LocalTensor<float> &row,
+                                           int64_t rows, int64_t cols)
+    {
+        if (cols / EIGHT > MAX_REPEAT) {
+            for (int64_t r = 0; r < rows; r++) {
+                Mul(data[r * cols], data[r * cols], row, cols);
+            }
+            PipeBarrier<PIPE_V>();
+            return;
+        }
+        uint8_t repStride = cols / EIGHT;
+        for (int64_t r = 0; r < rows; r += MAX_REPEAT) {
+            uint8_t repeat = (rows - r) > MAX_REPEAT ? MAX_REPEAT : (rows - r);
+            for (int64_t c = 0; c < cols; c += ELEM_PER_REP_FP32) {
+                uint64_t mask = (cols - c) > ELEM_PER_REP_FP32 ? ELEM_PER_REP_FP32 : (cols - c);
+                int64_t offset = r * cols + c;
+                Mul(data[offset], data[offset], row[c], mask, repeat, {1, 1, 1, repStride, repStride, 0});
+            }
+        }
+        PipeBarrier<PIPE_V>();
+    }
+
+private:
+    TPipe *Ppipe = nullptr;
+    const SwiGluQuantTilingData *tiling = nullptr;
+    TQue<QuePosition::VECIN, BUFFER_NUM> inQueueA;
+    TQue<QuePosition::VECIN, BUFFER_NUM> inQueueB;
+    TQue<QuePosition::VECOUT, BUFFER_NUM> outQueue;
+    TQue<QuePosition::VECOUT, BUFFER_NUM> scaleQueue;
+    TBuf<TPosition::VECCALC> dataBuf;
+    TBuf<TPosition::VECCALC> tmpBuf;
+    TBuf<TPosition::VECCALC> maxBuf;
+    TBuf<TPosition::VECCALC> brcbBuf;
+    TBuf<TPosition::VECCALC> smoothBuf;
+
+    GlobalTensor<xDtype> xGm;
+    GlobalTensor<xDtype> smoothGm;
+    GlobalTensor<yDtype> yGm;
+    GlobalTensor<float> scaleGm;
+
+    int64_t colLen = 0;
+    int64_t groupSize = 0;
+    int64_t alignCols = 0;
+    int64_t unitStart = 0;
+    int64_t unitEnd = 0;
+    int64_t smoothLoadedCol = -1;
+    int64_t smoothLoadedLen = 0;
+    float quantMax = QUANT_INT8_SYM_SCALE;
+};
+}  // namespace SwiGluQuant
+#endif  // SWI_GLU_QUANT_H
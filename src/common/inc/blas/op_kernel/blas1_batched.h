@@ -0,0 +1,605 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file blas1_batched.h
+ * \brief kernel of the strided-batched level-1 BLAS ops.
+ *
+ * x is [batch, stride] (float or complex64 as float pairs), one vector per row, and n comes from an int32 tensor
+ * of length 1 (shared) or batch (per vector). Each core owns a contiguous range of rows:
+ *   - rows whose padded length fits in UB are packed, many rows per DMA, and reduced row by row
+ *     (one WholeReduce repeat per row when n <= 64);
+ *   - longer rows are streamed in chunks and accumulated on the scalar side.
+ * The reduce routines load through a double-buffered queue, the next block is in flight while the current one
+ * is reduced; scal/copy write back from the load buffer and keep one buffer.
+ * nrm2 splits |x| into the small/medium/big buckets of nrm2_scaled.h and combines them per vector, so every
+ * vector gets the same overflow-safe result as snrm2.
+ * Results are written per core without atomics or cross-core sync.
+ */
+#ifndef BLAS1_BATCHED_H_
+#define BLAS1_BATCHED_H_
+
+#include "kernel_operator.h"
+#include "nrm2_scaled.h"
+
+namespace Blas1Batched {
+using namespace AscendC;
+
+enum class Routine : uint32_t {
+    ASUM = 0,
+    AMAX = 1,
+    NRM2 = 2,
+    SCAL = 3,
+    COPY = 4
+};
+
+constexpr int32_t BUFFER_NUM = 2;
+constexpr int64_t DATA_FLOATS = 16384;
+constexpr int64_t MAX_ROWS = 1024;
+constexpr int64_t WORK_FLOATS = 4096;
+constexpr int64_t TMP_FLOATS = 16;
+constexpr int64_t BLOCK_FLOATS = 8;
+constexpr int64_t REPEAT_FLOATS = 64;
+constexpr int64_t MAX_REPEAT = 248;
+constexpr int64_t GATHER_FLOATS = MAX_REPEAT * REPEAT_FLOATS;
+constexpr int64_t COMPLEX_PITCH_ALIGN = 16;
+constexpr uint8_t EVEN_PATTERN = 1;
+constexpr uint8_t ODD_PATTERN = 2;
+
+template <HardEvent EVENT>
+__aicore__ inline void PipeSync()
+{
+    event_t eventId = static_cast<event_t>(GetTPipePtr()->FetchEventID(EVENT));
+    SetFlag<EVENT>(eventId);
+    WaitFlag<EVENT>(eventId);
+}
+
+__aicore__ inline int64_t CeilAlign(int64_t x, int64_t align)
+{
+    return (x + align - 1) / align * align;
+}
+
+__aicore__ inline int64_t MinLen(int64_t a, int64_t b)
+{
+    return a < b ? a : b;
+}
+
+template <Routine ROUTINE>
+class Blas1BatchedKernel {
+public:
+    __aicore__ inline Blas1BatchedKernel() {}
+    __aicore__ inline void Init(GM_ADDR x, GM_ADDR n, GM_ADDR y, const Blas1BatchedTilingData *tiling);
+    __aicore__ inline void Process();
+
+private:
+    static constexpr bool IS_REDUCE = ROUTINE == Routine::ASUM || ROUTINE == Routine::AMAX ||
+                                      ROUTINE == Routine::NRM2;
+    // 归约类双缓冲，每块为单缓冲的一半
+    static constexpr int64_t LOAD_FLOATS = IS_REDUCE ? DATA_FLOATS / BUFFER_NUM : DATA_FLOATS;
+    static constexpr int64_t MASK_BYTES = LOAD_FLOATS / 8;
+
+    __aicore__ inline int64_t ClampN(int64_t n);
+    __aicore__ inline int64_t ValidLen(int64_t i);
+    __aicore__ inline void LoadN(int64_t row0, int64_t rows);
+    __aicore__ inline void PairSum(int64_t total);
+    __aicore__ inline void ReduceRows(const LocalTensor<float> &dst, const LocalTensor<float> &src, int64_t rows);
+    __aicore__ inline void SumRows(int64_t rows);
+    __aicore__ inline void Nrm2Rows(int64_t rows);
+    __aicore__ inline void Nrm2Chunk(int64_t cnt, float *acc);
+    __aicore__ inline void AmaxRows(int64_t rows);
+    __aicore__ inline void CopyInRows(int64_t row0, int64_t rows);
+    __aicore__ inline void CopyInChunk(int64_t offset, int64_t cnt);
+    __aicore__ inline void WriteZeros(int64_t row0, int64_t rows);
+    __aicore__ inline void ReducePacked(int64_t row0, int64_t rows);
+    __aicore__ inline void ReduceLongRow(int64_t row);
+    __aicore__ inline void ProcessPacked(int64_t row0, int64_t rows);
+    __aicore__ inline void ProcessLongRow(int64_t row);
+
+private:
+    TPipe pipe;
+    GlobalTensor<float> xGm;
+    GlobalTensor<int32_t> nGm;
+    GlobalTensor<float> yGm;
+
+    TQue<QuePosition::VECIN, BUFFER_NUM> inQueue;
+    TBuf<TPosition::VECCALC> dataBuf;
+    TBuf<TPosition::VECCALC> pairBuf;
+    TBuf<TPosition::VECCALC> workBuf;
+    TBuf<TPosition::VECCALC> tmpBuf;
+    TBuf<TPosition::VECCALC> outBuf;
+    TBuf<TPosition::VECCALC> nBuf;
+    TBuf<TPosition::VECCALC> sqBuf;
+    TBuf<TPosition::VECCALC> maskBuf;
+    TBuf<TPosition::VECCALC> bucketBuf;
+
+    LocalTensor<float> dataLocal;
+    LocalTensor<float> pairLocal;
+    LocalTensor<float> workLocal;
+    LocalTensor<float> tmpLocal;
+    LocalTensor<float> outLocal;
+    LocalTensor<int32_t> nLocal;
+    LocalTensor<float> sqLocal;
+    LocalTensor<uint8_t> maskLocal;
+    LocalTensor<float> bucketLocal;
+
+    int64_t stride {0};
+    int64_t rowLen {0};
+    int64_t elemWidth {1};
+    float alpha {1.0f};
+    bool uniform {true};
+    int64_t copyLen {0};
+    int64_t pitch {0};
+    int64_t rowsPerLoad {0};
+    int64_t rowStart {0};
+    int64_t rowEnd {0};
+};
+
+template <Routine ROUTINE>
+__aicore__ inline void Blas1BatchedKernel<ROUTINE>::Init(GM_ADDR x, GM_ADDR n, GM_ADDR y,
+                                                         const Blas1BatchedTilingData *tiling)
+{
+    stride = tiling->stride;
+    elemWidth = tiling->elemWidth;
+    rowLen = stride * elemWidth;
+    alpha = tiling->alpha;
+    uniform = tiling->nNum == 1;
+    rowStart = GetBlockIdx() * tiling->rowsPerCore;
+    rowEnd = MinLen(tiling->batch, rowStart + tiling->rowsPerCore);
+
+    xGm.SetGlobalBuffer((__gm__ float *)x);
+    nGm.SetGlobalBuffer((__gm__ int32_t *)n);
+    // 原地scal没有输出，结果写回x
+    yGm.SetGlobalBuffer((__gm__ float *)(y == nullptr ? x : y));
+
+    // 共享n时所有行按n搬运；逐向量n时按整行搬运，再按各行n计算
+    copyLen = uniform ? ClampN(nGm.GetValue(0)) * elemWidth : rowLen;
+    int64_t pitchAlign = (ROUTINE == Routine::AMAX && elemWidth > 1) ? COMPLEX_PITCH_ALIGN : BLOCK_FLOATS;
+    pitch = CeilAlign(copyLen, pitchAlign);
+    rowsPerLoad = pitch == 0 ? MAX_ROWS : MinLen(MAX_ROWS, LOAD_FLOATS / pitch);
+
+    if constexpr (IS_REDUCE) {
+        pipe.InitBuffer(inQueue, BUFFER_NUM, LOAD_FLOATS * sizeof(float));
+    } else {
+        pipe.InitBuffer(dataBuf, DATA_FLOATS * sizeof(float));
+        dataLocal = dataBuf.Get<float>();
+    }
+    pipe.InitBuffer(workBuf, WORK_FLOATS * sizeof(float));
+    pipe.InitBuffer(tmpBuf, TMP_FLOATS * sizeof(float));
+    pipe.InitBuffer(outBuf, MAX_ROWS * sizeof(float));
+    pipe.InitBuffer(nBuf, MAX_ROWS * sizeof(int32_t));
+    workLocal = workBuf.Get<float>();
+    tmpLocal = tmpBuf.Get<float>();
+    outLocal = outBuf.Get<float>();
+    nLocal = nBuf.Get<int32_t>();
+    if constexpr (ROUTINE == Routine::AMAX) {
+        pipe.InitBuffer(pairBuf, LOAD_FLOATS * sizeof(float));
+        pairLocal = pairBuf.Get<float>();
+    }
+    if constexpr (ROUTINE == Routine::NRM2) {
+        pipe.InitBuffer(sqBuf, LOAD_FLOATS * sizeof(float));
+        pipe.InitBuffer(maskBuf, Nrm2Scaled::BUCKET_NUM * MASK_BYTES);
+        pipe.InitBuffer(bucketBuf, Nrm2Scaled::BUCKET_NUM * MAX_ROWS * sizeof(float));
+        sqLocal = sqBuf.Get<float>();
+        maskLocal = maskBuf.Get<uint8_t>();
+        bucketLocal = bucketBuf.Get<float>();
+    }
+}
+
+template <Routine ROUTINE>
+__aicore__ inline int64_t Blas1BatchedKernel<ROUTINE>::ClampN(int64_t n)
+{
+    return n < 0 ? 0 : MinLen(n, stride);
+}
+
+// 第i行（相对本次搬运的首行）参与计算的float个数
+template <Routine ROUTINE>
+__aicore__ inline int64_t Blas1BatchedKernel<ROUTINE>::ValidLen(int64_t i)
+{
+    return uniform ? copyLen : ClampN(nLocal.GetValue(i)) * elemWidth;
+}
+
+template <Routine ROUTINE>
+__aicore__ inline void Blas1BatchedKernel<ROUTINE>::Process()
+{
+    if (rowStart >= rowEnd) {
+        return;
+    }
+    if constexpr (IS_REDUCE) {
+        if (rowsPerLoad == 0) {
+            for (int64_t row = rowStart; row < rowEnd; row++) {
+                ReduceLongRow(row);
+            }
+            return;
+        }
+        if (copyLen == 0) {
+            for (int64_t row0 = rowStart; row0 < rowEnd; row0 += rowsPerLoad) {
+                WriteZeros(row0, MinLen(rowsPerLoad, rowEnd - row0));
+            }
+            return;
+        }
+        // 先取本块的n再发起下一块的搬入，标量等n时不会被下一块的DMA拖住
+        CopyInRows(rowStart, MinLen(rowsPerLoad, rowEnd - rowStart));
+        for (int64_t row0 = rowStart; row0 < rowEnd; row0 += rowsPerLoad) {
+            int64_t rows = MinLen(rowsPerLoad, rowEnd - row0);
+            LoadN(row0, rows);
+            int64_t next = row0 + rowsPerLoad;
+            if (next < rowEnd) {
+                CopyInRows(next, MinLen(rowsPerLoad, rowEnd - next));
+            }
+            ReducePacked(row0, rows);
+        }
+        return;
+    }
+    if (rowsPerLoad == 0) {
+        for (int64_t row = rowStart; row < rowEnd; row++) {
+            ProcessLongRow(row);
+        }
+        return;
+    }
+    for (int64_t row0 = rowStart; row0 < rowEnd; row0 += rowsPerLoad) {
+        ProcessPacked(row0, MinLen(rowsPerLoad, rowEnd - row0));
+    }
+}
+
+template <Routine ROUTINE>
+__aicore__ inline void Blas1BatchedKernel<ROUTINE>::LoadN(int64_t row0, int64_t rows)
+{
+    if (uniform) {
+        return;
+    }
+    DataCopyExtParams copyParams {1, static_cast<uint32_t>(rows * sizeof(int32_t)), 0, 0, 0};
+    DataCopyPadExtParams<int32_t> padParams {false, 0, 0, 0};
+    PipeSync<HardEvent::S_MTE2>();
+    DataCopyPad(nLocal, nGm[row0], copyParams, padParams);
+    PipeSync<HardEvent::MTE2_S>();
+}
+
+// 复数|re| + |im|：偶数位与奇数位分别收集后相加，结果放在pairLocal[0, total / 2)
+template <Routine ROUTINE>
+__aicore__ inline void Blas1BatchedKernel<ROUTINE>::PairSum(int64_t total)
+{
+    uint64_t rsvdCnt = 0;
+    int64_t half = LOAD_FLOATS / 2;
+    for (int64_t done = 0; done < total; done += GATHER_FLOATS) {
+        int64_t cnt = MinLen(GATHER_FLOATS, total - done);
+        uint16_t repeat = static_cast<uint16_t>((cnt + REPEAT_FLOATS - 1) / REPEAT_FLOATS);
+        GatherMask(pairLocal[done / 2], dataLocal[done], EVEN_PATTERN, false, 0, {1, repeat, 8, 0}, rsvdCnt);
+        GatherMask(pairLocal[half + done / 2], dataLocal[done], ODD_PATTERN, false, 0, {1, repeat, 8, 0}, rsvdCnt);
+    }
+    PipeBarrier<PIPE_V>();
+    Add(pairLocal, pairLocal, pairLocal[half], static_cast<int32_t>(total / 2));
+    PipeBarrier<PIPE_V>();
+}
+
+// 逐行归约src中每行的有效元素，结果写到dst[0, rows)
+template <Routine ROUTINE>
+__aicore__ inline void Blas1BatchedKernel<ROUTINE>::ReduceRows(const LocalTensor<float> &dst,
+                                                               const LocalTensor<float> &src, int64_t rows)
+{
+    if (uniform && copyLen <= REPEAT_FLOATS) {
+        // 每行一个repeat，一条指令归约MAX_REPEAT行
+        for (int64_t r = 0; r < rows; r += MAX_REPEAT) {
+            uint8_t repeat = static_cast<uint8_t>(MinLen(MAX_REPEAT, rows - r));
+            WholeReduceSum<float>(dst[r], src[r * pitch], static_cast<int32_t>(copyLen), repeat, 1, 1,
+                                  static_cast<int32_t>(pitch / BLOCK_FLOATS));
+        }
+        PipeBarrier<PIPE_V>();
+        return;
+    }
+    for (int64_t r = 0; r < rows; r++) {
+        int64_t len = ValidLen(r);
+        float value = 0.0f;
+        if (len > 0) {
+            ReduceSum(tmpLocal, src[r * pitch], workLocal, static_cast<int32_t>(len));
+            PipeSync<HardEvent::V_S>();
+            value = tmpLocal.GetValue(0);
+        }
+        dst.SetValue(r, value);
+    }
+    PipeSync<HardEvent::S_V>();
+}
+
+template <Routine ROUTINE>
+__aicore__ inline void Blas1BatchedKernel<ROUTINE>::SumRows(int64_t rows)
+{
+    Abs(dataLocal, dataLocal, static_cast<int32_t>(rows * pitch));
+    PipeBarrier<PIPE_V>();
+    ReduceRows(outLocal, dataLocal, rows);
+}
+
+/*
+ * 整块按元素分到三个桶，每个桶缩放平方后逐行归约，再按行合成，与snrm2的缩放和合成方式一致
+ */
+template <Routine ROUTINE>
+__aicore__ inline void Blas1BatchedKernel<ROUTINE>::Nrm2Rows(int64_t rows)
+{
+    // CompareScalar/Select按256字节处理，行尾与块尾的补齐部分不参与逐行归约
+    uint32_t calCount = static_cast<uint32_t>(CeilAlign(rows * pitch, REPEAT_FLOATS));
+    Abs(dataLocal, dataLocal, calCount);
+    PipeBarrier<PIPE_V>();
+    LocalTensor<uint8_t> smlMask = maskLocal[Nrm2Scaled::SML_IDX * MASK_BYTES];
+    LocalTensor<uint8_t> medMask = maskLocal[Nrm2Scaled::MED_IDX * MASK_BYTES];
+    LocalTensor<uint8_t> bigMask = maskLocal[Nrm2Scaled::BIG_IDX * MASK_BYTES];
+    Nrm2Scaled::SplitBuckets(smlMask, medMask, bigMask, dataLocal, calCount);
+
+    LocalTensor<float> smlRows = bucketLocal[Nrm2Scaled::SML_IDX * MAX_ROWS];
+    LocalTensor<float> medRows = bucketLocal[Nrm2Scaled::MED_IDX * MAX_ROWS];
+    LocalTensor<float> bigRows = bucketLocal[Nrm2Scaled::BIG_IDX * MAX_ROWS];
+    Nrm2Scaled::ScaledSquare(sqLocal, smlMask, dataLocal, Nrm2Scaled::SSML, calCount);
+    ReduceRows(smlRows, sqLocal, rows);
+    Nrm2Scaled::ScaledSquare(sqLocal, medMask, dataLocal, 1.0f, calCount);
+    ReduceRows(medRows, sqLocal, rows);
+    Nrm2Scaled::ScaledSquare(sqLocal, bigMask, dataLocal, Nrm2Scaled::SBIG, calCount);
+    ReduceRows(bigRows, sqLocal, rows);
+
+    // 合成时sqLocal已空闲，用作临时空间；maskLocal按行重新生成掩码
+    Nrm2Scaled::CombineBucketRows(outLocal, smlRows, medRows, bigRows, sqLocal, maskLocal,
+                                  static_cast<uint32_t>(CeilAlign(rows, REPEAT_FLOATS)));
+}
+
+// 长行的一段：三个桶的平方和累加到acc[SML_IDX, MED_IDX, BIG_IDX]
+template <Routine ROUTINE>
+__aicore__ inline void Blas1BatchedKernel<ROUTINE>::Nrm2Chunk(int64_t cnt, float *acc)
+{
+    uint32_t calCount = static_cast<uint32_t>(CeilAlign(cnt, REPEAT_FLOATS));
+    Abs(dataLocal, dataLocal, calCount);
+    PipeBarrier<PIPE_V>();
+    LocalTensor<uint8_t> smlMask = maskLocal[Nrm2Scaled::SML_IDX * MASK_BYTES];
+    LocalTensor<uint8_t> medMask = maskLocal[Nrm2Scaled::MED_IDX * MASK_BYTES];
+    LocalTensor<uint8_t> bigMask = maskLocal[Nrm2Scaled::BIG_IDX * MASK_BYTES];
+    Nrm2Scaled::SplitBuckets(smlMask, medMask, bigMask, dataLocal, calCount);
+    const float scales[Nrm2Scaled::BUCKET_NUM] = {Nrm2Scaled::SSML, 1.0f, Nrm2Scaled::SBIG};
+    for (uint32_t bucket = 0; bucket < Nrm2Scaled::BUCKET_NUM; bucket++) {
+        Nrm2Scaled::ScaledSquare(sqLocal, maskLocal[bucket * MASK_BYTES], dataLocal, scales[bucket], calCount);
+        ReduceSum(tmpLocal, sqLocal, workLocal, static_cast<int32_t>(cnt));
+        PipeSync<HardEvent::V_S>();
+        acc[bucket] += tmpLocal.GetValue(0);
+    }
+    PipeSync<HardEvent::S_V>();
+}
+
+// 结果为1起始的下标，n <= 0时为0，与isamax/icamax一致
+template <Routine ROUTINE>
+__aicore__ inline void Blas1BatchedKernel<ROUTINE>::AmaxRows(int64_t rows)
+{
+    Abs(dataLocal, dataLocal, static_cast<int32_t>(rows * pitch));
+    PipeBarrier<PIPE_V>();
+    LocalTensor<float> src = dataLocal;
+    int64_t srcPitch = pitch;
+    if (elemWidth > 1) {
+        PairSum(rows * pitch);
+        src = pairLocal;
+        srcPitch = pitch / elemWidth;
+    }
+    int64_t elemLen = copyLen / elemWidth;
+    LocalTensor<int32_t> outInt = outLocal.ReinterpretCast<int32_t>();
+    if (uniform && elemLen <= REPEAT_FLOATS) {
+        // [value, index]成对写到workLocal，再取出奇数位的index
+        for (int64_t r = 0; r < rows; r += MAX_REPEAT) {
+            uint8_t repeat = static_cast<uint8_t>(MinLen(MAX_REPEAT, rows - r));
+            WholeReduceMax<float>(workLocal[2 * r], src[r * srcPitch], static_cast<int32_t>(elemLen), repeat, 1, 1,
+                                  static_cast<int32_t>(srcPitch / BLOCK_FLOATS), ReduceOrder::ORDER_VALUE_INDEX);
+        }
+        PipeBarrier<PIPE_V>();
+        uint64_t rsvdCnt = 0;
+        uint16_t repeat = static_cast<uint16_t>((2 * rows + REPEAT_FLOATS - 1) / REPEAT_FLOATS);
+        LocalTensor<uint32_t> outU32 = outLocal.ReinterpretCast<uint32_t>();
+        LocalTensor<uint32_t> workU32 = workLocal.ReinterpretCast<uint32_t>();
+        GatherMask(outU32, workU32, ODD_PATTERN, false, 0, {1, repeat, 8, 0}, rsvdCnt);
+        PipeBarrier<PIPE_V>();
+        Adds(outInt, outInt, 1, static_cast<int32_t>(rows));
+        return;
+    }
+    LocalTensor<uint32_t> tmpU32 = tmpLocal.ReinterpretCast<uint32_t>();
+    for (int64_t r = 0; r < rows; r++) {
+        int64_t len = ValidLen(r) / elemWidth;
+        int32_t index = 0;
+        if (len > 0) {
+            ReduceMax(tmpLocal, src[r * srcPitch], workLocal, static_cast<int32_t>(len), true);
+            PipeSync<HardEvent::V_S>();
+            index = static_cast<int32_t>(tmpU32.GetValue(1)) + 1;
+        }
+        outInt.SetValue(r, index);
+    }
+    PipeSync<HardEvent::S_V>();
+}
+
+template <Routine ROUTINE>
+__aicore__ inline void Blas1BatchedKernel<ROUTINE>::CopyInRows(int64_t row0, int64_t rows)
+{
+    LocalTensor<float> inLocal = inQueue.AllocTensor<float>();
+    uint32_t padBlocks = static_cast<uint32_t>((pitch - CeilAlign(copyLen, BLOCK_FLOATS)) / BLOCK_FLOATS);
+    uint32_t gmGap = static_cast<uint32_t>((rowLen - copyLen) * sizeof(float));
+    DataCopyExtParams inParams {static_cast<uint16_t>(rows), static_cast<uint32_t>(copyLen * sizeof(float)), gmGap,
+                                padBlocks, 0};
+    DataCopyPadExtParams<float> padParams {false, 0, 0, 0};
+    DataCopyPad(inLocal, xGm[row0 * rowLen], inParams, padParams);
+    inQueue.EnQue(inLocal);
+}
+
+template <Routine ROUTINE>
+__aicore__ inline void Blas1BatchedKernel<ROUTINE>::CopyInChunk(int64_t offset, int64_t cnt)
+{
+    LocalTensor<float> inLocal = inQueue.AllocTensor<float>();
+    DataCopyExtParams copyParams {1, static_cast<uint32_t>(cnt * sizeof(float)), 0, 0, 0};
+    DataCopyPadExtParams<float> padParams {false, 0, 0, 0};
+    DataCopyPad(inLocal, xGm[offset], copyParams, padParams);
+    inQueue.EnQue(inLocal);
+}
+
+// n <= 0的归约结果为0（amax的下标同样为0）
+template <Routine ROUTINE>
+__aicore__ inline void Blas1BatchedKernel<ROUTINE>::WriteZeros(int64_t row0, int64_t rows)
+{
+    PipeSync<HardEvent::MTE3_V>();
+    Duplicate(outLocal.ReinterpretCast<int32_t>(), 0, static_cast<int32_t>(rows));
+    PipeSync<HardEvent::V_MTE3>();
+    DataCopyExtParams outParams {1, static_cast<uint32_t>(rows * sizeof(float)), 0, 0, 0};
+    DataCopyPad(yGm[row0], outLocal, outParams);
+}
+
+template <Routine ROUTINE>
+__aicore__ inline void Blas1BatchedKernel<ROUTINE>::ReducePacked(int64_t row0, int64_t rows)
+{
+    dataLocal = inQueue.DeQue<float>();
+    PipeSync<HardEvent::MTE3_V>();
+    if constexpr (ROUTINE == Routine::AMAX) {
+        AmaxRows(rows);
+    } else if constexpr (ROUTINE == Routine::NRM2) {
+        Nrm2Rows(rows);
+    } else {
+        SumRows(rows);
+    }
+    inQueue.FreeTensor(dataLocal);
+    PipeSync<HardEvent::V_MTE3>();
+    DataCopyExtParams outParams {1, static_cast<uint32_t>(rows * sizeof(float)), 0, 0, 0};
+    DataCopyPad(yGm[row0], outLocal, outParams);
+}
+
+template <Routine ROUTINE>
+__aicore__ inline void Blas1BatchedKernel<ROUTINE>::ProcessPacked(int64_t row0, int64_t rows)
+{
+    if (copyLen == 0) {
+        return;
+    }
+    LoadN(row0, rows);
+
+    uint32_t padBlocks = static_cast<uint32_t>((pitch - CeilAlign(copyLen, BLOCK_FLOATS)) / BLOCK_FLOATS);
+    uint32_t gmGap = static_cast<uint32_t>((rowLen - copyLen) * sizeof(float));
+    DataCopyExtParams inParams {static_cast<uint16_t>(rows), static_cast<uint32_t>(copyLen * sizeof(float)), gmGap,
+                                padBlocks, 0};
+    DataCopyExtParams backParams {static_cast<uint16_t>(rows), static_cast<uint32_t>(copyLen * sizeof(float)),
+                                  padBlocks, gmGap, 0};
+    DataCopyPadExtParams<float> padParams {false, 0, 0, 0};
+    PipeSync<HardEvent::MTE3_MTE2>();
+    PipeSync<HardEvent::V_MTE2>();
+    DataCopyPad(dataLocal, xGm[row0 * rowLen], inParams, padParams);
+
+    if constexpr (ROUTINE == Routine::COPY) {
+        PipeSync<HardEvent::MTE2_MTE3>();
+        if (uniform) {
+            DataCopyPad(yGm[row0 * rowLen], dataLocal, backParams);
+            return;
+        }
+        for (int64_t r = 0; r < rows; r++) {
+            int64_t len = ValidLen(r);
+            if (len > 0) {
+                DataCopyExtParams rowParams {1, static_cast<uint32_t>(len * sizeof(float)), 0, 0, 0};
+                DataCopyPad(yGm[(row0 + r) * rowLen], dataLocal[r * pitch], rowParams);
+            }
+        }
+    } else {
+        PipeSync<HardEvent::MTE2_V>();
+        if (uniform) {
+            Muls(dataLocal, dataLocal, alpha, static_cast<int32_t>(rows * pitch));
+        } else {
+            for (int64_t r = 0; r < rows; r++) {
+                int64_t len = ValidLen(r);
+                if (len > 0) {
+                    Muls(dataLocal[r * pitch], dataLocal[r * pitch], alpha, static_cast<int32_t>(len));
+                }
+            }
+        }
+        PipeSync<HardEvent::V_MTE3>();
+        DataCopyPad(yGm[row0 * rowLen], dataLocal, backParams);
+    }
+}
+
+/*
+ * 单行超出UB时按LOAD_FLOATS分段；复数时LOAD_FLOATS为偶数，实部虚部不会跨段
+ */
+template <Routine ROUTINE>
+__aicore__ inline void Blas1BatchedKernel<ROUTINE>::ProcessLongRow(int64_t row)
+{
+    int64_t len = uniform ? copyLen : ClampN(nGm.GetValue(row)) * elemWidth;
+    DataCopyPadExtParams<float> padParams {false, 0, 0, 0};
+    for (int64_t c0 = 0; c0 < len; c0 += LOAD_FLOATS) {
+        int64_t cnt = MinLen(LOAD_FLOATS, len - c0);
+        DataCopyExtParams copyParams {1, static_cast<uint32_t>(cnt * sizeof(float)), 0, 0, 0};
+        PipeSync<HardEvent::MTE3_MTE2>();
+        PipeSync<HardEvent::V_MTE2>();
+        DataCopyPad(dataLocal, xGm[row * rowLen + c0], copyParams, padParams);
+        if constexpr (ROUTINE == Routine::COPY) {
+            PipeSync<HardEvent::MTE2_MTE3>();
+            DataCopyPad(yGm[row * rowLen + c0], dataLocal, copyParams);
+        } else {
+            PipeSync<HardEvent::MTE2_V>();
+            Muls(dataLocal, dataLocal, alpha, static_cast<int32_t>(cnt));
+            PipeSync<HardEvent::V_MTE3>();
+            DataCopyPad(yGm[row * rowLen + c0], dataLocal, copyParams);
+        }
+    }
+}
+
+/*
+ * 归约类的长行：段间在标量侧累加，下一段在当前段归约时搬入
+ */
+template <Routine ROUTINE>
+__aicore__ inline void Blas1BatchedKernel<ROUTINE>::ReduceLongRow(int64_t row)
+{
+    int64_t len = uniform ? copyLen : ClampN(nGm.GetValue(row)) * elemWidth;
+    float acc = 0.0f;
+    float bucketAcc[Nrm2Scaled::BUCKET_NUM] = {0.0f, 0.0f, 0.0f};
+    float best = -1.0f;
+    int64_t bestIndex = -1;
+    LocalTensor<uint32_t> tmpU32 = tmpLocal.ReinterpretCast<uint32_t>();
+    if (len > 0) {
+        CopyInChunk(row * rowLen, MinLen(LOAD_FLOATS, len));
+    }
+    for (int64_t c0 = 0; c0 < len; c0 += LOAD_FLOATS) {
+        int64_t cnt = MinLen(LOAD_FLOATS, len - c0);
+        int64_t next = c0 + LOAD_FLOATS;
+        if (next < len) {
+            CopyInChunk(row * rowLen + next, MinLen(LOAD_FLOATS, len - next));
+        }
+        dataLocal = inQueue.DeQue<float>();
+        if constexpr (ROUTINE == Routine::AMAX) {
+            Abs(dataLocal, dataLocal, static_cast<int32_t>(cnt));
+            PipeBarrier<PIPE_V>();
+            LocalTensor<float> src = dataLocal;
+            if (elemWidth > 1) {
+                PairSum(cnt);
+                src = pairLocal;
+            }
+            ReduceMax(tmpLocal, src, workLocal, static_cast<int32_t>(cnt / elemWidth), true);
+            PipeSync<HardEvent::V_S>();
+            float value = tmpLocal.GetValue(0);
+            // 严格大于，保证取第一个最大值
+            if (value > best) {
+                best = value;
+                bestIndex = c0 / elemWidth + static_cast<int64_t>(tmpU32.GetValue(1));
+            }
+        } else if constexpr (ROUTINE == Routine::NRM2) {
+            Nrm2Chunk(cnt, bucketAcc);
+        } else {
+            Abs(dataLocal, dataLocal, static_cast<int32_t>(cnt));
+            PipeBarrier<PIPE_V>();
+            ReduceSum(tmpLocal, dataLocal, workLocal, static_cast<int32_t>(cnt));
+            PipeSync<HardEvent::V_S>();
+            acc += tmpLocal.GetValue(0);
+        }
+        inQueue.FreeTensor(dataLocal);
+    }
+    PipeSync<HardEvent::MTE3_S>();
+    if constexpr (ROUTINE == Routine::AMAX) {
+        outLocal.ReinterpretCast<int32_t>().SetValue(0, static_cast<int32_t>(bestIndex + 1));
+    } else if constexpr (ROUTINE == Routine::NRM2) {
+        float nrm = Nrm2Scaled::CombineBuckets(bucketAcc[Nrm2Scaled::SML_IDX], bucketAcc[Nrm2Scaled::MED_IDX],
+                                               bucketAcc[Nrm2Scaled::BIG_IDX], tmpLocal);
+        outLocal.SetValue(0, nrm);
+    } else {
+        outLocal.SetValue(0, acc);
+    }
+    PipeSync<HardEvent::S_MTE3>();
+    DataCopyExtParams outParams {1, static_cast<uint32_t>(sizeof(float)), 0, 0, 0};
+    DataCopyPad(yGm[row], outLocal, outParams);
+}
+} // namespace Blas1Batched
+#endif // BLAS1_BATCHED_H_
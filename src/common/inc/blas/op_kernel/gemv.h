@@ -0,0 +1,485 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file gemv.h
+ * \brief vector-unit kernel of sgemv/cgemv, y = alpha * op(a) * x + beta * y.
+ *
+ * a is [batch, m, n] row-major, complex64 is handled as interleaved float pairs. GEMV reads every element of a
+ * exactly once, so it runs on the vector units at memory bandwidth instead of padding N to 16 on the cube unit.
+ *   - trans = N: a unit owns up to 128 rows; for each K tile, x is loaded once and the row tiles are streamed,
+ *     multiplied by x and reduced with two WholeReduceSum passes. Complex rows are dotted against
+ *     [re(x), -im(x)] and [im(x), re(x)], which gives the real and imaginary parts without de-interleaving a.
+ *   - trans = T/C: a unit owns a column block; rows are streamed and accumulated with one Axpy per row
+ *     (two for complex, against re(x_i) and im(x_i)), then combined with a pair swap at the end.
+ * When the output blocks cannot fill all cores, K is split as well: y is first scaled by beta, then after
+ * SyncAll every unit atomically adds alpha * partial. Without K split each unit applies beta itself.
+ */
+#ifndef GEMV_H_
+#define GEMV_H_
+
+#include "kernel_operator.h"
+
+namespace Gemv {
+using namespace AscendC;
+
+constexpr int64_t TILE_FLOATS = 8192;
+constexpr int64_t N_UNIT_ROWS = 128;
+constexpr int64_t N_SMALL_PITCH = 64;
+constexpr int64_t N_K_TILE = 1024;
+constexpr int64_t T_COL_FLOATS = 2048;
+constexpr int64_t T_MAX_ROWS = 1024;
+constexpr int64_t VEC_FLOATS = 2048;
+constexpr int64_t PART_FLOATS = 512;
+constexpr int64_t BLOCK_FLOATS = 8;
+constexpr int64_t REPEAT_FLOATS = 64;
+constexpr int64_t BUFFER_NUM = 2;
+constexpr uint32_t TRANS_N = 0;
+constexpr uint32_t TRANS_T = 1;
+constexpr uint32_t TRANS_C = 2;
+constexpr uint32_t BETA_ONE = 0;
+constexpr uint32_t BETA_ZERO = 1;
+constexpr uint32_t BETA_SCALE = 2;
+
+template <HardEvent EVENT>
+__aicore__ inline void PipeSync()
+{
+    event_t eventId = static_cast<event_t>(GetTPipePtr()->FetchEventID(EVENT));
+    SetFlag<EVENT>(eventId);
+    WaitFlag<EVENT>(eventId);
+}
+
+__aicore__ inline int64_t CeilAlign(int64_t x, int64_t align)
+{
+    return (x + align - 1) / align * align;
+}
+
+__aicore__ inline int64_t MinLen(int64_t a, int64_t b)
+{
+    return a < b ? a : b;
+}
+
+class GemvKernel {
+public:
+    __aicore__ inline GemvKernel() {}
+    __aicore__ inline void Init(GM_ADDR a, GM_ADDR x, GM_ADDR y, const GemvTilingData *tiling);
+    __aicore__ inline void Process();
+
+private:
+    __aicore__ inline void InitComplexTables();
+    __aicore__ inline void ComplexScale(const LocalTensor<float> &v, float re, float im, int64_t count);
+    __aicore__ inline void ScaleY();
+    __aicore__ inline void StoreOut(int64_t offset, const LocalTensor<float> &t, int64_t count);
+    __aicore__ inline void LoadRowX(int64_t b, int64_t k0, int64_t len);
+    __aicore__ inline void DotRows(const LocalTensor<float> &aLocal, const LocalTensor<float> &xv,
+                                   const LocalTensor<float> &rowSum, int64_t rows);
+    __aicore__ inline void CopyInRowTile(int64_t b, int64_t row, int64_t k0, int64_t len, int64_t rows);
+    __aicore__ inline void CopyInColTile(int64_t b, int64_t row, int64_t rows, int64_t col0, int64_t cols,
+                                         const LocalTensor<float> &xDst);
+    __aicore__ inline void ProcessRowUnit(int64_t b, int64_t blk, int64_t ks);
+    __aicore__ inline void ProcessColUnit(int64_t b, int64_t blk, int64_t ks);
+
+private:
+    TPipe pipe;
+    GlobalTensor<float> aGm;
+    GlobalTensor<float> xGm;
+    GlobalTensor<float> yGm;
+
+    TQue<QuePosition::VECIN, BUFFER_NUM> aQueue;
+    TBuf<TPosition::VECCALC> prodBuf;
+    TBuf<TPosition::VECCALC> xBuf;
+    TBuf<TPosition::VECCALC> accBuf;
+    TBuf<TPosition::VECCALC> partBuf;
+    TBuf<TPosition::VECCALC> yBuf;
+    TBuf<TPosition::VECCALC> scratchBuf;
+    TBuf<TPosition::VECCALC> swapBuf;
+    TBuf<TPosition::VECCALC> signBuf;
+
+    LocalTensor<float> prodLocal;
+    LocalTensor<float> xLocal;
+    LocalTensor<float> accLocal;
+    LocalTensor<float> partLocal;
+    LocalTensor<float> yLocal;
+    LocalTensor<float> scratchLocal;
+    LocalTensor<uint32_t> swapLocal;
+    LocalTensor<float> signLocal;
+
+    const GemvTilingData *td {nullptr};
+    int64_t rowLen {0};
+    bool isComplex {false};
+    bool fused {false};
+};
+
+__aicore__ inline void GemvKernel::Init(GM_ADDR a, GM_ADDR x, GM_ADDR y, const GemvTilingData *tiling)
+{
+    td = tiling;
+    isComplex = td->elemWidth > 1;
+    rowLen = td->n * td->elemWidth;
+    fused = td->kSplit == 1;
+    int64_t kElems = td->trans == TRANS_N ? td->n : td->m;
+    aGm.SetGlobalBuffer((__gm__ float *)a, td->batch * td->m * rowLen);
+    xGm.SetGlobalBuffer((__gm__ float *)x, td->batch * kElems * td->elemWidth);
+    yGm.SetGlobalBuffer((__gm__ float *)y, td->batch * td->outLen);
+
+    pipe.InitBuffer(aQueue, BUFFER_NUM, TILE_FLOATS * sizeof(float));
+    pipe.InitBuffer(prodBuf, TILE_FLOATS * sizeof(float));
+    pipe.InitBuffer(xBuf, 2 * VEC_FLOATS * sizeof(float));
+    pipe.InitBuffer(accBuf, 2 * VEC_FLOATS * sizeof(float));
+    pipe.InitBuffer(partBuf, PART_FLOATS * sizeof(float));
+    pipe.InitBuffer(yBuf, VEC_FLOATS * sizeof(float));
+    pipe.InitBuffer(scratchBuf, VEC_FLOATS * sizeof(float));
+    prodLocal = prodBuf.Get<float>();
+    xLocal = xBuf.Get<float>();
+    accLocal = accBuf.Get<float>();
+    partLocal = partBuf.Get<float>();
+    yLocal = yBuf.Get<float>();
+    scratchLocal = scratchBuf.Get<float>();
+    if (isComplex) {
+        pipe.InitBuffer(swapBuf, VEC_FLOATS * sizeof(uint32_t));
+        pipe.InitBuffer(signBuf, VEC_FLOATS * sizeof(float));
+        swapLocal = swapBuf.Get<uint32_t>();
+        signLocal = signBuf.Get<float>();
+        InitComplexTables();
+    }
+    // 行块pitch中超出tileLen的部分DMA不会写到，先清零，避免残留的Inf/NaN与x的补零相乘
+    LocalTensor<float> aPing = aQueue.AllocTensor<float>();
+    LocalTensor<float> aPong = aQueue.AllocTensor<float>();
+    Duplicate(aPing, 0.0f, static_cast<int32_t>(TILE_FLOATS));
+    Duplicate(aPong, 0.0f, static_cast<int32_t>(TILE_FLOATS));
+    aQueue.FreeTensor(aPing);
+    aQueue.FreeTensor(aPong);
+    PipeSync<HardEvent::V_MTE2>();
+}
+
+// swapLocal为交换实部虚部的字节偏移，signLocal为[1, -1, 1, -1, ...]，即共轭的符号
+__aicore__ inline void GemvKernel::InitComplexTables()
+{
+    for (int64_t i = 0; i < VEC_FLOATS; i++) {
+        swapLocal.SetValue(i, static_cast<uint32_t>((i ^ 1) * sizeof(float)));
+        signLocal.SetValue(i, (i & 1) ? -1.0f : 1.0f);
+    }
+    PipeSync<HardEvent::S_V>();
+}
+
+// v = (re + i * im) * v，按交织布局：re * v + im * [-v.im, v.re]
+__aicore__ inline void GemvKernel::ComplexScale(const LocalTensor<float> &v, float re, float im, int64_t count)
+{
+    Gather(scratchLocal, v, swapLocal, 0, static_cast<uint32_t>(count));
+    PipeBarrier<PIPE_V>();
+    Mul(scratchLocal, scratchLocal, signLocal, static_cast<int32_t>(count));
+    PipeBarrier<PIPE_V>();
+    Muls(scratchLocal, scratchLocal, -im, static_cast<int32_t>(count));
+    Muls(v, v, re, static_cast<int32_t>(count));
+    PipeBarrier<PIPE_V>();
+    Add(v, v, scratchLocal, static_cast<int32_t>(count));
+    PipeBarrier<PIPE_V>();
+}
+
+__aicore__ inline void GemvKernel::Process()
+{
+    bool alphaZero = td->alphaRe == 0.0f && td->alphaIm == 0.0f;
+    if (td->betaMode != BETA_ONE && (!fused || alphaZero)) {
+        ScaleY();
+        if (alphaZero) {
+            return;
+        }
+        SyncAll();
+    }
+    if (alphaZero) {
+        return;
+    }
+    int64_t coreNum = td->usedCoreNum;
+    int64_t idx = GetBlockIdx();
+    int64_t base = td->unitNum / coreNum;
+    int64_t rem = td->unitNum % coreNum;
+    int64_t u0 = idx * base + MinLen(idx, rem);
+    int64_t u1 = u0 + base + (idx < rem ? 1 : 0);
+    int64_t unitsPerBatch = td->blockNum * td->kSplit;
+    for (int64_t u = u0; u < u1; u++) {
+        int64_t b = u / unitsPerBatch;
+        int64_t blk = (u % unitsPerBatch) / td->kSplit;
+        int64_t ks = u % td->kSplit;
+        if (td->trans == TRANS_N) {
+            ProcessRowUnit(b, blk, ks);
+        } else {
+            ProcessColUnit(b, blk, ks);
+        }
+    }
+}
+
+// 第一阶段：y = beta * y，按元素均分到各核
+__aicore__ inline void GemvKernel::ScaleY()
+{
+    int64_t total = td->batch * td->outLen;
+    int64_t per = CeilAlign((total + td->usedCoreNum - 1) / td->usedCoreNum, REPEAT_FLOATS);
+    int64_t s0 = GetBlockIdx() * per;
+    int64_t s1 = MinLen(total, s0 + per);
+    for (int64_t off = s0; off < s1; off += VEC_FLOATS) {
+        int64_t cnt = MinLen(VEC_FLOATS, s1 - off);
+        DataCopyExtParams params {1, static_cast<uint32_t>(cnt * sizeof(float)), 0, 0, 0};
+        if (td->betaMode == BETA_ZERO) {
+            // beta = 0时不读y，y中的NaN不传播
+            Duplicate(yLocal, 0.0f, static_cast<int32_t>(cnt));
+        } else {
+            DataCopyPadExtParams<float> padParams {false, 0, 0, 0.0f};
+            DataCopyPad(yLocal, yGm[off], params, padParams);
+            PipeSync<HardEvent::MTE2_V>();
+            if (isComplex) {
+                ComplexScale(yLocal, td->betaRe, td->betaIm, cnt);
+            } else {
+                Muls(yLocal, yLocal, td->betaRe, static_cast<int32_t>(cnt));
+            }
+        }
+        PipeSync<HardEvent::V_MTE3>();
+        DataCopyPad(yGm[off], yLocal, params);
+        PipeSync<HardEvent::MTE3_V>();
+        PipeSync<HardEvent::MTE3_MTE2>();
+    }
+}
+
+// t中已乘alpha；不切K时由本任务完成beta * y并直接写回，否则原子加到已缩放的y上
+__aicore__ inline void GemvKernel::StoreOut(int64_t offset, const LocalTensor<float> &t, int64_t count)
+{
+    DataCopyExtParams params {1, static_cast<uint32_t>(count * sizeof(float)), 0, 0, 0};
+    bool direct = fused && td->betaMode != BETA_ONE;
+    if (direct && td->betaMode == BETA_SCALE) {
+        DataCopyPadExtParams<float> padParams {false, 0, 0, 0.0f};
+        DataCopyPad(yLocal, yGm[offset], params, padParams);
+        PipeSync<HardEvent::MTE2_V>();
+        if (isComplex) {
+            ComplexScale(yLocal, td->betaRe, td->betaIm, count);
+        } else {
+            Muls(yLocal, yLocal, td->betaRe, static_cast<int32_t>(count));
+            PipeBarrier<PIPE_V>();
+        }
+        Add(t, t, yLocal, static_cast<int32_t>(count));
+    }
+    PipeSync<HardEvent::V_MTE3>();
+    if (direct) {
+        DataCopyPad(yGm[offset], t, params);
+    } else {
+        SetAtomicAdd<float>();
+        DataCopyPad(yGm[offset], t, params);
+        SetAtomicNone();
+    }
+    PipeSync<HardEvent::MTE3_V>();
+    PipeSync<HardEvent::MTE3_MTE2>();
+}
+
+// x的一段K：实数直接搬到xLocal[0, pitch)；复数搬到yLocal后生成[re, -im]与[im, re]两份
+__aicore__ inline void GemvKernel::LoadRowX(int64_t b, int64_t k0, int64_t len)
+{
+    int64_t pitch = td->pitch;
+    LocalTensor<float> dst = isComplex ? yLocal : xLocal;
+    PipeSync<HardEvent::V_MTE2>();
+    if (len < pitch) {
+        Duplicate(dst, 0.0f, static_cast<int32_t>(pitch));
+        PipeSync<HardEvent::V_MTE2>();
+    }
+    int64_t alignLen = CeilAlign(len, BLOCK_FLOATS);
+    DataCopyExtParams params {1, static_cast<uint32_t>(len * sizeof(float)), 0, 0, 0};
+    DataCopyPadExtParams<float> padParams {true, 0, static_cast<uint8_t>(alignLen - len), 0.0f};
+    DataCopyPad(dst, xGm[b * td->kLen + k0], params, padParams);
+    PipeSync<HardEvent::MTE2_V>();
+    if (isComplex) {
+        Mul(xLocal, yLocal, signLocal, static_cast<int32_t>(pitch));
+        Gather(xLocal[VEC_FLOATS], yLocal, swapLocal, 0, static_cast<uint32_t>(pitch));
+        PipeBarrier<PIPE_V>();
+    }
+}
+
+// rowSum[r] = sum(aLocal[r, :] * xv)，pitch <= 64时每行一个repeat，否则先按64归约再按行归约
+__aicore__ inline void GemvKernel::DotRows(const LocalTensor<float> &aLocal, const LocalTensor<float> &xv,
+                                           const LocalTensor<float> &rowSum, int64_t rows)
+{
+    int64_t pitch = td->pitch;
+    uint8_t rowStride = static_cast<uint8_t>(pitch / BLOCK_FLOATS);
+    if (pitch <= N_SMALL_PITCH) {
+        Mul(prodLocal, aLocal, xv, static_cast<uint64_t>(pitch), static_cast<uint8_t>(rows),
+            {1, 1, 1, rowStride, rowStride, 0});
+        PipeBarrier<PIPE_V>();
+        WholeReduceSum<float>(rowSum, prodLocal, static_cast<int32_t>(pitch), static_cast<int32_t>(rows), 1, 1,
+                              rowStride);
+    } else {
+        for (int64_t r = 0; r < rows; r++) {
+            Mul(prodLocal[r * pitch], aLocal[r * pitch], xv, static_cast<int32_t>(pitch));
+        }
+        PipeBarrier<PIPE_V>();
+        int64_t partNum = pitch / REPEAT_FLOATS;
+        WholeReduceSum<float>(partLocal, prodLocal, static_cast<int32_t>(REPEAT_FLOATS),
+                              static_cast<int32_t>(rows * partNum), 1, 1, REPEAT_FLOATS / BLOCK_FLOATS);
+        PipeBarrier<PIPE_V>();
+        WholeReduceSum<float>(rowSum, partLocal, static_cast<int32_t>(partNum), static_cast<int32_t>(rows), 1, 1,
+                              static_cast<int32_t>(partNum / BLOCK_FLOATS));
+    }
+    PipeBarrier<PIPE_V>();
+}
+
+__aicore__ inline void GemvKernel::CopyInRowTile(int64_t b, int64_t row, int64_t k0, int64_t len, int64_t rows)
+{
+    int64_t pitch = td->pitch;
+    int64_t alignLen = CeilAlign(len, BLOCK_FLOATS);
+    LocalTensor<float> aLocal = aQueue.AllocTensor<float>();
+    if (len < td->tileLen) {
+        // K尾段：上一块的数据可能残留在[len, tileLen)中
+        Duplicate(aLocal, 0.0f, static_cast<int32_t>(rows * pitch));
+        PipeSync<HardEvent::V_MTE2>();
+    }
+    DataCopyExtParams params {static_cast<uint16_t>(rows), static_cast<uint32_t>(len * sizeof(float)),
+                              static_cast<uint32_t>((rowLen - len) * sizeof(float)),
+                              static_cast<uint32_t>((pitch - alignLen) / BLOCK_FLOATS), 0};
+    DataCopyPadExtParams<float> padParams {true, 0, static_cast<uint8_t>(alignLen - len), 0.0f};
+    DataCopyPad(aLocal, aGm[(b * td->m + row) * rowLen + k0], params, padParams);
+    aQueue.EnQue(aLocal);
+}
+
+__aicore__ inline void GemvKernel::CopyInColTile(int64_t b, int64_t row, int64_t rows, int64_t col0, int64_t cols,
+                                                 const LocalTensor<float> &xDst)
+{
+    int64_t ew = td->elemWidth;
+    DataCopyPadExtParams<float> padParams {false, 0, 0, 0.0f};
+    DataCopyExtParams xParams {1, static_cast<uint32_t>(rows * ew * sizeof(float)), 0, 0, 0};
+    DataCopyPad(xDst, xGm[(b * td->m + row) * ew], xParams, padParams);
+
+    LocalTensor<float> aLocal = aQueue.AllocTensor<float>();
+    int64_t alignCols = CeilAlign(cols, BLOCK_FLOATS);
+    DataCopyExtParams params {static_cast<uint16_t>(rows), static_cast<uint32_t>(cols * sizeof(float)),
+                              static_cast<uint32_t>((rowLen - cols) * sizeof(float)),
+                              static_cast<uint32_t>((td->pitch - alignCols) / BLOCK_FLOATS), 0};
+    DataCopyPad(aLocal, aGm[(b * td->m + row) * rowLen + col0], params, padParams);
+    aQueue.EnQue(aLocal);
+}
+
+// accLocal: [0, 128)为各行实部累加，[128, 256)为虚部，[VEC_FLOATS, ...)存放交织后的结果
+__aicore__ inline void GemvKernel::ProcessRowUnit(int64_t b, int64_t blk, int64_t ks)
+{
+    int64_t row0 = blk * td->outBlock;
+    int64_t rows = MinLen(td->outBlock, td->m - row0);
+    int64_t k0 = ks * td->kChunk;
+    int64_t kEnd = MinLen(td->kLen, k0 + td->kChunk);
+    if (rows <= 0) {
+        return;
+    }
+    LocalTensor<float> accRe = accLocal;
+    LocalTensor<float> accIm = accLocal[N_UNIT_ROWS];
+    LocalTensor<float> sumRe = partLocal[2 * N_UNIT_ROWS];
+    LocalTensor<float> sumIm = partLocal[3 * N_UNIT_ROWS];
+    Duplicate(accLocal, 0.0f, static_cast<int32_t>(2 * N_UNIT_ROWS));
+    PipeBarrier<PIPE_V>();
+
+    int64_t tileRows = td->tileRows;
+    for (int64_t kk = k0; kk < kEnd; kk += td->tileLen) {
+        int64_t len = MinLen(td->tileLen, kEnd - kk);
+        LoadRowX(b, kk, len);
+        // 下一行块的搬运先于本块计算发出，两块UB轮转
+        CopyInRowTile(b, row0, kk, len, MinLen(tileRows, rows));
+        for (int64_t r0 = 0; r0 < rows; r0 += tileRows) {
+            int64_t tr = MinLen(tileRows, rows - r0);
+            if (r0 + tileRows < rows) {
+                CopyInRowTile(b, row0 + r0 + tileRows, kk, len, MinLen(tileRows, rows - r0 - tileRows));
+            }
+            LocalTensor<float> aLocal = aQueue.DeQue<float>();
+            DotRows(aLocal, xLocal, sumRe, tr);
+            Add(accRe[r0], accRe[r0], sumRe, static_cast<int32_t>(tr));
+            if (isComplex) {
+                DotRows(aLocal, xLocal[VEC_FLOATS], sumIm, tr);
+                Add(accIm[r0], accIm[r0], sumIm, static_cast<int32_t>(tr));
+            }
+            PipeBarrier<PIPE_V>();
+            aQueue.FreeTensor(aLocal);
+        }
+    }
+
+    LocalTensor<float> out = accLocal[VEC_FLOATS];
+    if (isComplex) {
+        // 行数不超过128，在标量侧交织并乘复数alpha
+        PipeSync<HardEvent::V_S>();
+        for (int64_t r = 0; r < rows; r++) {
+            float re = accRe.GetValue(r);
+            float im = accIm.GetValue(r);
+            out.SetValue(2 * r, td->alphaRe * re - td->alphaIm * im);
+            out.SetValue(2 * r + 1, td->alphaRe * im + td->alphaIm * re);
+        }
+        PipeSync<HardEvent::S_V>();
+        PipeSync<HardEvent::S_MTE3>();
+    } else {
+        Muls(out, accRe, td->alphaRe, static_cast<int32_t>(rows));
+        PipeBarrier<PIPE_V>();
+    }
+    StoreOut(b * td->outLen + row0 * td->elemWidth, out, rows * td->elemWidth);
+}
+
+// accLocal: [0, VEC_FLOATS)累加sum(re(x_i) * a_i)，[VEC_FLOATS, ...)累加sum(im(x_i) * a_i)
+// x按行块分两半轮转，第i + 1块的x与a在第i块计算前发出，标量侧等到本块计算发出后再同步
+__aicore__ inline void GemvKernel::ProcessColUnit(int64_t b, int64_t blk, int64_t ks)
+{
+    int64_t col0 = blk * td->outBlock;
+    int64_t cols = MinLen(td->outBlock, td->outLen - col0);
+    int64_t r0 = ks * td->kChunk;
+    int64_t rEnd = MinLen(td->m, r0 + td->kChunk);
+    if (cols <= 0) {
+        return;
+    }
+    int64_t ew = td->elemWidth;
+    int64_t pitch = td->pitch;
+    int64_t tileRows = td->tileRows;
+    LocalTensor<float> accP = accLocal;
+    LocalTensor<float> accQ = accLocal[VEC_FLOATS];
+    Duplicate(accLocal, 0.0f, static_cast<int32_t>(2 * VEC_FLOATS));
+    PipeBarrier<PIPE_V>();
+
+    int64_t half = 0;
+    if (r0 < rEnd) {
+        CopyInColTile(b, r0, MinLen(tileRows, rEnd - r0), col0, cols, xLocal);
+        PipeSync<HardEvent::MTE2_S>();
+    }
+    for (int64_t rr = r0; rr < rEnd; rr += tileRows) {
+        int64_t rows = MinLen(tileRows, rEnd - rr);
+        LocalTensor<float> xCur = xLocal[half * VEC_FLOATS];
+        if (rr + tileRows < rEnd) {
+            CopyInColTile(b, rr + tileRows, MinLen(tileRows, rEnd - rr - tileRows), col0, cols,
+                          xLocal[(1 - half) * VEC_FLOATS]);
+        }
+        LocalTensor<float> aLocal = aQueue.DeQue<float>();
+        for (int64_t r = 0; r < rows; r++) {
+            Axpy(accP, aLocal[r * pitch], xCur.GetValue(r * ew), static_cast<int32_t>(cols));
+            if (isComplex) {
+                Axpy(accQ, aLocal[r * pitch], xCur.GetValue(r * ew + 1), static_cast<int32_t>(cols));
+            }
+        }
+        PipeBarrier<PIPE_V>();
+        aQueue.FreeTensor(aLocal);
+        PipeSync<HardEvent::MTE2_S>();
+        half = 1 - half;
+    }
+
+    if (isComplex) {
+        // T: y = P + [-Q.im, Q.re]；C: y = conj(P) + [Q.im, Q.re]
+        Gather(scratchLocal, accQ, swapLocal, 0, static_cast<uint32_t>(cols));
+        PipeBarrier<PIPE_V>();
+        if (td->trans == TRANS_C) {
+            Mul(accP, accP, signLocal, static_cast<int32_t>(cols));
+            PipeBarrier<PIPE_V>();
+            Add(accP, accP, scratchLocal, static_cast<int32_t>(cols));
+        } else {
+            Mul(scratchLocal, scratchLocal, signLocal, static_cast<int32_t>(cols));
+            PipeBarrier<PIPE_V>();
+            Sub(accP, accP, scratchLocal, static_cast<int32_t>(cols));
+        }
+        PipeBarrier<PIPE_V>();
+        ComplexScale(accP, td->alphaRe, td->alphaIm, cols);
+    } else {
+        Muls(accP, accP, td->alphaRe, static_cast<int32_t>(cols));
+        PipeBarrier<PIPE_V>();
+    }
+    StoreOut(b * td->outLen + col0, accP, cols);
+}
+} // namespace Gemv
+#endif // GEMV_H_
@@ -0,0 +1,403 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file nrm2_scaled.h
+ * \brief one-pass overflow-safe euclidean norm shared by snrm2 and scnrm2.
+ *
+ * Blue's algorithm as in reference BLAS (LAPACK 3.10 snrm2): every |x| falls into exactly one of three buckets
+ *   - big    (|x| > TBIG):  accumulate (|x| * SBIG)^2
+ *   - small  (|x| < TSML):  accumulate (|x| * SSML)^2
+ *   - medium (otherwise):   accumulate |x|^2
+ * so no partial sum can overflow or underflow, and x is read only once. Each core writes its three partial sums
+ * to its own workspace slot; after SyncAll core 0 adds the slots bucket by bucket and combines them.
+ * complex64 input is handled as 2n floats, the norm is the same.
+ * The bucket split and the final combine are free functions so that the strided-batched nrm2 applies the same
+ * scaling per vector.
+ */
+#ifndef NRM2_SCALED_H_
+#define NRM2_SCALED_H_
+
+#include "kernel_operator.h"
+
+namespace Nrm2Scaled {
+using namespace AscendC;
+
+constexpr uint32_t BUFFER_NUM = 2;
+constexpr uint32_t BLOCK_FLOATS = 8;
+constexpr uint32_t REPEAT_FLOATS = 64;
+constexpr uint32_t MAX_DATA_COUNT = 12288;  // 48KB，双缓冲输入加一块scratch
+constexpr uint32_t MAX_CORE_NUM = 40;       // 与tiling中startOffset/calNum数组长度一致
+constexpr uint32_t SLOT_FLOATS = 8;         // 每核workspace槽位：[small, medium, big, 0...]
+constexpr uint32_t BUCKET_NUM = 3;
+constexpr uint32_t SML_IDX = 0;
+constexpr uint32_t MED_IDX = 1;
+constexpr uint32_t BIG_IDX = 2;
+
+// float下radix=2, digits=24, minexponent=-125, maxexponent=128
+constexpr float TSML = 1.0842021724855044e-19f;  // 2^-63
+constexpr float TBIG = 4.5035996273704960e+15f;  // 2^52
+constexpr float SSML = 3.7778931862957162e+22f;  // 2^75
+constexpr float SBIG = 1.3234889800848443e-23f;  // 2^-76
+constexpr float INV_SSML = 2.6469779601696886e-23f;  // 2^-75
+constexpr float INV_SBIG = 7.5557863725914323e+22f;  // 2^76
+
+template <HardEvent EVENT>
+__aicore__ inline void PipeSync()
+{
+    event_t eventId = static_cast<event_t>(GetTPipePtr()->FetchEventID(EVENT));
+    SetFlag<EVENT>(eventId);
+    WaitFlag<EVENT>(eventId);
+}
+
+__aicore__ inline uint32_t CeilAlign(uint32_t x, uint32_t align)
+{
+    return (x + align - 1) / align * align;
+}
+
+/*
+ * 按|x|生成三个桶的掩码，每个掩码calCount / 8字节，calCount需为64的倍数
+ */
+__aicore__ inline void SplitBuckets(const LocalTensor<uint8_t> &smlMask, const LocalTensor<uint8_t> &medMask,
+                                    const LocalTensor<uint8_t> &bigMask, const LocalTensor<float> &absLocal,
+                                    uint32_t calCount)
+{
+    CompareScalar(smlMask, absLocal, TSML, CMPMODE::LT, calCount);
+    CompareScalar(bigMask, absLocal, TBIG, CMPMODE::GT, calCount);
+    PipeBarrier<PIPE_V>();
+    // medium取not(small or big)而不是两个比较相与，NaN比较恒为假，会落在medium桶中继续传播
+    uint32_t maskHalfs = calCount / 16;
+    Or(medMask.ReinterpretCast<uint16_t>(), smlMask.ReinterpretCast<uint16_t>(), bigMask.ReinterpretCast<uint16_t>(),
+       maskHalfs);
+    PipeBarrier<PIPE_V>();
+    Not(medMask.ReinterpretCast<uint16_t>(), medMask.ReinterpretCast<uint16_t>(), maskHalfs);
+    PipeBarrier<PIPE_V>();
+}
+
+// dst = (mask ? |x| * scale : 0)^2
+__aicore__ inline void ScaledSquare(const LocalTensor<float> &dst, const LocalTensor<uint8_t> &mask,
+                                    const LocalTensor<float> &absLocal, float scale, uint32_t calCount)
+{
+    Select(dst, mask, absLocal, 0.0f, SELMODE::VSEL_TENSOR_SCALAR_MODE, calCount);
+    PipeBarrier<PIPE_V>();
+    if (scale != 1.0f) {
+        Muls(dst, dst, scale, calCount);
+        PipeBarrier<PIPE_V>();
+    }
+    Mul(dst, dst, dst, calCount);
+    PipeBarrier<PIPE_V>();
+}
+
+/*
+ * 三个桶的平方和合成范数，标量侧的开方借用sqrtLocal（至少8个float）在vector上完成
+ */
+__aicore__ inline float CombineBuckets(float asml, float amed, float abig, const LocalTensor<float> &sqrtLocal)
+{
+    float scl = 1.0f;
+    float sumsq = amed;
+    bool medValid = amed > 0.0f || amed != amed;
+    if (abig > 0.0f) {
+        // 存在big时small可忽略，medium按big的比例合入
+        if (medValid) {
+            abig += (amed * SBIG) * SBIG;
+        }
+        scl = INV_SBIG;
+        sumsq = abig;
+    } else if (asml > 0.0f) {
+        if (medValid) {
+            sqrtLocal.SetValue(0, amed);
+            sqrtLocal.SetValue(1, asml);
+            PipeSync<HardEvent::S_V>();
+            Sqrt(sqrtLocal, sqrtLocal, BLOCK_FLOATS);
+            PipeSync<HardEvent::V_S>();
+            float ymed = sqrtLocal.GetValue(0);
+            float ysml = sqrtLocal.GetValue(1) * INV_SSML;
+            float ymin = ysml > ymed ? ymed : ysml;
+            float ymax = ysml > ymed ? ysml : ymed;
+            float ratio = ymin / ymax;
+            scl = 1.0f;
+            sumsq = ymax * ymax * (1.0f + ratio * ratio);
+        } else {
+            scl = INV_SSML;
+            sumsq = asml;
+        }
+    }
+    sqrtLocal.SetValue(0, sumsq);
+    PipeSync<HardEvent::S_V>();
+    Sqrt(sqrtLocal, sqrtLocal, BLOCK_FLOATS);
+    PipeSync<HardEvent::V_S>();
+    return scl * sqrtLocal.GetValue(0);
+}
+
+/*
+ * CombineBuckets的向量版本，count个向量各自的三个桶一次合成，分支改为掩码选择。
+ * count需为64的倍数；tmpLocal至少2 * count个float，maskLocal至少3 * count / 8字节；dst不能与输入重叠。
+ */
+__aicore__ inline void CombineBucketRows(const LocalTensor<float> &dst, const LocalTensor<float> &sml,
+                                         const LocalTensor<float> &med, const LocalTensor<float> &big,
+                                         const LocalTensor<float> &tmpLocal, const LocalTensor<uint8_t> &maskLocal,
+                                         uint32_t count)
+{
+    uint32_t maskBytes = count / 8;
+    LocalTensor<uint8_t> smlMask = maskLocal[SML_IDX * maskBytes];
+    LocalTensor<uint8_t> medMask = maskLocal[MED_IDX * maskBytes];
+    LocalTensor<uint8_t> bigMask = maskLocal[BIG_IDX * maskBytes];
+    LocalTensor<float> ymax = tmpLocal;
+    LocalTensor<float> ymin = tmpLocal[count];
+    CompareScalar(smlMask, sml, 0.0f, CMPMODE::GT, count);
+    CompareScalar(bigMask, big, 0.0f, CMPMODE::GT, count);
+    // medValid = not(med <= 0)，NaN同样视为有效
+    CompareScalar(medMask, med, 0.0f, CMPMODE::LE, count);
+    PipeBarrier<PIPE_V>();
+    Not(medMask.ReinterpretCast<uint16_t>(), medMask.ReinterpretCast<uint16_t>(), count / 16);
+
+    // small与medium并存：sqrt(ymax^2 * (1 + (ymin / ymax)^2))
+    Sqrt(dst, med, count);
+    Sqrt(ymin, sml, count);
+    PipeBarrier<PIPE_V>();
+    Muls(ymin, ymin, INV_SSML, count);
+    PipeBarrier<PIPE_V>();
+    Max(ymax, dst, ymin, count);
+    PipeBarrier<PIPE_V>();
+    Min(ymin, dst, ymin, count);
+    PipeBarrier<PIPE_V>();
+    Div(ymin, ymin, ymax, count);
+    PipeBarrier<PIPE_V>();
+    Mul(ymin, ymin, ymin, count);
+    Mul(ymax, ymax, ymax, count);
+    PipeBarrier<PIPE_V>();
+    Adds(ymin, ymin, 1.0f, count);
+    PipeBarrier<PIPE_V>();
+    Mul(ymax, ymax, ymin, count);
+    PipeBarrier<PIPE_V>();
+    Sqrt(ymax, ymax, count);
+    // 只有small：sqrt(asml) / SSML
+    Sqrt(ymin, sml, count);
+    PipeBarrier<PIPE_V>();
+    Muls(ymin, ymin, INV_SSML, count);
+    PipeBarrier<PIPE_V>();
+    Select(ymin, medMask, ymax, ymin, SELMODE::VSEL_TENSOR_TENSOR_MODE, count);
+    PipeBarrier<PIPE_V>();
+    // 没有small时dst中的sqrt(amed)即为结果
+    Select(dst, smlMask, ymin, dst, SELMODE::VSEL_TENSOR_TENSOR_MODE, count);
+
+    // 存在big：sqrt(abig + amed * SBIG^2) / SBIG
+    Muls(ymax, med, SBIG, count);
+    PipeBarrier<PIPE_V>();
+    Muls(ymax, ymax, SBIG, count);
+    PipeBarrier<PIPE_V>();
+    Add(ymax, ymax, big, count);
+    PipeBarrier<PIPE_V>();
+    Sqrt(ymax, ymax, count);
+    PipeBarrier<PIPE_V>();
+    Muls(ymax, ymax, INV_SBIG, count);
+    PipeBarrier<PIPE_V>();
+    Select(dst, bigMask, ymax, dst, SELMODE::VSEL_TENSOR_TENSOR_MODE, count);
+    PipeBarrier<PIPE_V>();
+}
+
+class Nrm2ScaledAIV {
+public:
+    __aicore__ inline Nrm2ScaledAIV() {}
+    __aicore__ inline void Init(GM_ADDR x, GM_ADDR result, GM_ADDR workSpace, GM_ADDR tilingGm);
+    __aicore__ inline void Process();
+
+private:
+    __aicore__ inline void ParseTilingData(GM_ADDR tilingGm);
+    __aicore__ inline void CopyIn(uint32_t offset, uint32_t dataCount);
+    __aicore__ inline void Accumulate(uint32_t dataCount);
+    __aicore__ inline void AccumulateBucket(const LocalTensor<float> &absLocal, const LocalTensor<uint8_t> &mask,
+                                            float scale, uint32_t bucket, uint32_t dataCount);
+    __aicore__ inline void StoreSlot();
+    __aicore__ inline void PostProcess();
+
+private:
+    TPipe pipe;
+
+    GlobalTensor<float> inGM;
+    GlobalTensor<float> outGM;
+    GlobalTensor<float> workGM;
+
+    TQue<QuePosition::VECIN, BUFFER_NUM> inQueue;
+    TBuf<TPosition::VECCALC> tmpBuf;
+    TBuf<TPosition::VECCALC> maskBuf;
+    TBuf<TPosition::VECCALC> workBuf;
+    TBuf<TPosition::VECCALC> redBuf;
+    TBuf<TPosition::VECCALC> accBuf;
+    TBuf<TPosition::VECCALC> outBuf;
+
+    uint32_t n = 0;  // total elements num(float32)
+    uint32_t calNum = 0;
+    uint32_t startOffset = 0;
+    uint32_t maskBytes = 0;
+    int32_t vecIdx = 0;
+    int32_t blockNum = 0;
+};
+
+__aicore__ inline void Nrm2ScaledAIV::Init(GM_ADDR x, GM_ADDR result, GM_ADDR workSpace, GM_ADDR tilingGm)
+{
+    blockNum = GetBlockNum();
+    vecIdx = GetBlockIdx();
+
+    ParseTilingData(tilingGm);
+
+    inGM.SetGlobalBuffer((__gm__ float *)x, n);
+    outGM.SetGlobalBuffer((__gm__ float *)result, 1);
+    workGM.SetGlobalBuffer((__gm__ float *)workSpace, blockNum * SLOT_FLOATS);
+
+    // 三个掩码各占MAX_DATA_COUNT / 8字节：big、small以及二者取反得到的medium
+    maskBytes = MAX_DATA_COUNT / 8;
+    uint32_t workFloats = CeilAlign(MAX_DATA_COUNT / REPEAT_FLOATS, BLOCK_FLOATS);
+    pipe.InitBuffer(inQueue, BUFFER_NUM, MAX_DATA_COUNT * sizeof(float));
+    pipe.InitBuffer(tmpBuf, MAX_DATA_COUNT * sizeof(float));
+    pipe.InitBuffer(maskBuf, BUCKET_NUM * maskBytes);
+    pipe.InitBuffer(workBuf, workFloats * sizeof(float));
+    pipe.InitBuffer(redBuf, BUCKET_NUM * BLOCK_FLOATS * sizeof(float));
+    pipe.InitBuffer(accBuf, BUCKET_NUM * BLOCK_FLOATS * sizeof(float));
+    pipe.InitBuffer(outBuf, SLOT_FLOATS * sizeof(float));
+
+    Duplicate<float>(redBuf.Get<float>(), 0.0f, BUCKET_NUM * BLOCK_FLOATS);
+    Duplicate<float>(accBuf.Get<float>(), 0.0f, BUCKET_NUM * BLOCK_FLOATS);
+    PipeBarrier<PIPE_V>();
+}
+
+__aicore__ inline void Nrm2ScaledAIV::ParseTilingData(GM_ADDR tilingGm)
+{
+    // 与Snrm2TilingData/Scnrm2TilingData布局一致：n, useCoreNum, startOffset[40], calNum[40]
+    auto tilingBuf = reinterpret_cast<__gm__ uint8_t *>(tilingGm);
+
+    n = (*(__gm__ uint32_t *)(tilingBuf));
+    startOffset = (*(__gm__ uint32_t *)(tilingBuf + 2 * sizeof(uint32_t) + sizeof(uint32_t) * vecIdx));
+    calNum = (*(__gm__ uint32_t *)(tilingBuf + 2 * sizeof(uint32_t) + MAX_CORE_NUM * sizeof(uint32_t) +
+                                   sizeof(uint32_t) * vecIdx));
+}
+
+__aicore__ inline void Nrm2ScaledAIV::Process()
+{
+    // 双缓冲：当前块累加前先发起下一块的搬入
+    uint32_t endOffset = startOffset + calNum;
+    if (calNum > 0) {
+        CopyIn(startOffset, calNum < MAX_DATA_COUNT ? calNum : MAX_DATA_COUNT);
+    }
+    for (uint32_t currOffset = startOffset; currOffset < endOffset; currOffset += MAX_DATA_COUNT) {
+        uint32_t remain = endOffset - currOffset;
+        uint32_t dataCount = remain < MAX_DATA_COUNT ? remain : MAX_DATA_COUNT;
+        uint32_t nextOffset = currOffset + dataCount;
+        if (nextOffset < endOffset) {
+            uint32_t nextRemain = endOffset - nextOffset;
+            CopyIn(nextOffset, nextRemain < MAX_DATA_COUNT ? nextRemain : MAX_DATA_COUNT);
+        }
+        Accumulate(dataCount);
+    }
+
+    // 没有分到数据的核也写零槽位，保证所有核都参与SyncAll
+    StoreSlot();
+    SyncAll();
+
+    if (vecIdx == 0) {
+        PostProcess();
+    }
+}
+
+__aicore__ inline void Nrm2ScaledAIV::CopyIn(uint32_t offset, uint32_t dataCount)
+{
+    LocalTensor<float> inLocal = inQueue.AllocTensor<float>();
+    uint8_t paddingNum = static_cast<uint8_t>((BLOCK_FLOATS - dataCount % BLOCK_FLOATS) % BLOCK_FLOATS);
+    DataCopyExtParams copyParams{1, static_cast<uint32_t>(dataCount * sizeof(float)), 0, 0, 0};
+    DataCopyPadExtParams<float> padParams{true, 0, paddingNum, 0.0f};
+    DataCopyPad(inLocal, inGM[offset], copyParams, padParams);
+    inQueue.EnQue<float>(inLocal);
+}
+
+__aicore__ inline void Nrm2ScaledAIV::Accumulate(uint32_t dataCount)
+{
+    LocalTensor<float> inLocal = inQueue.DeQue<float>();
+
+    // CompareScalar/Select要求256字节对齐，尾部补0，0落入small桶且平方为0
+    uint32_t blockAligned = CeilAlign(dataCount, BLOCK_FLOATS);
+    uint32_t calCount = CeilAlign(dataCount, REPEAT_FLOATS);
+    if (calCount > blockAligned) {
+        Duplicate<float>(inLocal[blockAligned], 0.0f, calCount - blockAligned);
+    }
+    Abs(inLocal, inLocal, calCount);
+    PipeBarrier<PIPE_V>();
+
+    LocalTensor<uint8_t> maskLocal = maskBuf.Get<uint8_t>();
+    LocalTensor<uint8_t> smlMask = maskLocal[SML_IDX * maskBytes];
+    LocalTensor<uint8_t> medMask = maskLocal[MED_IDX * maskBytes];
+    LocalTensor<uint8_t> bigMask = maskLocal[BIG_IDX * maskBytes];
+    SplitBuckets(smlMask, medMask, bigMask, inLocal, calCount);
+
+    AccumulateBucket(inLocal, smlMask, SSML, SML_IDX, calCount);
+    AccumulateBucket(inLocal, medMask, 1.0f, MED_IDX, calCount);
+    AccumulateBucket(inLocal, bigMask, SBIG, BIG_IDX, calCount);
+
+    LocalTensor<float> accLocal = accBuf.Get<float>();
+    Add(accLocal, accLocal, redBuf.Get<float>(), BUCKET_NUM * BLOCK_FLOATS);
+    PipeBarrier<PIPE_V>();
+
+    inQueue.FreeTensor(inLocal);
+}
+
+__aicore__ inline void Nrm2ScaledAIV::AccumulateBucket(const LocalTensor<float> &absLocal,
+                                                       const LocalTensor<uint8_t> &mask, float scale, uint32_t bucket,
+                                                       uint32_t dataCount)
+{
+    LocalTensor<float> tmpLocal = tmpBuf.Get<float>();
+    LocalTensor<float> redLocal = redBuf.Get<float>();
+    ScaledSquare(tmpLocal, mask, absLocal, scale, dataCount);
+    ReduceSum(redLocal[bucket * BLOCK_FLOATS], tmpLocal, workBuf.Get<float>(), dataCount);
+    PipeBarrier<PIPE_V>();
+}
+
+__aicore__ inline void Nrm2ScaledAIV::StoreSlot()
+{
+    LocalTensor<float> accLocal = accBuf.Get<float>();
+    LocalTensor<float> outLocal = outBuf.Get<float>();
+    PipeSync<HardEvent::V_S>();
+    for (uint32_t i = 0; i < SLOT_FLOATS; i++) {
+        outLocal.SetValue(i, i < BUCKET_NUM ? accLocal.GetValue(i * BLOCK_FLOATS) : 0.0f);
+    }
+    PipeSync<HardEvent::S_MTE3>();
+    DataCopyExtParams copyParams{1, static_cast<uint32_t>(SLOT_FLOATS * sizeof(float)), 0, 0, 0};
+    DataCopyPad(workGM[vecIdx * SLOT_FLOATS], outLocal, copyParams);
+    PipeBarrier<PIPE_MTE3>();
+}
+
+__aicore__ inline void Nrm2ScaledAIV::PostProcess()
+{
+    // 槽位经输入队列搬入，各核同一桶内的缩放相同，按核顺序在vector上逐槽相加
+    LocalTensor<float> slotLocal = inQueue.AllocTensor<float>();
+    DataCopyExtParams copyParams{1, static_cast<uint32_t>(blockNum * SLOT_FLOATS * sizeof(float)), 0, 0, 0};
+    DataCopyPadExtParams<float> padParams{false, 0, 0, 0.0f};
+    DataCopyPad(slotLocal, workGM, copyParams, padParams);
+    inQueue.EnQue<float>(slotLocal);
+    slotLocal = inQueue.DeQue<float>();
+
+    LocalTensor<float> sumLocal = redBuf.Get<float>();
+    Duplicate<float>(sumLocal, 0.0f, SLOT_FLOATS);
+    PipeBarrier<PIPE_V>();
+    for (int32_t i = 0; i < blockNum; i++) {
+        Add(sumLocal, sumLocal, slotLocal[i * SLOT_FLOATS], SLOT_FLOATS);
+        PipeBarrier<PIPE_V>();
+    }
+    inQueue.FreeTensor(slotLocal);
+    PipeSync<HardEvent::V_S>();
+    float nrm = CombineBuckets(sumLocal.GetValue(SML_IDX), sumLocal.GetValue(MED_IDX), sumLocal.GetValue(BIG_IDX),
+                               outBuf.Get<float>());
+
+    LocalTensor<float> outLocal = outBuf.Get<float>();
+    outLocal.SetValue(0, nrm);
+    PipeSync<HardEvent::S_MTE3>();
+    DataCopyExtParams outParams{1, static_cast<uint32_t>(sizeof(float)), 0, 0, 0};
+    DataCopyPad(outGM, outLocal, outParams);
+}
+} // namespace Nrm2Scaled
+#endif // NRM2_SCALED_H_
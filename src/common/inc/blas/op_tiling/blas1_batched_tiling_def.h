@@ -0,0 +1,32 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file blas1_batched_tiling_def.h
+ * \brief tiling data shared by the strided-batched level-1 BLAS ops.
+ */
+#ifndef BLAS1_BATCHED_TILING_DEF_H_
+#define BLAS1_BATCHED_TILING_DEF_H_
+
+#include "register/tilingdata_base.h"
+
+namespace optiling {
+// x为[batch, stride]，每行一个向量；n由输入tensor给出，tiling只依赖batch与stride
+BEGIN_TILING_DATA_DEF(Blas1BatchedTilingData)
+TILING_DATA_FIELD_DEF(int64_t, batch);
+TILING_DATA_FIELD_DEF(int64_t, stride);
+TILING_DATA_FIELD_DEF(int64_t, nNum);
+TILING_DATA_FIELD_DEF(int64_t, rowsPerCore);
+TILING_DATA_FIELD_DEF(uint32_t, usedCoreNum);
+TILING_DATA_FIELD_DEF(uint32_t, elemWidth);
+TILING_DATA_FIELD_DEF(float, alpha);
+END_TILING_DATA_DEF;
+} // namespace optiling
+#endif // BLAS1_BATCHED_TILING_DEF_H_
@@ -0,0 +1,97 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file blas1_batched_tiling_func.h
+ * \brief tiling and shape inference shared by the strided-batched level-1 BLAS ops.
+ */
+#ifndef BLAS1_BATCHED_TILING_FUNC_H_
+#define BLAS1_BATCHED_TILING_FUNC_H_
+
+#include <algorithm>
+#include "register/op_def_registry.h"
+#include "tiling/platform/platform_ascendc.h"
+#include "blas1_batched_tiling_def.h"
+
+namespace optiling {
+constexpr int64_t BLAS1_BATCHED_MIN_ROWS_PER_CORE = 8;
+constexpr size_t BLAS1_BATCHED_X_IDX = 0;
+constexpr size_t BLAS1_BATCHED_N_IDX = 1;
+constexpr uint32_t BLAS1_BATCHED_COMPLEX_WIDTH = 2;
+
+// x为1维时视为batch = 1
+inline void GetBlas1BatchedShape(const gert::Shape &xShape, int64_t &batch, int64_t &stride)
+{
+    size_t dimNum = xShape.GetDimNum();
+    batch = dimNum > 1 ? xShape.GetDim(0) : 1;
+    stride = dimNum > 1 ? xShape.GetDim(1) : xShape.GetDim(0);
+}
+
+inline ge::graphStatus Blas1BatchedTiling(gert::TilingContext *context, float alpha)
+{
+    auto xShape = context->GetInputShape(BLAS1_BATCHED_X_IDX);
+    auto nShape = context->GetInputShape(BLAS1_BATCHED_N_IDX);
+    auto xDesc = context->GetInputDesc(BLAS1_BATCHED_X_IDX);
+    if (xShape == nullptr || nShape == nullptr || xDesc == nullptr) {
+        return ge::GRAPH_FAILED;
+    }
+    int64_t batch = 0;
+    int64_t stride = 0;
+    GetBlas1BatchedShape(xShape->GetStorageShape(), batch, stride);
+    int64_t nNum = nShape->GetStorageShape().GetShapeSize();
+    if (xShape->GetStorageShape().GetDimNum() > 2 || (nNum != 1 && nNum != batch)) {
+        return ge::GRAPH_FAILED;
+    }
+
+    auto ascendcPlatform = platform_ascendc::PlatformAscendC(context->GetPlatformInfo());
+    int64_t coreNum = ascendcPlatform.GetCoreNumAiv();
+    // 每核至少分到若干个向量，避免小batch时核启动开销大于计算
+    int64_t usedCoreNum = (batch + BLAS1_BATCHED_MIN_ROWS_PER_CORE - 1) / BLAS1_BATCHED_MIN_ROWS_PER_CORE;
+    usedCoreNum = std::max<int64_t>(1, std::min(usedCoreNum, coreNum));
+    int64_t rowsPerCore = (batch + usedCoreNum - 1) / usedCoreNum;
+    usedCoreNum = rowsPerCore == 0 ? 1 : (batch + rowsPerCore - 1) / rowsPerCore;
+
+    Blas1BatchedTilingData tiling;
+    tiling.set_batch(batch);
+    tiling.set_stride(stride);
+    tiling.set_nNum(nNum);
+    tiling.set_rowsPerCore(rowsPerCore);
+    tiling.set_usedCoreNum(static_cast<uint32_t>(usedCoreNum));
+    tiling.set_elemWidth(xDesc->GetDataType() == ge::DT_COMPLEX64 ? BLAS1_BATCHED_COMPLEX_WIDTH : 1);
+    tiling.set_alpha(alpha);
+
+    context->SetTilingKey(0);
+    context->SetBlockDim(static_cast<uint32_t>(usedCoreNum));
+    tiling.SaveToBuffer(context->GetRawTilingData()->GetData(), context->GetRawTilingData()->GetCapacity());
+    context->GetRawTilingData()->SetDataSize(tiling.GetDataSize());
+    size_t *currentWorkspace = context->GetWorkspaceSizes(1);
+    currentWorkspace[0] = 0;
+    return ge::GRAPH_SUCCESS;
+}
+} // namespace optiling
+
+namespace ge {
+// 归约类接口每个向量输出一个结果，shape为[batch]
+inline graphStatus InferShapeForBlas1BatchedReduce(gert::InferShapeContext *context)
+{
+    const gert::Shape *xShape = context->GetInputShape(0);
+    gert::Shape *resultShape = context->GetOutputShape(0);
+    if (xShape == nullptr || resultShape == nullptr) {
+        return GRAPH_FAILED;
+    }
+    int64_t batch = 0;
+    int64_t stride = 0;
+    optiling::GetBlas1BatchedShape(*xShape, batch, stride);
+    resultShape->SetDimNum(1);
+    resultShape->SetDim(0, batch);
+    return GRAPH_SUCCESS;
+}
+} // namespace ge
+#endif // BLAS1_BATCHED_TILING_FUNC_H_
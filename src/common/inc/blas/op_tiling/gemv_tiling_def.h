@@ -0,0 +1,47 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file gemv_tiling_def.h
+ * \brief tiling data shared by sgemv and cgemv.
+ */
+#ifndef GEMV_TILING_DEF_H_
+#define GEMV_TILING_DEF_H_
+
+#include "register/tilingdata_base.h"
+
+namespace optiling {
+// a为[batch, m, n]行主序；长度类字段均以float为单位，复数为实部虚部交织的2个float
+// 任务按(batch, 输出块, K切分)编号，各核分到连续的一段任务
+BEGIN_TILING_DATA_DEF(GemvTilingData)
+TILING_DATA_FIELD_DEF(int64_t, batch);
+TILING_DATA_FIELD_DEF(int64_t, m);
+TILING_DATA_FIELD_DEF(int64_t, n);
+TILING_DATA_FIELD_DEF(int64_t, outLen);
+TILING_DATA_FIELD_DEF(int64_t, kLen);
+TILING_DATA_FIELD_DEF(int64_t, outBlock);
+TILING_DATA_FIELD_DEF(int64_t, blockNum);
+TILING_DATA_FIELD_DEF(int64_t, kChunk);
+TILING_DATA_FIELD_DEF(int64_t, kSplit);
+TILING_DATA_FIELD_DEF(int64_t, unitNum);
+TILING_DATA_FIELD_DEF(int64_t, tileLen);
+TILING_DATA_FIELD_DEF(int64_t, pitch);
+TILING_DATA_FIELD_DEF(int64_t, tileRows);
+TILING_DATA_FIELD_DEF(uint32_t, trans);
+TILING_DATA_FIELD_DEF(uint32_t, elemWidth);
+TILING_DATA_FIELD_DEF(uint32_t, betaMode);
+TILING_DATA_FIELD_DEF(uint32_t, usedCoreNum);
+TILING_DATA_FIELD_DEF(float, alphaRe);
+TILING_DATA_FIELD_DEF(float, alphaIm);
+TILING_DATA_FIELD_DEF(float, betaRe);
+TILING_DATA_FIELD_DEF(float, betaIm);
+END_TILING_DATA_DEF;
+} // namespace optiling
+#endif // GEMV_TILING_DEF_H_
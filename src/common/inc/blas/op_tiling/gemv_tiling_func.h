@@ -0,0 +1,181 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file gemv_tiling_func.h
+ * \brief tiling shared by sgemv and cgemv.
+ */
+#ifndef GEMV_TILING_FUNC_H_
+#define GEMV_TILING_FUNC_H_
+
+#include <algorithm>
+#include <string>
+#include "register/op_def_registry.h"
+#include "tiling/platform/platform_ascendc.h"
+#include "gemv_tiling_def.h"
+
+namespace optiling {
+constexpr size_t GEMV_A_IDX = 0;
+constexpr size_t GEMV_X_IDX = 1;
+constexpr size_t GEMV_Y_IDX = 2;
+constexpr uint32_t GEMV_TRANS_N = 0;
+constexpr uint32_t GEMV_TRANS_T = 1;
+constexpr uint32_t GEMV_TRANS_C = 2;
+constexpr uint32_t GEMV_BETA_ONE = 0;
+constexpr uint32_t GEMV_BETA_ZERO = 1;
+constexpr uint32_t GEMV_BETA_SCALE = 2;
+constexpr uint32_t GEMV_COMPLEX_WIDTH = 2;
+// 以下取值与kernel中UB划分一致
+constexpr int64_t GEMV_TILE_FLOATS = 8192;
+constexpr int64_t GEMV_N_UNIT_ROWS = 128;
+constexpr int64_t GEMV_N_K_TILE = 1024;
+constexpr int64_t GEMV_N_SMALL_PITCH = 64;
+constexpr int64_t GEMV_N_PITCH_ALIGN = 512;
+constexpr int64_t GEMV_T_COL_FLOATS = 2048;
+constexpr int64_t GEMV_T_MAX_ROWS = 1024;
+constexpr int64_t GEMV_BLOCK_FLOATS = 8;
+constexpr int64_t GEMV_REPEAT_FLOATS = 64;
+constexpr int64_t GEMV_SYS_WORK_SPACE = 16 * 1024 * 1024;
+
+inline int64_t GemvCeilDiv(int64_t x, int64_t y)
+{
+    return y == 0 ? 0 : (x + y - 1) / y;
+}
+
+inline int64_t GemvCeilAlign(int64_t x, int64_t align)
+{
+    return GemvCeilDiv(x, align) * align;
+}
+
+inline uint32_t GemvParseTrans(const char *trans, bool isComplex)
+{
+    if (trans == nullptr || trans[0] == 'N' || trans[0] == 'n') {
+        return GEMV_TRANS_N;
+    }
+    if ((trans[0] == 'C' || trans[0] == 'c') && isComplex) {
+        return GEMV_TRANS_C;
+    }
+    return GEMV_TRANS_T;
+}
+
+// op(a)x中每个输出元素是一段连续的点积（trans = N）或一列的加权和（trans = T/C）
+// 输出块数不足以占满所有核时沿K再切分，部分和用原子加合并
+inline ge::graphStatus GemvTiling(gert::TilingContext *context, const char *transStr, float alphaRe, float alphaIm,
+                                  float betaRe, float betaIm)
+{
+    auto aShape = context->GetInputShape(GEMV_A_IDX);
+    auto xShape = context->GetInputShape(GEMV_X_IDX);
+    auto yShape = context->GetInputShape(GEMV_Y_IDX);
+    auto aDesc = context->GetInputDesc(GEMV_A_IDX);
+    if (aShape == nullptr || xShape == nullptr || yShape == nullptr || aDesc == nullptr) {
+        return ge::GRAPH_FAILED;
+    }
+    const gert::Shape &aStorage = aShape->GetStorageShape();
+    size_t dimNum = aStorage.GetDimNum();
+    if (dimNum != 2 && dimNum != 3) {
+        return ge::GRAPH_FAILED;
+    }
+    int64_t batch = dimNum == 3 ? aStorage.GetDim(0) : 1;
+    int64_t m = aStorage.GetDim(dimNum - 2);
+    int64_t n = aStorage.GetDim(dimNum - 1);
+    bool isComplex = aDesc->GetDataType() == ge::DT_COMPLEX64;
+    int64_t elemWidth = isComplex ? GEMV_COMPLEX_WIDTH : 1;
+    uint32_t trans = GemvParseTrans(transStr, isComplex);
+    int64_t outElems = trans == GEMV_TRANS_N ? m : n;
+    int64_t kElems = trans == GEMV_TRANS_N ? n : m;
+    if (xShape->GetStorageShape().GetShapeSize() != batch * kElems ||
+        yShape->GetStorageShape().GetShapeSize() != batch * outElems) {
+        return ge::GRAPH_FAILED;
+    }
+
+    int64_t outLen = outElems * elemWidth;
+    int64_t kLen = 0;
+    int64_t outBlock = 0;
+    int64_t tileLen = 0;
+    int64_t pitch = 0;
+    int64_t tileRows = 0;
+    int64_t minChunk = 0;
+    if (trans == GEMV_TRANS_N) {
+        // 每个任务负责outBlock行，K方向按tileLen分段，一段x搬入一次供各行复用
+        kLen = n * elemWidth;
+        tileLen = std::max<int64_t>(1, std::min(kLen, GEMV_N_K_TILE));
+        pitch = tileLen <= GEMV_N_SMALL_PITCH ? GemvCeilAlign(tileLen, GEMV_BLOCK_FLOATS) :
+                                                GemvCeilAlign(tileLen, GEMV_N_PITCH_ALIGN);
+        tileRows = std::min(GEMV_TILE_FLOATS / pitch, GEMV_N_UNIT_ROWS) / GEMV_BLOCK_FLOATS * GEMV_BLOCK_FLOATS;
+        outBlock = std::max<int64_t>(1, std::min(m, GEMV_N_UNIT_ROWS));
+        minChunk = 2 * GEMV_N_K_TILE;
+    } else {
+        // 每个任务负责outBlock个float宽的列块，逐行Axpy累加
+        kLen = m;
+        outBlock = std::max<int64_t>(elemWidth, std::min(outLen, GEMV_T_COL_FLOATS));
+        tileLen = outBlock;
+        pitch = GemvCeilAlign(outBlock, GEMV_BLOCK_FLOATS);
+        tileRows = std::min(GEMV_TILE_FLOATS / pitch, GEMV_T_MAX_ROWS);
+        minChunk = tileRows;
+    }
+    int64_t outUnits = trans == GEMV_TRANS_N ? outElems : outLen;
+    int64_t blockNum = std::max<int64_t>(1, GemvCeilDiv(outUnits, outBlock));
+
+    auto ascendcPlatform = platform_ascendc::PlatformAscendC(context->GetPlatformInfo());
+    int64_t coreNum = ascendcPlatform.GetCoreNumAiv();
+    int64_t baseUnits = batch * blockNum;
+    int64_t kSplit = 1;
+    if (baseUnits < coreNum && kLen > minChunk) {
+        kSplit = std::min(GemvCeilDiv(coreNum, baseUnits), GemvCeilDiv(kLen, minChunk));
+    }
+    int64_t kChunk = std::max<int64_t>(1, GemvCeilDiv(kLen, kSplit));
+    if (trans == GEMV_TRANS_N) {
+        kChunk = GemvCeilAlign(kChunk, GEMV_REPEAT_FLOATS);
+    }
+    kSplit = std::max<int64_t>(1, GemvCeilDiv(kLen, kChunk));
+    int64_t unitNum = baseUnits * kSplit;
+    int64_t usedCoreNum = std::max<int64_t>(1, std::min(coreNum, unitNum));
+
+    uint32_t betaMode = GEMV_BETA_SCALE;
+    if (betaRe == 1.0f && betaIm == 0.0f) {
+        betaMode = GEMV_BETA_ONE;
+    } else if (betaRe == 0.0f && betaIm == 0.0f) {
+        betaMode = GEMV_BETA_ZERO;
+    }
+
+    GemvTilingData tiling;
+    tiling.set_batch(batch);
+    tiling.set_m(m);
+    tiling.set_n(n);
+    tiling.set_outLen(outLen);
+    tiling.set_kLen(kLen);
+    tiling.set_outBlock(outBlock);
+    tiling.set_blockNum(blockNum);
+    tiling.set_kChunk(kChunk);
+    tiling.set_kSplit(kSplit);
+    tiling.set_unitNum(unitNum);
+    tiling.set_tileLen(tileLen);
+    tiling.set_pitch(pitch);
+    tiling.set_tileRows(tileRows);
+    tiling.set_trans(trans);
+    tiling.set_elemWidth(static_cast<uint32_t>(elemWidth));
+    tiling.set_betaMode(betaMode);
+    tiling.set_usedCoreNum(static_cast<uint32_t>(usedCoreNum));
+    tiling.set_alphaRe(alphaRe);
+    tiling.set_alphaIm(alphaIm);
+    tiling.set_betaRe(betaRe);
+    tiling.set_betaIm(betaIm);
+
+    context->SetTilingKey(0);
+    context->SetBlockDim(static_cast<uint32_t>(usedCoreNum));
+    tiling.SaveToBuffer(context->GetRawTilingData()->GetData(), context->GetRawTilingData()->GetCapacity());
+    context->GetRawTilingData()->SetDataSize(tiling.GetDataSize());
+    size_t *currentWorkspace = context->GetWorkspaceSizes(1);
+    // K切分时先整体缩放y再原子加，两阶段之间需要SyncAll
+    currentWorkspace[0] = GEMV_SYS_WORK_SPACE;
+    return ge::GRAPH_SUCCESS;
+}
+} // namespace optiling
+#endif // GEMV_TILING_FUNC_H_
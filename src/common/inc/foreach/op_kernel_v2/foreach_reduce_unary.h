@@ -40,6 +40,11 @@ public:
         static_assert(std::is_member_function_pointer_v<decltype(&OpPredicate::ReduceOp)>);
         pred.ReduceOp(dstLocal, srcLocal, workLocal, count);
     }
+
+    __aicore__ inline P RevertAfterReduceOp(P value) {
+        static_assert(std::is_member_function_pointer_v<decltype(&OpPredicate::RevertAfterReduceOp)>);
+        return pred.RevertAfterReduceOp(value);
+    }
 private:
     OpPredicate &pred;
 };
@@ -162,6 +167,7 @@ public:
     __aicore__ inline ForeachReduceUnary(OpPredicate &op) : Base(*this), reduceAdapter(op){};
     __aicore__ inline void Init(GM_ADDR x, GM_ADDR y, GM_ADDR workspace, const Tiling* tilingData);
     using Base::Process;
+    using Base::ProcessGlobal;
 
 private:
     InnerComputer<T, P, OpPredicate> computer;
@@ -207,6 +213,60 @@ private:
         computer.ReduceCompute(reduceAdapter, dstLocal, srcLocal, workLocal, count);
     }
 
+    __aicore__ inline void ComputeGlobalRound2(uint16_t dataCount, uint16_t index, LocalTensor<P>& tempLocal) {
+        LocalTensor<P> dataLocal = Base::dataQueue.template DeQue<P>();
+
+        if (dataCount > 1) {
+            pipe_barrier(PIPE_V);
+            reduceAdapter.ReduceOp(dataLocal, dataLocal, dataLocal, dataCount);
+        }
+        SetFlag<HardEvent::V_S>(EVENT_ID0);
+        WaitFlag<HardEvent::V_S>(EVENT_ID0);
+        SetValueAdapter<P>(tempLocal, dataLocal.GetValue(0), index);
+        SetFlag<HardEvent::S_V>(EVENT_ID1);
+        WaitFlag<HardEvent::S_V>(EVENT_ID1);
+
+        Base::dataQueue.FreeTensor(dataLocal);
+    }
+
+    __aicore__ inline void MergeGlobalPrev(P prevValue, uint16_t index, LocalTensor<P>& tempLocal) {
+        // the previous result already went through AfterReduceOp, map it back to a middle value first
+        SetValueAdapter<P>(tempLocal, reduceAdapter.RevertAfterReduceOp(prevValue), index);
+        SetFlag<HardEvent::S_V>(EVENT_ID1);
+        WaitFlag<HardEvent::S_V>(EVENT_ID1);
+    }
+
+    __aicore__ inline void CopyOutGlobal(uint16_t dataCount, LocalTensor<P>& tempLocal) {
+        LocalTensor<P> outLocal = Base::outQueue.template AllocTensor<P>();
+
+        if (dataCount == 0) {
+            SetValueAdapter<P>(outLocal, float(0.0), 0);
+            SetFlag<HardEvent::S_V>(EVENT_ID1);
+            WaitFlag<HardEvent::S_V>(EVENT_ID1);
+        } else {
+            if (dataCount > 1) {
+                pipe_barrier(PIPE_V);
+                reduceAdapter.ReduceOp(tempLocal, tempLocal, tempLocal, dataCount);
+            }
+            pipe_barrier(PIPE_V);
+            reduceAdapter.AfterReduceOp(outLocal, tempLocal, 1);
+            pipe_barrier(PIPE_V);
+        }
+
+        event_t eventID1 = static_cast<event_t>(GetTPipePtr()->FetchEventID(HardEvent::V_MTE3));
+        SetFlag<HardEvent::V_MTE3>(eventID1);
+        WaitFlag<HardEvent::V_MTE3>(eventID1);
+
+        DataCopyExtParams copyParams{1, static_cast<uint32_t>(sizeof(P)), 0, 0, 0}; // 结构体DataCopyExtParams最后一个参数是rsv保留位
+        DataCopyPad(Base::globalOutTensorGM, outLocal, copyParams);
+
+        event_t eventID2 = static_cast<event_t>(GetTPipePtr()->FetchEventID(HardEvent::MTE3_MTE2));
+        SetFlag<HardEvent::MTE3_MTE2>(eventID2);
+        WaitFlag<HardEvent::MTE3_MTE2>(eventID2);
+
+        Base::outQueue.FreeTensor(outLocal);
+    }
+
     __aicore__ inline void BeforeProcess() {
     }
 
@@ -44,8 +44,14 @@ protected:
     explicit __aicore__ inline KernelForeadhReduce(Predicate &p): Base(), pred(p) {};
     __aicore__ inline void Init(GM_ADDR x, GM_ADDR y, GM_ADDR workspace, const Tiling* tilingData);
     __aicore__ inline void Process();
+    __aicore__ inline void ProcessGlobal(GM_ADDR prevGlobal = nullptr);
     __aicore__ inline void SingleTensorProcess(int64_t dataCount, uint16_t offset);
 private:
+    __aicore__ inline void ProcessStage1();
+    __aicore__ inline void SyncAllCores();
+    __aicore__ inline void ComputeGlobalRound2(uint16_t dataCount, uint16_t index, LocalTensor<P>& tempLocal);
+    __aicore__ inline void CopyOutGlobal(uint16_t dataCount, LocalTensor<P>& tempLocal);
+    __aicore__ inline void MergeGlobalPrev(P prevValue, uint16_t index, LocalTensor<P>& tempLocal);
     __aicore__ inline void CopyInStage1(uint32_t index, int64_t dataCount);
     __aicore__ inline void CopyInFromWorkspace(uint16_t dataCount, uint16_t offset);
     __aicore__ inline void Copy2Workspace(uint32_t index, int64_t dataCount);
@@ -70,6 +76,7 @@ protected:
     GlobalTensor<T> inTensorGM;
     GlobalTensor<T> outTensorGM;
     GlobalTensor<P> workTensorGM;
+    GlobalTensor<P> globalOutTensorGM;
 
     GM_ADDR inTensorPtr = nullptr;
     GM_ADDR outTensorPtr = nullptr;
@@ -119,9 +126,75 @@ __aicore__ inline void  KernelForeadhReduce<T, P, Predicate, bufferNum, paramsCo
         float32Tensor = float32Queue.DeQue<float>(); 
     }
 
+    ProcessStage1();
+
+    SyncAllCores();
+
+    // Stage2 
+    for (uint16_t i = Base::blockIdx; i < Base::totalTensorCount; i += Base::needCoreNum) {
+        outTensorGM.SetGlobalBuffer(Base::GetTensorAddr(i, outTensorPtr));
+        if (Base::tensorDataCountList[i] == 0) {
+            OutputZero();
+            continue;
+        }
+        CopyInFromWorkspace(Base::tensorMiddleCountList[i], Base::tensorMiddleStartList[i]);
+        ComputeRound2(Base::tensorMiddleCountList[i], Base::tensorMiddleStartList[i]);
+    }
+
+    if (std::is_same<T, bfloat16_t>::value || std::is_same<T, half>::value) {
+        float32Queue.FreeTensor(float32Tensor);
+    }
+}
+
+/**
+ * Reduce the whole tensor list into a single value of type P, written to y as a plain tensor (not a list).
+ * Stage1 is shared with Process(); after the cross-core sync, core 0 folds every tensor's middle values and
+ * then all tensors together, so the result never leaves the device between the reduce and its consumer.
+ */
+template <typename T, typename P, typename Predicate, int32_t bufferNum, uint8_t paramsCount, typename Tiling>
+__aicore__ inline void  KernelForeadhReduce<T, P, Predicate, bufferNum, paramsCount, Tiling>::ProcessGlobal(GM_ADDR prevGlobal) {
+    if (std::is_same<T, bfloat16_t>::value || std::is_same<T, half>::value) {
+        float32Tensor = float32Queue.DeQue<float>();
+    }
+
+    ProcessStage1();
+
+    SyncAllCores();
+
+    // Stage2: only core 0 is needed, the middle values are at most MAX_CORE_CONT + MAX_TENSOR_CONT
+    if (Base::blockIdx == 0) {
+        globalOutTensorGM.SetGlobalBuffer((__gm__ P*)outTensorPtr, 1);
+        LocalTensor<P> tempLocal = calcBuf.Get<P>();
+        uint16_t validTensorCount = 0;
+        for (uint16_t i = 0; i < Base::totalTensorCount; i++) {
+            // empty tensors never write their middle value in stage1
+            if (Base::tensorDataCountList[i] == 0) {
+                continue;
+            }
+            CopyInFromWorkspace(Base::tensorMiddleCountList[i], Base::tensorMiddleStartList[i]);
+            ComputeGlobalRound2(Base::tensorMiddleCountList[i], validTensorCount, tempLocal);
+            validTensorCount++;
+        }
+        // prevGlobal holds the result of an earlier launch over the preceding part of the list,
+        // it joins the fold as one more middle value so lists longer than MAX_TENSOR_CONT can be chained
+        if (prevGlobal != nullptr) {
+            GlobalTensor<P> prevGlobalGM;
+            prevGlobalGM.SetGlobalBuffer((__gm__ P*)prevGlobal, 1);
+            MergeGlobalPrev(prevGlobalGM.GetValue(0), validTensorCount, tempLocal);
+            validTensorCount++;
+        }
+        CopyOutGlobal(validTensorCount, tempLocal);
+    }
+
+    if (std::is_same<T, bfloat16_t>::value || std::is_same<T, half>::value) {
+        float32Queue.FreeTensor(float32Tensor);
+    }
+}
+
+template <typename T, typename P, typename Predicate, int32_t bufferNum, uint8_t paramsCount, typename Tiling>
+__aicore__ inline void  KernelForeadhReduce<T, P, Predicate, bufferNum, paramsCount, Tiling>::ProcessStage1() {
     BeforeProcess();
 
-    // stage1
     for (uint16_t i = Base::tensorStart; i <= Base::tensorEnd; i++) {
         if ( Base::tensorDataCountList[i] == 0) {
             continue;
@@ -145,27 +218,14 @@ __aicore__ inline void  KernelForeadhReduce<T, P, Predicate, bufferNum, paramsCo
     }
 
     AfterProcess();
+}
 
-    // Sync All Cores
+template <typename T, typename P, typename Predicate, int32_t bufferNum, uint8_t paramsCount, typename Tiling>
+__aicore__ inline void  KernelForeadhReduce<T, P, Predicate, bufferNum, paramsCount, Tiling>::SyncAllCores() {
     uint16_t flagId = 1;
     constexpr uint8_t mode = 0;
     CrossCoreSetFlag<mode, PIPE_MTE3>(flagId);
     CrossCoreWaitFlag(flagId);
-
-    // Stage2 
-    for (uint16_t i = Base::blockIdx; i < Base::totalTensorCount; i += Base::needCoreNum) {
-        outTensorGM.SetGlobalBuffer(Base::GetTensorAddr(i, outTensorPtr));
-        if (Base::tensorDataCountList[i] == 0) {
-            OutputZero();
-            continue;
-        }
-        CopyInFromWorkspace(Base::tensorMiddleCountList[i], Base::tensorMiddleStartList[i]);
-        ComputeRound2(Base::tensorMiddleCountList[i], Base::tensorMiddleStartList[i]);
-    }
-
-    if (std::is_same<T, bfloat16_t>::value || std::is_same<T, half>::value) {
-        float32Queue.FreeTensor(float32Tensor);
-    }
 }
 
 template <typename T, typename P, typename Predicate, int32_t bufferNum, uint8_t paramsCount, typename Tiling>
@@ -245,6 +305,24 @@ __aicore__ inline void KernelForeadhReduce<T, P, Predicate, bufferNum, paramsCou
     }
 }
 
+template <typename T, typename P, typename Predicate , int32_t bufferNum, uint8_t paramsCount, typename Tiling>
+__aicore__ inline void KernelForeadhReduce<T, P, Predicate, bufferNum, paramsCount, Tiling>::ComputeGlobalRound2(uint16_t dataCount, uint16_t index, LocalTensor<P>& tempLocal) {
+    static_assert(std::is_member_function_pointer_v<decltype(&Predicate::ComputeGlobalRound2)>);
+    pred.ComputeGlobalRound2(dataCount, index, tempLocal);
+}
+
+template <typename T, typename P, typename Predicate , int32_t bufferNum, uint8_t paramsCount, typename Tiling>
+__aicore__ inline void KernelForeadhReduce<T, P, Predicate, bufferNum, paramsCount, Tiling>::CopyOutGlobal(uint16_t dataCount, LocalTensor<P>& tempLocal) {
+    static_assert(std::is_member_function_pointer_v<decltype(&Predicate::CopyOutGlobal)>);
+    pred.CopyOutGlobal(dataCount, tempLocal);
+}
+
+template <typename T, typename P, typename Predicate , int32_t bufferNum, uint8_t paramsCount, typename Tiling>
+__aicore__ inline void KernelForeadhReduce<T, P, Predicate, bufferNum, paramsCount, Tiling>::MergeGlobalPrev(P prevValue, uint16_t index, LocalTensor<P>& tempLocal) {
+    static_assert(std::is_member_function_pointer_v<decltype(&Predicate::MergeGlobalPrev)>);
+    pred.MergeGlobalPrev(prevValue, index, tempLocal);
+}
+
 template <typename T, typename P, typename Predicate , int32_t bufferNum, uint8_t paramsCount, typename Tiling>
 __aicore__ inline void KernelForeadhReduce<T, P, Predicate, bufferNum, paramsCount, Tiling>::ReduceCompute(LocalTensor<P>& dstLocal, LocalTensor<P>& srcLocal, LocalTensor<P>& workLocal, int32_t count) {
     static_assert(std::is_member_function_pointer_v<decltype(&Predicate::ReduceCompute)>);
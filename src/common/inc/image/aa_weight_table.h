@@ -0,0 +1,289 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file aa_weight_table.h
+ * \brief vectorized weight matrix of the separable antialias resize (bilinear / bicubic, forward and grad).
+ *
+ * The matrix of a slice is built in two vector passes instead of per-element scalar loops:
+ *   1. table[j][o]: normalized weight of the j-th tap of output o, the normalization uses the full window;
+ *   2. dst(o, p): gathered from the table with j = inStart + p - xmin(o), zero outside the window.
+ * center / xmin / xsize of every output are recomputed with the same float ops as the kernels' index tensors,
+ * so the windows are bit-identical with the scalar path.
+ */
+#ifndef AA_WEIGHT_TABLE_H_
+#define AA_WEIGHT_TABLE_H_
+
+#include "kernel_operator.h"
+
+namespace AAResize {
+using namespace AscendC;
+
+constexpr int32_t TABLE_MAX_SIZE = 4096;
+constexpr int32_t TABLE_CHUNK = 1024;
+constexpr int32_t TABLE_CALC_NUM = 5;
+constexpr int32_t TABLE_ROW_ALIGN = 8;
+constexpr float TABLE_TOTAL_EPS = 1e-20f;
+
+struct AAWindowParam {
+  float scale;
+  float invscale;
+  float support;
+  float inSize;
+  float interpSize;
+};
+
+// 系数矩阵的排布：outMajor时元素(o, p)位于o * stride + p，否则位于p * stride + o
+struct AAWeightLayout {
+  int64_t outStart;
+  int32_t outNum;
+  int64_t inStart;
+  int32_t inNum;
+  int32_t stride;
+  bool outMajor;
+};
+
+struct BilinearFilter {
+  // w = max(0, 1 - |x|)，x会被改写
+  __aicore__ inline static void Compute(const LocalTensor<float>& w, const LocalTensor<float>& x,
+                                        const LocalTensor<float>& tmp0, const LocalTensor<float>& tmp1,
+                                        int32_t count) {
+    Abs(x, x, count);
+    Muls(w, x, -1.0f, count);
+    Adds(w, w, 1.0f, count);
+    Maxs(w, w, 0.0f, count);
+  }
+};
+
+struct BicubicFilter {
+  // a = -0.5的三次卷积核，按k = floor(min(|x|, 2))分段：k = 0取内段，k = 1取外段，k = 2取0
+  __aicore__ inline static void Compute(const LocalTensor<float>& w, const LocalTensor<float>& x,
+                                        const LocalTensor<float>& tmp0, const LocalTensor<float>& tmp1,
+                                        int32_t count) {
+    Abs(x, x, count);
+    Mins(tmp0, x, 2.0f, count);
+    Floor(tmp0, tmp0, count);
+
+    // (1.5|x| - 2.5)|x|^2 + 1，k = 0时保留
+    Muls(w, x, 1.5f, count);
+    Adds(w, w, -2.5f, count);
+    Mul(w, w, x, count);
+    Mul(w, w, x, count);
+    Adds(w, w, 1.0f, count);
+    Muls(tmp1, tmp0, -1.0f, count);
+    Adds(tmp1, tmp1, 1.0f, count);
+    Maxs(tmp1, tmp1, 0.0f, count);
+    Mul(w, w, tmp1, count);
+
+    // ((-0.5|x| + 2.5)|x| - 4)|x| + 2，k = 1时保留
+    Muls(tmp1, x, -0.5f, count);
+    Adds(tmp1, tmp1, 2.5f, count);
+    Mul(tmp1, tmp1, x, count);
+    Adds(tmp1, tmp1, -4.0f, count);
+    Mul(tmp1, tmp1, x, count);
+    Adds(tmp1, tmp1, 2.0f, count);
+    Mins(x, tmp0, 1.0f, count);
+    Adds(tmp0, tmp0, -1.0f, count);
+    Maxs(tmp0, tmp0, 0.0f, count);
+    Sub(x, x, tmp0, count);
+    Mul(tmp1, tmp1, x, count);
+    Add(w, w, tmp1, count);
+  }
+};
+
+template <typename Filter>
+class AAWeightTable {
+public:
+  __aicore__ inline AAWeightTable() {}
+
+  __aicore__ inline void Init(TPipe* pipe) {
+    pipe->InitBuffer(tableBuf_, TABLE_MAX_SIZE * sizeof(float));
+    pipe->InitBuffer(scratchBuf_, TABLE_MAX_SIZE * sizeof(float));
+    pipe->InitBuffer(calcBuf_, TABLE_CALC_NUM * TABLE_CHUNK * sizeof(float));
+  }
+
+  // 权重表放不下时调用方回退到标量路径
+  __aicore__ inline bool Fits(const AAWindowParam& window, int64_t outNum) const {
+    return outNum > 0 && (static_cast<int64_t>(window.interpSize) + 1) * AlignRow(outNum) <= TABLE_MAX_SIZE;
+  }
+
+  // dst中layout覆盖的(outMajor ? outNum : inNum) * stride个元素全部改写，窗口外为0
+  __aicore__ inline void Build(const LocalTensor<float>& dst, const AAWindowParam& window,
+                               const AAWeightLayout& layout) {
+    int32_t rowNum = AlignRow(layout.outNum);
+    int32_t interpSize = static_cast<int32_t>(window.interpSize);
+    LocalTensor<float> table = tableBuf_.Get<float>();
+    BuildTable(table, window, layout.outStart, rowNum, interpSize);
+    Normalize(table, rowNum, interpSize);
+    GatherMatrix(dst, table, window, layout, rowNum, interpSize);
+  }
+
+private:
+  __aicore__ inline static int32_t AlignRow(int64_t outNum) {
+    return static_cast<int32_t>((outNum + TABLE_ROW_ALIGN - 1) / TABLE_ROW_ALIGN * TABLE_ROW_ALIGN);
+  }
+
+  // center / xmin / xsize与kernel中的下标计算保持相同的运算顺序，xSize可与center共用buffer
+  __aicore__ inline static void ComputeWindow(const LocalTensor<float>& center, const LocalTensor<float>& xMin,
+                                              const LocalTensor<float>& xSize, const AAWindowParam& window,
+                                              int32_t count) {
+    Adds(center, center, 0.5f, count);
+    Muls(center, center, window.scale, count);
+
+    Adds(xMin, center, 0.5f - window.support, count);
+    Floor(xMin, xMin, count);
+    Maxs(xMin, xMin, 0.0f, count);
+
+    Adds(xSize, center, 0.5f + window.support, count);
+    Floor(xSize, xSize, count);
+    Mins(xSize, xSize, window.inSize, count);
+    Sub(xSize, xSize, xMin, count);
+    Mins(xSize, xSize, window.interpSize, count);
+    Maxs(xSize, xSize, 0.0f, count);
+  }
+
+  // 平铺下标e拆成(q, m)：q = floor((e + 0.5) / stride)，m = e - q * stride，均为精确整数
+  __aicore__ inline static void SplitIndex(const LocalTensor<float>& q, const LocalTensor<float>& m,
+                                           int32_t offset, int32_t stride, int32_t count) {
+    ArithProgression(m, static_cast<float>(offset), 1.0f, count);
+    PipeBarrier<PIPE_V>();
+    Adds(q, m, 0.5f, count);
+    Muls(q, q, 1.0f / static_cast<float>(stride), count);
+    Floor(q, q, count);
+    Axpy(m, q, -static_cast<float>(stride), count);
+  }
+
+  // table[j * rowNum + o]为输出outStart + o第j个抽头的权重，窗口外为0
+  __aicore__ inline void BuildTable(const LocalTensor<float>& table, const AAWindowParam& window, int64_t outStart,
+                                    int32_t rowNum, int32_t interpSize) {
+    LocalTensor<float> calc = calcBuf_.Get<float>();
+    LocalTensor<float> tapTensor = calc;
+    LocalTensor<float> centerTensor = calc[TABLE_CHUNK];
+    LocalTensor<float> xMinTensor = calc[TABLE_CHUNK * 2];
+    LocalTensor<float> xSizeTensor = calc[TABLE_CHUNK * 3];
+    LocalTensor<float> tmpTensor = calc[TABLE_CHUNK * 4];
+
+    int32_t total = interpSize * rowNum;
+    for (int32_t offset = 0; offset < total; offset += TABLE_CHUNK) {
+      int32_t count = total - offset < TABLE_CHUNK ? total - offset : TABLE_CHUNK;
+      SplitIndex(tapTensor, centerTensor, offset, rowNum, count);
+      Adds(centerTensor, centerTensor, static_cast<float>(outStart), count);
+      ComputeWindow(centerTensor, xMinTensor, xSizeTensor, window, count);
+
+      // x = (j + xmin - center + 0.5) * invscale，有效位为j < xsize
+      Sub(centerTensor, xMinTensor, centerTensor, count);
+      Adds(centerTensor, centerTensor, 0.5f, count);
+      Add(centerTensor, centerTensor, tapTensor, count);
+      Muls(centerTensor, centerTensor, window.invscale, count);
+      Sub(xSizeTensor, xSizeTensor, tapTensor, count);
+      ClampMask(xSizeTensor, count);
+
+      Filter::Compute(xMinTensor, centerTensor, tapTensor, tmpTensor, count);
+      Mul(table[offset], xMinTensor, xSizeTensor, count);
+      PipeBarrier<PIPE_V>();
+    }
+    Duplicate(table[total], 0.0f, rowNum);
+    PipeBarrier<PIPE_V>();
+  }
+
+  // 每个输出除以整个窗口的权重和，grad中切块只覆盖部分窗口时同样成立
+  __aicore__ inline void Normalize(const LocalTensor<float>& table, int32_t rowNum, int32_t interpSize) {
+    LocalTensor<float> scratch = scratchBuf_.Get<float>();
+    LocalTensor<float> ones = calcBuf_.Get<float>();
+    int32_t total = interpSize * rowNum;
+    DataCopy(scratch, table, total);
+    PipeBarrier<PIPE_V>();
+    for (int32_t rows = interpSize; rows > 1;) {
+      int32_t half = rows / 2;
+      Add(scratch, scratch, scratch[(rows - half) * rowNum], half * rowNum);
+      PipeBarrier<PIPE_V>();
+      rows -= half;
+    }
+    Maxs(scratch, scratch, TABLE_TOTAL_EPS, rowNum);
+    Duplicate(ones, 1.0f, rowNum);
+    PipeBarrier<PIPE_V>();
+    Div(scratch, ones, scratch, rowNum);
+    PipeBarrier<PIPE_V>();
+    for (int32_t filled = rowNum; filled < total; filled *= 2) {
+      int32_t count = total - filled < filled ? total - filled : filled;
+      DataCopy(scratch[filled], scratch, count);
+      PipeBarrier<PIPE_V>();
+    }
+    Mul(table, table, scratch, total);
+    PipeBarrier<PIPE_V>();
+  }
+
+  // 元素(o, p)取table[(inStart + p - xmin(o)) * rowNum + o]，窗口外或越界取table末尾的0行
+  __aicore__ inline void GatherMatrix(const LocalTensor<float>& dst, const LocalTensor<float>& table,
+                                      const AAWindowParam& window, const AAWeightLayout& layout, int32_t rowNum,
+                                      int32_t interpSize) {
+    LocalTensor<float> calc = calcBuf_.Get<float>();
+    LocalTensor<float> outTensor = calc;
+    LocalTensor<float> tapTensor = calc[TABLE_CHUNK];
+    LocalTensor<float> xSizeTensor = calc[TABLE_CHUNK * 2];
+    LocalTensor<float> tmpTensor = calc[TABLE_CHUNK * 3];
+    LocalTensor<float> validTensor = calc[TABLE_CHUNK * 4];
+    LocalTensor<int32_t> offsetTensor = xSizeTensor.ReinterpretCast<int32_t>();
+
+    int32_t total = (layout.outMajor ? layout.outNum : layout.inNum) * layout.stride;
+    for (int32_t offset = 0; offset < total; offset += TABLE_CHUNK) {
+      int32_t count = total - offset < TABLE_CHUNK ? total - offset : TABLE_CHUNK;
+      if (layout.outMajor) {
+        SplitIndex(outTensor, tapTensor, offset, layout.stride, count);
+      } else {
+        SplitIndex(tapTensor, outTensor, offset, layout.stride, count);
+      }
+
+      // valid = [p < inNum] * [o < outNum] * [0 <= j] * [j < xsize]，各项都是整数值的clamp
+      Muls(validTensor, tapTensor, -1.0f, count);
+      Adds(validTensor, validTensor, static_cast<float>(layout.inNum), count);
+      ClampMask(validTensor, count);
+      Muls(tmpTensor, outTensor, -1.0f, count);
+      Adds(tmpTensor, tmpTensor, static_cast<float>(layout.outNum), count);
+      ClampMask(tmpTensor, count);
+      Mul(validTensor, validTensor, tmpTensor, count);
+
+      Adds(xSizeTensor, outTensor, static_cast<float>(layout.outStart), count);
+      ComputeWindow(xSizeTensor, tmpTensor, xSizeTensor, window, count);
+      Adds(tapTensor, tapTensor, static_cast<float>(layout.inStart), count);
+      Sub(tapTensor, tapTensor, tmpTensor, count);
+      Adds(tmpTensor, tapTensor, 1.0f, count);
+      ClampMask(tmpTensor, count);
+      Mul(validTensor, validTensor, tmpTensor, count);
+      Sub(tmpTensor, xSizeTensor, tapTensor, count);
+      ClampMask(tmpTensor, count);
+      Mul(validTensor, validTensor, tmpTensor, count);
+
+      // 字节偏移 = ((j - interp) * rowNum + o) * valid + interp * rowNum
+      Adds(tapTensor, tapTensor, static_cast<float>(-interpSize), count);
+      Muls(tapTensor, tapTensor, static_cast<float>(rowNum), count);
+      Add(tapTensor, tapTensor, outTensor, count);
+      Mul(tapTensor, tapTensor, validTensor, count);
+      Adds(tapTensor, tapTensor, static_cast<float>(interpSize * rowNum), count);
+      Muls(tapTensor, tapTensor, static_cast<float>(sizeof(float)), count);
+      Cast(offsetTensor, tapTensor, RoundMode::CAST_RINT, count);
+      PipeBarrier<PIPE_V>();
+      Gather(dst[offset], table, offsetTensor.ReinterpretCast<uint32_t>(), 0, count);
+      PipeBarrier<PIPE_V>();
+    }
+  }
+
+  __aicore__ inline static void ClampMask(const LocalTensor<float>& mask, int32_t count) {
+    Maxs(mask, mask, 0.0f, count);
+    Mins(mask, mask, 1.0f, count);
+  }
+
+  TBuf<TPosition::VECCALC> tableBuf_;
+  TBuf<TPosition::VECCALC> scratchBuf_;
+  TBuf<TPosition::VECCALC> calcBuf_;
+};
+}  // namespace AAResize
+
+#endif  // AA_WEIGHT_TABLE_H_
@@ -0,0 +1,105 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file fused_norm_epilogue.h
+ * \brief static quant epilogue of the merge-N RmsNorm kernel used by AddRmsNormQuant.
+ *
+ * The epilogue receives the normalized fp32 tile y = norm(x) * gamma and owns every output after it.
+ * Interface expected by KernelFusedNormMergeN:
+ *   Init(pipe, tile)                         allocate UB, bind GM to the rows of this core
+ *   Prepare(scratch)                         load per-channel parameters once, scratch holds numColAlign fp32
+ *   Compute(y, tmp, reduceTmp, brcb, rowNum) consume y in place and enqueue the outputs of rowNum rows
+ *   CopyOut(rowOffset, rowNum)               write the enqueued outputs, rowOffset is relative to the core
+ * Its UB cost is exported as UbCost, the tiling sizes rowFactor from it.
+ */
+#ifndef FUSED_NORM_EPILOGUE_H_
+#define FUSED_NORM_EPILOGUE_H_
+#include "fused_norm_utils.h"
+
+namespace FusedNorm {
+/*
+ * per-channel static quant: int8(round(y / scale + zeroPoint)).
+ */
+template <typename TScale, typename TOffset>
+class StaticQuantEpilogue {
+public:
+    using UbCost = StaticQuantUbCost;
+
+    __aicore__ inline StaticQuantEpilogue() {}
+    __aicore__ inline void SetGm(GM_ADDR scales, GM_ADDR zeroPoints, GM_ADDR y, bool hasZeroPoints)
+    {
+        scalesAddr_ = scales;
+        zeroPointsAddr_ = zeroPoints;
+        yAddr_ = y;
+        hasZeroPoints_ = hasZeroPoints;
+    }
+
+    __aicore__ inline void Init(TPipe *pipe, const FusedNormTileInfo &tile)
+    {
+        tile_ = tile;
+        scalesGm_.SetGlobalBuffer((__gm__ TScale *)scalesAddr_, tile.numCol);
+        if (hasZeroPoints_) {
+            zeroPointsGm_.SetGlobalBuffer((__gm__ TOffset *)zeroPointsAddr_, tile.numCol);
+        }
+        yGm_.SetGlobalBuffer((__gm__ int8_t *)yAddr_ + tile.rowStart * tile.numCol, tile.rowWork * tile.numCol);
+        pipe->InitBuffer(scalesBuf_, tile.numColAlign * sizeof(float));
+        pipe->InitBuffer(zeroPointsBuf_, tile.numColAlign * sizeof(float));
+        pipe->InitBuffer(outQueueY_, 1, tile.rowFactor * tile.numColAlign * UbCost::kRowBytes);
+    }
+
+    __aicore__ inline void Prepare(const LocalTensor<float> &scratch)
+    {
+        LoadChannelParam<TScale>(
+            scalesBuf_.Get<float>(), scratch.ReinterpretCast<TScale>(), scalesGm_, tile_.numCol);
+        if (hasZeroPoints_) {
+            LoadChannelParam<TOffset>(
+                zeroPointsBuf_.Get<float>(), scratch.ReinterpretCast<TOffset>(), zeroPointsGm_, tile_.numCol);
+        }
+    }
+
+    __aicore__ inline void Compute(const LocalTensor<float> &yLocal, const LocalTensor<float> &tmpLocal,
+        const LocalTensor<float> &reduceLocal, const LocalTensor<float> &brcbLocal, uint32_t rowNum)
+    {
+        RowBroadcastCompute<ROW_OP_DIV>(
+            yLocal, yLocal, scalesBuf_.Get<float>(), rowNum, tile_.numCol, tile_.numColAlign);
+        if (hasZeroPoints_) {
+            RowBroadcastCompute<ROW_OP_ADD>(
+                yLocal, yLocal, zeroPointsBuf_.Get<float>(), rowNum, tile_.numCol, tile_.numColAlign);
+        }
+        LocalTensor<int8_t> outLocal = outQueueY_.template AllocTensor<int8_t>();
+        RoundFloat2Int8(outLocal, yLocal, rowNum * tile_.numColAlign);
+        outQueueY_.EnQue(outLocal);
+    }
+
+    __aicore__ inline void CopyOut(uint32_t rowOffset, uint32_t rowNum)
+    {
+        LocalTensor<int8_t> outLocal = outQueueY_.template DeQue<int8_t>();
+        CopyOutRows(yGm_[rowOffset * tile_.numCol], outLocal, rowNum, tile_.numCol, tile_.numColAlign);
+        outQueueY_.FreeTensor(outLocal);
+    }
+
+private:
+    GM_ADDR scalesAddr_ = nullptr;
+    GM_ADDR zeroPointsAddr_ = nullptr;
+    GM_ADDR yAddr_ = nullptr;
+    bool hasZeroPoints_ = false;
+    FusedNormTileInfo tile_;
+    GlobalTensor<TScale> scalesGm_;
+    GlobalTensor<TOffset> zeroPointsGm_;
+    GlobalTensor<int8_t> yGm_;
+    TBuf<TPosition::VECCALC> scalesBuf_;
+    TBuf<TPosition::VECCALC> zeroPointsBuf_;
+    TQue<QuePosition::VECOUT, 1> outQueueY_;
+};
+
+}  // namespace FusedNorm
+
+#endif  // FUSED_NORM_EPILOGUE_H_
@@ -0,0 +1,220 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file fused_norm_merge_n.h
+ * \brief merge-N RmsNorm kernel of AddRmsNormQuant: x1 + x2 -> RmsNorm -> * gamma -> StaticQuantEpilogue.
+ *
+ * Each core owns blockFactor rows and walks them rowFactor rows at a time, so small reduce dims
+ * (numColAlign <= 255 * 8) are processed with one vector instruction per 64 columns instead of per row.
+ * UB cost is MergeNUbCost<sizeof(TX)> plus the epilogue cost, see fused_norm_ub_cost.h.
+ */
+#ifndef FUSED_NORM_MERGE_N_H_
+#define FUSED_NORM_MERGE_N_H_
+#include "fused_norm_utils.h"
+#include "fused_norm_epilogue.h"
+
+namespace FusedNorm {
+template <typename TX, typename Epilogue>
+class KernelFusedNormMergeN {
+public:
+    using UbCost = MergeNUbCost<sizeof(TX)>;
+
+    __aicore__ inline KernelFusedNormMergeN(TPipe *pipe, Epilogue *epilogue) : pipe_(pipe), epilogue_(epilogue) {}
+
+    __aicore__ inline void Init(GM_ADDR x1, GM_ADDR x2, GM_ADDR gamma, GM_ADDR xOut,
+        const FusedNormParams &params)
+    {
+        ASSERT(GetBlockNum() != 0 && "Block dim can not be zero!");
+        numCol_ = params.numCol;
+        numColAlign_ = AlignCol(numCol_);
+        rowFactor_ = params.rowFactor;
+        epsilon_ = params.epsilon;
+        avgFactor_ = params.avgFactor;
+
+        uint32_t blockIdx = GetBlockIdx();
+        uint64_t rowStart = static_cast<uint64_t>(blockIdx) * params.blockFactor;
+        if (blockIdx < GetBlockNum() - 1) {
+            rowWork_ = params.blockFactor;
+        } else if (blockIdx == GetBlockNum() - 1) {
+            rowWork_ = params.numRow - rowStart;
+        } else {
+            rowWork_ = 0;
+        }
+
+        x1Gm_.SetGlobalBuffer((__gm__ TX *)x1 + rowStart * numCol_, rowWork_ * numCol_);
+        x2Gm_.SetGlobalBuffer((__gm__ TX *)x2 + rowStart * numCol_, rowWork_ * numCol_);
+        xOutGm_.SetGlobalBuffer((__gm__ TX *)xOut + rowStart * numCol_, rowWork_ * numCol_);
+        gammaGm_.SetGlobalBuffer((__gm__ TX *)gamma, numCol_);
+
+        uint32_t tileSize = rowFactor_ * numColAlign_;
+        uint32_t rowAlign = (rowFactor_ + ELEM_PER_BLK_FP32 - 1) / ELEM_PER_BLK_FP32 * ELEM_PER_BLK_FP32;
+        pipe_->InitBuffer(inQueueX1_, 1, tileSize * sizeof(TX));
+        pipe_->InitBuffer(inQueueX2_, 1, tileSize * sizeof(TX));
+        pipe_->InitBuffer(outQueueX_, 1, tileSize * sizeof(TX));
+        pipe_->InitBuffer(xFp32Buf_, tileSize * sizeof(float));
+        pipe_->InitBuffer(tmpBuf_, tileSize * sizeof(float));
+        pipe_->InitBuffer(reduceBuf_, rowFactor_ * FUSED_NORM_REDUCE_ROW_BYTES);
+        pipe_->InitBuffer(rstdBuf_, rowAlign * sizeof(float));
+        pipe_->InitBuffer(brcbBuf_, rowAlign * BRCB_ONE_BLK * sizeof(float));
+        pipe_->InitBuffer(gammaBuf_, numColAlign_ * sizeof(float));
+
+        FusedNormTileInfo tile{rowStart, rowWork_, numCol_, numColAlign_, rowFactor_};
+        epilogue_->Init(pipe_, tile);
+    }
+
+    __aicore__ inline void Process()
+    {
+        if (rowWork_ == 0) {
+            return;
+        }
+        LocalTensor<float> scratch = tmpBuf_.Get<float>();
+        LoadChannelParam<TX>(gammaBuf_.Get<float>(), scratch.ReinterpretCast<TX>(), gammaGm_, numCol_);
+        epilogue_->Prepare(scratch);
+
+        for (uint32_t rowOffset = 0; rowOffset < rowWork_; rowOffset += rowFactor_) {
+            uint32_t rowNum = (rowWork_ - rowOffset) > rowFactor_ ? rowFactor_ : (rowWork_ - rowOffset);
+            CopyIn(rowOffset, rowNum);
+            ComputeX(rowNum);
+            CopyOutX(rowOffset, rowNum);
+            ComputeNorm(rowNum);
+            epilogue_->Compute(
+                xFp32Buf_.Get<float>(), tmpBuf_.Get<float>(), reduceBuf_.Get<float>(), brcbBuf_.Get<float>(), rowNum);
+            epilogue_->CopyOut(rowOffset, rowNum);
+        }
+    }
+
+private:
+    __aicore__ inline void CopyIn(uint32_t rowOffset, uint32_t rowNum)
+    {
+        LocalTensor<TX> x1Local = inQueueX1_.template AllocTensor<TX>();
+        CopyInRows(x1Local, x1Gm_[rowOffset * numCol_], rowNum, numCol_, numColAlign_);
+        inQueueX1_.EnQue(x1Local);
+        LocalTensor<TX> x2Local = inQueueX2_.template AllocTensor<TX>();
+        CopyInRows(x2Local, x2Gm_[rowOffset * numCol_], rowNum, numCol_, numColAlign_);
+        inQueueX2_.EnQue(x2Local);
+    }
+
+    /*
+     * xFp32 <- x1 + x2. For half the add is done in half to match the row kernels of the family.
+     */
+    __aicore__ inline void ComputeX(uint32_t rowNum)
+    {
+        uint32_t count = rowNum * numColAlign_;
+        LocalTensor<float> xFp32 = xFp32Buf_.Get<float>();
+        LocalTensor<TX> x1Local = inQueueX1_.template DeQue<TX>();
+        LocalTensor<TX> x2Local = inQueueX2_.template DeQue<TX>();
+        LocalTensor<TX> xOutLocal = outQueueX_.template AllocTensor<TX>();
+        if constexpr (IsSameType<TX, half>::value) {
+            Add(xOutLocal, x1Local, x2Local, count);
+            PipeBarrier<PIPE_V>();
+            Cast(xFp32, xOutLocal, RoundMode::CAST_NONE, count);
+        } else if constexpr (IsSameType<TX, float>::value) {
+            Add(xFp32, x1Local, x2Local, count);
+            PipeBarrier<PIPE_V>();
+            Adds(xOutLocal, xFp32, ZERO, count);
+        } else {
+            LocalTensor<float> tmpLocal = tmpBuf_.Get<float>();
+            Cast(xFp32, x1Local, RoundMode::CAST_NONE, count);
+            Cast(tmpLocal, x2Local, RoundMode::CAST_NONE, count);
+            PipeBarrier<PIPE_V>();
+            Add(xFp32, xFp32, tmpLocal, count);
+            PipeBarrier<PIPE_V>();
+            Cast(xOutLocal, xFp32, RoundMode::CAST_RINT, count);
+        }
+        PipeBarrier<PIPE_V>();
+        inQueueX2_.FreeTensor(x2Local);
+        outQueueX_.EnQue(xOutLocal);
+        inQueueX1_.FreeTensor(x1Local);
+    }
+
+    __aicore__ inline void CopyOutX(uint32_t rowOffset, uint32_t rowNum)
+    {
+        LocalTensor<TX> xOutLocal = outQueueX_.template DeQue<TX>();
+        CopyOutRows(xOutGm_[rowOffset * numCol_], xOutLocal, rowNum, numCol_, numColAlign_);
+        outQueueX_.FreeTensor(xOutLocal);
+    }
+
+    __aicore__ inline void ComputeRstd(
+        const LocalTensor<float> &rstd, const LocalTensor<float> &src, uint32_t rowNum)
+    {
+        LocalTensor<float> tmpLocal = tmpBuf_.Get<float>();
+        Mul(tmpLocal, src, src, rowNum * numColAlign_);
+        PipeBarrier<PIPE_V>();
+        ReduceSumMultiN(rstd, tmpLocal, reduceBuf_.Get<float>(), rowNum, numCol_, numColAlign_);
+        PipeBarrier<PIPE_V>();
+        Muls(rstd, rstd, avgFactor_, rowNum);
+        PipeBarrier<PIPE_V>();
+        Adds(rstd, rstd, epsilon_, rowNum);
+        PipeBarrier<PIPE_V>();
+        Sqrt(rstd, rstd, rowNum);
+        Duplicate(tmpLocal, 1.0f, rowNum);
+        PipeBarrier<PIPE_V>();
+        Div(rstd, tmpLocal, rstd, rowNum);
+        PipeBarrier<PIPE_V>();
+    }
+
+    __aicore__ inline void RoundToHalf(const LocalTensor<float> &xFp32, uint32_t count)
+    {
+        LocalTensor<half> xHalf = tmpBuf_.Get<half>();
+        Cast(xHalf, xFp32, RoundMode::CAST_NONE, count);
+        PipeBarrier<PIPE_V>();
+        Cast(xFp32, xHalf, RoundMode::CAST_NONE, count);
+        PipeBarrier<PIPE_V>();
+    }
+
+    __aicore__ inline void ComputeNorm(uint32_t rowNum)
+    {
+        LocalTensor<float> xFp32 = xFp32Buf_.Get<float>();
+        LocalTensor<float> rstd = rstdBuf_.Get<float>();
+        LocalTensor<float> brcbLocal = brcbBuf_.Get<float>();
+        ComputeRstd(rstd, xFp32, rowNum);
+        RowScalarCompute<ROW_OP_MUL>(xFp32, xFp32, rstd, brcbLocal, rowNum, numCol_, numColAlign_);
+
+        // RmsNorm in half multiplies gamma in half precision, keep the same rounding points.
+        constexpr bool roundHalf = IsSameType<TX, half>::value;
+        if constexpr (roundHalf) {
+            RoundToHalf(xFp32, rowNum * numColAlign_);
+        }
+        RowBroadcastCompute<ROW_OP_MUL>(xFp32, xFp32, gammaBuf_.Get<float>(), rowNum, numCol_, numColAlign_);
+        if constexpr (roundHalf) {
+            RoundToHalf(xFp32, rowNum * numColAlign_);
+        }
+    }
+
+private:
+    TPipe *pipe_ = nullptr;
+    Epilogue *epilogue_ = nullptr;
+
+    TQue<QuePosition::VECIN, 1> inQueueX1_;
+    TQue<QuePosition::VECIN, 1> inQueueX2_;
+    TQue<QuePosition::VECOUT, 1> outQueueX_;
+    TBuf<TPosition::VECCALC> xFp32Buf_;
+    TBuf<TPosition::VECCALC> tmpBuf_;
+    TBuf<TPosition::VECCALC> reduceBuf_;
+    TBuf<TPosition::VECCALC> rstdBuf_;
+    TBuf<TPosition::VECCALC> brcbBuf_;
+    TBuf<TPosition::VECCALC> gammaBuf_;
+
+    GlobalTensor<TX> x1Gm_;
+    GlobalTensor<TX> x2Gm_;
+    GlobalTensor<TX> gammaGm_;
+    GlobalTensor<TX> xOutGm_;
+
+    uint32_t numCol_;
+    uint32_t numColAlign_;
+    uint32_t rowFactor_;
+    uint32_t rowWork_ = 0;
+    float epsilon_;
+    float avgFactor_;
+};
+}  // namespace FusedNorm
+
+#endif  // FUSED_NORM_MERGE_N_H_
@@ -0,0 +1,55 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file fused_norm_ub_cost.h
+ * \brief UB cost of the merge-N RmsNorm kernel and its quant epilogue.
+ *
+ * Shared by the kernels, which size their buffers with these values, and by the host tiling, which
+ * derives rowFactor from them: no AscendC dependency here.
+ * kRowBytes:      bytes per row per aligned column
+ * kRowFixedBytes: bytes per row independent of the column count
+ * kColBytes:      bytes per aligned column, allocated once per core
+ */
+#ifndef FUSED_NORM_UB_COST_H_
+#define FUSED_NORM_UB_COST_H_
+#include <cstdint>
+
+namespace FusedNorm {
+// 32 elements keep every row 32B aligned for int8 / b16 / fp32 tiles alike.
+constexpr uint32_t FUSED_NORM_COL_ALIGN = 32;
+constexpr uint32_t BRCB_ONE_BLK = 8;
+constexpr uint32_t FUSED_NORM_REDUCE_ROW_BYTES = 64 * sizeof(float);
+
+/*
+ * KernelFusedNormMergeN<TX, Epilogue>, X_SIZE = sizeof(TX).
+ * Per row: x1, x2, xOut tiles in TX plus the xFp32 and tmp fp32 tiles; one repeat of reduce scratch,
+ * rstd and its brcb block (the last two are allocated per 8 rows, the tiling reserve covers the round up).
+ * Per column: gamma in fp32.
+ */
+template <uint32_t X_SIZE>
+struct MergeNUbCost {
+    static constexpr uint32_t kRowBytes = X_SIZE * 3 + sizeof(float) * 2;
+    static constexpr uint32_t kRowFixedBytes =
+        FUSED_NORM_REDUCE_ROW_BYTES + sizeof(float) + BRCB_ONE_BLK * sizeof(float);
+    static constexpr uint32_t kColBytes = sizeof(float);
+};
+
+/*
+ * StaticQuantEpilogue: int8 output tile per row, scale and zero point in fp32 per column.
+ */
+struct StaticQuantUbCost {
+    static constexpr uint32_t kRowBytes = sizeof(int8_t);
+    static constexpr uint32_t kRowFixedBytes = 0;
+    static constexpr uint32_t kColBytes = sizeof(float) * 2;
+};
+}  // namespace FusedNorm
+
+#endif  // FUSED_NORM_UB_COST_H_
@@ -0,0 +1,198 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file fused_norm_utils.h
+ * \brief helpers shared by the merge-N RmsNorm kernel of AddRmsNormQuant and its quant epilogue.
+ *        All tiles are laid out as (rowNum, numColAlign) fp32 with numColAlign a multiple of FUSED_NORM_COL_ALIGN.
+ */
+#ifndef FUSED_NORM_UTILS_H_
+#define FUSED_NORM_UTILS_H_
+#include "kernel_operator.h"
+#include "reduce_common.h"
+#include "fused_norm_ub_cost.h"
+
+namespace FusedNorm {
+using namespace AscendC;
+
+constexpr uint8_t ROW_OP_ADD = 0;
+constexpr uint8_t ROW_OP_SUB = 1;
+constexpr uint8_t ROW_OP_MUL = 2;
+constexpr uint8_t ROW_OP_DIV = 3;
+
+template <typename T, typename U>
+struct IsSameType {
+    static constexpr bool value = false;
+};
+
+template <typename T>
+struct IsSameType<T, T> {
+    static constexpr bool value = true;
+};
+
+struct FusedNormParams {
+    uint32_t numRow;
+    uint32_t numCol;
+    uint32_t blockFactor;
+    uint32_t rowFactor;
+    float epsilon;
+    float avgFactor;
+};
+
+struct FusedNormTileInfo {
+    uint64_t rowStart;  // first row handled by this core
+    uint32_t rowWork;
+    uint32_t numCol;
+    uint32_t numColAlign;
+    uint32_t rowFactor;
+};
+
+__aicore__ inline uint32_t AlignCol(uint32_t numCol)
+{
+    return (numCol + FUSED_NORM_COL_ALIGN - 1) / FUSED_NORM_COL_ALIGN * FUSED_NORM_COL_ALIGN;
+}
+
+/*
+ * copy rowNum rows of numCol elements from a dense GM matrix into a (rowNum, numColAlign) UB tile.
+ */
+template <typename T>
+__aicore__ inline void CopyInRows(const LocalTensor<T> &dst, const GlobalTensor<T> &src, uint32_t rowNum,
+    uint32_t numCol, uint32_t numColAlign)
+{
+    uint32_t rowBytes = numCol * sizeof(T);
+    uint32_t padBytes = (rowBytes + ONE_BLK_SIZE - 1) / ONE_BLK_SIZE * ONE_BLK_SIZE;
+    DataCopyExtParams copyParams{static_cast<uint16_t>(rowNum), rowBytes, 0,
+        static_cast<uint32_t>((numColAlign * sizeof(T) - padBytes) / ONE_BLK_SIZE), 0};
+    DataCopyPadExtParams<T> padParams{false, 0, 0, 0};
+    DataCopyPad(dst, src, copyParams, padParams);
+}
+
+template <typename T>
+__aicore__ inline void CopyOutRows(const GlobalTensor<T> &dst, const LocalTensor<T> &src, uint32_t rowNum,
+    uint32_t numCol, uint32_t numColAlign)
+{
+    uint32_t rowBytes = numCol * sizeof(T);
+    uint32_t padBytes = (rowBytes + ONE_BLK_SIZE - 1) / ONE_BLK_SIZE * ONE_BLK_SIZE;
+    DataCopyExtParams copyParams{static_cast<uint16_t>(rowNum), rowBytes,
+        static_cast<uint32_t>((numColAlign * sizeof(T) - padBytes) / ONE_BLK_SIZE), 0, 0};
+    DataCopyPad(dst, src, copyParams);
+}
+
+/*
+ * load a per-channel vector of numCol elements (fp32 / b16 / int32) and widen it to fp32.
+ * stage must hold numColAlign elements of T and must not alias dst.
+ */
+template <typename T>
+__aicore__ inline void LoadChannelParam(
+    const LocalTensor<float> &dst, const LocalTensor<T> &stage, const GlobalTensor<T> &src, uint32_t numCol)
+{
+    DataCopyExtParams copyParams{1, static_cast<uint32_t>(numCol * sizeof(T)), 0, 0, 0};
+    DataCopyPadExtParams<T> padParams{false, 0, 0, 0};
+    if constexpr (IsSameType<T, float>::value) {
+        DataCopyPad(dst, src, copyParams, padParams);
+        event_t eventMte2V = static_cast<event_t>(GetTPipePtr()->FetchEventID(HardEvent::MTE2_V));
+        SetFlag<HardEvent::MTE2_V>(eventMte2V);
+        WaitFlag<HardEvent::MTE2_V>(eventMte2V);
+    } else {
+        DataCopyPad(stage, src, copyParams, padParams);
+        event_t eventMte2V = static_cast<event_t>(GetTPipePtr()->FetchEventID(HardEvent::MTE2_V));
+        SetFlag<HardEvent::MTE2_V>(eventMte2V);
+        WaitFlag<HardEvent::MTE2_V>(eventMte2V);
+        Cast(dst, stage, RoundMode::CAST_NONE, numCol);
+        PipeBarrier<PIPE_V>();
+        event_t eventVMte2 = static_cast<event_t>(GetTPipePtr()->FetchEventID(HardEvent::V_MTE2));
+        SetFlag<HardEvent::V_MTE2>(eventVMte2);
+        WaitFlag<HardEvent::V_MTE2>(eventVMte2);
+    }
+}
+
+/*
+ * dst[r, c] = src[r, c] OP row[c] for every row of a (rowNum, numColAlign) tile.
+ * row is broadcast with a zero repeat stride, so one instruction covers up to 255 rows of 64 columns.
+ * require numColAlign <= 255 * 8.
+ */
+template <uint8_t OP>
+__aicore__ inline void RowBroadcastCompute(const LocalTensor<float> &dst, const LocalTensor<float> &src,
+    const LocalTensor<float> &row, uint32_t rowNum, uint32_t numCol, uint32_t numColAlign)
+{
+    const uint8_t repStride = numColAlign / ELEM_PER_BLK_FP32;
+    for (uint32_t rowIdx = 0; rowIdx < rowNum; rowIdx += MAX_REP_NUM) {
+        uint8_t repeat = (rowNum - rowIdx) > MAX_REP_NUM ? MAX_REP_NUM : (rowNum - rowIdx);
+        for (uint32_t colIdx = 0; colIdx < numCol; colIdx += ELEM_PER_REP_FP32) {
+            uint64_t mask = (numCol - colIdx) > ELEM_PER_REP_FP32 ? ELEM_PER_REP_FP32 : (numCol - colIdx);
+            uint32_t offset = rowIdx * numColAlign + colIdx;
+            BinaryRepeatParams repeatParams{1, 1, 1, repStride, repStride, 0};
+            if constexpr (OP == ROW_OP_ADD) {
+                Add(dst[offset], src[offset], row[colIdx], mask, repeat, repeatParams);
+            } else if constexpr (OP == ROW_OP_SUB) {
+                Sub(dst[offset], src[offset], row[colIdx], mask, repeat, repeatParams);
+            } else if constexpr (OP == ROW_OP_MUL) {
+                Mul(dst[offset], src[offset], row[colIdx], mask, repeat, repeatParams);
+            } else {
+                Div(dst[offset], src[offset], row[colIdx], mask, repeat, repeatParams);
+            }
+        }
+    }
+    PipeBarrier<PIPE_V>();
+}
+
+/*
+ * dst[r, c] = src[r, c] OP scalar[r] for every row of a (rowNum, numColAlign) tile.
+ * brcbLocal needs rowNum * 8 floats: Brcb spreads each scalar over one block which is then
+ * read with a zero block stride.
+ */
+template <uint8_t OP>
+__aicore__ inline void RowScalarCompute(const LocalTensor<float> &dst, const LocalTensor<float> &src,
+    const LocalTensor<float> &scalar, const LocalTensor<float> &brcbLocal, uint32_t rowNum, uint32_t numCol,
+    uint32_t numColAlign)
+{
+    const uint32_t brcbRepeat = (rowNum + BRCB_ONE_BLK - 1) / BRCB_ONE_BLK;
+    Brcb(brcbLocal, scalar, brcbRepeat, {1, BRCB_ONE_BLK});
+    PipeBarrier<PIPE_V>();
+    const uint8_t repStride = numColAlign / ELEM_PER_BLK_FP32;
+    for (uint32_t rowIdx = 0; rowIdx < rowNum; rowIdx += MAX_REP_NUM) {
+        uint8_t repeat = (rowNum - rowIdx) > MAX_REP_NUM ? MAX_REP_NUM : (rowNum - rowIdx);
+        for (uint32_t colIdx = 0; colIdx < numCol; colIdx += ELEM_PER_REP_FP32) {
+            uint64_t mask = (numCol - colIdx) > ELEM_PER_REP_FP32 ? ELEM_PER_REP_FP32 : (numCol - colIdx);
+            uint32_t offset = rowIdx * numColAlign + colIdx;
+            BinaryRepeatParams repeatParams{1, 1, 0, repStride, repStride, 1};
+            auto brcbRow = brcbLocal[rowIdx * BRCB_ONE_BLK];
+            if constexpr (OP == ROW_OP_ADD) {
+                Add(dst[offset], src[offset], brcbRow, mask, repeat, repeatParams);
+            } else if constexpr (OP == ROW_OP_SUB) {
+                Sub(dst[offset], src[offset], brcbRow, mask, repeat, repeatParams);
+            } else if constexpr (OP == ROW_OP_MUL) {
+                Mul(dst[offset], src[offset], brcbRow, mask, repeat, repeatParams);
+            } else {
+                Div(dst[offset], src[offset], brcbRow, mask, repeat, repeatParams);
+            }
+        }
+    }
+    PipeBarrier<PIPE_V>();
+}
+
+/*
+ * fp32 -> int32 (round to nearest even) -> half -> int8, the quant cast chain used by the norm family.
+ */
+__aicore__ inline void RoundFloat2Int8(const LocalTensor<int8_t> &dstTensor, const LocalTensor<float> &srcTensor,
+    uint32_t size)
+{
+    Cast(srcTensor.ReinterpretCast<int32_t>(), srcTensor, RoundMode::CAST_RINT, size);
+    PipeBarrier<PIPE_V>();
+    SetDeqScale((half)1.000000e+00f);
+    PipeBarrier<PIPE_V>();
+    Cast(srcTensor.ReinterpretCast<half>(), srcTensor.ReinterpretCast<int32_t>(), RoundMode::CAST_NONE, size);
+    PipeBarrier<PIPE_V>();
+    Cast(dstTensor, srcTensor.ReinterpretCast<half>(), RoundMode::CAST_TRUNC, size);
+    PipeBarrier<PIPE_V>();
+}
+}  // namespace FusedNorm
+
+#endif  // FUSED_NORM_UTILS_H_
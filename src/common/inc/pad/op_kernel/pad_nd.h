@@ -0,0 +1,547 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file pad_nd.h
+ * \brief backward kernel of the N-D padding engine (constant/edge/reflect/circular).
+ *
+ * The problem arrives folded by pad_nd_tiling_func.h: k >= 2 dims, the last one counted in blocks of blockLen
+ * contiguous elements. Every unpadded position i sums its own padded position and the pad positions that map to it
+ * (Contrib(d, i, n)), so each core owns its output rows and no atomics or workspace are needed.
+ * Rows of the last dim are accumulated rows-per-DMA along dim k-2, the middle of each row as one burst, with
+ * double-buffered loads and stores. Pads of the last dim are either loaded one side per DMA and gathered into place
+ * by a per-launch offset table (blocks shorter than 32B) or moved block by block, merging runs whose sources are
+ * contiguous (circular).
+ */
+#ifndef PAD_ND_H_
+#define PAD_ND_H_
+
+#include "kernel_operator.h"
+
+namespace PadNd {
+using namespace AscendC;
+
+constexpr int64_t MAX_DIM_NUM = 8;
+constexpr int64_t BUFFER_NUM = 2;
+constexpr int64_t BLOCK_BYTES = 32;
+constexpr int64_t FLOAT_ALIGN = 8;
+constexpr int64_t MODE_CONSTANT = 0;
+constexpr int64_t MODE_EDGE = 1;
+constexpr int64_t MODE_REFLECT = 2;
+constexpr int64_t MODE_CIRCULAR = 3;
+
+template <HardEvent EVENT>
+__aicore__ inline void PipeSync()
+{
+    event_t eventId = static_cast<event_t>(GetTPipePtr()->FetchEventID(EVENT));
+    SetFlag<EVENT>(eventId);
+    WaitFlag<EVENT>(eventId);
+}
+
+__aicore__ inline int64_t CeilAlign(int64_t x, int64_t align)
+{
+    return (x + align - 1) / align * align;
+}
+
+__aicore__ inline int64_t MinLen(int64_t a, int64_t b)
+{
+    return a < b ? a : b;
+}
+
+template <typename T>
+__aicore__ inline T CastValue(float value)
+{
+    return static_cast<T>(value);
+}
+
+template <>
+__aicore__ inline bfloat16_t CastValue<bfloat16_t>(float value)
+{
+    return ToBfloat16(value);
+}
+
+class PadNdIndex {
+public:
+    __aicore__ inline void InitIndex(const PadNdTilingData *tilingData)
+    {
+        tiling = tilingData;
+        dimNum = tiling->dimNum;
+        lastDim = dimNum - 1;
+        blockLen = tiling->blockLen;
+        mode = tiling->mode;
+        inStride[lastDim] = blockLen;
+        outStride[lastDim] = blockLen;
+        for (int64_t d = lastDim - 1; d >= 0; d--) {
+            inStride[d] = tiling->inShape[d + 1] * inStride[d + 1];
+            outStride[d] = tiling->outShape[d + 1] * outStride[d + 1];
+        }
+        inRowLen = tiling->inShape[lastDim] * blockLen;
+        outRowLen = tiling->outShape[lastDim] * blockLen;
+        beforeLen = tiling->padBefore[lastDim] * blockLen;
+        afterLen = outRowLen - inRowLen - beforeLen;
+        rowsPerGroup = tiling->rowsPerGroup;
+        chunkLen = tiling->chunkLen;
+        chunkNum = tiling->chunkNum;
+        rowPitch = tiling->rowPitch;
+        padPitch = tiling->padPitch;
+
+        int64_t blockIdx = GetBlockIdx();
+        int64_t tailCoreNum = tiling->tailCoreNum;
+        unitStart = blockIdx * tiling->unitsPerCore + (blockIdx < tailCoreNum ? blockIdx : tailCoreNum);
+        unitEnd = unitStart + tiling->unitsPerCore + (blockIdx < tailCoreNum ? 1 : 0);
+    }
+
+    // 填充一侧第o个位置取自未填充一侧的下标，常数填充位置返回-1
+    __aicore__ inline int64_t SrcIndex(int64_t d, int64_t o) const
+    {
+        int64_t in = tiling->inShape[d];
+        int64_t p = o - tiling->padBefore[d];
+        if (p >= 0 && p < in) {
+            return p;
+        }
+        if (mode == MODE_EDGE) {
+            return p < 0 ? 0 : in - 1;
+        }
+        if (mode == MODE_REFLECT) {
+            return p < 0 ? -p : 2 * (in - 1) - p;
+        }
+        if (mode == MODE_CIRCULAR) {
+            return p < 0 ? p + in : p - in;
+        }
+        return -1;
+    }
+
+    // 未填充一侧第i个位置在填充一侧的来源个数：自身加上映射到i的前后填充位置
+    __aicore__ inline int64_t ContribNum(int64_t d, int64_t i) const
+    {
+        return 1 + BeforeNum(d, i) + AfterNum(d, i);
+    }
+
+    __aicore__ inline int64_t Contrib(int64_t d, int64_t i, int64_t n) const
+    {
+        int64_t in = tiling->inShape[d];
+        int64_t before = tiling->padBefore[d];
+        if (n == 0) {
+            return i + before;
+        }
+        int64_t beforeNum = BeforeNum(d, i);
+        if (n - 1 < beforeNum) {
+            if (mode == MODE_EDGE) {
+                return n - 1;
+            }
+            return mode == MODE_REFLECT ? before - i : i - in + before;
+        }
+        if (mode == MODE_EDGE) {
+            return before + in + (n - 1 - beforeNum);
+        }
+        return mode == MODE_REFLECT ? before + 2 * (in - 1) - i : before + in + i;
+    }
+
+protected:
+    __aicore__ inline int64_t BeforeNum(int64_t d, int64_t i) const
+    {
+        int64_t in = tiling->inShape[d];
+        int64_t before = tiling->padBefore[d];
+        if (mode == MODE_EDGE) {
+            return i == 0 ? before : 0;
+        }
+        if (mode == MODE_REFLECT) {
+            return (i >= 1 && i <= before) ? 1 : 0;
+        }
+        if (mode == MODE_CIRCULAR) {
+            return i >= in - before ? 1 : 0;
+        }
+        return 0;
+    }
+
+    __aicore__ inline int64_t AfterNum(int64_t d, int64_t i) const
+    {
+        int64_t in = tiling->inShape[d];
+        int64_t after = tiling->outShape[d] - in - tiling->padBefore[d];
+        if (mode == MODE_EDGE) {
+            return i == in - 1 ? after : 0;
+        }
+        if (mode == MODE_REFLECT) {
+            return (i <= in - 2 && i >= in - 1 - after) ? 1 : 0;
+        }
+        if (mode == MODE_CIRCULAR) {
+            return i < after ? 1 : 0;
+        }
+        return 0;
+    }
+
+    // 末维[pStart, pEnd)中从p开始、来源连续的块数
+    __aicore__ inline int64_t SrcRunLen(int64_t p, int64_t pEnd, int64_t src) const
+    {
+        int64_t n = 1;
+        while (p + n < pEnd && SrcIndex(lastDim, p + n) == src + n) {
+            n++;
+        }
+        return n;
+    }
+
+    const PadNdTilingData *tiling = nullptr;
+    int64_t dimNum = 0;
+    int64_t lastDim = 0;
+    int64_t blockLen = 0;
+    int64_t mode = 0;
+    int64_t inStride[MAX_DIM_NUM];
+    int64_t outStride[MAX_DIM_NUM];
+    int64_t inRowLen = 0;
+    int64_t outRowLen = 0;
+    int64_t beforeLen = 0;
+    int64_t afterLen = 0;
+    int64_t rowsPerGroup = 0;
+    int64_t chunkLen = 0;
+    int64_t chunkNum = 0;
+    int64_t rowPitch = 0;
+    int64_t padPitch = 0;
+    int64_t unitStart = 0;
+    int64_t unitEnd = 0;
+};
+
+template <typename T>
+class PadNdBackward : public PadNdIndex {
+public:
+    __aicore__ inline PadNdBackward(TPipe *pipe)
+    {
+        Ppipe = pipe;
+    }
+
+    __aicore__ inline void Init(GM_ADDR dy, GM_ADDR dx, const PadNdTilingData *tilingData)
+    {
+        InitIndex(tilingData);
+        dyGm.SetGlobalBuffer((__gm__ T *)dy);
+        dxGm.SetGlobalBuffer((__gm__ T *)dx);
+        int64_t rowSlots = rowsPerGroup * rowPitch;
+        // 搬入与搬出均双缓冲：下一段dy的搬入、上一组dx的搬出与当前的累加并行
+        Ppipe->InitBuffer(inQueue, BUFFER_NUM, rowSlots * sizeof(T));
+        Ppipe->InitBuffer(outQueue, BUFFER_NUM, rowSlots * (IS_FLOAT ? sizeof(float) : sizeof(T)));
+        if constexpr (!IS_FLOAT) {
+            Ppipe->InitBuffer(accBuf, rowSlots * sizeof(float));
+            Ppipe->InitBuffer(tmpFloatBuf, rowSlots * sizeof(float));
+        }
+        if (tiling->scalarPad != 0) {
+            InitPadSides();
+        }
+    }
+
+    __aicore__ inline void Process()
+    {
+        int64_t rowDim = dimNum - 2;
+        int64_t inIdx[MAX_DIM_NUM];
+        int64_t nth[MAX_DIM_NUM];
+        for (int64_t unit = unitStart; unit < unitEnd; unit++) {
+            int64_t chunk = unit % chunkNum;
+            int64_t group = unit / chunkNum % tiling->groupsPerLine;
+            int64_t line = unit / chunkNum / tiling->groupsPerLine;
+            int64_t dxLine = 0;
+            for (int64_t d = rowDim - 1; d >= 0; d--) {
+                inIdx[d] = line % tiling->inShape[d];
+                line /= tiling->inShape[d];
+                dxLine += inIdx[d] * inStride[d];
+                nth[d] = 0;
+            }
+            int64_t r0 = group * rowsPerGroup;
+            int64_t rows = MinLen(rowsPerGroup, tiling->inShape[rowDim] - r0);
+            int64_t c0 = chunk * chunkLen;
+            int64_t len = MinLen(chunkLen, inRowLen - c0);
+
+            if constexpr (IS_FLOAT) {
+                accLocal = outQueue.AllocTensor<float>();
+            } else {
+                accLocal = accBuf.Get<float>();
+            }
+            Duplicate(accLocal, 0.0f, static_cast<int32_t>(rows * rowPitch));
+            PipeBarrier<PIPE_V>();
+
+            // 前k-2维的来源逐个组合；第k-2维上组内各行的自身来源相邻，一次多行累加，其余来源逐行累加
+            while (true) {
+                int64_t dyLine = 0;
+                for (int64_t d = 0; d < rowDim; d++) {
+                    dyLine += Contrib(d, inIdx[d], nth[d]) * outStride[d];
+                }
+                AccumulateRows(dyLine + Contrib(rowDim, r0, 0) * outStride[rowDim], rows, 0, c0, len);
+                for (int64_t j = 0; j < rows; j++) {
+                    int64_t contribNum = ContribNum(rowDim, r0 + j);
+                    for (int64_t n = 1; n < contribNum; n++) {
+                        AccumulateRows(dyLine + Contrib(rowDim, r0 + j, n) * outStride[rowDim], 1, j, c0, len);
+                    }
+                }
+                int64_t d = rowDim - 1;
+                while (d >= 0) {
+                    nth[d]++;
+                    if (nth[d] < ContribNum(d, inIdx[d])) {
+                        break;
+                    }
+                    nth[d] = 0;
+                    d--;
+                }
+                if (d < 0) {
+                    break;
+                }
+            }
+            CopyOut(dxLine + r0 * inStride[rowDim] + c0, rows, len);
+        }
+    }
+
+private:
+    static constexpr bool IS_FLOAT = IsSameType<T, float>::value;
+    static constexpr int64_t ELEM_ALIGN = BLOCK_BYTES / sizeof(T);
+    static constexpr int64_t REPEAT_FLOAT_NUM = 64;
+    static constexpr int64_t MAX_REPEAT_TIMES = 255;
+    static constexpr int64_t MAX_REPEAT_STRIDE = 255;
+    static constexpr int64_t SIDE_NUM = 2;
+
+    __aicore__ inline void AccumulateRows(int64_t dyRow, int64_t rows, int64_t accRow, int64_t c0, int64_t len)
+    {
+        AddSegment(dyRow + beforeLen + c0, rows, accRow, 0, len);
+        if (mode == MODE_CONSTANT) {
+            return;
+        }
+        int64_t padEnd = tiling->padBefore[lastDim];
+        int64_t afterStart = padEnd + tiling->inShape[lastDim];
+        if (tiling->scalarPad != 0) {
+            AddPadSide(dyRow, rows, accRow, 0);
+            AddPadSide(dyRow + beforeLen + inRowLen, rows, accRow, 1);
+            return;
+        }
+        AddPadBlocks(dyRow, rows, accRow, c0, len, 0, padEnd);
+        AddPadBlocks(dyRow, rows, accRow, c0, len, afterStart, tiling->outShape[lastDim]);
+    }
+
+    __aicore__ inline void AddPadBlocks(int64_t dyRow, int64_t rows, int64_t accRow, int64_t c0, int64_t len,
+                                        int64_t pStart, int64_t pEnd)
+    {
+        for (int64_t p = pStart; p < pEnd;) {
+            int64_t src = SrcIndex(lastDim, p);
+            int64_t n = SrcRunLen(p, pEnd, src);
+            int64_t colStart = src * blockLen > c0 ? src * blockLen : c0;
+            int64_t colEnd = MinLen((src + n) * blockLen, c0 + len);
+            if (colStart < colEnd) {
+                AddSegment(dyRow + p * blockLen + (colStart - src * blockLen), rows, accRow, colStart - c0,
+                           colEnd - colStart);
+            }
+            p += n;
+        }
+    }
+
+    // dy的rows行各取segLen个元素累加到acc第accRow行起的col列；左侧补零使其与acc的32B边界对齐
+    __aicore__ inline void AddSegment(int64_t dyOffset, int64_t rows, int64_t accRow, int64_t col, int64_t segLen)
+    {
+        int64_t lead = col % FLOAT_ALIGN;
+        int64_t span = CeilAlign(lead + segLen, ELEM_ALIGN);
+        int64_t addLen = CeilAlign(lead + segLen, FLOAT_ALIGN);
+        DataCopyExtParams inParams{static_cast<uint16_t>(rows), static_cast<uint32_t>(segLen * sizeof(T)),
+                                   static_cast<uint32_t>((outRowLen - segLen) * sizeof(T)),
+                                   static_cast<uint32_t>((rowPitch - span) / ELEM_ALIGN), 0};
+        DataCopyPadExtParams<T> padParams{true, static_cast<uint8_t>(lead),
+                                          static_cast<uint8_t>(span - lead - segLen), CastValue<T>(0.0f)};
+        LocalTensor<T> inLocal = inQueue.AllocTensor<T>();
+        DataCopyPad(inLocal, dyGm[dyOffset], inParams, padParams);
+        inQueue.EnQue(inLocal);
+        inLocal = inQueue.DeQue<T>();
+
+        LocalTensor<float> srcLocal;
+        if constexpr (IS_FLOAT) {
+            srcLocal = inLocal;
+        } else {
+            srcLocal = tmpFloatBuf.Get<float>();
+            for (int64_t j = 0; j < rows; j++) {
+                Cast(srcLocal[j * rowPitch], inLocal[j * rowPitch], RoundMode::CAST_NONE,
+                     static_cast<uint32_t>(addLen));
+            }
+            PipeBarrier<PIPE_V>();
+        }
+        AddRows(accRow, col - lead, srcLocal, rowPitch, rows, addLen);
+        PipeBarrier<PIPE_V>();
+        inQueue.FreeTensor(inLocal);
+    }
+
+    // src的rows行（行距srcPitch）各取len个元素加到acc第accRow行起的col列；len不超过一个repeat时跨行一条指令完成
+    __aicore__ inline void AddRows(int64_t accRow, int64_t col, const LocalTensor<float> &srcLocal, int64_t srcPitch,
+                                   int64_t rows, int64_t len)
+    {
+        int64_t accOffset = accRow * rowPitch + col;
+        int64_t dstRepStride = rowPitch / FLOAT_ALIGN;
+        int64_t srcRepStride = srcPitch / FLOAT_ALIGN;
+        if (len <= REPEAT_FLOAT_NUM && dstRepStride <= MAX_REPEAT_STRIDE && srcRepStride <= MAX_REPEAT_STRIDE) {
+            BinaryRepeatParams repeatParams{1, 1, 1, static_cast<uint8_t>(dstRepStride),
+                                            static_cast<uint8_t>(dstRepStride), static_cast<uint8_t>(srcRepStride)};
+            for (int64_t j = 0; j < rows; j += MAX_REPEAT_TIMES) {
+                int64_t offset = accOffset + j * rowPitch;
+                Add(accLocal[offset], accLocal[offset], srcLocal[j * srcPitch], static_cast<uint64_t>(len),
+                    static_cast<uint8_t>(MinLen(MAX_REPEAT_TIMES, rows - j)), repeatParams);
+            }
+            return;
+        }
+        for (int64_t j = 0; j < rows; j++) {
+            int64_t offset = accOffset + j * rowPitch;
+            Add(accLocal[offset], accLocal[offset], srcLocal[j * srcPitch], static_cast<int32_t>(len));
+        }
+    }
+
+    // 块长不足32B时每侧填充区一次多行搬入，再按预先建好的字节偏移表Gather到与acc对齐的暂存区，整段向量累加。
+    // 偏移表每行width项：映射到acc[base, base + width)的位置指向对应的填充元素，其余指向行内的全零区。
+    // edge模式下一侧全部块映射到同一块，逐层（第t层取第t块）Gather后相加
+    __aicore__ inline void InitPadSides()
+    {
+        int64_t padSlots = rowsPerGroup * padPitch;
+        int64_t stageSlots = rowsPerGroup * tiling->stagePitch;
+        Ppipe->InitBuffer(edgeQueue, BUFFER_NUM, padSlots * sizeof(T));
+        if constexpr (!IS_FLOAT) {
+            Ppipe->InitBuffer(edgeFloatBuf, padSlots * sizeof(float));
+        }
+        Ppipe->InitBuffer(offsetBuf, SIDE_NUM * stageSlots * sizeof(uint32_t));
+        Ppipe->InitBuffer(sumBuf, stageSlots * sizeof(float));
+        if (mode == MODE_EDGE) {
+            Ppipe->InitBuffer(shiftBuf, stageSlots * sizeof(uint32_t));
+            Ppipe->InitBuffer(stageBuf, stageSlots * sizeof(float));
+        }
+
+        // 填充区的后半行为全零区，搬入只写前半行，故只需清零一次
+        LocalTensor<T> edgePing = edgeQueue.AllocTensor<T>();
+        LocalTensor<T> edgePong = edgeQueue.AllocTensor<T>();
+        int32_t halfNum = static_cast<int32_t>(padSlots * sizeof(T) / sizeof(int16_t));
+        Duplicate(edgePing.template ReinterpretCast<int16_t>(), static_cast<int16_t>(0), halfNum);
+        Duplicate(edgePong.template ReinterpretCast<int16_t>(), static_cast<int16_t>(0), halfNum);
+        edgeQueue.FreeTensor(edgePing);
+        edgeQueue.FreeTensor(edgePong);
+
+        int64_t padEnd = tiling->padBefore[lastDim];
+        BuildSideTable(0, 0, beforeLen);
+        BuildSideTable(1, padEnd + tiling->inShape[lastDim], afterLen);
+    }
+
+    __aicore__ inline void BuildSideTable(int64_t side, int64_t pStart, int64_t sideLen)
+    {
+        sideWidth[side] = 0;
+        if (sideLen == 0) {
+            return;
+        }
+        int64_t blockNum = sideLen / blockLen;
+        bool edge = mode == MODE_EDGE;
+        int64_t dstLo = SrcIndex(lastDim, pStart);
+        for (int64_t q = 1; q < blockNum; q++) {
+            int64_t dst = SrcIndex(lastDim, pStart + q);
+            dstLo = dst < dstLo ? dst : dstLo;
+        }
+        int64_t lead = dstLo * blockLen % FLOAT_ALIGN;
+        int64_t width = CeilAlign(lead + (edge ? blockLen : sideLen), FLOAT_ALIGN);
+        sideBase[side] = dstLo * blockLen - lead;
+        sideWidth[side] = width;
+        sideLayers[side] = edge ? blockNum : 1;
+
+        // 首行逐项建表，其余行在已建好的行上加行距，行数倍增
+        LocalTensor<int32_t> tableLocal = offsetBuf.Get<int32_t>()[side * rowsPerGroup * tiling->stagePitch];
+        int32_t zeroOffset = static_cast<int32_t>(padPitch / 2 * sizeof(float));
+        for (int64_t w = 0; w < width; w++) {
+            tableLocal.SetValue(w, zeroOffset);
+        }
+        int64_t qEnd = edge ? 1 : blockNum;
+        for (int64_t q = 0; q < qEnd; q++) {
+            int64_t dstCol = SrcIndex(lastDim, pStart + q) * blockLen - sideBase[side];
+            for (int64_t e = 0; e < blockLen; e++) {
+                tableLocal.SetValue(dstCol + e, static_cast<int32_t>((q * blockLen + e) * sizeof(float)));
+            }
+        }
+        PipeSync<HardEvent::S_V>();
+        for (int64_t built = 1; built < rowsPerGroup; built *= 2) {
+            int64_t copyRows = MinLen(built, rowsPerGroup - built);
+            Adds(tableLocal[built * width], tableLocal, static_cast<int32_t>(built * padPitch * sizeof(float)),
+                 static_cast<int32_t>(copyRows * width));
+            PipeBarrier<PIPE_V>();
+        }
+    }
+
+    __aicore__ inline void AddPadSide(int64_t dyOffset, int64_t rows, int64_t accRow, int64_t side)
+    {
+        int64_t width = sideWidth[side];
+        if (width == 0) {
+            return;
+        }
+        int64_t sideLen = side == 0 ? beforeLen : afterLen;
+        DataCopyExtParams inParams{static_cast<uint16_t>(rows), static_cast<uint32_t>(sideLen * sizeof(T)),
+                                   static_cast<uint32_t>((outRowLen - sideLen) * sizeof(T)),
+                                   static_cast<uint32_t>((padPitch - CeilAlign(sideLen, ELEM_ALIGN)) / ELEM_ALIGN), 0};
+        DataCopyPadExtParams<T> padParams{false, 0, 0, 0};
+        LocalTensor<T> edgeLocal = edgeQueue.AllocTensor<T>();
+        DataCopyPad(edgeLocal, dyGm[dyOffset], inParams, padParams);
+        edgeQueue.EnQue(edgeLocal);
+        edgeLocal = edgeQueue.DeQue<T>();
+
+        LocalTensor<float> edgeFloat;
+        if constexpr (IS_FLOAT) {
+            edgeFloat = edgeLocal;
+        } else {
+            edgeFloat = edgeFloatBuf.Get<float>();
+            Cast(edgeFloat, edgeLocal, RoundMode::CAST_NONE, static_cast<uint32_t>(rows * padPitch));
+            PipeBarrier<PIPE_V>();
+        }
+        LocalTensor<uint32_t> tableLocal = offsetBuf.Get<uint32_t>()[side * rowsPerGroup * tiling->stagePitch];
+        LocalTensor<float> sumLocal = sumBuf.Get<float>();
+        uint32_t count = static_cast<uint32_t>(rows * width);
+        Gather(sumLocal, edgeFloat, tableLocal, 0, count);
+        for (int64_t t = 1; t < sideLayers[side]; t++) {
+            LocalTensor<uint32_t> shiftLocal = shiftBuf.Get<uint32_t>();
+            LocalTensor<float> stageLocal = stageBuf.Get<float>();
+            Adds(shiftLocal.ReinterpretCast<int32_t>(), tableLocal.ReinterpretCast<int32_t>(),
+                 static_cast<int32_t>(t * blockLen * sizeof(float)), static_cast<int32_t>(count));
+            PipeBarrier<PIPE_V>();
+            Gather(stageLocal, edgeFloat, shiftLocal, 0, count);
+            PipeBarrier<PIPE_V>();
+            Add(sumLocal, sumLocal, stageLocal, static_cast<int32_t>(count));
+        }
+        PipeBarrier<PIPE_V>();
+        AddRows(accRow, sideBase[side], sumLocal, width, rows, width);
+        PipeBarrier<PIPE_V>();
+        edgeQueue.FreeTensor(edgeLocal);
+    }
+
+    __aicore__ inline void CopyOut(int64_t dxOffset, int64_t rows, int64_t len)
+    {
+        DataCopyExtParams outParams{static_cast<uint16_t>(rows), static_cast<uint32_t>(len * sizeof(T)),
+                                    static_cast<uint32_t>((rowPitch - CeilAlign(len, ELEM_ALIGN)) / ELEM_ALIGN),
+                                    static_cast<uint32_t>((inRowLen - len) * sizeof(T)), 0};
+        if constexpr (IS_FLOAT) {
+            outQueue.EnQue(accLocal);
+            LocalTensor<float> outLocal = outQueue.DeQue<float>();
+            DataCopyPad(dxGm[dxOffset], outLocal, outParams);
+            outQueue.FreeTensor(outLocal);
+        } else {
+            LocalTensor<T> outLocal = outQueue.AllocTensor<T>();
+            Cast(outLocal, accLocal, RoundMode::CAST_RINT, static_cast<uint32_t>(rows * rowPitch));
+            outQueue.EnQue(outLocal);
+            outLocal = outQueue.DeQue<T>();
+            DataCopyPad(dxGm[dxOffset], outLocal, outParams);
+            outQueue.FreeTensor(outLocal);
+        }
+    }
+
+    TPipe *Ppipe = nullptr;
+    TQue<QuePosition::VECIN, BUFFER_NUM> inQueue;
+    TQue<QuePosition::VECOUT, BUFFER_NUM> outQueue;
+    TQue<QuePosition::VECIN, BUFFER_NUM> edgeQueue;
+    TBuf<TPosition::VECCALC> accBuf;
+    TBuf<TPosition::VECCALC> tmpFloatBuf;
+    TBuf<TPosition::VECCALC> edgeFloatBuf;
+    TBuf<TPosition::VECCALC> offsetBuf;
+    TBuf<TPosition::VECCALC> shiftBuf;
+    TBuf<TPosition::VECCALC> stageBuf;
+    TBuf<TPosition::VECCALC> sumBuf;
+    LocalTensor<float> accLocal;
+    int64_t sideBase[SIDE_NUM] = {0, 0};
+    int64_t sideWidth[SIDE_NUM] = {0, 0};
+    int64_t sideLayers[SIDE_NUM] = {0, 0};
+    GlobalTensor<T> dyGm;
+    GlobalTensor<T> dxGm;
+};
+}  // namespace PadNd
+#endif  // PAD_ND_H_
@@ -0,0 +1,46 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file pad_nd_tiling_def.h
+ * \brief tiling data shared by the ops built on the N-D padding engine.
+ */
+#ifndef PAD_ND_TILING_DEF_H_
+#define PAD_ND_TILING_DEF_H_
+
+#include "register/tilingdata_base.h"
+
+namespace optiling {
+constexpr size_t PAD_ND_MAX_DIM_NUM = 8;
+// 规整后的k维问题：inShape为未填充的一侧（dx），outShape为填充后的一侧（dy）
+// 末尾连续的无填充维合并为blockLen，末维的下标以blockLen个元素为单位
+// 任务按(line, group, chunk)编号：line为前k-2维，group为第k-2维上rowsPerGroup行，chunk为末维中段的一段
+BEGIN_TILING_DATA_DEF(PadNdTilingData)
+TILING_DATA_FIELD_DEF(int64_t, dimNum);
+TILING_DATA_FIELD_DEF(int64_t, blockLen);
+TILING_DATA_FIELD_DEF(int64_t, mode);
+TILING_DATA_FIELD_DEF(int64_t, rowsPerGroup);
+TILING_DATA_FIELD_DEF(int64_t, groupsPerLine);
+TILING_DATA_FIELD_DEF(int64_t, chunkLen);
+TILING_DATA_FIELD_DEF(int64_t, chunkNum);
+TILING_DATA_FIELD_DEF(int64_t, rowPitch);
+TILING_DATA_FIELD_DEF(int64_t, padPitch);
+TILING_DATA_FIELD_DEF(int64_t, stagePitch);
+TILING_DATA_FIELD_DEF(int64_t, scalarPad);
+TILING_DATA_FIELD_DEF(int64_t, unitNum);
+TILING_DATA_FIELD_DEF(int64_t, usedCoreNum);
+TILING_DATA_FIELD_DEF(int64_t, unitsPerCore);
+TILING_DATA_FIELD_DEF(int64_t, tailCoreNum);
+TILING_DATA_FIELD_DEF_ARR(int64_t, PAD_ND_MAX_DIM_NUM, inShape);
+TILING_DATA_FIELD_DEF_ARR(int64_t, PAD_ND_MAX_DIM_NUM, outShape);
+TILING_DATA_FIELD_DEF_ARR(int64_t, PAD_ND_MAX_DIM_NUM, padBefore);
+END_TILING_DATA_DEF;
+} // namespace optiling
+#endif // PAD_ND_TILING_DEF_H_
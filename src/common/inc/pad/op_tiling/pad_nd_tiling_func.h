@@ -0,0 +1,271 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file pad_nd_tiling_func.h
+ * \brief tiling solver of the N-D padding engine (backward).
+ *
+ * The problem is first folded to its canonical form: trailing dims without padding become one contiguous block
+ * (blockLen), adjacent unpadded dims are merged and extent-1 unpadded dims are dropped, so that every DMA moves the
+ * longest contiguous run the layout allows. The solver then packs as many rows of the last dim per DMA as UB holds,
+ * or splits a row into chunks (never shorter than one efficient burst) when the rows cannot fill all cores.
+ */
+#ifndef PAD_ND_TILING_FUNC_H_
+#define PAD_ND_TILING_FUNC_H_
+
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "register/op_def_registry.h"
+#include "pad_nd_tiling_def.h"
+
+namespace optiling {
+enum class PadNdMode : int64_t {
+    CONSTANT = 0,
+    EDGE = 1,
+    REFLECT = 2,
+    CIRCULAR = 3
+};
+
+struct PadNdParams {
+    std::vector<int64_t> inShape;   // 未填充一侧（dx）的shape
+    std::vector<int64_t> padBefore;
+    std::vector<int64_t> padAfter;
+    PadNdMode mode = PadNdMode::CONSTANT;
+    ge::DataType dtype = ge::DT_FLOAT;
+};
+
+constexpr int64_t PAD_ND_BLOCK_BYTES = 32;
+constexpr int64_t PAD_ND_RESERVED_UB = 8 * 1024;
+constexpr int64_t PAD_ND_BUFFER_NUM = 2;
+constexpr int64_t PAD_ND_MAX_BLOCK_COUNT = 4095;
+constexpr int64_t PAD_ND_MIN_BURST_BYTES = 2048;
+constexpr int64_t PAD_ND_SCALAR_PAD_LIMIT = 1024;
+constexpr int64_t PAD_ND_FLOAT_BYTES = 4;
+constexpr int64_t PAD_ND_FLOAT_ALIGN = 8;
+constexpr int64_t PAD_ND_TABLE_BYTES = 4;
+constexpr int64_t PAD_ND_SIDE_NUM = 2;
+
+inline bool GetPadNdMode(const std::string &name, PadNdMode &mode)
+{
+    if (name == "constant") {
+        mode = PadNdMode::CONSTANT;
+    } else if (name == "edge") {
+        mode = PadNdMode::EDGE;
+    } else if (name == "reflect") {
+        mode = PadNdMode::REFLECT;
+    } else if (name == "circular") {
+        mode = PadNdMode::CIRCULAR;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+// tiling key只区分数据类型，各op的kernel按同一组key分发；反向在fp32中累加，只支持浮点类型
+inline bool GetPadNdTilingKey(ge::DataType dtype, uint64_t &tilingKey, int64_t &typeSize)
+{
+    switch (dtype) {
+        case ge::DT_FLOAT:
+            tilingKey = 1;
+            typeSize = 4;
+            return true;
+        case ge::DT_FLOAT16:
+            tilingKey = 2;
+            typeSize = 2;
+            return true;
+        case ge::DT_BF16:
+            tilingKey = 3;
+            typeSize = 2;
+            return true;
+        default:
+            return false;
+    }
+}
+
+struct PadNdDim {
+    int64_t in;
+    int64_t before;
+    int64_t after;
+};
+
+inline int64_t PadNdCeilDiv(int64_t a, int64_t b)
+{
+    return b == 0 ? a : (a + b - 1) / b;
+}
+
+inline int64_t PadNdCeilAlign(int64_t a, int64_t b)
+{
+    return PadNdCeilDiv(a, b) * b;
+}
+
+inline bool CheckPadNdParams(const PadNdParams &params)
+{
+    size_t rank = params.inShape.size();
+    if (rank == 0 || rank > PAD_ND_MAX_DIM_NUM || params.padBefore.size() != rank || params.padAfter.size() != rank) {
+        return false;
+    }
+    for (size_t d = 0; d < rank; d++) {
+        int64_t in = params.inShape[d];
+        int64_t before = params.padBefore[d];
+        int64_t after = params.padAfter[d];
+        if (in < 0 || before < 0 || after < 0) {
+            return false;
+        }
+        if (in == 0) {
+            // dx为空时无需写出
+            continue;
+        }
+        if (params.mode == PadNdMode::REFLECT && (before >= in || after >= in)) {
+            return false;
+        }
+        if (params.mode == PadNdMode::CIRCULAR && (before > in || after > in)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// 规整：末尾无填充维并入blockLen，相邻无填充维合并，长度为1的无填充维去掉，不足2维时在前面补1
+inline void FoldPadNdDims(const PadNdParams &params, std::vector<PadNdDim> &dims, int64_t &blockLen)
+{
+    size_t end = params.inShape.size();
+    blockLen = 1;
+    while (end > 0 && params.padBefore[end - 1] == 0 && params.padAfter[end - 1] == 0) {
+        blockLen *= params.inShape[end - 1];
+        end--;
+    }
+    dims.clear();
+    for (size_t d = 0; d < end; d++) {
+        PadNdDim dim{params.inShape[d], params.padBefore[d], params.padAfter[d]};
+        bool unpadded = dim.before == 0 && dim.after == 0;
+        if (unpadded && dim.in == 1) {
+            continue;
+        }
+        if (unpadded && !dims.empty() && dims.back().before == 0 && dims.back().after == 0) {
+            dims.back().in *= dim.in;
+            continue;
+        }
+        dims.push_back(dim);
+    }
+    while (dims.size() < 2) {
+        dims.insert(dims.begin(), PadNdDim{1, 0, 0});
+    }
+}
+
+inline ge::graphStatus PadNdTiling(gert::TilingContext *context, const PadNdParams &params, int64_t coreNum,
+                                   int64_t ubSize, size_t sysWorkspaceSize)
+{
+    uint64_t tilingKey = 0;
+    int64_t typeSize = 0;
+    if (coreNum <= 0 || !CheckPadNdParams(params) || !GetPadNdTilingKey(params.dtype, tilingKey, typeSize)) {
+        return ge::GRAPH_FAILED;
+    }
+    std::vector<PadNdDim> dims;
+    int64_t blockLen = 1;
+    FoldPadNdDims(params, dims, blockLen);
+
+    size_t k = dims.size();
+    int64_t align = PAD_ND_BLOCK_BYTES / typeSize;
+    const PadNdDim &last = dims[k - 1];
+    const PadNdDim &second = dims[k - 2];
+    int64_t inRowLen = last.in * blockLen;
+    int64_t maxPadLen = std::max(last.before, last.after) * blockLen;
+    int64_t lineRows = second.in;
+    int64_t lineNum = 1;
+    for (size_t d = 0; d + 2 < k; d++) {
+        lineNum *= dims[d].in;
+    }
+    int64_t totalRows = lineNum * lineRows;
+
+    // 每行在UB中占用的字节：双缓冲的输入区与输出区，非fp32时另有fp32累加区和输入的fp32副本
+    bool castToFloat = typeSize != PAD_ND_FLOAT_BYTES;
+    int64_t outBytes = castToFloat ? typeSize : PAD_ND_FLOAT_BYTES;
+    int64_t dataCoef = PAD_ND_BUFFER_NUM * (typeSize + outBytes) + (castToFloat ? 2 * PAD_ND_FLOAT_BYTES : 0);
+    // 填充区：双缓冲的搬入区及其fp32副本；暂存区：两侧的Gather偏移表、edge模式的逐层偏移表、Gather结果与累加结果
+    int64_t padCoef = PAD_ND_BUFFER_NUM * typeSize + (castToFloat ? PAD_ND_FLOAT_BYTES : 0);
+    int64_t stageCoef = (PAD_ND_SIDE_NUM + 1) * PAD_ND_TABLE_BYTES + 2 * PAD_ND_FLOAT_BYTES;
+    int64_t budget = ubSize - PAD_ND_RESERVED_UB;
+
+    // 块长不足32B时一侧填充区一次多行搬入，在UB内Gather到与累加区对齐的位置后整段相加；否则逐块搬运，每次至少一个32B块
+    bool scalarPad = params.mode != PadNdMode::CONSTANT && maxPadLen > 0 && blockLen < align &&
+                     maxPadLen <= PAD_ND_SCALAR_PAD_LIMIT;
+    // 填充区每行后半为全零区，供偏移表中不接收贡献的位置取0
+    int64_t padPitch = scalarPad ? 2 * PadNdCeilAlign(maxPadLen, align) : 0;
+    int64_t stagePitch = scalarPad ? PadNdCeilAlign(maxPadLen + PAD_ND_FLOAT_ALIGN - 1, PAD_ND_FLOAT_ALIGN) : 0;
+    int64_t rowPitch = PadNdCeilAlign(inRowLen, align) + align;
+    int64_t rowsFit = budget / (dataCoef * rowPitch + padCoef * padPitch + stageCoef * stagePitch);
+
+    // 行数铺不满所有核时把中段切开，但每段不短于一次高效的burst
+    int64_t minChunk = PadNdCeilAlign(PAD_ND_MIN_BURST_BYTES / typeSize, align);
+    int64_t wantChunks = (totalRows > 0 && totalRows < coreNum) ? PadNdCeilDiv(coreNum, totalRows) : 1;
+    int64_t chunkLen = inRowLen;
+    int64_t chunkNum = 1;
+    int64_t rowsPerGroup = 1;
+    if (rowsFit < 1 || (wantChunks > 1 && inRowLen >= 2 * minChunk)) {
+        chunkLen = (budget / dataCoef) / align * align - align;
+        if (wantChunks > 1) {
+            chunkLen = std::min(chunkLen, std::max(minChunk, PadNdCeilAlign(PadNdCeilDiv(inRowLen, wantChunks), align)));
+        }
+        if (chunkLen <= 0) {
+            return ge::GRAPH_FAILED;
+        }
+        chunkNum = std::max<int64_t>(1, PadNdCeilDiv(inRowLen, chunkLen));
+        scalarPad = false;
+        padPitch = 0;
+        stagePitch = 0;
+        rowPitch = PadNdCeilAlign(chunkLen, align) + align;
+    } else {
+        int64_t balanceRows = std::max<int64_t>(1, totalRows / coreNum);
+        rowsPerGroup = std::min({rowsFit, std::max<int64_t>(1, lineRows), PAD_ND_MAX_BLOCK_COUNT, balanceRows});
+    }
+
+    int64_t groupsPerLine = PadNdCeilDiv(lineRows, rowsPerGroup);
+    int64_t unitNum = lineNum * groupsPerLine * chunkNum;
+    int64_t usedCoreNum = std::max<int64_t>(1, std::min(coreNum, unitNum));
+
+    PadNdTilingData tiling;
+    tiling.set_dimNum(static_cast<int64_t>(k));
+    tiling.set_blockLen(blockLen);
+    tiling.set_mode(static_cast<int64_t>(params.mode));
+    tiling.set_rowsPerGroup(rowsPerGroup);
+    tiling.set_groupsPerLine(groupsPerLine);
+    tiling.set_chunkLen(chunkLen);
+    tiling.set_chunkNum(chunkNum);
+    tiling.set_rowPitch(rowPitch);
+    tiling.set_padPitch(padPitch);
+    tiling.set_stagePitch(stagePitch);
+    tiling.set_scalarPad(scalarPad ? 1 : 0);
+    tiling.set_unitNum(unitNum);
+    tiling.set_usedCoreNum(usedCoreNum);
+    tiling.set_unitsPerCore(unitNum / usedCoreNum);
+    tiling.set_tailCoreNum(unitNum % usedCoreNum);
+    int64_t inShape[PAD_ND_MAX_DIM_NUM] = {0};
+    int64_t outShape[PAD_ND_MAX_DIM_NUM] = {0};
+    int64_t padBefore[PAD_ND_MAX_DIM_NUM] = {0};
+    for (size_t d = 0; d < k; d++) {
+        inShape[d] = dims[d].in;
+        outShape[d] = dims[d].in + dims[d].before + dims[d].after;
+        padBefore[d] = dims[d].before;
+    }
+    tiling.set_inShape(inShape);
+    tiling.set_outShape(outShape);
+    tiling.set_padBefore(padBefore);
+
+    context->SetTilingKey(tilingKey);
+    context->SetBlockDim(static_cast<uint32_t>(usedCoreNum));
+    tiling.SaveToBuffer(context->GetRawTilingData()->GetData(), context->GetRawTilingData()->GetCapacity());
+    context->GetRawTilingData()->SetDataSize(tiling.GetDataSize());
+    size_t *currentWorkspace = context->GetWorkspaceSizes(1);
+    currentWorkspace[0] = sysWorkspaceSize;
+    return ge::GRAPH_SUCCESS;
+}
+} // namespace optiling
+#endif // PAD_ND_TILING_FUNC_H_
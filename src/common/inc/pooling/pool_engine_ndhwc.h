@@ -0,0 +1,262 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file pool_engine_ndhwc.h
+ * \brief channel last pooling engine, one output point per step and C split into tileC.
+ *
+ * The window of an output point is walked as runs of input points that are contiguous in DHW:
+ *   full H and W   one run of (dend - dstart) * H * W points, e.g. global average
+ *   full W         one run of (hend - hstart) * W points per d
+ *   otherwise      one run of (wend - wstart) points per (d, h)
+ * Each run is loaded runPointNum points at a time by a single strided DataCopyPad into rows of tileC, the next
+ * chunk is prefetched while the current one is tree reduced over its rows. Requires DataCopyPad (__CCE_AICORE__ >= 220).
+ * UB: QUEUE_DEPTH * runPointNum * tileC * sizeof(T) + runPointNum * tileC * 4 (T != float)
+ *     + QUEUE_DEPTH * tileC * sizeof(T) + tileC * 4
+ */
+#ifndef POOL_ENGINE_NDHWC_H_
+#define POOL_ENGINE_NDHWC_H_
+
+#include "kernel_operator.h"
+#include "pool_window.h"
+#include "pool_reducer.h"
+
+namespace PoolEngine {
+using namespace AscendC;
+
+struct PoolEngineParam {
+  int64_t inD;
+  int64_t inH;
+  int64_t inW;
+  int64_t outD;
+  int64_t outH;
+  int64_t outW;
+  int64_t channels;
+  int64_t tileC;
+  int64_t runPointNum;
+  int64_t outputPointNum;
+  int64_t outputPointOffset;
+
+  __aicore__ inline PoolEngineParam() {}
+};
+
+template <typename T, typename Window, typename Reducer, int32_t QUEUE_DEPTH>
+class KernelPoolNdhwcSplitC {
+public:
+  __aicore__ inline KernelPoolNdhwcSplitC() {}
+  __aicore__ inline void Init(GM_ADDR x, GM_ADDR y, const PoolEngineParam& param, const Window& window, TPipe* pipe);
+  __aicore__ inline void Process();
+
+private:
+  __aicore__ inline void ReducePoint(int64_t outputPointIdx);
+  __aicore__ inline void SetRuns(const PoolIndex& index);
+  __aicore__ inline int64_t ChunkOffset(int64_t chunkIdx, int64_t& pointNum) const;
+  __aicore__ inline void CopyIn(int64_t offset, int64_t pointNum, int64_t len);
+  __aicore__ inline void ReduceChunk(const LocalTensor<float>& accLocal, int64_t pointNum, int64_t len);
+  __aicore__ inline void CopyOut(int64_t offset, int64_t len);
+
+  TQue<QuePosition::VECIN, QUEUE_DEPTH> inputQueue;
+  TQue<QuePosition::VECOUT, QUEUE_DEPTH> outputQueue;
+  TBuf<TPosition::VECCALC> castBuf;
+  TBuf<TPosition::VECCALC> accBuf;
+
+  GlobalTensor<T> inputGlobal;
+  GlobalTensor<T> outputGlobal;
+
+  PoolEngineParam param;
+  Window window;
+
+  int64_t inputPointStride;
+  int64_t numPerBlock;
+  int64_t lenAlign;
+
+  // 当前窗口的连续段：runNum段，每段runLen个点，按runPointNum切块
+  int64_t runNum;
+  int64_t runLen;
+  int64_t runStart;
+  int64_t runStride;
+  int64_t runInnerNum;
+  int64_t runInnerStride;
+  int64_t chunkPerRun;
+};
+
+template <typename T, typename Window, typename Reducer, int32_t QUEUE_DEPTH>
+__aicore__ inline void KernelPoolNdhwcSplitC<T, Window, Reducer, QUEUE_DEPTH>::Init(
+    GM_ADDR x, GM_ADDR y, const PoolEngineParam& engineParam, const Window& poolWindow, TPipe* pipe) {
+  param = engineParam;
+  window = poolWindow;
+  inputPointStride = param.inD * param.inH * param.inW;
+  numPerBlock = GetDataBlockSizeInBytes() / sizeof(T);
+
+  inputGlobal.SetGlobalBuffer((__gm__ T*)x);
+  outputGlobal.SetGlobalBuffer((__gm__ T*)y);
+
+  pipe->InitBuffer(inputQueue, QUEUE_DEPTH, param.runPointNum * param.tileC * sizeof(T));
+  pipe->InitBuffer(outputQueue, QUEUE_DEPTH, param.tileC * sizeof(T));
+  if constexpr (!std::is_same_v<T, float>) {
+    pipe->InitBuffer(castBuf, param.runPointNum * param.tileC * sizeof(float));
+  }
+  pipe->InitBuffer(accBuf, param.tileC * sizeof(float));
+}
+
+template <typename T, typename Window, typename Reducer, int32_t QUEUE_DEPTH>
+__aicore__ inline void KernelPoolNdhwcSplitC<T, Window, Reducer, QUEUE_DEPTH>::SetRuns(const PoolIndex& index) {
+  int64_t hNum = index.hend - index.hstart;
+  int64_t wNum = index.wend - index.wstart;
+  int64_t planeSize = param.inH * param.inW;
+  runStart = (index.dstart * param.inH + index.hstart) * param.inW + index.wstart;
+  runInnerNum = 1;
+  runInnerStride = 0;
+  if (wNum == param.inW && hNum == param.inH) {
+    runNum = 1;
+    runLen = (index.dend - index.dstart) * planeSize;
+    runStride = 0;
+  } else if (wNum == param.inW) {
+    runNum = index.dend - index.dstart;
+    runLen = hNum * param.inW;
+    runStride = planeSize;
+  } else {
+    runNum = (index.dend - index.dstart) * hNum;
+    runLen = wNum;
+    runStride = planeSize;
+    runInnerNum = hNum;
+    runInnerStride = param.inW;
+  }
+  chunkPerRun = (runLen + param.runPointNum - 1) / param.runPointNum;
+}
+
+template <typename T, typename Window, typename Reducer, int32_t QUEUE_DEPTH>
+__aicore__ inline int64_t KernelPoolNdhwcSplitC<T, Window, Reducer, QUEUE_DEPTH>::ChunkOffset(
+    int64_t chunkIdx, int64_t& pointNum) const {
+  int64_t run = chunkIdx / chunkPerRun;
+  int64_t inner = (chunkIdx - run * chunkPerRun) * param.runPointNum;
+  pointNum = runLen - inner < param.runPointNum ? runLen - inner : param.runPointNum;
+  return runStart + run / runInnerNum * runStride + run % runInnerNum * runInnerStride + inner;
+}
+
+template <typename T, typename Window, typename Reducer, int32_t QUEUE_DEPTH>
+__aicore__ inline void KernelPoolNdhwcSplitC<T, Window, Reducer, QUEUE_DEPTH>::CopyIn(
+    int64_t offset, int64_t pointNum, int64_t len) {
+  LocalTensor<T> inputLocal = inputQueue.template AllocTensor<T>();
+  // 每个点取len个通道，UB内按32B对齐成行
+  DataCopyExtParams copyParams{static_cast<uint16_t>(pointNum), static_cast<uint32_t>(len * sizeof(T)),
+                               static_cast<uint32_t>((param.channels - len) * sizeof(T)), 0, 0};
+  DataCopyPadExtParams<T> padParams{false, 0, 0, 0};
+  DataCopyPad(inputLocal, inputGlobal[offset], copyParams, padParams);
+  inputQueue.EnQue(inputLocal);
+}
+
+template <typename T, typename Window, typename Reducer, int32_t QUEUE_DEPTH>
+__aicore__ inline void KernelPoolNdhwcSplitC<T, Window, Reducer, QUEUE_DEPTH>::ReduceChunk(
+    const LocalTensor<float>& accLocal, int64_t pointNum, int64_t len) {
+  LocalTensor<T> inputLocal = inputQueue.template DeQue<T>();
+  LocalTensor<float> rowsLocal;
+  if constexpr (std::is_same_v<T, float>) {
+    rowsLocal = inputLocal;
+  } else {
+    rowsLocal = castBuf.Get<float>();
+    Cast(rowsLocal, inputLocal, RoundMode::CAST_NONE, pointNum * lenAlign);
+    inputQueue.FreeTensor(inputLocal);
+  }
+
+  // 行间二分归约，每次把后半行合并到前半行
+  int64_t rowNum = pointNum;
+  while (rowNum > 1) {
+    int64_t half = rowNum / 2;
+    PipeBarrier<PIPE_V>();
+    Reducer::Combine(rowsLocal, rowsLocal, rowsLocal[(rowNum - half) * lenAlign], half * lenAlign);
+    rowNum -= half;
+  }
+  PipeBarrier<PIPE_V>();
+  Reducer::Combine(accLocal, accLocal, rowsLocal, len);
+
+  if constexpr (std::is_same_v<T, float>) {
+    inputQueue.FreeTensor(inputLocal);
+  }
+}
+
+template <typename T, typename Window, typename Reducer, int32_t QUEUE_DEPTH>
+__aicore__ inline void KernelPoolNdhwcSplitC<T, Window, Reducer, QUEUE_DEPTH>::CopyOut(int64_t offset, int64_t len) {
+  LocalTensor<T> outputLocal = outputQueue.template DeQue<T>();
+  DataCopyExtParams copyParams{1, static_cast<uint32_t>(len * sizeof(T)), 0, 0, 0};
+  DataCopyPad(outputGlobal[offset], outputLocal, copyParams);
+  outputQueue.FreeTensor(outputLocal);
+}
+
+template <typename T, typename Window, typename Reducer, int32_t QUEUE_DEPTH>
+__aicore__ inline void KernelPoolNdhwcSplitC<T, Window, Reducer, QUEUE_DEPTH>::ReducePoint(int64_t outputPointIdx) {
+  int64_t ow = outputPointIdx % param.outW;
+  int64_t oh = outputPointIdx / param.outW % param.outH;
+  int64_t od = outputPointIdx / (param.outW * param.outH) % param.outD;
+  int64_t n = outputPointIdx / (param.outW * param.outH * param.outD);
+
+  PoolIndex index;
+  window.Compute(od, oh, ow, index);
+  SetRuns(index);
+  int64_t chunkNum = runNum * chunkPerRun;
+  int64_t nOffset = n * inputPointStride;
+
+  LocalTensor<float> accLocal = accBuf.Get<float>();
+  for (int64_t cOffset = 0; cOffset < param.channels; cOffset += param.tileC) {
+    int64_t len = param.channels - cOffset < param.tileC ? param.channels - cOffset : param.tileC;
+    lenAlign = (len + numPerBlock - 1) / numPerBlock * numPerBlock;
+    Reducer::Init(accLocal, len);
+
+    int64_t pointNum = 0;
+    int64_t nextPointNum = 0;
+    int64_t nextOffset = 0;
+    if (chunkNum > 0) {
+      nextOffset = ChunkOffset(0, nextPointNum);
+      if constexpr (QUEUE_DEPTH > 1) {
+        CopyIn((nOffset + nextOffset) * param.channels + cOffset, nextPointNum, len);
+      }
+    }
+    for (int64_t chunkIdx = 0; chunkIdx < chunkNum; ++chunkIdx) {
+      int64_t offset = nextOffset;
+      pointNum = nextPointNum;
+      if (chunkIdx + 1 < chunkNum) {
+        nextOffset = ChunkOffset(chunkIdx + 1, nextPointNum);
+      }
+      if constexpr (QUEUE_DEPTH > 1) {
+        // 下一块的搬运与当前块的归约并行
+        if (chunkIdx + 1 < chunkNum) {
+          CopyIn((nOffset + nextOffset) * param.channels + cOffset, nextPointNum, len);
+        }
+      } else {
+        CopyIn((nOffset + offset) * param.channels + cOffset, pointNum, len);
+      }
+      ReduceChunk(accLocal, pointNum, len);
+    }
+
+    PipeBarrier<PIPE_V>();
+    Reducer::Finalize(accLocal, index, len);
+    LocalTensor<T> outputLocal = outputQueue.template AllocTensor<T>();
+    if constexpr (std::is_same_v<T, float>) {
+      DataCopy(outputLocal, accLocal, lenAlign);
+    } else if constexpr (std::is_same_v<T, half>) {
+      Cast(outputLocal, accLocal, RoundMode::CAST_NONE, len);
+    } else {
+      Cast(outputLocal, accLocal, RoundMode::CAST_RINT, len);
+    }
+    outputQueue.EnQue(outputLocal);
+    CopyOut(outputPointIdx * param.channels + cOffset, len);
+  }
+}
+
+template <typename T, typename Window, typename Reducer, int32_t QUEUE_DEPTH>
+__aicore__ inline void KernelPoolNdhwcSplitC<T, Window, Reducer, QUEUE_DEPTH>::Process() {
+  for (int64_t outputPointIdx = param.outputPointOffset;
+       outputPointIdx < param.outputPointOffset + param.outputPointNum; ++outputPointIdx) {
+    ReducePoint(outputPointIdx);
+  }
+}
+} // namespace PoolEngine
+
+#endif // POOL_ENGINE_NDHWC_H_
@@ -0,0 +1,60 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file pool_reducer.h
+ * \brief reducer policies of the pooling engine, all of them work on fp32.
+ *
+ * Interface expected by the engine:
+ *   Init(acc, count)                  set acc to the identity of the reduction
+ *   Combine(dst, src0, src1, count)   dst = reduce(src0, src1), dst may alias src0
+ *   Finalize(acc, index, count)       turn the reduction of a window into the output value
+ */
+#ifndef POOL_REDUCER_H_
+#define POOL_REDUCER_H_
+
+#include "kernel_operator.h"
+#include "pool_window.h"
+
+namespace PoolEngine {
+using namespace AscendC;
+
+struct AvgReducer {
+  __aicore__ inline static void Init(const LocalTensor<float>& acc, int32_t count) {
+    Duplicate(acc, 0.0f, count);
+  }
+
+  __aicore__ inline static void Combine(const LocalTensor<float>& dst, const LocalTensor<float>& src0,
+                                        const LocalTensor<float>& src1, int32_t count) {
+    Add(dst, src0, src1, count);
+  }
+
+  __aicore__ inline static void Finalize(const LocalTensor<float>& acc, const PoolIndex& index, int32_t count) {
+    Muls(acc, acc, index.factor, count);
+  }
+};
+
+struct MaxReducer {
+  constexpr static uint32_t NEG_INF_FP32 = 0xFF800000;
+
+  __aicore__ inline static void Init(const LocalTensor<float>& acc, int32_t count) {
+    Duplicate(acc.template ReinterpretCast<uint32_t>(), NEG_INF_FP32, count);
+  }
+
+  __aicore__ inline static void Combine(const LocalTensor<float>& dst, const LocalTensor<float>& src0,
+                                        const LocalTensor<float>& src1, int32_t count) {
+    Max(dst, src0, src1, count);
+  }
+
+  __aicore__ inline static void Finalize(const LocalTensor<float>& acc, const PoolIndex& index, int32_t count) {}
+};
+} // namespace PoolEngine
+
+#endif // POOL_REDUCER_H_
@@ -0,0 +1,140 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file pool_window.h
+ * \brief window generators of the pooling engine.
+ *
+ * A window maps an output point (od, oh, ow) to the clamped input range [start, end) of each dim and to the
+ * factor the reducer applies at the end (1 / divisor for average, unused for max).
+ * Interface expected by the engine:
+ *   Compute(od, oh, ow, index)
+ */
+#ifndef POOL_WINDOW_H_
+#define POOL_WINDOW_H_
+
+#include "kernel_operator.h"
+
+namespace PoolEngine {
+struct PoolIndex {
+  int64_t dstart;
+  int64_t dend;
+  int64_t hstart;
+  int64_t hend;
+  int64_t wstart;
+  int64_t wend;
+  float factor;
+
+  __aicore__ inline PoolIndex() {}
+};
+
+// 自适应池化：第i个输出覆盖[floor(i * in / out), ceil((i + 1) * in / out))
+class AdaptiveWindow {
+public:
+  __aicore__ inline AdaptiveWindow() {}
+
+  __aicore__ inline void Init(int64_t inD, int64_t inH, int64_t inW, int64_t outD, int64_t outH, int64_t outW) {
+    inD_ = inD;
+    inH_ = inH;
+    inW_ = inW;
+    outD_ = outD;
+    outH_ = outH;
+    outW_ = outW;
+  }
+
+  __aicore__ inline void Compute(int64_t od, int64_t oh, int64_t ow, PoolIndex& index) const {
+    index.dstart = Start(od, outD_, inD_);
+    index.dend = End(od, outD_, inD_);
+    index.hstart = Start(oh, outH_, inH_);
+    index.hend = End(oh, outH_, inH_);
+    index.wstart = Start(ow, outW_, inW_);
+    index.wend = End(ow, outW_, inW_);
+    index.factor = 1.0f / (static_cast<float>(index.dend - index.dstart) * (index.hend - index.hstart) *
+                           (index.wend - index.wstart));
+  }
+
+private:
+  __aicore__ inline static int64_t Start(int64_t idx, int64_t osize, int64_t isize) {
+    return (idx / osize) * isize + ((idx % osize) * isize) / osize;
+  }
+
+  __aicore__ inline static int64_t End(int64_t idx, int64_t osize, int64_t isize) {
+    return 1 + ((idx + 1) * isize - 1) / osize;
+  }
+
+  int64_t inD_;
+  int64_t inH_;
+  int64_t inW_;
+  int64_t outD_;
+  int64_t outH_;
+  int64_t outW_;
+};
+
+// 滑窗池化：kernel/stride/pad描述的窗口，除数语义与AvgPool3D一致
+class SlidingWindow {
+public:
+  __aicore__ inline SlidingWindow() {}
+
+  __aicore__ inline void Init(int64_t inD, int64_t inH, int64_t inW, int64_t kD, int64_t kH, int64_t kW,
+                              int64_t sD, int64_t sH, int64_t sW, int64_t pD, int64_t pH, int64_t pW,
+                              int64_t countIncludePad, int64_t divisorOverride) {
+    inD_ = inD;
+    inH_ = inH;
+    inW_ = inW;
+    kD_ = kD;
+    kH_ = kH;
+    kW_ = kW;
+    sD_ = sD;
+    sH_ = sH;
+    sW_ = sW;
+    pD_ = pD;
+    pH_ = pH;
+    pW_ = pW;
+    countIncludePad_ = countIncludePad;
+    divisorOverride_ = divisorOverride;
+  }
+
+  __aicore__ inline void Compute(int64_t od, int64_t oh, int64_t ow, PoolIndex& index) const {
+    int64_t poolSize = Range(od, inD_, kD_, sD_, pD_, index.dstart, index.dend);
+    poolSize *= Range(oh, inH_, kH_, sH_, pH_, index.hstart, index.hend);
+    poolSize *= Range(ow, inW_, kW_, sW_, pW_, index.wstart, index.wend);
+    poolSize = divisorOverride_ ? divisorOverride_ : poolSize;
+    index.factor = 1.0f / static_cast<float>(poolSize);
+  }
+
+private:
+  __aicore__ inline int64_t Range(int64_t idx, int64_t inSize, int64_t kernel, int64_t stride, int64_t pad,
+                                  int64_t& start, int64_t& end) const {
+    start = idx * stride - pad;
+    end = start + kernel < inSize + pad ? start + kernel : inSize + pad;
+    int64_t includePadSize = end - start;
+    start = start > 0 ? start : 0;
+    end = end < inSize ? end : inSize;
+    return countIncludePad_ ? includePadSize : end - start;
+  }
+
+  int64_t inD_;
+  int64_t inH_;
+  int64_t inW_;
+  int64_t kD_;
+  int64_t kH_;
+  int64_t kW_;
+  int64_t sD_;
+  int64_t sH_;
+  int64_t sW_;
+  int64_t pD_;
+  int64_t pH_;
+  int64_t pW_;
+  int64_t countIncludePad_;
+  int64_t divisorOverride_;
+};
+} // namespace PoolEngine
+
+#endif // POOL_WINDOW_H_
@@ -0,0 +1,222 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * \file main.cpp
+ * \brief
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "acl/acl.h"
+#include "aclnn_coalesce_sparse_v2.h"
+
+#define SUCCESS 0
+#define FAILED 1
+
+#define INFO_LOG(fmt, args...) fprintf(stdout, "[INFO]  " fmt "\n", ##args)
+#define ERROR_LOG(fmt, args...) fprintf(stderr, "[ERROR]  " fmt "\n", ##args)
+
+#define CHECK_RET(cond, return_expr) \
+    do {                             \
+        if (!(cond)) {               \
+            return_expr;             \
+        }                            \
+    } while (0)
+
+namespace {
+constexpr int32_t WARMUP_NUM = 3;
+constexpr int32_t DEFAULT_LOOP_NUM = 20;
+constexpr uint64_t RAND_SEED = 2026;
+
+struct BenchCase {
+    const char *name;
+    int64_t nnz;
+    std::vector<int64_t> size;        // 稀疏维大小
+    std::vector<int64_t> denseShape;  // 每个非零元的value shape
+};
+
+int64_t GetShapeSize(const std::vector<int64_t> &shape)
+{
+    int64_t shapeSize = 1;
+    for (auto i : shape) {
+        shapeSize *= i;
+    }
+    return shapeSize;
+}
+
+uint64_t NextRand(uint64_t &state)
+{
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return state >> 33;
+}
+
+int CreateDeviceTensor(const std::vector<int64_t> &shape, aclDataType dataType, size_t dtypeSize,
+                       const void *hostData, void **deviceAddr, aclTensor **tensor)
+{
+    size_t size = GetShapeSize(shape) * dtypeSize;
+    auto ret = aclrtMalloc(deviceAddr, size, ACL_MEM_MALLOC_HUGE_FIRST);
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("aclrtMalloc failed. ERROR: %d", ret); return FAILED);
+    if (hostData != nullptr) {
+        ret = aclrtMemcpy(*deviceAddr, size, hostData, size, ACL_MEMCPY_HOST_TO_DEVICE);
+    } else {
+        ret = aclrtMemset(*deviceAddr, size, 0, size);
+    }
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("init device memory failed. ERROR: %d", ret); return FAILED);
+    std::vector<int64_t> strides(shape.size(), 1);
+    for (int64_t i = static_cast<int64_t>(shape.size()) - 2; i >= 0; i--) {
+        strides[i] = shape[i + 1] * strides[i + 1];
+    }
+    *tensor = aclCreateTensor(shape.data(), shape.size(), dataType, strides.data(), 0, aclFormat::ACL_FORMAT_ND,
+                              shape.data(), shape.size(), *deviceAddr);
+    return SUCCESS;
+}
+
+int RunOnce(aclTensor *indices, aclTensor *values, aclIntArray *size, aclTensor *newIndices, aclTensor *newValues,
+            aclrtStream stream, void **workspaceAddr, uint64_t &workspaceCap)
+{
+    uint64_t workspaceSize = 0;
+    aclOpExecutor *executor = nullptr;
+    auto ret = aclnnCoalesceSparseV2GetWorkspaceSize(indices, values, size, newIndices, newValues, &workspaceSize,
+                                                     &executor);
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("GetWorkspaceSize failed. ERROR: %d", ret); return FAILED);
+    if (workspaceSize > workspaceCap) {
+        if (*workspaceAddr != nullptr) {
+            aclrtFree(*workspaceAddr);
+        }
+        ret = aclrtMalloc(workspaceAddr, workspaceSize, ACL_MEM_MALLOC_HUGE_FIRST);
+        CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("allocate workspace failed. ERROR: %d", ret); return FAILED);
+        workspaceCap = workspaceSize;
+    }
+    ret = aclnnCoalesceSparseV2(*workspaceAddr, workspaceSize, executor, stream);
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("launch failed. ERROR: %d", ret); return FAILED);
+    return SUCCESS;
+}
+
+int RunCase(const BenchCase &benchCase, int32_t loopNum, aclrtStream stream)
+{
+    int64_t sparseDim = benchCase.size.size();
+    std::vector<int64_t> indicesShape = {benchCase.nnz, sparseDim};
+    std::vector<int64_t> valuesShape = {benchCase.nnz};
+    valuesShape.insert(valuesShape.end(), benchCase.denseShape.begin(), benchCase.denseShape.end());
+
+    // 耗时与run的分布有关，下标用固定种子的随机数，value置0即可
+    std::vector<int64_t> indicesHost(GetShapeSize(indicesShape));
+    uint64_t state = RAND_SEED;
+    for (int64_t i = 0; i < benchCase.nnz; i++) {
+        for (int64_t d = 0; d < sparseDim; d++) {
+            indicesHost[i * sparseDim + d] = NextRand(state) % benchCase.size[d];
+        }
+    }
+
+    void *indicesDeviceAddr = nullptr;
+    void *valuesDeviceAddr = nullptr;
+    void *newIndicesDeviceAddr = nullptr;
+    void *newValuesDeviceAddr = nullptr;
+    aclTensor *indices = nullptr;
+    aclTensor *values = nullptr;
+    aclTensor *newIndices = nullptr;
+    aclTensor *newValues = nullptr;
+    auto ret = CreateDeviceTensor(indicesShape, ACL_INT64, sizeof(int64_t), indicesHost.data(), &indicesDeviceAddr,
+                                  &indices);
+    CHECK_RET(ret == SUCCESS, return FAILED);
+    ret = CreateDeviceTensor(valuesShape, ACL_FLOAT, sizeof(float), nullptr, &valuesDeviceAddr, &values);
+    CHECK_RET(ret == SUCCESS, return FAILED);
+    ret = CreateDeviceTensor(indicesShape, ACL_INT64, sizeof(int64_t), nullptr, &newIndicesDeviceAddr, &newIndices);
+    CHECK_RET(ret == SUCCESS, return FAILED);
+    ret = CreateDeviceTensor(valuesShape, ACL_FLOAT, sizeof(float), nullptr, &newValuesDeviceAddr, &newValues);
+    CHECK_RET(ret == SUCCESS, return FAILED);
+    aclIntArray *size = aclCreateIntArray(benchCase.size.data(), benchCase.size.size());
+
+    void *workspaceAddr = nullptr;
+    uint64_t workspaceCap = 0;
+    for (int32_t i = 0; i < WARMUP_NUM && ret == SUCCESS; i++) {
+        ret = RunOnce(indices, values, size, newIndices, newValues, stream, &workspaceAddr, workspaceCap);
+    }
+    aclrtEvent start = nullptr;
+    aclrtEvent end = nullptr;
+    aclrtCreateEvent(&start);
+    aclrtCreateEvent(&end);
+    aclrtSynchronizeStream(stream);
+    aclrtRecordEvent(start, stream);
+    for (int32_t i = 0; i < loopNum && ret == SUCCESS; i++) {
+        ret = RunOnce(indices, values, size, newIndices, newValues, stream, &workspaceAddr, workspaceCap);
+    }
+    aclrtRecordEvent(end, stream);
+    aclrtSynchronizeStream(stream);
+
+    if (ret == SUCCESS) {
+        float costMs = 0.0f;
+        aclrtEventElapsedTime(&costMs, start, end);
+        double avgUs = costMs * 1000.0 / loopNum;
+        printf("%-24s %10ld %4ld %6ld %10.2f %10.2f\n", benchCase.name, benchCase.nnz, sparseDim,
+               GetShapeSize(benchCase.denseShape), avgUs, benchCase.nnz / avgUs);
+    }
+
+    aclrtDestroyEvent(start);
+    aclrtDestroyEvent(end);
+    aclDestroyIntArray(size);
+    aclDestroyTensor(indices);
+    aclDestroyTensor(values);
+    aclDestroyTensor(newIndices);
+    aclDestroyTensor(newValues);
+    aclrtFree(indicesDeviceAddr);
+    aclrtFree(valuesDeviceAddr);
+    aclrtFree(newIndicesDeviceAddr);
+    aclrtFree(newValuesDeviceAddr);
+    if (workspaceAddr != nullptr) {
+        aclrtFree(workspaceAddr);
+    }
+    return ret;
+}
+}  // namespace
+
+int main(int argc, char **argv)
+{
+    int32_t loopNum = argc > 1 ? atoi(argv[1]) : DEFAULT_LOOP_NUM;
+    CHECK_RET(loopNum > 0, ERROR_LOG("loop num should be positive, got %d", loopNum); return FAILED);
+
+    int32_t deviceId = 0;
+    aclrtStream stream;
+    auto ret = aclInit(nullptr);
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("aclInit failed. ERROR: %d", ret); return FAILED);
+    ret = aclrtSetDevice(deviceId);
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("aclrtSetDevice failed. ERROR: %d", ret); return FAILED);
+    ret = aclrtCreateStream(&stream);
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("aclrtCreateStream failed. ERROR: %d", ret); return FAILED);
+
+    const std::vector<BenchCase> cases = {
+        {"graph_1e5_nnz10m", 10000000, {100000, 100000}, {}},
+        {"dup_4096_nnz16m", 16000000, {4096, 4096}, {}},
+        {"tensor3d_nnz10m_v8", 10000000, {1024, 1024, 1024}, {8}},
+        {"graph_1e5_nnz4m_v64", 4000000, {100000, 100000}, {64}},
+    };
+
+    INFO_LOG("coalesce sparse benchmark, loop %d", loopNum);
+    printf("%-24s %10s %4s %6s %10s %10s\n", "case", "nnz", "m", "V", "time(us)", "Mnnz/s");
+    int32_t failNum = 0;
+    for (const auto &benchCase : cases) {
+        if (RunCase(benchCase, loopNum, stream) != SUCCESS) {
+            failNum++;
+        }
+    }
+
+    aclrtDestroyStream(stream);
+    aclrtResetDevice(deviceId);
+    aclFinalize();
+    if (failNum != 0) {
+        ERROR_LOG("%d cases failed", failNum);
+        return FAILED;
+    }
+    return SUCCESS;
+}
@@ -0,0 +1,57 @@
+#!/usr/bin/python3
+# -*- coding:utf-8 -*-
+# Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+# This file is a part of the CANN Open Software.
+# Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+# ======================================================================================================================
+
+import os
+import torch
+import numpy as np
+
+dtype_map = {torch.float16: np.float16, torch.float32: np.float32, torch.int32: np.int32, torch.int64: np.int64}
+
+
+def gen_golden_data_simple():
+    m = 8
+    n = 13
+    values_size = [n, 7, 2, 3]
+    values_dtype = torch.float16
+    indices_dtype = torch.int32
+
+    indices = torch.randint(0, 10, [m, n], dtype=indices_dtype)
+    values = torch.randn(values_size, dtype=values_dtype)
+
+    max_values, _ = torch.max(indices, dim=1)
+    sparse_size = (max_values + 1).tolist()
+    dense_size = [i for i in values.shape][1:]
+
+    sparse_tensor_cpu = torch.sparse_coo_tensor(indices, values, sparse_size + dense_size)
+    coalesced_tensor_cpu = sparse_tensor_cpu.coalesce()
+    new_indices = coalesced_tensor_cpu.indices()
+    new_values = coalesced_tensor_cpu.values()
+    new_nnz = new_values.shape[0]
+    new_indices_size = [new_nnz, m]
+    new_values_size = [new_nnz] + dense_size
+
+    os.system("mkdir -p input")
+    os.system("mkdir -p output")
+    indices = torch.transpose(indices, 0, 1).contiguous()
+    indices.numpy().astype(dtype_map[indices_dtype]).tofile("./input/input_indices.bin")
+    values.numpy().astype(dtype_map[values_dtype]).tofile("./input/input_values.bin")
+    np.array(sparse_size, dtype=np.int64).tofile("./input/size.bin")
+    np.array([i for i in indices.shape], dtype=np.int64).tofile("./input/indices_shape.bin")
+    np.array([i for i in values.shape], dtype=np.int64).tofile("./input/values_shape.bin")
+    np.array(new_indices_size, dtype=np.int64).tofile("./input/new_indices_shape.bin")
+    np.array(new_values_size, dtype=np.int64).tofile("./input/new_values_shape.bin")
+
+    new_indices = torch.transpose(new_indices, 0, 1)
+    new_indices.numpy().astype(dtype_map[indices_dtype]).tofile("./output/golden_new_indices.bin")
+    new_values.numpy().astype(dtype_map[values_dtype]).tofile("./output/golden_new_values.bin")
+
+if __name__ == "__main__":
+    gen_golden_data_simple()
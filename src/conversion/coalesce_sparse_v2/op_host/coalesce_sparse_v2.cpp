@@ -0,0 +1,353 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file coalesce_sparse_v2.cpp
+ */
+#include "coalesce_sparse_v2_tiling.h"
+#include "tiling/tiling_api.h"
+#include "register/op_def_registry.h"
+#include "platform/platform_info.h"
+
+#define OP_LOGD(nodeName, fmt, ...) std::printf(fmt, ##__VA_ARGS__)
+
+namespace optiling {
+constexpr uint64_t INT64_ID = 0;
+constexpr uint64_t INT32_ID = 1;
+constexpr uint64_t FP32_ID = 0;
+constexpr uint64_t FP16_ID = 2;
+constexpr uint64_t KEY_MODE = 3;
+constexpr uint64_t AILGN32 = 32;
+constexpr uint64_t SORT_TILE = 2048;
+constexpr uint64_t RADIX_BITS = 8;
+constexpr uint64_t RADIX_SIZE = 256;
+constexpr uint64_t WORD_BITS = 32;
+constexpr uint64_t KEY_BITS = 64;
+constexpr uint64_t RUN_INFO_STRIDE = 8;
+constexpr uint64_t ROW_ALIGN = 8;
+constexpr uint64_t MAX_SPARSE_DIM = 16;
+constexpr uint64_t MAX_VALUE_DIM = 8;
+constexpr uint64_t MAX_ROWS = 2147483647;
+constexpr uint64_t COL_MAX = 1024;
+constexpr uint64_t REDUCE_ROWS = 512;
+constexpr uint64_t REDUCE_ELEMS = 2048;
+constexpr uint64_t ROWS_BUF_BYTES = 16384;
+constexpr uint32_t BATCH_MODE = 1;
+constexpr size_t INPUT_INDICES_IDX = 0;
+constexpr size_t INPUT_VALUES_IDX = 1;
+constexpr size_t ATTR_SIZE_IDX = 0;
+
+class CoalesceSparseV2Tiling {
+    public:
+        explicit CoalesceSparseV2Tiling(gert::TilingContext* context) : TilingContext(context){};
+        ge::graphStatus Init();
+        ge::graphStatus RunKernelTiling();
+        void SetTilingKey(ge::DataType indicesDtype, ge::DataType valuesDtype);
+        void TilingDataPrint() const;
+    private:
+        ge::graphStatus InitKeyFields();
+        void InitValueTiling(uint64_t valueTypeSize);
+
+        CoalesceSparseV2TilingData TilingData;
+        gert::TilingContext* TilingContext = nullptr;
+        uint64_t tiling_key = 0;
+        uint64_t usedCoreNum = 0;
+        uint64_t n = 0;
+        uint64_t m = 0;
+        uint64_t valueSize = 0;
+        uint64_t coreLen = 0;
+        uint64_t keyWords = 0;
+        uint64_t passNum = 0;
+        uint64_t colLen = 0;
+        uint64_t colLoop = 0;
+        uint64_t colTail = 0;
+        uint64_t rowTile = 0;
+        uint64_t valueDimNum = 0;
+        uint64_t valueDims[MAX_VALUE_DIM] = {0};
+        uint64_t fieldShift[MAX_SPARSE_DIM] = {0};
+        uint64_t fieldBits[MAX_SPARSE_DIM] = {0};
+        uint64_t usrWorkspaceSize = 0;
+};
+
+void CoalesceSparseV2Tiling::SetTilingKey(ge::DataType indicesDtype, ge::DataType valuesDtype)
+{
+    if (indicesDtype == ge::DT_INT64) {
+        tiling_key = INT64_ID * KEY_MODE;
+    } else {
+        tiling_key = INT32_ID * KEY_MODE;
+    }
+    if (valuesDtype == ge::DT_FLOAT) {
+        tiling_key += FP32_ID;
+    } else if (valuesDtype == ge::DT_INT32) {
+        tiling_key += INT32_ID;
+    } else {
+        tiling_key += FP16_ID;
+    }
+}
+
+/*
+ * 每个稀疏维按size取最少的位数拼成一个不超过64位的key，最后一维在低位，
+ * 排序趟数只取决于总位数而不是m
+ */
+ge::graphStatus CoalesceSparseV2Tiling::InitKeyFields()
+{
+    auto attrs = TilingContext->GetAttrs();
+    if (attrs == nullptr) {
+        return ge::GRAPH_FAILED;
+    }
+    auto sizePtr = attrs->GetAttrPointer<gert::ContinuousVector>(ATTR_SIZE_IDX);
+    if (sizePtr == nullptr || sizePtr->GetSize() != m) {
+        OP_LOGD(TilingContext->GetNodeName(), "size length should be equal to indices dim 1.");
+        return ge::GRAPH_FAILED;
+    }
+    const int64_t* sizeData = reinterpret_cast<const int64_t*>(sizePtr->GetData());
+    uint64_t totalBits = 0;
+    for (int64_t d = static_cast<int64_t>(m) - 1; d >= 0; d--) {
+        if (sizeData[d] <= 0) {
+            OP_LOGD(TilingContext->GetNodeName(), "size[%ld] should be positive.", d);
+            return ge::GRAPH_FAILED;
+        }
+        uint64_t bits = 0;
+        while ((static_cast<uint64_t>(1) << bits) < static_cast<uint64_t>(sizeData[d]) && bits < KEY_BITS) {
+            bits++;
+        }
+        fieldShift[d] = totalBits;
+        fieldBits[d] = bits;
+        totalBits += bits;
+    }
+    if (totalBits > KEY_BITS) {
+        OP_LOGD(TilingContext->GetNodeName(), "sparse key needs %lu bits, more than 64.", totalBits);
+        return ge::GRAPH_FAILED;
+    }
+    keyWords = totalBits > WORD_BITS ? 2 : 1;
+    passNum = (totalBits + RADIX_BITS - 1) / RADIX_BITS;
+    return ge::GRAPH_SUCCESS;
+}
+
+/*
+ * value按列分块，单块放得下整行时行在UB内紧排；rowTile同时受行缓冲与扫描元素数限制
+ */
+void CoalesceSparseV2Tiling::InitValueTiling(uint64_t valueTypeSize)
+{
+    colLen = valueSize <= COL_MAX ? valueSize : COL_MAX;
+    colLoop = (valueSize + colLen - 1) / colLen;
+    colTail = valueSize - (colLoop - 1) * colLen;
+    uint64_t alignNum = AILGN32 / valueTypeSize;
+    uint64_t colPad = (colLen + alignNum - 1) / alignNum * alignNum;
+    uint64_t rowStride = colLoop == 1 ? colLen : colPad;
+    rowTile = REDUCE_ROWS;
+    if (ROWS_BUF_BYTES / (colPad * valueTypeSize) < rowTile) {
+        rowTile = ROWS_BUF_BYTES / (colPad * valueTypeSize);
+    }
+    if (REDUCE_ELEMS / rowStride < rowTile) {
+        rowTile = REDUCE_ELEMS / rowStride;
+    }
+}
+
+ge::graphStatus CoalesceSparseV2Tiling::Init()
+{
+    OP_LOGD(TilingContext->GetNodeName(), "Tiling initing.");
+    auto platformInfo = TilingContext->GetPlatformInfo();
+    auto indicesShape = TilingContext->GetInputShape(INPUT_INDICES_IDX)->GetStorageShape();
+    auto valueShape = TilingContext->GetInputShape(INPUT_VALUES_IDX)->GetStorageShape();
+    auto indicesDtype = TilingContext->GetInputDesc(INPUT_INDICES_IDX)->GetDataType();
+    auto valuesDtype = TilingContext->GetInputDesc(INPUT_VALUES_IDX)->GetDataType();
+    uint64_t valueTypeSize = GetSizeByDataType(valuesDtype);
+    uint32_t coreNum = platformInfo->GetCoreNum();
+    SetTilingKey(indicesDtype, valuesDtype);
+
+    n = indicesShape.GetDim(0);
+    m = indicesShape.GetDim(1);
+    if (m == 0 || m > MAX_SPARSE_DIM || n > MAX_ROWS || coreNum == 0) {
+        OP_LOGD(TilingContext->GetNodeName(), "indices shape [%lu, %lu] is not supported.", n, m);
+        return ge::GRAPH_FAILED;
+    }
+    valueDimNum = valueShape.GetDimNum();
+    valueSize = 1;
+    for (uint64_t i = 0; i < valueDimNum; i++) {
+        valueDims[i] = valueShape.GetDim(i);
+        if (i > 0) {
+            valueSize *= valueShape.GetDim(i);
+        }
+    }
+    if (valueSize == 0 || InitKeyFields() != ge::GRAPH_SUCCESS) {
+        return ge::GRAPH_FAILED;
+    }
+
+    coreLen = (n + coreNum - 1) / coreNum;
+    coreLen = (coreLen + ROW_ALIGN - 1) / ROW_ALIGN * ROW_ALIGN;
+    usedCoreNum = n > 0 ? (n + coreLen - 1) / coreLen : 1;
+    InitValueTiling(valueTypeSize);
+
+    uint64_t nAlign = (n + SORT_TILE - 1) / SORT_TILE * SORT_TILE;
+    usrWorkspaceSize = ((keyWords + 1) * 2 * nAlign + usedCoreNum * (RADIX_SIZE + RUN_INFO_STRIDE)) *
+                       sizeof(int32_t);
+    OP_LOGD(TilingContext->GetNodeName(), "Tiling inited.");
+    return ge::GRAPH_SUCCESS;
+}
+
+ge::graphStatus CoalesceSparseV2Tiling::RunKernelTiling(){
+    OP_LOGD(TilingContext->GetNodeName(), "Tiling start.");
+    TilingContext->SetBlockDim(usedCoreNum);
+    TilingContext->SetTilingKey(tiling_key);
+    TilingContext->SetScheduleMode(BATCH_MODE);
+    TilingData.set_usedCoreNum(usedCoreNum);
+    TilingData.set_n(n);
+    TilingData.set_m(m);
+    TilingData.set_valueSize(valueSize);
+    TilingData.set_coreLen(coreLen);
+    TilingData.set_keyWords(keyWords);
+    TilingData.set_passNum(passNum);
+    TilingData.set_colLen(colLen);
+    TilingData.set_colLoop(colLoop);
+    TilingData.set_colTail(colTail);
+    TilingData.set_rowTile(rowTile);
+    TilingData.set_valueDimNum(valueDimNum);
+    TilingData.set_valueDims(valueDims);
+    TilingData.set_fieldShift(fieldShift);
+    TilingData.set_fieldBits(fieldBits);
+
+    auto ascendcPlatform = platform_ascendc::PlatformAscendC(TilingContext->GetPlatformInfo());
+    size_t* currentWorkspace = TilingContext->GetWorkspaceSizes(1);
+    currentWorkspace[0] = usrWorkspaceSize + ascendcPlatform.GetLibApiWorkSpaceSize();
+
+    TilingData.SaveToBuffer(TilingContext->GetRawTilingData()->GetData(), TilingContext->GetRawTilingData()->GetCapacity());
+    TilingContext->GetRawTilingData()->SetDataSize(TilingData.GetDataSize());
+    TilingDataPrint();
+    OP_LOGD(TilingContext->GetNodeName(), "Tiling end.");
+    return ge::GRAPH_SUCCESS;
+}
+
+void CoalesceSparseV2Tiling::TilingDataPrint() const {
+    OP_LOGD(TilingContext->GetNodeName(), "usedCoreNum: %lu.", usedCoreNum);
+    OP_LOGD(TilingContext->GetNodeName(), "n: %lu.", n);
+    OP_LOGD(TilingContext->GetNodeName(), "m: %lu.", m);
+    OP_LOGD(TilingContext->GetNodeName(), "valueSize: %lu.", valueSize);
+    OP_LOGD(TilingContext->GetNodeName(), "coreLen: %lu.", coreLen);
+    OP_LOGD(TilingContext->GetNodeName(), "keyWords: %lu.", keyWords);
+    OP_LOGD(TilingContext->GetNodeName(), "passNum: %lu.", passNum);
+    OP_LOGD(TilingContext->GetNodeName(), "colLen: %lu.", colLen);
+    OP_LOGD(TilingContext->GetNodeName(), "colLoop: %lu.", colLoop);
+    OP_LOGD(TilingContext->GetNodeName(), "colTail: %lu.", colTail);
+    OP_LOGD(TilingContext->GetNodeName(), "rowTile: %lu.", rowTile);
+    OP_LOGD(TilingContext->GetNodeName(), "usrWorkspaceSize: %lu.", usrWorkspaceSize);
+}
+
+static ge::graphStatus TilingCoalesceSparseV2(gert::TilingContext *context)
+{
+    CoalesceSparseV2Tiling tilingObject(context);
+    if (tilingObject.Init() != ge::GRAPH_SUCCESS) {
+        return ge::GRAPH_FAILED;
+    }
+    return tilingObject.RunKernelTiling();
+}
+
+static ge::graphStatus TilingPrepareForCoalesceSparseV2(gert::TilingParseContext* context) {
+    OP_LOGD("CoalesceSparseV2", "TilingPrepareForCoalesceSparseV2 start.");
+    return ge::GRAPH_SUCCESS;
+}
+
+struct CoalesceSparseV2CompileInfo {};
+IMPL_OP_OPTILING(CoalesceSparseV2)
+    .Tiling(TilingCoalesceSparseV2)
+    .TilingParse<CoalesceSparseV2CompileInfo>(TilingPrepareForCoalesceSparseV2);
+} // namespace optiling
+
+namespace ge {
+constexpr size_t INPUT_INDICES_IDX = 0;
+constexpr size_t INPUT_VALUES_IDX = 1;
+
+#define OPS_CHECK_NULL_WITH_CONTEXT(context, ptr)            \
+    if ((ptr) == nullptr)                                    \
+    {                                                        \
+        std::printf("nullptr error!");                       \
+        return ge::GRAPH_FAILED;                             \
+    }                                                        \
+
+/*
+ * 输出行数U在执行期才确定，这里给出上界n，实际shape由kernel写回
+ */
+static graphStatus CoalesceSparseV2InferShape(gert::InferShapeContext *context)
+{
+    const gert::Shape* indicesShape = context->GetInputShape(INPUT_INDICES_IDX);
+    const gert::Shape* valueShape = context->GetInputShape(INPUT_VALUES_IDX);
+    OPS_CHECK_NULL_WITH_CONTEXT(context, indicesShape);
+    OPS_CHECK_NULL_WITH_CONTEXT(context, valueShape);
+
+    gert::Shape* newIndicesShape = context->GetOutputShape(0);
+    gert::Shape* newValueShape = context->GetOutputShape(1);
+    OPS_CHECK_NULL_WITH_CONTEXT(context, newIndicesShape);
+    OPS_CHECK_NULL_WITH_CONTEXT(context, newValueShape);
+
+    *newIndicesShape = *indicesShape;
+    *newValueShape = *valueShape;
+    return ge::GRAPH_SUCCESS;
+}
+
+static graphStatus CoalesceSparseV2InferDataType(gert::InferDataTypeContext *context)
+{
+    OP_LOGD(context->GetNodeName(), "Begin to do InferDataType4CoalesceSparseV2");
+
+    auto indicesDataType = context->GetInputDataType(INPUT_INDICES_IDX);
+    auto valueDataType = context->GetInputDataType(INPUT_VALUES_IDX);
+    context->SetOutputDataType(0, indicesDataType);
+    context->SetOutputDataType(1, valueDataType);
+
+    OP_LOGD(context->GetNodeName(), "End to do InferDataType4CoalesceSparseV2 end");
+    return ge::GRAPH_SUCCESS;
+}
+
+IMPL_OP_INFERSHAPE(CoalesceSparseV2)
+    .InferShape(CoalesceSparseV2InferShape)
+    .InferDataType(CoalesceSparseV2InferDataType);
+} // namespace ge
+
+namespace ops {
+class CoalesceSparseV2 : public OpDef {
+public:
+    explicit CoalesceSparseV2(const char *name) : OpDef(name)
+    {
+        this->Input("indices")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_INT64, ge::DT_INT64, ge::DT_INT64, ge::DT_INT32, ge::DT_INT32, ge::DT_INT32})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND})
+            .AutoContiguous();
+        this->Input("values")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_FLOAT, ge::DT_INT32, ge::DT_FLOAT16, ge::DT_FLOAT, ge::DT_INT32, ge::DT_FLOAT16})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND})
+            .AutoContiguous();
+        this->Output("new_indices")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_INT64, ge::DT_INT64, ge::DT_INT64, ge::DT_INT32, ge::DT_INT32, ge::DT_INT32})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND})
+            .OutputShapeDependOnCompute();
+        this->Output("new_values")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_FLOAT, ge::DT_INT32, ge::DT_FLOAT16, ge::DT_FLOAT, ge::DT_INT32, ge::DT_FLOAT16})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND})
+            .OutputShapeDependOnCompute();
+        this->Attr("size").AttrType(REQUIRED).ListInt();
+
+        OpAICoreConfig aicore_config;
+        aicore_config.DynamicCompileStaticFlag(true)
+            .DynamicFormatFlag(true)
+            .DynamicRankSupportFlag(true)
+            .DynamicShapeSupportFlag(true);
+        this->AICore()
+            .AddConfig("ascend910b", aicore_config);
+    }
+};
+OP_ADD(CoalesceSparseV2);
+} // namespace ops
@@ -0,0 +1,39 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file coalesce_sparse_v2_tiling.h
+ */
+#ifndef COALESCE_SPARSE_V2_TILING_H
+#define COALESCE_SPARSE_V2_TILING_H
+#include "register/tilingdata_base.h"
+
+namespace optiling {
+BEGIN_TILING_DATA_DEF(CoalesceSparseV2TilingData)
+TILING_DATA_FIELD_DEF(uint64_t, usedCoreNum);
+TILING_DATA_FIELD_DEF(uint64_t, n);
+TILING_DATA_FIELD_DEF(uint64_t, m);
+TILING_DATA_FIELD_DEF(uint64_t, valueSize);
+TILING_DATA_FIELD_DEF(uint64_t, coreLen);
+TILING_DATA_FIELD_DEF(uint64_t, keyWords);
+TILING_DATA_FIELD_DEF(uint64_t, passNum);
+TILING_DATA_FIELD_DEF(uint64_t, colLen);
+TILING_DATA_FIELD_DEF(uint64_t, colLoop);
+TILING_DATA_FIELD_DEF(uint64_t, colTail);
+TILING_DATA_FIELD_DEF(uint64_t, rowTile);
+TILING_DATA_FIELD_DEF(uint64_t, valueDimNum);
+TILING_DATA_FIELD_DEF_ARR(uint64_t, 8, valueDims);
+TILING_DATA_FIELD_DEF_ARR(uint64_t, 16, fieldShift);
+TILING_DATA_FIELD_DEF_ARR(uint64_t, 16, fieldBits);
+END_TILING_DATA_DEF;
+
+REGISTER_TILING_DATA_CLASS(CoalesceSparseV2, CoalesceSparseV2TilingData)
+} // namespace optiling
+#endif // COALESCE_SPARSE_V2_TILING_H
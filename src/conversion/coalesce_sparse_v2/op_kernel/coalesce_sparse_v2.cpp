@@ -0,0 +1,50 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file coalesce_sparse_v2.cpp
+ */
+#include "coalesce_sparse_v2.h"
+
+using namespace CoalesceSparseV2;
+
+extern "C" __global__ __aicore__ void coalesce_sparse_v2(GM_ADDR indices, GM_ADDR values, GM_ADDR new_indices,
+                                                         GM_ADDR new_values, GM_ADDR shape_out, GM_ADDR workspace,
+                                                         GM_ADDR tiling)
+{
+    GET_TILING_DATA(tilingData, tiling);
+    const CoalesceSparseV2TilingData* __restrict tilingDevice = &tilingData;
+    GM_ADDR userWorkspace = GetUserWorkspace(workspace);
+    if (TILING_KEY_IS(0)) {
+        KernelCoalesceSparseV2<int64_t, float> op;
+        op.Init(indices, values, new_indices, new_values, shape_out, userWorkspace, tilingDevice);
+        op.Process();
+    } else if (TILING_KEY_IS(1)) {
+        KernelCoalesceSparseV2<int64_t, int32_t> op;
+        op.Init(indices, values, new_indices, new_values, shape_out, userWorkspace, tilingDevice);
+        op.Process();
+    } else if (TILING_KEY_IS(2)) {
+        KernelCoalesceSparseV2<int64_t, half> op;
+        op.Init(indices, values, new_indices, new_values, shape_out, userWorkspace, tilingDevice);
+        op.Process();
+    } else if (TILING_KEY_IS(3)) {
+        KernelCoalesceSparseV2<int32_t, float> op;
+        op.Init(indices, values, new_indices, new_values, shape_out, userWorkspace, tilingDevice);
+        op.Process();
+    } else if (TILING_KEY_IS(4)) {
+        KernelCoalesceSparseV2<int32_t, int32_t> op;
+        op.Init(indices, values, new_indices, new_values, shape_out, userWorkspace, tilingDevice);
+        op.Process();
+    } else if (TILING_KEY_IS(5)) {
+        KernelCoalesceSparseV2<int32_t, half> op;
+        op.Init(indices, values, new_indices, new_values, shape_out, userWorkspace, tilingDevice);
+        op.Process();
+    }
+}
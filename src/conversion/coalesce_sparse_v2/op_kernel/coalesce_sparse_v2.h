@@ -0,0 +1,700 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file coalesce_sparse_v2.h
+ */
+#ifndef COALESCE_SPARSE_V2_H
+#define COALESCE_SPARSE_V2_H
+
+#include "kernel_operator.h"
+#include "kernel_tiling/kernel_tiling.h"
+#include "coalesce_sparse_v2_sort.h"
+
+namespace CoalesceSparseV2 {
+using namespace AscendC;
+
+constexpr int32_t REDUCE_ROWS = 512;
+constexpr int32_t REDUCE_ELEMS = 2048;
+constexpr int32_t ROWS_BUF_BYTES = 16384;
+constexpr int32_t COL_MAX = 1024;
+constexpr int32_t IDX_BATCH = 64;
+constexpr int32_t MAX_IDX_WORDS = MAX_SPARSE_DIM * 2;
+constexpr int32_t SCAN_PREFIX = 8;
+constexpr int32_t SHAPE_DIM_STRIDE = 9;
+constexpr int32_t MAX_VALUE_DIM = 8;
+
+template <typename T>
+struct AccType {
+    using type = float;
+};
+
+template <>
+struct AccType<int32_t> {
+    using type = int32_t;
+};
+
+/*
+ * 三个阶段：KeyRadixSort把key排好序；CountRuns统计每核内的run起点，核间前缀和得到每个run的输出行号；
+ * Reduce按run分段累加value行。每核负责起点落在本核分片内的run，run可以延伸到后面的分片，
+ * 因此所有输出行只被一个核写一次，不需要原子加和输出清零。
+ */
+template <typename idxType, typename dataType>
+class KernelCoalesceSparseV2 {
+public:
+    using accType = typename AccType<dataType>::type;
+
+    __aicore__ inline KernelCoalesceSparseV2() = default;
+    __aicore__ inline void Init(GM_ADDR indices, GM_ADDR values, GM_ADDR newIndices, GM_ADDR newValues,
+                                GM_ADDR shapeOut, GM_ADDR workspace,
+                                const CoalesceSparseV2TilingData *__restrict tilingData);
+    __aicore__ inline void Process();
+
+private:
+    __aicore__ inline void InitTilingValue(const CoalesceSparseV2TilingData *__restrict tilingData);
+    __aicore__ inline void InitReduceBuffers();
+    __aicore__ inline void InitReduceTables();
+    __aicore__ inline void ComputeRunFlags(int64_t rowStart, int64_t cnt);
+    __aicore__ inline void CountRuns();
+    __aicore__ inline void LoadRunInfo();
+    __aicore__ inline void WriteShape();
+    __aicore__ inline void Reduce();
+    __aicore__ inline void ReduceTile(int64_t rowStart, int64_t rows, int64_t colStart, int64_t colNum,
+                                      bool writeIndices);
+    __aicore__ inline void LoadRows(int64_t rows, int64_t colStart, int64_t colNum);
+    __aicore__ inline void SegmentIds(int64_t rows);
+    __aicore__ inline void SegmentedScan(int64_t rows, int64_t elemNum);
+    __aicore__ inline void WriteEnded(int64_t rows, int64_t elemNum, int64_t colStart, int64_t colNum);
+    __aicore__ inline void WriteIndices(int64_t rows);
+
+private:
+    TPipe pipe;
+    TBuf<TPosition::VECCALC> ubBuf;
+
+    GlobalTensor<idxType> indicesGm;
+    GlobalTensor<dataType> valuesGm;
+    GlobalTensor<idxType> newIndicesGm;
+    GlobalTensor<dataType> newValuesGm;
+    GlobalTensor<uint64_t> shapeOutGm;
+    GlobalTensor<int32_t> runInfoGm;
+
+    SortWorkspace ws;
+    SortParam sortParam;
+    KeyRadixSort<idxType> sorter;
+    int64_t fin {0};
+
+    uint64_t usedCoreNum {0};
+    uint64_t n {0};
+    uint64_t m {0};
+    uint64_t valueSize {0};
+    uint64_t colLen {0};
+    uint64_t colLoop {0};
+    uint64_t colTail {0};
+    uint64_t rowTile {0};
+    uint64_t valueDimNum {0};
+    uint64_t valueDims[MAX_VALUE_DIM] {0};
+
+    int64_t colPad {0};
+    int64_t rowStride {0};
+    bool compact {true};
+    int64_t runNum {0};
+    int64_t runTotal {0};
+    int64_t segBase {0};
+    int64_t rowBegin {0};
+    int64_t rowEnd {0};
+    int64_t segCursor {0};
+    int64_t startCursor {0};
+    bool carryValid {false};
+
+    LocalTensor<int32_t> keyLo;
+    LocalTensor<int32_t> keyHi;
+    LocalTensor<int32_t> curOff;
+    LocalTensor<int32_t> prevOff;
+    LocalTensor<int32_t> tmpA;
+    LocalTensor<int32_t> tmpB;
+    LocalTensor<float> tmpC;
+    LocalTensor<float> flagF;
+    LocalTensor<float> endF;
+    LocalTensor<float> segS;
+    LocalTensor<int32_t> permT;
+    LocalTensor<uint32_t> startPerm;
+    LocalTensor<dataType> rowsBuf;
+    LocalTensor<accType> accBuf;
+    LocalTensor<float> elemE;
+    LocalTensor<accType> shAcc;
+    LocalTensor<float> shE;
+    LocalTensor<int32_t> elemOff;
+    LocalTensor<uint32_t> rowOffTbl;
+    LocalTensor<uint32_t> compactOff;
+    LocalTensor<float> endE;
+    LocalTensor<accType> outBuf;
+    LocalTensor<half> outHalf;
+    LocalTensor<uint8_t> maskE;
+    LocalTensor<accType> carry;
+    LocalTensor<idxType> idxRows;
+    LocalTensor<idxType> idxCompact;
+    LocalTensor<uint32_t> idxOff;
+    LocalTensor<int32_t> runInfoLocal;
+};
+
+template <typename idxType, typename dataType>
+__aicore__ inline void KernelCoalesceSparseV2<idxType, dataType>::Init(
+    GM_ADDR indices, GM_ADDR values, GM_ADDR newIndices, GM_ADDR newValues, GM_ADDR shapeOut, GM_ADDR workspace,
+    const CoalesceSparseV2TilingData *__restrict tilingData)
+{
+    InitTilingValue(tilingData);
+    indicesGm.SetGlobalBuffer((__gm__ idxType *)indices);
+    valuesGm.SetGlobalBuffer((__gm__ dataType *)values);
+    newIndicesGm.SetGlobalBuffer((__gm__ idxType *)newIndices);
+    newValuesGm.SetGlobalBuffer((__gm__ dataType *)newValues);
+    shapeOutGm.SetGlobalBuffer((__gm__ uint64_t *)shapeOut, SHAPE_DIM_STRIDE * 2);
+
+    ws.Init(workspace, n, usedCoreNum, sortParam.keyWords);
+    runInfoGm.SetGlobalBuffer(ws.runInfo);
+    pipe.InitBuffer(ubBuf, UB_BUF_BYTES);
+    sorter.Init(indices, ws, sortParam, ubBuf.Get<uint8_t>());
+}
+
+template <typename idxType, typename dataType>
+__aicore__ inline void KernelCoalesceSparseV2<idxType, dataType>::InitTilingValue(
+    const CoalesceSparseV2TilingData *__restrict tilingData)
+{
+    usedCoreNum = tilingData->usedCoreNum;
+    n = tilingData->n;
+    m = tilingData->m;
+    valueSize = tilingData->valueSize;
+    colLen = tilingData->colLen;
+    colLoop = tilingData->colLoop;
+    colTail = tilingData->colTail;
+    rowTile = tilingData->rowTile;
+    valueDimNum = tilingData->valueDimNum;
+    for (uint64_t i = 0; i < valueDimNum; i++) {
+        valueDims[i] = tilingData->valueDims[i];
+    }
+
+    int64_t coreIdx = GetBlockIdx();
+    sortParam.n = n;
+    sortParam.m = m;
+    sortParam.coreNum = usedCoreNum;
+    sortParam.coreStart = coreIdx * tilingData->coreLen;
+    sortParam.coreLen = MinLen(tilingData->coreLen, static_cast<int64_t>(n) - sortParam.coreStart);
+    sortParam.keyWords = tilingData->keyWords;
+    sortParam.passNum = tilingData->passNum;
+    for (uint64_t d = 0; d < m; d++) {
+        sortParam.fieldShift[d] = tilingData->fieldShift[d];
+        sortParam.fieldBits[d] = tilingData->fieldBits[d];
+    }
+
+    colPad = CeilAlign(colLen, BLOCK_BYTES / sizeof(dataType));
+    compact = (colLoop == 1);
+    rowStride = compact ? colLen : colPad;
+}
+
+template <typename idxType, typename dataType>
+__aicore__ inline void KernelCoalesceSparseV2<idxType, dataType>::InitReduceBuffers()
+{
+    constexpr uint32_t rowBytes = (REDUCE_ROWS + FLOAT_REPEAT_NUM) * sizeof(float);
+    constexpr uint32_t elemBytes = (REDUCE_ELEMS + FLOAT_REPEAT_NUM) * sizeof(float);
+    constexpr uint32_t prefixBytes = SCAN_PREFIX * sizeof(float);
+    constexpr uint32_t idxBytes = IDX_BATCH * MAX_IDX_WORDS * sizeof(uint32_t);
+    LocalTensor<uint8_t> ub = ubBuf.Get<uint8_t>();
+    uint32_t offset = 0;
+    keyLo = ub[offset].ReinterpretCast<int32_t>();
+    offset += rowBytes;
+    keyHi = ub[offset].ReinterpretCast<int32_t>();
+    offset += rowBytes;
+    curOff = ub[offset].ReinterpretCast<int32_t>();
+    offset += rowBytes;
+    prevOff = ub[offset].ReinterpretCast<int32_t>();
+    offset += rowBytes;
+    tmpA = ub[offset].ReinterpretCast<int32_t>();
+    offset += rowBytes;
+    tmpB = ub[offset].ReinterpretCast<int32_t>();
+    offset += rowBytes;
+    tmpC = ub[offset].ReinterpretCast<float>();
+    offset += rowBytes;
+    flagF = ub[offset].ReinterpretCast<float>();
+    offset += rowBytes;
+    endF = ub[offset].ReinterpretCast<float>();
+    offset += rowBytes;
+    segS = ub[offset].ReinterpretCast<float>();
+    offset += rowBytes + prefixBytes;
+    permT = ub[offset].ReinterpretCast<int32_t>();
+    offset += rowBytes;
+    startPerm = ub[offset].ReinterpretCast<uint32_t>();
+    offset += rowBytes;
+    rowsBuf = ub[offset].ReinterpretCast<dataType>();
+    offset += ROWS_BUF_BYTES;
+    accBuf = ub[offset].ReinterpretCast<accType>();
+    offset += elemBytes + prefixBytes;
+    elemE = ub[offset].ReinterpretCast<float>();
+    offset += elemBytes + prefixBytes;
+    shAcc = ub[offset].ReinterpretCast<accType>();
+    offset += elemBytes;
+    shE = ub[offset].ReinterpretCast<float>();
+    offset += elemBytes;
+    elemOff = ub[offset].ReinterpretCast<int32_t>();
+    offset += elemBytes;
+    rowOffTbl = ub[offset].ReinterpretCast<uint32_t>();
+    offset += elemBytes;
+    compactOff = ub[offset].ReinterpretCast<uint32_t>();
+    offset += elemBytes;
+    endE = ub[offset].ReinterpretCast<float>();
+    offset += elemBytes;
+    outBuf = ub[offset].ReinterpretCast<accType>();
+    offset += elemBytes;
+    outHalf = ub[offset].ReinterpretCast<half>();
+    offset += elemBytes / 2;
+    maskE = ub[offset];
+    offset += elemBytes / BLOCK_BYTES * INT32_BLOCK_NUM / 4;
+    carry = ub[offset].ReinterpretCast<accType>();
+    offset += (COL_MAX + FLOAT_REPEAT_NUM) * sizeof(float);
+    idxRows = ub[offset].ReinterpretCast<idxType>();
+    offset += idxBytes;
+    idxCompact = ub[offset].ReinterpretCast<idxType>();
+    offset += idxBytes;
+    idxOff = ub[offset].ReinterpretCast<uint32_t>();
+    offset += idxBytes;
+    runInfoLocal = ub[offset].ReinterpretCast<int32_t>();
+}
+
+/*
+ * 行号、紧排偏移与下标紧排偏移只与tiling相关，整个Reduce阶段只生成一次
+ */
+template <typename idxType, typename dataType>
+__aicore__ inline void KernelCoalesceSparseV2<idxType, dataType>::InitReduceTables()
+{
+    int64_t e = 0;
+    for (int64_t r = 0; r < static_cast<int64_t>(rowTile); r++) {
+        for (int64_t c = 0; c < rowStride; c++, e++) {
+            rowOffTbl.SetValue(e, static_cast<uint32_t>(r * sizeof(float)));
+            compactOff.SetValue(e, static_cast<uint32_t>((r * colPad + c) * sizeof(dataType)));
+        }
+    }
+    int64_t idxWords = m * sizeof(idxType) / sizeof(uint32_t);
+    int64_t idxPadWords = CeilAlign(idxWords, INT32_BLOCK_NUM);
+    e = 0;
+    for (int64_t r = 0; r < IDX_BATCH; r++) {
+        for (int64_t c = 0; c < idxWords; c++, e++) {
+            idxOff.SetValue(e, static_cast<uint32_t>((r * idxPadWords + c) * sizeof(uint32_t)));
+        }
+    }
+    PipeSync<HardEvent::S_V>();
+    Duplicate(segS, 0.0f, SCAN_PREFIX);
+    Duplicate(elemE, -1.0f, SCAN_PREFIX);
+    Duplicate(accBuf, static_cast<accType>(0), SCAN_PREFIX);
+    PipeBarrier<PIPE_V>();
+}
+
+template <typename idxType, typename dataType>
+__aicore__ inline void KernelCoalesceSparseV2<idxType, dataType>::Process()
+{
+    if (n == 0) {
+        if (GetBlockIdx() == 0) {
+            WriteShape();
+        }
+        return;
+    }
+    fin = sorter.Process();
+    InitReduceBuffers();
+    CountRuns();
+    SyncAll();
+    LoadRunInfo();
+    if (GetBlockIdx() == 0) {
+        WriteShape();
+    }
+    if (runNum > 0) {
+        Reduce();
+    }
+}
+
+/*
+ * flagF[i]表示第rowStart + i行是否为一个run的起点：与前一行的key有任一字不同。
+ * 首行和越过n的一行恒为起点，后者用作最后一行的结束标记。
+ */
+template <typename idxType, typename dataType>
+__aicore__ inline void KernelCoalesceSparseV2<idxType, dataType>::ComputeRunFlags(int64_t rowStart, int64_t cnt)
+{
+    int64_t loadStart = rowStart > 0 ? rowStart - 1 : 0;
+    int64_t loadEnd = MinLen(rowStart + cnt, n);
+    int64_t loadLen = loadEnd - loadStart;
+    int64_t shift = rowStart - loadStart;
+    DataCopyExtParams copyParams {1, static_cast<uint32_t>(loadLen * sizeof(int32_t)), 0, 0, 0};
+    DataCopyPadExtParams<int32_t> padParams {false, 0, 0, 0};
+    GlobalTensor<int32_t> keyGm;
+
+    PipeSync<HardEvent::V_MTE2>();
+    keyGm.SetGlobalBuffer(ws.key[0][fin]);
+    DataCopyPad(keyLo, keyGm[loadStart], copyParams, padParams);
+    if (sortParam.keyWords > 1) {
+        keyGm.SetGlobalBuffer(ws.key[1][fin]);
+        DataCopyPad(keyHi, keyGm[loadStart], copyParams, padParams);
+    }
+    ArithProgression<int32_t>(curOff, static_cast<int32_t>(shift * sizeof(int32_t)),
+                              static_cast<int32_t>(sizeof(int32_t)), cnt);
+    ArithProgression<int32_t>(prevOff, static_cast<int32_t>((shift - 1) * sizeof(int32_t)),
+                              static_cast<int32_t>(sizeof(int32_t)), cnt);
+    PipeBarrier<PIPE_V>();
+    Mins(curOff, curOff, static_cast<int32_t>((loadLen - 1) * sizeof(int32_t)), cnt);
+    Maxs(prevOff, prevOff, 0, cnt);
+    PipeSync<HardEvent::MTE2_V>();
+
+    for (int64_t w = 0; w < sortParam.keyWords; w++) {
+        LocalTensor<int32_t> key = (w == 0) ? keyLo : keyHi;
+        LocalTensor<float> diff = (w == 0) ? flagF : tmpC;
+        Gather(tmpA.ReinterpretCast<uint32_t>(), key.ReinterpretCast<uint32_t>(), curOff.ReinterpretCast<uint32_t>(),
+               0, cnt);
+        Gather(tmpB.ReinterpretCast<uint32_t>(), key.ReinterpretCast<uint32_t>(),
+               prevOff.ReinterpretCast<uint32_t>(), 0, cnt);
+        PipeBarrier<PIPE_V>();
+        Sub(tmpA, tmpA, tmpB, cnt);
+        PipeBarrier<PIPE_V>();
+        // 差值不为0时转float后绝对值至少为1，两个字相加不会抵消
+        Cast(diff, tmpA, RoundMode::CAST_NONE, cnt);
+        PipeBarrier<PIPE_V>();
+        Abs(diff, diff, cnt);
+        PipeBarrier<PIPE_V>();
+        if (w > 0) {
+            Add(flagF, flagF, tmpC, cnt);
+            PipeBarrier<PIPE_V>();
+        }
+    }
+    Mins(flagF, flagF, 1.0f, cnt);
+    if (rowStart == 0 || rowStart + cnt > static_cast<int64_t>(n)) {
+        PipeSync<HardEvent::V_S>();
+        if (rowStart == 0) {
+            flagF.SetValue(0, 1.0f);
+        }
+        if (rowStart + cnt > static_cast<int64_t>(n)) {
+            flagF.SetValue(n - rowStart, 1.0f);
+        }
+        PipeSync<HardEvent::S_V>();
+    }
+    PipeBarrier<PIPE_V>();
+}
+
+template <typename idxType, typename dataType>
+__aicore__ inline void KernelCoalesceSparseV2<idxType, dataType>::CountRuns()
+{
+    int64_t count = 0;
+    int64_t first = n;
+    for (int64_t t0 = 0; t0 < sortParam.coreLen; t0 += REDUCE_ROWS) {
+        int64_t rows = MinLen(REDUCE_ROWS, sortParam.coreLen - t0);
+        int64_t rowStart = sortParam.coreStart + t0;
+        ComputeRunFlags(rowStart, rows);
+        CompareScalar(maskE, flagF, 1.0f, CMPMODE::EQ, CeilAlign(rows, FLOAT_REPEAT_NUM));
+        ArithProgression<int32_t>(tmpA, static_cast<int32_t>(rowStart), 1, rows);
+        PipeBarrier<PIPE_V>();
+        uint64_t startNum = 0;
+        GatherMask(tmpB.ReinterpretCast<uint32_t>(), tmpA.ReinterpretCast<uint32_t>(),
+                   maskE.ReinterpretCast<uint32_t>(), true, static_cast<uint32_t>(rows), {1, 1, 8, 8}, startNum);
+        PipeSync<HardEvent::V_S>();
+        if (first == static_cast<int64_t>(n) && startNum > 0) {
+            first = tmpB.GetValue(0);
+        }
+        count += startNum;
+    }
+    runInfoLocal.SetValue(0, static_cast<int32_t>(count));
+    runInfoLocal.SetValue(1, static_cast<int32_t>(first));
+    PipeSync<HardEvent::S_MTE3>();
+    DataCopy(runInfoGm[GetBlockIdx() * RUN_INFO_STRIDE], runInfoLocal, RUN_INFO_STRIDE);
+    PipeSync<HardEvent::MTE3_S>();
+}
+
+/*
+ * 本核的run从全局第segBase个输出行开始写，覆盖行区间[rowBegin, rowEnd)，
+ * rowEnd是后面第一个含run起点的核的首个起点
+ */
+template <typename idxType, typename dataType>
+__aicore__ inline void KernelCoalesceSparseV2<idxType, dataType>::LoadRunInfo()
+{
+    int64_t coreIdx = GetBlockIdx();
+    LocalTensor<int32_t> infoAll = tmpA;
+    PipeSync<HardEvent::V_MTE2>();
+    DataCopy(infoAll, runInfoGm, usedCoreNum * RUN_INFO_STRIDE);
+    PipeSync<HardEvent::MTE2_S>();
+    runTotal = 0;
+    segBase = 0;
+    rowEnd = n;
+    for (int64_t c = 0; c < static_cast<int64_t>(usedCoreNum); c++) {
+        int64_t cnt = infoAll.GetValue(c * RUN_INFO_STRIDE);
+        if (c < coreIdx) {
+            segBase += cnt;
+        } else if (c == coreIdx) {
+            runNum = cnt;
+            rowBegin = infoAll.GetValue(c * RUN_INFO_STRIDE + 1);
+        } else if (cnt > 0 && rowEnd == static_cast<int64_t>(n)) {
+            rowEnd = infoAll.GetValue(c * RUN_INFO_STRIDE + 1);
+        }
+        runTotal += cnt;
+    }
+}
+
+/*
+ * 输出shape由执行期写回，每个输出占SHAPE_DIM_STRIDE个uint64：维度数后接各维大小
+ */
+template <typename idxType, typename dataType>
+__aicore__ inline void KernelCoalesceSparseV2<idxType, dataType>::WriteShape()
+{
+    shapeOutGm.SetValue(0, 2);
+    shapeOutGm.SetValue(1, runTotal);
+    shapeOutGm.SetValue(2, m);
+    shapeOutGm.SetValue(SHAPE_DIM_STRIDE, valueDimNum);
+    shapeOutGm.SetValue(SHAPE_DIM_STRIDE + 1, runTotal);
+    for (uint64_t i = 1; i < valueDimNum; i++) {
+        shapeOutGm.SetValue(SHAPE_DIM_STRIDE + 1 + i, valueDims[i]);
+    }
+    DataCacheCleanAndInvalid<uint64_t, CacheLine::ENTIRE_DATA_CACHE>(shapeOutGm);
+}
+
+template <typename idxType, typename dataType>
+__aicore__ inline void KernelCoalesceSparseV2<idxType, dataType>::Reduce()
+{
+    InitReduceTables();
+    for (uint64_t cc = 0; cc < colLoop; cc++) {
+        int64_t colStart = cc * colLen;
+        int64_t colNum = (cc == colLoop - 1) ? colTail : colLen;
+        segCursor = 0;
+        startCursor = 0;
+        carryValid = false;
+        for (int64_t a = rowBegin; a < rowEnd; a += rowTile) {
+            int64_t rows = MinLen(rowTile, rowEnd - a);
+            ReduceTile(a, rows, colStart, colNum, cc == 0);
+        }
+    }
+}
+
+template <typename idxType, typename dataType>
+__aicore__ inline void KernelCoalesceSparseV2<idxType, dataType>::ReduceTile(
+    int64_t rowStart, int64_t rows, int64_t colStart, int64_t colNum, bool writeIndices)
+{
+    int64_t elemNum = rows * rowStride;
+    // 多算一行标记，第i + 1行的起点标记即第i行的结束标记
+    ComputeRunFlags(rowStart, rows + 1);
+    ArithProgression<int32_t>(curOff, static_cast<int32_t>(sizeof(float)), static_cast<int32_t>(sizeof(float)),
+                              rows);
+    PipeBarrier<PIPE_V>();
+    Gather(endF.ReinterpretCast<uint32_t>(), flagF.ReinterpretCast<uint32_t>(), curOff.ReinterpretCast<uint32_t>(),
+           0, rows);
+    SegmentIds(rows);
+
+    GlobalTensor<int32_t> permGm;
+    permGm.SetGlobalBuffer(ws.perm[fin]);
+    DataCopyExtParams copyParams {1, static_cast<uint32_t>(rows * sizeof(int32_t)), 0, 0, 0};
+    DataCopyPadExtParams<int32_t> padParams {false, 0, 0, 0};
+    DataCopyPad(permT, permGm[rowStart], copyParams, padParams);
+    PipeSync<HardEvent::MTE2_S>();
+    LoadRows(rows, colStart, colNum);
+    SegmentedScan(rows, elemNum);
+    WriteEnded(rows, elemNum, colStart, colNum);
+    if (writeIndices) {
+        WriteIndices(rows);
+    }
+}
+
+/*
+ * 按置换下标把各行value搬进UB，行与行之间不等待；
+ * 单次能放下整行时紧排成连续的元素序列，否则保持按32B对齐的行布局
+ */
+template <typename idxType, typename dataType>
+__aicore__ inline void KernelCoalesceSparseV2<idxType, dataType>::LoadRows(int64_t rows, int64_t colStart,
+                                                                          int64_t colNum)
+{
+    int64_t elemNum = rows * rowStride;
+    DataCopyExtParams copyParams {1, static_cast<uint32_t>(colNum * sizeof(dataType)), 0, 0, 0};
+    DataCopyPadExtParams<dataType> padParams {false, 0, 0, 0};
+    PipeSync<HardEvent::V_MTE2>();
+    for (int64_t r = 0; r < rows; r++) {
+        int64_t srcRow = permT.GetValue(r);
+        DataCopyPad(rowsBuf[r * colPad], valuesGm[srcRow * valueSize + colStart], copyParams, padParams);
+    }
+    PipeSync<HardEvent::MTE2_V>();
+
+    LocalTensor<accType> acc = accBuf[SCAN_PREFIX];
+    if constexpr (std::is_same<dataType, half>::value) {
+        LocalTensor<half> src = rowsBuf;
+        if (compact) {
+            Gather(outHalf.ReinterpretCast<uint16_t>(), rowsBuf.template ReinterpretCast<uint16_t>(), compactOff, 0,
+                   elemNum);
+            PipeBarrier<PIPE_V>();
+            src = outHalf;
+        }
+        Cast(acc, src, RoundMode::CAST_NONE, elemNum);
+    } else {
+        if (compact) {
+            Gather(acc.template ReinterpretCast<uint32_t>(), rowsBuf.template ReinterpretCast<uint32_t>(), compactOff,
+                   0, elemNum);
+        } else {
+            Adds(acc, rowsBuf, static_cast<accType>(0), elemNum);
+        }
+    }
+    PipeBarrier<PIPE_V>();
+    // 上一个tile末尾未结束的run延续到本tile第0行
+    if (carryValid) {
+        Add(acc, acc, carry, rowStride);
+        PipeBarrier<PIPE_V>();
+    }
+}
+
+/*
+ * 行内run编号 = 起点标记的包含前缀和，按log步长错位相加；错位越界的位置指向值为0的前缀
+ */
+template <typename idxType, typename dataType>
+__aicore__ inline void KernelCoalesceSparseV2<idxType, dataType>::SegmentIds(int64_t rows)
+{
+    LocalTensor<float> seg = segS[SCAN_PREFIX];
+    Adds(seg, flagF, 0.0f, rows);
+    PipeBarrier<PIPE_V>();
+    for (int64_t d = 1; d < rows; d <<= 1) {
+        ArithProgression<int32_t>(prevOff, static_cast<int32_t>((SCAN_PREFIX - d) * sizeof(float)),
+                                  static_cast<int32_t>(sizeof(float)), rows);
+        PipeBarrier<PIPE_V>();
+        Maxs(prevOff, prevOff, 0, rows);
+        PipeBarrier<PIPE_V>();
+        Gather(tmpC.ReinterpretCast<uint32_t>(), segS.ReinterpretCast<uint32_t>(),
+               prevOff.ReinterpretCast<uint32_t>(), 0, rows);
+        PipeBarrier<PIPE_V>();
+        Add(seg, seg, tmpC, rows);
+        PipeBarrier<PIPE_V>();
+    }
+}
+
+/*
+ * 分段包含扫描：第d步把d行之前且run编号相同的元素累加进来，log2(rows)步后每个run的末行即为该run之和
+ */
+template <typename idxType, typename dataType>
+__aicore__ inline void KernelCoalesceSparseV2<idxType, dataType>::SegmentedScan(int64_t rows, int64_t elemNum)
+{
+    int64_t cmpNum = CeilAlign(elemNum, FLOAT_REPEAT_NUM);
+    LocalTensor<accType> acc = accBuf[SCAN_PREFIX];
+    LocalTensor<float> elemSeg = elemE[SCAN_PREFIX];
+    if (rowStride == 1) {
+        Adds(elemSeg, segS[SCAN_PREFIX], 0.0f, rows);
+    } else {
+        Gather(elemSeg.ReinterpretCast<uint32_t>(), segS[SCAN_PREFIX].ReinterpretCast<uint32_t>(), rowOffTbl, 0,
+               elemNum);
+    }
+    PipeBarrier<PIPE_V>();
+    for (int64_t d = 1; d < rows; d <<= 1) {
+        int64_t shiftElem = d * rowStride;
+        ArithProgression<int32_t>(elemOff, static_cast<int32_t>((SCAN_PREFIX - shiftElem) * sizeof(float)),
+                                  static_cast<int32_t>(sizeof(float)), elemNum);
+        PipeBarrier<PIPE_V>();
+        Maxs(elemOff, elemOff, 0, elemNum);
+        PipeBarrier<PIPE_V>();
+        Gather(shAcc.template ReinterpretCast<uint32_t>(), accBuf.template ReinterpretCast<uint32_t>(),
+               elemOff.ReinterpretCast<uint32_t>(), 0, elemNum);
+        Gather(shE.ReinterpretCast<uint32_t>(), elemE.ReinterpretCast<uint32_t>(),
+               elemOff.ReinterpretCast<uint32_t>(), 0, elemNum);
+        PipeBarrier<PIPE_V>();
+        Compare(maskE, elemSeg, shE, CMPMODE::EQ, cmpNum);
+        PipeBarrier<PIPE_V>();
+        Select(shAcc.template ReinterpretCast<float>(), maskE, shAcc.template ReinterpretCast<float>(), 0.0f,
+               SELMODE::VSEL_TENSOR_SCALAR_MODE, cmpNum);
+        PipeBarrier<PIPE_V>();
+        Add(acc, acc, shAcc, elemNum);
+        PipeBarrier<PIPE_V>();
+    }
+}
+
+/*
+ * 取出本tile内结束的run，按输出行号顺序连续写出；末行未结束时留作下一tile的进位
+ */
+template <typename idxType, typename dataType>
+__aicore__ inline void KernelCoalesceSparseV2<idxType, dataType>::WriteEnded(int64_t rows, int64_t elemNum,
+                                                                            int64_t colStart, int64_t colNum)
+{
+    LocalTensor<accType> acc = accBuf[SCAN_PREFIX];
+    LocalTensor<float> endMask = endF;
+    if (rowStride > 1) {
+        Gather(endE.ReinterpretCast<uint32_t>(), endF.ReinterpretCast<uint32_t>(), rowOffTbl, 0, elemNum);
+        PipeBarrier<PIPE_V>();
+        endMask = endE;
+    }
+    CompareScalar(maskE, endMask, 1.0f, CMPMODE::EQ, CeilAlign(elemNum, FLOAT_REPEAT_NUM));
+    PipeBarrier<PIPE_V>();
+    uint64_t outNum = 0;
+    GatherMask(outBuf.template ReinterpretCast<uint32_t>(), acc.template ReinterpretCast<uint32_t>(),
+               maskE.ReinterpretCast<uint32_t>(), true, static_cast<uint32_t>(elemNum), {1, 1, 8, 8}, outNum);
+    int64_t endedRows = outNum / rowStride;
+
+    LocalTensor<dataType> out = outBuf.template ReinterpretCast<dataType>();
+    if constexpr (std::is_same<dataType, half>::value) {
+        PipeBarrier<PIPE_V>();
+        Cast(outHalf, outBuf, RoundMode::CAST_ROUND, outNum);
+        out = outHalf;
+    }
+    PipeSync<HardEvent::V_S>();
+    if (endedRows > 0) {
+        PipeSync<HardEvent::V_MTE3>();
+        int64_t dstRow = segBase + segCursor;
+        if (compact) {
+            DataCopyExtParams copyParams {1, static_cast<uint32_t>(outNum * sizeof(dataType)), 0, 0, 0};
+            DataCopyPad(newValuesGm[dstRow * valueSize], out, copyParams);
+        } else {
+            int64_t rowBytes = CeilAlign(colNum * sizeof(dataType), BLOCK_BYTES);
+            uint32_t srcStride = (rowStride * sizeof(dataType) - rowBytes) / BLOCK_BYTES;
+            DataCopyExtParams copyParams {static_cast<uint16_t>(endedRows),
+                                          static_cast<uint32_t>(colNum * sizeof(dataType)), srcStride,
+                                          static_cast<uint32_t>((valueSize - colNum) * sizeof(dataType)), 0};
+            DataCopyPad(newValuesGm[dstRow * valueSize + colStart], out, copyParams);
+        }
+        segCursor += endedRows;
+    }
+
+    carryValid = (endF.GetValue(rows - 1) == 0.0f);
+    if (carryValid) {
+        ArithProgression<int32_t>(elemOff,
+                                  static_cast<int32_t>((SCAN_PREFIX + (rows - 1) * rowStride) * sizeof(float)),
+                                  static_cast<int32_t>(sizeof(float)), rowStride);
+        PipeBarrier<PIPE_V>();
+        Gather(carry.template ReinterpretCast<uint32_t>(), accBuf.template ReinterpretCast<uint32_t>(),
+               elemOff.ReinterpretCast<uint32_t>(), 0, rowStride);
+    }
+    PipeSync<HardEvent::MTE3_V>();
+}
+
+/*
+ * 每个run输出其首行对应的原始下标，分批搬入后紧排，一次写出
+ */
+template <typename idxType, typename dataType>
+__aicore__ inline void KernelCoalesceSparseV2<idxType, dataType>::WriteIndices(int64_t rows)
+{
+    CompareScalar(maskE, flagF, 1.0f, CMPMODE::EQ, CeilAlign(rows, FLOAT_REPEAT_NUM));
+    PipeBarrier<PIPE_V>();
+    uint64_t startNum = 0;
+    GatherMask(startPerm, permT.ReinterpretCast<uint32_t>(), maskE.ReinterpretCast<uint32_t>(), true,
+               static_cast<uint32_t>(rows), {1, 1, 8, 8}, startNum);
+    PipeSync<HardEvent::V_S>();
+
+    int64_t rowBytes = m * sizeof(idxType);
+    int64_t idxWords = rowBytes / sizeof(uint32_t);
+    int64_t idxPad = CeilAlign(idxWords, INT32_BLOCK_NUM) * sizeof(uint32_t) / sizeof(idxType);
+    DataCopyExtParams rowParams {1, static_cast<uint32_t>(rowBytes), 0, 0, 0};
+    DataCopyPadExtParams<idxType> padParams {false, 0, 0, 0};
+    for (int64_t k0 = 0; k0 < static_cast<int64_t>(startNum); k0 += IDX_BATCH) {
+        int64_t batch = MinLen(IDX_BATCH, startNum - k0);
+        PipeSync<HardEvent::V_MTE2>();
+        for (int64_t k = 0; k < batch; k++) {
+            int64_t srcRow = startPerm.GetValue(k0 + k);
+            DataCopyPad(idxRows[k * idxPad], indicesGm[srcRow * m], rowParams, padParams);
+        }
+        PipeSync<HardEvent::MTE2_V>();
+        Gather(idxCompact.template ReinterpretCast<uint32_t>(), idxRows.template ReinterpretCast<uint32_t>(), idxOff,
+               0, batch * idxWords);
+        PipeSync<HardEvent::V_MTE3>();
+        DataCopyExtParams outParams {1, static_cast<uint32_t>(batch * rowBytes), 0, 0, 0};
+        DataCopyPad(newIndicesGm[(segBase + startCursor) * m], idxCompact, outParams);
+        PipeSync<HardEvent::MTE3_V>();
+        startCursor += batch;
+    }
+}
+} // namespace CoalesceSparseV2
+#endif // COALESCE_SPARSE_V2_H
@@ -0,0 +1,484 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file coalesce_sparse_v2_sort.h
+ */
+#ifndef COALESCE_SPARSE_V2_SORT_H
+#define COALESCE_SPARSE_V2_SORT_H
+
+#include "kernel_operator.h"
+
+namespace CoalesceSparseV2 {
+using namespace AscendC;
+
+constexpr int32_t MAX_SPARSE_DIM = 16;
+constexpr int32_t MAX_KEY_WORDS = 2;
+constexpr int32_t WORD_BITS = 32;
+constexpr int32_t RADIX_BITS = 8;
+constexpr int32_t RADIX_SIZE = 256;
+constexpr int32_t SORT_TILE = 2048;
+constexpr int32_t ONE_REPEAT_SORT_NUM = 32;
+constexpr int32_t FLOAT_REPEAT_NUM = 64;
+constexpr int32_t INT32_BLOCK_NUM = 8;
+constexpr int32_t BLOCK_BYTES = 32;
+constexpr int32_t PACK_TILE_BYTES = 32768;
+constexpr int32_t HIST_BATCH = 32;
+constexpr int32_t RUN_INFO_STRIDE = 8;
+constexpr float MIN_FP32 = -3.4e38;
+// 每个run在UB内按32B对齐摆放，最多浪费RADIX_SIZE个块
+constexpr int32_t RUN_SLOT_NUM = SORT_TILE + RADIX_SIZE * INT32_BLOCK_NUM;
+constexpr uint32_t UB_BUF_BYTES = 176 * 1024;
+
+template <HardEvent EVENT>
+__aicore__ inline void PipeSync()
+{
+    event_t eventId = static_cast<event_t>(GetTPipePtr()->FetchEventID(EVENT));
+    SetFlag<EVENT>(eventId);
+    WaitFlag<EVENT>(eventId);
+}
+
+__aicore__ inline int64_t CeilAlign(int64_t x, int64_t align)
+{
+    return (x + align - 1) / align * align;
+}
+
+__aicore__ inline int64_t MinLen(int64_t a, int64_t b)
+{
+    return a < b ? a : b;
+}
+
+/*
+ * 排序阶段workspace布局，key按32位拆成低/高两个平面，与置换下标各做乒乓双缓冲；
+ * hist存放每核每个digit的计数，runInfo存放每核run个数与首个run起点
+ */
+struct SortWorkspace {
+    __aicore__ inline void Init(GM_ADDR workspace, int64_t n, int64_t coreNum, int64_t keyWords)
+    {
+        int64_t nAlign = CeilAlign(n, SORT_TILE);
+        __gm__ int32_t *base = reinterpret_cast<__gm__ int32_t *>(workspace);
+        for (int64_t w = 0; w < MAX_KEY_WORDS; w++) {
+            for (int64_t b = 0; b < 2; b++) {
+                key[w][b] = base;
+                base += (w < keyWords) ? nAlign : 0;
+            }
+        }
+        for (int64_t b = 0; b < 2; b++) {
+            perm[b] = base;
+            base += nAlign;
+        }
+        hist = base;
+        base += coreNum * RADIX_SIZE;
+        runInfo = base;
+    }
+
+    __gm__ int32_t *key[MAX_KEY_WORDS][2];
+    __gm__ int32_t *perm[2];
+    __gm__ int32_t *hist;
+    __gm__ int32_t *runInfo;
+};
+
+struct SortParam {
+    int64_t n;
+    int64_t m;
+    int64_t coreNum;
+    int64_t coreStart;
+    int64_t coreLen;
+    int64_t keyWords;
+    int64_t passNum;
+    int64_t fieldShift[MAX_SPARSE_DIM];
+    int64_t fieldBits[MAX_SPARSE_DIM];
+};
+
+/*
+ * 对打包后的key做多核LSD基数排序，每趟取RADIX_BITS位作为digit。
+ * 核内以SORT_TILE为单位用Sort指令按digit稳定排序，Sort对相同score按下标先后输出，
+ * 与核间按核号前缀求和得到的桶起点一起保证整趟排序稳定；同一digit在tile内连续，
+ * 每个run只需一次搬出。
+ */
+template <typename idxType>
+class KeyRadixSort {
+public:
+    __aicore__ inline KeyRadixSort() = default;
+    __aicore__ inline void Init(GM_ADDR indices, const SortWorkspace &ws, const SortParam &param,
+                                const LocalTensor<uint8_t> &ubBuf);
+    // 返回排序结果所在的乒乓缓冲下标
+    __aicore__ inline int64_t Process();
+
+private:
+    __aicore__ inline void PackKeys();
+    __aicore__ inline void CountDigits(int64_t pass);
+    __aicore__ inline void PrefixBuckets();
+    __aicore__ inline void ScatterRuns(int64_t pass);
+    __aicore__ inline int64_t SortTileByDigit(int64_t pass, int64_t offset, int64_t len);
+    __aicore__ inline void LoadPlane(const LocalTensor<int32_t> &dst, __gm__ int32_t *src, int64_t offset,
+                                     int64_t len);
+    __aicore__ inline void StorePlane(__gm__ int32_t *dst, const LocalTensor<int32_t> &src, int64_t len);
+
+private:
+    GlobalTensor<idxType> indicesGm;
+    GlobalTensor<int32_t> histGm;
+    SortWorkspace ws;
+    SortParam param;
+    int64_t src {0};
+
+    LocalTensor<float> score;
+    LocalTensor<uint32_t> idxConst;
+    LocalTensor<float> sortBuf;
+    LocalTensor<float> sortTmp;
+    LocalTensor<float> sortedScore;
+    LocalTensor<uint32_t> sortedIdx;
+    LocalTensor<float> nextScore;
+    LocalTensor<uint8_t> mask;
+    LocalTensor<uint32_t> endConst;
+    LocalTensor<uint32_t> runEnd;
+    LocalTensor<uint32_t> shift1Const;
+    LocalTensor<int32_t> srcTbl;
+    LocalTensor<uint32_t> alignedOff;
+    LocalTensor<int32_t> plane;
+    LocalTensor<int32_t> planeOut;
+    LocalTensor<int32_t> histLocal;
+    LocalTensor<int32_t> baseLocal;
+    LocalTensor<int32_t> runTab;
+};
+
+template <typename idxType>
+__aicore__ inline void KeyRadixSort<idxType>::Init(GM_ADDR indices, const SortWorkspace &ws,
+                                                   const SortParam &param, const LocalTensor<uint8_t> &ubBuf)
+{
+    this->ws = ws;
+    this->param = param;
+    indicesGm.SetGlobalBuffer((__gm__ idxType *)indices);
+    histGm.SetGlobalBuffer(ws.hist);
+
+    constexpr uint32_t tileBytes = SORT_TILE * sizeof(float);
+    constexpr uint32_t slackBytes = FLOAT_REPEAT_NUM * sizeof(float);
+    constexpr uint32_t slotBytes = RUN_SLOT_NUM * sizeof(int32_t);
+    uint32_t offset = 0;
+    score = ubBuf[offset].ReinterpretCast<float>();
+    offset += tileBytes;
+    idxConst = ubBuf[offset].ReinterpretCast<uint32_t>();
+    offset += tileBytes;
+    sortBuf = ubBuf[offset].ReinterpretCast<float>();
+    offset += tileBytes * 2;
+    sortTmp = ubBuf[offset].ReinterpretCast<float>();
+    offset += tileBytes * 2;
+    sortedScore = ubBuf[offset].ReinterpretCast<float>();
+    offset += tileBytes + slackBytes;
+    sortedIdx = ubBuf[offset].ReinterpretCast<uint32_t>();
+    offset += tileBytes;
+    nextScore = ubBuf[offset].ReinterpretCast<float>();
+    offset += tileBytes + slackBytes;
+    mask = ubBuf[offset];
+    offset += SORT_TILE / 2;
+    endConst = ubBuf[offset].ReinterpretCast<uint32_t>();
+    offset += tileBytes;
+    runEnd = ubBuf[offset].ReinterpretCast<uint32_t>();
+    offset += tileBytes;
+    shift1Const = ubBuf[offset].ReinterpretCast<uint32_t>();
+    offset += tileBytes;
+    srcTbl = ubBuf[offset].ReinterpretCast<int32_t>();
+    offset += slotBytes;
+    alignedOff = ubBuf[offset].ReinterpretCast<uint32_t>();
+    offset += slotBytes;
+    plane = ubBuf[offset].ReinterpretCast<int32_t>();
+    offset += tileBytes;
+    planeOut = ubBuf[offset].ReinterpretCast<int32_t>();
+    offset += slotBytes;
+    histLocal = ubBuf[offset].ReinterpretCast<int32_t>();
+    offset += RADIX_SIZE * sizeof(int32_t);
+    baseLocal = ubBuf[offset].ReinterpretCast<int32_t>();
+    offset += RADIX_SIZE * sizeof(int32_t);
+    runTab = ubBuf[offset].ReinterpretCast<int32_t>();
+
+    // Sort的下标、run结束位置和错位一格的偏移在各趟之间不变，只生成一次
+    ArithProgression<int32_t>(idxConst.ReinterpretCast<int32_t>(), 0, 1, SORT_TILE);
+    ArithProgression<int32_t>(endConst.ReinterpretCast<int32_t>(), 1, 1, SORT_TILE);
+    ArithProgression<int32_t>(shift1Const.ReinterpretCast<int32_t>(), static_cast<int32_t>(sizeof(float)),
+                              static_cast<int32_t>(sizeof(float)), SORT_TILE);
+}
+
+template <typename idxType>
+__aicore__ inline int64_t KeyRadixSort<idxType>::Process()
+{
+    if (param.coreLen > 0) {
+        PackKeys();
+    }
+    SyncAll();
+    src = 0;
+    for (int64_t pass = 0; pass < param.passNum; pass++) {
+        CountDigits(pass);
+        SyncAll();
+        PrefixBuckets();
+        ScatterRuns(pass);
+        SyncAll();
+        src = 1 - src;
+    }
+    return src;
+}
+
+template <typename idxType>
+__aicore__ inline void KeyRadixSort<idxType>::LoadPlane(const LocalTensor<int32_t> &dst, __gm__ int32_t *srcAddr,
+                                                        int64_t offset, int64_t len)
+{
+    GlobalTensor<int32_t> srcGm;
+    srcGm.SetGlobalBuffer(srcAddr + offset);
+    DataCopyExtParams copyParams {1, static_cast<uint32_t>(len * sizeof(int32_t)), 0, 0, 0};
+    DataCopyPadExtParams<int32_t> padParams {false, 0, 0, 0};
+    DataCopyPad(dst, srcGm, copyParams, padParams);
+}
+
+template <typename idxType>
+__aicore__ inline void KeyRadixSort<idxType>::StorePlane(__gm__ int32_t *dst, const LocalTensor<int32_t> &srcLocal,
+                                                         int64_t len)
+{
+    GlobalTensor<int32_t> dstGm;
+    dstGm.SetGlobalBuffer(dst);
+    DataCopyExtParams copyParams {1, static_cast<uint32_t>(len * sizeof(int32_t)), 0, 0, 0};
+    DataCopyPad(dstGm, srcLocal, copyParams);
+}
+
+/*
+ * 各稀疏维按位宽依次拼成最多64位的key，高位在前，按key排序与按展平下标排序一致。
+ * 每个字段不跨出自身位宽，拼接可以用移位加代替按位或，全部是32位整型向量运算。
+ */
+template <typename idxType>
+__aicore__ inline void KeyRadixSort<idxType>::PackKeys()
+{
+    constexpr int32_t idxBytes = sizeof(idxType);
+    int64_t rowBytes = param.m * idxBytes;
+    int64_t packRows = MinLen(SORT_TILE, PACK_TILE_BYTES / rowBytes / INT32_BLOCK_NUM * INT32_BLOCK_NUM);
+    LocalTensor<idxType> idxTile = sortBuf.ReinterpretCast<idxType>();
+    LocalTensor<uint32_t> col = score.ReinterpretCast<uint32_t>();
+    LocalTensor<uint32_t> tmp = nextScore.ReinterpretCast<uint32_t>();
+    LocalTensor<int32_t> lo = plane;
+    LocalTensor<int32_t> hi = planeOut;
+    LocalTensor<int32_t> permTile = srcTbl;
+    LocalTensor<int32_t> colOff = alignedOff.ReinterpretCast<int32_t>();
+
+    for (int64_t r0 = 0; r0 < param.coreLen; r0 += packRows) {
+        int64_t rows = MinLen(packRows, param.coreLen - r0);
+        int64_t gmRow = param.coreStart + r0;
+        DataCopyExtParams copyParams {1, static_cast<uint32_t>(rows * rowBytes), 0, 0, 0};
+        DataCopyPadExtParams<idxType> padParams {false, 0, 0, 0};
+        DataCopyPad(idxTile, indicesGm[gmRow * param.m], copyParams, padParams);
+        PipeSync<HardEvent::MTE2_V>();
+
+        Duplicate(lo, 0, rows);
+        Duplicate(hi, 0, rows);
+        for (int64_t d = 0; d < param.m; d++) {
+            int64_t bits = param.fieldBits[d];
+            if (bits == 0) {
+                continue;
+            }
+            int64_t shift = param.fieldShift[d];
+            // int64下标只取低32位，位宽已保证每个字段小于2^31
+            ArithProgression<int32_t>(colOff, static_cast<int32_t>(d * idxBytes), static_cast<int32_t>(rowBytes),
+                                      rows);
+            PipeBarrier<PIPE_V>();
+            Gather(col, idxTile.template ReinterpretCast<uint32_t>(), colOff.ReinterpretCast<uint32_t>(), 0, rows);
+            PipeBarrier<PIPE_V>();
+            if (shift >= WORD_BITS) {
+                ShiftLeft(tmp, col, static_cast<uint32_t>(shift - WORD_BITS), rows);
+                PipeBarrier<PIPE_V>();
+                Add(hi, hi, tmp.ReinterpretCast<int32_t>(), rows);
+            } else {
+                ShiftLeft(tmp, col, static_cast<uint32_t>(shift), rows);
+                PipeBarrier<PIPE_V>();
+                Add(lo, lo, tmp.ReinterpretCast<int32_t>(), rows);
+                if (shift + bits > WORD_BITS) {
+                    PipeBarrier<PIPE_V>();
+                    ShiftRight(tmp, col, static_cast<uint32_t>(WORD_BITS - shift), rows);
+                    PipeBarrier<PIPE_V>();
+                    Add(hi, hi, tmp.ReinterpretCast<int32_t>(), rows);
+                }
+            }
+            PipeBarrier<PIPE_V>();
+        }
+        ArithProgression<int32_t>(permTile, static_cast<int32_t>(gmRow), 1, rows);
+        PipeSync<HardEvent::V_MTE3>();
+        StorePlane(ws.key[0][0] + gmRow, lo, rows);
+        if (param.keyWords > 1) {
+            StorePlane(ws.key[1][0] + gmRow, hi, rows);
+        }
+        StorePlane(ws.perm[0] + gmRow, permTile, rows);
+        PipeSync<HardEvent::MTE3_MTE2>();
+        PipeSync<HardEvent::MTE3_V>();
+    }
+}
+
+/*
+ * 取出当前趟的digit并在tile内稳定排序，再找出相邻digit不同的位置得到各run的结束下标。
+ * 返回run个数，runEnd保存各run的结束位置，sortedScore保存取负后的digit。
+ */
+template <typename idxType>
+__aicore__ inline int64_t KeyRadixSort<idxType>::SortTileByDigit(int64_t pass, int64_t offset, int64_t len)
+{
+    int64_t bitPos = pass * RADIX_BITS;
+    int64_t word = bitPos / WORD_BITS;
+    int64_t shift = bitPos % WORD_BITS;
+    int64_t sortNum = CeilAlign(len, ONE_REPEAT_SORT_NUM);
+    int64_t cmpNum = CeilAlign(sortNum, FLOAT_REPEAT_NUM);
+    LocalTensor<uint32_t> digit = plane.ReinterpretCast<uint32_t>();
+
+    LoadPlane(plane, ws.key[word][src], offset, len);
+    Duplicate(score, MIN_FP32, static_cast<int32_t>(sortNum));
+    PipeSync<HardEvent::MTE2_V>();
+    ShiftLeft(digit, digit, static_cast<uint32_t>(WORD_BITS - RADIX_BITS - shift), len);
+    PipeBarrier<PIPE_V>();
+    ShiftRight(digit, digit, static_cast<uint32_t>(WORD_BITS - RADIX_BITS), len);
+    PipeBarrier<PIPE_V>();
+    // Sort按降序输出，取负后相当于digit升序，补齐部分用MIN_FP32排到最后
+    Cast(score, digit.ReinterpretCast<int32_t>(), RoundMode::CAST_NONE, len);
+    PipeBarrier<PIPE_V>();
+    Muls(score, score, static_cast<float>(-1), len);
+    PipeBarrier<PIPE_V>();
+
+    LocalTensor<float> concatLocal;
+    Concat(concatLocal, score, sortTmp, sortNum / ONE_REPEAT_SORT_NUM);
+    PipeBarrier<PIPE_V>();
+    Sort<float, true>(sortBuf, concatLocal, idxConst, sortTmp, sortNum / ONE_REPEAT_SORT_NUM);
+    PipeBarrier<PIPE_V>();
+    Extract(sortedScore, sortedIdx, sortBuf, sortNum / ONE_REPEAT_SORT_NUM);
+    PipeBarrier<PIPE_V>();
+    Duplicate(sortedScore[sortNum], MIN_FP32, INT32_BLOCK_NUM);
+    PipeBarrier<PIPE_V>();
+
+    // run的结束位置即排序后相邻digit不同处，最后一个有效元素之后是补齐值，一定不同
+    Gather(nextScore.ReinterpretCast<uint32_t>(), sortedScore.ReinterpretCast<uint32_t>(), shift1Const, 0,
+           sortNum);
+    PipeBarrier<PIPE_V>();
+    Compare(mask, sortedScore, nextScore, CMPMODE::NE, cmpNum);
+    PipeBarrier<PIPE_V>();
+    uint64_t runNum = 0;
+    GatherMask(runEnd, endConst, mask.ReinterpretCast<uint32_t>(), true, static_cast<uint32_t>(len),
+               {1, 1, 8, 8}, runNum);
+    PipeSync<HardEvent::V_S>();
+    return static_cast<int64_t>(runNum);
+}
+
+template <typename idxType>
+__aicore__ inline void KeyRadixSort<idxType>::CountDigits(int64_t pass)
+{
+    Duplicate(histLocal, 0, RADIX_SIZE);
+    PipeSync<HardEvent::V_S>();
+    for (int64_t t0 = 0; t0 < param.coreLen; t0 += SORT_TILE) {
+        int64_t len = MinLen(SORT_TILE, param.coreLen - t0);
+        int64_t runNum = SortTileByDigit(pass, param.coreStart + t0, len);
+        int64_t start = 0;
+        for (int64_t j = 0; j < runNum; j++) {
+            int64_t end = runEnd.GetValue(j);
+            int32_t d = static_cast<int32_t>(-sortedScore.GetValue(end - 1));
+            histLocal.SetValue(d, histLocal.GetValue(d) + static_cast<int32_t>(end - start));
+            start = end;
+        }
+        PipeSync<HardEvent::S_V>();
+        PipeSync<HardEvent::S_MTE2>();
+    }
+    PipeSync<HardEvent::S_MTE3>();
+    DataCopy(histGm[GetBlockIdx() * RADIX_SIZE], histLocal, RADIX_SIZE);
+    PipeSync<HardEvent::MTE3_V>();
+}
+
+/*
+ * 桶起点 = 所有核中更小digit的总数 + 本核之前各核同digit的个数
+ */
+template <typename idxType>
+__aicore__ inline void KeyRadixSort<idxType>::PrefixBuckets()
+{
+    LocalTensor<int32_t> histAll = sortBuf.ReinterpretCast<int32_t>();
+    LocalTensor<int32_t> total = srcTbl;
+    LocalTensor<int32_t> before = alignedOff.ReinterpretCast<int32_t>();
+    int64_t coreIdx = GetBlockIdx();
+    Duplicate(total, 0, RADIX_SIZE);
+    Duplicate(before, 0, RADIX_SIZE);
+    for (int64_t c0 = 0; c0 < param.coreNum; c0 += HIST_BATCH) {
+        int64_t cnt = MinLen(HIST_BATCH, param.coreNum - c0);
+        PipeSync<HardEvent::V_MTE2>();
+        DataCopy(histAll, histGm[c0 * RADIX_SIZE], cnt * RADIX_SIZE);
+        PipeSync<HardEvent::MTE2_V>();
+        for (int64_t c = 0; c < cnt; c++) {
+            Add(total, total, histAll[c * RADIX_SIZE], RADIX_SIZE);
+            if (c0 + c < coreIdx) {
+                Add(before, before, histAll[c * RADIX_SIZE], RADIX_SIZE);
+            }
+            PipeBarrier<PIPE_V>();
+        }
+    }
+    PipeSync<HardEvent::V_S>();
+    int32_t run = 0;
+    for (int32_t b = 0; b < RADIX_SIZE; b++) {
+        baseLocal.SetValue(b, run + before.GetValue(b));
+        run += total.GetValue(b);
+    }
+}
+
+template <typename idxType>
+__aicore__ inline void KeyRadixSort<idxType>::ScatterRuns(int64_t pass)
+{
+    constexpr int32_t tabDigit = 0;
+    constexpr int32_t tabLen = RADIX_SIZE;
+    constexpr int32_t tabSlot = RADIX_SIZE * 2;
+    constexpr int32_t tabDst = RADIX_SIZE * 3;
+    int64_t dst = 1 - src;
+    __gm__ int32_t *srcPlanes[MAX_KEY_WORDS + 1] = {ws.key[0][src], ws.key[1][src], ws.perm[src]};
+    __gm__ int32_t *dstPlanes[MAX_KEY_WORDS + 1] = {ws.key[0][dst], ws.key[1][dst], ws.perm[dst]};
+
+    for (int64_t t0 = 0; t0 < param.coreLen; t0 += SORT_TILE) {
+        int64_t len = MinLen(SORT_TILE, param.coreLen - t0);
+        int64_t offset = param.coreStart + t0;
+        int64_t runNum = SortTileByDigit(pass, offset, len);
+
+        // 每个run在UB内占一段32B对齐的槽位，槽位内按排序后的顺序指向原tile位置
+        PipeSync<HardEvent::S_V>();
+        Duplicate(srcTbl, 0, RUN_SLOT_NUM);
+        PipeBarrier<PIPE_V>();
+        int64_t start = 0;
+        int64_t slot = 0;
+        for (int64_t j = 0; j < runNum; j++) {
+            int64_t end = runEnd.GetValue(j);
+            int32_t d = static_cast<int32_t>(-sortedScore.GetValue(end - 1));
+            int32_t runLen = static_cast<int32_t>(end - start);
+            int32_t dstPos = baseLocal.GetValue(d);
+            ArithProgression<int32_t>(srcTbl[slot], static_cast<int32_t>(start * sizeof(uint32_t)),
+                                      static_cast<int32_t>(sizeof(uint32_t)), runLen);
+            runTab.SetValue(tabDigit + j, d);
+            runTab.SetValue(tabLen + j, runLen);
+            runTab.SetValue(tabSlot + j, static_cast<int32_t>(slot));
+            runTab.SetValue(tabDst + j, dstPos);
+            baseLocal.SetValue(d, dstPos + runLen);
+            start = end;
+            slot += CeilAlign(runLen, INT32_BLOCK_NUM);
+        }
+        PipeBarrier<PIPE_V>();
+        Gather(alignedOff, sortedIdx, srcTbl.ReinterpretCast<uint32_t>(), 0, slot);
+        PipeBarrier<PIPE_V>();
+        ShiftLeft(alignedOff, alignedOff, static_cast<uint32_t>(2), slot);
+
+        for (int64_t p = 0; p < MAX_KEY_WORDS + 1; p++) {
+            if (p > 0 && p < MAX_KEY_WORDS && p >= param.keyWords) {
+                continue;
+            }
+            PipeSync<HardEvent::V_MTE2>();
+            LoadPlane(plane, srcPlanes[p], offset, len);
+            PipeSync<HardEvent::MTE2_V>();
+            Gather(planeOut.ReinterpretCast<uint32_t>(), plane.ReinterpretCast<uint32_t>(), alignedOff, 0, slot);
+            PipeSync<HardEvent::V_MTE3>();
+            for (int64_t j = 0; j < runNum; j++) {
+                StorePlane(dstPlanes[p] + runTab.GetValue(tabDst + j), planeOut[runTab.GetValue(tabSlot + j)],
+                           runTab.GetValue(tabLen + j));
+            }
+            PipeSync<HardEvent::MTE3_V>();
+        }
+        PipeSync<HardEvent::MTE3_MTE2>();
+    }
+}
+} // namespace CoalesceSparseV2
+#endif // COALESCE_SPARSE_V2_SORT_H
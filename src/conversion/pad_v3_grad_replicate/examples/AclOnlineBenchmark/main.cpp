@@ -0,0 +1,284 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * \file main.cpp
+ * \brief
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "acl/acl.h"
+#include "acl/acl_op_compiler.h"
+
+#define SUCCESS 0
+#define FAILED 1
+
+#define INFO_LOG(fmt, args...) fprintf(stdout, "[INFO]  " fmt "\n", ##args)
+#define ERROR_LOG(fmt, args...) fprintf(stderr, "[ERROR]  " fmt "\n", ##args)
+
+#define CHECK_RET(cond, return_expr) \
+    do {                             \
+        if (!(cond)) {               \
+            return_expr;             \
+        }                            \
+    } while (0)
+
+namespace {
+constexpr int32_t WARMUP_NUM = 5;
+constexpr int32_t DEFAULT_LOOP_NUM = 50;
+constexpr size_t DIM_H = 2;
+constexpr size_t DIM_W = 3;
+constexpr size_t PAD_LEFT = 0;
+constexpr size_t PAD_RIGHT = 1;
+constexpr size_t PAD_TOP = 2;
+constexpr size_t PAD_BOTTOM = 3;
+constexpr int32_t PATTERN_NUM = 3;
+// 0.25、0.5、1.0在float32/float16/bfloat16下的位模式，少量相加结果精确，两条路径的输出应逐字节一致
+constexpr float PATTERN_FP32[PATTERN_NUM] = {0.25f, 0.5f, 1.0f};
+constexpr uint16_t PATTERN_FP16[PATTERN_NUM] = {0x3400, 0x3800, 0x3C00};
+constexpr uint16_t PATTERN_BF16[PATTERN_NUM] = {0x3E80, 0x3F00, 0x3F80};
+
+struct BenchCase {
+    const char *name;
+    std::vector<int64_t> selfShape;  // NCHW，未填充一侧
+    std::vector<int64_t> padding;    // left, right, top, bottom
+};
+
+// 一次调用PadV3GradReplicate所需的shape与paddings（按维成对排列）
+struct OpShape {
+    std::vector<int64_t> xShape;
+    std::vector<int64_t> yShape;
+    std::vector<int64_t> paddings;
+};
+
+struct RunResult {
+    double avgUs = 0.0;
+    std::vector<uint8_t> output;
+};
+
+int64_t GetShapeSize(const std::vector<int64_t> &shape)
+{
+    int64_t shapeSize = 1;
+    for (auto i : shape) {
+        shapeSize *= i;
+    }
+    return shapeSize;
+}
+
+// 4维NCHW满足特化kernel的条件；前面补一个长度为1的维度后tiling改走N维填充引擎，
+// 引擎求解时会丢弃长度为1的维度，两者处理的是同一个问题
+OpShape GetOpShape(const BenchCase &benchCase, bool engine)
+{
+    OpShape opShape;
+    opShape.yShape = benchCase.selfShape;
+    opShape.xShape = benchCase.selfShape;
+    opShape.xShape[DIM_H] += benchCase.padding[PAD_TOP] + benchCase.padding[PAD_BOTTOM];
+    opShape.xShape[DIM_W] += benchCase.padding[PAD_LEFT] + benchCase.padding[PAD_RIGHT];
+    opShape.paddings = {0, 0, 0, 0, benchCase.padding[PAD_TOP], benchCase.padding[PAD_BOTTOM],
+                        benchCase.padding[PAD_LEFT], benchCase.padding[PAD_RIGHT]};
+    if (engine) {
+        opShape.xShape.insert(opShape.xShape.begin(), 1);
+        opShape.yShape.insert(opShape.yShape.begin(), 1);
+        opShape.paddings.insert(opShape.paddings.begin(), {0, 0});
+    }
+    return opShape;
+}
+
+void FillPattern(std::vector<uint8_t> &hostData, aclDataType dataType)
+{
+    if (dataType == ACL_FLOAT) {
+        float *data = reinterpret_cast<float *>(hostData.data());
+        for (size_t i = 0; i < hostData.size() / sizeof(float); i++) {
+            data[i] = PATTERN_FP32[i % PATTERN_NUM];
+        }
+        return;
+    }
+    const uint16_t *pattern = dataType == ACL_FLOAT16 ? PATTERN_FP16 : PATTERN_BF16;
+    uint16_t *data = reinterpret_cast<uint16_t *>(hostData.data());
+    for (size_t i = 0; i < hostData.size() / sizeof(uint16_t); i++) {
+        data[i] = pattern[i % PATTERN_NUM];
+    }
+}
+
+int RunPath(const OpShape &opShape, aclDataType dataType, size_t dtypeSize, const std::vector<uint8_t> &hostInput,
+            int32_t loopNum, aclrtStream stream, RunResult &result)
+{
+    size_t xSize = GetShapeSize(opShape.xShape) * dtypeSize;
+    size_t ySize = GetShapeSize(opShape.yShape) * dtypeSize;
+    size_t padSize = opShape.paddings.size() * sizeof(int64_t);
+    void *xDeviceAddr = nullptr;
+    void *padDeviceAddr = nullptr;
+    void *yDeviceAddr = nullptr;
+    auto ret = aclrtMalloc(&xDeviceAddr, xSize, ACL_MEM_MALLOC_HUGE_FIRST);
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("aclrtMalloc failed. ERROR: %d", ret); return FAILED);
+    ret = aclrtMalloc(&padDeviceAddr, padSize, ACL_MEM_MALLOC_HUGE_FIRST);
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("aclrtMalloc failed. ERROR: %d", ret); return FAILED);
+    ret = aclrtMalloc(&yDeviceAddr, ySize, ACL_MEM_MALLOC_HUGE_FIRST);
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("aclrtMalloc failed. ERROR: %d", ret); return FAILED);
+    ret = aclrtMemcpy(xDeviceAddr, xSize, hostInput.data(), xSize, ACL_MEMCPY_HOST_TO_DEVICE);
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("aclrtMemcpy failed. ERROR: %d", ret); return FAILED);
+    ret = aclrtMemcpy(padDeviceAddr, padSize, opShape.paddings.data(), padSize, ACL_MEMCPY_HOST_TO_DEVICE);
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("aclrtMemcpy failed. ERROR: %d", ret); return FAILED);
+
+    // tiling依赖paddings的值，需设置为常量
+    std::vector<int64_t> padShape = {static_cast<int64_t>(opShape.paddings.size())};
+    aclTensorDesc *inputDesc[2] = {
+        aclCreateTensorDesc(dataType, opShape.xShape.size(), opShape.xShape.data(), ACL_FORMAT_ND),
+        aclCreateTensorDesc(ACL_INT64, padShape.size(), padShape.data(), ACL_FORMAT_ND)};
+    aclSetTensorConst(inputDesc[1], const_cast<int64_t *>(opShape.paddings.data()), padSize);
+    aclTensorDesc *outputDesc[1] = {
+        aclCreateTensorDesc(dataType, opShape.yShape.size(), opShape.yShape.data(), ACL_FORMAT_ND)};
+    aclDataBuffer *inputs[2] = {aclCreateDataBuffer(xDeviceAddr, xSize), aclCreateDataBuffer(padDeviceAddr, padSize)};
+    aclDataBuffer *outputs[1] = {aclCreateDataBuffer(yDeviceAddr, ySize)};
+    aclopAttr *attr = aclopCreateAttr();
+    aclopSetAttrString(attr, "mode", "edge");
+    aclopSetAttrBool(attr, "paddings_contiguous", 1);
+
+    auto launch = [&]() {
+        return aclopCompileAndExecuteV2("PadV3GradReplicate", 2, inputDesc, inputs, 1, outputDesc, outputs, attr,
+                                        ACL_ENGINE_SYS, ACL_COMPILE_SYS, nullptr, stream);
+    };
+    // 首次调用包含编译，计入预热
+    for (int32_t i = 0; i < WARMUP_NUM && ret == ACL_SUCCESS; i++) {
+        ret = launch();
+    }
+    aclrtEvent start = nullptr;
+    aclrtEvent end = nullptr;
+    aclrtCreateEvent(&start);
+    aclrtCreateEvent(&end);
+    aclrtSynchronizeStream(stream);
+    aclrtRecordEvent(start, stream);
+    for (int32_t i = 0; i < loopNum && ret == ACL_SUCCESS; i++) {
+        ret = launch();
+    }
+    aclrtRecordEvent(end, stream);
+    aclrtSynchronizeStream(stream);
+
+    int status = SUCCESS;
+    if (ret != ACL_SUCCESS) {
+        ERROR_LOG("aclopCompileAndExecuteV2 failed. ERROR: %d", ret);
+        status = FAILED;
+    } else {
+        float costMs = 0.0f;
+        aclrtEventElapsedTime(&costMs, start, end);
+        result.avgUs = costMs * 1000.0 / loopNum;
+        result.output.resize(ySize);
+        ret = aclrtMemcpy(result.output.data(), ySize, yDeviceAddr, ySize, ACL_MEMCPY_DEVICE_TO_HOST);
+        status = ret == ACL_SUCCESS ? SUCCESS : FAILED;
+    }
+
+    aclrtDestroyEvent(start);
+    aclrtDestroyEvent(end);
+    aclopDestroyAttr(attr);
+    for (auto *buffer : inputs) {
+        aclDestroyDataBuffer(buffer);
+    }
+    aclDestroyDataBuffer(outputs[0]);
+    for (auto *desc : inputDesc) {
+        aclDestroyTensorDesc(desc);
+    }
+    aclDestroyTensorDesc(outputDesc[0]);
+    aclrtFree(xDeviceAddr);
+    aclrtFree(padDeviceAddr);
+    aclrtFree(yDeviceAddr);
+    return status;
+}
+
+int RunCase(const BenchCase &benchCase, aclDataType dataType, size_t dtypeSize, int32_t loopNum, aclrtStream stream)
+{
+    OpShape specShape = GetOpShape(benchCase, false);
+    OpShape engineShape = GetOpShape(benchCase, true);
+    std::vector<uint8_t> hostInput(GetShapeSize(specShape.xShape) * dtypeSize);
+    FillPattern(hostInput, dataType);
+
+    RunResult specResult;
+    RunResult engineResult;
+    CHECK_RET(RunPath(specShape, dataType, dtypeSize, hostInput, loopNum, stream, specResult) == SUCCESS,
+              ERROR_LOG("%s specialized path failed", benchCase.name);
+              return FAILED);
+    CHECK_RET(RunPath(engineShape, dataType, dtypeSize, hostInput, loopNum, stream, engineResult) == SUCCESS,
+              ERROR_LOG("%s engine path failed", benchCase.name);
+              return FAILED);
+    bool match = specResult.output == engineResult.output;
+
+    // 按读入gradOutput和写出gradInput各一次估算带宽
+    double bytes = static_cast<double>(GetShapeSize(specShape.xShape) + GetShapeSize(specShape.yShape)) * dtypeSize;
+    printf("%-16s %4ld %4ld %5ld %5ld %2ld %2ld %2ld %2ld %10.2f %8.2f %10.2f %8.2f %6.3f %5s\n", benchCase.name,
+           benchCase.selfShape[0], benchCase.selfShape[1], benchCase.selfShape[DIM_H], benchCase.selfShape[DIM_W],
+           benchCase.padding[PAD_LEFT], benchCase.padding[PAD_RIGHT], benchCase.padding[PAD_TOP],
+           benchCase.padding[PAD_BOTTOM], specResult.avgUs, bytes / specResult.avgUs / 1000.0, engineResult.avgUs,
+           bytes / engineResult.avgUs / 1000.0, engineResult.avgUs / specResult.avgUs, match ? "yes" : "NO");
+    return match ? SUCCESS : FAILED;
+}
+}  // namespace
+
+int main(int argc, char **argv)
+{
+    std::string dtype = argc > 1 ? argv[1] : "float32";
+    int32_t loopNum = argc > 2 ? atoi(argv[2]) : DEFAULT_LOOP_NUM;
+    CHECK_RET(loopNum > 0, ERROR_LOG("loop num should be positive, got %d", loopNum); return FAILED);
+    aclDataType dataType = ACL_FLOAT;
+    size_t dtypeSize = 4;
+    if (dtype == "float16") {
+        dataType = ACL_FLOAT16;
+        dtypeSize = 2;
+    } else if (dtype == "bfloat16") {
+        dataType = ACL_BF16;
+        dtypeSize = 2;
+    } else if (dtype != "float32") {
+        ERROR_LOG("unsupported dtype %s", dtype.c_str());
+        return FAILED;
+    }
+
+    int32_t deviceId = 0;
+    aclrtStream stream;
+    auto ret = aclInit(nullptr);
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("aclInit failed. ERROR: %d", ret); return FAILED);
+    ret = aclrtSetDevice(deviceId);
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("aclrtSetDevice failed. ERROR: %d", ret); return FAILED);
+    ret = aclrtCreateStream(&stream);
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("aclrtCreateStream failed. ERROR: %d", ret); return FAILED);
+
+    // 依次覆盖特化kernel的W填充、H填充、小shape、小H大W、大H小W、大shape分支；填充量不超过7，bf16特化kernel也支持
+    const std::vector<BenchCase> cases = {
+        {"w_pad_small_w", {16, 64, 56, 56}, {1, 1, 0, 0}},
+        {"w_pad_large_w", {8, 32, 64, 1024}, {3, 3, 0, 0}},
+        {"h_pad", {16, 64, 56, 56}, {0, 0, 1, 1}},
+        {"hw_pad_mini", {32, 64, 32, 32}, {2, 2, 2, 2}},
+        {"hw_pad_small_h", {8, 64, 32, 512}, {1, 1, 1, 1}},
+        {"hw_pad_small_w", {8, 64, 512, 32}, {1, 1, 1, 1}},
+        {"hw_pad_large", {4, 32, 256, 256}, {3, 3, 3, 3}},
+    };
+
+    INFO_LOG("PadV3GradReplicate specialized kernel vs pad nd engine, dtype %s, loop %d", dtype.c_str(), loopNum);
+    printf("%-16s %4s %4s %5s %5s %2s %2s %2s %2s %10s %8s %10s %8s %6s %5s\n", "case", "N", "C", "H", "W", "pl", "pr",
+           "pt", "pb", "spec(us)", "GB/s", "engine(us)", "GB/s", "ratio", "match");
+    int32_t failNum = 0;
+    for (const auto &benchCase : cases) {
+        if (RunCase(benchCase, dataType, dtypeSize, loopNum, stream) != SUCCESS) {
+            failNum++;
+        }
+    }
+
+    aclrtDestroyStream(stream);
+    aclrtResetDevice(deviceId);
+    aclFinalize();
+    if (failNum != 0) {
+        ERROR_LOG("%d cases failed", failNum);
+        return FAILED;
+    }
+    return SUCCESS;
+}
@@ -15,6 +15,7 @@
 #include <vector>
 #include <string>
 #include "pad_v3_grad_replicate_tiling.h"
+#include "pad/op_tiling/pad_nd_tiling_func.h"
 #include "platform/platform_info.h"
 #include "register/op_def_registry.h"
 #include "tiling/tiling_api.h"
@@ -59,6 +60,7 @@ namespace optiling {
 
 constexpr uint32_t BYTE_BLOCK = 32;
 constexpr size_t MODE_INDEX = 0;
+constexpr size_t PADDINGS_CONTIGUOUS_INDEX = 1;
 constexpr int32_t X_INPUT_INDEX = 0;
 constexpr int32_t PAD_INPUT_INDEX = 1;
 constexpr int32_t FLOAT_BYTES = 4;
@@ -469,6 +471,106 @@ static ge::graphStatus GetInputInfo(gert::TilingContext* tilingContext, InputPar
     return ge::GRAPH_SUCCESS;
 }
 
+// 特化kernel只处理4维、edge模式、paddings成对排列且N/C维无填充的场景
+template <typename T>
+static bool IsSpecializedCase(gert::TilingContext* tilingContext) {
+    const gert::StorageShape* xShape = tilingContext->GetInputShape(X_INPUT_INDEX);
+    const gert::StorageShape* paddingShape = tilingContext->GetInputShape(PAD_INPUT_INDEX);
+    const gert::Tensor* paddingsTensor = tilingContext->GetInputTensor(PAD_INPUT_INDEX);
+    const gert::RuntimeAttrs* attrs = tilingContext->GetAttrs();
+    if (xShape == nullptr || paddingShape == nullptr || paddingsTensor == nullptr || attrs == nullptr ||
+        xShape->GetStorageShape().GetDimNum() != CHECK_DIM_NUM ||
+        paddingShape->GetStorageShape().GetShapeSize() != static_cast<int64_t>(CHECK_DIM_NUM * PAIR)) {
+        return false;
+    }
+    const char* mode = attrs->GetAttrPointer<char>(MODE_INDEX);
+    const bool* paddingsContiguous = attrs->GetAttrPointer<bool>(PADDINGS_CONTIGUOUS_INDEX);
+    if (mode == nullptr || std::string(mode) != "edge" ||
+        (paddingsContiguous != nullptr && !*paddingsContiguous)) {
+        return false;
+    }
+    const T* paddingsValue = paddingsTensor->GetData<T>();
+    for (uint32_t i = 0; i < PADDING_NUM_INDEX4; i++) {
+        if (paddingsValue[i] != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// x为填充后一侧的梯度，y为未填充一侧；paddings_contiguous为true时按维成对给出前后填充量，否则先列全部前侧再列全部后侧
+template <typename T>
+static ge::graphStatus GetPadNdInputInfo(gert::TilingContext* tilingContext, PadNdParams& params) {
+    const gert::StorageShape* xShape = tilingContext->GetInputShape(X_INPUT_INDEX);
+    const gert::StorageShape* yShape = tilingContext->GetOutputShape(0);
+    const gert::StorageShape* paddingShape = tilingContext->GetInputShape(PAD_INPUT_INDEX);
+    const gert::Tensor* paddingsTensor = tilingContext->GetInputTensor(PAD_INPUT_INDEX);
+    OPS_CHECK_NULL_WITH_CONTEXT(tilingContext, xShape);
+    OPS_CHECK_NULL_WITH_CONTEXT(tilingContext, yShape);
+    OPS_CHECK_NULL_WITH_CONTEXT(tilingContext, paddingShape);
+    OPS_CHECK_NULL_WITH_CONTEXT(tilingContext, paddingsTensor);
+    size_t dimNum = xShape->GetStorageShape().GetDimNum();
+    OP_TILING_CHECK(
+        dimNum == 0 || dimNum > PAD_ND_MAX_DIM_NUM || yShape->GetStorageShape().GetDimNum() != dimNum,
+        VECTOR_INNER_ERR_REPORT_TILIING(tilingContext->GetNodeName(), "input dim should be in [1, 8], please check."),
+        return ge::GRAPH_FAILED);
+    OP_TILING_CHECK(
+        static_cast<int64_t>(dimNum * PAIR) != paddingShape->GetStorageShape().GetShapeSize(),
+        VECTOR_INNER_ERR_REPORT_TILIING(tilingContext->GetNodeName(), "Please check input or padding shape"),
+        return ge::GRAPH_FAILED);
+
+    const gert::RuntimeAttrs* attrs = tilingContext->GetAttrs();
+    OP_TILING_CHECK(attrs == nullptr,
+                    VECTOR_INNER_ERR_REPORT_TILIING(tilingContext->GetNodeName(), "Get attrs Failed."),
+                    return ge::GRAPH_FAILED);
+    // 本算子只做replicate（edge）填充的反向，其余模式由各自的算子处理
+    const char* modeAttr = attrs->GetAttrPointer<char>(MODE_INDEX);
+    const std::string mode = modeAttr == nullptr ? "" : std::string(modeAttr);
+    OP_TILING_CHECK(mode != "edge" || !GetPadNdMode(mode, params.mode),
+                    VECTOR_INNER_ERR_REPORT_TILIING(tilingContext->GetNodeName(),
+                                                    "mode %s is not supported, only edge is supported.", mode.c_str()),
+                    return ge::GRAPH_FAILED);
+    const bool* paddingsContiguous = attrs->GetAttrPointer<bool>(PADDINGS_CONTIGUOUS_INDEX);
+    bool contiguous = paddingsContiguous == nullptr || *paddingsContiguous;
+
+    const T* paddingsValue = paddingsTensor->GetData<T>();
+    params.inShape.resize(dimNum);
+    params.padBefore.resize(dimNum);
+    params.padAfter.resize(dimNum);
+    for (size_t d = 0; d < dimNum; d++) {
+        params.padBefore[d] = static_cast<int64_t>(contiguous ? paddingsValue[PAIR * d] : paddingsValue[d]);
+        params.padAfter[d] =
+            static_cast<int64_t>(contiguous ? paddingsValue[PAIR * d + 1] : paddingsValue[dimNum + d]);
+        params.inShape[d] = xShape->GetStorageShape().GetDim(d) - params.padBefore[d] - params.padAfter[d];
+        OP_TILING_CHECK(
+            params.inShape[d] != yShape->GetStorageShape().GetDim(d),
+            VECTOR_INNER_ERR_REPORT_TILIING(tilingContext->GetNodeName(), "Please check input or output shape"),
+            return ge::GRAPH_FAILED);
+    }
+    return ge::GRAPH_SUCCESS;
+}
+
+static ge::graphStatus Tiling4PadNd(gert::TilingContext* tilingContext, ge::DataType inputDatatype,
+                                    ge::DataType paddingDatatype,
+                                    const Tiling4PadV3GradReplicateCompileInfo* compileInfo) {
+    PadNdParams params;
+    params.dtype = inputDatatype;
+    ge::graphStatus ret = paddingDatatype == ge::DT_INT32 ? GetPadNdInputInfo<int32_t>(tilingContext, params)
+                                                          : GetPadNdInputInfo<int64_t>(tilingContext, params);
+    OP_TILING_CHECK(ret != ge::GRAPH_SUCCESS,
+                    VECTOR_INNER_ERR_REPORT_TILIING(tilingContext->GetNodeName(), "get op inputs failed."),
+                    return ge::GRAPH_FAILED);
+    ret = PadNdTiling(tilingContext, params, compileInfo->coreNum, static_cast<int64_t>(compileInfo->ubSizePlatForm),
+                      compileInfo->sysWorkspaceSize);
+    OP_TILING_CHECK(ret != ge::GRAPH_SUCCESS,
+                    VECTOR_INNER_ERR_REPORT_TILIING(tilingContext->GetNodeName(),
+                                                    "paddings are not supported by mode, or ub space is not enough."),
+                    return ge::GRAPH_FAILED);
+    OP_LOGD(tilingContext->GetNodeName(), "PadV3GradReplicate uses pad nd engine, tiling key is %lu.",
+            tilingContext->GetTilingKey());
+    return ge::GRAPH_SUCCESS;
+}
+
 static ge::graphStatus Tiling4PadV3GradReplicate(gert::TilingContext* tilingContext) {
     auto compileInfo = reinterpret_cast<const Tiling4PadV3GradReplicateCompileInfo *>(tilingContext->GetCompileInfo());
     uint64_t ubSizePlatForm = compileInfo->ubSizePlatForm;
@@ -497,6 +599,13 @@ static ge::graphStatus Tiling4PadV3GradReplicate(gert::TilingContext* tilingCont
         VECTOR_INNER_ERR_REPORT_TILIING(tilingContext->GetNodeName(),
                                         "the current padding dtype is not in dtype support list [int32, int64]."),
         return ge::GRAPH_FAILED);
+    // 只按shape与paddings选择kernel：特化kernel覆盖不到的edge场景走N维填充引擎
+    bool specialized = paddingDatatype == ge::DT_INT32 ? IsSpecializedCase<int32_t>(tilingContext)
+                                                       : IsSpecializedCase<int64_t>(tilingContext);
+    if (!specialized) {
+        return Tiling4PadNd(tilingContext, inputDatatype, paddingDatatype, compileInfo);
+    }
+
     InputParamsInfo params;
     params.dtype = DTYPE_MAP[inputDatatype];
 
@@ -15,6 +15,7 @@
 #define __PAD_V3_GRAD_REPLICATE_TILINGDATA_H__
 
 #include "register/tilingdata_base.h"
+#include "pad/op_tiling/pad_nd_tiling_def.h"
 
 namespace optiling {
 BEGIN_TILING_DATA_DEF(PadV3GradReplicateTilingData)
@@ -42,6 +43,11 @@ BEGIN_TILING_DATA_DEF(PadV3GradReplicateTilingData)
 END_TILING_DATA_DEF;
 REGISTER_TILING_DATA_CLASS(PadV3GradReplicate, PadV3GradReplicateTilingData)
 
+// 特化kernel覆盖不到的edge模式场景（非4维、N/C维有填充、paddings非成对排列）走N维填充引擎，key 1/2/3对应float/half/bf16
+REGISTER_TILING_DATA_CLASS(PadV3GradReplicate_1, PadNdTilingData)
+REGISTER_TILING_DATA_CLASS(PadV3GradReplicate_2, PadNdTilingData)
+REGISTER_TILING_DATA_CLASS(PadV3GradReplicate_3, PadNdTilingData)
+
 struct Tiling4PadV3GradReplicateCompileInfo {
     uint32_t coreNum;
     uint64_t ubSizePlatForm;
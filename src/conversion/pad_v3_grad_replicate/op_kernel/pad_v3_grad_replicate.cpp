@@ -20,6 +20,7 @@
 #include "pad_v3_grad_replicate_large_h_small_w.h"
 #include "pad_v3_grad_replicate_large_h_small_w_bf16.h"
 #include "pad_v3_grad_replicate_h_w_large.h"
+#include "pad_nd.h"
 
 extern "C" __global__ __aicore__ void pad_v3_grad_replicate(GM_ADDR x, GM_ADDR paddings, GM_ADDR y,
                                                             GM_ADDR workspace, GM_ADDR tiling) {
@@ -27,6 +28,26 @@ extern "C" __global__ __aicore__ void pad_v3_grad_replicate(GM_ADDR x, GM_ADDR p
         return;
     }
     TPipe pipe;
+    // key 1/2/3：特化kernel覆盖不到的edge模式场景，由N维填充引擎处理
+    if (TILING_KEY_IS(1)) {
+        GET_TILING_DATA_WITH_STRUCT(PadNdTilingData, padNdTilingData, tiling);
+        PadNd::PadNdBackward<float> op(&pipe);
+        op.Init(x, y, &padNdTilingData);
+        op.Process();
+        return;
+    } else if (TILING_KEY_IS(2)) {
+        GET_TILING_DATA_WITH_STRUCT(PadNdTilingData, padNdTilingData, tiling);
+        PadNd::PadNdBackward<half> op(&pipe);
+        op.Init(x, y, &padNdTilingData);
+        op.Process();
+        return;
+    } else if (TILING_KEY_IS(3)) {
+        GET_TILING_DATA_WITH_STRUCT(PadNdTilingData, padNdTilingData, tiling);
+        PadNd::PadNdBackward<bfloat16_t> op(&pipe);
+        op.Init(x, y, &padNdTilingData);
+        op.Process();
+        return;
+    }
     GET_TILING_DATA(tilingData, tiling);
     if (TILING_KEY_IS(1110)) {
         PadV3GradReplicateH<float> op;
@@ -0,0 +1,44 @@
+#!/usr/bin/python3
+# -*- coding:utf-8 -*-
+# Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+# This file is a part of the CANN Open Software.
+# Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+# ======================================================================================================================
+
+import os
+import numpy as np
+
+def gen_golden_data_simple():
+    os.system("mkdir -p input")
+    os.system("mkdir -p output")
+
+    dtype = np.float16
+    cache_num = 4
+    var_ref_shape = [2, 4, 8, 16]
+    input_value_shape = [2, 4, 1, 16]
+    # 每项的begin与strides，对应每步写入的序列位置
+    begin = [[0, 0, 5, 0], [0, 0, 5, 0], [0, 0, 2, 0], [0, 0, 7, 0]]
+    strides = [[1, 1, 1, 1], [1, 1, 1, 1], [1, 1, 1, 1], [1, 1, 1, 1]]
+
+    slice_desc = np.array([[b, s] for b, s in zip(begin, strides)], dtype=np.int64)
+    slice_desc.tofile("./input/slice_desc.bin")
+
+    golden = []
+    for i in range(cache_num):
+        var_ref = np.random.uniform(-1, 1, var_ref_shape).astype(dtype)
+        input_value = np.random.uniform(-1, 1, input_value_shape).astype(dtype)
+        var_ref.tofile("./input/var{}.bin".format(i))
+        input_value.tofile("./input/value{}.bin".format(i))
+
+        slices = tuple(slice(b, b + n * s, s) for b, n, s in zip(begin[i], input_value_shape, strides[i]))
+        var_ref[slices] = input_value
+        golden.append(var_ref)
+
+    np.stack(golden).tofile("./output/golden.bin")
+
+if __name__ == "__main__":
+    gen_golden_data_simple()
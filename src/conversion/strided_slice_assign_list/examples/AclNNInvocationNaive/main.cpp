@@ -0,0 +1,250 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file main.cpp
+ */
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <fstream>
+#include <fcntl.h>
+
+#include "acl/acl.h"
+#include "aclnn_strided_slice_assign_list.h"
+
+const int SUCCESS = 0;
+const int FAILED = 1;
+
+#define INFO_LOG(fmt, args...) fprintf(stdout, "[INFO]  " fmt "\n", ##args)
+#define WARN_LOG(fmt, args...) fprintf(stdout, "[WARN]  " fmt "\n", ##args)
+#define ERROR_LOG(fmt, args...) fprintf(stderr, "[ERROR]  " fmt "\n", ##args)
+
+#define CHECK_RET(cond, return_expr) \
+    do {                             \
+        if (!(cond)) {               \
+            return_expr;             \
+        }                            \
+    } while (0)
+
+#define LOG_PRINT(message, ...)         \
+    do {                                \
+        printf(message, ##__VA_ARGS__); \
+    } while (0)
+
+bool ReadFile(const std::string &filePath, size_t fileSize, void *buffer, size_t bufferSize)
+{
+    struct stat sBuf;
+    int fileStatus = stat(filePath.data(), &sBuf);
+    if (fileStatus == -1) {
+        ERROR_LOG("failed to get file %s", filePath.c_str());
+        return false;
+    }
+    if (S_ISREG(sBuf.st_mode) == 0) {
+        ERROR_LOG("%s is not a file, please enter a file", filePath.c_str());
+        return false;
+    }
+
+    std::ifstream file;
+    file.open(filePath, std::ios::binary);
+    if (!file.is_open()) {
+        ERROR_LOG("Open file failed. path = %s", filePath.c_str());
+        return false;
+    }
+
+    std::filebuf *buf = file.rdbuf();
+    size_t size = buf->pubseekoff(0, std::ios::end, std::ios::in);
+    if (size == 0) {
+        ERROR_LOG("file size is 0");
+        file.close();
+        return false;
+    }
+    if (size > bufferSize) {
+        ERROR_LOG("file size is larger than buffer size");
+        file.close();
+        return false;
+    }
+    buf->pubseekpos(0, std::ios::in);
+    buf->sgetn(static_cast<char *>(buffer), size);
+    fileSize = size;
+    file.close();
+    return true;
+}
+
+bool WriteFile(const std::string &filePath, const void *buffer, size_t size)
+{
+    if (buffer == nullptr) {
+        ERROR_LOG("Write file failed. buffer is nullptr");
+        return false;
+    }
+
+    int fd = open(filePath.c_str(), O_RDWR | O_CREAT | O_TRUNC, S_IRUSR | S_IWRITE);
+    if (fd < 0) {
+        ERROR_LOG("Open file failed. path = %s", filePath.c_str());
+        return false;
+    }
+
+    auto writeSize = write(fd, buffer, size);
+    (void) close(fd);
+    if (writeSize != size) {
+        ERROR_LOG("Write file Failed.");
+        return false;
+    }
+
+    return true;
+}
+
+int64_t GetShapeSize(const std::vector<int64_t> &shape)
+{
+    int64_t shapeSize = 1;
+    for (auto i : shape) {
+        shapeSize *= i;
+    }
+    return shapeSize;
+}
+
+int Init(int32_t deviceId, aclrtStream *stream)
+{
+    // 固定写法，acl初始化
+    auto ret = aclInit(nullptr);
+    CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("aclInit failed. ERROR: %d\n", ret); return FAILED);
+    ret = aclrtSetDevice(deviceId);
+    CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("aclrtSetDevice failed. ERROR: %d\n", ret); return FAILED);
+    ret = aclrtCreateStream(stream);
+    CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("aclrtCreateStream failed. ERROR: %d\n", ret); return FAILED);
+
+    return SUCCESS;
+}
+
+template <typename T>
+int CreateAclTensor(const std::vector<T> &hostData, const std::vector<int64_t> &shape, void **deviceAddr,
+                    aclDataType dataType, aclTensor **tensor)
+{
+    auto size = GetShapeSize(shape) * sizeof(T);
+    // 调用aclrtMalloc申请device侧内存
+    auto ret = aclrtMalloc(deviceAddr, size, ACL_MEM_MALLOC_HUGE_FIRST);
+    CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("aclrtMalloc failed. ERROR: %d\n", ret); return FAILED);
+
+    // 调用aclrtMemcpy将host侧数据拷贝到device侧内存上
+    ret = aclrtMemcpy(*deviceAddr, size, hostData.data(), size, ACL_MEMCPY_HOST_TO_DEVICE);
+    CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("aclrtMemcpy failed. ERROR: %d\n", ret); return FAILED);
+
+    // 调用aclCreateTensor接口创建aclTensor
+    *tensor = aclCreateTensor(shape.data(), shape.size(), dataType, nullptr, 0, aclFormat::ACL_FORMAT_ND, shape.data(),
+                              shape.size(), *deviceAddr);
+    return SUCCESS;
+}
+
+int main(int argc, char **argv)
+{
+    // 1. （固定写法）device/stream初始化, 参考acl对外接口列表
+    // 根据自己的实际device填写deviceId
+    int32_t deviceId = 0;
+    aclrtStream stream;
+    auto ret = Init(deviceId, &stream);
+    CHECK_RET(ret == 0, LOG_PRINT("Init acl failed. ERROR: %d\n", ret); return FAILED);
+
+    // 2. 构造输入与输出，需要根据API的接口自定义构造
+    // 模拟两层的K/V cache：[batch, head, maxSeq, headDim]，每步写入[batch, head, 1, headDim]
+    const int64_t cacheNum = 4;
+    std::vector<int64_t> varRefShape = {2, 4, 8, 16};
+    std::vector<int64_t> inputValueShape = {2, 4, 1, 16};
+    std::vector<int64_t> sliceDescShape = {cacheNum, 2, 4};
+    size_t varRefShapeSize = GetShapeSize(varRefShape);
+    size_t inputValueShapeSize = GetShapeSize(inputValueShape);
+    size_t dataType = sizeof(uint16_t);
+    size_t fileSize = 0;
+
+    std::vector<std::vector<aclFloat16>> varRefHostData(cacheNum, std::vector<aclFloat16>(varRefShapeSize));
+    std::vector<std::vector<aclFloat16>> inputValueHostData(cacheNum, std::vector<aclFloat16>(inputValueShapeSize));
+    std::vector<void *> varRefDeviceAddr(cacheNum, nullptr);
+    std::vector<void *> inputValueDeviceAddr(cacheNum, nullptr);
+    std::vector<aclTensor *> varRef(cacheNum, nullptr);
+    std::vector<aclTensor *> inputValue(cacheNum, nullptr);
+    // 读取数据
+    for (int64_t i = 0; i < cacheNum; i++) {
+        ReadFile("../input/var" + std::to_string(i) + ".bin", fileSize, varRefHostData[i].data(),
+                 varRefShapeSize * dataType);
+        ReadFile("../input/value" + std::to_string(i) + ".bin", fileSize, inputValueHostData[i].data(),
+                 inputValueShapeSize * dataType);
+    }
+    // 每项的begin与strides，与gen_data.py一致
+    std::vector<int64_t> sliceDescHostData(GetShapeSize(sliceDescShape));
+    ReadFile("../input/slice_desc.bin", fileSize, sliceDescHostData.data(), sliceDescHostData.size() * sizeof(int64_t));
+    INFO_LOG("Set input success");
+
+    for (int64_t i = 0; i < cacheNum; i++) {
+        ret = CreateAclTensor(varRefHostData[i], varRefShape, &varRefDeviceAddr[i], aclDataType::ACL_FLOAT16,
+                              &varRef[i]);
+        CHECK_RET(ret == ACL_SUCCESS, return FAILED);
+        ret = CreateAclTensor(inputValueHostData[i], inputValueShape, &inputValueDeviceAddr[i],
+                              aclDataType::ACL_FLOAT16, &inputValue[i]);
+        CHECK_RET(ret == ACL_SUCCESS, return FAILED);
+    }
+    void *sliceDescDeviceAddr = nullptr;
+    aclTensor *sliceDesc = nullptr;
+    ret = CreateAclTensor(sliceDescHostData, sliceDescShape, &sliceDescDeviceAddr, aclDataType::ACL_INT64, &sliceDesc);
+    CHECK_RET(ret == ACL_SUCCESS, return FAILED);
+    aclTensorList *varRefList = aclCreateTensorList(varRef.data(), varRef.size());
+    aclTensorList *inputValueList = aclCreateTensorList(inputValue.data(), inputValue.size());
+
+    // 3. 调用CANN算子库API，需要修改为具体的API
+    uint64_t workspaceSize = 0;
+    aclOpExecutor* executor;
+    // 调用aclnnStridedSliceAssignList第一段接口
+    ret = aclnnStridedSliceAssignListGetWorkspaceSize(varRefList, inputValueList, sliceDesc, &workspaceSize, &executor);
+    CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("aclnnStridedSliceAssignListGetWorkspaceSize failed. ERROR: %d\n", ret); return ret);
+    // 根据第一段接口计算出的workspaceSize申请device内存
+    void* workspaceAddr = nullptr;
+    if (workspaceSize > 0) {
+    ret = aclrtMalloc(&workspaceAddr, workspaceSize, ACL_MEM_MALLOC_HUGE_FIRST);
+    CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("allocate workspace failed. ERROR: %d\n", ret); return ret;);
+    }
+    // 调用aclnnStridedSliceAssignList第二段接口
+    ret = aclnnStridedSliceAssignList(workspaceAddr, workspaceSize, executor, stream);
+    CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("aclnnStridedSliceAssignList failed. ERROR: %d\n", ret); return ret);
+    // 4. （固定写法）同步等待任务执行结束
+    ret = aclrtSynchronizeStream(stream);
+    CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("aclrtSynchronizeStream failed. ERROR: %d\n", ret); return ret);
+
+    // 5. 获取输出的值，将device侧内存上的结果拷贝至host侧，各cache依次写入同一个文件
+    std::vector<aclFloat16> resultData(cacheNum * varRefShapeSize, 0);
+    for (int64_t i = 0; i < cacheNum; i++) {
+        ret = aclrtMemcpy(resultData.data() + i * varRefShapeSize, varRefShapeSize * dataType, varRefDeviceAddr[i],
+            varRefShapeSize * dataType, ACL_MEMCPY_DEVICE_TO_HOST);
+        CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("copy result from device to host failed. ERROR: %d\n", ret); return FAILED);
+    }
+    WriteFile("../output/output.bin", resultData.data(), resultData.size() * dataType);
+    INFO_LOG("Write output success");
+
+    // 6. 释放aclTensor，需要根据具体API的接口定义修改
+    aclDestroyTensorList(varRefList);
+    aclDestroyTensorList(inputValueList);
+    aclDestroyTensor(sliceDesc);
+
+    // 7. 释放device资源，需要根据具体API的接口定义修改
+    for (int64_t i = 0; i < cacheNum; i++) {
+        aclrtFree(varRefDeviceAddr[i]);
+        aclrtFree(inputValueDeviceAddr[i]);
+    }
+    aclrtFree(sliceDescDeviceAddr);
+    if (workspaceSize > 0) {
+    aclrtFree(workspaceAddr);
+    }
+    aclrtDestroyStream(stream);
+    aclrtResetDevice(deviceId);
+    aclFinalize();
+    return SUCCESS;
+}
@@ -0,0 +1,235 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file strided_slice_assign_list_tiling.cpp
+ * \brief
+ */
+#include <algorithm>
+#include <vector>
+#include "register/op_def_registry.h"
+#include "tiling/tiling_api.h"
+#include "strided_slice_assign_list.h"
+
+#define OPS_CHECK_NULL_WITH_CONTEXT(context, ptr) \
+    if ((ptr) == nullptr) {                       \
+        std::printf("nullptr error!");            \
+        return ge::GRAPH_FAILED;                  \
+    }
+#define OP_LOGD(nodeName, fmt, ...) std::printf(fmt, ##__VA_ARGS__)
+
+#define VECTOR_INNER_ERR_REPORT_TILIING(op_name, err_msg, ...) std::printf(err_msg, ##__VA_ARGS__)
+#define OP_TILING_CHECK(cond, log_func, expr) \
+    do {                                        \
+        if (cond) {                               \
+        log_func;                               \
+        expr;                                   \
+        }                                         \
+    } while (0)
+
+namespace optiling {
+constexpr size_t INPUT_VAR_INDEX = 0;
+constexpr size_t INPUT_INPUTVAL_INDEX = 1;
+constexpr int64_t DESC_ITEM_NUM = 2;
+constexpr int64_t BUFFER_NUM = 2;
+constexpr int64_t BLOCK_BYTES = 32;
+// 预留给标量栈与对齐的UB空间
+constexpr int64_t UB_RESERVED_BYTES = 1024;
+
+template <typename T>
+inline T *GetCompileInfoPtr(gert::TilingParseContext *context)
+{
+    return context->GetCompiledInfo<T>();
+}
+
+static int64_t GetInstanceNum(gert::TilingContext* context, size_t irIndex)
+{
+    auto computeNodeInfo = context->GetComputeNodeInfo();
+    if (computeNodeInfo == nullptr) {
+        return 0;
+    }
+    auto instanceInfo = computeNodeInfo->GetInputInstanceInfo(irIndex);
+    if (instanceInfo == nullptr) {
+        return 0;
+    }
+    return static_cast<int64_t>(instanceInfo->GetInstanceNum());
+}
+
+// 列表中所有张量的shape须一致，每步更新的KV cache即为此形式
+static ge::graphStatus GetListShape(gert::TilingContext* context, size_t irIndex, int64_t entryNum,
+                                   gert::Shape &shape)
+{
+    auto firstShape = context->GetDynamicInputShape(irIndex, 0);
+    OPS_CHECK_NULL_WITH_CONTEXT(context, firstShape);
+    shape = firstShape->GetStorageShape();
+    for (int64_t i = 1; i < entryNum; i++) {
+        auto otherShape = context->GetDynamicInputShape(irIndex, i);
+        OPS_CHECK_NULL_WITH_CONTEXT(context, otherShape);
+        OP_TILING_CHECK(otherShape->GetStorageShape() != shape,
+                        VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(), "All tensors in a list must share one shape."),
+                        return ge::GRAPH_FAILED);
+    }
+    return ge::GRAPH_SUCCESS;
+}
+
+static ge::graphStatus Tiling4StridedSliceAssignList(gert::TilingContext* context)
+{
+    OP_LOGD(context->GetNodeName(), " Tiling4StridedSliceAssignList is running.");
+    StridedSliceAssignListTilingData tiling;
+    auto compileInfo = reinterpret_cast<const StridedSliceAssignListCompileInfo*>(context->GetCompileInfo());
+    auto ascendcPlatform = platform_ascendc::PlatformAscendC(context->GetPlatformInfo());
+    int64_t totalCoreNum = (compileInfo == nullptr) ? ascendcPlatform.GetCoreNumAiv() : compileInfo->totalCoreNum;
+    int64_t ubSize = 0;
+    if (compileInfo == nullptr) {
+        uint64_t ubSizePlatForm;
+        ascendcPlatform.GetCoreMemSize(platform_ascendc::CoreMemType::UB, ubSizePlatForm);
+        ubSize = static_cast<int64_t>(ubSizePlatForm);
+    } else {
+        ubSize = compileInfo->ubSize;
+    }
+
+    int64_t entryNum = GetInstanceNum(context, INPUT_VAR_INDEX);
+    OP_TILING_CHECK(entryNum <= 0 || entryNum != GetInstanceNum(context, INPUT_INPUTVAL_INDEX),
+                    VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(),
+                        "var and input_value must be non-empty lists of the same length."),
+                    return ge::GRAPH_FAILED);
+
+    gert::Shape varShape;
+    gert::Shape valueShape;
+    OP_TILING_CHECK(GetListShape(context, INPUT_VAR_INDEX, entryNum, varShape) != ge::GRAPH_SUCCESS,
+                    VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(), "Get var shape failed."),
+                    return ge::GRAPH_FAILED);
+    OP_TILING_CHECK(GetListShape(context, INPUT_INPUTVAL_INDEX, entryNum, valueShape) != ge::GRAPH_SUCCESS,
+                    VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(), "Get input_value shape failed."),
+                    return ge::GRAPH_FAILED);
+
+    int64_t dimNum = static_cast<int64_t>(varShape.GetDimNum());
+    OP_TILING_CHECK(dimNum <= 0 || dimNum > static_cast<int64_t>(LIST_MAX_DIM_NUM) ||
+                    dimNum != static_cast<int64_t>(valueShape.GetDimNum()),
+                    VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(),
+                        "Var's dim num must equal to input_value's and be in [1, 8]."),
+                    return ge::GRAPH_FAILED);
+    for (int64_t i = 0; i < dimNum; i++) {
+        OP_TILING_CHECK(varShape.GetDim(i) <= 0 || valueShape.GetDim(i) <= 0 ||
+                        valueShape.GetDim(i) > varShape.GetDim(i),
+                        VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(), "Input shape does not match, please check!"),
+                        return ge::GRAPH_FAILED);
+    }
+
+    // slice_desc紧跟在两个列表之后
+    auto descShape = context->GetInputShape(DESC_ITEM_NUM * entryNum);
+    OPS_CHECK_NULL_WITH_CONTEXT(context, descShape);
+    OP_TILING_CHECK(descShape->GetStorageShape().GetShapeSize() != entryNum * DESC_ITEM_NUM * dimNum,
+                    VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(),
+                        "slice_desc must be [entryNum, 2, dimNum]."),
+                    return ge::GRAPH_FAILED);
+
+    auto varDesc = context->GetDynamicInputDesc(INPUT_VAR_INDEX, 0);
+    OPS_CHECK_NULL_WITH_CONTEXT(context, varDesc);
+    int64_t typeSize = ge::GetSizeByDataType(varDesc->GetDataType());
+    OP_TILING_CHECK(typeSize <= 0,
+                    VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(), "Unsupported data type."),
+                    return ge::GRAPH_FAILED);
+
+    int64_t varDim[LIST_MAX_DIM_NUM] = {0};
+    int64_t varCumShape[LIST_MAX_DIM_NUM] = {0};
+    varCumShape[dimNum - 1] = 1;
+    for (int64_t i = 0; i < dimNum; i++) {
+        varDim[i] = varShape.GetDim(i);
+    }
+    for (int64_t i = dimNum - 2; i >= 0; i--) {
+        varCumShape[i] = varDim[i + 1] * varCumShape[i + 1];
+    }
+
+    // 压缩input_value中长度为1的维度，这些维度只贡献一个固定偏移，如KV cache更新时的序列维
+    int64_t sqDim[LIST_MAX_DIM_NUM] = {0};
+    int64_t sqValueDim[LIST_MAX_DIM_NUM] = {0};
+    int64_t sqDimNum = 0;
+    for (int64_t i = 0; i < dimNum; i++) {
+        if (valueShape.GetDim(i) != 1 || i == dimNum - 1) {
+            sqDim[sqDimNum] = i;
+            sqValueDim[sqDimNum] = valueShape.GetDim(i);
+            sqDimNum++;
+        }
+    }
+    int64_t rowLen = sqValueDim[sqDimNum - 1];
+    int64_t rowsPerSlab = sqDimNum >= DESC_ITEM_NUM ? sqValueDim[sqDimNum - DESC_ITEM_NUM] : 1;
+    int64_t slabsPerEntry = 1;
+    for (int64_t i = 0; i + DESC_ITEM_NUM < sqDimNum; i++) {
+        slabsPerEntry *= sqValueDim[i];
+    }
+
+    int64_t unitNum = entryNum * slabsPerEntry;
+    int64_t usedCoreNum = std::max<int64_t>(1, std::min(totalCoreNum, unitNum));
+    int64_t bufBytes = (ubSize - UB_RESERVED_BYTES) / BUFFER_NUM / BLOCK_BYTES * BLOCK_BYTES;
+    OP_TILING_CHECK(bufBytes < BLOCK_BYTES,
+                    VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(), "UB size is too small."),
+                    return ge::GRAPH_FAILED);
+
+    tiling.set_entryNum(entryNum);
+    tiling.set_dimNum(dimNum);
+    tiling.set_sqDimNum(sqDimNum);
+    tiling.set_typeSize(typeSize);
+    tiling.set_rowLen(rowLen);
+    tiling.set_rowsPerSlab(rowsPerSlab);
+    tiling.set_slabsPerEntry(slabsPerEntry);
+    tiling.set_unitNum(unitNum);
+    tiling.set_usedCoreNum(usedCoreNum);
+    tiling.set_unitsPerCore(unitNum / usedCoreNum);
+    tiling.set_tailCoreNum(unitNum % usedCoreNum);
+    tiling.set_bufBytes(bufBytes);
+    tiling.set_sqDim(sqDim);
+    tiling.set_sqValueDim(sqValueDim);
+    tiling.set_varDim(varDim);
+    tiling.set_varCumShape(varCumShape);
+
+    context->SetBlockDim(static_cast<uint32_t>(usedCoreNum));
+    context->SetTilingKey(1);
+    tiling.SaveToBuffer(context->GetRawTilingData()->GetData(), context->GetRawTilingData()->GetCapacity());
+    context->GetRawTilingData()->SetDataSize(tiling.GetDataSize());
+
+    size_t sysWorkspaceSize = 16 * 1024 * 1024;
+    size_t* currentWorkspace = context->GetWorkspaceSizes(1);
+    currentWorkspace[0] = sysWorkspaceSize;
+
+    return ge::GRAPH_SUCCESS;
+}
+
+static ge::graphStatus TilingPrepare4StridedSliceAssignList(gert::TilingParseContext* context)
+{
+    OP_LOGD(context->GetNodeName(), "TilingPrepare4StridedSliceAssignList running.");
+    auto compileInfo = GetCompileInfoPtr<StridedSliceAssignListCompileInfo>(context);
+    OPS_CHECK_NULL_WITH_CONTEXT(context, compileInfo);
+    auto platformInfo = context->GetPlatformInfo();
+    OPS_CHECK_NULL_WITH_CONTEXT(context, platformInfo);
+    auto ascendcPlatform = platform_ascendc::PlatformAscendC(platformInfo);
+    compileInfo->totalCoreNum = ascendcPlatform.GetCoreNumAiv();
+    OP_TILING_CHECK((compileInfo->totalCoreNum <= 0),
+                    VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(),
+                        "TilingPrepare4StridedSliceAssignList fail to get core num."),
+                    return ge::GRAPH_FAILED);
+
+    uint64_t ubSizePlatForm;
+    ascendcPlatform.GetCoreMemSize(platform_ascendc::CoreMemType::UB, ubSizePlatForm);
+    compileInfo->ubSize = static_cast<int64_t>(ubSizePlatForm);
+    OP_TILING_CHECK((compileInfo->ubSize <= 0),
+                    VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(),
+                        "TilingPrepare4StridedSliceAssignList fail to get ub size."),
+                    return ge::GRAPH_FAILED);
+
+    OP_LOGD(context->GetNodeName(), "TilingPrepare4StridedSliceAssignList exit.");
+    return ge::GRAPH_SUCCESS;
+}
+
+IMPL_OP_OPTILING(StridedSliceAssignList)
+    .Tiling(Tiling4StridedSliceAssignList)
+    .TilingParse<StridedSliceAssignListCompileInfo>(TilingPrepare4StridedSliceAssignList);
+
+}  // namespace optiling
@@ -0,0 +1,51 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file strided_slice_assign_list_tiling.h
+ * \brief
+ */
+#ifndef OPS_BUILT_IN_OP_TILING_RUNTIME_STRIDED_SLICE_ASSIGN_LIST_H
+#define OPS_BUILT_IN_OP_TILING_RUNTIME_STRIDED_SLICE_ASSIGN_LIST_H
+
+#include "register/tilingdata_base.h"
+
+namespace optiling {
+constexpr size_t LIST_MAX_DIM_NUM = 8;
+// input_value中长度为1的维度被压缩掉（末维除外），sqDim记录保留下来的原始维度下标
+// 每个任务为一项中的一片：压缩后最后两维构成的[rowsPerSlab, rowLen]
+BEGIN_TILING_DATA_DEF(StridedSliceAssignListTilingData)
+    TILING_DATA_FIELD_DEF(int64_t, entryNum);
+    TILING_DATA_FIELD_DEF(int64_t, dimNum);
+    TILING_DATA_FIELD_DEF(int64_t, sqDimNum);
+    TILING_DATA_FIELD_DEF(int64_t, typeSize);
+    TILING_DATA_FIELD_DEF(int64_t, rowLen);
+    TILING_DATA_FIELD_DEF(int64_t, rowsPerSlab);
+    TILING_DATA_FIELD_DEF(int64_t, slabsPerEntry);
+    TILING_DATA_FIELD_DEF(int64_t, unitNum);
+    TILING_DATA_FIELD_DEF(int64_t, usedCoreNum);
+    TILING_DATA_FIELD_DEF(int64_t, unitsPerCore);
+    TILING_DATA_FIELD_DEF(int64_t, tailCoreNum);
+    TILING_DATA_FIELD_DEF(int64_t, bufBytes);
+    TILING_DATA_FIELD_DEF_ARR(int64_t, LIST_MAX_DIM_NUM, sqDim);
+    TILING_DATA_FIELD_DEF_ARR(int64_t, LIST_MAX_DIM_NUM, sqValueDim);
+    TILING_DATA_FIELD_DEF_ARR(int64_t, LIST_MAX_DIM_NUM, varDim);
+    TILING_DATA_FIELD_DEF_ARR(int64_t, LIST_MAX_DIM_NUM, varCumShape);
+END_TILING_DATA_DEF;
+
+REGISTER_TILING_DATA_CLASS(StridedSliceAssignList, StridedSliceAssignListTilingData)
+
+struct StridedSliceAssignListCompileInfo {
+    int32_t totalCoreNum = 0;
+    int64_t ubSize = 0;
+};
+}  // namespace optiling
+
+#endif  // OPS_BUILT_IN_OP_TILING_RUNTIME_STRIDED_SLICE_ASSIGN_LIST_H
@@ -0,0 +1,59 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file strided_slice_assign_list_def.cpp
+ * \brief
+ */
+#include <vector>
+#include <cstdint>
+#include "register/op_def_registry.h"
+
+static const std::vector<ge::DataType> inputDataType = {
+    ge::DT_FLOAT16, ge::DT_FLOAT, ge::DT_BF16, ge::DT_INT32, ge::DT_INT64, ge::DT_DOUBLE, ge::DT_INT8};
+
+static const std::vector<ge::DataType> idxDataType = {
+    ge::DT_INT64, ge::DT_INT64, ge::DT_INT64, ge::DT_INT64, ge::DT_INT64, ge::DT_INT64, ge::DT_INT64};
+
+static const std::vector<ge::Format> format = {
+    ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND};
+
+namespace ops {
+class StridedSliceAssignList : public OpDef {
+public:
+    explicit StridedSliceAssignList(const char* name) : OpDef(name)
+    {
+        this->Input("var")
+            .ParamType(DYNAMIC)
+            .DataType(inputDataType)
+            .Format(format)
+            .UnknownShapeFormat(format);
+        this->Input("input_value")
+            .ParamType(DYNAMIC)
+            .DataType(inputDataType)
+            .Format(format)
+            .UnknownShapeFormat(format);
+        // [entryNum, 2, dimNum]，每项为begin与strides，留在Device侧，不参与tiling
+        this->Input("slice_desc")
+            .ParamType(REQUIRED)
+            .DataType(idxDataType)
+            .Format(format)
+            .UnknownShapeFormat(format);
+        this->Output("var")
+            .ParamType(DYNAMIC)
+            .DataType(inputDataType)
+            .Format(format)
+            .UnknownShapeFormat(format);
+
+        this->AICore().AddConfig("ascend910b");
+    }
+};
+OP_ADD(StridedSliceAssignList);
+}  // namespace ops
@@ -0,0 +1,59 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file strided_slice_assign_list_ops.cc
+ * \brief
+ */
+#include "register/op_def_registry.h"
+
+#define OP_LOGD(nodeName, fmt, ...)  \
+    std::printf(fmt, ##__VA_ARGS__); \
+    std::printf("\n")
+#define OPS_CHECK_NULL_WITH_CONTEXT(context, ptr) \
+    if ((ptr) == nullptr) {                       \
+        std::printf("nullptr error!");            \
+        return ge::GRAPH_FAILED;                  \
+    }
+
+using namespace ge;
+
+namespace ops {
+// 第i个输出与第i个var同址同shape
+static ge::graphStatus InfershapeForStridedSliceAssignList(gert::InferShapeContext *context)
+{
+    OP_LOGD(context->GetNodeName(), "InfershapeForStridedSliceAssignList enter");
+    auto extendContext = reinterpret_cast<gert::ExtendedKernelContext*>(context);
+    size_t outputNum = extendContext->GetComputeNodeOutputNum();
+    for (size_t i = 0; i < outputNum; i++) {
+        auto in_shape = context->GetInputShape(i);
+        OPS_CHECK_NULL_WITH_CONTEXT(context, in_shape);
+        auto out_shape = context->GetOutputShape(i);
+        OPS_CHECK_NULL_WITH_CONTEXT(context, out_shape);
+        *out_shape = *in_shape;
+    }
+    return ge::GRAPH_SUCCESS;
+}
+
+static ge::graphStatus InferDataTypeForStridedSliceAssignList(gert::InferDataTypeContext *context)
+{
+    auto extendContext = reinterpret_cast<gert::ExtendedKernelContext*>(context);
+    size_t outputNum = extendContext->GetComputeNodeOutputNum();
+    for (size_t i = 0; i < outputNum; i++) {
+        context->SetOutputDataType(i, context->GetInputDataType(i));
+    }
+    return ge::GRAPH_SUCCESS;
+}
+
+IMPL_OP_INFERSHAPE(StridedSliceAssignList)
+    .InferShape(InfershapeForStridedSliceAssignList)
+    .InferDataType(InferDataTypeForStridedSliceAssignList);
+
+}  // namespace ops
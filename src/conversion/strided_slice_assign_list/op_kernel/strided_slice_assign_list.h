@@ -0,0 +1,241 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file strided_slice_assign_list.h
+ * \brief
+ */
+#ifndef STRIDED_SLICE_ASSIGN_LIST_H
+#define STRIDED_SLICE_ASSIGN_LIST_H
+
+#include "kernel_operator.h"
+
+namespace StridedSliceAssignList {
+using namespace AscendC;
+
+constexpr int64_t MAX_DIM_NUM = 8;
+constexpr int64_t BUFFER_NUM = 2;
+constexpr int64_t BLOCK_BYTES = 32;
+constexpr int64_t MAX_BLOCK_COUNT = 4095;
+constexpr int64_t MAX_STRIDE_BYTES = 0xFFFFFFFF;
+
+// 一次搬运：rows行、每行rowBytes字节，源端连续，目的端行距dstPitch字节
+struct CopyRegion {
+    __gm__ uint8_t *src = nullptr;
+    __gm__ uint8_t *dst = nullptr;
+    int64_t srcOffset = 0;
+    int64_t dstOffset = 0;
+    int64_t rows = 0;
+    int64_t rowBytes = 0;
+    int64_t dstPitch = 0;
+};
+
+/*
+  所有项共用一次launch：任务按(项, 片)编号，各核分到连续的一段。
+  begin/strides在Device侧的slice_desc中，逐项读取，因此每步更新位置时无需重新计算tiling。
+  相邻任务在源端与目的端都连续时合并为一次搬运，行距等于行长的片也退化为一段连续数据。
+  数据只经过搬运单元，按字节处理，与数据类型无关。
+*/
+class KernelStridedSliceAssignList {
+public:
+    __aicore__ inline KernelStridedSliceAssignList(TPipe *pipe)
+    {
+        Ppipe = pipe;
+    }
+    __aicore__ inline void Init(GM_ADDR var, GM_ADDR input_value, GM_ADDR slice_desc, GM_ADDR var_out,
+                                const StridedSliceAssignListTilingData *tilingData)
+    {
+        tiling = tilingData;
+        valueList = input_value;
+        varOutList = var_out;
+        descGm.SetGlobalBuffer((__gm__ int64_t *)slice_desc);
+
+        int64_t blockIdx = GetBlockIdx();
+        unitStart = blockIdx * tiling->unitsPerCore +
+                    (blockIdx < tiling->tailCoreNum ? blockIdx : tiling->tailCoreNum);
+        unitEnd = unitStart + tiling->unitsPerCore + (blockIdx < tiling->tailCoreNum ? 1 : 0);
+
+        Ppipe->InitBuffer(copyQueue, BUFFER_NUM, tiling->bufBytes);
+    }
+
+    __aicore__ inline void Process()
+    {
+        CopyRegion pending;
+        int64_t curEntry = -1;
+        for (int64_t unit = unitStart; unit < unitEnd; unit++) {
+            int64_t entry = unit / tiling->slabsPerEntry;
+            if (entry != curEntry) {
+                LoadDesc(entry);
+                curEntry = entry;
+            }
+            CopyRegion region = MakeRegion(unit % tiling->slabsPerEntry);
+            if (!TryMerge(pending, region)) {
+                Flush(pending);
+                pending = region;
+            }
+        }
+        Flush(pending);
+    }
+
+protected:
+    TPipe *Ppipe = nullptr;
+    const StridedSliceAssignListTilingData *tiling = nullptr;
+
+    TQueBind<TPosition::VECIN, TPosition::VECOUT, BUFFER_NUM> copyQueue;
+    GlobalTensor<int64_t> descGm;
+    GlobalTensor<uint8_t> srcGm;
+    GlobalTensor<uint8_t> dstGm;
+    GM_ADDR valueList;
+    GM_ADDR varOutList;
+
+    int64_t unitStart = 0;
+    int64_t unitEnd = 0;
+
+    __gm__ uint8_t *entrySrc = nullptr;
+    __gm__ uint8_t *entryDst = nullptr;
+    int64_t baseOffset = 0;
+    int64_t rowPitch = 0;
+    int64_t outerStride[MAX_DIM_NUM];
+
+private:
+    // 与ScatterList相同的张量列表布局：首个uint64为数据指针区相对首地址的偏移
+    __aicore__ inline __gm__ uint8_t *GetTensorAddr(GM_ADDR tensorListPtr, int64_t index)
+    {
+        __gm__ uint64_t *dataAddr = reinterpret_cast<__gm__ uint64_t *>(tensorListPtr);
+        uint64_t tensorPtrOffset = *dataAddr;
+        __gm__ uint64_t *tensorPtr = dataAddr + (tensorPtrOffset >> 3);
+        return reinterpret_cast<__gm__ uint8_t *>(*(tensorPtr + index));
+    }
+
+    __aicore__ inline void LoadDesc(int64_t entry)
+    {
+        entrySrc = GetTensorAddr(valueList, entry);
+        entryDst = GetTensorAddr(varOutList, entry);
+
+        int64_t dimNum = tiling->dimNum;
+        int64_t beginBase = entry * 2 * dimNum;
+        int64_t strideBase = beginBase + dimNum;
+        baseOffset = 0;
+        for (int64_t d = 0; d < dimNum; d++) {
+            int64_t begin = descGm.GetValue(beginBase + d);
+            if (begin < 0) {
+                begin += tiling->varDim[d];
+            }
+            baseOffset += begin * tiling->varCumShape[d];
+        }
+
+        int64_t sqDimNum = tiling->sqDimNum;
+        for (int64_t k = 0; k + 1 < sqDimNum; k++) {
+            int64_t d = tiling->sqDim[k];
+            outerStride[k] = descGm.GetValue(strideBase + d) * tiling->varCumShape[d];
+        }
+        rowPitch = sqDimNum >= 2 ? outerStride[sqDimNum - 2] : 0;
+    }
+
+    __aicore__ inline CopyRegion MakeRegion(int64_t slab)
+    {
+        int64_t typeSize = tiling->typeSize;
+        int64_t dstOffset = baseOffset;
+        int64_t idx = slab;
+        for (int64_t k = tiling->sqDimNum - 3; k >= 0; k--) {
+            dstOffset += (idx % tiling->sqValueDim[k]) * outerStride[k];
+            idx /= tiling->sqValueDim[k];
+        }
+
+        CopyRegion region;
+        region.src = entrySrc;
+        region.dst = entryDst;
+        region.srcOffset = slab * tiling->rowsPerSlab * tiling->rowLen * typeSize;
+        region.dstOffset = dstOffset * typeSize;
+        region.rows = tiling->rowsPerSlab;
+        region.rowBytes = tiling->rowLen * typeSize;
+        region.dstPitch = rowPitch * typeSize;
+        if (region.rows == 1 || region.dstPitch == region.rowBytes) {
+            region.rowBytes *= region.rows;
+            region.rows = 1;
+            region.dstPitch = region.rowBytes;
+        }
+        return region;
+    }
+
+    __aicore__ inline bool TryMerge(CopyRegion &pending, const CopyRegion &region)
+    {
+        if (pending.rows == 0 || pending.src != region.src || pending.dst != region.dst ||
+            pending.srcOffset + pending.rows * pending.rowBytes != region.srcOffset) {
+            return false;
+        }
+        // 两段连续数据首尾相接
+        if (pending.rows == 1 && region.rows == 1 && pending.dstOffset + pending.rowBytes == region.dstOffset) {
+            pending.rowBytes += region.rowBytes;
+            pending.dstPitch = pending.rowBytes;
+            return true;
+        }
+        // 两片行长与行距相同且目的端按行距衔接
+        if (pending.rows > 1 && region.rows > 1 && pending.rowBytes == region.rowBytes &&
+            pending.dstPitch == region.dstPitch &&
+            pending.dstOffset + pending.rows * pending.dstPitch == region.dstOffset) {
+            pending.rows += region.rows;
+            return true;
+        }
+        return false;
+    }
+
+    __aicore__ inline void Flush(const CopyRegion &region)
+    {
+        if (region.rows == 0) {
+            return;
+        }
+        srcGm.SetGlobalBuffer(region.src);
+        dstGm.SetGlobalBuffer(region.dst);
+
+        int64_t bufBytes = tiling->bufBytes;
+        int64_t alignRow = (region.rowBytes + BLOCK_BYTES - 1) / BLOCK_BYTES * BLOCK_BYTES;
+        int64_t gap = region.dstPitch - region.rowBytes;
+        if (alignRow <= bufBytes) {
+            int64_t rowsPerCopy = bufBytes / alignRow;
+            rowsPerCopy = rowsPerCopy < MAX_BLOCK_COUNT ? rowsPerCopy : MAX_BLOCK_COUNT;
+            if (gap < 0 || gap > MAX_STRIDE_BYTES) {
+                rowsPerCopy = 1;
+                gap = 0;
+            }
+            for (int64_t row = 0; row < region.rows; row += rowsPerCopy) {
+                int64_t rows = region.rows - row < rowsPerCopy ? region.rows - row : rowsPerCopy;
+                CopyRows(region.srcOffset + row * region.rowBytes, region.dstOffset + row * region.dstPitch,
+                         rows, region.rowBytes, gap);
+            }
+            return;
+        }
+        for (int64_t row = 0; row < region.rows; row++) {
+            for (int64_t off = 0; off < region.rowBytes; off += bufBytes) {
+                int64_t len = region.rowBytes - off < bufBytes ? region.rowBytes - off : bufBytes;
+                CopyRows(region.srcOffset + row * region.rowBytes + off,
+                         region.dstOffset + row * region.dstPitch + off, 1, len, 0);
+            }
+        }
+    }
+
+    __aicore__ inline void CopyRows(int64_t srcOffset, int64_t dstOffset, int64_t rows, int64_t rowBytes,
+                                    int64_t gap)
+    {
+        DataCopyExtParams inParams{static_cast<uint16_t>(rows), static_cast<uint32_t>(rowBytes), 0, 0, 0};
+        DataCopyExtParams outParams{static_cast<uint16_t>(rows), static_cast<uint32_t>(rowBytes), 0,
+                                    static_cast<uint32_t>(gap), 0};
+        DataCopyPadExtParams<uint8_t> padParams{false, 0, 0, 0};
+
+        LocalTensor<uint8_t> dataLocal = copyQueue.AllocTensor<uint8_t>();
+        DataCopyPad(dataLocal, srcGm[srcOffset], inParams, padParams);
+        copyQueue.EnQue(dataLocal);
+        dataLocal = copyQueue.DeQue<uint8_t>();
+        DataCopyPad(dstGm[dstOffset], dataLocal, outParams);
+        copyQueue.FreeTensor(dataLocal);
+    }
+};
+}  // namespace StridedSliceAssignList
+#endif  // STRIDED_SLICE_ASSIGN_LIST_H
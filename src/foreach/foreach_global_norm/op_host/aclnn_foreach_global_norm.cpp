@@ -0,0 +1,145 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file aclnn_foreach_global_norm.cpp
+ */
+
+#include <algorithm>
+#include <vector>
+#include "aclnn_foreach_global_norm.h"
+#include "foreach_global_norm_l0.h"
+#include "aclnn_kernels/contiguous.h"
+#include "aclnn_kernels/common/op_error_check.h"
+#include "opdev/common_types.h"
+#include "opdev/data_type_utils.h"
+#include "opdev/format_utils.h"
+#include "opdev/op_dfx.h"
+#include "opdev/op_executor.h"
+#include "opdev/op_log.h"
+#include "opdev/shape_utils.h"
+#include "opdev/tensor_view_utils.h"
+#include "opdev/platform.h"
+
+using namespace op;
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 单次kernel下发可处理的最大张量个数，与tiling中的MAX_TENSOR_CONT保持一致
+static constexpr uint64_t MAX_TENSOR_CONT = 50;
+
+static const std::initializer_list<op::DataType> DTYPE_SUPPORT_LIST = {
+  op::DataType::DT_FLOAT, op::DataType::DT_FLOAT16, op::DataType::DT_BF16};
+
+static bool CheckNotNull(const aclTensorList* x, const aclScalar* scalar, const aclTensor* out) {
+  OP_CHECK_NULL(x, return false);
+  OP_CHECK_NULL(scalar, return false);
+  OP_CHECK_NULL(out, return false);
+  for (uint64_t i = 0; i < x->Size(); i++) {
+    OP_CHECK_NULL((*x)[i], return false);
+  }
+  return true;
+}
+
+static bool CheckDtype(const aclTensorList* x, const aclScalar* scalar, const aclTensor* out) {
+  auto firstDtype = (*x)[0]->GetDataType();
+  for (uint64_t i = 0; i < x->Size(); i++) {
+    OP_CHECK_DTYPE_NOT_SUPPORT((*x)[i], DTYPE_SUPPORT_LIST, return false);
+    if ((*x)[i]->GetDataType() != firstDtype) {
+      OP_LOGE(ACLNN_ERR_PARAM_INVALID, "all tensors in x should have the same dtype, but x[%lu] is %s, x[0] is %s.",
+              i, op::ToString((*x)[i]->GetDataType()).GetString(), op::ToString(firstDtype).GetString());
+      return false;
+    }
+  }
+  if (scalar->GetDataType() != op::DataType::DT_FLOAT && scalar->GetDataType() != op::DataType::DT_INT64) {
+    OP_LOGE(ACLNN_ERR_PARAM_INVALID, "scalar dtype should be FLOAT or INT64, but got %s.",
+            op::ToString(scalar->GetDataType()).GetString());
+    return false;
+  }
+  OP_CHECK_DTYPE_NOT_MATCH(out, op::DataType::DT_FLOAT, return false);
+  return true;
+}
+
+static aclnnStatus CheckParams(const aclTensorList* x, const aclScalar* scalar, const aclTensor* out) {
+  // 1. 检查参数是否为空指针
+  CHECK_RET(CheckNotNull(x, scalar, out), ACLNN_ERR_PARAM_NULLPTR);
+
+  // 2. 张量列表不能为空
+  if (x->Size() == 0) {
+    OP_LOGE(ACLNN_ERR_PARAM_INVALID, "x should contain at least one tensor.");
+    return ACLNN_ERR_PARAM_INVALID;
+  }
+
+  // 3. 检查输入输出的数据类型
+  CHECK_RET(CheckDtype(x, scalar, out), ACLNN_ERR_PARAM_INVALID);
+
+  // 4. 输出为单个元素
+  if (out->GetViewShape().GetShapeSize() != 1) {
+    OP_LOGE(ACLNN_ERR_PARAM_INVALID, "out should have only one element, but got shape %s.",
+            op::ToString(out->GetViewShape()).GetString());
+    return ACLNN_ERR_PARAM_INVALID;
+  }
+  return ACLNN_SUCCESS;
+}
+
+aclnnStatus aclnnForeachGlobalNormGetWorkspaceSize(const aclTensorList* x, const aclScalar* scalar, aclTensor* out,
+                                                   uint64_t* workspaceSize, aclOpExecutor** executor) {
+  L2_DFX_PHASE_1(aclnnForeachGlobalNorm, DFX_IN(x, scalar), DFX_OUT(out));
+  // 固定写法，创建OpExecutor
+  auto uniqueExecutor = CREATE_EXECUTOR();
+  CHECK_RET(uniqueExecutor.get() != nullptr, ACLNN_ERR_INNER_CREATE_EXECUTOR);
+
+  // 固定写法，参数检查
+  auto ret = CheckParams(x, scalar, out);
+  CHECK_RET(ret == ACLNN_SUCCESS, ret);
+
+  // 固定写法，将输入x中的每个张量转换成连续的tensor
+  std::vector<const aclTensor*> xContiguous;
+  xContiguous.reserve(x->Size());
+  for (uint64_t i = 0; i < x->Size(); i++) {
+    auto tensorContiguous = l0op::Contiguous((*x)[i], uniqueExecutor.get());
+    CHECK_RET(tensorContiguous != nullptr, ACLNN_ERR_INNER_NULLPTR);
+    xContiguous.push_back(tensorContiguous);
+  }
+
+  auto scalarTensor = uniqueExecutor->ConvertToTensor(scalar, scalar->GetDataType());
+  CHECK_RET(scalarTensor != nullptr, ACLNN_ERR_INNER_NULLPTR);
+
+  // kernel单次最多处理MAX_TENSOR_CONT个张量，超出时按段下发，前一段的结果作为prev_norm并入下一段的归约
+  const aclTensor* normOut = nullptr;
+  for (uint64_t start = 0; start < xContiguous.size(); start += MAX_TENSOR_CONT) {
+    uint64_t chunkSize = std::min(MAX_TENSOR_CONT, static_cast<uint64_t>(xContiguous.size()) - start);
+    auto xChunk = uniqueExecutor->AllocTensorList(xContiguous.data() + start, chunkSize);
+    CHECK_RET(xChunk != nullptr, ACLNN_ERR_INNER_NULLPTR);
+    normOut = l0op::ForeachGlobalNorm(xChunk, scalarTensor, normOut, uniqueExecutor.get());
+    CHECK_RET(normOut != nullptr, ACLNN_ERR_INNER_NULLPTR);
+  }
+
+  // 固定写法，将计算结果拷贝到输出上，输出可能是非连续的tensor
+  auto viewCopyResult = l0op::ViewCopy(normOut, out, uniqueExecutor.get());
+  CHECK_RET(viewCopyResult != nullptr, ACLNN_ERR_INNER_NULLPTR);
+
+  // 固定写法，获取计算过程中需要使用的workspace大小
+  *workspaceSize = uniqueExecutor->GetWorkspaceSize();
+  uniqueExecutor.ReleaseTo(executor);  // 需要把uniqueExecutor持有executor转移给executor
+  return ACLNN_SUCCESS;
+}
+
+aclnnStatus aclnnForeachGlobalNorm(void* workspace, uint64_t workspaceSize, aclOpExecutor* executor,
+                                   aclrtStream stream) {
+  L2_DFX_PHASE_2(aclnnForeachGlobalNorm);
+  // 固定写法，调用框架能力，完成计算
+  return CommonOpExecutorRun(workspace, workspaceSize, executor, stream);
+}
+
+#ifdef __cplusplus
+}
+#endif
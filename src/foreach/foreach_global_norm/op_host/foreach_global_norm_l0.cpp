@@ -0,0 +1,46 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file foreach_global_norm_l0.cpp
+ */
+
+#include "foreach_global_norm_l0.h"
+#include "opdev/make_op_executor.h"
+#include "opdev/op_def.h"
+#include "opdev/op_dfx.h"
+#include "opdev/op_executor.h"
+#include "opdev/op_log.h"
+#include "opdev/shape_utils.h"
+
+using namespace op;
+
+namespace l0op {
+OP_TYPE_REGISTER(ForeachGlobalNorm);
+
+// AICORE算子kernel
+const aclTensor* ForeachGlobalNorm(const aclTensorList* x, const aclTensor* scalar, const aclTensor* prevNormOptional,
+                                   aclOpExecutor* executor) {
+    L0_DFX(ForeachGlobalNorm, x, scalar, prevNormOptional);
+    auto out = executor->AllocTensor(op::Shape{1}, op::DataType::DT_FLOAT);
+    if (out == nullptr) {
+        OP_LOGE(ACLNN_ERR_INNER_NULLPTR, "ForeachGlobalNorm alloc out tensor failed.");
+        return nullptr;
+    }
+    auto retAicore = ADD_TO_LAUNCHER_LIST_AICORE(ForeachGlobalNorm, OP_INPUT(x, scalar, prevNormOptional),
+                                                 OP_OUTPUT(out));
+    if (retAicore != ACLNN_SUCCESS) {
+        OP_LOGE(ACLNN_ERR_INNER_NULLPTR, "ForeachGlobalNorm ADD_TO_LAUNCHER_LIST_AICORE failed.");
+        return nullptr;
+    }
+    return out;
+}
+
+}  // namespace l0op
@@ -0,0 +1,25 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file foreach_global_norm_l0.h
+ */
+#ifndef OP_API_OPEN_LEVEL0_OP_FOREACH_GLOBAL_NORM_H_
+#define OP_API_OPEN_LEVEL0_OP_FOREACH_GLOBAL_NORM_H_
+
+#include "opdev/op_executor.h"
+
+namespace l0op {
+// 单次下发最多处理MAX_TENSOR_CONT个张量，prevNormOptional为前一段列表的结果，参与本段归约
+const aclTensor* ForeachGlobalNorm(const aclTensorList* x, const aclTensor* scalar, const aclTensor* prevNormOptional,
+                                   aclOpExecutor* executor);
+}
+
+#endif
@@ -0,0 +1,44 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file foreach_global_norm_tiling.cpp
+ * \brief
+ */
+
+#include "register/op_def_registry.h"
+#include "tiling/platform/platform_ascendc.h"
+#include "foreach_global_norm_tiling_def.h"
+#include "foreach_reduce_tiling_func.h"
+
+namespace optiling {
+
+// Same core split as ForeachNorm, the kernel only differs in how the middle values are folded in stage2.
+// A single launch covers at most MAX_TENSOR_CONT tensors, longer lists are split by aclnnForeachGlobalNorm
+// and chained through prev_norm instead of being truncated here.
+static ge::graphStatus Tiling4ForeachGlobalNormTiling(gert::TilingContext* context) {
+    if (context->GetDynamicInputTensor(0, MAX_TENSOR_CONT) != nullptr) {
+        return ge::GRAPH_FAILED;
+    }
+    ForeachReduceTiling tilingObject(context);
+    if (tilingObject.Init() != ge::GRAPH_SUCCESS) {
+        return ge::GRAPH_FAILED;
+    }
+    return tilingObject.RunBigKernelTiling();
+}
+
+static ge::graphStatus TilingPrepare4ForeachGlobalNormTiling(gert::TilingParseContext* context) {
+  return ge::GRAPH_SUCCESS;
+}
+
+IMPL_OP_OPTILING(ForeachGlobalNorm)
+.Tiling(Tiling4ForeachGlobalNormTiling)
+.TilingParse<ForeachNormCompileInfo>(TilingPrepare4ForeachGlobalNormTiling);
+} // namespace optiling
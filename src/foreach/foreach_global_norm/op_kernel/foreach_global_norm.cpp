@@ -0,0 +1,122 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file foreach_global_norm.cpp
+ * \brief
+ */
+
+#include "foreach_reduce_unary.h"
+
+using namespace Common::OpKernel;
+using namespace AscendC;
+
+constexpr uint8_t ONE_SCALAR_NORM_MODEL_CODE = 1;
+constexpr uint8_t TWO_SCALAR_NORM_MODEL_CODE = 2;
+
+// ord=1: sum(|x|) over every element of every tensor
+template <typename P, uint8_t modelCode>
+class GlobalNormAdapter: public ReduceAdapter<P, GlobalNormAdapter<P, modelCode>> {
+public:
+    __aicore__ inline GlobalNormAdapter() : ReduceAdapter<P, GlobalNormAdapter<P, modelCode>>(*this) {};
+
+    __aicore__ inline void BeforeReduceOp(const LocalTensor<P> &dstLocal, const LocalTensor<P> &srcLocal, int64_t dataCount) {
+        pipe_barrier(PIPE_V);
+        Abs(dstLocal, srcLocal, dataCount);
+        pipe_barrier(PIPE_V);
+    }
+
+    __aicore__ inline void AfterReduceOp(const LocalTensor<P> &dstLocal, const LocalTensor<P> &srcLocal, int64_t dataCount) {
+        pipe_barrier(PIPE_V);
+        Adds(dstLocal, srcLocal, P(0), dataCount);
+        pipe_barrier(PIPE_V);
+    }
+
+    __aicore__ inline P RevertAfterReduceOp(P value) {
+        return value;
+    }
+
+    __aicore__ inline void ReduceOp(const LocalTensor<P>& dstLocal, const LocalTensor<P>& srcLocal, const LocalTensor<P>& workLocal, int32_t count) {
+        ReduceSum<P>(dstLocal, srcLocal, workLocal, count);
+    }
+};
+
+// ord=2: sqrt(sum(x * x)) over every element of every tensor
+template <typename P>
+class GlobalNormAdapter<P, TWO_SCALAR_NORM_MODEL_CODE> : public ReduceAdapter<P, GlobalNormAdapter<P, TWO_SCALAR_NORM_MODEL_CODE>> {
+public:
+    __aicore__ inline GlobalNormAdapter() : ReduceAdapter<P, GlobalNormAdapter<P, TWO_SCALAR_NORM_MODEL_CODE>>(*this) {};
+
+    __aicore__ inline void BeforeReduceOp(const LocalTensor<P> &dstLocal, const LocalTensor<P> &srcLocal, int64_t dataCount) {
+        pipe_barrier(PIPE_V);
+        Mul(dstLocal, srcLocal, srcLocal, dataCount);
+        pipe_barrier(PIPE_V);
+    }
+
+    __aicore__ inline void AfterReduceOp(const LocalTensor<P> &dstLocal, const LocalTensor<P> &srcLocal, int64_t dataCount) {
+        pipe_barrier(PIPE_V);
+        Sqrt(dstLocal, srcLocal, dataCount);
+        pipe_barrier(PIPE_V);
+    }
+
+    __aicore__ inline P RevertAfterReduceOp(P value) {
+        return value * value;
+    }
+
+    __aicore__ inline void ReduceOp(const LocalTensor<P>& dstLocal, const LocalTensor<P>& srcLocal, const LocalTensor<P>& workLocal, int32_t count) {
+        ReduceSum<P>(dstLocal, srcLocal, workLocal, count);
+    }
+};
+
+template <typename T, uint8_t modelCode>
+__aicore__ inline void ForeachGlobalNormImpl(GM_ADDR inputs, GM_ADDR prevNorm, GM_ADDR output, GM_ADDR userWS,
+    const ForeachReduceTilingData* tilingData) {
+    GlobalNormAdapter<float, modelCode> normAdapter;
+    ForeachReduceUnary<T, float, GlobalNormAdapter<float, modelCode>> op(normAdapter);
+    op.Init(inputs, output, userWS, tilingData);
+    op.ProcessGlobal(prevNorm);
+}
+
+extern "C" __global__ __aicore__ void foreach_global_norm(GM_ADDR inputs, GM_ADDR scalar, GM_ADDR prevNorm, GM_ADDR output,
+    GM_ADDR workspace, GM_ADDR tiling) {
+    GET_TILING_DATA(tilingData, tiling);
+    if (workspace == nullptr) {
+        return;
+    }
+    SetSysWorkspace(workspace);
+    if (GetSysWorkSpacePtr() == nullptr) {
+        return;
+    }
+    GM_ADDR userWS = GetUserWorkspace(workspace);
+
+    GlobalTensor<DTYPE_SCALAR> inScalarGM;
+    inScalarGM.SetGlobalBuffer((__gm__ DTYPE_SCALAR*)scalar, 1);
+    bool isOrdOne = static_cast<int>(inScalarGM.GetValue(0)) == ONE_SCALAR_NORM_MODEL_CODE;
+
+    if (TILING_KEY_IS(1)) {
+        if (isOrdOne) {
+            ForeachGlobalNormImpl<half, ONE_SCALAR_NORM_MODEL_CODE>(inputs, prevNorm, output, userWS, &tilingData);
+        } else {
+            ForeachGlobalNormImpl<half, TWO_SCALAR_NORM_MODEL_CODE>(inputs, prevNorm, output, userWS, &tilingData);
+        }
+    } else if (TILING_KEY_IS(2)) {
+        if (isOrdOne) {
+            ForeachGlobalNormImpl<float, ONE_SCALAR_NORM_MODEL_CODE>(inputs, prevNorm, output, userWS, &tilingData);
+        } else {
+            ForeachGlobalNormImpl<float, TWO_SCALAR_NORM_MODEL_CODE>(inputs, prevNorm, output, userWS, &tilingData);
+        }
+    } else if (TILING_KEY_IS(4)) {
+        if (isOrdOne) {
+            ForeachGlobalNormImpl<bfloat16_t, ONE_SCALAR_NORM_MODEL_CODE>(inputs, prevNorm, output, userWS, &tilingData);
+        } else {
+            ForeachGlobalNormImpl<bfloat16_t, TWO_SCALAR_NORM_MODEL_CODE>(inputs, prevNorm, output, userWS, &tilingData);
+        }
+    }
+}
@@ -0,0 +1,173 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file main.cpp
+ */
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "grid_sample_cost_model.h"
+
+#define SUCCESS 0
+#define FAILED 1
+
+#define INFO_LOG(fmt, args...) fprintf(stdout, "[INFO]  " fmt "\n", ##args)
+#define ERROR_LOG(fmt, args...) fprintf(stderr, "[ERROR]  " fmt "\n", ##args)
+
+using optiling::GridSampleCost;
+using optiling::GridSampleCostParam;
+using optiling::GridSampleSchedule;
+
+namespace {
+constexpr int64_t DEFAULT_CORE_NUM = 48;
+constexpr int32_t SCHEDULE_NUM = static_cast<int32_t>(GridSampleSchedule::SCHEDULE_NUM);
+
+struct ExpectCase {
+    GridSampleCostParam param;
+    GridSampleSchedule expect;
+};
+
+const char *ScheduleName(GridSampleSchedule schedule)
+{
+    switch (schedule) {
+        case GridSampleSchedule::GENERIC:
+            return "generic";
+        case GridSampleSchedule::SLIDE_WINDOW:
+            return "slide_window";
+        case GridSampleSchedule::FULL_LOAD:
+            return "full_load";
+        default:
+            return "unknown";
+    }
+}
+
+void PrintCost(const GridSampleCost &cost)
+{
+    if (!cost.capable) {
+        printf(" %12s %10s %8s", "-", "-", "-");
+        return;
+    }
+    printf(" %12ld %10ld %8ld", cost.totalCycles, cost.mte2Bytes, cost.dmaNum);
+}
+
+// 选中模板必须可用且代价最小，全载只能在x可放入UB时选中，fp16不能选通用模板
+bool CheckChoice(const GridSampleCostParam &param, GridSampleSchedule choice, const GridSampleCost *costs)
+{
+    const GridSampleCost &chosen = costs[static_cast<int32_t>(choice)];
+    if (!chosen.capable) {
+        return false;
+    }
+    for (int32_t i = 0; i < SCHEDULE_NUM; i++) {
+        if (costs[i].capable && costs[i].totalCycles < chosen.totalCycles) {
+            return false;
+        }
+    }
+    if (choice == GridSampleSchedule::FULL_LOAD &&
+        param.inC * param.inH * param.inW > optiling::gridsample_cost::FULL_LOAD_MAX_HWC) {
+        return false;
+    }
+    return !(choice == GridSampleSchedule::GENERIC && param.dtypeSize != optiling::gridsample_cost::FP32_SIZE);
+}
+
+GridSampleCostParam MakeParam(int64_t dtypeSize, int64_t n, int64_t c, int64_t inHW, int64_t outHW, int64_t coreNum)
+{
+    GridSampleCostParam param;
+    param.inN = n;
+    param.inC = c;
+    param.inH = inHW;
+    param.inW = inHW;
+    param.outH = outHW;
+    param.outW = outHW;
+    param.dtypeSize = dtypeSize;
+    param.coreNum = coreNum;
+    return param;
+}
+}  // namespace
+
+int main(int argc, char **argv)
+{
+    int64_t coreNum = DEFAULT_CORE_NUM;
+    if (argc > 1) {
+        coreNum = atoll(argv[1]);
+    }
+    if (coreNum < 1) {
+        ERROR_LOG("core num should be positive, got %ld", coreNum);
+        return FAILED;
+    }
+
+    const std::vector<int64_t> dtypeList = {4, 2};
+    const std::vector<int64_t> nList = {1, 8, 32};
+    const std::vector<int64_t> cList = {1, 4, 16, 32, 64};
+    const std::vector<int64_t> inHWList = {16, 32, 64, 128, 512};
+    const std::vector<int64_t> outHWList = {8, 64, 256, 1024};
+
+    INFO_LOG("GridSample schedule sweep, core num %ld, cycles / mte2 bytes / dma num per core", coreNum);
+    printf("%-5s %4s %4s %6s %6s | %32s | %32s | %32s | %s\n", "dtype", "N", "C", "in", "out", "generic",
+        "slide_window", "full_load", "choice");
+
+    int64_t caseNum = 0;
+    int64_t failNum = 0;
+    int64_t choiceNum[SCHEDULE_NUM] = {0};
+    GridSampleCost costs[SCHEDULE_NUM];
+    for (auto dtypeSize : dtypeList) {
+        for (auto n : nList) {
+            for (auto c : cList) {
+                for (auto inHW : inHWList) {
+                    for (auto outHW : outHWList) {
+                        GridSampleCostParam param = MakeParam(dtypeSize, n, c, inHW, outHW, coreNum);
+                        GridSampleSchedule choice = optiling::SelectGridSampleSchedule(param, costs);
+                        printf("%-5s %4ld %4ld %6ld %6ld |", dtypeSize == 4 ? "fp32" : "fp16", n, c, inHW, outHW);
+                        for (int32_t i = 0; i < SCHEDULE_NUM; i++) {
+                            PrintCost(costs[i]);
+                            printf(" |");
+                        }
+                        printf(" %s\n", ScheduleName(choice));
+                        caseNum++;
+                        choiceNum[static_cast<int32_t>(choice)]++;
+                        if (!CheckChoice(param, choice, costs)) {
+                            ERROR_LOG("invalid choice %s", ScheduleName(choice));
+                            failNum++;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // 代表性场景的期望选择：大图多通道走通用，小通道缩放不大走滑窗，小图大grid走全载，小grid大图走滑窗而不是全载
+    const std::vector<ExpectCase> expectCases = {
+        {MakeParam(4, 8, 64, 512, 512, coreNum), GridSampleSchedule::GENERIC},
+        {MakeParam(4, 8, 4, 128, 128, coreNum), GridSampleSchedule::SLIDE_WINDOW},
+        {MakeParam(4, 8, 1, 32, 256, coreNum), GridSampleSchedule::FULL_LOAD},
+        {MakeParam(2, 8, 1, 32, 256, coreNum), GridSampleSchedule::FULL_LOAD},
+        {MakeParam(2, 1, 16, 512, 64, coreNum), GridSampleSchedule::SLIDE_WINDOW},
+    };
+    for (const auto &expectCase : expectCases) {
+        GridSampleSchedule choice = optiling::SelectGridSampleSchedule(expectCase.param, costs);
+        if (choice != expectCase.expect) {
+            ERROR_LOG("dtype size %ld N %ld C %ld in %ld out %ld: expect %s, got %s", expectCase.param.dtypeSize,
+                expectCase.param.inN, expectCase.param.inC, expectCase.param.inH, expectCase.param.outH,
+                ScheduleName(expectCase.expect), ScheduleName(choice));
+            failNum++;
+        }
+    }
+
+    INFO_LOG("cases %ld, generic %ld, slide_window %ld, full_load %ld", caseNum, choiceNum[0], choiceNum[1],
+        choiceNum[2]);
+    if (failNum != 0) {
+        ERROR_LOG("%ld checks failed", failNum);
+        return FAILED;
+    }
+    INFO_LOG("all checks passed");
+    return SUCCESS;
+}
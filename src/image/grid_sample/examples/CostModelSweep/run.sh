@@ -0,0 +1,21 @@
+#!/bin/bash
+# Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+# This file is a part of the CANN Open Software.
+# Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+# ======================================================================================================================
+set -e
+
+CURRENT_DIR=$(cd "$(dirname "$0")" && pwd)
+cd $CURRENT_DIR
+
+rm -rf build
+mkdir -p build
+g++ -std=c++17 -O2 -Wall -I../../op_host main.cpp -o build/cost_model_sweep
+echo "INFO: compile cost model sweep success!"
+
+# 可选参数为AIV核数，默认48
+./build/cost_model_sweep "$@"
@@ -46,10 +46,14 @@ static const int64_t SPATIAL_GRID_LAST_DIM_SIZE = 2;
 static const int64_t SPATIAL_DIM_NUM = 4;
 static const int64_t AICORE_MAX_SIZE_310P = 20480;
 static const int64_t SUPPORT_CHANNEL_310P = 32;
+static const int64_t FLOW_WARP_MAX_FLOW_W = 1024;
+static const int64_t FLOW_WARP_MIN_HW = 2;
 
 // 根据API定义，需要列出所能支持的所有dtype
 static const std::initializer_list<op::DataType> DTYPE_SUPPORT_LIST = {
     op::DataType::DT_FLOAT, op::DataType::DT_FLOAT16, op::DataType::DT_DOUBLE};
+static const std::initializer_list<op::DataType> FLOW_WARP_DTYPE_SUPPORT_LIST = {
+    op::DataType::DT_FLOAT, op::DataType::DT_FLOAT16};
 
 static bool CheckNotNull(const aclTensor *input, const aclTensor *grid, const aclTensor *out)
 {
@@ -294,6 +298,116 @@ aclnnStatus aclnnGridSampler2D(void *workspace, uint64_t workspaceSize, aclOpExe
     return CommonOpExecutorRun(workspace, workspaceSize, executor, stream);
 }
 
+static bool CheckFlowWarpShape(const aclTensor *input, const aclTensor *flow, const aclTensor *out)
+{
+    OP_CHECK_WRONG_DIMENSION(input, SPATIAL_DIM_NUM, return false);
+    OP_CHECK_WRONG_DIMENSION(flow, SPATIAL_DIM_NUM, return false);
+    OP_CHECK_WRONG_DIMENSION(out, SPATIAL_DIM_NUM, return false);
+
+    const auto &inputShape = input->GetViewShape();
+    const auto &flowShape = flow->GetViewShape();
+    const auto &outShape = out->GetViewShape();
+    if (inputShape != outShape || inputShape.GetDim(FIRST_DIM) != flowShape.GetDim(FIRST_DIM)) {
+        OP_LOGE(ACLNN_ERR_PARAM_INVALID,
+            "expect out to have the shape of input and flow to have its batch size, but got input with shape [%s] \
+            flow with shape [%s] and out with shape [%s]",
+            op::ToString(inputShape).GetString(),
+            op::ToString(flowShape).GetString(),
+            op::ToString(outShape).GetString());
+        return false;
+    }
+    if (flowShape.GetDim(FOURTH_DIM) != SPATIAL_GRID_LAST_DIM_SIZE || flowShape.GetDim(SECOND_DIM) < 1 ||
+        flowShape.GetDim(THIRD_DIM) < 1 || flowShape.GetDim(THIRD_DIM) > FLOW_WARP_MAX_FLOW_W) {
+        OP_LOGE(ACLNN_ERR_PARAM_INVALID,
+            "expect flow to be (N, h, w, 2) with 1 <= w <= %ld, but got flow with shape [%s]",
+            FLOW_WARP_MAX_FLOW_W,
+            op::ToString(flowShape).GetString());
+        return false;
+    }
+    if (inputShape.GetDim(THIRD_DIM) < FLOW_WARP_MIN_HW || inputShape.GetDim(FOURTH_DIM) < FLOW_WARP_MIN_HW) {
+        OP_LOGE(ACLNN_ERR_PARAM_INVALID,
+            "expect input to have H and W >= %ld, but got input with shape [%s]",
+            FLOW_WARP_MIN_HW,
+            op::ToString(inputShape).GetString());
+        return false;
+    }
+    return true;
+}
+
+static aclnnStatus CheckFlowWarpParams(
+    const aclTensor *input, const aclTensor *flow, int64_t paddingMode, const aclTensor *out)
+{
+    CHECK_RET(CheckNotNull(input, flow, out), ACLNN_ERR_PARAM_NULLPTR);
+
+    OP_CHECK_DTYPE_NOT_MATCH(flow, input->GetDataType(), return ACLNN_ERR_PARAM_INVALID);
+    OP_CHECK_DTYPE_NOT_MATCH(out, input->GetDataType(), return ACLNN_ERR_PARAM_INVALID);
+    OP_CHECK_DTYPE_NOT_SUPPORT(input, FLOW_WARP_DTYPE_SUPPORT_LIST, return ACLNN_ERR_PARAM_INVALID);
+
+    if (paddingMode != PADDING_MODE_MIN_VALUE && paddingMode != PADDING_MODE_MIN_VALUE + 1) {
+        OP_LOGE(ACLNN_ERR_PARAM_INVALID,
+            "paddingMode %ld should be in support list {0(zeros), 1(border)} for flow warp.",
+            paddingMode);
+        return ACLNN_ERR_PARAM_INVALID;
+    }
+
+    bool is910bSocVersion = (GetCurrentPlatformInfo().GetSocVersion() == SocVersion::ASCEND910B ||
+                             GetCurrentPlatformInfo().GetSocVersion() == SocVersion::ASCEND910_93);
+    if (!is910bSocVersion) {
+        OP_LOGE(ACLNN_ERR_PARAM_INVALID, "flow warp is only supported on Atlas A2/A3.");
+        return ACLNN_ERR_PARAM_INVALID;
+    }
+
+    CHECK_RET(CheckFlowWarpShape(input, flow, out), ACLNN_ERR_PARAM_INVALID);
+    return ACLNN_SUCCESS;
+}
+
+aclnnStatus aclnnGridSampler2DFlowWarpGetWorkspaceSize(const aclTensor *input, const aclTensor *flow,
+    int64_t paddingMode, bool alignCorners, aclTensor *out, uint64_t *workspaceSize, aclOpExecutor **executor)
+{
+    L2_DFX_PHASE_1(aclnnGridSampler2DFlowWarp, DFX_IN(input, flow, paddingMode, alignCorners), DFX_OUT(out));
+    auto uniqueExecutor = CREATE_EXECUTOR();
+    CHECK_RET(uniqueExecutor.get() != nullptr, ACLNN_ERR_INNER_CREATE_EXECUTOR);
+
+    auto ret = CheckFlowWarpParams(input, flow, paddingMode, out);
+    CHECK_RET(ret == ACLNN_SUCCESS, ret);
+
+    if (input->IsEmpty() || flow->IsEmpty()) {
+        *workspaceSize = 0;
+        uniqueExecutor.ReleaseTo(executor);
+        return ACLNN_SUCCESS;
+    }
+
+    auto inputContiguous = l0op::Contiguous(input, uniqueExecutor.get());
+    CHECK_RET(inputContiguous != nullptr, ACLNN_ERR_INNER_NULLPTR);
+    auto flowContiguous = l0op::Contiguous(flow, uniqueExecutor.get());
+    CHECK_RET(flowContiguous != nullptr, ACLNN_ERR_INNER_NULLPTR);
+
+    // transpose NCHW to NHWC, the kernel gathers whole channel rows
+    int64_t perm[4] = {0, 2, 3, 1};
+    auto valuePerm = uniqueExecutor.get()->AllocIntArray(perm, 4);
+    inputContiguous = l0op::Transpose(inputContiguous, valuePerm, uniqueExecutor.get());
+    CHECK_RET(inputContiguous != nullptr, ACLNN_ERR_INNER_NULLPTR);
+
+    OP_LOGD("Lanuch GridSampleFlowWarp in AICore. Attrs: [%ld], [%d]", paddingMode, alignCorners);
+    auto flowWarpOut =
+        l0op::GridSampleFlowWarp(inputContiguous, flowContiguous, paddingMode, alignCorners, uniqueExecutor.get());
+    CHECK_RET(flowWarpOut != nullptr, ACLNN_ERR_INNER_NULLPTR);
+
+    auto viewCopyResult = l0op::ViewCopy(flowWarpOut, out, uniqueExecutor.get());
+    CHECK_RET(viewCopyResult != nullptr, ACLNN_ERR_INNER_NULLPTR);
+
+    *workspaceSize = uniqueExecutor->GetWorkspaceSize();
+    uniqueExecutor.ReleaseTo(executor);
+    return ACLNN_SUCCESS;
+}
+
+aclnnStatus aclnnGridSampler2DFlowWarp(
+    void *workspace, uint64_t workspaceSize, aclOpExecutor *executor, aclrtStream stream)
+{
+    L2_DFX_PHASE_2(aclnnGridSampler2DFlowWarp);
+    return CommonOpExecutorRun(workspace, workspaceSize, executor, stream);
+}
+
 #ifdef __cplusplus
 }
 #endif
\ No newline at end of file
@@ -79,6 +79,53 @@ __attribute__((visibility("default"))) aclnnStatus aclnnGridSampler2DGetWorkspac
 __attribute__((visibility("default"))) aclnnStatus aclnnGridSampler2D(
     void *workspace, uint64_t workspaceSize, aclOpExecutor *executor, aclrtStream stream);
 
+/**
+ * @brief aclnnGridSampler2DFlowWarp的第一段接口，根据具体的计算流程，计算workspace大小。
+ * @domain aclnn_ops_infer
+ *
+ * 算子功能：光流warp融合接口。flow为低分辨率、以低分辨率像素为单位的光流，在UB内双线性上采样到input的H、W并换算为
+ * 采样坐标，再对input做双线性采样，等价于upsample_bilinear2d(flow) * scale + 坐标归一化 + GridSampler2D，
+ * 中间结果不落HBM。
+ *
+ * api计算的基本路径：
+ * ```mermaid
+ * graph LR
+ *     A[(input)] --> B([l0op::Contiguous]) --> T([l0op::Transpose]) --> C([l0op::GridSampleFlowWarp])
+ *     D[(flow)] --> E([l0op::Contiguous]) --> C
+ *     G((paddingMode)) --> C
+ *     H((alignCorners)) --> C
+ *     C --> I([l0op::ViewCopy]) --> Out[(out)]
+ * ```
+ *
+ * @param [in] input: npu device侧的aclTensor，shape为(N, C, H, W)，数据类型支持FLOAT、FLOAT16，支持非连续的Tensor，
+ * 数据格式支持ND。
+ * @param [in] flow: npu device侧的aclTensor，shape为(N, h, w, 2)，最后一维为(dx, dy)，单位为低分辨率像素，
+ * 数据类型与input一致，支持非连续的Tensor，数据格式支持ND。
+ * @param [in] paddingMode：host侧的int64_t，表示填充模式，支持0：zeros、1：border。
+ * @param [in] alignCorners：host侧的bool，表示flow上采样时的角点对齐方式，与upsample_bilinear2d的align_corners一致。
+ * @param [in] out: npu device侧的aclTensor，shape为(N, C, H, W)，数据类型与input一致，支持非连续的Tensor，
+ * 数据格式支持ND。
+ * @param [out] workspaceSize: 返回用户需要在npu device侧申请的workspace大小。
+ * @param [out] executor: 返回op执行器，包含算子计算流程。
+ * @return aclnnStatus: 返回状态码。
+ */
+__attribute__((visibility("default"))) aclnnStatus aclnnGridSampler2DFlowWarpGetWorkspaceSize(const aclTensor *input,
+    const aclTensor *flow, int64_t paddingMode, bool alignCorners, aclTensor *out, uint64_t *workspaceSize,
+    aclOpExecutor **executor);
+
+/**
+ * @brief aclnnGridSampler2DFlowWarp的第二段接口，用于执行计算。
+ *
+ * @param [in] workspace: 在npu device侧申请的workspace内存起址。
+ * @param [in] workspace_size: 在npu device侧申请的workspace大小，由第一段接口
+ * aclnnGridSampler2DFlowWarpGetWorkspaceSize获取。
+ * @param [in] executor: op执行器，包含了算子计算流程。
+ * @param [in] stream: acl stream流。
+ * @return aclnnStatus: 返回状态码。
+ */
+__attribute__((visibility("default"))) aclnnStatus aclnnGridSampler2DFlowWarp(
+    void *workspace, uint64_t workspaceSize, aclOpExecutor *executor, aclrtStream stream);
+
 #ifdef __cplusplus
 }
 #endif
@@ -70,13 +70,15 @@ static const int64_t CHANEL_LAST_TRUE = 1;
 static const int64_t CHANEL_LAST_FALSE = 0;
 const static int64_t SIZE_16 = 16;
 const static int64_t LENGTH_1024 = 1024;
+const static int64_t NORMAL_TYPE = 1;
 const static int64_t FULL_LOAD_TYPE = 2;
 const static int64_t X_MAX_HWC_FACTOR = 20480;  // 20k
-const static int64_t C1_X_COUNT = 4096;
-const static int64_t NUM_C32 = 32;
-const static int64_t MIN_HW_C32 = 8;
-const static int64_t TEMPLATE_C32 = 2;
 const static int64_t DOUBLE = 2;
+const static int64_t FLOW_WARP_TYPE = 3;
+const static int64_t FLOW_WARP_CAL_W = 64;
+const static int64_t FLOW_WARP_MAX_FLOW_W = 1024;
+const static int64_t FLOW_WARP_MIN_HW = 2;
+const static size_t ATTR_IDX_FLOW_WARP = 5;
 
 uint64_t GridSampleTiling::GetTilingKey() const
 {
@@ -199,6 +201,9 @@ ge::graphStatus GridSampleTiling::GetShapeAttrsInfo()
         channelLast = CHANEL_LAST_TRUE;
     }
 
+    const bool *pFlowWarp = attrs->GetAttrPointer<bool>(ATTR_IDX_FLOW_WARP);
+    flowWarp = (pFlowWarp != nullptr && *pFlowWarp) ? 1 : 0;
+
     inN = xShape.GetDim(0);
     if (dimension == 0) {
         if (channelLast == 0) {
@@ -218,13 +223,7 @@ ge::graphStatus GridSampleTiling::GetShapeAttrsInfo()
             tempType = FULL_LOAD_TYPE;
             hwFactor = TILING_HW_FACTOR;
             OP_LOGD(context_->GetNodeName(), "Get in FullLoad Template.");
-            if ((inC == 1) && (inH * inW < C1_X_COUNT)) {
-                templateCNum = 1;
-            } else if ((inC == NUM_C32) && (inH > MIN_HW_C32) && (inW > MIN_HW_C32)) {
-                templateCNum = TEMPLATE_C32;
-            } else {
-                templateCNum = 0;
-            }
+            templateCNum = GetGridSampleFullLoadCNum(inC, inH, inW);
         }
 
         OP_TILING_CHECK(inN < 1 || inC < 1 || inH < 1 || inW < 1 || outW < 1 || outH < 1,
@@ -246,7 +245,15 @@ ge::graphStatus GridSampleTiling::GetShapeAttrsInfo()
             VECTOR_INNER_ERR_REPORT_TILIING(
                 context_->GetNodeName(), "scheduler_mode support 1 only in the channel last scenario."),
             return ge::GRAPH_FAILED);
+        if (flowWarp == 1) {
+            OP_TILING_CHECK(GetFlowWarpInfo(gridDtype) != ge::GRAPH_SUCCESS,
+                VECTOR_INNER_ERR_REPORT_TILIING(context_->GetNodeName(), "flow_warp check failed."),
+                return ge::GRAPH_FAILED);
+        }
     } else {
+        OP_TILING_CHECK(flowWarp == 1,
+            VECTOR_INNER_ERR_REPORT_TILIING(context_->GetNodeName(), "flow_warp only support 2D input."),
+            return ge::GRAPH_FAILED);
         if (channelLast == 0) {
             inC = xShape.GetDim(1);
             inD = xShape.GetDim(DIM_2);
@@ -281,6 +288,38 @@ ge::graphStatus GridSampleTiling::GetShapeAttrsInfo()
     return ge::GRAPH_SUCCESS;
 }
 
+ge::graphStatus GridSampleTiling::GetFlowWarpInfo(ge::DataType gridDtype)
+{
+    // grid is the low-res flow (N, h, w, 2) in pixels, it is upsampled to (H, W) of x in UB and y is (N, C, H, W)
+    OP_TILING_CHECK(channelLast != CHANEL_LAST_TRUE || interpolationMode != INTERPOLATION_MODE_BILNEAR,
+        VECTOR_INNER_ERR_REPORT_TILIING(
+            context_->GetNodeName(), "flow_warp only support channel last x and bilinear interpolation."),
+        return ge::GRAPH_FAILED);
+    OP_TILING_CHECK(paddingMode == PADDING_MODE_REFLECTION,
+        VECTOR_INNER_ERR_REPORT_TILIING(context_->GetNodeName(), "flow_warp only support zeros or border padding."),
+        return ge::GRAPH_FAILED);
+    OP_TILING_CHECK(gridDtype != xDtype,
+        VECTOR_INNER_ERR_REPORT_TILIING(context_->GetNodeName(), "flow_warp need the same datatype of x and flow."),
+        return ge::GRAPH_FAILED);
+    OP_TILING_CHECK(outW > FLOW_WARP_MAX_FLOW_W,
+        VECTOR_INNER_ERR_REPORT_TILIING(
+            context_->GetNodeName(), "flow_warp only support flow W <= %ld, got %ld.", FLOW_WARP_MAX_FLOW_W, outW),
+        return ge::GRAPH_FAILED);
+    OP_TILING_CHECK(inH < FLOW_WARP_MIN_HW || inW < FLOW_WARP_MIN_HW,
+        VECTOR_INNER_ERR_REPORT_TILIING(context_->GetNodeName(), "flow_warp need H and W of x >= 2."),
+        return ge::GRAPH_FAILED);
+
+    flowH = outH;
+    flowW = outW;
+    outH = inH;
+    outW = inW;
+    tempType = FLOW_WARP_TYPE;
+    templateCNum = 0;
+    schedulerMode = 0;
+    OP_LOGD(context_->GetNodeName(), "Get in FlowWarp Template, flow: %ld x %ld.", flowH, flowW);
+    return ge::GRAPH_SUCCESS;
+}
+
 ge::graphStatus GridSampleTiling::GetPlatformInfo()
 {
     auto compileInfo = reinterpret_cast<const GridSampleCompileInfo *>(context_->GetCompileInfo());
@@ -293,10 +332,50 @@ ge::graphStatus GridSampleTiling::GetPlatformInfo()
         OP_LOGD(context_->GetNodeName(), "Entering into get core num from platform.");
         auto ascendcPlatform = platform_ascendc::PlatformAscendC(platformInfoPtr);
         coreNumVar = ascendcPlatform.GetCoreNumAiv();
+        // 代价模型只覆盖910B/910_93上的通用、滑窗、全载模板，其余平台沿用scheduler_mode选择
+        auto socVersion = ascendcPlatform.GetSocVersion();
+        costModelEnable = (socVersion == platform_ascendc::SocVersion::ASCEND910B ||
+                              socVersion == platform_ascendc::SocVersion::ASCEND910_93) &&
+                          dimension == 0 && channelLast == CHANEL_LAST_TRUE &&
+                          interpolationMode == INTERPOLATION_MODE_BILNEAR && tempType != FLOW_WARP_TYPE;
     }
     return ge::GRAPH_SUCCESS;
 }
 
+void GridSampleTiling::SelectScheduleByCostModel()
+{
+    GridSampleCostParam param;
+    param.inN = inN;
+    param.inC = inC;
+    param.inH = inH;
+    param.inW = inW;
+    param.outH = outH;
+    param.outW = outW;
+    param.dtypeSize = xDtype == ge::DT_FLOAT16 ? sizeof(uint16_t) : sizeof(float);
+    param.coreNum = coreNumVar;
+
+    GridSampleCost costs[static_cast<int32_t>(GridSampleSchedule::SCHEDULE_NUM)];
+    GridSampleSchedule schedule = SelectGridSampleSchedule(param, costs);
+    OP_LOGD(context_->GetNodeName(),
+        "cost model cycles generic:%ld, slide window:%ld, full load:%ld, choose:%d.",
+        costs[static_cast<int32_t>(GridSampleSchedule::GENERIC)].totalCycles,
+        costs[static_cast<int32_t>(GridSampleSchedule::SLIDE_WINDOW)].totalCycles,
+        costs[static_cast<int32_t>(GridSampleSchedule::FULL_LOAD)].totalCycles,
+        static_cast<int32_t>(schedule));
+
+    if (schedule == GridSampleSchedule::FULL_LOAD) {
+        tempType = FULL_LOAD_TYPE;
+        hwFactor = TILING_HW_FACTOR;
+        templateCNum = GetGridSampleFullLoadCNum(inC, inH, inW);
+        schedulerMode = 1;
+        return;
+    }
+    tempType = NORMAL_TYPE;
+    hwFactor = gridsample_cost::CAL_H_W_BLOCK;
+    templateCNum = 0;
+    schedulerMode = schedule == GridSampleSchedule::SLIDE_WINDOW ? 1 : 0;
+}
+
 bool GridSampleTiling::IsCapable()
 {
     return true;
@@ -315,6 +394,10 @@ ge::graphStatus GridSampleTiling::GetWorkspaceSize()
         needCoreNum = inN;
     }
     workspaceSize_ = SIZE_16 * LENGTH_1024 * LENGTH_1024;
+    if (tempType == FLOW_WARP_TYPE) {
+        // flow warp keeps everything in UB
+        return ge::GRAPH_SUCCESS;
+    }
     if (xDtype == ge::DT_FLOAT16 || xDtype == ge::DT_BF16) {
         // 每个核使用inC * 512(1024) * dtype(float),再乘上核数
         size_t outputShapeSize = needCoreNum * inC * hwFactor * sizeof(float);
@@ -329,6 +412,9 @@ ge::graphStatus GridSampleTiling::GetWorkspaceSize()
 
 ge::graphStatus GridSampleTiling::DoOpTiling()
 {
+    if (costModelEnable) {
+        SelectScheduleByCostModel();
+    }
     tilingData.set_coreNumVar(coreNumVar);
     tilingData.set_inN(inN);
     tilingData.set_inC(inC);
@@ -343,6 +429,21 @@ ge::graphStatus GridSampleTiling::DoOpTiling()
     tilingData.set_alignCorners(alignCorners);
     tilingData.set_channelLast(channelLast);
 
+    tilingData.set_flowH(flowH);
+    tilingData.set_flowW(flowW);
+
+    if (tempType == FLOW_WARP_TYPE) {
+        // one task is FLOW_WARP_CAL_W pixels of an output row, first preCoreNum cores take one task more
+        int64_t taskNum = inN * inH * ((inW + FLOW_WARP_CAL_W - 1) / FLOW_WARP_CAL_W);
+        int64_t usedCoreNum = taskNum < coreNumVar ? taskNum : coreNumVar;
+        int64_t preNumPerCore = (taskNum + usedCoreNum - 1) / usedCoreNum;
+        tilingData.set_needCoreNum(usedCoreNum);
+        tilingData.set_preNumPerCore(preNumPerCore);
+        tilingData.set_postNumPerCore(preNumPerCore - 1);
+        tilingData.set_preCoreNum(taskNum - (preNumPerCore - 1) * usedCoreNum);
+        return ge::GRAPH_SUCCESS;
+    }
+
     // output format is [N, C, H, W]
     int64_t outputD = outD == 0 ? 1 : outD;
     int64_t outputHW = outH * outW * outputD;
@@ -427,6 +528,7 @@ constexpr uint64_t Y_DIM_IDX_DIMS_START = 2;
 constexpr uint64_t Y_DIM_IDX_H = 2;
 constexpr uint64_t Y_DIM_IDX_W = 3;
 constexpr uint64_t ATTR_IDX_CHANNEL_LAST = 3;
+constexpr uint64_t ATTR_IDX_FLOW_WARP = 5;
 constexpr uint64_t NUM_1 = 1;
 constexpr uint64_t NUM_2 = 2;
 constexpr uint64_t NUM_3 = 3;
@@ -474,6 +576,12 @@ static ge::graphStatus InferGridSampleShape2D(
 
     int64_t hDim = gridShape->GetDim(1U);
     int64_t wDim = gridShape->GetDim(GRID_DIM_IDX_W);
+    // flow warp: grid is the low-res flow, y keeps H and W of the channel last x
+    const bool *flowWarp = attrs->GetAttrPointer<bool>(ATTR_IDX_FLOW_WARP);
+    if (flowWarp != nullptr && *flowWarp) {
+        hDim = xShape->GetDim(1U);
+        wDim = xShape->GetDim(GRID_DIM_IDX_W);
+    }
 
     yShape->SetDimNum(DIM_NUM_2D);
     yShape->SetDim(0, nDim);
@@ -637,9 +745,12 @@ static ge::graphStatus InferGridSampleShapeRange(gert::InferShapeRangeContext *c
         // For GridSample-2D, set range for H/W
         // For GridSample-3D, set range for D/H/W
         // For GridSample-nD, set range for H/W/....
+        // For flow warp, H/W follow x
+        const bool *flowWarp = attrs->GetAttrPointer<bool>(ATTR_IDX_FLOW_WARP);
+        auto spatialRange = (flowWarp != nullptr && *flowWarp) ? xRange : gridRange;
         for (size_t axis = Y_DIM_IDX_DIMS_START; axis < xDimNum; ++axis) {
-            yRange->GetMin()->SetDim(axis, gridRange->GetMin()->GetDim(axis - 1));
-            yRange->GetMax()->SetDim(axis, gridRange->GetMax()->GetDim(axis - 1));
+            yRange->GetMin()->SetDim(axis, spatialRange->GetMin()->GetDim(axis - 1));
+            yRange->GetMax()->SetDim(axis, spatialRange->GetMax()->GetDim(axis - 1));
         }
     }
 
@@ -727,6 +838,7 @@ public:
         this->Attr("align_corners").AttrType(OPTIONAL).Bool(false);
         this->Attr("channel_last").AttrType(OPTIONAL).Bool(false);
         this->Attr("scheduler_mode").AttrType(OPTIONAL).Int(1);
+        this->Attr("flow_warp").AttrType(OPTIONAL).Bool(false);
 
         OpAICoreConfig aicore_config;
         aicore_config.DynamicCompileStaticFlag(true)
@@ -0,0 +1,304 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file grid_sample_cost_model.h
+ * \brief 2D bilinear channel last场景下通用、滑窗、全载模板的代价估计与选择，不依赖CANN头文件，可在host侧单独编译
+ */
+#ifndef OPS_BUILT_IN_OP_TILING_RUNTIME_GRID_SAMPLE_COST_MODEL_H
+#define OPS_BUILT_IN_OP_TILING_RUNTIME_GRID_SAMPLE_COST_MODEL_H
+#include <cstdint>
+
+namespace optiling {
+
+enum class GridSampleSchedule : int32_t { GENERIC = 0, SLIDE_WINDOW = 1, FULL_LOAD = 2, SCHEDULE_NUM = 3 };
+
+struct GridSampleCostParam {
+    int64_t inN = 0;
+    int64_t inC = 0;
+    int64_t inH = 0;
+    int64_t inW = 0;
+    int64_t outH = 0;
+    int64_t outW = 0;
+    int64_t dtypeSize = 4;  // x的数据类型字节数，4为float32，2为float16
+    int64_t coreNum = 1;
+};
+
+struct GridSampleCost {
+    bool capable = false;
+    int64_t mte2Bytes = 0;     // 单核GM->UB搬运字节数
+    int64_t dmaNum = 0;        // 单核MTE2指令条数
+    int64_t vectorCycles = 0;  // 单核vector估计cycle
+    int64_t totalCycles = 0;   // 单核估计总cycle，kernel内MTE2与vector基本串行，取二者之和
+};
+
+namespace gridsample_cost {
+// 与kernel侧常量保持一致
+constexpr int64_t CAL_H_W_BLOCK = 512;                   // 通用、滑窗模板单次处理的输出点数
+constexpr int64_t CHANNEL_BLOCK = 64;                    // 通用模板单次处理的通道数
+constexpr int64_t SLIDING_WINDOW_C_LIMIT = 16;           // 滑窗模板支持的最大通道数
+constexpr int64_t SLIDE_X_UB_BYTES_FP32 = 81920;         // fp32滑窗x的UB大小
+constexpr int64_t SLIDE_X_UB_BYTES_FP16 = 65536;         // fp16滑窗x的UB大小
+constexpr int64_t FULL_LOAD_MAX_HWC = 20480;             // 全载模板x的最大元素个数
+constexpr int64_t FULL_LOAD_H_W_BLOCK = 1024;
+constexpr int64_t FULL_LOAD_C1_H_W_BLOCK = 2048;
+constexpr int64_t FULL_LOAD_C32_H_W_BLOCK = 512;
+constexpr int64_t FULL_LOAD_C1_X_COUNT = 4096;
+constexpr int64_t FULL_LOAD_C32 = 32;
+constexpr int64_t FULL_LOAD_C32_MIN_HW = 8;
+
+// 硬件代价参数，按910B单个AIV核估计
+constexpr int64_t MTE2_BYTES_PER_CYCLE = 32;   // 所有核同时搬运时单核分到的GM带宽
+constexpr int64_t DMA_BURST_BYTES = 32;        // DMA最小搬运粒度
+constexpr int64_t DMA_ISSUE_CYCLES = 40;       // 单条DataCopyPad的下发与标量计算开销
+constexpr int64_t SYNC_CYCLES = 300;           // 一次跨流水SetFlag/WaitFlag等待
+constexpr int64_t VEC_ISSUE_CYCLES = 8;        // 单条vector指令下发开销
+constexpr int64_t VEC_BYTES_PER_REPEAT = 256;  // 单个repeat处理字节数
+constexpr int64_t GATHER_ELEMS_PER_CYCLE = 8;  // Gather每cycle取数个数
+constexpr int64_t COORD_VEC_INSTR = 48;        // 坐标反归一化、padding处理、权重计算的vector指令数
+constexpr int64_t SLIDE_EXTRA_VEC_INSTR = 24;  // 滑窗求框(ReduceMax)与UB内坐标换算的额外指令数
+constexpr int64_t CORNER_NUM = 4;
+constexpr int64_t FP32_SIZE = 4;
+constexpr int64_t FP16_SIZE = 2;
+constexpr int64_t GRID_DIM = 2;
+
+inline int64_t CeilDiv(int64_t a, int64_t b)
+{
+    return b == 0 ? 0 : (a + b - 1) / b;
+}
+
+inline int64_t AlignUp(int64_t a, int64_t b)
+{
+    return CeilDiv(a, b) * b;
+}
+
+inline int64_t MinValue(int64_t a, int64_t b)
+{
+    return a < b ? a : b;
+}
+
+inline int64_t VecCycles(int64_t instrNum, int64_t elems, int64_t elemBytes)
+{
+    return instrNum * (VEC_ISSUE_CYCLES + CeilDiv(elems * elemBytes, VEC_BYTES_PER_REPEAT));
+}
+
+// count条DMA，每条burstNum段、每段burstBytes字节
+inline void AddDma(GridSampleCost &cost, int64_t count, int64_t burstNum, int64_t burstBytes)
+{
+    int64_t bytes = count * burstNum * AlignUp(burstBytes, DMA_BURST_BYTES);
+    cost.mte2Bytes += bytes;
+    cost.dmaNum += count;
+    cost.totalCycles += count * DMA_ISSUE_CYCLES + CeilDiv(bytes, MTE2_BYTES_PER_CYCLE);
+}
+
+inline void AddVec(GridSampleCost &cost, int64_t cycles)
+{
+    cost.vectorCycles += cycles;
+    cost.totalCycles += cycles;
+}
+
+// 与tiling中needCoreNum的计算保持一致：N小于核数且一个核一次能处理完所有输出点时按N分核
+inline int64_t PerCoreTasks(const GridSampleCostParam &param, int64_t hwBlock)
+{
+    int64_t outHW = param.outH * param.outW;
+    int64_t needCoreNum = param.coreNum;
+    if (param.inN < param.coreNum && outHW <= hwBlock) {
+        needCoreNum = param.inN;
+    }
+    int64_t totalTasks = param.inN * CeilDiv(outHW, hwBlock);
+    return CeilDiv(totalTasks, MinValue(needCoreNum, totalTasks));
+}
+
+inline void ScaleByTasks(GridSampleCost &cost, int64_t tasks)
+{
+    cost.mte2Bytes *= tasks;
+    cost.dmaNum *= tasks;
+    cost.vectorCycles *= tasks;
+    cost.totalCycles *= tasks;
+}
+
+// 一个512点基本块中grid搬入、坐标计算与y搬出的公共开销
+inline void AddBlockCommon(GridSampleCost &cost, const GridSampleCostParam &param, int64_t hwBlock)
+{
+    AddDma(cost, 1, 1, hwBlock * GRID_DIM * param.dtypeSize);
+    cost.totalCycles += SYNC_CYCLES;
+    AddVec(cost, VecCycles(COORD_VEC_INSTR, hwBlock, FP32_SIZE));
+    // y为NCHW，每个通道一段连续hwBlock个点，MTE3与MTE2带宽相当，按相同代价计入总cycle
+    cost.totalCycles += param.inC * DMA_ISSUE_CYCLES +
+                        CeilDiv(param.inC * AlignUp(hwBlock * param.dtypeSize, DMA_BURST_BYTES), MTE2_BYTES_PER_CYCLE);
+}
+
+// 逐点搬运4个角点的兜底计算，即通用模板以及滑窗不满足时的计算方式
+inline void AddPointDmaBlock(GridSampleCost &cost, const GridSampleCostParam &param, int64_t hwBlock)
+{
+    int64_t cLoop = CeilDiv(param.inC, CHANNEL_BLOCK);
+    for (int64_t cIdx = 0; cIdx < cLoop; cIdx++) {
+        int64_t cElems = MinValue(CHANNEL_BLOCK, param.inC - cIdx * CHANNEL_BLOCK);
+        int64_t cAlign = AlignUp(cElems, DMA_BURST_BYTES / FP32_SIZE);
+        AddDma(cost, CORNER_NUM * hwBlock, 1, cElems * param.dtypeSize);
+        cost.totalCycles += CORNER_NUM * SYNC_CYCLES;
+        // 每个角点乘权重并累加，最后转置为NCHW
+        int64_t instrNum = CORNER_NUM * 2 + 2;
+        if (param.dtypeSize == FP16_SIZE) {
+            instrNum += CORNER_NUM;
+        }
+        AddVec(cost, VecCycles(instrNum, hwBlock * cAlign, FP32_SIZE));
+    }
+}
+
+// 按平滑grid(近似仿射变换)估计一个基本块在x上覆盖的矩形框，判断能否放入滑窗UB
+inline bool SlideWindowFit(const GridSampleCostParam &param, int64_t &boxH, int64_t &boxW)
+{
+    if (param.inC > SLIDING_WINDOW_C_LIMIT) {
+        return false;
+    }
+    if (param.outW >= CAL_H_W_BLOCK && param.outW % CAL_H_W_BLOCK == 0) {
+        // 基本块落在一行输出内
+        boxW = CeilDiv(CAL_H_W_BLOCK * param.inW, param.outW) + 2;
+        boxH = CeilDiv(param.inH, param.outH) + 2;
+    } else {
+        // 基本块跨越多行输出，框宽度按整行计
+        int64_t outRows = CeilDiv(CAL_H_W_BLOCK, param.outW) + 1;
+        boxW = param.inW;
+        boxH = CeilDiv(outRows * param.inH, param.outH) + 2;
+    }
+    boxW = MinValue(boxW, param.inW);
+    boxH = MinValue(boxH, param.inH);
+    int64_t ubBytes = param.dtypeSize == FP16_SIZE ? SLIDE_X_UB_BYTES_FP16 : SLIDE_X_UB_BYTES_FP32;
+    int64_t alignNum = DMA_BURST_BYTES / param.dtypeSize;
+    // fp32滑窗按float搬入，fp16滑窗按half搬入
+    return AlignUp(boxW, alignNum) * boxH * param.inC * param.dtypeSize <= ubBytes;
+}
+}  // namespace gridsample_cost
+
+/*
+ * @brief: 全载模板的定制分支，c=1且h*w小于4k走模板1，c=32且h、w大于8走模板2，其余走模板0
+ */
+inline int64_t GetGridSampleFullLoadCNum(int64_t inC, int64_t inH, int64_t inW)
+{
+    if ((inC == 1) && (inH * inW < gridsample_cost::FULL_LOAD_C1_X_COUNT)) {
+        return 1;
+    }
+    if ((inC == gridsample_cost::FULL_LOAD_C32) && (inH > gridsample_cost::FULL_LOAD_C32_MIN_HW) &&
+        (inW > gridsample_cost::FULL_LOAD_C32_MIN_HW)) {
+        return 2;
+    }
+    return 0;
+}
+
+/*
+ * @brief: 通用模板(仅float32)：每个输出点的4个角点按64通道一段逐条DataCopyPad搬入
+ */
+inline GridSampleCost EstimateGridSampleGeneric(const GridSampleCostParam &param)
+{
+    using namespace gridsample_cost;
+    GridSampleCost cost;
+    if (param.dtypeSize != FP32_SIZE) {
+        // fp16没有独立的通用模板，scheduler_mode为0时同样走fp16滑窗模板
+        return cost;
+    }
+    cost.capable = true;
+    AddBlockCommon(cost, param, CAL_H_W_BLOCK);
+    AddPointDmaBlock(cost, param, CAL_H_W_BLOCK);
+    ScaleByTasks(cost, PerCoreTasks(param, CAL_H_W_BLOCK));
+    return cost;
+}
+
+/*
+ * @brief: 滑窗模板(float32/float16)：c<=16且基本块覆盖的框能放入UB时整框一次搬入后在UB内Gather，否则退化为逐点搬运
+ */
+inline GridSampleCost EstimateGridSampleSlideWindow(const GridSampleCostParam &param)
+{
+    using namespace gridsample_cost;
+    GridSampleCost cost;
+    cost.capable = true;
+    AddBlockCommon(cost, param, CAL_H_W_BLOCK);
+    AddVec(cost, VecCycles(SLIDE_EXTRA_VEC_INSTR, CAL_H_W_BLOCK, FP32_SIZE));
+    int64_t boxH = 0;
+    int64_t boxW = 0;
+    if (!SlideWindowFit(param, boxH, boxW)) {
+        AddPointDmaBlock(cost, param, CAL_H_W_BLOCK);
+    } else {
+        AddDma(cost, 1, boxH, boxW * param.inC * param.dtypeSize);
+        cost.totalCycles += SYNC_CYCLES;
+        int64_t cAlign = AlignUp(param.inC, DMA_BURST_BYTES / FP32_SIZE);
+        int64_t gatherElems = CORNER_NUM * CAL_H_W_BLOCK * cAlign;
+        int64_t instrNum = CORNER_NUM * 2 + 2;
+        if (param.dtypeSize == FP16_SIZE) {
+            instrNum += CORNER_NUM;
+        }
+        AddVec(cost, CeilDiv(gatherElems, GATHER_ELEMS_PER_CYCLE) + CORNER_NUM * VEC_ISSUE_CYCLES +
+                         VecCycles(instrNum, CAL_H_W_BLOCK * cAlign, FP32_SIZE));
+    }
+    ScaleByTasks(cost, PerCoreTasks(param, CAL_H_W_BLOCK));
+    return cost;
+}
+
+/*
+ * @brief: 全载模板(float32/float16)：c*h*w不超过20k时每个batch的x整块搬入一次，逐通道在UB内Gather
+ */
+inline GridSampleCost EstimateGridSampleFullLoad(const GridSampleCostParam &param)
+{
+    using namespace gridsample_cost;
+    GridSampleCost cost;
+    int64_t xElems = param.inC * param.inH * param.inW;
+    if (xElems > FULL_LOAD_MAX_HWC) {
+        return cost;
+    }
+    cost.capable = true;
+    int64_t cNum = GetGridSampleFullLoadCNum(param.inC, param.inH, param.inW);
+    int64_t hwBlock = cNum == 1 ? FULL_LOAD_C1_H_W_BLOCK : (cNum == 2 ? FULL_LOAD_C32_H_W_BLOCK : FULL_LOAD_H_W_BLOCK);
+    AddBlockCommon(cost, param, hwBlock);
+    // 每个通道4个角点Gather，再乘权重累加
+    AddVec(cost, param.inC * (CeilDiv(CORNER_NUM * hwBlock, GATHER_ELEMS_PER_CYCLE) + CORNER_NUM * VEC_ISSUE_CYCLES +
+                                 VecCycles(CORNER_NUM * 2 - 1, hwBlock, FP32_SIZE)));
+    if (param.dtypeSize == FP16_SIZE) {
+        // fp16先以float写workspace再读回cast
+        AddDma(cost, 1, 1, param.inC * hwBlock * FP32_SIZE);
+        cost.totalCycles += CeilDiv(param.inC * hwBlock * FP32_SIZE, MTE2_BYTES_PER_CYCLE) + SYNC_CYCLES;
+        AddVec(cost, VecCycles(1, param.inC * hwBlock, FP32_SIZE));
+    }
+    int64_t tasks = PerCoreTasks(param, hwBlock);
+    ScaleByTasks(cost, tasks);
+
+    // 每个核在batch切换时整块搬入x，一个核最多跨越tasks / blockPerN + 1个batch
+    int64_t blockPerN = CeilDiv(param.outH * param.outW, hwBlock);
+    int64_t xLoadNum = MinValue(param.inN, CeilDiv(tasks, blockPerN) + 1);
+    AddDma(cost, xLoadNum, 1, xElems * param.dtypeSize);
+    cost.totalCycles += xLoadNum * SYNC_CYCLES;
+    return cost;
+}
+
+/*
+ * @brief: 估计各模板单核cycle并返回最小者，costs按GridSampleSchedule下标返回各模板估计值
+ */
+inline GridSampleSchedule SelectGridSampleSchedule(const GridSampleCostParam &param, GridSampleCost *costs)
+{
+    costs[static_cast<int32_t>(GridSampleSchedule::GENERIC)] = EstimateGridSampleGeneric(param);
+    costs[static_cast<int32_t>(GridSampleSchedule::SLIDE_WINDOW)] = EstimateGridSampleSlideWindow(param);
+    costs[static_cast<int32_t>(GridSampleSchedule::FULL_LOAD)] = EstimateGridSampleFullLoad(param);
+
+    // 代价相同时优先滑窗，其次全载，与原有默认选择一致
+    const GridSampleSchedule order[] = {
+        GridSampleSchedule::SLIDE_WINDOW, GridSampleSchedule::FULL_LOAD, GridSampleSchedule::GENERIC};
+    GridSampleSchedule best = GridSampleSchedule::SLIDE_WINDOW;
+    int64_t bestCycles = -1;
+    for (auto schedule : order) {
+        const GridSampleCost &cost = costs[static_cast<int32_t>(schedule)];
+        if (cost.capable && (bestCycles < 0 || cost.totalCycles < bestCycles)) {
+            best = schedule;
+            bestCycles = cost.totalCycles;
+        }
+    }
+    return best;
+}
+
+}  // namespace optiling
+#endif  // OPS_BUILT_IN_OP_TILING_RUNTIME_GRID_SAMPLE_COST_MODEL_H
@@ -185,4 +185,33 @@ const aclTensor *GridSample3D(const aclTensor *x, const aclTensor *grid, int64_t
         return nullptr);
     return y;
 }
+
+const aclTensor *GridSampleFlowWarp(const aclTensor *x, const aclTensor *flow, int64_t paddingMode,
+    bool alignCorners, aclOpExecutor *executor)
+{
+    L0_DFX(GridSampleFlowWarp, x, flow, paddingMode, alignCorners);
+    // x is channel last (N, H, W, C), y is (N, C, H, W)
+    op::Shape yShape;
+    yShape.AppendDim(x->GetViewShape().GetDim(FIRST_DIM));
+    yShape.AppendDim(x->GetViewShape().GetDim(FOURTH_DIM));
+    yShape.AppendDim(x->GetViewShape().GetDim(SECOND_DIM));
+    yShape.AppendDim(x->GetViewShape().GetDim(THIRD_DIM));
+
+    auto y = executor->AllocTensor(yShape, x->GetDataType(), op::Format::FORMAT_ND);
+    if (y == nullptr) {
+        OP_LOGE(ACLNN_ERR_INNER_NULLPTR, "alloc y tensor failed.");
+        return nullptr;
+    }
+
+    auto ret = ADD_TO_LAUNCHER_LIST_AICORE(GridSample,
+        OP_ATTR_NAMES(
+            {"interpolation_mode", "padding_mode", "align_corners", "channel_last", "scheduler_mode", "flow_warp"}),
+        OP_INPUT(x, flow),
+        OP_OUTPUT(y),
+        OP_ATTR(INTERPOLATION_BILINEAR, GetPaddingModeStr(paddingMode), alignCorners, true, 0, true));
+    OP_CHECK(ret == ACLNN_SUCCESS,
+        OP_LOGE(ACLNN_ERR_INNER_NULLPTR, "GridSampleFlowWarp AiCore ADD_TO_LAUNCHER_LIST_AICORE failed."),
+        return nullptr);
+    return y;
+}
 }  // namespace l0op
\ No newline at end of file
@@ -23,6 +23,8 @@ const aclTensor *GridSample(const aclTensor *input, const aclTensor *grid, int64
     int64_t paddingMode, bool alignCorners, bool channelLast, int64_t schedulerMode, aclOpExecutor *executor);
 const aclTensor *GridSample3D(const aclTensor *input, const aclTensor *grid, int64_t interpolationMode,
     int64_t paddingMode, bool alignCorners, bool channelLast, aclOpExecutor *executor);
+const aclTensor *GridSampleFlowWarp(const aclTensor *input, const aclTensor *flow, int64_t paddingMode,
+    bool alignCorners, aclOpExecutor *executor);
 }  // namespace l0op
 
 #endif  // OP_API_INC_LEVEL0_GRID_SAMPLE_H_
\ No newline at end of file
@@ -22,6 +22,7 @@
 #include "tiling/tiling_api.h"
 #include "tiling/tiling_base.h"
 #include "tiling/tiling_type.h"
+#include "grid_sample_cost_model.h"
 
 constexpr int64_t UNKNOWN_RANK_DIM_VALUE = -2;
 /*
@@ -78,6 +79,8 @@ TILING_DATA_FIELD_DEF(int64_t, needCoreNum);
 TILING_DATA_FIELD_DEF(int64_t, preCoreNum);
 TILING_DATA_FIELD_DEF(int64_t, preNumPerCore);
 TILING_DATA_FIELD_DEF(int64_t, postNumPerCore);
+TILING_DATA_FIELD_DEF(int64_t, flowH);
+TILING_DATA_FIELD_DEF(int64_t, flowW);
 
 END_TILING_DATA_DEF;
 
@@ -108,6 +111,9 @@ protected:
     ge::graphStatus PostTiling() override;
 
 private:
+    ge::graphStatus GetFlowWarpInfo(ge::DataType gridDtype);
+    void SelectScheduleByCostModel();
+
     ge::DataType xDtype{ge::DT_FLOAT};
     int64_t coreNumVar{0};
     int64_t inN{0};
@@ -129,6 +135,10 @@ private:
     int64_t templateCNum{0};
     int64_t hwFactor{512};
     int64_t dimension{0};
+    int64_t flowWarp{0};
+    int64_t flowH{0};
+    int64_t flowW{0};
+    bool costModelEnable{false};
     GridSampleTilingData tilingData;
 };
 
@@ -25,6 +25,7 @@
 #include "grid_sample_2d_slide_window.h"
 #include "grid_sample_2d_fp16_slide_window.h"
 #include "grid_sample_2d_fullLoad.h"
+#include "grid_sample_2d_flow_warp.h"
 #include "grid_sample_3d.h"
 #include "grid_sample_3d_nearest.h"
 #include "grid_sample_3d_portrait.h"
@@ -129,6 +130,16 @@ extern "C" __global__ __aicore__ void grid_sample(GM_ADDR x, GM_ADDR grid, GM_AD
         GridSample::GridSampler2DFullLoad<half, 2> op;
         op.Init(x, grid, y, userWS, &tilingData);
         op.Process();
+    } else if (TILING_KEY_IS(3000220)) {
+        // 2D Bilinear fp32 fused flow upsample + warp
+        GridSample::GridSampler2DFlowWarp<float> op;
+        op.Init(x, grid, y, userWS, &tilingData);
+        op.Process();
+    } else if (TILING_KEY_IS(3000210)) {
+        // 2D Bilinear fp16 fused flow upsample + warp
+        GridSample::GridSampler2DFlowWarp<half> op;
+        op.Init(x, grid, y, userWS, &tilingData);
+        op.Process();
     } else if (TILING_KEY_IS(1010320)) {
         // 3D Bilinear fp32 normal
         GridSample::GridSampler3D<float> op;
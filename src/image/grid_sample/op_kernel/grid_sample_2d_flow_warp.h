@@ -0,0 +1,569 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file grid_sample_2d_flow_warp.h
+ * \brief fused flow upsample + bilinear warp, x is NHWC, flow is (N, h, w, 2) in low-res pixels
+ */
+#ifndef GRID_SAMPLER_2D_FLOW_WARP
+#define GRID_SAMPLER_2D_FLOW_WARP
+
+#include "kernel_operator.h"
+#include "kernel_tiling/kernel_tiling.h"
+#include "grid_sample_common.h"
+
+namespace GridSample {
+
+using namespace AscendC;
+
+// one task is FLOW_WARP_CAL_W pixels of one output row
+constexpr int64_t FLOW_WARP_CAL_W = 64;
+constexpr int64_t FLOW_WARP_CHANNEL_BLOCK = 64;
+constexpr int64_t FLOW_WARP_MAX_FLOW_W = 1024;
+// per pixel: (row y0c, col x0c), (y0c, x0c + 1), (y0c + 1, x0c), (y0c + 1, x0c + 1)
+constexpr int32_t FLOW_WARP_CORNERS = 4;
+constexpr int32_t FLOW_WARP_VEC_SLOTS = 32;
+constexpr int32_t FLOW_WARP_MASK_SIZE = 32;
+
+template <typename T>
+class GridSampler2DFlowWarp {
+public:
+    __aicore__ inline GridSampler2DFlowWarp(){};
+    __aicore__ inline void Init(
+        GM_ADDR x, GM_ADDR flow, GM_ADDR y, GM_ADDR workspace, const GridSampleTilingData *tilingData);
+    __aicore__ inline void Process();
+
+private:
+    __aicore__ inline void ParseTilingData(const GridSampleTilingData *tilingData);
+    __aicore__ inline LocalTensor<float> VecSlot(int32_t idx);
+    __aicore__ inline void ComputeFlowRow(int64_t nIdx, int64_t ohIdx);
+    __aicore__ inline void ComputeSampleCoords(int64_t ohIdx, int64_t owStart);
+    __aicore__ inline void ComputeAxisWeights(LocalTensor<float> iFpUb, LocalTensor<float> firstUb,
+        LocalTensor<float> secondUb, LocalTensor<int32_t> pairUb, int64_t size);
+    __aicore__ inline void GatherCorners(int64_t nIdx, int32_t cIdx, int32_t calCElems, int32_t calWElems);
+    __aicore__ inline void AccumulateCorners(int32_t channelAlign);
+    __aicore__ inline void OutTranspose(int32_t channelAlign);
+    __aicore__ inline void CopyOut(
+        int64_t nIdx, int64_t ohIdx, int64_t owStart, int32_t cIdx, int32_t calCElems, int32_t calWElems);
+
+private:
+    TPipe pipe;
+
+    TBuf<QuePosition::VECCALC> flowRawBuf_;
+    TBuf<QuePosition::VECCALC> flowRowBuf_;
+    TBuf<QuePosition::VECCALC> vecBuf_;
+    TBuf<QuePosition::VECCALC> maskBuf_;
+    TBuf<QuePosition::VECCALC> weightBrcbBuf_;
+    TBuf<QuePosition::VECCALC> xBuf_;
+    TBuf<QuePosition::VECCALC> tmpBuf_;
+    TBuf<QuePosition::VECCALC> accBuf_;
+    TBuf<QuePosition::VECCALC> outBuf_;
+
+    GlobalTensor<T> gmX_;
+    GlobalTensor<T> gmFlow_;
+    GlobalTensor<T> gmY_;
+
+    // vec slots, FLOW_WARP_CAL_W floats each
+    constexpr static int32_t SLOT_RAMP = 0;
+    constexpr static int32_t SLOT_OW = 1;
+    constexpr static int32_t SLOT_SRC = 2;
+    constexpr static int32_t SLOT_LAMBDA = 3;
+    constexpr static int32_t SLOT_IDX0 = 4;
+    constexpr static int32_t SLOT_IDX1 = 5;
+    constexpr static int32_t SLOT_OFF0 = 6;
+    constexpr static int32_t SLOT_OFF1 = 7;
+    constexpr static int32_t SLOT_FX0 = 8;
+    constexpr static int32_t SLOT_FX1 = 9;
+    constexpr static int32_t SLOT_FY0 = 10;
+    constexpr static int32_t SLOT_FY1 = 11;
+    constexpr static int32_t SLOT_IX = 12;
+    constexpr static int32_t SLOT_IY = 13;
+    constexpr static int32_t SLOT_WXF = 14;
+    constexpr static int32_t SLOT_WXS = 15;
+    constexpr static int32_t SLOT_WYF = 16;
+    constexpr static int32_t SLOT_WYS = 17;
+    constexpr static int32_t SLOT_X0C = 18;
+    constexpr static int32_t SLOT_Y0C = 19;
+    constexpr static int32_t SLOT_BASE = 20;
+    constexpr static int32_t SLOT_FLOOR_INT = 21;
+    constexpr static int32_t SLOT_FLOOR_FP = 22;
+    constexpr static int32_t SLOT_FRAC = 23;
+    constexpr static int32_t SLOT_ONE_MINUS = 24;
+    constexpr static int32_t SLOT_TMP = 25;
+    constexpr static int32_t SLOT_W = 26;  // 4 slots, corner weights before Brcb
+
+    int64_t blockIDX = 0;
+
+    // tiling params
+    int64_t inputN_ = 0;
+    int64_t inputC_ = 0;
+    int64_t inputH_ = 0;
+    int64_t inputW_ = 0;
+    int64_t flowH_ = 0;
+    int64_t flowW_ = 0;
+    int64_t paddingMode_ = 0;
+    int64_t alignCorners_ = 0;
+    int64_t needCoreNum_ = 0;
+    int64_t preCoreNum_ = 0;
+    int64_t preNumPerCore_ = 0;
+    int64_t postNumPerCore_ = 0;
+
+    int64_t chunkPerRow_ = 0;
+    int64_t channelLoop_ = 0;
+    int64_t lastLoopChannel_ = 0;
+    int64_t cachedRow_ = -1;
+    float scaleX_ = 0.0f;
+    float scaleY_ = 0.0f;
+};
+
+template <typename T>
+__aicore__ inline void GridSampler2DFlowWarp<T>::ParseTilingData(const GridSampleTilingData *tilingData)
+{
+    inputN_ = tilingData->inN;
+    inputC_ = tilingData->inC;
+    inputH_ = tilingData->inH;
+    inputW_ = tilingData->inW;
+    flowH_ = tilingData->flowH;
+    flowW_ = tilingData->flowW;
+    paddingMode_ = tilingData->paddingMode;
+    alignCorners_ = tilingData->alignCorners;
+    needCoreNum_ = tilingData->needCoreNum;
+    preCoreNum_ = tilingData->preCoreNum;
+    preNumPerCore_ = tilingData->preNumPerCore;
+    postNumPerCore_ = tilingData->postNumPerCore;
+
+    chunkPerRow_ = (inputW_ + FLOW_WARP_CAL_W - 1) / FLOW_WARP_CAL_W;
+    channelLoop_ = (inputC_ + FLOW_WARP_CHANNEL_BLOCK - 1) / FLOW_WARP_CHANNEL_BLOCK;
+    lastLoopChannel_ = inputC_ - FLOW_WARP_CHANNEL_BLOCK * (channelLoop_ - 1);
+    // flow is in low-res pixels, scale it to the output grid while upsampling
+    scaleX_ = static_cast<float>(inputW_) / static_cast<float>(flowW_);
+    scaleY_ = static_cast<float>(inputH_) / static_cast<float>(flowH_);
+}
+
+template <typename T>
+__aicore__ inline void GridSampler2DFlowWarp<T>::Init(
+    GM_ADDR x, GM_ADDR flow, GM_ADDR y, GM_ADDR workspace, const GridSampleTilingData *tilingData)
+{
+    blockIDX = GetBlockIdx();
+    ParseTilingData(tilingData);
+
+    gmX_.SetGlobalBuffer((__gm__ T *)x);
+    gmFlow_.SetGlobalBuffer((__gm__ T *)flow);
+    gmY_.SetGlobalBuffer((__gm__ T *)y);
+
+    pipe.InitBuffer(flowRawBuf_, NUM_2 * FLOW_WARP_MAX_FLOW_W * NUM_2 * sizeof(float));                 // 16KB
+    pipe.InitBuffer(flowRowBuf_, FLOW_WARP_MAX_FLOW_W * NUM_2 * sizeof(float));                         // 8KB
+    pipe.InitBuffer(vecBuf_, FLOW_WARP_VEC_SLOTS * FLOW_WARP_CAL_W * sizeof(float));                    // 8KB
+    pipe.InitBuffer(maskBuf_, NUM_4 * FLOW_WARP_MASK_SIZE);                                             // 128B
+    pipe.InitBuffer(weightBrcbBuf_, FLOW_WARP_CORNERS * FLOW_WARP_CAL_W * B32_ALIGN_FACTOR * sizeof(float));  // 8KB
+    pipe.InitBuffer(xBuf_, FLOW_WARP_CAL_W * FLOW_WARP_CORNERS * FLOW_WARP_CHANNEL_BLOCK * sizeof(T));  // 64KB
+    pipe.InitBuffer(tmpBuf_, FLOW_WARP_CAL_W * FLOW_WARP_CHANNEL_BLOCK * sizeof(float));                // 16KB
+    pipe.InitBuffer(accBuf_, FLOW_WARP_CAL_W * FLOW_WARP_CHANNEL_BLOCK * sizeof(float));                // 16KB
+    pipe.InitBuffer(outBuf_, FLOW_WARP_CAL_W * FLOW_WARP_CHANNEL_BLOCK * sizeof(float));                // 16KB
+
+    ArithProgression(VecSlot(SLOT_RAMP), static_cast<float>(0), static_cast<float>(1), FLOW_WARP_CAL_W);
+    PipeBarrier<PIPE_V>();
+}
+
+template <typename T>
+__aicore__ inline LocalTensor<float> GridSampler2DFlowWarp<T>::VecSlot(int32_t idx)
+{
+    return vecBuf_.GetWithOffset<float>(FLOW_WARP_CAL_W, idx * FLOW_WARP_CAL_W * sizeof(float));
+}
+
+template <typename T>
+__aicore__ inline void GridSampler2DFlowWarp<T>::ComputeFlowRow(int64_t nIdx, int64_t ohIdx)
+{
+    // upsample_bilinear2d along H, a scalar per output row
+    float srcY = 0.0f;
+    if (alignCorners_ == 1) {
+        srcY = static_cast<float>(ohIdx) * static_cast<float>(flowH_ - 1) / static_cast<float>(inputH_ - 1);
+    } else {
+        srcY = (static_cast<float>(ohIdx) + 0.5f) * static_cast<float>(flowH_) / static_cast<float>(inputH_) - 0.5f;
+        srcY = srcY < 0.0f ? 0.0f : srcY;
+    }
+    int64_t y0 = static_cast<int64_t>(srcY);
+    int64_t y1 = y0 < flowH_ - 1 ? y0 + 1 : y0;
+    float lambdaY = srcY - static_cast<float>(y0);
+
+    int64_t rowElems = flowW_ * NUM_2;
+    int64_t rowStride = FLOW_WARP_MAX_FLOW_W * NUM_2;
+    LocalTensor<T> rawLocal = flowRawBuf_.Get<T>();
+    LocalTensor<float> rawFpLocal = flowRawBuf_.Get<float>();
+    LocalTensor<float> rowLocal = flowRowBuf_.Get<float>();
+
+    event_t eventVMte2 = static_cast<event_t>(GetTPipePtr()->FetchEventID(HardEvent::V_MTE2));
+    SetFlag<HardEvent::V_MTE2>(eventVMte2);
+    WaitFlag<HardEvent::V_MTE2>(eventVMte2);
+
+    DataCopyExtParams params{1, static_cast<uint32_t>(rowElems * sizeof(T)), 0, 0, 0};
+    DataCopyPadExtParams<T> padParams{false, 0, 0, 0};
+    DataCopyPad(rawLocal, gmFlow_[(nIdx * flowH_ + y0) * rowElems], params, padParams);
+    DataCopyPad(rawLocal[rowStride], gmFlow_[(nIdx * flowH_ + y1) * rowElems], params, padParams);
+
+    event_t eventMte2V = static_cast<event_t>(GetTPipePtr()->FetchEventID(HardEvent::MTE2_V));
+    SetFlag<HardEvent::MTE2_V>(eventMte2V);
+    WaitFlag<HardEvent::MTE2_V>(eventMte2V);
+
+    LocalTensor<float> row1Local = rawFpLocal[rowStride];
+    if constexpr (IsSameType<T, half>::value) {
+        // half rows occupy the lower 8KB, the fp32 copy of row1 goes to the upper 8KB
+        Cast(rowLocal, rawLocal, RoundMode::CAST_NONE, rowElems);
+        Cast(row1Local, rawLocal[rowStride], RoundMode::CAST_NONE, rowElems);
+        PipeBarrier<PIPE_V>();
+        Muls(rowLocal, rowLocal, 1.0f - lambdaY, rowElems);
+    } else {
+        Muls(rowLocal, rawFpLocal, 1.0f - lambdaY, rowElems);
+    }
+    PipeBarrier<PIPE_V>();
+    Axpy(rowLocal, row1Local, lambdaY, rowElems);
+    PipeBarrier<PIPE_V>();
+}
+
+template <typename T>
+__aicore__ inline void GridSampler2DFlowWarp<T>::ComputeAxisWeights(LocalTensor<float> iFpUb,
+    LocalTensor<float> firstUb, LocalTensor<float> secondUb, LocalTensor<int32_t> pairUb, int64_t size)
+{
+    /*
+     The two corners of one axis are fetched as a pair starting at pair = clamp(i0, 0, size - 2), so one
+     DataCopyPad covers both. Weights are moved onto the pair slots:
+       i0 in [0, size - 2]: first = w0, second = w1
+       i0 == -1           : first = w1 (i1 = 0), second = 0
+       i0 == size - 1     : first = 0, second = w0 (i0 = pair + 1)
+       otherwise          : both 0
+    */
+    LocalTensor<int32_t> floorIntUb = VecSlot(SLOT_FLOOR_INT).ReinterpretCast<int32_t>();
+    LocalTensor<float> floorFpUb = VecSlot(SLOT_FLOOR_FP);
+    LocalTensor<float> w1Ub = VecSlot(SLOT_FRAC);
+    LocalTensor<float> w0Ub = VecSlot(SLOT_ONE_MINUS);
+    LocalTensor<float> tmpUb = VecSlot(SLOT_TMP);
+    LocalTensor<uint8_t> maskLoUb = maskBuf_.GetWithOffset<uint8_t>(FLOW_WARP_MASK_SIZE, 0);
+    LocalTensor<uint8_t> maskHiUb = maskBuf_.GetWithOffset<uint8_t>(FLOW_WARP_MASK_SIZE, FLOW_WARP_MASK_SIZE);
+    LocalTensor<uint8_t> maskLeftUb = maskBuf_.GetWithOffset<uint8_t>(FLOW_WARP_MASK_SIZE, FLOW_WARP_MASK_SIZE * 2);
+    LocalTensor<uint8_t> maskRightUb = maskBuf_.GetWithOffset<uint8_t>(FLOW_WARP_MASK_SIZE, FLOW_WARP_MASK_SIZE * 3);
+
+    if (paddingMode_ == PADDING_MODE_BORDER) {
+        Mins(iFpUb, iFpUb, static_cast<float>(size - 1), FLOW_WARP_CAL_W);
+        PipeBarrier<PIPE_V>();
+        Maxs(iFpUb, iFpUb, 0.0f, FLOW_WARP_CAL_W);
+    } else {
+        // anything beyond one pixel outside has zero weight, clamp so the int cast cannot overflow
+        Mins(iFpUb, iFpUb, static_cast<float>(size + 1), FLOW_WARP_CAL_W);
+        PipeBarrier<PIPE_V>();
+        Maxs(iFpUb, iFpUb, -2.0f, FLOW_WARP_CAL_W);
+    }
+    PipeBarrier<PIPE_V>();
+
+    Cast(floorIntUb, iFpUb, RoundMode::CAST_FLOOR, FLOW_WARP_CAL_W);
+    PipeBarrier<PIPE_V>();
+    Cast(floorFpUb, floorIntUb, RoundMode::CAST_NONE, FLOW_WARP_CAL_W);
+    Maxs(pairUb, floorIntUb, 0, FLOW_WARP_CAL_W);
+    PipeBarrier<PIPE_V>();
+    Mins(pairUb, pairUb, static_cast<int32_t>(size - NUM_2), FLOW_WARP_CAL_W);
+    Sub(w1Ub, iFpUb, floorFpUb, FLOW_WARP_CAL_W);
+    PipeBarrier<PIPE_V>();
+    Muls(w0Ub, w1Ub, -1.0f, FLOW_WARP_CAL_W);
+    PipeBarrier<PIPE_V>();
+    Adds(w0Ub, w0Ub, 1.0f, FLOW_WARP_CAL_W);
+
+    CompareScalar(maskLoUb, floorFpUb, 0.0f, CMPMODE::GE, FLOW_WARP_CAL_W);
+    CompareScalar(maskHiUb, floorFpUb, static_cast<float>(size - NUM_2), CMPMODE::LE, FLOW_WARP_CAL_W);
+    CompareScalar(maskLeftUb, floorFpUb, -1.0f, CMPMODE::EQ, FLOW_WARP_CAL_W);
+    CompareScalar(maskRightUb, floorFpUb, static_cast<float>(size - 1), CMPMODE::EQ, FLOW_WARP_CAL_W);
+    PipeBarrier<PIPE_V>();
+    auto maskLoTmp = maskLoUb.ReinterpretCast<uint16_t>();
+    auto maskHiTmp = maskHiUb.ReinterpretCast<uint16_t>();
+    And(maskLoTmp, maskLoTmp, maskHiTmp, FLOW_WARP_CAL_W / NUM_16);
+    PipeBarrier<PIPE_V>();
+    LocalTensor<uint8_t> maskMidUb = maskLoTmp.ReinterpretCast<uint8_t>();
+
+    Select(tmpUb, maskLeftUb, w1Ub, 0.0f, SELMODE::VSEL_TENSOR_SCALAR_MODE, FLOW_WARP_CAL_W);
+    PipeBarrier<PIPE_V>();
+    Select(firstUb, maskMidUb, w0Ub, tmpUb, SELMODE::VSEL_TENSOR_TENSOR_MODE, FLOW_WARP_CAL_W);
+    PipeBarrier<PIPE_V>();
+    Select(tmpUb, maskRightUb, w0Ub, 0.0f, SELMODE::VSEL_TENSOR_SCALAR_MODE, FLOW_WARP_CAL_W);
+    PipeBarrier<PIPE_V>();
+    Select(secondUb, maskMidUb, w1Ub, tmpUb, SELMODE::VSEL_TENSOR_TENSOR_MODE, FLOW_WARP_CAL_W);
+    PipeBarrier<PIPE_V>();
+}
+
+template <typename T>
+__aicore__ inline void GridSampler2DFlowWarp<T>::ComputeSampleCoords(int64_t ohIdx, int64_t owStart)
+{
+    LocalTensor<float> rowLocal = flowRowBuf_.Get<float>();
+    LocalTensor<float> owUb = VecSlot(SLOT_OW);
+    LocalTensor<float> srcUb = VecSlot(SLOT_SRC);
+    LocalTensor<float> lambdaUb = VecSlot(SLOT_LAMBDA);
+    LocalTensor<int32_t> idx0Ub = VecSlot(SLOT_IDX0).ReinterpretCast<int32_t>();
+    LocalTensor<int32_t> idx1Ub = VecSlot(SLOT_IDX1).ReinterpretCast<int32_t>();
+    LocalTensor<int32_t> off0Ub = VecSlot(SLOT_OFF0).ReinterpretCast<int32_t>();
+    LocalTensor<int32_t> off1Ub = VecSlot(SLOT_OFF1).ReinterpretCast<int32_t>();
+    LocalTensor<float> fx0Ub = VecSlot(SLOT_FX0);
+    LocalTensor<float> fx1Ub = VecSlot(SLOT_FX1);
+    LocalTensor<float> fy0Ub = VecSlot(SLOT_FY0);
+    LocalTensor<float> fy1Ub = VecSlot(SLOT_FY1);
+    LocalTensor<float> ixUb = VecSlot(SLOT_IX);
+    LocalTensor<float> iyUb = VecSlot(SLOT_IY);
+
+    // upsample_bilinear2d along W on the blended row, the row is interleaved (fx, fy)
+    Adds(owUb, VecSlot(SLOT_RAMP), static_cast<float>(owStart), FLOW_WARP_CAL_W);
+    PipeBarrier<PIPE_V>();
+    if (alignCorners_ == 1) {
+        Muls(srcUb, owUb, static_cast<float>(flowW_ - 1) / static_cast<float>(inputW_ - 1), FLOW_WARP_CAL_W);
+    } else {
+        Adds(srcUb, owUb, 0.5f, FLOW_WARP_CAL_W);
+        PipeBarrier<PIPE_V>();
+        Muls(srcUb, srcUb, static_cast<float>(flowW_) / static_cast<float>(inputW_), FLOW_WARP_CAL_W);
+        PipeBarrier<PIPE_V>();
+        Adds(srcUb, srcUb, -0.5f, FLOW_WARP_CAL_W);
+        PipeBarrier<PIPE_V>();
+        Maxs(srcUb, srcUb, 0.0f, FLOW_WARP_CAL_W);
+    }
+    PipeBarrier<PIPE_V>();
+    Cast(idx0Ub, srcUb, RoundMode::CAST_FLOOR, FLOW_WARP_CAL_W);
+    PipeBarrier<PIPE_V>();
+    Cast(lambdaUb, idx0Ub, RoundMode::CAST_NONE, FLOW_WARP_CAL_W);
+    Adds(idx1Ub, idx0Ub, 1, FLOW_WARP_CAL_W);
+    PipeBarrier<PIPE_V>();
+    Sub(lambdaUb, srcUb, lambdaUb, FLOW_WARP_CAL_W);
+    Mins(idx1Ub, idx1Ub, static_cast<int32_t>(flowW_ - 1), FLOW_WARP_CAL_W);
+    // byte offsets of fx, fy + 4
+    Muls(off0Ub, idx0Ub, static_cast<int32_t>(NUM_2 * sizeof(float)), FLOW_WARP_CAL_W);
+    PipeBarrier<PIPE_V>();
+    Muls(off1Ub, idx1Ub, static_cast<int32_t>(NUM_2 * sizeof(float)), FLOW_WARP_CAL_W);
+    Gather(fx0Ub, rowLocal, off0Ub.ReinterpretCast<uint32_t>(), 0, FLOW_WARP_CAL_W);
+    PipeBarrier<PIPE_V>();
+    Gather(fx1Ub, rowLocal, off1Ub.ReinterpretCast<uint32_t>(), 0, FLOW_WARP_CAL_W);
+    Gather(fy0Ub, rowLocal, off0Ub.ReinterpretCast<uint32_t>(), sizeof(float), FLOW_WARP_CAL_W);
+    Gather(fy1Ub, rowLocal, off1Ub.ReinterpretCast<uint32_t>(), sizeof(float), FLOW_WARP_CAL_W);
+    PipeBarrier<PIPE_V>();
+    Sub(fx1Ub, fx1Ub, fx0Ub, FLOW_WARP_CAL_W);
+    Sub(fy1Ub, fy1Ub, fy0Ub, FLOW_WARP_CAL_W);
+    PipeBarrier<PIPE_V>();
+    Mul(fx1Ub, fx1Ub, lambdaUb, FLOW_WARP_CAL_W);
+    Mul(fy1Ub, fy1Ub, lambdaUb, FLOW_WARP_CAL_W);
+    PipeBarrier<PIPE_V>();
+    Add(fx0Ub, fx0Ub, fx1Ub, FLOW_WARP_CAL_W);
+    Add(fy0Ub, fy0Ub, fy1Ub, FLOW_WARP_CAL_W);
+    PipeBarrier<PIPE_V>();
+
+    // sample position in output pixels: (ow + fx * W / w, oh + fy * H / h)
+    Muls(fx0Ub, fx0Ub, scaleX_, FLOW_WARP_CAL_W);
+    Muls(fy0Ub, fy0Ub, scaleY_, FLOW_WARP_CAL_W);
+    PipeBarrier<PIPE_V>();
+    Add(ixUb, owUb, fx0Ub, FLOW_WARP_CAL_W);
+    Adds(iyUb, fy0Ub, static_cast<float>(ohIdx), FLOW_WARP_CAL_W);
+    PipeBarrier<PIPE_V>();
+
+    LocalTensor<float> wxFirst = VecSlot(SLOT_WXF);
+    LocalTensor<float> wxSecond = VecSlot(SLOT_WXS);
+    LocalTensor<float> wyFirst = VecSlot(SLOT_WYF);
+    LocalTensor<float> wySecond = VecSlot(SLOT_WYS);
+    LocalTensor<int32_t> x0cUb = VecSlot(SLOT_X0C).ReinterpretCast<int32_t>();
+    LocalTensor<int32_t> y0cUb = VecSlot(SLOT_Y0C).ReinterpretCast<int32_t>();
+    LocalTensor<int32_t> baseUb = VecSlot(SLOT_BASE).ReinterpretCast<int32_t>();
+    ComputeAxisWeights(ixUb, wxFirst, wxSecond, x0cUb, inputW_);
+    ComputeAxisWeights(iyUb, wyFirst, wySecond, y0cUb, inputH_);
+
+    Muls(baseUb, y0cUb, static_cast<int32_t>(inputW_), FLOW_WARP_CAL_W);
+    Mul(VecSlot(SLOT_W), wyFirst, wxFirst, FLOW_WARP_CAL_W);
+    Mul(VecSlot(SLOT_W + 1), wyFirst, wxSecond, FLOW_WARP_CAL_W);
+    Mul(VecSlot(SLOT_W + 2), wySecond, wxFirst, FLOW_WARP_CAL_W);
+    Mul(VecSlot(SLOT_W + 3), wySecond, wxSecond, FLOW_WARP_CAL_W);
+    PipeBarrier<PIPE_V>();
+    Add(baseUb, baseUb, x0cUb, FLOW_WARP_CAL_W);
+
+    // one block of 8 equal weights per pixel, read with src1 block stride 0
+    LocalTensor<float> weightBrcb = weightBrcbBuf_.Get<float>();
+    for (int32_t k = 0; k < FLOW_WARP_CORNERS; k++) {
+        Brcb(weightBrcb[k * FLOW_WARP_CAL_W * B32_ALIGN_FACTOR], VecSlot(SLOT_W + k),
+            FLOW_WARP_CAL_W / B32_ALIGN_FACTOR, {1, 8});
+    }
+    PipeBarrier<PIPE_V>();
+
+    event_t eventVS = static_cast<event_t>(GetTPipePtr()->FetchEventID(HardEvent::V_S));
+    SetFlag<HardEvent::V_S>(eventVS);
+    WaitFlag<HardEvent::V_S>(eventVS);
+}
+
+template <typename T>
+__aicore__ inline void GridSampler2DFlowWarp<T>::GatherCorners(
+    int64_t nIdx, int32_t cIdx, int32_t calCElems, int32_t calWElems)
+{
+    constexpr int32_t alignFactor = BLOCK_SIZE / sizeof(T);
+    int32_t channelAlign = (calCElems + alignFactor - 1) / alignFactor * alignFactor;
+    int64_t gmBase = nIdx * inputH_ * inputW_ * inputC_ + cIdx * FLOW_WARP_CHANNEL_BLOCK;
+    int64_t rowOffset = inputW_ * inputC_;
+    LocalTensor<T> xLocal = xBuf_.Get<T>();
+    LocalTensor<int32_t> baseUb = VecSlot(SLOT_BASE).ReinterpretCast<int32_t>();
+
+    event_t eventVMte2 = static_cast<event_t>(GetTPipePtr()->FetchEventID(HardEvent::V_MTE2));
+    SetFlag<HardEvent::V_MTE2>(eventVMte2);
+    WaitFlag<HardEvent::V_MTE2>(eventVMte2);
+
+    // two adjacent pixels per row, each padded to channelAlign
+    DataCopyExtParams params;
+    params.blockCount = NUM_2;
+    params.blockLen = calCElems * sizeof(T);
+    params.srcStride = (inputC_ - calCElems) * sizeof(T);
+    params.dstStride = 0;
+    DataCopyPadExtParams<T> padParams{false, 0, 0, 0};
+    for (int32_t i = 0; i < calWElems; i++) {
+        int64_t location = gmBase + static_cast<int64_t>(baseUb.GetValue(i)) * inputC_;
+        int32_t ubOffset = i * FLOW_WARP_CORNERS * channelAlign;
+        DataCopyPad(xLocal[ubOffset], gmX_[location], params, padParams);
+        DataCopyPad(xLocal[ubOffset + NUM_2 * channelAlign], gmX_[location + rowOffset], params, padParams);
+    }
+
+    event_t eventMte2V = static_cast<event_t>(GetTPipePtr()->FetchEventID(HardEvent::MTE2_V));
+    SetFlag<HardEvent::MTE2_V>(eventMte2V);
+    WaitFlag<HardEvent::MTE2_V>(eventMte2V);
+}
+
+template <typename T>
+__aicore__ inline void GridSampler2DFlowWarp<T>::AccumulateCorners(int32_t channelAlign)
+{
+    LocalTensor<float> weightBrcb = weightBrcbBuf_.Get<float>();
+    LocalTensor<float> accLocal = accBuf_.Get<float>();
+    LocalTensor<float> tmpLocal = tmpBuf_.Get<float>();
+    uint8_t rowBlocks = static_cast<uint8_t>(channelAlign / B32_ALIGN_FACTOR);
+    uint8_t cornerBlocks = static_cast<uint8_t>(FLOW_WARP_CORNERS * channelAlign * sizeof(T) / BLOCK_SIZE);
+    int32_t count = FLOW_WARP_CAL_W * channelAlign;
+
+    // acc[p, c] = sum_k w_k[p] * x[p, k, c], one repeat per pixel
+    for (int32_t k = 0; k < FLOW_WARP_CORNERS; k++) {
+        LocalTensor<float> dstLocal = (k == 0) ? accLocal : tmpLocal;
+        LocalTensor<float> wLocal = weightBrcb[k * FLOW_WARP_CAL_W * B32_ALIGN_FACTOR];
+        if constexpr (IsSameType<T, half>::value) {
+            LocalTensor<half> xLocal = xBuf_.Get<half>();
+            Cast(dstLocal, xLocal[k * channelAlign], RoundMode::CAST_NONE, channelAlign, FLOW_WARP_CAL_W,
+                {1, 1, rowBlocks, cornerBlocks});
+            PipeBarrier<PIPE_V>();
+            Mul(dstLocal, dstLocal, wLocal, channelAlign, FLOW_WARP_CAL_W, {1, 1, 0, rowBlocks, rowBlocks, 1});
+        } else {
+            LocalTensor<float> xLocal = xBuf_.Get<float>();
+            Mul(dstLocal, xLocal[k * channelAlign], wLocal, channelAlign, FLOW_WARP_CAL_W,
+                {1, 1, 0, rowBlocks, cornerBlocks, 1});
+        }
+        PipeBarrier<PIPE_V>();
+        if (k > 0) {
+            Add(accLocal, accLocal, tmpLocal, count);
+            PipeBarrier<PIPE_V>();
+        }
+    }
+}
+
+template <typename T>
+__aicore__ inline void GridSampler2DFlowWarp<T>::OutTranspose(int32_t channelAlign)
+{
+    LocalTensor<float> accLocal = accBuf_.Get<float>();
+    LocalTensor<float> outLocal = outBuf_.Get<float>();
+    LocalTensor<float> dstList[16];
+    LocalTensor<float> srcList[16];
+
+    event_t eventVS = static_cast<event_t>(GetTPipePtr()->FetchEventID(HardEvent::V_S));
+    event_t eventSV = static_cast<event_t>(GetTPipePtr()->FetchEventID(HardEvent::S_V));
+
+    // [CAL_W, channelAlign] -> [channelAlign, CAL_W], 16 pixels x 8 channels per repeat
+    TransDataTo5HDParams transDataParams;
+    transDataParams.dstHighHalf = false;
+    transDataParams.srcHighHalf = false;
+    transDataParams.repeatTimes = channelAlign / B32_ALIGN_FACTOR;
+    transDataParams.dstRepStride = transDataParams.repeatTimes == 1 ? 0 : FLOW_WARP_CAL_W;
+    transDataParams.srcRepStride = transDataParams.repeatTimes == 1 ? 0 : 1;
+    for (int32_t j = 0; j < FLOW_WARP_CAL_W / NUM_16; j++) {
+        for (int32_t i = 0; i < NUM_16; i++) {
+            srcList[i] = accLocal[(j * NUM_16 + i) * channelAlign];
+        }
+        for (int32_t i = 0; i < NUM_8; i++) {
+            dstList[i * 2] = outLocal[i * FLOW_WARP_CAL_W + j * NUM_16];
+            dstList[i * 2 + 1] = outLocal[i * FLOW_WARP_CAL_W + j * NUM_16 + NUM_8];
+        }
+        SetFlag<HardEvent::S_V>(eventSV);
+        WaitFlag<HardEvent::S_V>(eventSV);
+        TransDataTo5HD<float>(dstList, srcList, transDataParams);
+        SetFlag<HardEvent::V_S>(eventVS);
+        WaitFlag<HardEvent::V_S>(eventVS);
+    }
+}
+
+template <typename T>
+__aicore__ inline void GridSampler2DFlowWarp<T>::CopyOut(
+    int64_t nIdx, int64_t ohIdx, int64_t owStart, int32_t cIdx, int32_t calCElems, int32_t calWElems)
+{
+    LocalTensor<T> outLocal = outBuf_.Get<T>();
+    if constexpr (IsSameType<T, half>::value) {
+        outLocal = tmpBuf_.Get<T>();
+        PipeBarrier<PIPE_V>();
+        Cast(outLocal, outBuf_.Get<float>(), RoundMode::CAST_NONE, calCElems * FLOW_WARP_CAL_W);
+    }
+    event_t eventVMte3 = static_cast<event_t>(GetTPipePtr()->FetchEventID(HardEvent::V_MTE3));
+    SetFlag<HardEvent::V_MTE3>(eventVMte3);
+    WaitFlag<HardEvent::V_MTE3>(eventVMte3);
+
+    int64_t outHW = inputH_ * inputW_;
+    int64_t gmOffset = (nIdx * inputC_ + cIdx * FLOW_WARP_CHANNEL_BLOCK) * outHW + ohIdx * inputW_ + owStart;
+    uint32_t rowBlocks = FLOW_WARP_CAL_W * sizeof(T) / BLOCK_SIZE;
+    uint32_t lenBlocks = (calWElems * sizeof(T) + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    DataCopyExtParams params;
+    params.blockCount = calCElems;
+    params.blockLen = calWElems * sizeof(T);
+    params.srcStride = rowBlocks - lenBlocks;
+    params.dstStride = (outHW - calWElems) * sizeof(T);
+    DataCopyPad(gmY_[gmOffset], outLocal, params);
+
+    event_t eventMte3V = static_cast<event_t>(GetTPipePtr()->FetchEventID(HardEvent::MTE3_V));
+    SetFlag<HardEvent::MTE3_V>(eventMte3V);
+    WaitFlag<HardEvent::MTE3_V>(eventMte3V);
+}
+
+template <typename T>
+__aicore__ inline void GridSampler2DFlowWarp<T>::Process()
+{
+    if (blockIDX >= needCoreNum_) {
+        return;
+    }
+
+    int64_t taskStart = blockIDX * preNumPerCore_;
+    int64_t taskNum = preNumPerCore_;
+    if (blockIDX >= preCoreNum_) {
+        taskStart = preCoreNum_ * preNumPerCore_ + (blockIDX - preCoreNum_) * postNumPerCore_;
+        taskNum = postNumPerCore_;
+    }
+
+    constexpr int32_t alignFactor = BLOCK_SIZE / sizeof(T);
+    for (int64_t taskIdx = taskStart; taskIdx < taskStart + taskNum; taskIdx++) {
+        int64_t rowIdx = taskIdx / chunkPerRow_;
+        int64_t nIdx = rowIdx / inputH_;
+        int64_t ohIdx = rowIdx - nIdx * inputH_;
+        int64_t owStart = (taskIdx - rowIdx * chunkPerRow_) * FLOW_WARP_CAL_W;
+        int32_t calWElems = static_cast<int32_t>(
+            (inputW_ - owStart) < FLOW_WARP_CAL_W ? (inputW_ - owStart) : FLOW_WARP_CAL_W);
+
+        // tasks of one core are contiguous, the upsampled flow row is shared by every chunk of the row
+        if (rowIdx != cachedRow_) {
+            ComputeFlowRow(nIdx, ohIdx);
+            cachedRow_ = rowIdx;
+        }
+        ComputeSampleCoords(ohIdx, owStart);
+
+        for (int32_t cIdx = 0; cIdx < channelLoop_; cIdx++) {
+            int32_t calCElems = (cIdx == channelLoop_ - 1) ? lastLoopChannel_ : FLOW_WARP_CHANNEL_BLOCK;
+            int32_t channelAlign = (calCElems + alignFactor - 1) / alignFactor * alignFactor;
+            GatherCorners(nIdx, cIdx, calCElems, calWElems);
+            AccumulateCorners(channelAlign);
+            OutTranspose(channelAlign);
+            CopyOut(nIdx, ohIdx, owStart, cIdx, calCElems, calWElems);
+        }
+    }
+}
+
+}  // namespace GridSample
+#endif  // GRID_SAMPLER_2D_FLOW_WARP
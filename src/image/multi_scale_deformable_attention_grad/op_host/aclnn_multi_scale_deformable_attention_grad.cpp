@@ -49,6 +49,15 @@ static const int64_t NUM_KEYS = 1;
 static const int64_t NUM_HEADS = 2;
 static const int64_t NUM_LEVELS = 4;
 static const int64_t NUM_POINTS = 5;
+static const int64_t EMBED_DIMS = 3;
+
+// 满足以下规格时kernel直接读取未转置的location/attnWeight，与tiling侧IsQueryMajorSupported保持一致
+static const int64_t QUERY_MAJOR_QUERIES_MIN = 32;
+static const int64_t QUERY_MAJOR_HEADS_MAX = 16;
+static const int64_t QUERY_MAJOR_SAMPLES_MAX = 1024;
+static const int64_t QUERY_MAJOR_POINT_EMBED_MAX = 2048;
+static const int64_t QUERY_MAJOR_EMBED_MAX = 256;
+static const int64_t QUERY_MAJOR_EMBED_ALIGN = 8;
 
 static const std::initializer_list<DataType> VALUE_DTYPE_SUPPORT_LIST = {
     op::DataType::DT_FLOAT, op::DataType::DT_FLOAT16, op::DataType::DT_BF16};
@@ -118,6 +127,20 @@ static aclnnStatus CheckParams(const aclTensor *value, const aclTensor *spatialS
     return ACLNN_SUCCESS;
 }
 
+static bool IsQueryMajorSupported(const aclTensor *value, const aclTensor *location) {
+    auto valueShape = value->GetViewShape();
+    auto locationShape = location->GetViewShape();
+    int64_t numQueries = locationShape.GetDim(SECOND_DIM);
+    int64_t numHeads = locationShape.GetDim(NUM_HEADS);
+    int64_t numLevels = locationShape.GetDim(FOURTH_DIM);
+    int64_t numPoints = locationShape.GetDim(FIFTH_DIM);
+    int64_t embedDims = valueShape.GetDim(EMBED_DIMS);
+    return numQueries >= QUERY_MAJOR_QUERIES_MIN && numHeads <= QUERY_MAJOR_HEADS_MAX &&
+           numHeads * numLevels * numPoints <= QUERY_MAJOR_SAMPLES_MAX &&
+           numPoints * embedDims <= QUERY_MAJOR_POINT_EMBED_MAX && embedDims <= QUERY_MAJOR_EMBED_MAX &&
+           embedDims % QUERY_MAJOR_EMBED_ALIGN == 0;
+}
+
 static aclIntArray *GetDimTransposeArray(int64_t dimNum, int64_t lastDim, int64_t positiveDim,
                                          aclOpExecutor *executor) {
     int64_t perm[dimNum] = {0};
@@ -173,21 +196,27 @@ aclnnStatus aclnnMultiScaleDeformableAttentionGradGetWorkspaceSize(const aclTens
     auto gradOutputContiguous = l0op::Contiguous(gradOutput, uniqueExecutor.get());
     CHECK_RET(gradOutputContiguous != nullptr, ACLNN_ERR_INNER_NULLPTR);
 
-    // loc transpose
-    const int64_t permuteLocList[] = {0, 2, 3, 4, 5, 1};
+    // 规格满足时kernel按query切分，直接读取未转置的输入，省去输入输出共4次Transpose
+    bool noTranspose = IsQueryMajorSupported(value, location);
     int64_t locDimNum = static_cast<int64_t>(locationContiguous->GetViewShape().GetDimNum());
-    auto locAxes = uniqueExecutor.get()->AllocIntArray(permuteLocList, locDimNum);
-    CHECK_RET(locAxes != nullptr, ACLNN_ERR_INNER_NULLPTR);
-    auto locationTrans = l0op::Transpose(locationContiguous, locAxes, uniqueExecutor.get());
-    CHECK_RET(locationTrans != nullptr, ACLNN_ERR_INNER_NULLPTR);
-
-    // attnWeight transpose
-    const int64_t permuteAttnList[] = {0, 2, 3, 4, 1};
     int64_t attnDimNum = static_cast<int64_t>(attnWeightContiguous->GetViewShape().GetDimNum());
-    auto attnAxes = uniqueExecutor.get()->AllocIntArray(permuteAttnList, attnDimNum);
-    CHECK_RET(attnAxes != nullptr, ACLNN_ERR_INNER_NULLPTR);
-    auto attnWeightTrans = l0op::Transpose(attnWeightContiguous, attnAxes, uniqueExecutor.get());
-    CHECK_RET(attnWeightTrans != nullptr, ACLNN_ERR_INNER_NULLPTR);
+    auto locationTrans = locationContiguous;
+    auto attnWeightTrans = attnWeightContiguous;
+    if (!noTranspose) {
+        // loc transpose
+        const int64_t permuteLocList[] = {0, 2, 3, 4, 5, 1};
+        auto locAxes = uniqueExecutor.get()->AllocIntArray(permuteLocList, locDimNum);
+        CHECK_RET(locAxes != nullptr, ACLNN_ERR_INNER_NULLPTR);
+        locationTrans = l0op::Transpose(locationContiguous, locAxes, uniqueExecutor.get());
+        CHECK_RET(locationTrans != nullptr, ACLNN_ERR_INNER_NULLPTR);
+
+        // attnWeight transpose
+        const int64_t permuteAttnList[] = {0, 2, 3, 4, 1};
+        auto attnAxes = uniqueExecutor.get()->AllocIntArray(permuteAttnList, attnDimNum);
+        CHECK_RET(attnAxes != nullptr, ACLNN_ERR_INNER_NULLPTR);
+        attnWeightTrans = l0op::Transpose(attnWeightContiguous, attnAxes, uniqueExecutor.get());
+        CHECK_RET(attnWeightTrans != nullptr, ACLNN_ERR_INNER_NULLPTR);
+    }
 
     // 输入如果是float16/bfloat16，需要cast为float32
     auto valueCasted = l0op::Cast(valueContiguous, op::DataType::DT_FLOAT, uniqueExecutor.get());
@@ -220,19 +249,23 @@ aclnnStatus aclnnMultiScaleDeformableAttentionGradGetWorkspaceSize(const aclTens
     CHECK_RET(gradLocationNoTrans != nullptr, ACLNN_ERR_INNER_NULLPTR);
     CHECK_RET(gradAttnWeightNoTrans != nullptr, ACLNN_ERR_INNER_NULLPTR);
 
-    // locationGrad transpose
-    const int64_t permuteLocResList[] = {0, 5, 1, 2, 3, 4};
-    auto locResAxes = uniqueExecutor.get()->AllocIntArray(permuteLocResList, locDimNum);
-    CHECK_RET(locResAxes != nullptr, ACLNN_ERR_INNER_NULLPTR);
-    auto gradLocationOut = l0op::Transpose(gradLocationNoTrans, locResAxes, uniqueExecutor.get());
-    CHECK_RET(gradLocationOut != nullptr, ACLNN_ERR_INNER_NULLPTR);
-
-    // attnWeightGrad transpose
-    const int64_t permuteAttnResList[] = {0, 4, 1, 2, 3};
-    auto attnResAxes = uniqueExecutor.get()->AllocIntArray(permuteAttnResList, attnDimNum);
-    CHECK_RET(attnResAxes != nullptr, ACLNN_ERR_INNER_NULLPTR);
-    auto gradAttnWeightOut = l0op::Transpose(gradAttnWeightNoTrans, attnResAxes, uniqueExecutor.get());
-    CHECK_RET(gradAttnWeightOut != nullptr, ACLNN_ERR_INNER_NULLPTR);
+    auto gradLocationOut = gradLocationNoTrans;
+    auto gradAttnWeightOut = gradAttnWeightNoTrans;
+    if (!noTranspose) {
+        // locationGrad transpose
+        const int64_t permuteLocResList[] = {0, 5, 1, 2, 3, 4};
+        auto locResAxes = uniqueExecutor.get()->AllocIntArray(permuteLocResList, locDimNum);
+        CHECK_RET(locResAxes != nullptr, ACLNN_ERR_INNER_NULLPTR);
+        gradLocationOut = l0op::Transpose(gradLocationNoTrans, locResAxes, uniqueExecutor.get());
+        CHECK_RET(gradLocationOut != nullptr, ACLNN_ERR_INNER_NULLPTR);
+
+        // attnWeightGrad transpose
+        const int64_t permuteAttnResList[] = {0, 4, 1, 2, 3};
+        auto attnResAxes = uniqueExecutor.get()->AllocIntArray(permuteAttnResList, attnDimNum);
+        CHECK_RET(attnResAxes != nullptr, ACLNN_ERR_INNER_NULLPTR);
+        gradAttnWeightOut = l0op::Transpose(gradAttnWeightNoTrans, attnResAxes, uniqueExecutor.get());
+        CHECK_RET(gradAttnWeightOut != nullptr, ACLNN_ERR_INNER_NULLPTR);
+    }
 
     // 固定写法，将计算结果转换成输出out的数据类型
     auto gradValueCastOut = l0op::Cast(gradValueOut, gradValue->GetDataType(), uniqueExecutor.get());
@@ -25,6 +25,15 @@ namespace {
 namespace optiling {
   constexpr static int64_t FP32_MODE = 0;
   constexpr static int64_t FP16_MODE = 1;
+  // sampling_locations/attention_weights未转置([bs, num_queries, num_heads, num_levels, num_points, 2])
+  constexpr static int64_t QUERY_MAJOR_MODE = 2;
+  constexpr static uint64_t QUERY_MAJOR_QUERIES_MIN = 32;
+  constexpr static uint64_t QUERY_MAJOR_HEADS_MAX = 16;
+  constexpr static uint64_t QUERY_MAJOR_SAMPLES_MAX = 1024;
+  constexpr static uint64_t QUERY_MAJOR_POINT_EMBED_MAX = 2048;
+  constexpr static uint64_t QUERY_MAJOR_EMBED_MAX = 256;
+  constexpr static uint64_t QUERY_MAJOR_EMBED_ALIGN = 8;
+  constexpr static uint64_t LOCATION_XY_DIM = 5;
   static uint64_t RESERVE_SAPCE = 1024;
   constexpr static int64_t NUM_LEVEL_BUFFER = 3;
   constexpr static int64_t NUM_EMEBDDIM_BUFFER = 8;
@@ -38,6 +47,7 @@ namespace optiling {
         void TilingDataPrint();
     private:
         void SetTilingKeyMode(ge::DataType dType_str);
+        bool IsQueryMajorSupported() const;
         MultiScaleDeformableAttentionGradTilingData TilingData;
         gert::TilingContext* TilingContext = nullptr;
         uint64_t batch_size = 1; // 1 size
@@ -53,8 +63,15 @@ namespace optiling {
         uint64_t max_ub_num = 0;
         uint64_t ub_size = 192 * 1024; // 192 * 1024 size
         uint64_t deterministicFlag = 0;
+        bool query_major = false;
   };
 
+  bool MultiScaleDeformableAttentionGradTiling::IsQueryMajorSupported() const {
+    return num_heads <= QUERY_MAJOR_HEADS_MAX && num_heads * num_levels * num_point <= QUERY_MAJOR_SAMPLES_MAX &&
+           num_point * channels <= QUERY_MAJOR_POINT_EMBED_MAX && channels <= QUERY_MAJOR_EMBED_MAX &&
+           channels % QUERY_MAJOR_EMBED_ALIGN == 0;
+  }
+
   void MultiScaleDeformableAttentionGradTiling::SetTilingKeyMode(ge::DataType dType_str) {
     switch (dType_str) {
         case ge::DT_FLOAT:
@@ -95,6 +112,23 @@ namespace optiling {
     OP_LOGD(TilingContext->GetNodeName(), "batch size is %lu.", batch_size);
     OP_LOGD(TilingContext->GetNodeName(), "num_head is %lu.", num_heads);
     OP_LOGD(TilingContext->GetNodeName(), "spatial_size is %lu.", spatial_size);
+    // aclnn只在满足IsQueryMajorSupported时跳过转置，此时dim1为num_queries(>=32)、dim2为num_heads
+    query_major = sampling_loc_shape.GetDim(LOCATION_XY_DIM) == sample_step &&
+                  static_cast<uint64_t>(sampling_loc_shape.GetDim(1)) >= QUERY_MAJOR_QUERIES_MIN &&
+                  static_cast<uint64_t>(sampling_loc_shape.GetDim(sample_idx)) == num_heads;
+    if (query_major) {
+      num_query = sampling_loc_shape.GetDim(1);
+      num_levels = sampling_loc_shape.GetDim(sample_idx + 1);
+      num_point = sampling_loc_shape.GetDim(sample_idx + sample_step);
+      if (!IsQueryMajorSupported()) {
+        OP_LOGE(TilingContext->GetNodeName(), "query-major layout is not supported for this shape.");
+        return ge::GRAPH_FAILED;
+      }
+      TilingContext->SetTilingKey(QUERY_MAJOR_MODE);
+      core_used = std::min(core_num, batch_size * num_query);
+      OP_LOGD(TilingContext->GetNodeName(), "Tiling init finish.");
+      return ge::GRAPH_SUCCESS;
+    }
     num_levels = sampling_loc_shape.GetDim(sample_idx++);
     num_point = sampling_loc_shape.GetDim(sample_idx);
     sample_idx += sample_step;
@@ -150,7 +184,9 @@ namespace optiling {
 
   static ge::graphStatus TilingMultiScaleDeformableAttentionGrad(gert::TilingContext* context) {
     MultiScaleDeformableAttentionGradTiling tilingObject(context);
-    tilingObject.Init();
+    if (tilingObject.Init() != ge::GRAPH_SUCCESS) {
+      return ge::GRAPH_FAILED;
+    }
     return tilingObject.RunKernelTiling();
   }
 
@@ -36,6 +36,15 @@
 
 using namespace ge;
 namespace ops {
+constexpr int64_t QUERY_MAJOR_QUERIES_MIN = 32;
+
+// sampling_locations为[bs, num_queries, num_heads, num_levels, num_points, 2]时不经过转置，与tiling侧判断一致
+static bool IsQueryMajorLayout(const gert::Shape *valueShape, const gert::Shape *samplingLocationsShape)
+{
+    return samplingLocationsShape->GetDim(5) == 2 && samplingLocationsShape->GetDim(1) >= QUERY_MAJOR_QUERIES_MIN &&
+           samplingLocationsShape->GetDim(2) == valueShape->GetDim(2); // 5: xy dim; 2: heads dim
+}
+
 static ge::graphStatus InferShapeForMultiScaleDeformableAttentionGrad(gert::InferShapeContext *context)
 {
     const gert::Shape *valueShape = context->GetInputShape(0);
@@ -70,7 +79,11 @@ static ge::graphStatus InferShapeForMultiScaleDeformableAttentionGrad(gert::Infe
     gradAttnWeightShape->AppendDim(samplingLocationsShape->GetDim(1));
     gradAttnWeightShape->AppendDim(samplingLocationsShape->GetDim(2)); // dim 2
     gradAttnWeightShape->AppendDim(samplingLocationsShape->GetDim(3)); // dim 3
-    gradAttnWeightShape->AppendDim(samplingLocationsShape->GetDim(5)); // dim5
+    if (IsQueryMajorLayout(valueShape, samplingLocationsShape)) {
+        gradAttnWeightShape->AppendDim(samplingLocationsShape->GetDim(4)); // dim 4
+    } else {
+        gradAttnWeightShape->AppendDim(samplingLocationsShape->GetDim(5)); // dim5
+    }
     return GRAPH_SUCCESS;
 }
 
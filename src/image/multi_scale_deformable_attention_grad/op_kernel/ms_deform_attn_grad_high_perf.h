@@ -0,0 +1,411 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file ms_deform_attn_grad_high_perf.h
+ * \brief query-major grad kernel: reads sampling_locations/attention_weights without transpose,
+ *        one core owns whole (batch, query) rows so grad_sampling_locations/grad_attention_weights need no atomics
+ */
+
+#ifndef MS_DEFORM_ATTN_GRAD_HIGH_PERF_H_
+#define MS_DEFORM_ATTN_GRAD_HIGH_PERF_H_
+
+#include "kernel_operator.h"
+
+using namespace AscendC;
+
+class KernelMultiScaleDeformableAttnGradOpt {
+public:
+    __aicore__ inline KernelMultiScaleDeformableAttnGradOpt() = delete;
+
+    __aicore__ inline KernelMultiScaleDeformableAttnGradOpt(GM_ADDR value, GM_ADDR valueSpatialShapes,
+        GM_ADDR valueLevelStartIndex, GM_ADDR samplingLocations, GM_ADDR attentionWeights, GM_ADDR gradOutput,
+        GM_ADDR gradValue, GM_ADDR gradSamplingLocations, GM_ADDR gradAttentionWeights,
+        const MultiScaleDeformableAttentionGradTilingData* tilingData, TPipe* pipe)
+        : pipe_(pipe), blkIdx_(GetBlockIdx())
+    {
+        InitTiling(tilingData);
+        InitTask();
+        InitGM(value, valueSpatialShapes, valueLevelStartIndex, samplingLocations, attentionWeights, gradOutput,
+            gradValue, gradSamplingLocations, gradAttentionWeights);
+        InitBuffer();
+        InitEvent();
+    }
+
+    __aicore__ inline void Process();
+
+private:
+    __aicore__ inline void InitTiling(const MultiScaleDeformableAttentionGradTilingData* tilingData)
+    {
+        batchSize_ = tilingData->batchSize;
+        numKeys_ = tilingData->numKeys;
+        numHeads_ = tilingData->numHeads;
+        embedDims_ = tilingData->embedDims;
+        numLevels_ = tilingData->numLevels;
+        numQueries_ = tilingData->numQueries;
+        numPoints_ = tilingData->numPoints;
+        coreNum_ = tilingData->coreNum;
+
+        oneQueryNum_ = numHeads_ * numLevels_ * numPoints_;
+        alignedSampleNum_ = AlignUp(oneQueryNum_, B32_DATA_NUM_PER_BLOCK);
+        alignedLocNum_ = AlignUp(TWO * oneQueryNum_, B32_DATA_NUM_PER_BLOCK);
+        outDims_ = numHeads_ * embedDims_;
+        embedBlk_ = embedDims_ / B32_DATA_NUM_PER_BLOCK;
+        outBlk_ = outDims_ / B32_DATA_NUM_PER_BLOCK;
+        // acc rows: [sampled value | d/dw | d/dh] * numPoints, reduced against grad_output in one Sum
+        accRows_ = THREE * numPoints_;
+
+        cpOneValParams_.blockLen = embedBlk_;
+        cpDoubleValParams_.blockLen = embedBlk_;
+        cpDoubleValParams_.srcStride = outBlk_ - embedBlk_;
+    }
+
+    __aicore__ inline void InitTask()
+    {
+        uint32_t taskNum = batchSize_ * numQueries_;
+        uint32_t avgTasks = taskNum / coreNum_;
+        uint32_t remainTasks = taskNum % coreNum_;
+        startOffset_ = avgTasks * blkIdx_ + (blkIdx_ < remainTasks ? blkIdx_ : remainTasks);
+        endOffset_ = startOffset_ + avgTasks + (blkIdx_ < remainTasks ? 1 : 0);
+    }
+
+    __aicore__ inline void InitGM(GM_ADDR value, GM_ADDR valueSpatialShapes, GM_ADDR valueLevelStartIndex,
+        GM_ADDR samplingLocations, GM_ADDR attentionWeights, GM_ADDR gradOutput, GM_ADDR gradValue,
+        GM_ADDR gradSamplingLocations, GM_ADDR gradAttentionWeights)
+    {
+        valueGm_.SetGlobalBuffer(reinterpret_cast<__gm__ float*>(value));
+        locationGm_.SetGlobalBuffer(reinterpret_cast<__gm__ float*>(samplingLocations));
+        attentionWeightsGm_.SetGlobalBuffer(reinterpret_cast<__gm__ float*>(attentionWeights));
+        gradOutputGm_.SetGlobalBuffer(reinterpret_cast<__gm__ float*>(gradOutput));
+        valueSpatialShapesGm_.SetGlobalBuffer(reinterpret_cast<__gm__ int32_t*>(valueSpatialShapes));
+        valueLevelStartIndexGm_.SetGlobalBuffer(reinterpret_cast<__gm__ int32_t*>(valueLevelStartIndex));
+
+        gradValueGm_.SetGlobalBuffer(reinterpret_cast<__gm__ float*>(gradValue));
+        gradLocationGm_.SetGlobalBuffer(reinterpret_cast<__gm__ float*>(gradSamplingLocations));
+        gradWeightGm_.SetGlobalBuffer(reinterpret_cast<__gm__ float*>(gradAttentionWeights));
+    }
+
+    __aicore__ inline void InitBuffer()
+    {
+        pipe_->InitBuffer(shapeBuf_, AlignUp(numLevels_ * TWO, B32_DATA_NUM_PER_BLOCK) * B32_BYTE_SIZE);
+        pipe_->InitBuffer(offsetBuf_, AlignUp(numLevels_, B32_DATA_NUM_PER_BLOCK) * B32_BYTE_SIZE);
+        pipe_->InitBuffer(locationBuf_, alignedLocNum_ * B32_BYTE_SIZE);
+        pipe_->InitBuffer(attentionWeightsBuf_, alignedSampleNum_ * B32_BYTE_SIZE);
+        pipe_->InitBuffer(topGradBuf_, outDims_ * B32_BYTE_SIZE);
+        pipe_->InitBuffer(gradLocationBuf_, alignedLocNum_ * B32_BYTE_SIZE);
+        pipe_->InitBuffer(gradWeightBuf_, alignedSampleNum_ * B32_BYTE_SIZE);
+
+        pipe_->InitBuffer(cornerBuf_, TWO * FOUR * embedDims_ * B32_BYTE_SIZE); // TWO for double buffer
+        pipe_->InitBuffer(midBuf_, TWO * FOUR * embedDims_ * B32_BYTE_SIZE);
+        pipe_->InitBuffer(accBuf_, accRows_ * embedDims_ * B32_BYTE_SIZE);
+        pipe_->InitBuffer(sumBuf_, AlignUp(accRows_, B32_DATA_NUM_PER_BLOCK) * B32_BYTE_SIZE);
+    }
+
+    __aicore__ inline void InitEvent()
+    {
+        calEvt_ = pipe_->AllocEventID<HardEvent::V_MTE3>();
+        copyEvt_ = pipe_->AllocEventID<HardEvent::MTE2_V>();
+        sampleEvt_ = pipe_->AllocEventID<HardEvent::MTE2_S>();
+        sumEvt_ = pipe_->AllocEventID<HardEvent::V_S>();
+        outEvt_ = pipe_->AllocEventID<HardEvent::S_MTE3>();
+        outDoneEvt_ = pipe_->AllocEventID<HardEvent::MTE3_S>();
+        topEvt_ = pipe_->AllocEventID<HardEvent::V_MTE2>();
+        for (uint32_t i = 0; i < TWO; ++i) {
+            cornerEvt_[i] = pipe_->AllocEventID<HardEvent::V_MTE2>();
+            midEvt_[i] = pipe_->AllocEventID<HardEvent::MTE3_V>();
+        }
+    }
+
+    __aicore__ inline void ClearGradValue();
+
+    __aicore__ inline void PrepareShape();
+
+    __aicore__ inline void CopyInQuery(uint32_t task);
+
+    __aicore__ inline void CopyInCorners(const LocalTensor<float>& corner, uint32_t srcOffset, int32_t hLow,
+        int32_t wLow, int32_t h, int32_t w);
+
+    __aicore__ inline void ScatterGradValue(const LocalTensor<float>& top, const LocalTensor<float>& mid,
+        uint32_t srcOffset, int32_t hLow, int32_t wLow, int32_t h, int32_t w, float attn, float lh, float lw);
+
+    __aicore__ inline void ComputeSample(const LocalTensor<float>& top, uint32_t point, uint32_t srcOffset,
+        float locH, float locW, float attn, int32_t h, int32_t w);
+
+    __aicore__ inline void ComputeLevel(uint32_t head, uint32_t level, uint32_t batch);
+
+    __aicore__ inline void CopyOutQuery(uint32_t task);
+
+private:
+    TPipe* pipe_;
+    GlobalTensor<float> valueGm_, locationGm_, attentionWeightsGm_, gradOutputGm_;
+    GlobalTensor<float> gradValueGm_, gradLocationGm_, gradWeightGm_;
+    GlobalTensor<int32_t> valueSpatialShapesGm_, valueLevelStartIndexGm_;
+
+    TBuf<TPosition::VECCALC> shapeBuf_, offsetBuf_, locationBuf_, attentionWeightsBuf_, topGradBuf_;
+    TBuf<TPosition::VECCALC> gradLocationBuf_, gradWeightBuf_, cornerBuf_, midBuf_, accBuf_, sumBuf_;
+
+    LocalTensor<int32_t> shapes_, offset_;
+    LocalTensor<float> location_, attentionWeight_, topGrad_, gradLocation_, gradWeight_;
+    LocalTensor<float> corner_, mid_, acc_, sum_;
+
+    int32_t blkIdx_;
+
+    uint32_t batchSize_, numKeys_, numHeads_, embedDims_, outDims_, numLevels_, numQueries_, numPoints_, coreNum_;
+    uint32_t startOffset_, endOffset_;
+    uint32_t oneQueryNum_, alignedSampleNum_, alignedLocNum_, accRows_;
+    uint16_t embedBlk_, outBlk_;
+    uint32_t TWO = 2, THREE = 3, FOUR = 4;
+    uint8_t ping_ = 0;
+
+    TEventID calEvt_, copyEvt_, sampleEvt_, sumEvt_, outEvt_, outDoneEvt_, topEvt_;
+    TEventID cornerEvt_[2], midEvt_[2];
+
+    DataCopyParams cpOneValParams_, cpDoubleValParams_ {2, 0, 0, 0};
+};
+
+__aicore__ inline void KernelMultiScaleDeformableAttnGradOpt::ClearGradValue()
+{
+    uint64_t total = static_cast<uint64_t>(batchSize_) * numKeys_ * outDims_;
+    uint64_t perCore = AlignUp(DivCeil(total, static_cast<uint64_t>(GetBlockNum())), B32_DATA_NUM_PER_BLOCK);
+    uint64_t start = perCore * blkIdx_;
+    if (start < total) {
+        uint64_t len = total - start < perCore ? total - start : perCore;
+        InitOutput<float>(gradValueGm_[start], len, 0);
+    }
+    if ASCEND_IS_AIV {
+        SyncAll();
+    }
+}
+
+__aicore__ inline void KernelMultiScaleDeformableAttnGradOpt::PrepareShape()
+{
+    DataCopy(shapes_, valueSpatialShapesGm_,
+        {1, static_cast<uint16_t>(DivCeil(TWO * numLevels_, B32_DATA_NUM_PER_BLOCK)), 0, 0});
+    DataCopy(offset_, valueLevelStartIndexGm_,
+        {1, static_cast<uint16_t>(DivCeil(numLevels_, B32_DATA_NUM_PER_BLOCK)), 0, 0});
+    SetFlag<HardEvent::MTE2_S>(sampleEvt_);
+    WaitFlag<HardEvent::MTE2_S>(sampleEvt_);
+}
+
+__aicore__ inline void KernelMultiScaleDeformableAttnGradOpt::CopyInQuery(uint32_t task)
+{
+    // location/attention_weights rows are read by scalar, grad_output row by vector
+    WaitFlag<HardEvent::V_MTE2>(topEvt_);
+    DataCopyPad(location_, locationGm_[task * TWO * oneQueryNum_],
+        {1, static_cast<uint32_t>(TWO * oneQueryNum_ * B32_BYTE_SIZE), 0, 0, 0}, {false, 0, 0, 0});
+    DataCopyPad(attentionWeight_, attentionWeightsGm_[task * oneQueryNum_],
+        {1, static_cast<uint32_t>(oneQueryNum_ * B32_BYTE_SIZE), 0, 0, 0}, {false, 0, 0, 0});
+    DataCopy(topGrad_, gradOutputGm_[task * outDims_], {1, outBlk_, 0, 0});
+    SetFlag<HardEvent::MTE2_S>(sampleEvt_);
+    SetFlag<HardEvent::MTE2_V>(copyEvt_);
+    WaitFlag<HardEvent::MTE2_S>(sampleEvt_);
+    WaitFlag<HardEvent::MTE2_V>(copyEvt_);
+}
+
+__aicore__ inline void KernelMultiScaleDeformableAttnGradOpt::CopyInCorners(const LocalTensor<float>& corner,
+    uint32_t srcOffset, int32_t hLow, int32_t wLow, int32_t h, int32_t w)
+{
+    // corner rows: [v1(hLow, wLow) | v2(hLow, wHigh) | v3(hHigh, wLow) | v4(hHigh, wHigh)]
+    int32_t hHigh = hLow + 1;
+    int32_t wHigh = wLow + 1;
+    if (hLow >= 0) {
+        if (wLow >= 0 && wHigh < w) {
+            DataCopy(corner, valueGm_[srcOffset + (hLow * w + wLow) * outDims_], cpDoubleValParams_);
+        } else if (wLow >= 0) {
+            DataCopy(corner, valueGm_[srcOffset + (hLow * w + wLow) * outDims_], cpOneValParams_);
+        } else if (wHigh < w) {
+            DataCopy(corner[embedDims_], valueGm_[srcOffset + (hLow * w + wHigh) * outDims_], cpOneValParams_);
+        }
+    }
+    if (hHigh < h) {
+        if (wLow >= 0 && wHigh < w) {
+            DataCopy(corner[TWO * embedDims_], valueGm_[srcOffset + (hHigh * w + wLow) * outDims_],
+                cpDoubleValParams_);
+        } else if (wLow >= 0) {
+            DataCopy(corner[TWO * embedDims_], valueGm_[srcOffset + (hHigh * w + wLow) * outDims_], cpOneValParams_);
+        } else if (wHigh < w) {
+            DataCopy(corner[THREE * embedDims_], valueGm_[srcOffset + (hHigh * w + wHigh) * outDims_],
+                cpOneValParams_);
+        }
+    }
+}
+
+__aicore__ inline void KernelMultiScaleDeformableAttnGradOpt::ScatterGradValue(const LocalTensor<float>& top,
+    const LocalTensor<float>& mid, uint32_t srcOffset, int32_t hLow, int32_t wLow, int32_t h, int32_t w, float attn,
+    float lh, float lw)
+{
+    int32_t hHigh = hLow + 1;
+    int32_t wHigh = wLow + 1;
+    float hh = 1.f - lh;
+    float hw = 1.f - lw;
+    bool valid[4] = {hLow >= 0 && wLow >= 0, hLow >= 0 && wHigh < w, hHigh < h && wLow >= 0, hHigh < h && wHigh < w};
+    float weight[4] = {hh * hw, hh * lw, lh * hw, lh * lw};
+    int32_t key[4] = {hLow * w + wLow, hLow * w + wHigh, hHigh * w + wLow, hHigh * w + wHigh};
+
+    WaitFlag<HardEvent::MTE3_V>(midEvt_[ping_]);
+    for (uint32_t i = 0; i < FOUR; ++i) {
+        if (valid[i]) {
+            Muls(mid[i * embedDims_], top, attn * weight[i], embedDims_);
+        }
+    }
+    SetFlag<HardEvent::V_MTE3>(calEvt_);
+    WaitFlag<HardEvent::V_MTE3>(calEvt_);
+    SetAtomicAdd<float>();
+    for (uint32_t i = 0; i < FOUR; ++i) {
+        if (valid[i]) {
+            DataCopy(gradValueGm_[srcOffset + key[i] * outDims_], mid[i * embedDims_], cpOneValParams_);
+        }
+    }
+    SetAtomicNone();
+    SetFlag<HardEvent::MTE3_V>(midEvt_[ping_]);
+}
+
+__aicore__ inline void KernelMultiScaleDeformableAttnGradOpt::ComputeSample(const LocalTensor<float>& top,
+    uint32_t point, uint32_t srcOffset, float locH, float locW, float attn, int32_t h, int32_t w)
+{
+    // locH/locW > -1 here, so truncation is floor except for (-1, 0)
+    int32_t hLow = locH < 0 ? -1 : static_cast<int32_t>(locH);
+    int32_t wLow = locW < 0 ? -1 : static_cast<int32_t>(locW);
+    float lh = locH - hLow;
+    float lw = locW - wLow;
+    float hh = 1.f - lh;
+    float hw = 1.f - lw;
+
+    LocalTensor<float> corner = corner_[ping_ * FOUR * embedDims_];
+    WaitFlag<HardEvent::V_MTE2>(cornerEvt_[ping_]);
+    CopyInCorners(corner, srcOffset, hLow, wLow, h, w);
+    SetFlag<HardEvent::MTE2_V>(copyEvt_);
+
+    // grad_value does not depend on the gathered corners, overlap it with the gather
+    ScatterGradValue(top, mid_[ping_ * FOUR * embedDims_], srcOffset, hLow, wLow, h, w, attn, lh, lw);
+
+    WaitFlag<HardEvent::MTE2_V>(copyEvt_);
+    // out-of-range corners stay zero in the tile, so all four are accumulated unconditionally
+    LocalTensor<float> accVal = acc_[point * embedDims_];
+    LocalTensor<float> accW = acc_[(numPoints_ + point) * embedDims_];
+    LocalTensor<float> accH = acc_[(TWO * numPoints_ + point) * embedDims_];
+    LocalTensor<float> v1 = corner;
+    LocalTensor<float> v2 = corner[embedDims_];
+    LocalTensor<float> v3 = corner[TWO * embedDims_];
+    LocalTensor<float> v4 = corner[THREE * embedDims_];
+    Axpy(accVal, v1, hh * hw, embedDims_);
+    Axpy(accVal, v2, hh * lw, embedDims_);
+    Axpy(accVal, v3, lh * hw, embedDims_);
+    Axpy(accVal, v4, lh * lw, embedDims_);
+    Axpy(accW, v1, -hh, embedDims_);
+    Axpy(accW, v2, hh, embedDims_);
+    Axpy(accW, v3, -lh, embedDims_);
+    Axpy(accW, v4, lh, embedDims_);
+    Axpy(accH, v1, -hw, embedDims_);
+    Axpy(accH, v2, -lw, embedDims_);
+    Axpy(accH, v3, hw, embedDims_);
+    Axpy(accH, v4, lw, embedDims_);
+    PipeBarrier<PIPE_V>();
+    Duplicate(corner, 0.f, FOUR * embedDims_);
+    SetFlag<HardEvent::V_MTE2>(cornerEvt_[ping_]);
+    ping_ = 1 - ping_;
+}
+
+__aicore__ inline void KernelMultiScaleDeformableAttnGradOpt::ComputeLevel(uint32_t head, uint32_t level,
+    uint32_t batch)
+{
+    int32_t h = shapes_.GetValue(level * TWO);
+    int32_t w = shapes_.GetValue(level * TWO + 1);
+    uint32_t srcOffset = (batch * numKeys_ + offset_.GetValue(level)) * outDims_ + head * embedDims_;
+    uint32_t sampleBase = (head * numLevels_ + level) * numPoints_;
+    LocalTensor<float> top = topGrad_[head * embedDims_];
+
+    Duplicate(acc_, 0.f, accRows_ * embedDims_);
+    for (uint32_t point = 0; point < numPoints_; ++point) {
+        uint32_t sample = sampleBase + point;
+        float locW = location_.GetValue(TWO * sample) * w - 0.5f;
+        float locH = location_.GetValue(TWO * sample + 1) * h - 0.5f;
+        if (locH > -1 && locW > -1 && locH < h && locW < w) {
+            ComputeSample(top, point, srcOffset, locH, locW, attentionWeight_.GetValue(sample), h, w);
+        }
+    }
+
+    // dot every acc row with grad_output of this head: same top row for all repeats (src1 rep stride 0)
+    uint8_t rowStride = static_cast<uint8_t>(embedBlk_);
+    for (uint32_t c = 0; c < embedDims_; c += B32_DATA_NUM_PER_REPEAT) {
+        uint64_t mask = embedDims_ - c < B32_DATA_NUM_PER_REPEAT ? embedDims_ - c : B32_DATA_NUM_PER_REPEAT;
+        Mul(acc_[c], acc_[c], top[c], mask, accRows_, {1, 1, 1, rowStride, rowStride, 0});
+    }
+    PipeBarrier<PIPE_V>();
+    Sum(sum_, acc_, {accRows_, embedDims_, embedDims_});
+    SetFlag<HardEvent::V_S>(sumEvt_);
+    WaitFlag<HardEvent::V_S>(sumEvt_);
+
+    for (uint32_t point = 0; point < numPoints_; ++point) {
+        uint32_t sample = sampleBase + point;
+        float attn = attentionWeight_.GetValue(sample);
+        gradWeight_.SetValue(sample, sum_.GetValue(point));
+        gradLocation_.SetValue(TWO * sample, sum_.GetValue(numPoints_ + point) * attn * w);
+        gradLocation_.SetValue(TWO * sample + 1, sum_.GetValue(TWO * numPoints_ + point) * attn * h);
+    }
+}
+
+__aicore__ inline void KernelMultiScaleDeformableAttnGradOpt::CopyOutQuery(uint32_t task)
+{
+    SetFlag<HardEvent::S_MTE3>(outEvt_);
+    WaitFlag<HardEvent::S_MTE3>(outEvt_);
+    DataCopyPad(gradLocationGm_[task * TWO * oneQueryNum_], gradLocation_,
+        {1, static_cast<uint32_t>(TWO * oneQueryNum_ * B32_BYTE_SIZE), 0, 0, 0});
+    DataCopyPad(gradWeightGm_[task * oneQueryNum_], gradWeight_,
+        {1, static_cast<uint32_t>(oneQueryNum_ * B32_BYTE_SIZE), 0, 0, 0});
+    SetFlag<HardEvent::MTE3_S>(outDoneEvt_);
+}
+
+__aicore__ inline void KernelMultiScaleDeformableAttnGradOpt::Process()
+{
+    shapes_ = shapeBuf_.Get<int32_t>();
+    offset_ = offsetBuf_.Get<int32_t>();
+    location_ = locationBuf_.Get<float>();
+    attentionWeight_ = attentionWeightsBuf_.Get<float>();
+    topGrad_ = topGradBuf_.Get<float>();
+    gradLocation_ = gradLocationBuf_.Get<float>();
+    gradWeight_ = gradWeightBuf_.Get<float>();
+    corner_ = cornerBuf_.Get<float>();
+    mid_ = midBuf_.Get<float>();
+    acc_ = accBuf_.Get<float>();
+    sum_ = sumBuf_.Get<float>();
+
+    ClearGradValue();
+    PrepareShape();
+    Duplicate(corner_, 0.f, TWO * FOUR * embedDims_);
+    SetFlag<HardEvent::V_MTE2>(topEvt_);
+    SetFlag<HardEvent::MTE3_S>(outDoneEvt_);
+    for (uint32_t i = 0; i < TWO; ++i) {
+        SetFlag<HardEvent::V_MTE2>(cornerEvt_[i]);
+        SetFlag<HardEvent::MTE3_V>(midEvt_[i]);
+    }
+
+    for (uint32_t task = startOffset_; task < endOffset_; ++task) {
+        uint32_t batch = task / numQueries_;
+        CopyInQuery(task);
+        WaitFlag<HardEvent::MTE3_S>(outDoneEvt_);
+        for (uint32_t head = 0; head < numHeads_; ++head) {
+            for (uint32_t level = 0; level < numLevels_; ++level) {
+                ComputeLevel(head, level, batch);
+            }
+        }
+        SetFlag<HardEvent::V_MTE2>(topEvt_);
+        CopyOutQuery(task);
+    }
+
+    WaitFlag<HardEvent::V_MTE2>(topEvt_);
+    WaitFlag<HardEvent::MTE3_S>(outDoneEvt_);
+    for (uint32_t i = 0; i < TWO; ++i) {
+        WaitFlag<HardEvent::V_MTE2>(cornerEvt_[i]);
+        WaitFlag<HardEvent::MTE3_V>(midEvt_[i]);
+    }
+}
+
+#endif // MS_DEFORM_ATTN_GRAD_HIGH_PERF_H_
@@ -19,6 +19,7 @@
  * \brief
  */
 #include "multi_scale_deformable_attention_grad.h"
+#include "ms_deform_attn_grad_high_perf.h"
 
 using namespace AscendC;
 // core func
@@ -32,6 +33,13 @@ extern "C" __global__ __aicore__ void multi_scale_deformable_attention_grad(GM_A
     
     TPipe pipe;
     GET_TILING_DATA(tiling_datas, tiling_data);
+    if (TILING_KEY_IS(2)) {
+        KernelMultiScaleDeformableAttnGradOpt op(value_gm, spatial_shapes_gm, level_start_index_gm, sampling_loc_gm,
+            attn_weight_gm, grad_output_gm, grad_value_gm, grad_sampling_loc_gm, grad_attn_weight_gm, &tiling_datas,
+            &pipe);
+        op.Process();
+        return;
+    }
     MultiScaleDeformableAttentionGrad op;
     op.Init(value_gm, spatial_shapes_gm, level_start_index_gm, sampling_loc_gm, attn_weight_gm, grad_output_gm,
             grad_value_gm, grad_sampling_loc_gm, grad_attn_weight_gm, &tiling_datas, &pipe);
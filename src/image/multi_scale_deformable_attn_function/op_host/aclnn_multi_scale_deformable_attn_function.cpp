@@ -56,6 +56,8 @@ static const int64_t LOCATION_DIM_LIMIT = 6;
 static const int64_t ATTN_WEIGHT_DIM_LIMIT = 5;
 static const int64_t DIM_ONE = 1;
 static const int64_t DIM_FIVE = 5;
+// 与tiling侧HEAD_LEVEL_MAX_CHANNEL_TILED保持一致
+static const uint64_t HEAD_LEVEL_MAX_NO_TRANSPOSE = 128;
 
 static const std::initializer_list<DataType> VALUE_DTYPE_SUPPORT_LIST = {
     op::DataType::DT_FLOAT, op::DataType::DT_FLOAT16, op::DataType::DT_BF16};
@@ -217,16 +219,12 @@ aclnnStatus aclnnMultiScaleDeformableAttnFunctionGetWorkspaceSize(const aclTenso
     auto attnWeightContiguous = l0op::Contiguous(attnWeight, uniqueExecutor.get());
     CHECK_RET(attnWeightContiguous != nullptr, ACLNN_ERR_INNER_NULLPTR);
 
-    auto valueShape = value->GetViewShape();
     auto locationShape = location->GetViewShape();
-    uint64_t numQueries =  locationShape.GetDim(1);
     uint64_t numHeads =  locationShape.GetDim(2);
     uint64_t numLevels =  locationShape.GetDim(3);
-    uint64_t numPoints =  locationShape.GetDim(4);
-    uint64_t embedDims =  valueShape.GetDim(3);
-    uint64_t noTranspose = numLevels <= 8 && numHeads <= 8 && (embedDims == 16 || embedDims == 32) &&
-                        (numPoints % 2 == 0 || numPoints == 1);
-    
+    // 高性能kernel(含通道分块kernel)直接读取未转置的输入，只有head*level超过ub容量时才需要转置
+    uint64_t noTranspose = numHeads * numLevels <= HEAD_LEVEL_MAX_NO_TRANSPOSE;
+
     if (noTranspose == 0){
         // value transpose
         const int64_t permuteValueList[] = {0, 2, 1, 3};
@@ -46,6 +46,9 @@ const uint64_t NUM_POINTS_TWO = 2;
 const uint64_t EMBEDDIMS_SIXTEEN = 16;
 const uint64_t sysWorkspaceSize = 16 * 1024 *1024;
 const uint64_t TILING_KEY_WEIGHT = 1000;
+const uint64_t TILING_KEY_CHANNEL_TILED = 10000;
+// 通道分块kernel的ub占用随head*level线性增长，超过该值时回退到转置+通用kernel
+const uint64_t HEAD_LEVEL_MAX_CHANNEL_TILED = 128;
 
 const uint64_t NUM_QUERIES_MIN = 32;
 const uint64_t NUM_HEADS_MAX = 16;
@@ -136,11 +139,12 @@ static ge::graphStatus TilingFuncForMultiScaleDeformableAttn(gert::TilingContext
         numQueries = attnWeightShape.GetDim(NUM_QUERIES_DIM_TRANSPOSE);
         realLevels = attnWeightShape.GetDim(REAL_LEVEL_DIM_TRANSPOSE);
     }
-    uint64_t optPoint = numLevels <= 8 && numHeads <= 8 && (embedDims == 16 || embedDims == 32) &&
-                        (numPoints % 2 == 0 || numPoints == 1);
+    uint64_t optPoint = isTranspose == 0 && numLevels <= 8 && numHeads <= 8 &&
+                        (embedDims == 16 || embedDims == 32) && numPoints % 2 == 0;
+    uint64_t tiledPoint = isTranspose == 0 && optPoint == 0 && numHeads * numLevels <= HEAD_LEVEL_MAX_CHANNEL_TILED;
     uint64_t pointLoops = 0;
     uint64_t point = 0;
-    if (optPoint) {
+    if (optPoint || tiledPoint) {
         auto groups = GroupPoints(numPoints);
         pointLoops = std::get<1>(groups);
         point = std::get<0>(groups);
@@ -171,7 +175,12 @@ static ge::graphStatus TilingFuncForMultiScaleDeformableAttn(gert::TilingContext
         return ge::GRAPH_FAILED;
     }
 
-    uint64_t TilingKey = optPoint == 1 ? (embedDims / EMBEDDIMS_SIXTEEN) * TILING_KEY_WEIGHT + point : 0;
+    uint64_t TilingKey = 0;
+    if (optPoint == 1) {
+        TilingKey = (embedDims / EMBEDDIMS_SIXTEEN) * TILING_KEY_WEIGHT + point;
+    } else if (tiledPoint == 1) {
+        TilingKey = TILING_KEY_CHANNEL_TILED + point;
+    }
     OP_LOGD(context->GetNodeName(), "TilingKey = %lu", TilingKey);
     
     context->SetTilingKey(TilingKey);
@@ -21,6 +21,7 @@
 
 #include "ms_deform_attn_generic.h"
 #include "ms_deform_attn_high_perf.h"
+#include "ms_deform_attn_channel_tiled.h"
 
 extern "C" __global__ __aicore__ void multi_scale_deformable_attn_function(GM_ADDR value, GM_ADDR valueSpatialShapes,
     GM_ADDR valueLevelStartIndex, GM_ADDR samplingLocations, GM_ADDR attentionWeights, GM_ADDR output,
@@ -52,6 +53,22 @@ extern "C" __global__ __aicore__ void multi_scale_deformable_attn_function(GM_AD
         KernelMultiScaleDeformableAttnOpt<8, 32> op(value, valueSpatialShapes, valueLevelStartIndex, samplingLocations,
             attentionWeights, output, &tilingData, &pipe);
         op.Process();
+    } else if (TILING_KEY_IS(10001)) {
+        KernelMultiScaleDeformableAttnTiled<1> op(value, valueSpatialShapes, valueLevelStartIndex, samplingLocations,
+            attentionWeights, output, &tilingData, &pipe);
+        op.Process();
+    } else if (TILING_KEY_IS(10002)) {
+        KernelMultiScaleDeformableAttnTiled<2> op(value, valueSpatialShapes, valueLevelStartIndex, samplingLocations,
+            attentionWeights, output, &tilingData, &pipe);
+        op.Process();
+    } else if (TILING_KEY_IS(10004)) {
+        KernelMultiScaleDeformableAttnTiled<4> op(value, valueSpatialShapes, valueLevelStartIndex, samplingLocations,
+            attentionWeights, output, &tilingData, &pipe);
+        op.Process();
+    } else if (TILING_KEY_IS(10008)) {
+        KernelMultiScaleDeformableAttnTiled<8> op(value, valueSpatialShapes, valueLevelStartIndex, samplingLocations,
+            attentionWeights, output, &tilingData, &pipe);
+        op.Process();
     } else if (TILING_KEY_IS(0)) {
         KernelMultiScaleDeformableAttn op;
         op.Init(value, valueSpatialShapes, valueLevelStartIndex, samplingLocations, attentionWeights, output, &tilingData, &pipe);
@@ -18,6 +18,7 @@
 #include <type_traits>
 #include "kernel_operator.h"
 #include "lib/matmul_intf.h"
+#include "aa_weight_table.h"
 
 namespace UpsampleBicubic2dAA {
 using namespace AscendC;
@@ -106,6 +107,9 @@ class UpsampleBicubic2dAAND {
   TBuf<> xMinTensorBuff;
   TBuf<> xSizeTensorBuff;
   TBuf<> weightTensorBuff;
+  // 系数矩阵向量化生成
+  AAResize::AAWeightTable<AAResize::BicubicFilter> weightTable;
+  AAResize::AAWindowParam windowParam;
 
   const TCubeTiling* __restrict matmulTilingW;
   const TCubeTiling* __restrict matmulTilingH;
@@ -158,6 +162,7 @@ class UpsampleBicubic2dAAND {
 
   int64_t singleCoreK = 0;
   int64_t xMin = 0;
+  int64_t sliceIndex = 0;
   bool widthFixed;
   bool heightFixed;
   bool useWidthDirectCopy;
@@ -180,6 +185,7 @@ __aicore__ inline void UpsampleBicubic2dAAND<T>::Init(GM_ADDR x, GM_ADDR y, GM_A
   pipe.InitBuffer(xSizeTensorBuff, cacheBufferSize);
   
   pipe.InitBuffer(weightTensorBuff, CeilA2B(maxInterpSize * sizeof(float), 32));
+  weightTable.Init(&pipe);
 
   intermediateTensorGm.SetGlobalBuffer((__gm__ T*)workspace);
   inTensorsGM.SetGlobalBuffer((__gm__ T*)x);
@@ -280,6 +286,11 @@ __aicore__ inline void UpsampleBicubic2dAAND<T>::CalculateIndexTensor(int32_t in
     support = supportH;
     interpSize = maxInterpSizeH;
   }
+  sliceIndex = index;
+  windowParam.scale = scale;
+  windowParam.support = support;
+  windowParam.inSize = static_cast<float>(inputSize);
+  windowParam.interpSize = static_cast<float>(interpSize);
 
   ArithProgression(centerTensor, static_cast<float>(index), (float)1.0, realDataCount);
 
@@ -310,24 +321,39 @@ __aicore__ inline void UpsampleBicubic2dAAND<T>::CalculateRadioTensor(int32_t in
   xMin = static_cast<int64_t>(xMinTensor.GetValue(index));
   Duplicate(radioTensor, (float)0.0, tensorLength);
   singleCoreK = 0;
-  for (int32_t i = index; i < index+length; i++) {
-    float totalW = 0.0;
-    float distanceOffset = xMinTensor.GetValue(i) - centerTensor.GetValue(i) + (float)0.5;
-    for (int32_t j = 0; j < static_cast<int32_t>(xSizeTensor.GetValue(i)); j++) {
-      float w = WeightCalculate((j + distanceOffset) * invscale);
-      weightTensor.SetValue(j, w);
-      totalW += w;
+  if (weightTable.Fits(windowParam, length)) {
+    // 标量只求K方向长度，系数由向量权重表生成
+    for (int32_t i = index; i < index + length; i++) {
+      int64_t xSize = static_cast<int64_t>(xSizeTensor.GetValue(i));
+      if (xSize > 0) {
+        int64_t xEnd = static_cast<int64_t>(xMinTensor.GetValue(i)) - xMin + xSize;
+        singleCoreK = singleCoreK < xEnd ? xEnd : singleCoreK;
+      }
     }
-
-    if (totalW > (float)0.0) {
-      int32_t yIndexOffset = static_cast<int64_t>(xMinTensor.GetValue(i)) - xMin;
-      int32_t indexOffset = i - index;
+    windowParam.invscale = invscale;
+    AAResize::AAWeightLayout layout{sliceIndex + index, length, xMin, static_cast<int32_t>(singleCoreK), sliceSize,
+                                    false};
+    weightTable.Build(radioTensor, windowParam, layout);
+  } else {
+    for (int32_t i = index; i < index+length; i++) {
+      float totalW = 0.0;
+      float distanceOffset = xMinTensor.GetValue(i) - centerTensor.GetValue(i) + (float)0.5;
       for (int32_t j = 0; j < static_cast<int32_t>(xSizeTensor.GetValue(i)); j++) {
-        float weight = weightTensor.GetValue(j) / totalW;
-        int32_t yIndexValue = j + yIndexOffset;
-        singleCoreK = singleCoreK < yIndexValue + 1 ? yIndexValue + 1 : singleCoreK;
-        int64_t index = yIndexValue * sliceSize + indexOffset;
-        radioTensor.SetValue(index, weight);
+        float w = WeightCalculate((j + distanceOffset) * invscale);
+        weightTensor.SetValue(j, w);
+        totalW += w;
+      }
+
+      if (totalW > (float)0.0) {
+        int32_t yIndexOffset = static_cast<int64_t>(xMinTensor.GetValue(i)) - xMin;
+        int32_t indexOffset = i - index;
+        for (int32_t j = 0; j < static_cast<int32_t>(xSizeTensor.GetValue(i)); j++) {
+          float weight = weightTensor.GetValue(j) / totalW;
+          int32_t yIndexValue = j + yIndexOffset;
+          singleCoreK = singleCoreK < yIndexValue + 1 ? yIndexValue + 1 : singleCoreK;
+          int64_t index = yIndexValue * sliceSize + indexOffset;
+          radioTensor.SetValue(index, weight);
+        }
       }
     }
   }
@@ -19,6 +19,7 @@
 #include <type_traits>
 #include "kernel_operator.h"
 #include "lib/matmul_intf.h"
+#include "aa_weight_table.h"
 
 namespace UpSampleBicubic2dAAGrad {
 using namespace AscendC;
@@ -129,6 +130,10 @@ private:
     TQue<QuePosition::VECOUT, NO_BUFFER_NUM> radioQueue;
     TQue<QuePosition::VECOUT, NO_BUFFER_NUM> radioCastQueue;
 
+    // 系数矩阵向量化生成
+    AAResize::AAWeightTable<AAResize::BicubicFilter> weightTable;
+    AAResize::AAWindowParam windowParam;
+
     const TCubeTiling *__restrict matmulTiling_w;
     const TCubeTiling *__restrict matmulTiling_h;
 
@@ -346,6 +351,7 @@ __aicore__ inline void UpSampleBicubic2dAAGradND<T>::Init(
     pipe.InitBuffer(radioQueue, NO_BUFFER_NUM, (radioSize * sizeof(float) + 31) / 32 * 32);
     pipe.InitBuffer(weightQueue, (interpsize * sizeof(float) + 31) / 32 * 32);
     pipe.InitBuffer(radioCastQueue, NO_BUFFER_NUM, (radioSize * sizeof(T) + 31) / 32 * 32);
+    weightTable.Init(&pipe);
 
     intermediateTensorGm.SetGlobalBuffer((__gm__ T *)workspace);
     inTensorsGM.SetGlobalBuffer((__gm__ T *)inTensorsPtr);
@@ -386,6 +392,11 @@ __aicore__ inline void UpSampleBicubic2dAAGradND<T>::calculateIntermediateTensor
     }
 
     int64_t length = static_cast<int64_t>(centerTensor.GetSize());
+    windowParam.scale = scaleW;
+    windowParam.invscale = invscaleW;
+    windowParam.support = supportW;
+    windowParam.inSize = static_cast<float>(output_shapes[3]);
+    windowParam.interpSize = static_cast<float>(max_interp_size_w);
     // 先计算影响范围和中心点对应的位置，对象为输入矩阵中所有的列
     ArithProgression(centerTensor, static_cast<float>(instart_w), static_cast<float>(1), length);
     PipeBarrier<PIPE_V>();
@@ -426,6 +437,11 @@ __aicore__ inline void UpSampleBicubic2dAAGradND<T>::calculateIntermediateTensor
     if (instart_h < 0) {
         instart_h = 0;
     }
+    windowParam.scale = scaleH;
+    windowParam.invscale = invscaleH;
+    windowParam.support = supportH;
+    windowParam.inSize = static_cast<float>(output_shapes[2]);
+    windowParam.interpSize = static_cast<float>(max_interp_size_h);
     // 先计算影响范围和中心点对应的位置，对象为输入矩阵中所有的列
     ArithProgression(centerTensor_h, static_cast<float>(instart_h), static_cast<float>(1), length);
     PipeBarrier<PIPE_V>();
@@ -497,29 +513,36 @@ __aicore__ inline void UpSampleBicubic2dAAGradND<T>::calculateRadioTensorH(Local
 
     computeIndexValueH(xMinTensor_h, xSizeTensor_h, index, length);
     singleCoreK_h = inendIndex - instartIndex;
-    for (int64_t i = instartIndex; i < inendIndex; i++) {
-        float total_w = 0.0;
-        int64_t xmin = xMinTensor_h.GetValue(i);
-        int64_t xmax = xmin + xSizeTensor_h.GetValue(i);
-        for (int64_t j = 0; j < static_cast<int64_t>(xSizeTensor_h.GetValue(i)); j++) {
-            float w = getWeight((j + xMinTensor_h.GetValue(i) - centerTensor_h.GetValue(i) + (float)0.5) * invscaleH);
-            weightTensor_h.SetValue(j, w);
-            total_w += w;
-        }
-        int64_t insertx = i - instartIndex;
-        singleCoreK_h = singleCoreK_h < insertx + 1 ? insertx + 1 : singleCoreK_h;
-        int64_t xstart = getMax(index, xmin) - index;
-        int64_t xend = getMin(index + slidelen_h, xmax) - index;
-        if (!FloatEqual(total_w, 0.0)) {
+    if (weightTable.Fits(windowParam, singleCoreK_h)) {
+        AAResize::AAWeightLayout layout{instart_h + instartIndex, singleCoreK_h, index,
+            static_cast<int32_t>(slidelen_h), static_cast<int32_t>(matmulTiling_h->singleCoreK), false};
+        weightTable.Build(radioTensor_h, windowParam, layout);
+    } else {
+        for (int64_t i = instartIndex; i < inendIndex; i++) {
+            float total_w = 0.0;
+            int64_t xmin = xMinTensor_h.GetValue(i);
+            int64_t xmax = xmin + xSizeTensor_h.GetValue(i);
             for (int64_t j = 0; j < static_cast<int64_t>(xSizeTensor_h.GetValue(i)); j++) {
-                float weight = weightTensor_h.GetValue(j) / total_w;
-                // 求更新系数矩阵中行的位置
+                float w =
+                    getWeight((j + xMinTensor_h.GetValue(i) - centerTensor_h.GetValue(i) + (float)0.5) * invscaleH);
+                weightTensor_h.SetValue(j, w);
+                total_w += w;
+            }
+            int64_t insertx = i - instartIndex;
+            singleCoreK_h = singleCoreK_h < insertx + 1 ? insertx + 1 : singleCoreK_h;
+            int64_t xstart = getMax(index, xmin) - index;
+            int64_t xend = getMin(index + slidelen_h, xmax) - index;
+            if (!FloatEqual(total_w, 0.0)) {
+                for (int64_t j = 0; j < static_cast<int64_t>(xSizeTensor_h.GetValue(i)); j++) {
+                    float weight = weightTensor_h.GetValue(j) / total_w;
+                    // 求更新系数矩阵中行的位置
 
-                int64_t yIndexValue = xmin + j - index;
+                    int64_t yIndexValue = xmin + j - index;
 
-                if (yIndexValue < xend && yIndexValue >= 0) {
-                    int64_t index = yIndexValue * matmulTiling_h->singleCoreK + insertx;
-                    radioTensor_h.SetValue(index, weight);
+                    if (yIndexValue < xend && yIndexValue >= 0) {
+                        int64_t index = yIndexValue * matmulTiling_h->singleCoreK + insertx;
+                        radioTensor_h.SetValue(index, weight);
+                    }
                 }
             }
         }
@@ -572,39 +595,57 @@ __aicore__ inline void UpSampleBicubic2dAAGradND<T>::calculateRadioTensor(LocalT
 
     computeIndexValueW(xMinTensor, xSizeTensor, index, length);
 
-    for (int64_t i = instartIndex; i < inendIndex; i++) {
-        float total_w = 0.0;
-        int64_t xmin = xMinTensor.GetValue(i);
-        int64_t xmax = xmin + xSizeTensor.GetValue(i);
+    int64_t rowNum = inendIndex - instartIndex;
+    if (weightTable.Fits(windowParam, rowNum)) {
+        // 标量只求K方向长度，系数由向量权重表生成
+        for (int64_t i = instartIndex; i < inendIndex; i++) {
+            int64_t xmin = xMinTensor.GetValue(i);
+            int64_t xmax = xmin + xSizeTensor.GetValue(i);
+            if (getMax(index, xmin) < getMin(index + length, xmax)) {
+                singleCoreK = singleCoreK < i - instartIndex + 1 ? i - instartIndex + 1 : singleCoreK;
+                if (instartIndex + singleCoreK > input_shapes[3]) {
+                    singleCoreK = input_shapes[3] - instartIndex;
+                }
+            }
+        }
+        AAResize::AAWeightLayout layout{instart_w + instartIndex, static_cast<int32_t>(rowNum), index,
+            static_cast<int32_t>(length), static_cast<int32_t>(length), true};
+        weightTable.Build(radioTensor, windowParam, layout);
+    } else {
+        for (int64_t i = instartIndex; i < inendIndex; i++) {
+            float total_w = 0.0;
+            int64_t xmin = xMinTensor.GetValue(i);
+            int64_t xmax = xmin + xSizeTensor.GetValue(i);
 
-        for (int64_t j = 0; j < static_cast<int64_t>(xSizeTensor.GetValue(i)); j++) {
+            for (int64_t j = 0; j < static_cast<int64_t>(xSizeTensor.GetValue(i)); j++) {
 
-            float w = getWeight((j + xMinTensor.GetValue(i) - centerTensor.GetValue(i) + (float)0.5) * invscaleW);
+                float w = getWeight((j + xMinTensor.GetValue(i) - centerTensor.GetValue(i) + (float)0.5) * invscaleW);
 
-            weightTensor.SetValue(j, w);
-            total_w += w;
-        }
+                weightTensor.SetValue(j, w);
+                total_w += w;
+            }
 
-        if (!FloatEqual(total_w, 0.0)) {
-            int64_t xstart = getMax(index, xmin) - index;
-            int64_t xend = getMin(index + length, xmax) - index;
-            for (int64_t j = 0; j < static_cast<int64_t>(xSizeTensor.GetValue(i)); j++) {
-                float weight = weightTensor.GetValue(j) / total_w;
-                // 求更新系数矩阵中行的位置
-                int64_t insertx = xmin + j - index;
+            if (!FloatEqual(total_w, 0.0)) {
+                int64_t xstart = getMax(index, xmin) - index;
+                int64_t xend = getMin(index + length, xmax) - index;
+                for (int64_t j = 0; j < static_cast<int64_t>(xSizeTensor.GetValue(i)); j++) {
+                    float weight = weightTensor.GetValue(j) / total_w;
+                    // 求更新系数矩阵中行的位置
+                    int64_t insertx = xmin + j - index;
 
-                if (insertx < xend && insertx >= 0) {
-                    int64_t yIndexValue = 0;
+                    if (insertx < xend && insertx >= 0) {
+                        int64_t yIndexValue = 0;
 
-                    yIndexValue = i - instartIndex;
+                        yIndexValue = i - instartIndex;
 
-                    singleCoreK = singleCoreK < yIndexValue + 1 ? yIndexValue + 1 : singleCoreK;
-                    if (instartIndex + singleCoreK > input_shapes[3]) {
-                        singleCoreK = input_shapes[3] - instartIndex;
-                    }
-                    int64_t index = yIndexValue * length + insertx;
+                        singleCoreK = singleCoreK < yIndexValue + 1 ? yIndexValue + 1 : singleCoreK;
+                        if (instartIndex + singleCoreK > input_shapes[3]) {
+                            singleCoreK = input_shapes[3] - instartIndex;
+                        }
+                        int64_t index = yIndexValue * length + insertx;
 
-                    radioTensor.SetValue(index, weight);
+                        radioTensor.SetValue(index, weight);
+                    }
                 }
             }
         }
@@ -17,6 +17,7 @@
 
 #include <type_traits>
 #include "lib/matmul_intf.h"
+#include "aa_weight_table.h"
 
 namespace UpsampleBilinear2dAA {
 using namespace AscendC;
@@ -122,6 +123,10 @@ private:
     TBuf<QuePosition::VECCALC> weightQueue_h;
     TQue<QuePosition::VECOUT, BUFFER_NUM> radioQueue_h;
 
+    // 系数矩阵向量化生成
+    AAResize::AAWeightTable<AAResize::BilinearFilter> weightTable;
+    AAResize::AAWindowParam windowParam;
+
     const TCubeTiling *__restrict matmulTiling_w;
     const TCubeTiling *__restrict matmulTiling_h;
 
@@ -195,6 +200,7 @@ private:
     int64_t workSpaceRadioOffset = 0;
     int64_t singleCoreK = 0;
     int64_t xMin = 0;
+    int64_t sliceIndex = 0;
 };
 
 template <typename T>
@@ -224,6 +230,7 @@ __aicore__ inline void UpsampleBilinearAAND<T>::Init(
         pipe.InitBuffer(weightQueue_h, (max_interp_size_h * sizeof(float) + 31) / 32 * 32);
         pipe.InitBuffer(radioQueue_h, BUFFER_NUM, radio_matrix_size_h * sizeof(float));
     }
+    weightTable.Init(&pipe);
 
     intermediateTensorGm.SetGlobalBuffer((__gm__ T *)workspace);
     inTensorsGM.SetGlobalBuffer((__gm__ T *)inTensorsPtr);
@@ -352,6 +359,11 @@ __aicore__ inline void UpsampleBilinearAAND<T>::calculateIntermediateTensor(
         max_interp_size = max_interp_size_h;
         maxSize = input_shapes[2];
     }
+    sliceIndex = index;
+    windowParam.scale = scale;
+    windowParam.support = support;
+    windowParam.inSize = static_cast<float>(maxSize);
+    windowParam.interpSize = static_cast<float>(max_interp_size);
     ArithProgression(centerTensor, static_cast<float>(index), static_cast<float>(1), length);
     PipeBarrier<PIPE_V>();
 
@@ -399,24 +411,39 @@ __aicore__ inline void UpsampleBilinearAAND<T>::calculateRadioTensorW(int64_t xI
     WaitFlag<HardEvent::V_S>(eventIDVToS);
 
     xMin = static_cast<int64_t>(xMinTensor.GetValue(xIndex));
-    for (int64_t i = xIndex; i < xIndex + length; i++) {
-        float total_w = 0.0;
-        float tmpValue = xMinTensor.GetValue(i) - centerTensor.GetValue(i) + (float)0.5;
-        for (int64_t j = 0; j < static_cast<int64_t>(xSizeTensor.GetValue(i)); j++) {
-            float singleW = weightCalculate((j + tmpValue) * invscale);
-            weightTensor.SetValue(j, singleW);
-            total_w += singleW;
+    if (weightTable.Fits(windowParam, length)) {
+        // 标量只求K方向长度，系数由向量权重表生成
+        for (int64_t i = xIndex; i < xIndex + length; i++) {
+            int64_t xSize = static_cast<int64_t>(xSizeTensor.GetValue(i));
+            if (xSize > 0) {
+                int64_t xEnd = static_cast<int64_t>(xMinTensor.GetValue(i)) - xMin + xSize;
+                singleCoreK = singleCoreK < xEnd ? xEnd : singleCoreK;
+            }
         }
-        int64_t offset = i - xIndex;
-
-        if (!FloatEqual(total_w, (float)0.0)) {
-            int64_t yIndexOffset = static_cast<int64_t>(xMinTensor.GetValue(i)) - xMin;
+        windowParam.invscale = invscale;
+        AAResize::AAWeightLayout layout{sliceIndex + xIndex, static_cast<int32_t>(length), xMin,
+            static_cast<int32_t>(singleCoreK), static_cast<int32_t>(slide_size), false};
+        weightTable.Build(radioTensor, windowParam, layout);
+    } else {
+        for (int64_t i = xIndex; i < xIndex + length; i++) {
+            float total_w = 0.0;
+            float tmpValue = xMinTensor.GetValue(i) - centerTensor.GetValue(i) + (float)0.5;
             for (int64_t j = 0; j < static_cast<int64_t>(xSizeTensor.GetValue(i)); j++) {
-                float weight = weightTensor.GetValue(j) / total_w;
-                int64_t yIndexValue = j + yIndexOffset;
-                singleCoreK = singleCoreK < yIndexValue + 1 ? yIndexValue + 1 : singleCoreK;
-                int64_t index = yIndexValue * slide_size + offset;
-                radioTensor.SetValue(index, weight);
+                float singleW = weightCalculate((j + tmpValue) * invscale);
+                weightTensor.SetValue(j, singleW);
+                total_w += singleW;
+            }
+            int64_t offset = i - xIndex;
+
+            if (!FloatEqual(total_w, (float)0.0)) {
+                int64_t yIndexOffset = static_cast<int64_t>(xMinTensor.GetValue(i)) - xMin;
+                for (int64_t j = 0; j < static_cast<int64_t>(xSizeTensor.GetValue(i)); j++) {
+                    float weight = weightTensor.GetValue(j) / total_w;
+                    int64_t yIndexValue = j + yIndexOffset;
+                    singleCoreK = singleCoreK < yIndexValue + 1 ? yIndexValue + 1 : singleCoreK;
+                    int64_t index = yIndexValue * slide_size + offset;
+                    radioTensor.SetValue(index, weight);
+                }
             }
         }
     }
@@ -441,23 +468,31 @@ __aicore__ inline void UpsampleBilinearAAND<T>::calculateRadioTensorH(int64_t xI
     singleCoreK = xMinTensor.GetValue(xIndex + length - 1) - xMinTensor.GetValue(xIndex) +
                   xSizeTensor.GetValue(xIndex + length - 1);
 
-    for (int64_t i = xIndex; i < xIndex + length; i++) {
-        float total_w = 0.0;
-        float tmpValue = xMinTensor.GetValue(i) - centerTensor.GetValue(i) + (float)0.5;
-        for (int64_t j = 0; j < static_cast<int64_t>(xSizeTensor.GetValue(i)); j++) {
-            float w = weightCalculate((j + tmpValue) * invscale);
-            weightTensor.SetValue(j, w);
-            total_w += w;
-        }
-
-        int64_t offset = (i - xIndex) * matmulTiling_h->singleCoreK;
-        if (!FloatEqual(total_w, (float)0.0)) {
-            int64_t yIndexOffset = static_cast<int64_t>(xMinTensor.GetValue(i)) - xMin;
+    if (weightTable.Fits(windowParam, length)) {
+        int64_t kStride = matmulTiling_h->singleCoreK;
+        windowParam.invscale = invscale;
+        AAResize::AAWeightLayout layout{sliceIndex + xIndex, static_cast<int32_t>(length), xMin,
+            static_cast<int32_t>(singleCoreK < kStride ? singleCoreK : kStride), static_cast<int32_t>(kStride), true};
+        weightTable.Build(radioTensor, windowParam, layout);
+    } else {
+        for (int64_t i = xIndex; i < xIndex + length; i++) {
+            float total_w = 0.0;
+            float tmpValue = xMinTensor.GetValue(i) - centerTensor.GetValue(i) + (float)0.5;
             for (int64_t j = 0; j < static_cast<int64_t>(xSizeTensor.GetValue(i)); j++) {
-                float weight = weightTensor.GetValue(j) / total_w;
-                int64_t yIndexValue = j + yIndexOffset;
-                int64_t index = yIndexValue + offset;
-                radioTensor.SetValue(index, weight);
+                float w = weightCalculate((j + tmpValue) * invscale);
+                weightTensor.SetValue(j, w);
+                total_w += w;
+            }
+
+            int64_t offset = (i - xIndex) * matmulTiling_h->singleCoreK;
+            if (!FloatEqual(total_w, (float)0.0)) {
+                int64_t yIndexOffset = static_cast<int64_t>(xMinTensor.GetValue(i)) - xMin;
+                for (int64_t j = 0; j < static_cast<int64_t>(xSizeTensor.GetValue(i)); j++) {
+                    float weight = weightTensor.GetValue(j) / total_w;
+                    int64_t yIndexValue = j + yIndexOffset;
+                    int64_t index = yIndexValue + offset;
+                    radioTensor.SetValue(index, weight);
+                }
             }
         }
     }
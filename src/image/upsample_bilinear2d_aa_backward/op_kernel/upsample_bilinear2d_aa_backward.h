@@ -18,6 +18,7 @@
 #include <type_traits>
 #include "kernel_operator.h"
 #include "lib/matmul_intf.h"
+#include "aa_weight_table.h"
 
 namespace UpsampleBilinear2dAABackward {
 using namespace AscendC;
@@ -101,6 +102,10 @@ private:
     TBuf<QuePosition::VECCALC> weightQueueH;
     TQue<QuePosition::VECOUT, BUFFER_NUM> radioQueueH;
 
+    // 系数矩阵向量化生成
+    AAResize::AAWeightTable<AAResize::BilinearFilter> weightTable;
+    AAResize::AAWindowParam windowParam;
+
     const TCubeTiling *__restrict matmulTilingW;
     const TCubeTiling *__restrict matmulTilingH;
 
@@ -184,6 +189,7 @@ __aicore__ inline void UpsampleBilinear2dAABackwardND<T>::Init(
         pipe.InitBuffer(weightQueueH, (maxInterpSizeH * sizeof(float) + 31) / 32 * 32);
         pipe.InitBuffer(radioQueueH, BUFFER_NUM, (radioMatrixSizeH * sizeof(float) + 31) / 32 * 32);
     }
+    weightTable.Init(&pipe);
 
     intermediateTensorGm.SetGlobalBuffer((__gm__ T *)workspace);
     inTensorsGM.SetGlobalBuffer((__gm__ T *)inTensorPtr);
@@ -308,6 +314,11 @@ __aicore__ inline void UpsampleBilinear2dAABackwardND<T>::calculateIntermediateT
         length = inputShapes[3] - index;
     }
     xMin = index;
+    windowParam.scale = scaleW;
+    windowParam.invscale = invscaleW;
+    windowParam.support = supportW;
+    windowParam.inSize = static_cast<float>(outputShapes[3]);
+    windowParam.interpSize = static_cast<float>(maxInterpSizeW);
     ArithProgression(centerTensor, static_cast<float>(index), static_cast<float>(1), length);
     PipeBarrier<PIPE_V>();
 
@@ -359,6 +370,11 @@ __aicore__ inline void UpsampleBilinear2dAABackwardND<T>::calculateIntermediateT
         length = inputShapes[2] - index;
     }
     xMin = index;
+    windowParam.scale = scaleH;
+    windowParam.invscale = invscaleH;
+    windowParam.support = supportH;
+    windowParam.inSize = static_cast<float>(outputShapes[2]);
+    windowParam.interpSize = static_cast<float>(maxInterpSizeH);
     ArithProgression(centerTensor, static_cast<float>(index), static_cast<float>(1), length);
     PipeBarrier<PIPE_V>();
 
@@ -407,22 +423,29 @@ __aicore__ inline void UpsampleBilinear2dAABackwardND<T>::calculateRadioTensorW(
         xlength = inputShapes[3] - xMin;
     }
     singleCoreK = xlength;
-    for (int64_t i = xIndex; i < xIndex + xlength; i++) {
-        float totalW = 0.0;
-        for (int64_t j = 0; j < static_cast<int64_t>(xSizeTensor.GetValue(i)); j++) {
-            float w = weightCalculate((j + xMinTensor.GetValue(i) - centerTensor.GetValue(i) + (float)0.5) * invscaleW);
-            totalW += w;
-            weightTensor.SetValue(j, w);
-        }
-
-        if (totalW > (float)0.0) {
+    if (weightTable.Fits(windowParam, xlength)) {
+        AAResize::AAWeightLayout layout{xMin, static_cast<int32_t>(xlength), minIndex, static_cast<int32_t>(length),
+            static_cast<int32_t>(length), true};
+        weightTable.Build(radioTensor, windowParam, layout);
+    } else {
+        for (int64_t i = xIndex; i < xIndex + xlength; i++) {
+            float totalW = 0.0;
             for (int64_t j = 0; j < static_cast<int64_t>(xSizeTensor.GetValue(i)); j++) {
-                float weight = weightTensor.GetValue(j) / totalW;
-                int64_t yIndexValue = j + xMinTensor.GetValue(i) - minIndex;
-                if (yIndexValue >= 0 && yIndexValue < length) {
-                    int64_t xIndexValue = i - xIndex;
-                    int64_t index = xIndexValue * length + yIndexValue;
-                    radioTensor.SetValue(index, weight);
+                float w =
+                    weightCalculate((j + xMinTensor.GetValue(i) - centerTensor.GetValue(i) + (float)0.5) * invscaleW);
+                totalW += w;
+                weightTensor.SetValue(j, w);
+            }
+
+            if (totalW > (float)0.0) {
+                for (int64_t j = 0; j < static_cast<int64_t>(xSizeTensor.GetValue(i)); j++) {
+                    float weight = weightTensor.GetValue(j) / totalW;
+                    int64_t yIndexValue = j + xMinTensor.GetValue(i) - minIndex;
+                    if (yIndexValue >= 0 && yIndexValue < length) {
+                        int64_t xIndexValue = i - xIndex;
+                        int64_t index = xIndexValue * length + yIndexValue;
+                        radioTensor.SetValue(index, weight);
+                    }
                 }
             }
         }
@@ -449,22 +472,29 @@ __aicore__ inline void UpsampleBilinear2dAABackwardND<T>::calculateRadioTensorH(
         xlength = inputShapes[2] - xMin;
     }
     singleCoreK = xlength;
-    for (int64_t i = xIndex; i < xIndex + xlength; i++) {
-        float totalW = 0.0;
-        for (int64_t j = 0; j < static_cast<int64_t>(xSizeTensor.GetValue(i)); j++) {
-            float w = weightCalculate((j + xMinTensor.GetValue(i) - centerTensor.GetValue(i) + (float)0.5) * invscaleH);
-            totalW += w;
-            weightTensor.SetValue(j, w);
-        }
-
-        if (totalW > (float)0.0) {
+    if (weightTable.Fits(windowParam, xlength)) {
+        AAResize::AAWeightLayout layout{xMin, static_cast<int32_t>(xlength), minIndex, static_cast<int32_t>(length),
+            static_cast<int32_t>(xlength), false};
+        weightTable.Build(radioTensor, windowParam, layout);
+    } else {
+        for (int64_t i = xIndex; i < xIndex + xlength; i++) {
+            float totalW = 0.0;
             for (int64_t j = 0; j < static_cast<int64_t>(xSizeTensor.GetValue(i)); j++) {
-                float weight = weightTensor.GetValue(j) / totalW;
-                int64_t yIndexValue = j + xMinTensor.GetValue(i) - minIndex;
-                if (yIndexValue >= 0 && yIndexValue < length) {
-                    int64_t xIndexValue = i - xIndex;
-                    int64_t index = yIndexValue * singleCoreK + xIndexValue;
-                    radioTensor.SetValue(index, weight);
+                float w =
+                    weightCalculate((j + xMinTensor.GetValue(i) - centerTensor.GetValue(i) + (float)0.5) * invscaleH);
+                totalW += w;
+                weightTensor.SetValue(j, w);
+            }
+
+            if (totalW > (float)0.0) {
+                for (int64_t j = 0; j < static_cast<int64_t>(xSizeTensor.GetValue(i)); j++) {
+                    float weight = weightTensor.GetValue(j) / totalW;
+                    int64_t yIndexValue = j + xMinTensor.GetValue(i) - minIndex;
+                    if (yIndexValue >= 0 && yIndexValue < length) {
+                        int64_t xIndexValue = i - xIndex;
+                        int64_t index = yIndexValue * singleCoreK + xIndexValue;
+                        radioTensor.SetValue(index, weight);
+                    }
                 }
             }
         }
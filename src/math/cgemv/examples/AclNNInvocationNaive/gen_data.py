@@ -0,0 +1,36 @@
+#!/usr/bin/python3
+# -*- coding:utf-8 -*-
+# Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+# This file is a part of the CANN Open Software.
+# Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+# ======================================================================================================================
+
+import os
+import numpy as np
+
+
+def gen_golden_data_simple():
+    # 4个[512, 1024]的复数矩阵，y = alpha * a^H * x + beta * y
+    batch, m, n = 4, 512, 1024
+    alpha = np.complex64(1.5 - 0.5j)
+    beta = np.complex64(0.5 + 0.25j)
+    a = (np.random.uniform(-1, 1, [batch, m, n]) + 1j * np.random.uniform(-1, 1, [batch, m, n])).astype(np.complex64)
+    x = (np.random.uniform(-1, 1, [batch, m]) + 1j * np.random.uniform(-1, 1, [batch, m])).astype(np.complex64)
+    y = (np.random.uniform(-1, 1, [batch, n]) + 1j * np.random.uniform(-1, 1, [batch, n])).astype(np.complex64)
+    golden = alpha * np.einsum("bmn,bm->bn", np.conj(a), x) + beta * y
+    golden = golden.astype(np.complex64)
+
+    os.system("mkdir -p input")
+    os.system("mkdir -p output")
+    a.tofile("./input/input_a.bin")
+    x.tofile("./input/input_x.bin")
+    y.tofile("./input/input_y.bin")
+    golden.tofile("./output/golden.bin")
+
+
+if __name__ == "__main__":
+    gen_golden_data_simple()
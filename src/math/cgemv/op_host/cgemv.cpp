@@ -0,0 +1,89 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file cgemv.cpp
+ */
+#include "cgemv_tiling.h"
+#include "blas/op_tiling/gemv_tiling_func.h"
+#include "register/op_def_registry.h"
+
+namespace optiling {
+constexpr size_t ATTR_TRANS_IDX = 0;
+constexpr size_t ATTR_ALPHA_IDX = 1;
+constexpr size_t ATTR_BETA_IDX = 2;
+
+// 复数alpha/beta以[re, im]给出，缺省时取defRe + 0i
+static void GetComplexAttr(const gert::RuntimeAttrs *attrs, size_t idx, float defRe, float &re, float &im)
+{
+    re = defRe;
+    im = 0.0f;
+    auto *value = attrs->GetAttrPointer<gert::ContinuousVector>(idx);
+    if (value != nullptr && value->GetSize() >= 2) {
+        const float *data = reinterpret_cast<const float *>(value->GetData());
+        re = data[0];
+        im = data[1];
+    }
+}
+
+static ge::graphStatus TilingFunc(gert::TilingContext *context)
+{
+    auto *attrs = context->GetAttrs();
+    float alphaRe = 1.0f;
+    float alphaIm = 0.0f;
+    float betaRe = 0.0f;
+    float betaIm = 0.0f;
+    GetComplexAttr(attrs, ATTR_ALPHA_IDX, 1.0f, alphaRe, alphaIm);
+    GetComplexAttr(attrs, ATTR_BETA_IDX, 0.0f, betaRe, betaIm);
+    return GemvTiling(context, attrs->GetStr(ATTR_TRANS_IDX), alphaRe, alphaIm, betaRe, betaIm);
+}
+} // namespace optiling
+
+namespace ge {
+static graphStatus InferShape(gert::InferShapeContext *context)
+{
+    return GRAPH_SUCCESS;
+}
+
+static graphStatus InferDataType(gert::InferDataTypeContext *context)
+{
+    return ge::GRAPH_SUCCESS;
+}
+} // namespace ge
+
+namespace ops {
+class Cgemv : public OpDef {
+public:
+    explicit Cgemv(const char *name) : OpDef(name)
+    {
+        this->Input("a")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_COMPLEX64})
+            .Format({ge::FORMAT_ND});
+        this->Input("x")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_COMPLEX64})
+            .Format({ge::FORMAT_ND});
+        this->Input("y")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_COMPLEX64})
+            .Format({ge::FORMAT_ND});
+        this->Attr("trans").AttrType(OPTIONAL).String("N");
+        this->Attr("alpha").AttrType(OPTIONAL).ListFloat({1.0f, 0.0f});
+        this->Attr("beta").AttrType(OPTIONAL).ListFloat({0.0f, 0.0f});
+
+        this->SetInferShape(ge::InferShape).SetInferDataType(ge::InferDataType);
+        this->AICore()
+            .SetTiling(optiling::TilingFunc)
+            .AddConfig("ascend910b");
+    }
+};
+OP_ADD(Cgemv);
+} // namespace ops
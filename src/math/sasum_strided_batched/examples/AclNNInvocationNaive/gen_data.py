@@ -0,0 +1,31 @@
+#!/usr/bin/python3
+# -*- coding:utf-8 -*-
+# Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+# This file is a part of the CANN Open Software.
+# Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+# ======================================================================================================================
+
+import os
+import numpy as np
+
+
+def gen_golden_data_simple():
+    # 4096个长度为100的向量，每个只取前96个元素
+    batch, stride, n = 4096, 100, 96
+    x = np.random.uniform(-1, 1, [batch, stride]).astype(np.float32)
+    n_tensor = np.array([n], dtype=np.int32)
+    golden = np.sum(np.abs(x[:, :n]), axis=1).astype(np.float32)
+
+    os.system("mkdir -p input")
+    os.system("mkdir -p output")
+    x.tofile("./input/input_x.bin")
+    n_tensor.tofile("./input/input_n.bin")
+    golden.tofile("./output/golden.bin")
+
+
+if __name__ == "__main__":
+    gen_golden_data_simple()
@@ -12,13 +12,13 @@
  * @file scnrm2.cpp
  */
 
-#include "scnrm2_aiv.h"
+#include "nrm2_scaled.h"
 
 extern "C" __global__ __aicore__ void scnrm2(GM_ADDR x, GM_ADDR result,
                                         GM_ADDR workSpace, GM_ADDR tilingGm)
 {
     if (TILING_KEY_IS(0)) {
-        Scnrm2::Scnrm2AIV<float> op;
+        Nrm2Scaled::Nrm2ScaledAIV op;
         op.Init(x, result, workSpace, tilingGm);
         op.Process();
     }
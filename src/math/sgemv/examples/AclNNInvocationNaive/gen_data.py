@@ -0,0 +1,34 @@
+#!/usr/bin/python3
+# -*- coding:utf-8 -*-
+# Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+# This file is a part of the CANN Open Software.
+# Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+# ======================================================================================================================
+
+import os
+import numpy as np
+
+
+def gen_golden_data_simple():
+    # 4个[1024, 2048]的实数矩阵，y = alpha * a * x + beta * y
+    batch, m, n = 4, 1024, 2048
+    alpha, beta = 1.5, 0.5
+    a = np.random.uniform(-1, 1, [batch, m, n]).astype(np.float32)
+    x = np.random.uniform(-1, 1, [batch, n]).astype(np.float32)
+    y = np.random.uniform(-1, 1, [batch, m]).astype(np.float32)
+    golden = (alpha * np.einsum("bmn,bn->bm", a, x) + beta * y).astype(np.float32)
+
+    os.system("mkdir -p input")
+    os.system("mkdir -p output")
+    a.tofile("./input/input_a.bin")
+    x.tofile("./input/input_x.bin")
+    y.tofile("./input/input_y.bin")
+    golden.tofile("./output/golden.bin")
+
+
+if __name__ == "__main__":
+    gen_golden_data_simple()
@@ -0,0 +1,74 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file sgemv.cpp
+ */
+#include "sgemv_tiling.h"
+#include "blas/op_tiling/gemv_tiling_func.h"
+#include "register/op_def_registry.h"
+
+namespace optiling {
+constexpr size_t ATTR_TRANS_IDX = 0;
+constexpr size_t ATTR_ALPHA_IDX = 1;
+constexpr size_t ATTR_BETA_IDX = 2;
+
+static ge::graphStatus TilingFunc(gert::TilingContext *context)
+{
+    auto *attrs = context->GetAttrs();
+    auto *alphaPtr = attrs->GetAttrPointer<float>(ATTR_ALPHA_IDX);
+    auto *betaPtr = attrs->GetAttrPointer<float>(ATTR_BETA_IDX);
+    float alpha = alphaPtr == nullptr ? 1.0f : *alphaPtr;
+    float beta = betaPtr == nullptr ? 0.0f : *betaPtr;
+    return GemvTiling(context, attrs->GetStr(ATTR_TRANS_IDX), alpha, 0.0f, beta, 0.0f);
+}
+} // namespace optiling
+
+namespace ge {
+static graphStatus InferShape(gert::InferShapeContext *context)
+{
+    return GRAPH_SUCCESS;
+}
+
+static graphStatus InferDataType(gert::InferDataTypeContext *context)
+{
+    return ge::GRAPH_SUCCESS;
+}
+} // namespace ge
+
+namespace ops {
+class Sgemv : public OpDef {
+public:
+    explicit Sgemv(const char *name) : OpDef(name)
+    {
+        this->Input("a")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_FLOAT})
+            .Format({ge::FORMAT_ND});
+        this->Input("x")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_FLOAT})
+            .Format({ge::FORMAT_ND});
+        this->Input("y")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_FLOAT})
+            .Format({ge::FORMAT_ND});
+        this->Attr("trans").AttrType(OPTIONAL).String("N");
+        this->Attr("alpha").AttrType(OPTIONAL).Float(1.0f);
+        this->Attr("beta").AttrType(OPTIONAL).Float(0.0f);
+
+        this->SetInferShape(ge::InferShape).SetInferDataType(ge::InferDataType);
+        this->AICore()
+            .SetTiling(optiling::TilingFunc)
+            .AddConfig("ascend910b");
+    }
+};
+OP_ADD(Sgemv);
+} // namespace ops
@@ -22,6 +22,8 @@ namespace optiling {
 // static variable
 constexpr static uint64_t ELEMENTS_PER_BLOCK = 8;
 constexpr static int32_t SYS_WORK_SPACE = 16 * 1024 * 1024;
+// 每核一个32字节槽位，存放small/medium/big三桶部分和
+constexpr static uint32_t NRM2_SLOT_FLOATS = 8;
 
 // Calculate tiling data value
 static void CalTilingData(uint32_t elementNum, uint32_t* calNum, uint32_t* startOffset, uint32_t maxCoreNum)
@@ -93,7 +95,7 @@ static ge::graphStatus TilingFunc(gert::TilingContext *context)
     tiling.SaveToBuffer(context->GetRawTilingData()->GetData(), context->GetRawTilingData()->GetCapacity());
     context->GetRawTilingData()->SetDataSize(tiling.GetDataSize());
     size_t *currentWorkspace = context->GetWorkspaceSizes(1);
-    currentWorkspace[0] = SYS_WORK_SPACE + vecCoreNum * sizeof(float);
+    currentWorkspace[0] = SYS_WORK_SPACE + vecCoreNum * NRM2_SLOT_FLOATS * sizeof(float);
     return ge::GRAPH_SUCCESS;
 }
 } // namespace optiling
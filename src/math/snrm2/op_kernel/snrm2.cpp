@@ -12,13 +12,13 @@
  * @file snrm2.cpp
  */
 
-#include "snrm2_aiv.h"
+#include "nrm2_scaled.h"
 
 extern "C" __global__ __aicore__ void snrm2(GM_ADDR x, GM_ADDR result,
                                         GM_ADDR workSpace, GM_ADDR tilingGm)
 {
     if (TILING_KEY_IS(0)) {
-        Snrm2::Snrm2AIV<float> op;
+        Nrm2Scaled::Nrm2ScaledAIV op;
         op.Init(x, result, workSpace, tilingGm);
         op.Process();
     }
@@ -0,0 +1,23 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file snrm2_strided_batched.cpp
+ */
+#include "blas1_batched.h"
+
+extern "C" __global__ __aicore__ void snrm2_strided_batched(GM_ADDR x, GM_ADDR n,
+                                                            GM_ADDR result, GM_ADDR workspace, GM_ADDR tiling)
+{
+    GET_TILING_DATA(tilingData, tiling);
+    Blas1Batched::Blas1BatchedKernel<Blas1Batched::Routine::NRM2> op;
+    op.Init(x, n, result, &tilingData);
+    op.Process();
+}
@@ -0,0 +1,21 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file sscal_strided_batched_tiling.h
+ */
+#ifndef SSCAL_STRIDED_BATCHED_TILING_H
+#define SSCAL_STRIDED_BATCHED_TILING_H
+#include "blas/op_tiling/blas1_batched_tiling_def.h"
+
+namespace optiling {
+REGISTER_TILING_DATA_CLASS(SscalStridedBatched, Blas1BatchedTilingData)
+} // namespace optiling
+#endif // SSCAL_STRIDED_BATCHED_TILING_H
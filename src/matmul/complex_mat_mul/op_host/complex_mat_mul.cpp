@@ -18,18 +18,41 @@
 
 using namespace matmul_tiling;
 
-inline int AlignUP(int x, int p)
+namespace optiling
+{
+// x/y的batch维要么一致，要么一方为二维矩阵（batch步长为0，在各batch间广播）
+static bool GetBatchNum(const gert::Shape &shape_a, const gert::Shape &shape_b, int32_t &BatchSize,
+                        int32_t &aBatchNum, int32_t &bBatchNum)
 {
-    return (x + (p - 1)) & ~(p - 1);
+    int dim_a = shape_a.GetDimNum();
+    int dim_b = shape_b.GetDimNum();
+    if (dim_a > 2 && dim_b > 2 && dim_a != dim_b)
+    {
+        return false;
+    }
+    aBatchNum = 1;
+    bBatchNum = 1;
+    for (int i = 0; i < dim_a - 2; i++)
+    {
+        aBatchNum *= shape_a.GetDim(i);
+    }
+    for (int i = 0; i < dim_b - 2; i++)
+    {
+        if (dim_a > 2 && shape_a.GetDim(i) != shape_b.GetDim(i))
+        {
+            return false;
+        }
+        bBatchNum *= shape_b.GetDim(i);
+    }
+    BatchSize = aBatchNum > bBatchNum ? aBatchNum : bBatchNum;
+    return true;
 }
 
-namespace optiling
-{
 static ge::graphStatus TilingFunc(gert::TilingContext *context)
 {
     auto shape_a = context->GetInputTensor(0)->GetOriginShape();
     auto shape_b = context->GetInputTensor(1)->GetOriginShape();
-    if (shape_a.GetDimNum() < 2 || shape_a.GetDimNum() != shape_b.GetDimNum())
+    if (shape_a.GetDimNum() < 2 || shape_b.GetDimNum() < 2)
     {
         return ge::GRAPH_FAILED;
     }
@@ -39,47 +62,50 @@ static ge::graphStatus TilingFunc(gert::TilingContext *context)
     if (socVersion != platform_ascendc::SocVersion::ASCEND910B) {
         return ge::GRAPH_FAILED;
     }
-    int dim = shape_a.GetDimNum();
     int32_t BatchSize = 1;
-    for (int i = 0; i < dim - 2; i++)
+    int32_t aBatchNum = 1;
+    int32_t bBatchNum = 1;
+    if (!GetBatchNum(shape_a, shape_b, BatchSize, aBatchNum, bBatchNum))
     {
-        if (shape_a.GetDim(i) != shape_b.GetDim(i))
-        {
-            return ge::GRAPH_FAILED;
-        }
+        return ge::GRAPH_FAILED;
+    }
 
-        BatchSize *= shape_a.GetDim(i);
+    int32_t M = shape_a.GetDim(shape_a.GetDimNum() - 2);
+    int32_t K = shape_a.GetDim(shape_a.GetDimNum() - 1);
+    int32_t N = shape_b.GetDim(shape_b.GetDimNum() - 1);
+    if (shape_b.GetDim(shape_b.GetDimNum() - 2) != K)
+    {
+        return ge::GRAPH_FAILED;
+    }
+    auto bias = context->GetOptionalInputTensor(2);
+    if (bias != nullptr && bias->GetOriginShape().GetShapeSize() != static_cast<int64_t>(BatchSize) * M * N)
+    {
+        return ge::GRAPH_FAILED;
     }
 
-    int32_t M = shape_a.GetDim(dim - 2);
-    int32_t K = shape_a.GetDim(dim - 1);
-    int32_t N = shape_b.GetDim(dim - 1);
+    // complex32为两个fp16，complex64为两个fp32
+    auto dataType = context->GetInputDesc(0)->GetDataType();
+    bool isHalf = dataType == ge::DT_COMPLEX32;
+    auto cubeType = isHalf ? matmul_tiling::DataType::DT_FLOAT16 : matmul_tiling::DataType::DT_FLOAT;
+    size_t typeSize = isHalf ? sizeof(uint16_t) : sizeof(float);
 
     MultiCoreMatmulTiling tiling(ascendcPlatform);
     MatMulTilingData tiling1;
 
-    tiling.SetAType(TPosition::GM, CubeFormat::ND,
-                    matmul_tiling::DataType::DT_FLOAT);
-    tiling.SetBType(TPosition::GM, CubeFormat::ND,
-                    matmul_tiling::DataType::DT_FLOAT);
-    tiling.SetCType(TPosition::GM, CubeFormat::ND,
-                    matmul_tiling::DataType::DT_FLOAT);
-
-    constexpr int TILE_M = 64;
-    constexpr int TILE_N = 64;
+    tiling.SetAType(TPosition::GM, CubeFormat::ND, cubeType);
+    tiling.SetBType(TPosition::GM, CubeFormat::ND, cubeType);
+    tiling.SetCType(TPosition::GM, CubeFormat::ND, cubeType);
 
-    int32_t M0 = AlignUP(M, TILE_M);
-    int32_t K0 = AlignUP(K, 64);
-    int32_t N0 = AlignUP(N, TILE_N);
-
-    tiling.SetShape(M0, N0, K0);
-    tiling.SetOrgShape(M0, N0, K0);
-    tiling.SetAlignSplit(TILE_M, TILE_N, -1);
+    // 实数嵌入后为[M, 2K] @ [2K, 2N]
+    tiling.SetShape(M, 2 * N, 2 * K);
+    tiling.SetOrgShape(M, 2 * N, 2 * K);
 
     tiling.SetBias(false);
 
     tiling.SetBufferSpace(-1, -1, -1);
-    uint32_t n_core = ascendcPlatform.GetCoreNumAiv();
+    // 单个batch只需切出(核数 / batch)份，batch足够多时每个任务就是整个矩阵
+    uint32_t vec_core = ascendcPlatform.GetCoreNumAiv();
+    uint32_t n_core = (vec_core + BatchSize - 1) / BatchSize;
     tiling.SetDim(n_core);
 
     while (n_core > 0 && tiling.GetTiling(tiling1.cubeTilingData) == -1)
@@ -97,13 +123,17 @@ static ge::graphStatus TilingFunc(gert::TilingContext *context)
     tiling1.set_K(K);
     tiling1.set_N(N);
     tiling1.set_BatchSize(BatchSize);
+    tiling1.set_aBatchNum(aBatchNum);
+    tiling1.set_bBatchNum(bBatchNum);
 
-    context->SetBlockDim((n_core + 1) / 2);
+    context->SetTilingKey(isHalf ? 1 : 0);
+    context->SetBlockDim((vec_core + 1) / 2);
     tiling1.SaveToBuffer(context->GetRawTilingData()->GetData(),
                          context->GetRawTilingData()->GetCapacity());
     context->GetRawTilingData()->SetDataSize(tiling1.GetDataSize());
 
-    size_t userWorkspaceSize = (3 * M0 * K0 + 3 * K0 * N0 + 3 * M0 * N0) * sizeof(float);
+    // workspace中只存放展开后的y'，x与输出不再经过workspace
+    size_t userWorkspaceSize = static_cast<size_t>(bBatchNum) * (2 * K) * (2 * N) * typeSize;
     size_t systemWorkspaceSize =
         static_cast<size_t>(ascendcPlatform.GetLibApiWorkSpaceSize());
     size_t *currentWorkspace = context->GetWorkspaceSizes(1);
@@ -118,8 +148,17 @@ namespace ge
 static ge::graphStatus InferShape(gert::InferShapeContext *context)
 {
     const gert::Shape *x1_shape = context->GetInputShape(0);
+    const gert::Shape *x2_shape = context->GetInputShape(1);
     gert::Shape *y_shape = context->GetOutputShape(0);
-    *y_shape = *x1_shape;
+    const gert::Shape *batch_shape = x1_shape->GetDimNum() >= x2_shape->GetDimNum() ? x1_shape : x2_shape;
+    size_t dim = batch_shape->GetDimNum();
+    y_shape->SetDimNum(dim);
+    for (size_t i = 0; i + 2 < dim; i++)
+    {
+        y_shape->SetDim(i, batch_shape->GetDim(i));
+    }
+    y_shape->SetDim(dim - 2, x1_shape->GetDim(x1_shape->GetDimNum() - 2));
+    y_shape->SetDim(dim - 1, x2_shape->GetDim(x2_shape->GetDimNum() - 1));
     return GRAPH_SUCCESS;
 }
 } // namespace ge
@@ -133,24 +172,24 @@ class ComplexMatMul : public OpDef
     {
         this->Input("x")
             .ParamType(REQUIRED)
-            .DataType({ge::DT_COMPLEX64})
-            .Format({ge::FORMAT_ND})
-            .UnknownShapeFormat({ge::FORMAT_ND});
+            .DataType({ge::DT_COMPLEX64, ge::DT_COMPLEX32})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND, ge::FORMAT_ND});
         this->Input("y")
             .ParamType(REQUIRED)
-            .DataType({ge::DT_COMPLEX64})
-            .Format({ge::FORMAT_ND})
-            .UnknownShapeFormat({ge::FORMAT_ND});
+            .DataType({ge::DT_COMPLEX64, ge::DT_COMPLEX32})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND, ge::FORMAT_ND});
         this->Input("bias")
             .ParamType(OPTIONAL)
-            .DataType({ge::DT_COMPLEX64})
-            .Format({ge::FORMAT_ND})
-            .UnknownShapeFormat({ge::FORMAT_ND});
+            .DataType({ge::DT_COMPLEX64, ge::DT_COMPLEX32})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND, ge::FORMAT_ND});
         this->Output("z")
             .ParamType(REQUIRED)
-            .DataType({ge::DT_COMPLEX64})
-            .Format({ge::FORMAT_ND})
-            .UnknownShapeFormat({ge::FORMAT_ND});
+            .DataType({ge::DT_COMPLEX64, ge::DT_COMPLEX32})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND, ge::FORMAT_ND});
 
         this->SetInferShape(ge::InferShape);
 
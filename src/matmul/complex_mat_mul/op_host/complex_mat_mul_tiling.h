@@ -20,6 +20,8 @@ namespace optiling
 {
 BEGIN_TILING_DATA_DEF(MatMulTilingData)
 TILING_DATA_FIELD_DEF(uint32_t, BatchSize);
+TILING_DATA_FIELD_DEF(uint32_t, aBatchNum);
+TILING_DATA_FIELD_DEF(uint32_t, bBatchNum);
 TILING_DATA_FIELD_DEF(uint32_t, M);
 TILING_DATA_FIELD_DEF(uint32_t, K);
 TILING_DATA_FIELD_DEF(uint32_t, N);
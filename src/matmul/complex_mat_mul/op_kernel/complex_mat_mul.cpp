@@ -18,343 +18,241 @@ template <typename T>
 __aicore__ inline T Min(T x, T y) { return x < y ? x : y; }
 
 template <typename T>
-__aicore__ inline T Max(T x, T y) { return x > y ? x : y; }
+__aicore__ inline T CeilDiv(T x, T y) { return (x + y - 1) / y; }
 
 using namespace AscendC;
 using namespace matmul;
 
-__aicore__ inline uint32_t AlignUP(uint32_t x, uint32_t p)
-{
-    return (x + (p - 1)) & ~(p - 1);
-}
-
-__aicore__ inline uint32_t AlignDown(uint32_t x, uint32_t p)
-{
-    return x & ~(p - 1);
-}
-
-template <uint32_t LEN, uint32_t TILE_M, uint32_t TILE_N, uint32_t Alignment = 64>
-class KernelMatMulComplex
+constexpr uint32_t BUFFER_NUM = 2;
+constexpr uint32_t BLOCK_BYTES = 32;
+constexpr uint32_t REPEAT_BYTES = 256;
+constexpr uint32_t MAX_REPEAT_TIMES = 255;
+
+/*
+  复数矩阵乘按实数嵌入计算，x和z保持实部虚部交织的布局，不做拆分与合并：
+    x视为[M, 2K]的实矩阵，y的每个元素(br, bi)展开为2x2块[[br, bi], [-bi, br]]得到[2K, 2N]的实矩阵y'，
+    则x @ y'的第2n列为re(z)，第2n+1列为im(z)，即[M, 2N]的交织复数结果。
+  y'中第2k行就是y的第k行，第2k+1行为第k行实部虚部交换后偶数位取负，由vector核在workspace中生成；
+  x只由cube直接搬入一次，z由fixpipe直接写出一次；有bias时先将bias拷入z，再以原子加写出。
+*/
+template <typename T, uint32_t LEN>
+class KernelComplexMatMul
 {
   public:
-    __aicore__ inline KernelMatMulComplex()
+    using MatT = MatmulType<TPosition::GM, CubeFormat::ND, T>;
+
+    __aicore__ inline KernelComplexMatMul()
     {
     }
-    __aicore__ inline void Init(TPipe *pipe, GM_ADDR x1, GM_ADDR x2, GM_ADDR y,
-                                GM_ADDR bias, GM_ADDR workspace, uint32_t BatchSize, uint32_t M,
-                                uint32_t K, uint32_t N, TCubeTiling *tiling)
+    __aicore__ inline void Init(TPipe *pipe, GM_ADDR x1, GM_ADDR x2, GM_ADDR bias, GM_ADDR y,
+                                GM_ADDR workspace, uint32_t BatchSize, uint32_t aBatchNum, uint32_t bBatchNum,
+                                uint32_t M, uint32_t K, uint32_t N, TCubeTiling *tiling)
     {
         this->BatchSize = BatchSize;
+        this->aBatchNum = aBatchNum;
+        this->bBatchNum = bBatchNum;
         this->M = M;
         this->K = K;
         this->N = N;
-        this->M0 = AlignUP(M, TILE_M);
-        this->K0 = AlignUP(K, Alignment);
-        this->N0 = AlignUP(N, TILE_N);
         this->tiling = tiling;
+        this->vecNum = GetBlockNum() * GetTaskRation();
 
-        x1Gm.SetGlobalBuffer((__gm__ float *)x1, 2 * M * K * sizeof(float));
-        x2Gm.SetGlobalBuffer((__gm__ float *)x2, 2 * K * N * sizeof(float));
-        yGm.SetGlobalBuffer((__gm__ float *)y, 2 * M * N * sizeof(float));
-        workGm.SetGlobalBuffer((__gm__ float *)workspace, (3 * M0 * K0 + 3 * K0 * N0) * sizeof(float));
-        zGm.SetGlobalBuffer((__gm__ float *)workspace + (3 * M0 * K0 + 3 * K0 * N0), 3 * M0 * N0 * sizeof(float));
+        x1Gm.SetGlobalBuffer((__gm__ T *)x1, 2ULL * aBatchNum * M * K);
+        x2Gm.SetGlobalBuffer((__gm__ T *)x2, 2ULL * bBatchNum * K * N);
+        yGm.SetGlobalBuffer((__gm__ T *)y, 2ULL * BatchSize * M * N);
+        expandGm.SetGlobalBuffer((__gm__ T *)workspace, 4ULL * bBatchNum * K * N);
 
-        if (bias)
-        {
-            biasGm.SetGlobalBuffer((__gm__ float *)bias, 2 * M * N * sizeof(float));
-            pipe->InitBuffer(inQueueBias, 1, 2 * TILE_M * TILE_N * sizeof(float));
-            addBias = true;
-        }
-        else
+        addBias = bias != nullptr;
+        if (addBias)
         {
-            addBias = false;
+            biasGm.SetGlobalBuffer((__gm__ T *)bias, 2ULL * BatchSize * M * N);
+            pipe->InitBuffer(queBias, BUFFER_NUM, 2 * LEN * sizeof(T));
         }
 
-        pipe->InitBuffer(inQueueComplex, 1, 2 * LEN * sizeof(float));
-        pipe->InitBuffer(outQueueWork, 1, 3 * LEN * sizeof(float));
+        pipe->InitBuffer(inQueueRow, BUFFER_NUM, 2 * LEN * sizeof(T));
+        pipe->InitBuffer(outQueueRow, BUFFER_NUM, 4 * LEN * sizeof(T));
+        pipe->InitBuffer(tBufOffset, 2 * LEN * sizeof(uint32_t));
+        pipe->InitBuffer(tBufSign, 2 * LEN * sizeof(T));
 
-        pipe->InitBuffer(outQueueY, 1, 2 * TILE_M * TILE_N * sizeof(float));
-        pipe->InitBuffer(tBufAcc, (2 * TILE_M * TILE_N) * sizeof(float));
-        pipe->InitBuffer(inQueueP, 2, (TILE_M * TILE_N) * sizeof(float));
-        pipe->InitBuffer(tBufOffset,
-                         (128) * sizeof(uint32_t) + 128 * sizeof(float));
-        LocalTensor<uint32_t> offset = tBufOffset.Get<uint32_t>();
-
-        for (int i = 0; i < 64; i++)
-        {
-            offset.SetValue(2 * i + 0, 4 * i);
-            offset.SetValue(2 * i + 1, 4 * i + 256);
-        }
+        InitExpandTable();
     }
 
-    __aicore__ inline void CalcOffset(uint32_t blockIdx, const TCubeTiling &tiling, uint32_t &offsetA, uint32_t &offsetB, uint32_t &offsetC)
+    // 用vector指令生成交换实部虚部的字节偏移(i ^ 1) * sizeof(T)，以及[-1, 1, -1, 1, ...]
+    __aicore__ inline void InitExpandTable()
     {
-        uint32_t mSingleBlocks = (tiling.M - 1) / tiling.singleCoreM + 1;
-        uint32_t mCoreIndx = blockIdx % mSingleBlocks;
-        uint32_t nCoreIndx = blockIdx / mSingleBlocks;
-
-        offsetA = mCoreIndx * tiling.Ka * tiling.singleCoreM;
-        offsetB = nCoreIndx * tiling.singleCoreN;
-        offsetC = mCoreIndx * tiling.N * tiling.singleCoreM + nCoreIndx * tiling.singleCoreN;
-
-        if (mCoreIndx * tiling.singleCoreM >= tiling.M || nCoreIndx * tiling.singleCoreN >= tiling.N)
-        {
-            singleCoreM = 0;
-            singleCoreN = 0;
-            return;
-        }
-
-        uint32_t tailM = Min(tiling.M - mCoreIndx * tiling.singleCoreM, (uint32_t) tiling.singleCoreM);
-        uint32_t tailN = Min(tiling.N - nCoreIndx * tiling.singleCoreN, (uint32_t) tiling.singleCoreN);
-        if (tailM < tiling.singleCoreM || tailN < tiling.singleCoreN)
-        {
-            matmulObj.SetTail(tailM, tailN);
-            singleCoreM = tailM;
-            singleCoreN = tailN;
-        }
-        else
-        {
-            singleCoreM = tiling.singleCoreM;
-            singleCoreN = tiling.singleCoreN;
-        }
+        static_assert(2 * LEN * sizeof(uint32_t) % REPEAT_BYTES == 0 && 2 * LEN * sizeof(T) % REPEAT_BYTES == 0,
+                      "LEN must fill whole repeats");
+        static_assert(2 * LEN * sizeof(uint32_t) / REPEAT_BYTES <= MAX_REPEAT_TIMES, "LEN exceeds repeat limit");
+        constexpr int32_t typeSize = static_cast<int32_t>(sizeof(T));
+        constexpr uint8_t offsetRepeat = 2 * LEN * sizeof(uint32_t) / REPEAT_BYTES;
+        constexpr uint8_t signRepeat = 2 * LEN * sizeof(T) / REPEAT_BYTES;
+
+        // 偶数位与奇数位的掩码，32位类型每次repeat只有64个元素，mask_h需为0
+        uint64_t evenMaskB32[2] = {0x5555555555555555, 0};
+        uint64_t oddMaskB32[2] = {0xAAAAAAAAAAAAAAAA, 0};
+        uint64_t evenMask[2] = {0x5555555555555555, sizeof(T) == sizeof(uint32_t) ? 0 : 0x5555555555555555};
+        uint64_t oddMask[2] = {0xAAAAAAAAAAAAAAAA, sizeof(T) == sizeof(uint32_t) ? 0 : 0xAAAAAAAAAAAAAAAA};
+        UnaryRepeatParams repeatParams;
+
+        // i * sizeof(T)，偶数位加sizeof(T)、奇数位减sizeof(T)即为(i ^ 1) * sizeof(T)
+        LocalTensor<int32_t> offset = tBufOffset.Get<int32_t>();
+        CreateVecIndex(offset, static_cast<int32_t>(0), 2 * LEN);
+        PipeBarrier<PIPE_V>();
+        Muls(offset, offset, typeSize, 2 * LEN);
+        PipeBarrier<PIPE_V>();
+        Adds(offset, offset, typeSize, evenMaskB32, offsetRepeat, repeatParams);
+        PipeBarrier<PIPE_V>();
+        Adds(offset, offset, -typeSize, oddMaskB32, offsetRepeat, repeatParams);
+
+        LocalTensor<T> sign = tBufSign.Get<T>();
+        Duplicate(sign, static_cast<T>(-1.0f), evenMask, signRepeat, 1, 8);
+        Duplicate(sign, static_cast<T>(1.0f), oddMask, signRepeat, 1, 8);
+        PipeBarrier<PIPE_V>();
     }
 
     __aicore__ inline void Process()
     {
-        uint32_t offsetA, offsetB, offsetC;
-        CalcOffset(GetBlockIdx(), *tiling, offsetA, offsetB, offsetC);
-
-        const int cnt = GetBlockNum() * GetTaskRation();
-        for (uint32_t b = 0; b < BatchSize; b++)
+        ExpandY();
+        if (addBias)
         {
-            int idx = 0;
-
-            for (uint32_t i = GetBlockIdx(); i < M; i += cnt)
-            {
-                for (uint32_t j = 0; j < K; j += LEN)
-                {
-                    const uint32_t len = Min(LEN, K - j);
-                    CopyInX<true>(x1Gm[2 * (i * K + j)], 2 * len);
-                    SplitAndAdd();
-                    CopyOutWork(i * K0 + j, M0 * K0, AlignUP(len, Alignment));
-                }
-            }
-
-            for (uint32_t i = GetBlockIdx(); i < K; i += cnt)
-            {
-                for (uint32_t j = 0; j < N; j += LEN)
-                {
-                    const uint32_t len = Min(LEN, N - j);
-                    CopyInX(x2Gm[2 * (i * N + j)], 2 * len);
-                    SplitAndAdd();
-                    CopyOutWork(3 * M0 * K0 + i * N0 + j, K0 * N0, AlignUP(len, Alignment));
-                }
-            }
-
-            SyncAll();
-
-            BatchedGemm(zGm[offsetC], workGm[offsetA], workGm[offsetB + 3 * M0 * K0]);
-
-            SyncAll();
-
-            for (uint32_t i = 0; i < M; i += TILE_M, idx += N / TILE_N)
-            {
-                uint32_t len_m = Min(TILE_M, M - i);
-                uint32_t j_start = TILE_N * ((GetBlockIdx() + cnt - idx % cnt) % cnt);
-                for (uint32_t j = j_start; j < N; j += TILE_N * cnt)
-                {
-                    uint32_t len_n = Min(TILE_N, N - j);
-                    if (addBias)
-                    {
-                        CopyInBias(i, j, len_m, len_n);
-                    }
-                    Compute(i, j);
-                    CopyOut(i, j, len_m, len_n);
-                }
-            }
-            x1Gm = x1Gm[2 * M * K];
-            x2Gm = x2Gm[2 * K * N];
-            yGm = yGm[2 * M * N];
-            biasGm = biasGm[2 * M * N];
-            SyncAll();
+            CopyBias();
         }
+        SyncAll();
+        BatchedGemm();
     }
 
-    template<bool need_reset = false>
-    __aicore__ inline void CopyInX(const GlobalTensor<float> &ComplexGm, uint32_t len)
+    // 各核按(batch, M块, N块)领取任务，x/y'的batch步长为0时即为广播
+    __aicore__ inline void BatchedGemm()
     {
-        LocalTensor<float> xLocal = inQueueComplex.AllocTensor<float>();
-        if (need_reset && AlignDown(len, 2 * Alignment) != len)
+        const uint32_t singleM = tiling->singleCoreM;
+        const uint32_t singleN = tiling->singleCoreN;
+        const uint32_t N2 = 2 * N;
+        const uint32_t K2 = 2 * K;
+        const uint64_t tilesN = CeilDiv(N2, singleN);
+        const uint64_t tilesPerBatch = CeilDiv(M, singleM) * tilesN;
+        const uint64_t units = BatchSize * tilesPerBatch;
+
+        for (uint64_t u = GetBlockIdx(); u < units; u += vecNum)
         {
-            Duplicate(xLocal[AlignDown(len, 2 * Alignment)], 0.0f, 2 * Alignment);
+            const uint64_t b = u / tilesPerBatch;
+            const uint32_t mIdx = (u % tilesPerBatch) / tilesN;
+            const uint32_t nIdx = (u % tilesPerBatch) % tilesN;
+            const uint32_t mStart = mIdx * singleM;
+            const uint32_t nStart = nIdx * singleN;
+
+            const uint64_t offsetA = (aBatchNum > 1 ? b : 0) * M * K2 + static_cast<uint64_t>(mStart) * K2;
+            const uint64_t offsetB = (bBatchNum > 1 ? b : 0) * K2 * N2 + nStart;
+            const uint64_t offsetC = b * M * N2 + static_cast<uint64_t>(mStart) * N2 + nStart;
+
+            matmulObj.SetTail(Min(singleM, M - mStart), Min(singleN, N2 - nStart));
+            matmulObj.SetTensorA(x1Gm[offsetA]);
+            matmulObj.SetTensorB(expandGm[offsetB]);
+            matmulObj.IterateAll(yGm[offsetC], addBias ? 1 : 0);
         }
-        DataCopyExtParams copyParamsX{1, static_cast<uint32_t>(len * sizeof(float)), 0, 0, 0};
-        DataCopyPadExtParams<float> padParams{false, 0, 0, 0};
-        DataCopyPad(xLocal, ComplexGm, copyParamsX, padParams);
-        inQueueComplex.EnQue(xLocal);
-    }
-
-    __aicore__ inline void SplitAndAdd()
-    {
-        LocalTensor<float> complex = inQueueComplex.DeQue<float>();
-        LocalTensor<float> work = outQueueWork.AllocTensor<float>();
-
-        Split(complex, work, work[LEN], LEN);
-        Add(work[2 * LEN], work, work[LEN], LEN);
-
-        inQueueComplex.FreeTensor(complex);
-        outQueueWork.EnQue(work);
     }
 
-    __aicore__ inline void CopyOutWork(uint32_t offset, uint32_t stride, uint32_t len)
+    // 生成y'：每个任务处理y一行中不超过LEN个复数，写出y'中相邻的两行
+    __aicore__ inline void ExpandY()
     {
-        LocalTensor<float> work = outQueueWork.DeQue<float>();
-        DataCopyExtParams copyParamsX{3, static_cast<uint32_t>(len * sizeof(float)), (LEN - len) / 8, static_cast<uint32_t>((stride - len) * sizeof(float)), 0};
-        DataCopyPad(workGm[offset], work, copyParamsX);
-        outQueueWork.FreeTensor(work);
-    }
-
-    __aicore__ inline void CopyInBias(uint32_t i, uint32_t j, uint32_t rows,
-                                      uint32_t cols)
-    {
-        LocalTensor<float> xLocal = inQueueBias.AllocTensor<float>();
-        DataCopyExtParams copyParamsX;
-        copyParamsX.blockCount = rows;
-        copyParamsX.blockLen = 2 * cols * sizeof(float);
-        copyParamsX.srcStride = 2 * (N - cols) * sizeof(float);
-        copyParamsX.dstStride = (2 * (TILE_N - cols)) / (32 / sizeof(float));
-        DataCopyPadExtParams<float> padParams{false, 0, 0, 0};
-
-        DataCopyPad(xLocal, biasGm[2 * (i * N + j)], copyParamsX, padParams);
-        inQueueBias.EnQue(xLocal);
-    }
-
-    __aicore__ inline void CopyOut(uint32_t i, uint32_t j, uint32_t rows,
-                                   uint32_t cols)
-    {
-        LocalTensor<float> xLocal = outQueueY.DeQue<float>();
-        DataCopyExtParams copyParamsX;
-        copyParamsX.blockCount = rows;
-        copyParamsX.blockLen = 2 * cols * sizeof(float);
-        copyParamsX.srcStride = (2 * (TILE_N - cols)) / (32 / sizeof(float));
-        copyParamsX.dstStride = (2 * (N - cols)) * sizeof(float);
-        DataCopyPad(yGm[2 * (i * N + j)], xLocal, copyParamsX);
-        outQueueY.FreeTensor(xLocal);
-    }
-
-    __aicore__ inline void BatchedGemm(const GlobalTensor<float> &z,
-                                       const GlobalTensor<float> &x,
-                                       const GlobalTensor<float> &y)
-    {
-        if (singleCoreM == 0 || singleCoreN == 0)
-            return;
-
-        matmulObj.SetTensorA(x);
-        matmulObj.SetTensorB(y);
-        matmulObj.IterateAll(z);
-        matmulObj.SetTensorA(x[M0 * K0]);
-        matmulObj.SetTensorB(y[K0 * N0]);
-        matmulObj.IterateAll(z[M0 * N0]);
-        matmulObj.SetTensorA(x[2 * M0 * K0]);
-        matmulObj.SetTensorB(y[2 * K0 * N0]);
-        matmulObj.IterateAll(z[2 * M0 * N0]);
+        const uint32_t chunks = CeilDiv(N, LEN);
+        const uint64_t tasks = static_cast<uint64_t>(bBatchNum) * K * chunks;
+        for (uint64_t t = GetBlockIdx(); t < tasks; t += vecNum)
+        {
+            const uint64_t row = t / chunks;
+            const uint32_t col = (t % chunks) * LEN;
+            const uint32_t len = Min(LEN, N - col);
+            CopyInRow(row, col, len);
+            ComputeRow(len);
+            CopyOutRow(row, col, len);
+        }
     }
 
-    __aicore__ inline void Split(const LocalTensor<float> &xComplex,
-                                 const LocalTensor<float> &xReal,
-                                 const LocalTensor<float> &xImag,
-                                 uint32_t count)
+    __aicore__ inline void CopyInRow(uint64_t row, uint32_t col, uint32_t len)
     {
-        LocalTensor<uint32_t> offset = tBufOffset.Get<uint32_t>();
-        uint64_t rsvdCnt;
-        GatherMask(xReal, xComplex, 1, false, 0, {1, static_cast<uint16_t>(count / 32), 8, 8}, rsvdCnt);
-        GatherMask(xImag, xComplex, 2, false, 0, {1, static_cast<uint16_t>(count / 32), 8, 8}, rsvdCnt);
+        LocalTensor<T> rowLocal = inQueueRow.AllocTensor<T>();
+        DataCopyExtParams copyParams{1, static_cast<uint32_t>(2 * len * sizeof(T)), 0, 0, 0};
+        DataCopyPadExtParams<T> padParams{false, 0, 0, 0};
+        DataCopyPad(rowLocal, x2Gm[row * 2 * N + 2 * col], copyParams, padParams);
+        inQueueRow.EnQue(rowLocal);
     }
 
-    __aicore__ inline void Combine(const LocalTensor<float> &xComplex,
-                                   const LocalTensor<float> &xReal,
-                                   const LocalTensor<float> &xImag,
-                                   uint32_t count)
+    __aicore__ inline void ComputeRow(uint32_t len)
     {
-        LocalTensor<uint32_t> offset = tBufOffset.Get<uint32_t>();
-        LocalTensor<float> tmp = tBufOffset.Get<float>()[128];
-
-        for (int i = 0; i < count; i += 64)
-        {
-            DataCopy(tmp, xReal[i], 64);
-            DataCopy(tmp[64], xImag[i], 64);
-            Gather(xComplex[2 * i], tmp, offset, 0, 128);
-        }
+        LocalTensor<T> rowLocal = inQueueRow.DeQue<T>();
+        LocalTensor<T> outLocal = outQueueRow.AllocTensor<T>();
+        const uint32_t count = 2 * len;
+        const uint32_t alignCount = CeilDiv(static_cast<uint32_t>(count * sizeof(T)), BLOCK_BYTES) * BLOCK_BYTES / sizeof(T);
+
+        DataCopy(outLocal, rowLocal, alignCount);
+        Gather(outLocal[2 * LEN], rowLocal, tBufOffset.Get<uint32_t>(), 0, count);
+        PipeBarrier<PIPE_V>();
+        Mul(outLocal[2 * LEN], outLocal[2 * LEN], tBufSign.Get<T>(), count);
+
+        inQueueRow.FreeTensor(rowLocal);
+        outQueueRow.EnQue(outLocal);
     }
 
-    __aicore__ inline void CopyInP(uint32_t offset, uint32_t i, uint32_t j)
+    __aicore__ inline void CopyOutRow(uint64_t row, uint32_t col, uint32_t len)
     {
-        auto z = inQueueP.AllocTensor<float>();
-        DataCopyParams params;
-        params.blockCount = TILE_M;
-        params.blockLen = TILE_N * sizeof(float) / 32;
-        params.srcStride = (N0 - TILE_N) * sizeof(float) / 32;
-        params.dstStride = 0;
-        DataCopy(z, zGm[offset + i * N0 + j], params);
-        inQueueP.EnQue(z);
+        LocalTensor<T> outLocal = outQueueRow.DeQue<T>();
+        const uint32_t bytes = 2 * len * sizeof(T);
+        DataCopyExtParams copyParams;
+        copyParams.blockCount = 2;
+        copyParams.blockLen = bytes;
+        copyParams.srcStride = (2 * LEN * sizeof(T) - CeilDiv(bytes, BLOCK_BYTES) * BLOCK_BYTES) / BLOCK_BYTES;
+        copyParams.dstStride = 2 * (N - len) * sizeof(T);
+        copyParams.rsv = 0;
+        DataCopyPad(expandGm[row * 4 * N + 2 * col], outLocal, copyParams);
+        outQueueRow.FreeTensor(outLocal);
     }
 
-    __aicore__ inline void Compute(uint32_t i, uint32_t j)
+    __aicore__ inline void CopyBias()
     {
-        LocalTensor<float> zReal = tBufAcc.Get<float>()[0];
-        LocalTensor<float> zImag = tBufAcc.Get<float>()[TILE_M * TILE_N];
-
-        /*
-          z_real = x_real @ y_real - x_imag @ y_imag
-          z_imag = x_real @ y_imag + x_imag @ y_real
-        */
-
-        CopyInP(0, i, j);
-        auto p1 = inQueueP.DeQue<float>();
-        DataCopy(zReal, p1, TILE_M * TILE_N);
-        Muls(zImag, p1, -1.0f, TILE_M * TILE_N);
-        inQueueP.FreeTensor(p1);
-
-        CopyInP(M0 * N0, i, j);
-        auto p2 = inQueueP.DeQue<float>();
-        Sub(zReal, zReal, p2, TILE_M * TILE_N);
-        Sub(zImag, zImag, p2, TILE_M * TILE_N);
-        inQueueP.FreeTensor(p2);
-
-        CopyInP(2 * M0 * N0, i, j);
-        auto p3 = inQueueP.DeQue<float>();
-        Add(zImag, zImag, p3, TILE_M * TILE_N);
-        inQueueP.FreeTensor(p3);
-
-        auto acc = outQueueY.AllocTensor<float>();
-        Combine(acc, zReal, zImag, TILE_M * TILE_N);
-        if (addBias)
+        const uint64_t total = 2ULL * BatchSize * M * N;
+        const uint64_t tasks = CeilDiv(total, static_cast<uint64_t>(2 * LEN));
+        for (uint64_t t = GetBlockIdx(); t < tasks; t += vecNum)
         {
-            auto bias = inQueueBias.DeQue<float>();
-            Add(acc, acc, bias, 2 * TILE_M * TILE_N);
-            inQueueBias.FreeTensor(bias);
+            const uint64_t start = t * 2 * LEN;
+            const uint32_t len = Min(static_cast<uint64_t>(2 * LEN), total - start);
+            DataCopyExtParams copyParams{1, static_cast<uint32_t>(len * sizeof(T)), 0, 0, 0};
+            DataCopyPadExtParams<T> padParams{false, 0, 0, 0};
+
+            LocalTensor<T> biasLocal = queBias.AllocTensor<T>();
+            DataCopyPad(biasLocal, biasGm[start], copyParams, padParams);
+            queBias.EnQue(biasLocal);
+            biasLocal = queBias.DeQue<T>();
+            DataCopyPad(yGm[start], biasLocal, copyParams);
+            queBias.FreeTensor(biasLocal);
         }
-        outQueueY.EnQue(acc);
     }
 
-    TQue<QuePosition::VECIN, 1> inQueueComplex, inQueueBias, inQueueP;
-    TQue<QuePosition::VECOUT, 1> outQueueWork, outQueueY;
+    TQue<QuePosition::VECIN, BUFFER_NUM> inQueueRow;
+    TQue<QuePosition::VECOUT, BUFFER_NUM> outQueueRow;
+    TQueBind<TPosition::VECIN, TPosition::VECOUT, BUFFER_NUM> queBias;
+    TBuf<TPosition::VECCALC> tBufOffset, tBufSign;
 
-    GlobalTensor<float> x1Gm, x2Gm, yGm, zGm, biasGm, workGm;
-    TBuf<TPosition::VECCALC> tBufOffset, tBufAcc;
+    GlobalTensor<T> x1Gm, x2Gm, yGm, biasGm, expandGm;
 
-    Matmul<MatmulType<TPosition::GM, CubeFormat::ND, float>,
-           MatmulType<TPosition::GM, CubeFormat::ND, float>,
-           MatmulType<TPosition::GM, CubeFormat::ND, float>,
-           MatmulType<TPosition::GM, CubeFormat::ND, float>, CFG_MDL>
-        matmulObj;
+    Matmul<MatT, MatT, MatT, MatT, CFG_MDL> matmulObj;
 
     TCubeTiling *tiling;
-    uint32_t BatchSize, M, K, N, M0, K0, N0, singleCoreM, singleCoreN;
+    uint32_t BatchSize, aBatchNum, bBatchNum, M, K, N, vecNum;
     bool addBias;
 };
 
-// (M, K) (K, N) (M, N)
+template <typename T>
+__aicore__ inline void RunComplexMatMul(GM_ADDR x, GM_ADDR y, GM_ADDR bias, GM_ADDR z, GM_ADDR workspace,
+                                        MatMulTilingData *tilingData)
+{
+    TPipe pipe;
+    KernelComplexMatMul<T, 2048> op;
+    REGIST_MATMUL_OBJ(&pipe, GetSysWorkSpacePtr(), op.matmulObj, &tilingData->cubeTilingData);
+    op.Init(&pipe, x, y, bias, z, workspace, tilingData->BatchSize, tilingData->aBatchNum, tilingData->bBatchNum,
+            tilingData->M, tilingData->K, tilingData->N, &tilingData->cubeTilingData);
+    op.Process();
+}
+
+// (..., M, K) (..., K, N) (..., M, N)
 extern "C" __global__ __aicore__ void complex_mat_mul(GM_ADDR x, GM_ADDR y,
                                               GM_ADDR bias, GM_ADDR z,
                                               GM_ADDR workspace,
@@ -362,16 +260,16 @@ extern "C" __global__ __aicore__ void complex_mat_mul(GM_ADDR x, GM_ADDR y,
 {
     GET_TILING_DATA(tilingData, tiling);
     KERNEL_TASK_TYPE_DEFAULT(KERNEL_TYPE_MIX_AIC_1_2);
-    const uint32_t BatchSize = tilingData.BatchSize;
-    const uint32_t M = tilingData.M;
-    const uint32_t K = tilingData.K;
-    const uint32_t N = tilingData.N;
+    GM_ADDR userWorkspace = GetUserWorkspace(workspace);
 
-    TPipe pipe;
-
-    KernelMatMulComplex<2048, 64, 64> op;
-    REGIST_MATMUL_OBJ(&pipe, GetSysWorkSpacePtr(), op.matmulObj,
-                      &tilingData.cubeTilingData);
-    op.Init(&pipe, x, y, z, bias, workspace, BatchSize, M, K, N, &tilingData.cubeTilingData);
-    op.Process();
+    if (TILING_KEY_IS(0))
+    {
+        // complex64
+        RunComplexMatMul<float>(x, y, bias, z, userWorkspace, &tilingData);
+    }
+    else if (TILING_KEY_IS(1))
+    {
+        // complex32
+        RunComplexMatMul<half>(x, y, bias, z, userWorkspace, &tilingData);
+    }
 }
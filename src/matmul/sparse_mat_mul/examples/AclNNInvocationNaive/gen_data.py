@@ -0,0 +1,43 @@
+#!/usr/bin/python3
+# -*- coding:utf-8 -*-
+# Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+# This file is a part of the CANN Open Software.
+# Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+# ======================================================================================================================
+
+import os
+import numpy as np
+
+
+def gen_golden_data_simple():
+    m, k, n = 1000, 2048, 256
+    a = np.zeros((m, k), dtype=np.float32)
+    # 前64行在前512列上较稠密，覆盖cube路径；其余行每行约8个非零元，覆盖向量路径
+    dense_part = np.random.rand(64, 512) < 0.3
+    a[:64, :512] = np.where(dense_part, np.random.uniform(-1, 1, (64, 512)), 0)
+    for row in range(64, m):
+        cols = np.random.choice(k, np.random.randint(0, 16), replace=False)
+        a[row, cols] = np.random.uniform(-1, 1, cols.size)
+    rows, cols = np.nonzero(a)
+    values = a[rows, cols].astype(np.float32)
+    row_offsets = np.zeros(m + 1, dtype=np.int32)
+    np.cumsum(np.bincount(rows, minlength=m), out=row_offsets[1:])
+    dense = np.random.uniform(-1, 1, (k, n)).astype(np.float32)
+    golden = np.matmul(a, dense).astype(np.float32)
+
+    os.system("mkdir -p input")
+    os.system("mkdir -p output")
+    row_offsets.tofile("./input/input_row_offsets.bin")
+    cols.astype(np.int32).tofile("./input/input_col_indices.bin")
+    values.tofile("./input/input_values.bin")
+    dense.tofile("./input/input_dense.bin")
+    np.array([values.size], dtype=np.int64).tofile("./input/nnz.bin")
+    golden.tofile("./output/golden.bin")
+
+
+if __name__ == "__main__":
+    gen_golden_data_simple()
@@ -0,0 +1,179 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <fstream>
+#include <fcntl.h>
+
+#include "acl/acl.h"
+#include "aclnn_sparse_mat_mul.h"
+
+#define SUCCESS 0
+#define FAILED 1
+
+#define INFO_LOG(fmt, args...) fprintf(stdout, "[INFO]  " fmt "\n", ##args)
+#define WARN_LOG(fmt, args...) fprintf(stdout, "[WARN]  " fmt "\n", ##args)
+#define ERROR_LOG(fmt, args...) fprintf(stderr, "[ERROR]  " fmt "\n", ##args)
+
+#define CHECK_RET(cond, return_expr) \
+    do {                             \
+        if (!(cond)) {               \
+            return_expr;             \
+        }                            \
+    } while (0)
+
+bool ReadFile(const std::string &filePath, size_t fileSize, void *buffer, size_t bufferSize) {
+    std::ifstream file(filePath, std::ios::binary);
+    if (!file.is_open()) {
+        ERROR_LOG("Open file failed. path = %s", filePath.c_str());
+        return false;
+    }
+    file.read(static_cast<char*>(buffer), bufferSize);
+    file.close();
+    return true;
+}
+
+bool WriteFile(const std::string &filePath, const void *buffer, size_t size) {
+    std::ofstream file(filePath, std::ios::binary);
+    if (!file.is_open()) {
+        ERROR_LOG("Open file failed. path = %s", filePath.c_str());
+        return false;
+    }
+    file.write(static_cast<const char*>(buffer), size);
+    file.close();
+    return true;
+}
+
+int64_t GetShapeSize(const std::vector<int64_t> &shape) {
+    int64_t shapeSize = 1;
+    for (auto i : shape) shapeSize *= i;
+    return shapeSize;
+}
+
+int Init(int32_t deviceId, aclrtStream *stream) {
+    auto ret = aclInit(nullptr);
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("aclInit failed. ERROR: %d", ret); return FAILED);
+    ret = aclrtSetDevice(deviceId);
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("aclrtSetDevice failed. ERROR: %d", ret); return FAILED);
+    ret = aclrtCreateStream(stream);
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("aclrtCreateStream failed. ERROR: %d", ret); return FAILED);
+    return SUCCESS;
+}
+
+template <typename T>
+int CreateAclTensor(const std::string &filePath, const std::vector<int64_t> &shape, 
+                    void **deviceAddr, aclDataType dataType, aclTensor **tensor) {
+    auto size = GetShapeSize(shape) * sizeof(T);
+    auto ret = aclrtMalloc(deviceAddr, size, ACL_MEM_MALLOC_HUGE_FIRST);
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("aclrtMalloc failed. ERROR: %d", ret); return FAILED);
+    
+    std::vector<T> hostData(GetShapeSize(shape));
+    if (!ReadFile(filePath, 0, hostData.data(), size)) {
+        return FAILED;
+    }
+    
+    ret = aclrtMemcpy(*deviceAddr, size, hostData.data(), size, ACL_MEMCPY_HOST_TO_DEVICE);
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("aclrtMemcpy failed. ERROR: %d", ret); return FAILED);
+
+    *tensor = aclCreateTensor(shape.data(), shape.size(), dataType, nullptr, 0,
+                              aclFormat::ACL_FORMAT_ND, shape.data(), shape.size(), *deviceAddr);
+    return SUCCESS;
+}
+
+int main() {
+    int32_t deviceId = 0;
+    aclrtStream stream;
+    auto ret = Init(deviceId, &stream);
+    CHECK_RET(ret == SUCCESS, return FAILED);
+
+    // 稀疏矩阵为[m, k]的CSR，dense为[k, n]
+    int64_t m = 1000;
+    int64_t k = 2048;
+    int64_t n = 256;
+    int64_t nnz = 0;
+    CHECK_RET(ReadFile("../input/nnz.bin", 0, &nnz, sizeof(int64_t)), return FAILED);
+    std::vector<int64_t> rowOffsetsShape = {m + 1};
+    std::vector<int64_t> colIndicesShape = {nnz};
+    std::vector<int64_t> valuesShape = {nnz};
+    std::vector<int64_t> denseShape = {k, n};
+    std::vector<int64_t> outputShape = {m, n};
+    std::vector<int64_t> sparseShapeData = {m, k};
+
+    void *rowOffsetsDevice = nullptr, *colIndicesDevice = nullptr, *valuesDevice = nullptr;
+    void *denseDevice = nullptr, *outputDevice = nullptr;
+    aclTensor *rowOffsets = nullptr, *colIndices = nullptr, *values = nullptr, *dense = nullptr, *output = nullptr;
+
+    ret = CreateAclTensor<int32_t>("../input/input_row_offsets.bin", rowOffsetsShape, &rowOffsetsDevice,
+                                   ACL_INT32, &rowOffsets);
+    CHECK_RET(ret == SUCCESS, return FAILED);
+    ret = CreateAclTensor<int32_t>("../input/input_col_indices.bin", colIndicesShape, &colIndicesDevice,
+                                   ACL_INT32, &colIndices);
+    CHECK_RET(ret == SUCCESS, return FAILED);
+    ret = CreateAclTensor<float>("../input/input_values.bin", valuesShape, &valuesDevice, ACL_FLOAT, &values);
+    CHECK_RET(ret == SUCCESS, return FAILED);
+    ret = CreateAclTensor<float>("../input/input_dense.bin", denseShape, &denseDevice, ACL_FLOAT, &dense);
+    CHECK_RET(ret == SUCCESS, return FAILED);
+
+    auto outputSize = GetShapeSize(outputShape) * sizeof(float);
+    ret = aclrtMalloc(&outputDevice, outputSize, ACL_MEM_MALLOC_HUGE_FIRST);
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("aclrtMalloc for output failed. ERROR: %d", ret); return FAILED);
+    output = aclCreateTensor(outputShape.data(), outputShape.size(), ACL_FLOAT, nullptr, 0,
+                             ACL_FORMAT_ND, outputShape.data(), outputShape.size(), outputDevice);
+    aclIntArray *sparseShape = aclCreateIntArray(sparseShapeData.data(), sparseShapeData.size());
+    char sparseFormat[] = "csr";
+    double densityThreshold = 0.0625;
+
+    uint64_t workspaceSize = 0;
+    aclOpExecutor *executor;
+    ret = aclnnSparseMatMulGetWorkspaceSize(rowOffsets, colIndices, values, dense, sparseShape, sparseFormat,
+                                            densityThreshold, output, &workspaceSize, &executor);
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("aclnnSparseMatMulGetWorkspaceSize failed. ERROR: %d", ret); return FAILED);
+
+    void *workspace = nullptr;
+    if (workspaceSize > 0) {
+        ret = aclrtMalloc(&workspace, workspaceSize, ACL_MEM_MALLOC_HUGE_FIRST);
+        CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("Workspace allocation failed. ERROR: %d", ret); return FAILED);
+    }
+
+    ret = aclnnSparseMatMul(workspace, workspaceSize, executor, stream);
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("aclnnSparseMatMul failed. ERROR: %d", ret); return FAILED);
+
+    ret = aclrtSynchronizeStream(stream);
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("aclrtSynchronizeStream failed. ERROR: %d", ret); return FAILED);
+
+    std::vector<float> result(GetShapeSize(outputShape));
+    ret = aclrtMemcpy(result.data(), outputSize, outputDevice, outputSize, ACL_MEMCPY_DEVICE_TO_HOST);
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("Result copy failed. ERROR: %d", ret); return FAILED);
+
+    WriteFile("../output/output_y.bin", result.data(), outputSize);
+    INFO_LOG("Write output success");
+
+    aclDestroyTensor(rowOffsets);
+    aclDestroyTensor(colIndices);
+    aclDestroyTensor(values);
+    aclDestroyTensor(dense);
+    aclDestroyTensor(output);
+    aclDestroyIntArray(sparseShape);
+    aclrtFree(rowOffsetsDevice);
+    aclrtFree(colIndicesDevice);
+    aclrtFree(valuesDevice);
+    aclrtFree(denseDevice);
+    aclrtFree(outputDevice);
+    if (workspace) { aclrtFree(workspace); }
+    aclrtDestroyStream(stream);
+    aclrtResetDevice(deviceId);
+    aclFinalize();
+
+    return SUCCESS;
+}
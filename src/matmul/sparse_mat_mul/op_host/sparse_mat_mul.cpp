@@ -0,0 +1,216 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file sparse_mat_mul.cpp
+ */
+#include <cmath>
+#include <cstring>
+#include "sparse_mat_mul_tiling.h"
+#include "register/op_def_registry.h"
+#include "tiling/platform/platform_ascendc.h"
+#include "tiling/tiling_api.h"
+
+#define OP_LOGD(nodeName, fmt, ...) std::printf(fmt, ##__VA_ARGS__)
+
+using namespace matmul_tiling;
+
+namespace optiling
+{
+constexpr int64_t PANEL_M = 16;
+constexpr int64_t TILE_K = 256;
+constexpr int64_t MAX_K_TILE = 1024;
+constexpr size_t INPUT_ROW_IDX = 0;
+constexpr size_t INPUT_COL_IDX = 1;
+constexpr size_t INPUT_VALUES_IDX = 2;
+constexpr size_t INPUT_DENSE_IDX = 3;
+constexpr size_t ATTR_SPARSE_SHAPE_IDX = 0;
+constexpr size_t ATTR_SPARSE_FORMAT_IDX = 1;
+constexpr size_t ATTR_DENSITY_IDX = 2;
+constexpr size_t SPARSE_SHAPE_DIM = 2;
+constexpr uint32_t BATCH_MODE = 1;
+
+static ge::graphStatus TilingFunc(gert::TilingContext *context)
+{
+    auto ascendcPlatform = platform_ascendc::PlatformAscendC(context->GetPlatformInfo());
+    if (ascendcPlatform.GetSocVersion() != platform_ascendc::SocVersion::ASCEND910B) {
+        return ge::GRAPH_FAILED;
+    }
+    auto attrs = context->GetAttrs();
+    if (attrs == nullptr) {
+        return ge::GRAPH_FAILED;
+    }
+    auto sparseShape = attrs->GetAttrPointer<gert::ContinuousVector>(ATTR_SPARSE_SHAPE_IDX);
+    if (sparseShape == nullptr || sparseShape->GetSize() != SPARSE_SHAPE_DIM) {
+        OP_LOGD(context->GetNodeName(), "sparse_shape should be [m, k].");
+        return ge::GRAPH_FAILED;
+    }
+    const int64_t *sparseShapeData = reinterpret_cast<const int64_t *>(sparseShape->GetData());
+    int64_t m = sparseShapeData[0];
+    int64_t k = sparseShapeData[1];
+    const char *format = attrs->GetStr(ATTR_SPARSE_FORMAT_IDX);
+    bool isCoo = format != nullptr && std::strcmp(format, "coo") == 0;
+    if (format != nullptr && !isCoo && std::strcmp(format, "csr") != 0) {
+        OP_LOGD(context->GetNodeName(), "sparse_format %s is not supported.", format);
+        return ge::GRAPH_FAILED;
+    }
+    const float *densityPtr = attrs->GetAttrPointer<float>(ATTR_DENSITY_IDX);
+    float density = densityPtr == nullptr ? 0.0625f : *densityPtr;
+
+    auto rowShape = context->GetInputShape(INPUT_ROW_IDX)->GetStorageShape();
+    auto colShape = context->GetInputShape(INPUT_COL_IDX)->GetStorageShape();
+    auto valueShape = context->GetInputShape(INPUT_VALUES_IDX)->GetStorageShape();
+    auto denseShape = context->GetInputShape(INPUT_DENSE_IDX)->GetStorageShape();
+    if (denseShape.GetDimNum() != SPARSE_SHAPE_DIM || denseShape.GetDim(0) != k || m <= 0 || k <= 0) {
+        OP_LOGD(context->GetNodeName(), "dense should be [k, n] and match sparse_shape.");
+        return ge::GRAPH_FAILED;
+    }
+    int64_t n = denseShape.GetDim(1);
+    int64_t nnz = valueShape.GetShapeSize();
+    int64_t rowLen = rowShape.GetShapeSize();
+    if (colShape.GetShapeSize() != nnz || rowLen != (isCoo ? nnz : m + 1)) {
+        OP_LOGD(context->GetNodeName(), "row_offsets/col_indices length does not match values.");
+        return ge::GRAPH_FAILED;
+    }
+
+    auto idxDtype = context->GetInputDesc(INPUT_ROW_IDX)->GetDataType();
+    auto valueDtype = context->GetInputDesc(INPUT_VALUES_IDX)->GetDataType();
+    uint64_t idxKey = idxDtype == ge::DT_INT64 ? 0 : 1;
+    uint64_t valueKey = valueDtype == ge::DT_FLOAT ? 0 : 1;
+    auto cubeDtype = valueDtype == ge::DT_FLOAT ? DataType::DT_FLOAT : DataType::DT_FLOAT16;
+    size_t valueSize = valueDtype == ge::DT_FLOAT ? sizeof(float) : sizeof(int16_t);
+
+    // 稠密块阈值：[PANEL_M, TILE_K]块内nnz占比达到density才值得走cube，density > 1时只走向量路径
+    int64_t kTileNum = (k + TILE_K - 1) / TILE_K;
+    int64_t denseThreshold = static_cast<int64_t>(std::ceil(density * PANEL_M * TILE_K));
+    if (denseThreshold < 1) {
+        denseThreshold = 1;
+    }
+    bool denseEnable = density <= 1.0f && kTileNum <= MAX_K_TILE;
+
+    SparseMatMulTilingData tilingData;
+    MatmulApiTiling cubeTiling(ascendcPlatform);
+    cubeTiling.SetAType(TPosition::GM, CubeFormat::ND, cubeDtype);
+    cubeTiling.SetBType(TPosition::GM, CubeFormat::ND, cubeDtype);
+    cubeTiling.SetCType(TPosition::GM, CubeFormat::ND, DataType::DT_FLOAT);
+    cubeTiling.SetShape(PANEL_M, n, TILE_K);
+    cubeTiling.SetOrgShape(PANEL_M, n, TILE_K, k);
+    cubeTiling.SetBias(false);
+    cubeTiling.SetBufferSpace(-1, -1, -1);
+    if (cubeTiling.GetTiling(tilingData.cubeTilingData) == -1) {
+        OP_LOGD(context->GetNodeName(), "cube tiling for dense blocks failed.");
+        return ge::GRAPH_FAILED;
+    }
+
+    uint32_t cubeCoreNum = ascendcPlatform.GetCoreNumAic();
+    int64_t vecCoreNum = static_cast<int64_t>(cubeCoreNum) * 2;
+    tilingData.set_m(m);
+    tilingData.set_k(k);
+    tilingData.set_n(n);
+    tilingData.set_nnz(nnz);
+    tilingData.set_panelNum((m + PANEL_M - 1) / PANEL_M);
+    tilingData.set_vecCoreNum(vecCoreNum);
+    tilingData.set_kTileNum(kTileNum);
+    tilingData.set_denseThreshold(denseThreshold);
+    tilingData.set_isCoo(isCoo ? 1 : 0);
+    tilingData.set_denseEnable(denseEnable ? 1 : 0);
+
+    context->SetBlockDim(cubeCoreNum);
+    context->SetTilingKey(idxKey * 2 + valueKey);
+    context->SetScheduleMode(BATCH_MODE);
+    tilingData.SaveToBuffer(context->GetRawTilingData()->GetData(), context->GetRawTilingData()->GetCapacity());
+    context->GetRawTilingData()->SetDataSize(tilingData.GetDataSize());
+
+    size_t userWorkspaceSize =
+        vecCoreNum * (PANEL_M * TILE_K * valueSize + PANEL_M * n * sizeof(float));
+    size_t systemWorkspaceSize = static_cast<size_t>(ascendcPlatform.GetLibApiWorkSpaceSize());
+    size_t *currentWorkspace = context->GetWorkspaceSizes(1);
+    currentWorkspace[0] = userWorkspaceSize + systemWorkspaceSize;
+
+    OP_LOGD(context->GetNodeName(), "m: %ld, k: %ld, n: %ld, nnz: %ld.\n", m, k, n, nnz);
+    OP_LOGD(context->GetNodeName(), "isCoo: %d, denseEnable: %d, denseThreshold: %ld.\n", isCoo, denseEnable,
+            denseThreshold);
+    return ge::GRAPH_SUCCESS;
+}
+} // namespace optiling
+
+namespace ge
+{
+static ge::graphStatus InferShape(gert::InferShapeContext *context)
+{
+    auto attrs = context->GetAttrs();
+    const gert::Shape *denseShape = context->GetInputShape(3);
+    gert::Shape *yShape = context->GetOutputShape(0);
+    if (attrs == nullptr || denseShape == nullptr || yShape == nullptr) {
+        return GRAPH_FAILED;
+    }
+    auto sparseShape = attrs->GetAttrPointer<gert::ContinuousVector>(0);
+    if (sparseShape == nullptr || sparseShape->GetSize() != 2 || denseShape->GetDimNum() != 2) {
+        return GRAPH_FAILED;
+    }
+    const int64_t *sparseShapeData = reinterpret_cast<const int64_t *>(sparseShape->GetData());
+    yShape->SetDimNum(2);
+    yShape->SetDim(0, sparseShapeData[0]);
+    yShape->SetDim(1, denseShape->GetDim(1));
+    return GRAPH_SUCCESS;
+}
+
+static ge::graphStatus InferDataType(gert::InferDataTypeContext *context)
+{
+    context->SetOutputDataType(0, context->GetInputDataType(3));
+    return GRAPH_SUCCESS;
+}
+} // namespace ge
+
+namespace ops
+{
+class SparseMatMul : public OpDef
+{
+  public:
+    explicit SparseMatMul(const char *name) : OpDef(name)
+    {
+        this->Input("row_offsets")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_INT64, ge::DT_INT64, ge::DT_INT32, ge::DT_INT32})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND});
+        this->Input("col_indices")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_INT64, ge::DT_INT64, ge::DT_INT32, ge::DT_INT32})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND});
+        this->Input("values")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_FLOAT, ge::DT_FLOAT16, ge::DT_FLOAT, ge::DT_FLOAT16})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND});
+        this->Input("dense")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_FLOAT, ge::DT_FLOAT16, ge::DT_FLOAT, ge::DT_FLOAT16})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND});
+        this->Output("y")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_FLOAT, ge::DT_FLOAT16, ge::DT_FLOAT, ge::DT_FLOAT16})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND});
+        this->Attr("sparse_shape").AttrType(REQUIRED).ListInt();
+        this->Attr("sparse_format").AttrType(OPTIONAL).String("csr");
+        this->Attr("density_threshold").AttrType(OPTIONAL).Float(0.0625);
+
+        this->SetInferShape(ge::InferShape).SetInferDataType(ge::InferDataType);
+
+        this->AICore().SetTiling(optiling::TilingFunc);
+        this->AICore().AddConfig("ascend910b");
+    }
+};
+
+OP_ADD(SparseMatMul);
+} // namespace ops
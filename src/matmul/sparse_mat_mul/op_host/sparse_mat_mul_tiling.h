@@ -0,0 +1,37 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file sparse_mat_mul_tiling.h
+ */
+#ifndef SPARSE_MAT_MUL_TILING_H
+#define SPARSE_MAT_MUL_TILING_H
+#include "register/tilingdata_base.h"
+#include "tiling/tiling_api.h"
+
+namespace optiling
+{
+BEGIN_TILING_DATA_DEF(SparseMatMulTilingData)
+TILING_DATA_FIELD_DEF(int64_t, m);
+TILING_DATA_FIELD_DEF(int64_t, k);
+TILING_DATA_FIELD_DEF(int64_t, n);
+TILING_DATA_FIELD_DEF(int64_t, nnz);
+TILING_DATA_FIELD_DEF(int64_t, panelNum);
+TILING_DATA_FIELD_DEF(int64_t, vecCoreNum);
+TILING_DATA_FIELD_DEF(int64_t, kTileNum);
+TILING_DATA_FIELD_DEF(int64_t, denseThreshold);
+TILING_DATA_FIELD_DEF(uint32_t, isCoo);
+TILING_DATA_FIELD_DEF(uint32_t, denseEnable);
+TILING_DATA_FIELD_DEF_STRUCT(TCubeTiling, cubeTilingData);
+END_TILING_DATA_DEF;
+
+REGISTER_TILING_DATA_CLASS(SparseMatMul, SparseMatMulTilingData)
+} // namespace optiling
+#endif
@@ -0,0 +1,46 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file sparse_mat_mul.cpp
+ */
+#include "sparse_mat_mul.h"
+
+using namespace SparseMatMul;
+
+#define SPARSE_MAT_MUL_IMPL(idxType, dataType)                                                       \
+    do {                                                                                             \
+        KernelSparseMatMul<idxType, dataType> op;                                                    \
+        REGIST_MATMUL_OBJ(&pipe, GetSysWorkSpacePtr(), op.mm, &tilingData.cubeTilingData);          \
+        op.Init(rowOffsets, colIndices, values, dense, y, userWs, &tilingData, &pipe);               \
+        op.Process();                                                                                \
+    } while (0)
+
+// tilingKey = idxKey * 2 + valueKey，idx: int64 0 / int32 1，value: float 0 / half 1
+extern "C" __global__ __aicore__ void sparse_mat_mul(GM_ADDR rowOffsets, GM_ADDR colIndices, GM_ADDR values,
+                                                     GM_ADDR dense, GM_ADDR y, GM_ADDR workspace, GM_ADDR tiling)
+{
+    GET_TILING_DATA(tilingData, tiling);
+    KERNEL_TASK_TYPE_DEFAULT(KERNEL_TYPE_MIX_AIC_1_2);
+    GM_ADDR userWs = GetUserWorkspace(workspace);
+    if (userWs == nullptr) {
+        return;
+    }
+    TPipe pipe;
+    if (TILING_KEY_IS(0)) {
+        SPARSE_MAT_MUL_IMPL(int64_t, float);
+    } else if (TILING_KEY_IS(1)) {
+        SPARSE_MAT_MUL_IMPL(int64_t, half);
+    } else if (TILING_KEY_IS(2)) {
+        SPARSE_MAT_MUL_IMPL(int32_t, float);
+    } else if (TILING_KEY_IS(3)) {
+        SPARSE_MAT_MUL_IMPL(int32_t, half);
+    }
+}
@@ -0,0 +1,487 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file sparse_mat_mul.h
+ */
+#ifndef SPARSE_MAT_MUL_H
+#define SPARSE_MAT_MUL_H
+
+#include "kernel_operator.h"
+#include "lib/matmul_intf.h"
+
+namespace SparseMatMul {
+using namespace AscendC;
+using namespace matmul;
+
+constexpr int64_t PANEL_M = 16;
+constexpr int64_t TILE_K = 256;
+constexpr int64_t MAX_K_TILE = 1024;
+constexpr int64_t CHUNK_NNZ = 2048;
+constexpr int64_t TILE_N = 512;
+constexpr int64_t GATHER_ROWS = 16;
+constexpr int64_t BLOCK_BYTES = 32;
+
+template <HardEvent EVENT>
+__aicore__ inline void PipeSync()
+{
+    event_t eventId = static_cast<event_t>(GetTPipePtr()->FetchEventID(EVENT));
+    SetFlag<EVENT>(eventId);
+    WaitFlag<EVENT>(eventId);
+}
+
+__aicore__ inline int64_t CeilAlign(int64_t x, int64_t align)
+{
+    return (x + align - 1) / align * align;
+}
+
+__aicore__ inline int64_t MinLen(int64_t a, int64_t b)
+{
+    return a < b ? a : b;
+}
+
+template <typename T>
+using SpmmMatmul = Matmul<MatmulType<TPosition::GM, CubeFormat::ND, T>, MatmulType<TPosition::GM, CubeFormat::ND, T>,
+                          MatmulType<TPosition::GM, CubeFormat::ND, float>,
+                          MatmulType<TPosition::GM, CubeFormat::ND, float>>;
+
+/*
+ * y = A * B，A为CSR(或按行有序的COO)稀疏矩阵，B为[K, N]稠密矩阵。
+ * 以PANEL_M行为一个面板，按“面板前nnz + 行数”的代价二分切分到各向量核，核间无需同步。
+ * 面板内按TILE_K列切块统计nnz：达到阈值的块在UB中稠密化后交给cube做[16, TILE_K] x [TILE_K, N]，
+ * 其余非零元走向量路径，逐个搬入B的对应行做Axpy。两条路径结果在面板累加器中合并后一次写出。
+ */
+template <typename idxType, typename T>
+class KernelSparseMatMul {
+public:
+    __aicore__ inline KernelSparseMatMul() = default;
+    __aicore__ inline void Init(GM_ADDR rowOffsets, GM_ADDR colIndices, GM_ADDR values, GM_ADDR dense, GM_ADDR y,
+                                GM_ADDR workspace, const SparseMatMulTilingData *__restrict tilingData, TPipe *pipe);
+    __aicore__ inline void Process();
+
+    SpmmMatmul<T> mm;
+
+private:
+    __aicore__ inline int64_t LowerBound(int64_t target);
+    __aicore__ inline int64_t RowPtr(int64_t row);
+    __aicore__ inline int64_t PanelCost(int64_t panel);
+    __aicore__ inline int64_t FindPanel(int64_t target);
+    __aicore__ inline void LoadPanelRows(int64_t panel);
+    __aicore__ inline void LoadChunk(int64_t start, int64_t len);
+    __aicore__ inline void ClassifyChunk(int64_t start, int64_t len);
+    __aicore__ inline void DenseTiles(int64_t len, bool &hasDense);
+    __aicore__ inline void SparseRows(int64_t len, int64_t colStart, int64_t colNum);
+    __aicore__ inline void FlushGather(int64_t cnt, int64_t colNum);
+    __aicore__ inline void ProcessPanel(int64_t panel);
+
+private:
+    GlobalTensor<idxType> rowGm;
+    GlobalTensor<idxType> colGm;
+    GlobalTensor<T> valueGm;
+    GlobalTensor<T> denseGm;
+    GlobalTensor<T> yGm;
+    GlobalTensor<T> aWsGm;
+    GlobalTensor<float> cWsGm;
+
+    TBuf<TPosition::VECCALC> rowBuf;
+    TBuf<TPosition::VECCALC> colBuf;
+    TBuf<TPosition::VECCALC> valBuf;
+    TBuf<TPosition::VECCALC> rowOfBuf;
+    TBuf<TPosition::VECCALC> tileCntBuf;
+    TBuf<TPosition::VECCALC> bucketStartBuf;
+    TBuf<TPosition::VECCALC> bucketBuf;
+    TBuf<TPosition::VECCALC> aTileBuf;
+    TBuf<TPosition::VECCALC> accBuf;
+    TBuf<TPosition::VECCALC> gatherBuf;
+    TBuf<TPosition::VECCALC> outBuf;
+
+    LocalTensor<idxType> rowLocal;
+    LocalTensor<idxType> colLocal;
+    LocalTensor<T> valLocal;
+    LocalTensor<int32_t> rowOf;
+    LocalTensor<int32_t> tileCnt;
+    LocalTensor<int32_t> bucketStart;
+    LocalTensor<int32_t> bucket;
+    LocalTensor<T> aTile;
+    LocalTensor<float> acc;
+    LocalTensor<T> gatherRows;
+    LocalTensor<T> outLocal;
+
+    int64_t m {0};
+    int64_t k {0};
+    int64_t n {0};
+    int64_t nnz {0};
+    bool isCoo {false};
+    int64_t panelNum {0};
+    int64_t vecCoreNum {0};
+    int64_t kTileNum {0};
+    int64_t denseThreshold {0};
+    bool denseEnable {false};
+
+    int64_t panelRows {0};
+    int64_t rowPtr[PANEL_M + 1] {0};
+    int64_t loadedStart {-1};
+    int64_t loadedLen {0};
+    int64_t classifiedStart {-1};
+    int64_t gatherRow[GATHER_ROWS] {0};
+    float gatherVal[GATHER_ROWS] {0};
+};
+
+template <typename idxType, typename T>
+__aicore__ inline void KernelSparseMatMul<idxType, T>::Init(GM_ADDR rowOffsets, GM_ADDR colIndices, GM_ADDR values,
+                                                           GM_ADDR dense, GM_ADDR y, GM_ADDR workspace,
+                                                           const SparseMatMulTilingData *__restrict tilingData,
+                                                           TPipe *pipe)
+{
+    m = tilingData->m;
+    k = tilingData->k;
+    n = tilingData->n;
+    nnz = tilingData->nnz;
+    isCoo = tilingData->isCoo != 0;
+    panelNum = tilingData->panelNum;
+    vecCoreNum = tilingData->vecCoreNum;
+    kTileNum = tilingData->kTileNum;
+    denseThreshold = tilingData->denseThreshold;
+    denseEnable = tilingData->denseEnable != 0;
+
+    rowGm.SetGlobalBuffer((__gm__ idxType *)rowOffsets);
+    colGm.SetGlobalBuffer((__gm__ idxType *)colIndices);
+    valueGm.SetGlobalBuffer((__gm__ T *)values);
+    denseGm.SetGlobalBuffer((__gm__ T *)dense);
+    yGm.SetGlobalBuffer((__gm__ T *)y);
+    // 每个向量核独占一块稠密A块与面板累加结果
+    int64_t aWsSize = PANEL_M * TILE_K;
+    int64_t cWsSize = PANEL_M * n;
+    __gm__ uint8_t *ws = (__gm__ uint8_t *)workspace;
+    aWsGm.SetGlobalBuffer((__gm__ T *)(ws + GetBlockIdx() * aWsSize * sizeof(T)));
+    cWsGm.SetGlobalBuffer((__gm__ float *)(ws + vecCoreNum * aWsSize * sizeof(T) +
+                                           GetBlockIdx() * cWsSize * sizeof(float)));
+
+    pipe->InitBuffer(rowBuf, BLOCK_BYTES * 5);
+    pipe->InitBuffer(colBuf, CHUNK_NNZ * sizeof(idxType));
+    pipe->InitBuffer(valBuf, CHUNK_NNZ * sizeof(T));
+    pipe->InitBuffer(rowOfBuf, CHUNK_NNZ * sizeof(int32_t));
+    pipe->InitBuffer(tileCntBuf, MAX_K_TILE * sizeof(int32_t));
+    pipe->InitBuffer(bucketStartBuf, MAX_K_TILE * sizeof(int32_t));
+    pipe->InitBuffer(bucketBuf, CHUNK_NNZ * sizeof(int32_t));
+    pipe->InitBuffer(aTileBuf, PANEL_M * TILE_K * sizeof(T));
+    pipe->InitBuffer(accBuf, PANEL_M * TILE_N * sizeof(float));
+    pipe->InitBuffer(gatherBuf, GATHER_ROWS * TILE_N * sizeof(T));
+    pipe->InitBuffer(outBuf, PANEL_M * TILE_N * sizeof(T));
+    rowLocal = rowBuf.Get<idxType>();
+    colLocal = colBuf.Get<idxType>();
+    valLocal = valBuf.Get<T>();
+    rowOf = rowOfBuf.Get<int32_t>();
+    tileCnt = tileCntBuf.Get<int32_t>();
+    bucketStart = bucketStartBuf.Get<int32_t>();
+    bucket = bucketBuf.Get<int32_t>();
+    aTile = aTileBuf.Get<T>();
+    acc = accBuf.Get<float>();
+    gatherRows = gatherBuf.Get<T>();
+    outLocal = outBuf.Get<T>();
+}
+
+/*
+ * COO的行下标按行有序，第row行的起点即首个不小于row的位置
+ */
+template <typename idxType, typename T>
+__aicore__ inline int64_t KernelSparseMatMul<idxType, T>::LowerBound(int64_t target)
+{
+    int64_t lo = 0;
+    int64_t hi = nnz;
+    while (lo < hi) {
+        int64_t mid = (lo + hi) / 2;
+        if (static_cast<int64_t>(rowGm.GetValue(mid)) < target) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+template <typename idxType, typename T>
+__aicore__ inline int64_t KernelSparseMatMul<idxType, T>::RowPtr(int64_t row)
+{
+    if (isCoo) {
+        return row >= m ? nnz : LowerBound(row);
+    }
+    return rowGm.GetValue(row);
+}
+
+// 面板代价：每个非零元搬一行B，每个输出行写一行y，两者都是N个元素
+template <typename idxType, typename T>
+__aicore__ inline int64_t KernelSparseMatMul<idxType, T>::PanelCost(int64_t panel)
+{
+    int64_t row = MinLen(panel * PANEL_M, m);
+    return RowPtr(row) + row;
+}
+
+template <typename idxType, typename T>
+__aicore__ inline int64_t KernelSparseMatMul<idxType, T>::FindPanel(int64_t target)
+{
+    int64_t lo = 0;
+    int64_t hi = panelNum;
+    while (lo < hi) {
+        int64_t mid = (lo + hi) / 2;
+        if (PanelCost(mid) < target) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+template <typename idxType, typename T>
+__aicore__ inline void KernelSparseMatMul<idxType, T>::Process()
+{
+    int64_t coreIdx = GetBlockIdx();
+    int64_t total = nnz + m;
+    int64_t panelBegin = FindPanel(total * coreIdx / vecCoreNum);
+    int64_t panelEnd = FindPanel(total * (coreIdx + 1) / vecCoreNum);
+    if (coreIdx == vecCoreNum - 1) {
+        panelEnd = panelNum;
+    }
+    for (int64_t p = panelBegin; p < panelEnd; p++) {
+        ProcessPanel(p);
+    }
+}
+
+template <typename idxType, typename T>
+__aicore__ inline void KernelSparseMatMul<idxType, T>::LoadPanelRows(int64_t panel)
+{
+    int64_t row0 = panel * PANEL_M;
+    panelRows = MinLen(PANEL_M, m - row0);
+    if (isCoo) {
+        for (int64_t r = 0; r <= panelRows; r++) {
+            rowPtr[r] = RowPtr(row0 + r);
+        }
+        return;
+    }
+    DataCopyExtParams copyParams {1, static_cast<uint32_t>((panelRows + 1) * sizeof(idxType)), 0, 0, 0};
+    DataCopyPadExtParams<idxType> padParams {false, 0, 0, 0};
+    PipeSync<HardEvent::S_MTE2>();
+    DataCopyPad(rowLocal, rowGm[row0], copyParams, padParams);
+    PipeSync<HardEvent::MTE2_S>();
+    for (int64_t r = 0; r <= panelRows; r++) {
+        rowPtr[r] = rowLocal.GetValue(r);
+    }
+}
+
+/*
+ * 搬入一段非零元的列号与值，并记录每个非零元所在的面板内行号
+ */
+template <typename idxType, typename T>
+__aicore__ inline void KernelSparseMatMul<idxType, T>::LoadChunk(int64_t start, int64_t len)
+{
+    if (start == loadedStart && len == loadedLen) {
+        return;
+    }
+    DataCopyExtParams colParams {1, static_cast<uint32_t>(len * sizeof(idxType)), 0, 0, 0};
+    DataCopyPadExtParams<idxType> colPad {false, 0, 0, 0};
+    DataCopyExtParams valParams {1, static_cast<uint32_t>(len * sizeof(T)), 0, 0, 0};
+    DataCopyPadExtParams<T> valPad {false, 0, 0, 0};
+    PipeSync<HardEvent::S_MTE2>();
+    DataCopyPad(colLocal, colGm[start], colParams, colPad);
+    DataCopyPad(valLocal, valueGm[start], valParams, valPad);
+    int64_t r = 0;
+    for (int64_t i = 0; i < len; i++) {
+        while (rowPtr[r + 1] <= start + i) {
+            r++;
+        }
+        rowOf.SetValue(i, static_cast<int32_t>(r));
+    }
+    PipeSync<HardEvent::MTE2_S>();
+    loadedStart = start;
+    loadedLen = len;
+    classifiedStart = -1;
+}
+
+/*
+ * 按TILE_K列统计本段各块的nnz，达到阈值的块为稠密块，并把其非零元按块分桶；
+ * bucketStart[kt] < 0表示该块走向量路径
+ */
+template <typename idxType, typename T>
+__aicore__ inline void KernelSparseMatMul<idxType, T>::ClassifyChunk(int64_t start, int64_t len)
+{
+    if (classifiedStart == start) {
+        return;
+    }
+    PipeSync<HardEvent::S_V>();
+    Duplicate(tileCnt, 0, kTileNum);
+    PipeSync<HardEvent::V_S>();
+    for (int64_t i = 0; i < len; i++) {
+        int64_t kt = static_cast<int64_t>(colLocal.GetValue(i)) / TILE_K;
+        tileCnt.SetValue(kt, tileCnt.GetValue(kt) + 1);
+    }
+    int32_t cursor = 0;
+    for (int64_t kt = 0; kt < kTileNum; kt++) {
+        int32_t cnt = tileCnt.GetValue(kt);
+        if (cnt >= denseThreshold) {
+            bucketStart.SetValue(kt, cursor);
+            cursor += cnt;
+        } else {
+            bucketStart.SetValue(kt, -1);
+        }
+    }
+    if (cursor > 0) {
+        for (int64_t i = 0; i < len; i++) {
+            int64_t kt = static_cast<int64_t>(colLocal.GetValue(i)) / TILE_K;
+            int32_t pos = bucketStart.GetValue(kt);
+            if (pos >= 0) {
+                bucket.SetValue(pos, static_cast<int32_t>(i));
+                bucketStart.SetValue(kt, pos + 1);
+            }
+        }
+    }
+    classifiedStart = start;
+}
+
+/*
+ * 稠密块在UB中展开成[PANEL_M, TILE_K]后写到workspace，由cube与B的对应TILE_K行相乘，
+ * 同一面板的多个稠密块以原子加累加到面板结果上
+ */
+template <typename idxType, typename T>
+__aicore__ inline void KernelSparseMatMul<idxType, T>::DenseTiles(int64_t len, bool &hasDense)
+{
+    for (int64_t kt = 0; kt < kTileNum; kt++) {
+        int32_t end = bucketStart.GetValue(kt);
+        if (end < 0) {
+            continue;
+        }
+        int32_t cnt = tileCnt.GetValue(kt);
+        int64_t colBase = kt * TILE_K;
+        int64_t kLen = MinLen(TILE_K, k - colBase);
+        PipeSync<HardEvent::MTE3_V>();
+        Duplicate(aTile, static_cast<T>(0), PANEL_M * TILE_K);
+        PipeSync<HardEvent::V_S>();
+        for (int32_t j = end - cnt; j < end; j++) {
+            int32_t i = bucket.GetValue(j);
+            int64_t col = static_cast<int64_t>(colLocal.GetValue(i)) - colBase;
+            aTile.SetValue(rowOf.GetValue(i) * TILE_K + col, valLocal.GetValue(i));
+        }
+        PipeSync<HardEvent::S_MTE3>();
+        DataCopy(aWsGm, aTile, PANEL_M * TILE_K);
+        PipeSync<HardEvent::MTE3_S>();
+
+        mm.SetTensorA(aWsGm);
+        mm.SetTensorB(denseGm[colBase * n]);
+        mm.SetSingleShape(panelRows, n, kLen);
+        mm.IterateAll(cWsGm, hasDense ? 1 : 0);
+        mm.End();
+        hasDense = true;
+    }
+}
+
+template <typename idxType, typename T>
+__aicore__ inline void KernelSparseMatMul<idxType, T>::FlushGather(int64_t cnt, int64_t colNum)
+{
+    PipeSync<HardEvent::MTE2_V>();
+    for (int64_t j = 0; j < cnt; j++) {
+        if constexpr (IsSameType<T, half>::value) {
+            Axpy(acc[gatherRow[j] * TILE_N], gatherRows[j * TILE_N], static_cast<half>(gatherVal[j]), colNum);
+        } else {
+            Axpy(acc[gatherRow[j] * TILE_N], gatherRows[j * TILE_N], gatherVal[j], colNum);
+        }
+        PipeBarrier<PIPE_V>();
+    }
+    PipeSync<HardEvent::V_MTE2>();
+}
+
+/*
+ * 向量路径：每个非零元搬入B的一行，按批等待后逐行Axpy到所在输出行
+ */
+template <typename idxType, typename T>
+__aicore__ inline void KernelSparseMatMul<idxType, T>::SparseRows(int64_t len, int64_t colStart, int64_t colNum)
+{
+    DataCopyExtParams copyParams {1, static_cast<uint32_t>(colNum * sizeof(T)), 0, 0, 0};
+    DataCopyPadExtParams<T> padParams {false, 0, 0, 0};
+    int64_t cnt = 0;
+    for (int64_t i = 0; i < len; i++) {
+        int64_t col = colLocal.GetValue(i);
+        if (denseEnable && bucketStart.GetValue(col / TILE_K) >= 0) {
+            continue;
+        }
+        DataCopyPad(gatherRows[cnt * TILE_N], denseGm[col * n + colStart], copyParams, padParams);
+        gatherRow[cnt] = rowOf.GetValue(i);
+        gatherVal[cnt] = static_cast<float>(valLocal.GetValue(i));
+        cnt++;
+        if (cnt == GATHER_ROWS) {
+            FlushGather(cnt, colNum);
+            cnt = 0;
+        }
+    }
+    if (cnt > 0) {
+        FlushGather(cnt, colNum);
+    }
+}
+
+template <typename idxType, typename T>
+__aicore__ inline void KernelSparseMatMul<idxType, T>::ProcessPanel(int64_t panel)
+{
+    LoadPanelRows(panel);
+    int64_t row0 = panel * PANEL_M;
+    int64_t nnzBegin = rowPtr[0];
+    int64_t nnzEnd = rowPtr[panelRows];
+
+    bool hasDense = false;
+    if (denseEnable) {
+        for (int64_t s = nnzBegin; s < nnzEnd; s += CHUNK_NNZ) {
+            int64_t len = MinLen(CHUNK_NNZ, nnzEnd - s);
+            LoadChunk(s, len);
+            ClassifyChunk(s, len);
+            DenseTiles(len, hasDense);
+        }
+    }
+
+    for (int64_t c0 = 0; c0 < n; c0 += TILE_N) {
+        int64_t colNum = MinLen(TILE_N, n - c0);
+        int64_t colBytes = CeilAlign(colNum * sizeof(float), BLOCK_BYTES);
+        PipeSync<HardEvent::MTE3_V>();
+        if (hasDense) {
+            DataCopyExtParams accParams {static_cast<uint16_t>(panelRows),
+                                         static_cast<uint32_t>(colNum * sizeof(float)),
+                                         static_cast<uint32_t>((n - colNum) * sizeof(float)),
+                                         static_cast<uint32_t>((TILE_N * sizeof(float) - colBytes) / BLOCK_BYTES), 0};
+            DataCopyPadExtParams<float> accPad {false, 0, 0, 0};
+            PipeSync<HardEvent::MTE3_MTE2>();
+            DataCopyPad(acc, cWsGm[c0], accParams, accPad);
+            PipeSync<HardEvent::MTE2_V>();
+        } else {
+            Duplicate(acc, 0.0f, PANEL_M * TILE_N);
+        }
+        PipeSync<HardEvent::V_MTE2>();
+        for (int64_t s = nnzBegin; s < nnzEnd; s += CHUNK_NNZ) {
+            int64_t len = MinLen(CHUNK_NNZ, nnzEnd - s);
+            LoadChunk(s, len);
+            if (denseEnable) {
+                ClassifyChunk(s, len);
+            }
+            SparseRows(len, c0, colNum);
+        }
+
+        LocalTensor<T> outSrc = acc.template ReinterpretCast<T>();
+        if constexpr (IsSameType<T, half>::value) {
+            PipeSync<HardEvent::MTE3_V>();
+            Cast(outLocal, acc, RoundMode::CAST_ROUND, PANEL_M * TILE_N);
+            outSrc = outLocal;
+        }
+        PipeSync<HardEvent::V_MTE3>();
+        int64_t outBytes = CeilAlign(colNum * sizeof(T), BLOCK_BYTES);
+        DataCopyExtParams outParams {static_cast<uint16_t>(panelRows), static_cast<uint32_t>(colNum * sizeof(T)),
+                                     static_cast<uint32_t>((TILE_N * sizeof(T) - outBytes) / BLOCK_BYTES),
+                                     static_cast<uint32_t>((n - colNum) * sizeof(T)), 0};
+        DataCopyPad(yGm[row0 * n + c0], outSrc, outParams);
+    }
+    PipeSync<HardEvent::MTE3_S>();
+}
+} // namespace SparseMatMul
+#endif // SPARSE_MAT_MUL_H
@@ -13,9 +13,11 @@
  * \brief
  */
 #include <iostream>
+#include <algorithm>
 #include "register/op_def_registry.h"
 #include "tiling/tiling_api.h"
 #include "add_rms_norm_quant_tiling.h"
+#include "norm/fused_norm_ub_cost.h"
 
 namespace optiling {
 #define OP_LOGD(nodeName, fmt, ...)  \
@@ -49,10 +51,17 @@ constexpr uint32_t UB_FACTOR_B16_CUTD = 7680;
 constexpr uint32_t UB_FACTOR_B32_CUTD = 4096;
 constexpr uint32_t UB_FACTOR_SINGLE_N_B16 = 12224;
 constexpr uint32_t BLOCK_ALIGN_NUM = 16;
+constexpr uint32_t MERGE_N_COL_ALIGN = FusedNorm::FUSED_NORM_COL_ALIGN;
+constexpr uint32_t SMALL_REDUCE_NUM = 2000;
+constexpr uint32_t MERGE_N_MIN_ROW = 2;
+// merge-N kernel UB cost: the kernel and the static quant epilogue export it in fused_norm_ub_cost.h
+using MergeNEpilogueCost = FusedNorm::StaticQuantUbCost;
+constexpr uint32_t MERGE_N_UB_RESERVED = 1024;
 constexpr size_t INPUT_IDX_GAMMA = 2;
 constexpr size_t INPUT_IDX_ZERO_POINTS1 = 5;
 constexpr uint32_t MODE_NORMAL = 0;
 constexpr uint32_t MODE_SPLIT_D = 1;
+constexpr uint32_t MODE_MERGE_N = 2;
 constexpr uint32_t MODE_SINGLE_N = 3;
 
 inline static int64_t CeilDiv(const int64_t dividend, const int64_t divisor)
@@ -100,13 +109,45 @@ ge::graphStatus GetOpDescInfo(gert::TilingContext *context, uint32_t &hasZeroPoi
     return ge::GRAPH_SUCCESS;
 }
 
+template <uint32_t X_SIZE>
+static uint32_t CalcMergeNRowFactor(uint64_t ubSize, uint32_t numColAlign, uint32_t blockFactor)
+{
+    using NormCost = FusedNorm::MergeNUbCost<X_SIZE>;
+    uint64_t colBytes = static_cast<uint64_t>(numColAlign) * (NormCost::kColBytes + MergeNEpilogueCost::kColBytes) +
+                        MERGE_N_UB_RESERVED;
+    if (ubSize <= colBytes) {
+        return 0;
+    }
+    uint64_t rowBytes = static_cast<uint64_t>(numColAlign) * (NormCost::kRowBytes + MergeNEpilogueCost::kRowBytes) +
+                        NormCost::kRowFixedBytes + MergeNEpilogueCost::kRowFixedBytes;
+    uint64_t rowFactor = (ubSize - colBytes) / rowBytes;
+    return static_cast<uint32_t>(std::min(rowFactor, static_cast<uint64_t>(blockFactor)));
+}
+
+static uint32_t CalcMergeNRowFactor(uint64_t ubSize, uint32_t numCol, uint32_t blockFactor, DataType &dataType)
+{
+    uint32_t numColAlign = CeilDiv(numCol, MERGE_N_COL_ALIGN) * MERGE_N_COL_ALIGN;
+    if (dataType == ge::DT_FLOAT) {
+        return CalcMergeNRowFactor<sizeof(float)>(ubSize, numColAlign, blockFactor);
+    }
+    return CalcMergeNRowFactor<sizeof(uint16_t)>(ubSize, numColAlign, blockFactor);
+}
+
 static void CalcModeAndUbFactor(gert::TilingContext *context, uint32_t &modeKey, uint32_t &ubFactor,
-    uint32_t blockFactor, platform_ascendc::SocVersion &socVersion, uint32_t numCol, DataType &dataType)
+    uint32_t &rowFactor, uint32_t blockFactor, platform_ascendc::SocVersion &socVersion, uint64_t ubSize,
+    uint32_t numCol, DataType &dataType)
 {
+    uint32_t mergeNRowFactor = CalcMergeNRowFactor(ubSize, numCol, blockFactor, dataType);
     if (blockFactor == 1 && socVersion != platform_ascendc::SocVersion::ASCEND310P &&
         numCol <= UB_FACTOR_SINGLE_N_B16) {
         modeKey = MODE_SINGLE_N;
         ubFactor = UB_FACTOR_SINGLE_N_B16;
+    } else if (socVersion != platform_ascendc::SocVersion::ASCEND310P &&
+               CeilDiv(numCol, MERGE_N_COL_ALIGN) * MERGE_N_COL_ALIGN <= SMALL_REDUCE_NUM &&
+               mergeNRowFactor >= MERGE_N_MIN_ROW) {
+        // many short rows per core: normalize and quantize rowFactor rows per instruction
+        modeKey = MODE_MERGE_N;
+        rowFactor = mergeNRowFactor;
     } else if (numCol > ubFactor) {
         modeKey = MODE_SPLIT_D;
         ubFactor = (dataType == ge::DT_FLOAT) ? UB_FACTOR_B32_CUTD : UB_FACTOR_B16_CUTD;
@@ -148,8 +189,9 @@ ge::graphStatus Tiling4AddRmsNormQuant(gert::TilingContext *context)
     uint32_t rowFactor = 64;
     DataType dataType = context->GetInputDesc(0)->GetDataType();
 
-    uint32_t modeKey = MODE_NORMAL;  // 0: Normal, 1: SplitD, 2: MultiN 3: SingleN
-    CalcModeAndUbFactor(context, modeKey, ubFactor, blockFactor, socVersion, numCol, dataType);
+    uint32_t modeKey = MODE_NORMAL;  // 0: Normal, 1: SplitD, 2: MergeN 3: SingleN
+    CalcModeAndUbFactor(
+        context, modeKey, ubFactor, rowFactor, blockFactor, socVersion, ubSize, numCol, dataType);
     uint32_t tilingKey = modeKey;
     context->SetTilingKey(tilingKey);
 
@@ -14,6 +14,7 @@
  */
 #include "add_rms_norm_quant.h"
 #include "add_rms_norm_quant_split_d.h"
+#include "add_rms_norm_quant_merge_n.h"
 #include "add_rms_norm_quant_single_n.h"
 using namespace AscendC;
 
@@ -39,6 +40,9 @@ extern "C" __global__ __aicore__ void add_rms_norm_quant(GM_ADDR x1, GM_ADDR x2,
     } else if (TILING_KEY_IS(1)) {
         KernelAddRmsNormQuantSplitD<DTYPE_X1, DTYPE_SCALES1, DTYPE_ZERO_POINTS1> op(&pipe);
         INIT_AND_PROCESS;
+    } else if (TILING_KEY_IS(2)) {
+        KernelAddRmsNormQuantMergeN<DTYPE_X1, DTYPE_SCALES1, DTYPE_ZERO_POINTS1> op(&pipe);
+        INIT_AND_PROCESS;
     } else if (TILING_KEY_IS(3)) {
         KernelAddRmsNormQuantSingleN<DTYPE_X1, DTYPE_SCALES1, DTYPE_ZERO_POINTS1> op(&pipe);
         INIT_AND_PROCESS;
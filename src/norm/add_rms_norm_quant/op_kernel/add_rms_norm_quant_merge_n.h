@@ -0,0 +1,47 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file add_rms_norm_quant_merge_n.h
+ * \brief merge-N kernel of AddRmsNormQuant: KernelFusedNormMergeN with the static quant epilogue.
+ */
+#ifndef ADD_RMS_NORM_QUANT_MERGE_N_H_
+#define ADD_RMS_NORM_QUANT_MERGE_N_H_
+#include "fused_norm_merge_n.h"
+
+using namespace AscendC;
+
+template <typename TX, typename TScale, typename TOffset>
+class KernelAddRmsNormQuantMergeN {
+public:
+    using Epilogue = FusedNorm::StaticQuantEpilogue<TScale, TOffset>;
+
+    __aicore__ inline KernelAddRmsNormQuantMergeN(TPipe *pipe) : core_(pipe, &epilogue_) {}
+
+    __aicore__ inline void Init(GM_ADDR x1, GM_ADDR x2, GM_ADDR gamma, GM_ADDR scales1, GM_ADDR scales2,
+        GM_ADDR zero_points1, GM_ADDR zero_points2, GM_ADDR y1, GM_ADDR y2, GM_ADDR x,
+        const AddRMSNormQuantTilingData *tilingData)
+    {
+        epilogue_.SetGm(scales1, zero_points1, y1, tilingData->hasZeroPoints1 != 0);
+        FusedNorm::FusedNormParams params{tilingData->numRow, tilingData->numCol, tilingData->blockFactor,
+            tilingData->rowFactor, tilingData->epsilon, tilingData->avgFactor};
+        core_.Init(x1, x2, gamma, x, params);
+    }
+
+    __aicore__ inline void Process()
+    {
+        core_.Process();
+    }
+
+private:
+    Epilogue epilogue_;
+    FusedNorm::KernelFusedNormMergeN<TX, Epilogue> core_;
+};
+#endif  // ADD_RMS_NORM_QUANT_MERGE_N_H_
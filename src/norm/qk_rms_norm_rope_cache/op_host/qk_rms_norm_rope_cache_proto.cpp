@@ -0,0 +1,94 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file qk_rms_norm_rope_cache_proto.cpp
+ * \brief
+ */
+#include <vector>
+#include <cmath>
+#include "register/op_def_registry.h"
+#include "tiling/tiling_api.h"
+
+using namespace ge;
+
+namespace ops {
+
+static constexpr int INPUT_QKV_IDX = 0;
+static constexpr int INPUT_Q_GAMMA_IDX = 1;
+static constexpr int INPUT_K_CACHE_IDX = 6;
+static constexpr int INPUT_V_CACHE_IDX = 7;
+static constexpr int OUTPUT_Q_IDX = 0;
+static constexpr int OUTPUT_K_CACHE_IDX = 1;
+static constexpr int OUTPUT_V_CACHE_IDX = 2;
+static constexpr int ATTR_NUM_Q_HEADS_IDX = 0;
+
+#define OP_LOGD(nodeName, fmt, ...)  \
+    std::printf(fmt, ##__VA_ARGS__); \
+    std::printf("\n")
+
+#define OPS_CHECK_NULL_WITH_CONTEXT(context, ptr) \
+    if ((ptr) == nullptr) {                       \
+        std::printf("nullptr error!");            \
+        return ge::GRAPH_FAILED;                  \
+    }
+
+static ge::graphStatus InferShape4QkRmsNormRopeCache(gert::InferShapeContext *context)
+{
+    OP_LOGD(context->GetNodeName(), "Begin to do InferShape4QkRmsNormRopeCache");
+    const gert::Shape *qkvShape = context->GetInputShape(INPUT_QKV_IDX);
+    const gert::Shape *gammaShape = context->GetInputShape(INPUT_Q_GAMMA_IDX);
+    const gert::Shape *kCacheShape = context->GetInputShape(INPUT_K_CACHE_IDX);
+    const gert::Shape *vCacheShape = context->GetInputShape(INPUT_V_CACHE_IDX);
+    OPS_CHECK_NULL_WITH_CONTEXT(context, qkvShape);
+    OPS_CHECK_NULL_WITH_CONTEXT(context, gammaShape);
+    OPS_CHECK_NULL_WITH_CONTEXT(context, kCacheShape);
+    OPS_CHECK_NULL_WITH_CONTEXT(context, vCacheShape);
+    auto attrs = context->GetAttrs();
+    OPS_CHECK_NULL_WITH_CONTEXT(context, attrs);
+    const int64_t *numQHeads = attrs->GetInt(ATTR_NUM_Q_HEADS_IDX);
+    OPS_CHECK_NULL_WITH_CONTEXT(context, numQHeads);
+
+    gert::Shape *qShape = context->GetOutputShape(OUTPUT_Q_IDX);
+    gert::Shape *kCacheOutShape = context->GetOutputShape(OUTPUT_K_CACHE_IDX);
+    gert::Shape *vCacheOutShape = context->GetOutputShape(OUTPUT_V_CACHE_IDX);
+    OPS_CHECK_NULL_WITH_CONTEXT(context, qShape);
+    OPS_CHECK_NULL_WITH_CONTEXT(context, kCacheOutShape);
+    OPS_CHECK_NULL_WITH_CONTEXT(context, vCacheOutShape);
+
+    // q: [x.shape[:-1], num_q_heads, head_dim]
+    size_t qkvDimNum = qkvShape->GetDimNum();
+    qShape->SetDimNum(qkvDimNum + 1);
+    for (size_t i = 0; i < qkvDimNum - 1; i++) {
+        qShape->SetDim(i, qkvShape->GetDim(i));
+    }
+    qShape->SetDim(qkvDimNum - 1, *numQHeads);
+    qShape->SetDim(qkvDimNum, gammaShape->GetDim(gammaShape->GetDimNum() - 1));
+    *kCacheOutShape = *kCacheShape;
+    *vCacheOutShape = *vCacheShape;
+
+    OP_LOGD(context->GetNodeName(), "End to do InferShape4QkRmsNormRopeCache");
+    return GRAPH_SUCCESS;
+}
+
+static graphStatus InferDataType4QkRmsNormRopeCache(gert::InferDataTypeContext *context)
+{
+    OP_LOGD(context->GetNodeName(), "Begin to do InferDataType4QkRmsNormRopeCache");
+    context->SetOutputDataType(OUTPUT_Q_IDX, context->GetInputDataType(INPUT_QKV_IDX));
+    context->SetOutputDataType(OUTPUT_K_CACHE_IDX, context->GetInputDataType(INPUT_K_CACHE_IDX));
+    context->SetOutputDataType(OUTPUT_V_CACHE_IDX, context->GetInputDataType(INPUT_V_CACHE_IDX));
+    OP_LOGD(context->GetNodeName(), "End to do InferDataType4QkRmsNormRopeCache");
+    return GRAPH_SUCCESS;
+}
+
+IMPL_OP_INFERSHAPE(QkRmsNormRopeCache)
+    .InferShape(InferShape4QkRmsNormRopeCache)
+    .InferDataType(InferDataType4QkRmsNormRopeCache);
+}  // namespace ops
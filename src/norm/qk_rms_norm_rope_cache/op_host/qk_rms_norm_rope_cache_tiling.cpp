@@ -0,0 +1,246 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file qk_rms_norm_rope_cache_tiling.cpp
+ * \brief
+ */
+#include <iostream>
+#include "register/op_def_registry.h"
+#include "tiling/tiling_api.h"
+#include "qk_rms_norm_rope_cache_tiling.h"
+
+// tools api
+namespace optiling {
+#define OP_LOGD(nodeName, fmt, ...)  \
+    std::printf(fmt, ##__VA_ARGS__); \
+    std::printf("\n")
+#define OP_LOGI(nodeName, fmt, ...)  \
+    std::printf(fmt, ##__VA_ARGS__); \
+    std::printf("\n")
+
+#define OP_LOGE(op_name, ...) std::printf(op_name, ##__VA_ARGS__)
+#define OPS_CHECK_NULL_WITH_CONTEXT(context, ptr) \
+    if ((ptr) == nullptr) {                       \
+        std::printf("nullptr error!");            \
+        return ge::GRAPH_FAILED;                  \
+    }
+#define OP_TILING_CHECK(cond, log_func, expr) \
+    do {                                      \
+        if (cond) {                           \
+            log_func;                         \
+            expr;                             \
+        }                                     \
+    } while (0)
+}  // namespace optiling
+
+namespace optiling {
+constexpr uint32_t DTYPE_KEY_FP16 = 1;
+constexpr uint32_t DTYPE_KEY_BF16 = 2;
+constexpr uint32_t ROTARY_MODE_HALF = 0;
+constexpr uint32_t ROTARY_MODE_INTERLEAVE = 1;
+constexpr uint32_t HEAD_DIM_ALIGN = 32;
+constexpr uint32_t ROTARY_DIM_ALIGN = 16;
+constexpr uint32_t MAX_HEAD_DIM = 1024;
+constexpr uint32_t MAX_HEAD_NUM = 255;
+constexpr uint32_t UB_RESERVED = 2048;
+// reduce (64 floats) + rstd + brcb (8 floats) per head row
+constexpr uint32_t UB_PER_HEAD_ROW = 292;
+constexpr int32_t INPUT_QKV_INDEX = 0;
+constexpr int32_t INPUT_Q_GAMMA_INDEX = 1;
+constexpr int32_t INPUT_K_GAMMA_INDEX = 2;
+constexpr int32_t INPUT_COS_INDEX = 3;
+constexpr int32_t INPUT_SIN_INDEX = 4;
+constexpr int32_t INPUT_SLOT_INDEX = 5;
+constexpr int32_t INPUT_K_CACHE_INDEX = 6;
+constexpr int32_t INPUT_V_CACHE_INDEX = 7;
+constexpr int32_t ATTR_NUM_Q_HEADS_INDEX = 0;
+constexpr int32_t ATTR_NUM_KV_HEADS_INDEX = 1;
+constexpr int32_t ATTR_EPSILON_INDEX = 2;
+constexpr int32_t ATTR_ROTARY_MODE_INDEX = 3;
+constexpr size_t SYS_WORKSPACE_SIZE = 16 * 1024 * 1024;
+
+static uint64_t GetRowNum(const gert::Shape &shape)
+{
+    uint64_t rowNum = 1;
+    for (size_t i = 0; i + 1 < shape.GetDimNum(); i++) {
+        rowNum *= shape.GetDim(i);
+    }
+    return rowNum;
+}
+
+static ge::graphStatus CheckShapes(const gert::TilingContext *context, uint32_t numQHead, uint32_t numKvHead,
+    uint32_t &headDim, uint32_t &rotaryDim, uint32_t &numSlot)
+{
+    const gert::StorageShape *qkvShape = context->GetInputShape(INPUT_QKV_INDEX);
+    const gert::StorageShape *qGammaShape = context->GetInputShape(INPUT_Q_GAMMA_INDEX);
+    const gert::StorageShape *kGammaShape = context->GetInputShape(INPUT_K_GAMMA_INDEX);
+    const gert::StorageShape *cosShape = context->GetInputShape(INPUT_COS_INDEX);
+    const gert::StorageShape *sinShape = context->GetInputShape(INPUT_SIN_INDEX);
+    const gert::StorageShape *slotShape = context->GetInputShape(INPUT_SLOT_INDEX);
+    const gert::StorageShape *kCacheShape = context->GetInputShape(INPUT_K_CACHE_INDEX);
+    const gert::StorageShape *vCacheShape = context->GetInputShape(INPUT_V_CACHE_INDEX);
+    OPS_CHECK_NULL_WITH_CONTEXT(context, qkvShape);
+    OPS_CHECK_NULL_WITH_CONTEXT(context, qGammaShape);
+    OPS_CHECK_NULL_WITH_CONTEXT(context, kGammaShape);
+    OPS_CHECK_NULL_WITH_CONTEXT(context, cosShape);
+    OPS_CHECK_NULL_WITH_CONTEXT(context, sinShape);
+    OPS_CHECK_NULL_WITH_CONTEXT(context, slotShape);
+    OPS_CHECK_NULL_WITH_CONTEXT(context, kCacheShape);
+    OPS_CHECK_NULL_WITH_CONTEXT(context, vCacheShape);
+
+    const gert::Shape &qkv = qkvShape->GetStorageShape();
+    const gert::Shape &cos = cosShape->GetStorageShape();
+    OP_TILING_CHECK(qkv.GetDimNum() < 2,
+        OP_LOGE(context->GetNodeName(), "Input qkv's dim num should not be smaller than 2."),
+        return ge::GRAPH_FAILED);
+    uint64_t numToken = GetRowNum(qkv);
+    headDim = qGammaShape->GetStorageShape().GetShapeSize();
+    OP_TILING_CHECK(kGammaShape->GetStorageShape().GetShapeSize() != headDim,
+        OP_LOGE(context->GetNodeName(), "Input q_gamma and k_gamma must have the same size."),
+        return ge::GRAPH_FAILED);
+    OP_TILING_CHECK(headDim == 0 || headDim % HEAD_DIM_ALIGN != 0 || headDim > MAX_HEAD_DIM,
+        OP_LOGE(context->GetNodeName(), "head_dim(%u) must be a multiple of %u and not greater than %u.", headDim,
+            HEAD_DIM_ALIGN, MAX_HEAD_DIM),
+        return ge::GRAPH_FAILED);
+    OP_TILING_CHECK(qkv.GetDim(qkv.GetDimNum() - 1) != static_cast<int64_t>(numQHead + 2 * numKvHead) * headDim,
+        OP_LOGE(context->GetNodeName(), "qkv last dim must be (num_q_heads + 2 * num_kv_heads) * head_dim."),
+        return ge::GRAPH_FAILED);
+
+    rotaryDim = cos.GetDim(cos.GetDimNum() - 1);
+    OP_TILING_CHECK(rotaryDim == 0 || rotaryDim % ROTARY_DIM_ALIGN != 0 || rotaryDim > headDim,
+        OP_LOGE(context->GetNodeName(), "rotary dim(%u) must be a multiple of %u and not greater than head_dim.",
+            rotaryDim, ROTARY_DIM_ALIGN),
+        return ge::GRAPH_FAILED);
+    OP_TILING_CHECK(GetRowNum(cos) != numToken || sinShape->GetStorageShape() != cos,
+        OP_LOGE(context->GetNodeName(), "cos and sin must both be [num_token, rotary_dim]."),
+        return ge::GRAPH_FAILED);
+    OP_TILING_CHECK(static_cast<uint64_t>(slotShape->GetStorageShape().GetShapeSize()) != numToken,
+        OP_LOGE(context->GetNodeName(), "slot_mapping size must equal num_token."),
+        return ge::GRAPH_FAILED);
+
+    const gert::Shape &kCache = kCacheShape->GetStorageShape();
+    uint64_t slotSize = static_cast<uint64_t>(numKvHead) * headDim;
+    OP_TILING_CHECK(kCache.GetDim(kCache.GetDimNum() - 1) != headDim || kCache.GetShapeSize() % slotSize != 0 ||
+                        vCacheShape->GetStorageShape() != kCache,
+        OP_LOGE(context->GetNodeName(), "k_cache and v_cache must be [..., num_kv_heads, head_dim] of same shape."),
+        return ge::GRAPH_FAILED);
+    numSlot = kCache.GetShapeSize() / slotSize;
+    return ge::GRAPH_SUCCESS;
+}
+
+static ge::graphStatus Tiling4QkRmsNormRopeCache(gert::TilingContext *context)
+{
+    OP_LOGD("Tiling4QkRmsNormRopeCache", "Enter Tiling4QkRmsNormRopeCache");
+    auto ptrCompileInfo = reinterpret_cast<const QkRmsNormRopeCacheCompileInfo *>(context->GetCompileInfo());
+    uint32_t numCore;
+    uint64_t ubSize;
+    if (nullptr == ptrCompileInfo) {
+        auto ascendc_platform = platform_ascendc::PlatformAscendC(context->GetPlatformInfo());
+        numCore = ascendc_platform.GetCoreNumAiv();
+        ascendc_platform.GetCoreMemSize(platform_ascendc::CoreMemType::UB, ubSize);
+    } else {
+        numCore = ptrCompileInfo->totalCoreNum;
+        ubSize = ptrCompileInfo->totalUbSize;
+    }
+
+    auto attrs = context->GetAttrs();
+    OPS_CHECK_NULL_WITH_CONTEXT(context, attrs);
+    const int64_t *numQHeadPtr = attrs->GetInt(ATTR_NUM_Q_HEADS_INDEX);
+    const int64_t *numKvHeadPtr = attrs->GetInt(ATTR_NUM_KV_HEADS_INDEX);
+    const float *epsilon = attrs->GetFloat(ATTR_EPSILON_INDEX);
+    const int64_t *rotaryModePtr = attrs->GetInt(ATTR_ROTARY_MODE_INDEX);
+    OPS_CHECK_NULL_WITH_CONTEXT(context, numQHeadPtr);
+    OPS_CHECK_NULL_WITH_CONTEXT(context, numKvHeadPtr);
+    OPS_CHECK_NULL_WITH_CONTEXT(context, epsilon);
+    int64_t rotaryMode = rotaryModePtr == nullptr ? ROTARY_MODE_HALF : *rotaryModePtr;
+    OP_TILING_CHECK(*numQHeadPtr <= 0 || *numQHeadPtr > MAX_HEAD_NUM || *numKvHeadPtr <= 0 ||
+                        *numKvHeadPtr > MAX_HEAD_NUM,
+        OP_LOGE(context->GetNodeName(), "num_q_heads and num_kv_heads must be in [1, %u].", MAX_HEAD_NUM),
+        return ge::GRAPH_FAILED);
+    OP_TILING_CHECK(*epsilon < 0, OP_LOGE(context->GetNodeName(), "Epsilon less than zero, please check."),
+        return ge::GRAPH_FAILED);
+    OP_TILING_CHECK(rotaryMode != ROTARY_MODE_HALF && rotaryMode != ROTARY_MODE_INTERLEAVE,
+        OP_LOGE(context->GetNodeName(), "rotary_mode only supports 0 (half) and 1 (interleave)."),
+        return ge::GRAPH_FAILED);
+    uint32_t numQHead = static_cast<uint32_t>(*numQHeadPtr);
+    uint32_t numKvHead = static_cast<uint32_t>(*numKvHeadPtr);
+
+    uint32_t headDim = 0;
+    uint32_t rotaryDim = 0;
+    uint32_t numSlot = 0;
+    OP_TILING_CHECK(CheckShapes(context, numQHead, numKvHead, headDim, rotaryDim, numSlot) != ge::GRAPH_SUCCESS,
+        OP_LOGE(context->GetNodeName(), "Input shape invalid."),
+        return ge::GRAPH_FAILED);
+
+    uint32_t numToken = GetRowNum(context->GetInputShape(INPUT_QKV_INDEX)->GetStorageShape());
+    uint32_t blockFactor = CeilDiv(numToken, numCore);
+    uint32_t useCoreNum = CeilDiv(numToken, blockFactor);
+
+    auto dataType = context->GetInputDesc(INPUT_QKV_INDEX)->GetDataType();
+    uint32_t dtypeKey = (dataType == ge::DT_BF16) ? DTYPE_KEY_BF16 : DTYPE_KEY_FP16;
+
+    // in + out (b16) + x + tmp (fp32) [+ gather offsets] per element, cos + sin (fp32) per rotary element.
+    uint32_t headNum = numQHead > numKvHead ? numQHead : numKvHead;
+    uint64_t perElem = sizeof(uint16_t) * 2 + sizeof(float) * 2 + (rotaryMode == ROTARY_MODE_INTERLEAVE ? 4 : 0);
+    uint64_t perToken = headNum * (headDim * perElem + UB_PER_HEAD_ROW) + rotaryDim * sizeof(float) * 2;
+    uint64_t perCol = sizeof(float) * 3;  // q_gamma, k_gamma, sign row
+    uint64_t ubAvail = ubSize - UB_RESERVED - headDim * perCol;
+    uint64_t tokenFactor = ubAvail / perToken;
+    OP_TILING_CHECK(tokenFactor == 0,
+        OP_LOGE(context->GetNodeName(), "num_heads(%u) x head_dim(%u) of one token exceeds ub.", headNum, headDim),
+        return ge::GRAPH_FAILED);
+    tokenFactor = tokenFactor > blockFactor ? blockFactor : tokenFactor;
+
+    uint32_t tilingKey = dtypeKey * 10 + static_cast<uint32_t>(rotaryMode);
+    context->SetTilingKey(tilingKey);
+    context->SetBlockDim(useCoreNum);
+
+    QkRmsNormRopeCacheTilingData tiling;
+    tiling.set_num_token(numToken);
+    tiling.set_num_q_head(numQHead);
+    tiling.set_num_kv_head(numKvHead);
+    tiling.set_head_dim(headDim);
+    tiling.set_rotary_dim(rotaryDim);
+    tiling.set_block_factor(blockFactor);
+    tiling.set_token_factor(static_cast<uint32_t>(tokenFactor));
+    tiling.set_num_slot(numSlot);
+    tiling.set_epsilon(*epsilon);
+    tiling.set_avg_factor(1.0f / headDim);
+    tiling.SaveToBuffer(context->GetRawTilingData()->GetData(), context->GetRawTilingData()->GetCapacity());
+    context->GetRawTilingData()->SetDataSize(tiling.GetDataSize());
+
+    size_t *currentWorkspace = context->GetWorkspaceSizes(1);
+    currentWorkspace[0] = SYS_WORKSPACE_SIZE;
+
+    OP_LOGI("Tiling4QkRmsNormRopeCache", "Tiling Key: %u, Block Dim: %u", tilingKey, useCoreNum);
+    OP_LOGI("Tiling4QkRmsNormRopeCache",
+        "numToken: %u, numQHead: %u, numKvHead: %u, headDim: %u, rotaryDim: %u, blockFactor: %u, tokenFactor: %lu",
+        numToken, numQHead, numKvHead, headDim, rotaryDim, blockFactor, tokenFactor);
+    return ge::GRAPH_SUCCESS;
+}
+
+static ge::graphStatus TilingPrepare4QkRmsNormRopeCache(gert::TilingParseContext *context)
+{
+    OP_LOGD(context->GetNodeName(), "TilingPrepare4QkRmsNormRopeCache running.");
+    auto compileInfo = GetCompileInfoPtr<QkRmsNormRopeCacheCompileInfo>(context);
+    OPS_CHECK_NULL_WITH_CONTEXT(context, compileInfo);
+    auto platformInfo = context->GetPlatformInfo();
+    OPS_CHECK_NULL_WITH_CONTEXT(context, platformInfo);
+    auto ascendcPlatform = platform_ascendc::PlatformAscendC(platformInfo);
+    compileInfo->totalCoreNum = ascendcPlatform.GetCoreNumAiv();
+    ascendcPlatform.GetCoreMemSize(platform_ascendc::CoreMemType::UB, compileInfo->totalUbSize);
+    return ge::GRAPH_SUCCESS;
+}
+
+IMPL_OP_OPTILING(QkRmsNormRopeCache)
+    .Tiling(Tiling4QkRmsNormRopeCache)
+    .TilingParse<QkRmsNormRopeCacheCompileInfo>(TilingPrepare4QkRmsNormRopeCache);
+}  // namespace optiling
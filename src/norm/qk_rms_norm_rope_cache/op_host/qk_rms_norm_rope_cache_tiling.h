@@ -0,0 +1,57 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file qk_rms_norm_rope_cache_tiling.h
+ * \brief
+ */
+#ifndef OPS_BUILT_IN_OP_TILING_RUNTIME_QK_RMS_NORM_ROPE_CACHE_H_
+#define OPS_BUILT_IN_OP_TILING_RUNTIME_QK_RMS_NORM_ROPE_CACHE_H_
+
+#include "register/tilingdata_base.h"
+#include "tiling/platform/platform_ascendc.h"
+
+namespace optiling {
+BEGIN_TILING_DATA_DEF(QkRmsNormRopeCacheTilingData)
+TILING_DATA_FIELD_DEF(uint32_t, num_token);
+TILING_DATA_FIELD_DEF(uint32_t, num_q_head);
+TILING_DATA_FIELD_DEF(uint32_t, num_kv_head);
+TILING_DATA_FIELD_DEF(uint32_t, head_dim);
+TILING_DATA_FIELD_DEF(uint32_t, rotary_dim);
+TILING_DATA_FIELD_DEF(uint32_t, block_factor);
+TILING_DATA_FIELD_DEF(uint32_t, token_factor);
+TILING_DATA_FIELD_DEF(uint32_t, num_slot);
+TILING_DATA_FIELD_DEF(float, epsilon);
+TILING_DATA_FIELD_DEF(float, avg_factor);
+END_TILING_DATA_DEF;
+
+struct QkRmsNormRopeCacheCompileInfo {
+    uint32_t totalCoreNum = 0;
+    uint64_t totalUbSize = 0;
+};
+
+template <typename T>
+inline T *GetCompileInfoPtr(gert::TilingParseContext *context)
+{
+    return context->GetCompiledInfo<T>();
+}
+
+inline static int64_t CeilDiv(const int64_t dividend, const int64_t divisor)
+{
+    if (divisor == 0) {
+        return 0;
+    }
+    return (dividend + divisor - 1) / divisor;
+}
+
+REGISTER_TILING_DATA_CLASS(QkRmsNormRopeCache, QkRmsNormRopeCacheTilingData)
+}  // namespace optiling
+
+#endif  // OPS_BUILT_IN_OP_TILING_RUNTIME_QK_RMS_NORM_ROPE_CACHE_H_
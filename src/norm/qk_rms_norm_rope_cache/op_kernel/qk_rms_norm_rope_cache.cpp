@@ -0,0 +1,41 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file qk_rms_norm_rope_cache.cpp
+ * \brief
+ */
+#include "qk_rms_norm_rope_cache.h"
+
+using namespace AscendC;
+
+#define GENERAL_OP_IMPL(templateClass, ...)                                                               \
+    do {                                                                                                  \
+        templateClass<__VA_ARGS__> op(&pipe);                                                             \
+        op.Init(qkv, q_gamma, k_gamma, cos, sin, slot_mapping, k_cache, v_cache, q, workspace, &tilingData); \
+        op.Process();                                                                                     \
+    } while (0)
+
+extern "C" __global__ __aicore__ void qk_rms_norm_rope_cache(GM_ADDR qkv, GM_ADDR q_gamma, GM_ADDR k_gamma,
+    GM_ADDR cos, GM_ADDR sin, GM_ADDR slot_mapping, GM_ADDR k_cache, GM_ADDR v_cache, GM_ADDR q,
+    GM_ADDR k_cache_out, GM_ADDR v_cache_out, GM_ADDR workspace, GM_ADDR tiling)
+{
+    TPipe pipe;
+    GET_TILING_DATA(tilingData, tiling);
+    if (TILING_KEY_IS(10)) {
+        GENERAL_OP_IMPL(KernelQkRmsNormRopeCache, half, ROTARY_MODE_HALF);
+    } else if (TILING_KEY_IS(11)) {
+        GENERAL_OP_IMPL(KernelQkRmsNormRopeCache, half, ROTARY_MODE_INTERLEAVE);
+    } else if (TILING_KEY_IS(20)) {
+        GENERAL_OP_IMPL(KernelQkRmsNormRopeCache, bfloat16_t, ROTARY_MODE_HALF);
+    } else if (TILING_KEY_IS(21)) {
+        GENERAL_OP_IMPL(KernelQkRmsNormRopeCache, bfloat16_t, ROTARY_MODE_INTERLEAVE);
+    }
+}
@@ -0,0 +1,367 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file qk_rms_norm_rope_cache.h
+ * \brief split packed qkv [T, (Nq + 2 * Nkv) * D] -> per-head RmsNorm(q / k) -> RoPE(q / k) -> q out,
+ *        k / v scattered into the caches by slot_mapping.
+ *
+ * Each core owns blockFactor tokens and walks them tokenFactor tokens at a time. The q (or k) heads of a
+ * tile are one dense (tokenFactor * numHead, D) fp32 tile, so norm and rotary run in the merge-N style:
+ * one vector instruction covers up to 255 head rows per 64 columns.
+ */
+#ifndef QK_RMS_NORM_ROPE_CACHE_H_
+#define QK_RMS_NORM_ROPE_CACHE_H_
+#include "fused_norm_utils.h"
+
+using namespace AscendC;
+
+constexpr uint8_t ROTARY_MODE_HALF = 0;        // rotate_half: [x1, x2] -> [-x2, x1]
+constexpr uint8_t ROTARY_MODE_INTERLEAVE = 1;  // interleave: (x0, x1) -> (-x1, x0)
+
+template <typename T, uint8_t ROTARY_MODE>
+class KernelQkRmsNormRopeCache {
+public:
+    __aicore__ inline KernelQkRmsNormRopeCache(TPipe *pipe) : pipe_(pipe) {}
+
+    __aicore__ inline void Init(GM_ADDR qkv, GM_ADDR qGamma, GM_ADDR kGamma, GM_ADDR cos, GM_ADDR sin,
+        GM_ADDR slotMapping, GM_ADDR kCache, GM_ADDR vCache, GM_ADDR q, GM_ADDR workspace,
+        const QkRmsNormRopeCacheTilingData *tiling)
+    {
+        ASSERT(GetBlockNum() != 0 && "Block dim can not be zero!");
+        numQHead_ = tiling->num_q_head;
+        numKvHead_ = tiling->num_kv_head;
+        headDim_ = tiling->head_dim;
+        rotaryDim_ = tiling->rotary_dim;
+        tokenFactor_ = tiling->token_factor;
+        numSlot_ = tiling->num_slot;
+        epsilon_ = tiling->epsilon;
+        avgFactor_ = tiling->avg_factor;
+        qkvCol_ = (numQHead_ + 2 * numKvHead_) * headDim_;
+
+        uint32_t blockIdx = GetBlockIdx();
+        uint64_t tokenStart = static_cast<uint64_t>(blockIdx) * tiling->block_factor;
+        if (blockIdx < GetBlockNum() - 1) {
+            tokenWork_ = tiling->block_factor;
+        } else if (blockIdx == GetBlockNum() - 1) {
+            tokenWork_ = tiling->num_token - tokenStart;
+        } else {
+            tokenWork_ = 0;
+        }
+
+        qkvGm_.SetGlobalBuffer((__gm__ T *)qkv + tokenStart * qkvCol_, tokenWork_ * qkvCol_);
+        qGm_.SetGlobalBuffer((__gm__ T *)q + tokenStart * numQHead_ * headDim_, tokenWork_ * numQHead_ * headDim_);
+        cosGm_.SetGlobalBuffer((__gm__ T *)cos + tokenStart * rotaryDim_, tokenWork_ * rotaryDim_);
+        sinGm_.SetGlobalBuffer((__gm__ T *)sin + tokenStart * rotaryDim_, tokenWork_ * rotaryDim_);
+        slotGm_.SetGlobalBuffer((__gm__ int32_t *)slotMapping + tokenStart, tokenWork_);
+        qGammaGm_.SetGlobalBuffer((__gm__ T *)qGamma, headDim_);
+        kGammaGm_.SetGlobalBuffer((__gm__ T *)kGamma, headDim_);
+        kCacheGm_.SetGlobalBuffer((__gm__ T *)kCache);
+        vCacheGm_.SetGlobalBuffer((__gm__ T *)vCache);
+
+        uint32_t headNum = numQHead_ > numKvHead_ ? numQHead_ : numKvHead_;
+        maxRow_ = tokenFactor_ * headNum;
+        uint32_t tileSize = maxRow_ * headDim_;
+        uint32_t rowAlign = (maxRow_ + ELEM_PER_BLK_FP32 - 1) / ELEM_PER_BLK_FP32 * ELEM_PER_BLK_FP32;
+        pipe_->InitBuffer(inQueue_, 1, tileSize * sizeof(T));
+        pipe_->InitBuffer(outQueue_, 1, tileSize * sizeof(T));
+        pipe_->InitBuffer(xBuf_, tileSize * sizeof(float));
+        pipe_->InitBuffer(tmpBuf_, tileSize * sizeof(float));
+        pipe_->InitBuffer(reduceBuf_, maxRow_ * ELEM_PER_REP_FP32 * sizeof(float));
+        pipe_->InitBuffer(rstdBuf_, rowAlign * sizeof(float));
+        pipe_->InitBuffer(brcbBuf_, rowAlign * FusedNorm::BRCB_ONE_BLK * sizeof(float));
+        pipe_->InitBuffer(qGammaBuf_, headDim_ * sizeof(float));
+        pipe_->InitBuffer(kGammaBuf_, headDim_ * sizeof(float));
+        pipe_->InitBuffer(cosBuf_, tokenFactor_ * rotaryDim_ * sizeof(float));
+        pipe_->InitBuffer(sinBuf_, tokenFactor_ * rotaryDim_ * sizeof(float));
+        if constexpr (ROTARY_MODE == ROTARY_MODE_INTERLEAVE) {
+            pipe_->InitBuffer(offsetBuf_, tileSize * sizeof(uint32_t));
+            pipe_->InitBuffer(signBuf_, headDim_ * sizeof(float));
+        }
+    }
+
+    __aicore__ inline void Process()
+    {
+        if (tokenWork_ == 0) {
+            return;
+        }
+        LocalTensor<T> stage = tmpBuf_.Get<T>();
+        FusedNorm::LoadChannelParam<T>(qGammaBuf_.Get<float>(), stage, qGammaGm_, headDim_);
+        FusedNorm::LoadChannelParam<T>(kGammaBuf_.Get<float>(), stage, kGammaGm_, headDim_);
+        if constexpr (ROTARY_MODE == ROTARY_MODE_INTERLEAVE) {
+            BuildInterleaveTable();
+        }
+
+        for (uint32_t tokenOffset = 0; tokenOffset < tokenWork_; tokenOffset += tokenFactor_) {
+            uint32_t tokenNum = (tokenWork_ - tokenOffset) > tokenFactor_ ? tokenFactor_ : (tokenWork_ - tokenOffset);
+            LoadRope(tokenOffset, tokenNum);
+
+            CopyInHeads(tokenOffset, tokenNum, 0, numQHead_);
+            ComputeHeads(tokenNum, numQHead_, qGammaBuf_.Get<float>());
+            CopyOutQ(tokenOffset, tokenNum);
+
+            CopyInHeads(tokenOffset, tokenNum, numQHead_ * headDim_, numKvHead_);
+            ComputeHeads(tokenNum, numKvHead_, kGammaBuf_.Get<float>());
+            ScatterK(tokenOffset, tokenNum);
+
+            ScatterV(tokenOffset, tokenNum);
+        }
+    }
+
+private:
+    /*
+     * gather offsets (bytes) swapping every (even, odd) pair inside the rotary part of each head row,
+     * and the sign row (-1, +1, ...) that turns the swapped pair into (-x1, x0).
+     */
+    __aicore__ inline void BuildInterleaveTable()
+    {
+        LocalTensor<int32_t> offsetLocal = offsetBuf_.Get<int32_t>();
+        LocalTensor<float> signLocal = signBuf_.Get<float>();
+        for (uint32_t col = 0; col < headDim_; col++) {
+            uint32_t src = col < rotaryDim_ ? (col ^ 1) : col;
+            offsetLocal.SetValue(col, static_cast<int32_t>(src * sizeof(float)));
+            signLocal.SetValue(col, (col < rotaryDim_ && (col & 1) == 0) ? -1.0f : 1.0f);
+        }
+        event_t eventSV = static_cast<event_t>(GetTPipePtr()->FetchEventID(HardEvent::S_V));
+        SetFlag<HardEvent::S_V>(eventSV);
+        WaitFlag<HardEvent::S_V>(eventSV);
+        for (uint32_t row = 1; row < maxRow_; row++) {
+            Adds(offsetLocal[row * headDim_], offsetLocal, static_cast<int32_t>(row * headDim_ * sizeof(float)),
+                headDim_);
+        }
+        PipeBarrier<PIPE_V>();
+    }
+
+    __aicore__ inline void LoadRope(uint32_t tokenOffset, uint32_t tokenNum)
+    {
+        uint32_t count = tokenNum * rotaryDim_;
+        LocalTensor<T> cosStage = tmpBuf_.Get<T>();
+        LocalTensor<T> sinStage = cosStage[tokenFactor_ * rotaryDim_];
+        event_t eventVMte2 = static_cast<event_t>(GetTPipePtr()->FetchEventID(HardEvent::V_MTE2));
+        SetFlag<HardEvent::V_MTE2>(eventVMte2);
+        WaitFlag<HardEvent::V_MTE2>(eventVMte2);
+        DataCopyExtParams copyParams{1, static_cast<uint32_t>(count * sizeof(T)), 0, 0, 0};
+        DataCopyPadExtParams<T> padParams{false, 0, 0, 0};
+        DataCopyPad(cosStage, cosGm_[tokenOffset * rotaryDim_], copyParams, padParams);
+        DataCopyPad(sinStage, sinGm_[tokenOffset * rotaryDim_], copyParams, padParams);
+        event_t eventMte2V = static_cast<event_t>(GetTPipePtr()->FetchEventID(HardEvent::MTE2_V));
+        SetFlag<HardEvent::MTE2_V>(eventMte2V);
+        WaitFlag<HardEvent::MTE2_V>(eventMte2V);
+        Cast(cosBuf_.Get<float>(), cosStage, RoundMode::CAST_NONE, count);
+        Cast(sinBuf_.Get<float>(), sinStage, RoundMode::CAST_NONE, count);
+        PipeBarrier<PIPE_V>();
+    }
+
+    __aicore__ inline void CopyInHeads(uint32_t tokenOffset, uint32_t tokenNum, uint32_t colOffset, uint32_t headNum)
+    {
+        uint32_t headBytes = headNum * headDim_ * sizeof(T);
+        LocalTensor<T> inLocal = inQueue_.template AllocTensor<T>();
+        DataCopyExtParams copyParams{static_cast<uint16_t>(tokenNum), headBytes,
+            static_cast<uint32_t>(qkvCol_ * sizeof(T) - headBytes), 0, 0};
+        DataCopyPadExtParams<T> padParams{false, 0, 0, 0};
+        DataCopyPad(inLocal, qkvGm_[static_cast<uint64_t>(tokenOffset) * qkvCol_ + colOffset], copyParams, padParams);
+        inQueue_.EnQue(inLocal);
+    }
+
+    __aicore__ inline void ComputeHeads(uint32_t tokenNum, uint32_t headNum, const LocalTensor<float> &gamma)
+    {
+        uint32_t rowNum = tokenNum * headNum;
+        uint32_t count = rowNum * headDim_;
+        LocalTensor<float> xLocal = xBuf_.Get<float>();
+        LocalTensor<float> tmpLocal = tmpBuf_.Get<float>();
+        LocalTensor<float> rstd = rstdBuf_.Get<float>();
+        LocalTensor<T> inLocal = inQueue_.template DeQue<T>();
+        Cast(xLocal, inLocal, RoundMode::CAST_NONE, count);
+        PipeBarrier<PIPE_V>();
+        inQueue_.FreeTensor(inLocal);
+
+        Mul(tmpLocal, xLocal, xLocal, count);
+        PipeBarrier<PIPE_V>();
+        ReduceSumMultiN(rstd, tmpLocal, reduceBuf_.Get<float>(), rowNum, headDim_, headDim_);
+        PipeBarrier<PIPE_V>();
+        Muls(rstd, rstd, avgFactor_, rowNum);
+        PipeBarrier<PIPE_V>();
+        Adds(rstd, rstd, epsilon_, rowNum);
+        PipeBarrier<PIPE_V>();
+        Sqrt(rstd, rstd, rowNum);
+        Duplicate(tmpLocal, 1.0f, rowNum);
+        PipeBarrier<PIPE_V>();
+        Div(rstd, tmpLocal, rstd, rowNum);
+        PipeBarrier<PIPE_V>();
+        FusedNorm::RowScalarCompute<FusedNorm::ROW_OP_MUL>(
+            xLocal, xLocal, rstd, brcbBuf_.Get<float>(), rowNum, headDim_, headDim_);
+        FusedNorm::RowBroadcastCompute<FusedNorm::ROW_OP_MUL>(xLocal, xLocal, gamma, rowNum, headDim_, headDim_);
+
+        ApplyRope(xLocal, tmpLocal, tokenNum, headNum);
+
+        LocalTensor<T> outLocal = outQueue_.template AllocTensor<T>();
+        if constexpr (FusedNorm::IsSameType<T, half>::value) {
+            Cast(outLocal, xLocal, RoundMode::CAST_NONE, count);
+        } else {
+            Cast(outLocal, xLocal, RoundMode::CAST_RINT, count);
+        }
+        PipeBarrier<PIPE_V>();
+        outQueue_.EnQue(outLocal);
+    }
+
+    /*
+     * x[:, :R] = x[:, :R] * cos + rotate(x[:, :R]) * sin, the columns behind rotaryDim pass through.
+     * cos / sin hold one row per token, shared by the headNum rows of that token (repeat stride 0).
+     */
+    __aicore__ inline void ApplyRope(
+        const LocalTensor<float> &xLocal, const LocalTensor<float> &tmpLocal, uint32_t tokenNum, uint32_t headNum)
+    {
+        uint32_t rowNum = tokenNum * headNum;
+        const uint8_t repStride = headDim_ / ELEM_PER_BLK_FP32;
+        if constexpr (ROTARY_MODE == ROTARY_MODE_HALF) {
+            uint32_t halfDim = rotaryDim_ / 2;
+            for (uint32_t rowIdx = 0; rowIdx < rowNum; rowIdx += MAX_REP_NUM) {
+                uint8_t repeat = (rowNum - rowIdx) > MAX_REP_NUM ? MAX_REP_NUM : (rowNum - rowIdx);
+                for (uint32_t colIdx = 0; colIdx < halfDim; colIdx += ELEM_PER_REP_FP32) {
+                    uint64_t mask = (halfDim - colIdx) > ELEM_PER_REP_FP32 ? ELEM_PER_REP_FP32 : (halfDim - colIdx);
+                    uint32_t offset = rowIdx * headDim_ + colIdx;
+                    Muls(tmpLocal[offset], xLocal[offset + halfDim], -1.0f, mask, repeat,
+                        {1, 1, repStride, repStride});
+                    Adds(tmpLocal[offset + halfDim], xLocal[offset], ZERO, mask, repeat, {1, 1, repStride, repStride});
+                }
+            }
+            PipeBarrier<PIPE_V>();
+        } else {
+            Gather(tmpLocal, xLocal, offsetBuf_.Get<uint32_t>(), 0, rowNum * headDim_);
+            PipeBarrier<PIPE_V>();
+            FusedNorm::RowBroadcastCompute<FusedNorm::ROW_OP_MUL>(
+                tmpLocal, tmpLocal, signBuf_.Get<float>(), rowNum, rotaryDim_, headDim_);
+        }
+
+        LocalTensor<float> cosLocal = cosBuf_.Get<float>();
+        LocalTensor<float> sinLocal = sinBuf_.Get<float>();
+        for (uint32_t tokenIdx = 0; tokenIdx < tokenNum; tokenIdx++) {
+            uint32_t base = tokenIdx * headNum * headDim_;
+            for (uint32_t colIdx = 0; colIdx < rotaryDim_; colIdx += ELEM_PER_REP_FP32) {
+                uint64_t mask = (rotaryDim_ - colIdx) > ELEM_PER_REP_FP32 ? ELEM_PER_REP_FP32 : (rotaryDim_ - colIdx);
+                BinaryRepeatParams repeatParams{1, 1, 1, repStride, repStride, 0};
+                Mul(xLocal[base + colIdx], xLocal[base + colIdx], cosLocal[tokenIdx * rotaryDim_ + colIdx], mask,
+                    headNum, repeatParams);
+                Mul(tmpLocal[base + colIdx], tmpLocal[base + colIdx], sinLocal[tokenIdx * rotaryDim_ + colIdx], mask,
+                    headNum, repeatParams);
+            }
+        }
+        PipeBarrier<PIPE_V>();
+        for (uint32_t rowIdx = 0; rowIdx < rowNum; rowIdx += MAX_REP_NUM) {
+            uint8_t repeat = (rowNum - rowIdx) > MAX_REP_NUM ? MAX_REP_NUM : (rowNum - rowIdx);
+            for (uint32_t colIdx = 0; colIdx < rotaryDim_; colIdx += ELEM_PER_REP_FP32) {
+                uint64_t mask = (rotaryDim_ - colIdx) > ELEM_PER_REP_FP32 ? ELEM_PER_REP_FP32 : (rotaryDim_ - colIdx);
+                uint32_t offset = rowIdx * headDim_ + colIdx;
+                Add(xLocal[offset], xLocal[offset], tmpLocal[offset], mask, repeat,
+                    {1, 1, 1, repStride, repStride, repStride});
+            }
+        }
+        PipeBarrier<PIPE_V>();
+    }
+
+    __aicore__ inline void CopyOutQ(uint32_t tokenOffset, uint32_t tokenNum)
+    {
+        uint32_t tokenSize = numQHead_ * headDim_;
+        LocalTensor<T> outLocal = outQueue_.template DeQue<T>();
+        DataCopyExtParams copyParams{1, static_cast<uint32_t>(tokenNum * tokenSize * sizeof(T)), 0, 0, 0};
+        DataCopyPad(qGm_[static_cast<uint64_t>(tokenOffset) * tokenSize], outLocal, copyParams);
+        outQueue_.FreeTensor(outLocal);
+    }
+
+    /*
+     * write the Nkv heads of every token to cache[slot], tokens with a slot outside [0, numSlot) are skipped.
+     */
+    __aicore__ inline void ScatterTokens(
+        const GlobalTensor<T> &cacheGm, const LocalTensor<T> &src, uint32_t tokenOffset, uint32_t tokenNum)
+    {
+        uint32_t tokenSize = numKvHead_ * headDim_;
+        DataCopyExtParams copyParams{1, static_cast<uint32_t>(tokenSize * sizeof(T)), 0, 0, 0};
+        for (uint32_t tokenIdx = 0; tokenIdx < tokenNum; tokenIdx++) {
+            int32_t slot = slotGm_.GetValue(tokenOffset + tokenIdx);
+            if (slot < 0 || static_cast<uint32_t>(slot) >= numSlot_) {
+                continue;
+            }
+            DataCopyPad(cacheGm[static_cast<uint64_t>(slot) * tokenSize], src[tokenIdx * tokenSize], copyParams);
+        }
+    }
+
+    __aicore__ inline void ScatterK(uint32_t tokenOffset, uint32_t tokenNum)
+    {
+        LocalTensor<T> outLocal = outQueue_.template DeQue<T>();
+        ScatterTokens(kCacheGm_, outLocal, tokenOffset, tokenNum);
+        outQueue_.FreeTensor(outLocal);
+    }
+
+    /*
+     * v needs no compute: GM -> UB -> cache slots through the output buffer.
+     */
+    __aicore__ inline void ScatterV(uint32_t tokenOffset, uint32_t tokenNum)
+    {
+        uint32_t headBytes = numKvHead_ * headDim_ * sizeof(T);
+        LocalTensor<T> vLocal = outQueue_.template AllocTensor<T>();
+        event_t eventMte3Mte2 = static_cast<event_t>(GetTPipePtr()->FetchEventID(HardEvent::MTE3_MTE2));
+        SetFlag<HardEvent::MTE3_MTE2>(eventMte3Mte2);
+        WaitFlag<HardEvent::MTE3_MTE2>(eventMte3Mte2);
+        DataCopyExtParams copyParams{static_cast<uint16_t>(tokenNum), headBytes,
+            static_cast<uint32_t>(qkvCol_ * sizeof(T) - headBytes), 0, 0};
+        DataCopyPadExtParams<T> padParams{false, 0, 0, 0};
+        DataCopyPad(vLocal, qkvGm_[static_cast<uint64_t>(tokenOffset) * qkvCol_ + (numQHead_ + numKvHead_) * headDim_],
+            copyParams, padParams);
+        event_t eventMte2Mte3 = static_cast<event_t>(GetTPipePtr()->FetchEventID(HardEvent::MTE2_MTE3));
+        SetFlag<HardEvent::MTE2_MTE3>(eventMte2Mte3);
+        WaitFlag<HardEvent::MTE2_MTE3>(eventMte2Mte3);
+        ScatterTokens(vCacheGm_, vLocal, tokenOffset, tokenNum);
+        event_t eventMte3V = static_cast<event_t>(GetTPipePtr()->FetchEventID(HardEvent::MTE3_V));
+        SetFlag<HardEvent::MTE3_V>(eventMte3V);
+        WaitFlag<HardEvent::MTE3_V>(eventMte3V);
+        outQueue_.FreeTensor(vLocal);
+    }
+
+private:
+    TPipe *pipe_ = nullptr;
+
+    TQue<QuePosition::VECIN, 1> inQueue_;
+    TQue<QuePosition::VECOUT, 1> outQueue_;
+    TBuf<TPosition::VECCALC> xBuf_;
+    TBuf<TPosition::VECCALC> tmpBuf_;
+    TBuf<TPosition::VECCALC> reduceBuf_;
+    TBuf<TPosition::VECCALC> rstdBuf_;
+    TBuf<TPosition::VECCALC> brcbBuf_;
+    TBuf<TPosition::VECCALC> qGammaBuf_;
+    TBuf<TPosition::VECCALC> kGammaBuf_;
+    TBuf<TPosition::VECCALC> cosBuf_;
+    TBuf<TPosition::VECCALC> sinBuf_;
+    TBuf<TPosition::VECCALC> offsetBuf_;
+    TBuf<TPosition::VECCALC> signBuf_;
+
+    GlobalTensor<T> qkvGm_;
+    GlobalTensor<T> qGm_;
+    GlobalTensor<T> cosGm_;
+    GlobalTensor<T> sinGm_;
+    GlobalTensor<T> qGammaGm_;
+    GlobalTensor<T> kGammaGm_;
+    GlobalTensor<T> kCacheGm_;
+    GlobalTensor<T> vCacheGm_;
+    GlobalTensor<int32_t> slotGm_;
+
+    uint32_t numQHead_;
+    uint32_t numKvHead_;
+    uint32_t headDim_;
+    uint32_t rotaryDim_;
+    uint32_t qkvCol_;
+    uint32_t tokenFactor_;
+    uint32_t maxRow_;
+    uint32_t numSlot_;
+    uint32_t tokenWork_ = 0;
+    float epsilon_;
+    float avgFactor_;
+};
+
+#endif  // QK_RMS_NORM_ROPE_CACHE_H_
@@ -0,0 +1,48 @@
+#!/usr/bin/python3
+# -*- coding:utf-8 -*-
+# Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+# This file is a part of the CANN Open Software.
+# Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+# ==========================================================================================================
+
+import numpy as np
+np.random.seed(5)
+
+# 与main.cpp保持一致
+VAR_SHAPE = [4, 1000]
+STEP_NUM = 10
+LR, BETA1, BETA2, WEIGHT_DECAY, EPS = 1e-3, 0.9, 0.999, 1e-2, 1e-8
+
+
+def gen_golden_data_simple():
+    var = np.random.standard_normal(VAR_SHAPE).astype(np.float32)
+    grad = np.random.standard_normal([STEP_NUM] + VAR_SHAPE).astype(np.float32)
+
+    # fp32动量的AdamW参考，m、v初始为0，与量化状态全零初始化对应；在float64下计算以排除参考自身的误差
+    golden_var = var.astype(np.float64)
+    golden_m = np.zeros(VAR_SHAPE)
+    golden_v = np.zeros(VAR_SHAPE)
+    for i in range(STEP_NUM):
+        step_t = i + 1
+        g = grad[i].astype(np.float64)
+        golden_var = golden_var * (1 - LR * WEIGHT_DECAY)
+        golden_m = golden_m + (g - golden_m) * (1 - BETA1)
+        golden_v = golden_v * BETA2 + g * g * (1 - BETA2)
+        bias_correction1 = 1 - BETA1 ** step_t
+        bias_correction2_sqrt = np.sqrt(1 - BETA2 ** step_t)
+        denom = np.sqrt(golden_v) / bias_correction2_sqrt + EPS
+        golden_var = golden_var - (LR / bias_correction1) * (golden_m / denom)
+
+    var.tofile("./input/var.bin")
+    grad.tofile("./input/grad.bin")
+    golden_var.astype(np.float32).tofile("./output/golden_var.bin")
+    golden_m.astype(np.float32).tofile("./output/golden_m.bin")
+    golden_v.astype(np.float32).tofile("./output/golden_v.bin")
+
+
+if __name__ == "__main__":
+    gen_golden_data_simple()
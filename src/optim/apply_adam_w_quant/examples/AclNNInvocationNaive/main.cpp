@@ -0,0 +1,236 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file main.cpp
+ */
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "acl/acl.h"
+#include "aclnn_apply_adam_w_quant.h"
+
+#define SUCCESS 0
+#define FAILED 1
+
+#define INFO_LOG(fmt, args...) fprintf(stdout, "[INFO]  " fmt "\n", ##args)
+#define ERROR_LOG(fmt, args...) fprintf(stderr, "[ERROR]  " fmt "\n", ##args)
+
+#define CHECK_RET(cond, return_expr) \
+    do {                             \
+        if (!(cond)) {               \
+            return_expr;             \
+        }                            \
+    } while (0)
+
+namespace {
+// 与gen_data.py保持一致：连续更新STEP_NUM步，var元素个数不是BLOCK_SIZE的整数倍，最后一个量化块不满
+constexpr int64_t STEP_NUM = 10;
+constexpr int64_t BLOCK_SIZE = 256;
+constexpr double LR = 1e-3;
+constexpr double BETA1 = 0.9;
+constexpr double BETA2 = 0.999;
+constexpr double WEIGHT_DECAY = 1e-2;
+constexpr double EPS = 1e-8;
+
+int64_t GetShapeSize(const std::vector<int64_t> &shape)
+{
+    int64_t shapeSize = 1;
+    for (auto i : shape) {
+        shapeSize *= i;
+    }
+    return shapeSize;
+}
+
+bool ReadFile(const std::string &filePath, std::vector<float> &hostData)
+{
+    std::ifstream file(filePath, std::ios::binary);
+    if (!file.is_open()) {
+        ERROR_LOG("Open file failed. path = %s", filePath.c_str());
+        return false;
+    }
+    file.read(reinterpret_cast<char *>(hostData.data()), hostData.size() * sizeof(float));
+    return static_cast<size_t>(file.gcount()) == hostData.size() * sizeof(float);
+}
+
+int WriteOutput(const std::string &filePath, size_t bytes, const void *deviceAddr)
+{
+    std::vector<uint8_t> resultData(bytes, 0);
+    auto ret = aclrtMemcpy(resultData.data(), bytes, deviceAddr, bytes, ACL_MEMCPY_DEVICE_TO_HOST);
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("copy result from device to host failed. ERROR: %d", ret); return FAILED);
+    std::ofstream file(filePath, std::ios::binary);
+    CHECK_RET(file.is_open(), ERROR_LOG("Open file failed. path = %s", filePath.c_str()); return FAILED);
+    file.write(reinterpret_cast<const char *>(resultData.data()), bytes);
+    return SUCCESS;
+}
+
+int Init(int32_t deviceId, aclrtStream *stream)
+{
+    // 固定写法，acl初始化
+    auto ret = aclInit(nullptr);
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("aclInit failed. ERROR: %d", ret); return FAILED);
+    ret = aclrtSetDevice(deviceId);
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("aclrtSetDevice failed. ERROR: %d", ret); return FAILED);
+    ret = aclrtCreateStream(stream);
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("aclrtCreateStream failed. ERROR: %d", ret); return FAILED);
+    return SUCCESS;
+}
+
+// hostData为空时device内存置0，对应首次使用时全零的量化状态
+int CreateAclTensor(const void *hostData, const std::vector<int64_t> &shape, aclDataType dataType, size_t typeSize,
+                    void **deviceAddr, aclTensor **tensor)
+{
+    auto size = GetShapeSize(shape) * typeSize;
+    auto ret = aclrtMalloc(deviceAddr, size, ACL_MEM_MALLOC_HUGE_FIRST);
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("aclrtMalloc failed. ERROR: %d", ret); return FAILED);
+    if (hostData != nullptr) {
+        ret = aclrtMemcpy(*deviceAddr, size, hostData, size, ACL_MEMCPY_HOST_TO_DEVICE);
+        CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("aclrtMemcpy failed. ERROR: %d", ret); return FAILED);
+    } else {
+        ret = aclrtMemset(*deviceAddr, size, 0, size);
+        CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("aclrtMemset failed. ERROR: %d", ret); return FAILED);
+    }
+    *tensor = aclCreateTensor(shape.data(), shape.size(), dataType, nullptr, 0, aclFormat::ACL_FORMAT_ND,
+                              shape.data(), shape.size(), *deviceAddr);
+    return SUCCESS;
+}
+
+// 多次调用共用一块workspace，不足时重新申请
+int PrepareWorkspace(uint64_t workspaceSize, void **workspaceAddr, uint64_t &workspaceCap)
+{
+    if (workspaceSize <= workspaceCap) {
+        return SUCCESS;
+    }
+    if (*workspaceAddr != nullptr) {
+        aclrtFree(*workspaceAddr);
+    }
+    auto ret = aclrtMalloc(workspaceAddr, workspaceSize, ACL_MEM_MALLOC_HUGE_FIRST);
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("allocate workspace failed. ERROR: %d", ret); return FAILED);
+    workspaceCap = workspaceSize;
+    return SUCCESS;
+}
+}  // namespace
+
+int main(int argc, char **argv)
+{
+    // 1. （固定写法）device/stream初始化, 参考acl对外接口列表
+    int32_t deviceId = 0;
+    aclrtStream stream;
+    auto ret = Init(deviceId, &stream);
+    CHECK_RET(ret == SUCCESS, ERROR_LOG("Init acl failed. ERROR: %d", ret); return FAILED);
+
+    // 2. 构造输入，var为float32，m/v为int8且初始全零，每个量化块一个float32的scale
+    std::vector<int64_t> varShape = {4, 1000};
+    int64_t varSize = GetShapeSize(varShape);
+    std::vector<int64_t> scaleShape = {(varSize + BLOCK_SIZE - 1) / BLOCK_SIZE};
+    std::vector<int64_t> stepShape = {1};
+    std::vector<float> varHostData(varSize);
+    std::vector<float> gradHostData(STEP_NUM * varSize);
+    CHECK_RET(ReadFile("../input/var.bin", varHostData), return FAILED);
+    CHECK_RET(ReadFile("../input/grad.bin", gradHostData), return FAILED);
+
+    void *varDeviceAddr = nullptr;
+    void *mDeviceAddr = nullptr;
+    void *vDeviceAddr = nullptr;
+    void *mScaleDeviceAddr = nullptr;
+    void *vScaleDeviceAddr = nullptr;
+    aclTensor *var = nullptr;
+    aclTensor *m = nullptr;
+    aclTensor *v = nullptr;
+    aclTensor *mScale = nullptr;
+    aclTensor *vScale = nullptr;
+    ret = CreateAclTensor(varHostData.data(), varShape, aclDataType::ACL_FLOAT, sizeof(float), &varDeviceAddr, &var);
+    CHECK_RET(ret == SUCCESS, return FAILED);
+    ret = CreateAclTensor(nullptr, varShape, aclDataType::ACL_INT8, sizeof(int8_t), &mDeviceAddr, &m);
+    CHECK_RET(ret == SUCCESS, return FAILED);
+    ret = CreateAclTensor(nullptr, varShape, aclDataType::ACL_INT8, sizeof(int8_t), &vDeviceAddr, &v);
+    CHECK_RET(ret == SUCCESS, return FAILED);
+    ret = CreateAclTensor(nullptr, scaleShape, aclDataType::ACL_FLOAT, sizeof(float), &mScaleDeviceAddr, &mScale);
+    CHECK_RET(ret == SUCCESS, return FAILED);
+    ret = CreateAclTensor(nullptr, scaleShape, aclDataType::ACL_FLOAT, sizeof(float), &vScaleDeviceAddr, &vScale);
+    CHECK_RET(ret == SUCCESS, return FAILED);
+
+    // 每步的grad与step各自独立，step为已完成的更新次数，算子内部加1
+    std::vector<void *> gradDeviceAddrs(STEP_NUM, nullptr);
+    std::vector<void *> stepDeviceAddrs(STEP_NUM, nullptr);
+    std::vector<aclTensor *> grads(STEP_NUM, nullptr);
+    std::vector<aclTensor *> steps(STEP_NUM, nullptr);
+    for (int64_t i = 0; i < STEP_NUM; i++) {
+        float stepValue = static_cast<float>(i);
+        ret = CreateAclTensor(gradHostData.data() + i * varSize, varShape, aclDataType::ACL_FLOAT, sizeof(float),
+                              &gradDeviceAddrs[i], &grads[i]);
+        CHECK_RET(ret == SUCCESS, return FAILED);
+        ret = CreateAclTensor(&stepValue, stepShape, aclDataType::ACL_FLOAT, sizeof(float), &stepDeviceAddrs[i],
+                              &steps[i]);
+        CHECK_RET(ret == SUCCESS, return FAILED);
+    }
+
+    // 3. 连续调用STEP_NUM次，m/v/scale均原地更新，全程以int8状态在步间传递
+    void *workspaceAddr = nullptr;
+    uint64_t workspaceCap = 0;
+    uint64_t workspaceSize = 0;
+    aclOpExecutor *executor = nullptr;
+    for (int64_t i = 0; i < STEP_NUM; i++) {
+        ret = aclnnApplyAdamWQuantGetWorkspaceSize(var, m, v, mScale, vScale, grads[i], steps[i], LR, BETA1, BETA2,
+                                                   WEIGHT_DECAY, EPS, false, BLOCK_SIZE, &workspaceSize, &executor);
+        CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("aclnnApplyAdamWQuantGetWorkspaceSize failed. ERROR: %d", ret);
+                  return FAILED);
+        CHECK_RET(PrepareWorkspace(workspaceSize, &workspaceAddr, workspaceCap) == SUCCESS, return FAILED);
+        ret = aclnnApplyAdamWQuant(workspaceAddr, workspaceSize, executor, stream);
+        CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("aclnnApplyAdamWQuant failed. ERROR: %d", ret); return FAILED);
+    }
+
+    // 4. （固定写法）同步等待任务执行结束
+    ret = aclrtSynchronizeStream(stream);
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("aclrtSynchronizeStream failed. ERROR: %d", ret); return FAILED);
+
+    // 5. 写出var与量化状态，由verify_result.py反量化后与fp32 AdamW参考比对
+    int64_t scaleSize = GetShapeSize(scaleShape);
+    ret = WriteOutput("../output/output_var.bin", varSize * sizeof(float), varDeviceAddr);
+    CHECK_RET(ret == SUCCESS, return FAILED);
+    ret = WriteOutput("../output/output_m.bin", varSize * sizeof(int8_t), mDeviceAddr);
+    CHECK_RET(ret == SUCCESS, return FAILED);
+    ret = WriteOutput("../output/output_v.bin", varSize * sizeof(int8_t), vDeviceAddr);
+    CHECK_RET(ret == SUCCESS, return FAILED);
+    ret = WriteOutput("../output/output_m_scale.bin", scaleSize * sizeof(float), mScaleDeviceAddr);
+    CHECK_RET(ret == SUCCESS, return FAILED);
+    ret = WriteOutput("../output/output_v_scale.bin", scaleSize * sizeof(float), vScaleDeviceAddr);
+    CHECK_RET(ret == SUCCESS, return FAILED);
+    INFO_LOG("Write output success");
+
+    // 6. 释放aclTensor与device资源
+    for (int64_t i = 0; i < STEP_NUM; i++) {
+        aclDestroyTensor(grads[i]);
+        aclDestroyTensor(steps[i]);
+        aclrtFree(gradDeviceAddrs[i]);
+        aclrtFree(stepDeviceAddrs[i]);
+    }
+    aclDestroyTensor(var);
+    aclDestroyTensor(m);
+    aclDestroyTensor(v);
+    aclDestroyTensor(mScale);
+    aclDestroyTensor(vScale);
+    aclrtFree(varDeviceAddr);
+    aclrtFree(mDeviceAddr);
+    aclrtFree(vDeviceAddr);
+    aclrtFree(mScaleDeviceAddr);
+    aclrtFree(vScaleDeviceAddr);
+    if (workspaceAddr != nullptr) {
+        aclrtFree(workspaceAddr);
+    }
+    aclrtDestroyStream(stream);
+    aclrtResetDevice(deviceId);
+    aclFinalize();
+
+    return SUCCESS;
+}
@@ -0,0 +1,71 @@
+#!/usr/bin/python3
+# -*- coding:utf-8 -*-
+# Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+# This file is a part of the CANN Open Software.
+# Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+# ==========================================================================================================
+
+import sys
+import numpy as np
+
+BLOCK_SIZE = 256
+INT8_MAX = 127
+# var与fp32参考的绝对误差上限，取一步的lr：量化误差只改变每步更新量的一小部分，10步累积远小于一步
+VAR_LOSS = 1e-3
+# 反量化后的m、sqrt(v)与fp32参考的误差，按每个量化块的绝对值最大值归一化；
+# 单步重新量化的舍入误差为1/254，多步间误差经beta衰减后累积，10步约为2e-2
+STATE_LOSS = 5e-2
+
+
+def block_max(x):
+    pad = (-x.size) % BLOCK_SIZE
+    return np.abs(np.pad(x, (0, pad))).reshape(-1, BLOCK_SIZE).max(axis=1)
+
+
+def check_quant_state(name, q, scale, golden):
+    # 重新量化按块取绝对值最大值，非零块内|q|的最大值必为127
+    q_max = block_max(q.astype(np.int32))
+    if np.any((scale > 0) != (q_max == INT8_MAX)) or np.any(q_max > INT8_MAX):
+        print("[ERROR] %s is not requantized with the per-block absmax" % name)
+        return False
+    dequant = q.astype(np.float32) * np.repeat(scale, BLOCK_SIZE)[:q.size]
+    golden_max = block_max(golden)
+    error = block_max(dequant - golden) / np.maximum(golden_max, 1e-30)
+    if np.any(error > STATE_LOSS):
+        print("[ERROR] %s dequantized error %.4g exceeds %g of the block absmax" % (name, error.max(), STATE_LOSS))
+        return False
+    return True
+
+
+def verify_result(output_dir):
+    var = np.fromfile(output_dir + "/output_var.bin", dtype=np.float32)
+    golden_var = np.fromfile(output_dir + "/golden_var.bin", dtype=np.float32)
+    if var.size != golden_var.size:
+        print("[ERROR] result size %d not equal to golden size %d" % (var.size, golden_var.size))
+        return False
+    var_error = np.abs(var - golden_var).max()
+    if var_error > VAR_LOSS:
+        print("[ERROR] var error %.4g exceeds %g" % (var_error, VAR_LOSS))
+        return False
+
+    m = np.fromfile(output_dir + "/output_m.bin", dtype=np.int8)
+    v = np.fromfile(output_dir + "/output_v.bin", dtype=np.int8)
+    m_scale = np.fromfile(output_dir + "/output_m_scale.bin", dtype=np.float32)
+    v_scale = np.fromfile(output_dir + "/output_v_scale.bin", dtype=np.float32)
+    golden_m = np.fromfile(output_dir + "/golden_m.bin", dtype=np.float32)
+    golden_v = np.fromfile(output_dir + "/golden_v.bin", dtype=np.float32)
+    if np.any(v < 0):
+        print("[ERROR] v is quantized in the sqrt domain and must be non-negative")
+        return False
+    # v在开方域量化，与参考的sqrt(v)比对
+    return check_quant_state("m", m, m_scale, golden_m) and \
+        check_quant_state("sqrt(v)", v, v_scale, np.sqrt(golden_v))
+
+
+if __name__ == '__main__':
+    if verify_result(sys.argv[1] if len(sys.argv) > 1 else "output"):
+        print("test pass")
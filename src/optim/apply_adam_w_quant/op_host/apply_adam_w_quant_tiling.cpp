@@ -0,0 +1,223 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file apply_adam_w_quant_tiling.cpp
+ * \brief
+ */
+#include "apply_adam_w_quant_tiling.h"
+#include "error/ops_error.h"
+
+using namespace std;
+namespace optiling {
+constexpr uint32_t INPUT_VAR_IDX = 0;
+constexpr uint32_t INPUT_M_IDX = 1;
+constexpr uint32_t INPUT_V_IDX = 2;
+constexpr uint32_t INPUT_M_SCALE_IDX = 3;
+constexpr uint32_t INPUT_V_SCALE_IDX = 4;
+constexpr uint32_t INPUT_GRAD_IDX = 5;
+constexpr uint32_t INPUT_STEP_IDX = 6;
+constexpr uint32_t ATTR_LR_IDX = 0;
+constexpr uint32_t ATTR_BETA1_IDX = 1;
+constexpr uint32_t ATTR_BETA2_IDX = 2;
+constexpr uint32_t ATTR_WEIGHT_DECAY_IDX = 3;
+constexpr uint32_t ATTR_EPS_IDX = 4;
+constexpr uint32_t ATTR_MAXIMIZE_IDX = 5;
+constexpr uint32_t ATTR_BLOCK_SIZE_IDX = 6;
+
+constexpr uint64_t BYTE_ONE_BLK = 32;
+constexpr uint64_t BUFFER_NUM = 2;
+constexpr uint64_t FP32_DTYPE_SIZE = 4;
+constexpr uint64_t INT8_DTYPE_SIZE = 1;
+// var/grad/m/v 以及一块临时空间, 均以fp32参与计算
+constexpr uint64_t FP32_CALC_BUF_NUM = 5;
+// m/v 量化时 fp32->int32->half->int8 的中间结果
+constexpr uint64_t QUANT_CAST_BUF_SIZE = 4;
+// 每个量化块的 m_scale/v_scale 入队、出队以及块内 absmax 结果(32B对齐)
+constexpr uint64_t SCALE_BYTES_PER_BLOCK = 2 * BUFFER_NUM * FP32_DTYPE_SIZE * 2 + BYTE_ONE_BLK * 2;
+constexpr uint64_t RESERVED_UB_SIZE = 16 * 1024;
+constexpr uint64_t MAX_BLOCKS_PER_LOOP = 64;
+
+constexpr uint64_t TILING_KEY_BF16_STEP_FLOAT = 101;
+constexpr uint64_t TILING_KEY_BF16_STEP_INT64 = 102;
+constexpr uint64_t TILING_KEY_FP16_STEP_FLOAT = 103;
+constexpr uint64_t TILING_KEY_FP16_STEP_INT64 = 104;
+constexpr uint64_t TILING_KEY_FP32_STEP_FLOAT = 105;
+constexpr uint64_t TILING_KEY_FP32_STEP_INT64 = 106;
+
+static inline uint64_t CeilDiv(uint64_t value, uint64_t factor) {
+    return factor == 0 ? value : (value + factor - 1) / factor;
+}
+
+static void PrintTilingData(const gert::TilingContext* context, ApplyAdamWQuantTilingData& tilingData) {
+    auto nodeName = context->GetNodeName();
+    OPS_LOG_D(nodeName, "totalDataNum is %lu.", tilingData.get_totalDataNum());
+    OPS_LOG_D(nodeName, "blockSize is %lu.", tilingData.get_blockSize());
+    OPS_LOG_D(nodeName, "blockNum is %lu.", tilingData.get_blockNum());
+    OPS_LOG_D(nodeName, "usedCoreNum is %lu.", tilingData.get_usedCoreNum());
+    OPS_LOG_D(nodeName, "blockFactor is %lu.", tilingData.get_blockFactor());
+    OPS_LOG_D(nodeName, "tailCoreBlockNum is %lu.", tilingData.get_tailCoreBlockNum());
+    OPS_LOG_D(nodeName, "blocksPerLoop is %lu.", tilingData.get_blocksPerLoop());
+    OPS_LOG_D(nodeName, "lastBlockDataNum is %lu.", tilingData.get_lastBlockDataNum());
+    OPS_LOG_D(nodeName, "tilingKey is %lu.", context->GetTilingKey());
+}
+
+static ge::graphStatus GetTilingAttr(const gert::TilingContext* context, ApplyAdamWQuantTilingData& tilingData) {
+    auto* attrs = context->GetAttrs();
+    OPS_LOG_E_IF_NULL(context, attrs, return ge::GRAPH_FAILED);
+    const float* attrLr = attrs->GetAttrPointer<float>(ATTR_LR_IDX);
+    OPS_LOG_E_IF_NULL(context, attrLr, return ge::GRAPH_FAILED);
+    tilingData.set_lr(*attrLr);
+    const float* attrBeta1 = attrs->GetAttrPointer<float>(ATTR_BETA1_IDX);
+    OPS_LOG_E_IF_NULL(context, attrBeta1, return ge::GRAPH_FAILED);
+    tilingData.set_beta1(*attrBeta1);
+    const float* attrBeta2 = attrs->GetAttrPointer<float>(ATTR_BETA2_IDX);
+    OPS_LOG_E_IF_NULL(context, attrBeta2, return ge::GRAPH_FAILED);
+    tilingData.set_beta2(*attrBeta2);
+    const float* attrWeightDecay = attrs->GetAttrPointer<float>(ATTR_WEIGHT_DECAY_IDX);
+    OPS_LOG_E_IF_NULL(context, attrWeightDecay, return ge::GRAPH_FAILED);
+    tilingData.set_weightDecay(*attrWeightDecay);
+    const float* attrEps = attrs->GetAttrPointer<float>(ATTR_EPS_IDX);
+    OPS_LOG_E_IF_NULL(context, attrEps, return ge::GRAPH_FAILED);
+    tilingData.set_eps(*attrEps);
+    const bool* attrMaximize = attrs->GetAttrPointer<bool>(ATTR_MAXIMIZE_IDX);
+    OPS_LOG_E_IF_NULL(context, attrMaximize, return ge::GRAPH_FAILED);
+    tilingData.set_maximize(*attrMaximize ? 1 : 0);
+
+    const int64_t* attrBlockSize = attrs->GetAttrPointer<int64_t>(ATTR_BLOCK_SIZE_IDX);
+    OPS_LOG_E_IF_NULL(context, attrBlockSize, return ge::GRAPH_FAILED);
+    // 量化块在UB内需要以int8/fp32两种类型切片, 块长需32元素对齐以保证各切片起始地址32B对齐
+    OPS_CHECK(*attrBlockSize <= 0 || *attrBlockSize % static_cast<int64_t>(BYTE_ONE_BLK) != 0,
+              OPS_REPORT_VECTOR_INNER_ERR(context->GetNodeName(),
+                                          "block_size should be a positive multiple of 32, currently is %ld.",
+                                          *attrBlockSize),
+              return ge::GRAPH_FAILED);
+    tilingData.set_blockSize(static_cast<uint64_t>(*attrBlockSize));
+    return ge::GRAPH_SUCCESS;
+}
+
+static ge::graphStatus CheckInputs(const gert::TilingContext* context, uint64_t blockNum) {
+    auto varShapePtr = context->GetInputShape(INPUT_VAR_IDX);
+    OPS_LOG_E_IF_NULL(context, varShapePtr, return ge::GRAPH_FAILED);
+    auto varShape = varShapePtr->GetStorageShape();
+    for (uint32_t idx : {INPUT_M_IDX, INPUT_V_IDX, INPUT_GRAD_IDX}) {
+        auto shapePtr = context->GetInputShape(idx);
+        OPS_LOG_E_IF_NULL(context, shapePtr, return ge::GRAPH_FAILED);
+        OPS_CHECK(shapePtr->GetStorageShape() != varShape,
+                  OPS_REPORT_VECTOR_INNER_ERR(context->GetNodeName(), "var, m, v and grad should have same shape."),
+                  return ge::GRAPH_FAILED);
+    }
+    for (uint32_t idx : {INPUT_M_SCALE_IDX, INPUT_V_SCALE_IDX}) {
+        auto shapePtr = context->GetInputShape(idx);
+        OPS_LOG_E_IF_NULL(context, shapePtr, return ge::GRAPH_FAILED);
+        uint64_t scaleNum = shapePtr->GetStorageShape().GetShapeSize();
+        OPS_CHECK(scaleNum != blockNum,
+                  OPS_REPORT_VECTOR_INNER_ERR(context->GetNodeName(),
+                                              "m_scale and v_scale should have ceil(var.numel / block_size) = %lu "
+                                              "elements, currently is %lu.", blockNum, scaleNum),
+                  return ge::GRAPH_FAILED);
+    }
+    auto varDesc = context->GetInputDesc(INPUT_VAR_IDX);
+    OPS_LOG_E_IF_NULL(context, varDesc, return ge::GRAPH_FAILED);
+    auto gradDesc = context->GetInputDesc(INPUT_GRAD_IDX);
+    OPS_LOG_E_IF_NULL(context, gradDesc, return ge::GRAPH_FAILED);
+    OPS_CHECK(varDesc->GetDataType() != gradDesc->GetDataType(),
+              OPS_REPORT_VECTOR_INNER_ERR(context->GetNodeName(), "var and grad should have same dtype."),
+              return ge::GRAPH_FAILED);
+    auto stepShapePtr = context->GetInputShape(INPUT_STEP_IDX);
+    OPS_LOG_E_IF_NULL(context, stepShapePtr, return ge::GRAPH_FAILED);
+    OPS_CHECK(stepShapePtr->GetStorageShape().GetShapeSize() != 1,
+              OPS_REPORT_VECTOR_INNER_ERR(context->GetNodeName(), "step should have only one element."),
+              return ge::GRAPH_FAILED);
+    return ge::GRAPH_SUCCESS;
+}
+
+static uint64_t GetTilingKey(ge::DataType varDtype, ge::DataType stepDtype) {
+    bool isStepFloat = stepDtype == ge::DT_FLOAT;
+    if (varDtype == ge::DT_BF16) {
+        return isStepFloat ? TILING_KEY_BF16_STEP_FLOAT : TILING_KEY_BF16_STEP_INT64;
+    } else if (varDtype == ge::DT_FLOAT16) {
+        return isStepFloat ? TILING_KEY_FP16_STEP_FLOAT : TILING_KEY_FP16_STEP_INT64;
+    }
+    return isStepFloat ? TILING_KEY_FP32_STEP_FLOAT : TILING_KEY_FP32_STEP_INT64;
+}
+
+ge::graphStatus Tiling4ApplyAdamWQuant(gert::TilingContext* context) {
+    ApplyAdamWQuantTilingData tilingData;
+    OPS_CHECK(GetTilingAttr(context, tilingData) != ge::GRAPH_SUCCESS,
+              OPS_REPORT_VECTOR_INNER_ERR(context->GetNodeName(), "get attr failed."), return ge::GRAPH_FAILED);
+
+    auto varShapePtr = context->GetInputShape(INPUT_VAR_IDX);
+    OPS_LOG_E_IF_NULL(context, varShapePtr, return ge::GRAPH_FAILED);
+    uint64_t totalDataNum = varShapePtr->GetStorageShape().GetShapeSize();
+    // 空tensor没有可分核的量化块, 直接报错, 避免blockNum为0时尾块元素数下溢
+    OPS_CHECK(totalDataNum == 0,
+              OPS_REPORT_VECTOR_INNER_ERR(context->GetNodeName(), "var is an empty tensor, which is not supported."),
+              return ge::GRAPH_FAILED);
+    uint64_t blockSize = tilingData.get_blockSize();
+    uint64_t blockNum = CeilDiv(totalDataNum, blockSize);
+    OPS_CHECK(CheckInputs(context, blockNum) != ge::GRAPH_SUCCESS,
+              OPS_REPORT_VECTOR_INNER_ERR(context->GetNodeName(), "input check failed."), return ge::GRAPH_FAILED);
+
+    auto varDtype = context->GetInputDesc(INPUT_VAR_IDX)->GetDataType();
+    auto stepDtype = context->GetInputDesc(INPUT_STEP_IDX)->GetDataType();
+    uint64_t dtypeSize = ge::GetSizeByDataType(varDtype);
+    context->SetTilingKey(GetTilingKey(varDtype, stepDtype));
+
+    auto ascendcPlatform = platform_ascendc::PlatformAscendC(context->GetPlatformInfo());
+    uint64_t coreNum = ascendcPlatform.GetCoreNumAiv();
+    uint64_t ubSize;
+    ascendcPlatform.GetCoreMemSize(platform_ascendc::CoreMemType::UB, ubSize);
+
+    // 以量化块为粒度分核, 保证同一个块的 absmax 只在一个核内求取
+    uint64_t blockFactor = CeilDiv(blockNum, coreNum);
+    uint64_t usedCoreNum = CeilDiv(blockNum, blockFactor);
+    uint64_t tailCoreBlockNum = blockNum - (usedCoreNum - 1) * blockFactor;
+
+    // 单个元素的UB开销: var/grad 与 int8 m/v 的搬入(double buffer), var 与 int8 m/v 的搬出(double buffer),
+    // 以及 fp32 计算空间和量化cast中间空间
+    uint64_t bytesPerElem = (dtypeSize * 2 + INT8_DTYPE_SIZE * 2) * BUFFER_NUM +
+                            (dtypeSize + INT8_DTYPE_SIZE * 2) * BUFFER_NUM +
+                            FP32_DTYPE_SIZE * FP32_CALC_BUF_NUM + QUANT_CAST_BUF_SIZE;
+    uint64_t bytesPerBlock = bytesPerElem * blockSize + SCALE_BYTES_PER_BLOCK;
+    OPS_CHECK(ubSize <= RESERVED_UB_SIZE + bytesPerBlock,
+              OPS_REPORT_VECTOR_INNER_ERR(context->GetNodeName(), "block_size %lu is too large for UB.", blockSize),
+              return ge::GRAPH_FAILED);
+    uint64_t blocksPerLoop = (ubSize - RESERVED_UB_SIZE) / bytesPerBlock;
+    blocksPerLoop = std::min(std::min(blocksPerLoop, MAX_BLOCKS_PER_LOOP), blockFactor);
+
+    tilingData.set_totalDataNum(totalDataNum);
+    tilingData.set_blockNum(blockNum);
+    tilingData.set_usedCoreNum(usedCoreNum);
+    tilingData.set_blockFactor(blockFactor);
+    tilingData.set_tailCoreBlockNum(tailCoreBlockNum);
+    tilingData.set_blocksPerLoop(blocksPerLoop);
+    tilingData.set_lastBlockDataNum(totalDataNum - (blockNum - 1) * blockSize);
+
+    context->SetBlockDim(usedCoreNum);
+    tilingData.SaveToBuffer(context->GetRawTilingData()->GetData(), context->GetRawTilingData()->GetCapacity());
+    context->GetRawTilingData()->SetDataSize(tilingData.GetDataSize());
+    size_t* workspaces = context->GetWorkspaceSizes(1);
+    OPS_LOG_E_IF_NULL(context, workspaces, return ge::GRAPH_FAILED);
+    workspaces[0] = ascendcPlatform.GetLibApiWorkSpaceSize();
+    PrintTilingData(context, tilingData);
+    return ge::GRAPH_SUCCESS;
+}
+
+ge::graphStatus TilingPrepare4ApplyAdamWQuant(gert::TilingParseContext* context) {
+    return ge::GRAPH_SUCCESS;
+}
+
+struct ApplyAdamWQuantCompileInfo {};
+
+IMPL_OP_OPTILING(ApplyAdamWQuant)
+    .Tiling(Tiling4ApplyAdamWQuant)
+    .TilingParse<ApplyAdamWQuantCompileInfo>(TilingPrepare4ApplyAdamWQuant);
+} // namespace optiling
@@ -0,0 +1,45 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file apply_adam_w_quant_tiling.h
+ * \brief
+ */
+#ifndef TILING_RUNTIME_APPLY_ADAM_W_QUANT_H_
+#define TILING_RUNTIME_APPLY_ADAM_W_QUANT_H_
+
+#include "register/op_def_registry.h"
+#include "register/tilingdata_base.h"
+#include "platform/platform_info.h"
+#include "tiling/tiling_api.h"
+
+namespace optiling {
+
+BEGIN_TILING_DATA_DEF(ApplyAdamWQuantTilingData)
+    TILING_DATA_FIELD_DEF(float, lr);
+    TILING_DATA_FIELD_DEF(float, beta1);
+    TILING_DATA_FIELD_DEF(float, beta2);
+    TILING_DATA_FIELD_DEF(float, weightDecay);
+    TILING_DATA_FIELD_DEF(float, eps);
+    TILING_DATA_FIELD_DEF(uint64_t, maximize);
+
+    TILING_DATA_FIELD_DEF(uint64_t, totalDataNum);
+    TILING_DATA_FIELD_DEF(uint64_t, blockSize);         // 每个量化块包含的元素个数
+    TILING_DATA_FIELD_DEF(uint64_t, blockNum);          // 量化块总数, 即m_scale/v_scale的元素个数
+    TILING_DATA_FIELD_DEF(uint64_t, usedCoreNum);
+    TILING_DATA_FIELD_DEF(uint64_t, blockFactor);       // 非尾核处理的量化块个数
+    TILING_DATA_FIELD_DEF(uint64_t, tailCoreBlockNum);  // 尾核处理的量化块个数
+    TILING_DATA_FIELD_DEF(uint64_t, blocksPerLoop);     // 单次loop处理的量化块个数
+    TILING_DATA_FIELD_DEF(uint64_t, lastBlockDataNum);  // 最后一个量化块的实际元素个数
+END_TILING_DATA_DEF;
+REGISTER_TILING_DATA_CLASS(ApplyAdamWQuant, ApplyAdamWQuantTilingData)
+
+}  // namespace optiling
+#endif // TILING_RUNTIME_APPLY_ADAM_W_QUANT_H_
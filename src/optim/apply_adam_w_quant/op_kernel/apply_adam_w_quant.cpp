@@ -0,0 +1,56 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file apply_adam_w_quant.cpp
+ * \brief
+ */
+
+#include "apply_adam_w_quant.h"
+
+using namespace ApplyAdamWQuantNs;
+extern "C" __global__ __aicore__ void apply_adam_w_quant(GM_ADDR var, GM_ADDR m, GM_ADDR v, GM_ADDR m_scale,
+                                                         GM_ADDR v_scale, GM_ADDR grad, GM_ADDR step, GM_ADDR var_ref,
+                                                         GM_ADDR m_ref, GM_ADDR v_ref, GM_ADDR m_scale_ref,
+                                                         GM_ADDR v_scale_ref, GM_ADDR workspace, GM_ADDR tiling) {
+    GET_TILING_DATA(tilingData, tiling);
+    TPipe pipe;
+    if (TILING_KEY_IS(101)) {
+        ApplyAdamWQuant<bfloat16_t, float> op;
+        op.Init(var, m, v, m_scale, v_scale, grad, step, var_ref, m_ref, v_ref, m_scale_ref, v_scale_ref,
+                &tilingData, &pipe);
+        op.Process();
+    } else if (TILING_KEY_IS(102)) {
+        ApplyAdamWQuant<bfloat16_t, int64_t> op;
+        op.Init(var, m, v, m_scale, v_scale, grad, step, var_ref, m_ref, v_ref, m_scale_ref, v_scale_ref,
+                &tilingData, &pipe);
+        op.Process();
+    } else if (TILING_KEY_IS(103)) {
+        ApplyAdamWQuant<half, float> op;
+        op.Init(var, m, v, m_scale, v_scale, grad, step, var_ref, m_ref, v_ref, m_scale_ref, v_scale_ref,
+                &tilingData, &pipe);
+        op.Process();
+    } else if (TILING_KEY_IS(104)) {
+        ApplyAdamWQuant<half, int64_t> op;
+        op.Init(var, m, v, m_scale, v_scale, grad, step, var_ref, m_ref, v_ref, m_scale_ref, v_scale_ref,
+                &tilingData, &pipe);
+        op.Process();
+    } else if (TILING_KEY_IS(105)) {
+        ApplyAdamWQuant<float, float> op;
+        op.Init(var, m, v, m_scale, v_scale, grad, step, var_ref, m_ref, v_ref, m_scale_ref, v_scale_ref,
+                &tilingData, &pipe);
+        op.Process();
+    } else if (TILING_KEY_IS(106)) {
+        ApplyAdamWQuant<float, int64_t> op;
+        op.Init(var, m, v, m_scale, v_scale, grad, step, var_ref, m_ref, v_ref, m_scale_ref, v_scale_ref,
+                &tilingData, &pipe);
+        op.Process();
+    }
+}
@@ -0,0 +1,408 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file apply_adam_w_quant.h
+ * \brief AdamW with blockwise int8 optimizer states.
+ *
+ * m is stored as symmetric int8 with one fp32 scale per block: m = q_m * m_scale.
+ * v is stored in the sqrt domain, i.e. sqrt(v) = q_v * v_scale, which keeps the dynamic range of small second
+ * moments and lets the update reuse sqrt(v) directly as the denominator. Both states are dequantized in UB,
+ * updated in fp32 and requantized with a fresh per-block absmax before being written back in the same pass.
+ */
+
+#ifndef APPLY_ADAM_W_QUANT_H
+#define APPLY_ADAM_W_QUANT_H
+
+#include "kernel_operator.h"
+
+namespace ApplyAdamWQuantNs {
+using namespace AscendC;
+constexpr int32_t BUFFER_NUM = 2;
+constexpr int32_t BYTE_ONE_BLOCK = 32;
+constexpr int32_t BLOCK_SIZE_FOR_FLOAT32 = 8;
+constexpr int32_t FP32_CALC_BUF_NUM = 5;
+constexpr float INT8_MAX_VALUE = 127.0f;
+constexpr float INT8_MAX_RECIPROCAL = 1.0f / 127.0f;
+
+template <typename T, typename U>
+class ApplyAdamWQuant {
+public:
+    __aicore__ inline ApplyAdamWQuant(){};
+    __aicore__ inline void Init(GM_ADDR var, GM_ADDR m, GM_ADDR v, GM_ADDR mScale, GM_ADDR vScale, GM_ADDR grad,
+                                GM_ADDR step, GM_ADDR varRef, GM_ADDR mRef, GM_ADDR vRef, GM_ADDR mScaleRef,
+                                GM_ADDR vScaleRef, const ApplyAdamWQuantTilingData* tilingData, TPipe* pipe);
+    __aicore__ inline void Process();
+
+protected:
+    __aicore__ inline void ParseTilingData(const ApplyAdamWQuantTilingData* tilingData);
+    __aicore__ inline void CopyIn(uint64_t blockOffset, uint64_t blockCount, uint64_t dataCount);
+    __aicore__ inline void Compute(uint64_t blockOffset, uint64_t blockCount, uint64_t dataCount);
+    __aicore__ inline void CopyOut(uint64_t blockOffset, uint64_t blockCount, uint64_t dataCount);
+    __aicore__ inline void Dequant(const LocalTensor<float>& dst, const LocalTensor<int8_t>& src,
+                                   const LocalTensor<float>& scale, uint64_t blockCount, uint64_t dataCount);
+    __aicore__ inline void Quant(const LocalTensor<int8_t>& dst, const LocalTensor<float>& scale,
+                                 const LocalTensor<float>& src, bool isNonNegative, uint64_t blockOffset,
+                                 uint64_t blockCount, uint64_t dataCount);
+    __aicore__ inline uint64_t BlockDataCount(uint64_t globalBlockIdx);
+    __aicore__ inline float ScalarPow(float x, float y);
+
+private:
+    TPipe* pipe_ = nullptr;
+    TQue<QuePosition::VECIN, BUFFER_NUM> inQueue_;
+    TQue<QuePosition::VECIN, BUFFER_NUM> scaleInQueue_;
+    TQue<QuePosition::VECOUT, BUFFER_NUM> outQueue_;
+    TQue<QuePosition::VECOUT, BUFFER_NUM> scaleOutQueue_;
+    TBuf<QuePosition::VECCALC> calcBuf_;
+    TBuf<QuePosition::VECCALC> castBuf_;
+    TBuf<QuePosition::VECCALC> maxBuf_;
+    TBuf<QuePosition::VECCALC> powTempBuf1_;
+    TBuf<QuePosition::VECCALC> powTempBuf2_;
+
+    GlobalTensor<T> gmVar_, gmGrad_, gmVarRef_;
+    GlobalTensor<int8_t> gmM_, gmV_, gmMRef_, gmVRef_;
+    GlobalTensor<float> gmMScale_, gmVScale_, gmMScaleRef_, gmVScaleRef_;
+    GlobalTensor<U> gmStep_;
+
+    uint64_t blockSize_ = 0;
+    uint64_t blockNum_ = 0;
+    uint64_t blockFactor_ = 0;
+    uint64_t tailCoreBlockNum_ = 0;
+    uint64_t blocksPerLoop_ = 0;
+    uint64_t lastBlockDataNum_ = 0;
+    uint64_t usedCoreNum_ = 0;
+    uint64_t numPerLoop_ = 0;
+    uint64_t scaleNumAlign_ = 0;
+    uint64_t blockStart_ = 0;
+    uint64_t coreBlockNum_ = 0;
+    uint32_t blockIdx_ = 0;
+
+    float beta1_ = 0;
+    float beta2_ = 0;
+    float lr_ = 0;
+    float weightDecay_ = 0;
+    float eps_ = 0;
+    bool maximize_ = false;
+
+    float realWeightDecay_ = 0;
+    float stepSize_ = 0;
+    float biasCorrection2Sqrt_ = 0;
+    float oneSubBeta1_ = 0;
+    float oneSubBeta2_ = 0;
+
+    // inQueue_ 内按字节排布: var | grad | m | v
+    uint64_t gradInOffset_ = 0;
+    uint64_t mInOffset_ = 0;
+    uint64_t vInOffset_ = 0;
+    // outQueue_ 内按字节排布: var | m | v
+    uint64_t mOutOffset_ = 0;
+    uint64_t vOutOffset_ = 0;
+};
+
+template <typename T, typename U>
+__aicore__ inline void ApplyAdamWQuant<T, U>::Init(GM_ADDR var, GM_ADDR m, GM_ADDR v, GM_ADDR mScale,
+    GM_ADDR vScale, GM_ADDR grad, GM_ADDR step, GM_ADDR varRef, GM_ADDR mRef, GM_ADDR vRef, GM_ADDR mScaleRef,
+    GM_ADDR vScaleRef, const ApplyAdamWQuantTilingData* tilingData, TPipe* pipe) {
+    pipe_ = pipe;
+    blockIdx_ = GetBlockIdx();
+    ParseTilingData(tilingData);
+
+    blockStart_ = blockIdx_ * blockFactor_;
+    coreBlockNum_ = (blockIdx_ == usedCoreNum_ - 1) ? tailCoreBlockNum_ : blockFactor_;
+    numPerLoop_ = blocksPerLoop_ * blockSize_;
+    scaleNumAlign_ = (blocksPerLoop_ + BLOCK_SIZE_FOR_FLOAT32 - 1) / BLOCK_SIZE_FOR_FLOAT32 * BLOCK_SIZE_FOR_FLOAT32;
+
+    gmStep_.SetGlobalBuffer((__gm__ U*)step, 1);
+    float step = static_cast<float>(gmStep_.GetValue(0));
+
+    gmVar_.SetGlobalBuffer((__gm__ T*)var);
+    gmGrad_.SetGlobalBuffer((__gm__ T*)grad);
+    gmM_.SetGlobalBuffer((__gm__ int8_t*)m);
+    gmV_.SetGlobalBuffer((__gm__ int8_t*)v);
+    gmMScale_.SetGlobalBuffer((__gm__ float*)mScale);
+    gmVScale_.SetGlobalBuffer((__gm__ float*)vScale);
+    gmVarRef_.SetGlobalBuffer((__gm__ T*)varRef);
+    gmMRef_.SetGlobalBuffer((__gm__ int8_t*)mRef);
+    gmVRef_.SetGlobalBuffer((__gm__ int8_t*)vRef);
+    gmMScaleRef_.SetGlobalBuffer((__gm__ float*)mScaleRef);
+    gmVScaleRef_.SetGlobalBuffer((__gm__ float*)vScaleRef);
+
+    gradInOffset_ = numPerLoop_ * sizeof(T);
+    mInOffset_ = gradInOffset_ * 2;
+    vInOffset_ = mInOffset_ + numPerLoop_;
+    mOutOffset_ = numPerLoop_ * sizeof(T);
+    vOutOffset_ = mOutOffset_ + numPerLoop_;
+
+    pipe_->InitBuffer(inQueue_, BUFFER_NUM, vInOffset_ + numPerLoop_);
+    pipe_->InitBuffer(outQueue_, BUFFER_NUM, vOutOffset_ + numPerLoop_);
+    pipe_->InitBuffer(scaleInQueue_, BUFFER_NUM, 2 * scaleNumAlign_ * sizeof(float));
+    pipe_->InitBuffer(scaleOutQueue_, BUFFER_NUM, 2 * scaleNumAlign_ * sizeof(float));
+    pipe_->InitBuffer(calcBuf_, FP32_CALC_BUF_NUM * numPerLoop_ * sizeof(float));
+    pipe_->InitBuffer(castBuf_, numPerLoop_ * sizeof(int32_t));
+    pipe_->InitBuffer(maxBuf_, blocksPerLoop_ * BYTE_ONE_BLOCK);
+    pipe_->InitBuffer(powTempBuf1_, BYTE_ONE_BLOCK);
+    pipe_->InitBuffer(powTempBuf2_, BYTE_ONE_BLOCK);
+
+    step += 1;
+    float biasCorrection1 = 1.0f - ScalarPow(beta1_, step);
+    float biasCorrection2 = 1.0f - ScalarPow(beta2_, step);
+    stepSize_ = lr_ / biasCorrection1;
+    biasCorrection2Sqrt_ = 1.0f / sqrt(biasCorrection2);
+    realWeightDecay_ = 1.0f - lr_ * weightDecay_;
+    oneSubBeta1_ = 1.0f - beta1_;
+    oneSubBeta2_ = 1.0f - beta2_;
+}
+
+template <typename T, typename U>
+__aicore__ inline void ApplyAdamWQuant<T, U>::ParseTilingData(const ApplyAdamWQuantTilingData* tilingData) {
+    lr_ = tilingData->lr;
+    beta1_ = tilingData->beta1;
+    beta2_ = tilingData->beta2;
+    weightDecay_ = tilingData->weightDecay;
+    eps_ = tilingData->eps;
+    maximize_ = tilingData->maximize != 0;
+    blockSize_ = tilingData->blockSize;
+    blockNum_ = tilingData->blockNum;
+    usedCoreNum_ = tilingData->usedCoreNum;
+    blockFactor_ = tilingData->blockFactor;
+    tailCoreBlockNum_ = tilingData->tailCoreBlockNum;
+    blocksPerLoop_ = tilingData->blocksPerLoop;
+    lastBlockDataNum_ = tilingData->lastBlockDataNum;
+}
+
+template <typename T, typename U>
+__aicore__ inline float ApplyAdamWQuant<T, U>::ScalarPow(float x, float y) {
+    LocalTensor<float> baseLocal = powTempBuf1_.Get<float>();
+    LocalTensor<float> outLocal = powTempBuf2_.Get<float>();
+    pipe_barrier(PIPE_V);
+    Duplicate(baseLocal, x, BLOCK_SIZE_FOR_FLOAT32);
+    pipe_barrier(PIPE_V);
+    Power<float, false>(outLocal, baseLocal, y, BLOCK_SIZE_FOR_FLOAT32);
+    event_t eventIdVToS = static_cast<event_t>(GetTPipePtr()->FetchEventID(HardEvent::V_S));
+    SetFlag<HardEvent::V_S>(eventIdVToS);
+    WaitFlag<HardEvent::V_S>(eventIdVToS);
+    float result = outLocal.GetValue(0);
+    pipe_barrier(PIPE_ALL);
+    return result;
+}
+
+template <typename T, typename U>
+__aicore__ inline uint64_t ApplyAdamWQuant<T, U>::BlockDataCount(uint64_t globalBlockIdx) {
+    return globalBlockIdx == blockNum_ - 1 ? lastBlockDataNum_ : blockSize_;
+}
+
+template <typename T, typename U>
+__aicore__ inline void ApplyAdamWQuant<T, U>::CopyIn(uint64_t blockOffset, uint64_t blockCount,
+                                                     uint64_t dataCount) {
+    uint64_t offset = blockOffset * blockSize_;
+    LocalTensor<uint8_t> dataLocal = inQueue_.AllocTensor<uint8_t>();
+    LocalTensor<float> scaleLocal = scaleInQueue_.AllocTensor<float>();
+
+    DataCopyExtParams copyParams{1, static_cast<uint32_t>(dataCount * sizeof(T)), 0, 0, 0};
+    DataCopyPadExtParams<T> padParams{false, 0, 0, 0};
+    DataCopyPad(dataLocal.ReinterpretCast<T>(), gmVar_[offset], copyParams, padParams);
+    DataCopyPad(dataLocal[gradInOffset_].ReinterpretCast<T>(), gmGrad_[offset], copyParams, padParams);
+
+    DataCopyExtParams int8CopyParams{1, static_cast<uint32_t>(dataCount), 0, 0, 0};
+    DataCopyPadExtParams<int8_t> int8PadParams{false, 0, 0, 0};
+    DataCopyPad(dataLocal[mInOffset_].ReinterpretCast<int8_t>(), gmM_[offset], int8CopyParams, int8PadParams);
+    DataCopyPad(dataLocal[vInOffset_].ReinterpretCast<int8_t>(), gmV_[offset], int8CopyParams, int8PadParams);
+
+    DataCopyExtParams scaleCopyParams{1, static_cast<uint32_t>(blockCount * sizeof(float)), 0, 0, 0};
+    DataCopyPadExtParams<float> scalePadParams{false, 0, 0, 0};
+    DataCopyPad(scaleLocal, gmMScale_[blockOffset], scaleCopyParams, scalePadParams);
+    DataCopyPad(scaleLocal[scaleNumAlign_], gmVScale_[blockOffset], scaleCopyParams, scalePadParams);
+
+    inQueue_.EnQue(dataLocal);
+    scaleInQueue_.EnQue(scaleLocal);
+}
+
+template <typename T, typename U>
+__aicore__ inline void ApplyAdamWQuant<T, U>::Dequant(const LocalTensor<float>& dst, const LocalTensor<int8_t>& src,
+    const LocalTensor<float>& scale, uint64_t blockCount, uint64_t dataCount) {
+    LocalTensor<half> halfLocal = castBuf_.Get<half>();
+    Cast(halfLocal, src, RoundMode::CAST_NONE, dataCount);
+    pipe_barrier(PIPE_V);
+    Cast(dst, halfLocal, RoundMode::CAST_NONE, dataCount);
+    pipe_barrier(PIPE_V);
+    // scale 由 MTE2 搬入, 标量读取前需等待搬运完成
+    event_t eventIdMte2ToS = static_cast<event_t>(GetTPipePtr()->FetchEventID(HardEvent::MTE2_S));
+    SetFlag<HardEvent::MTE2_S>(eventIdMte2ToS);
+    WaitFlag<HardEvent::MTE2_S>(eventIdMte2ToS);
+    for (uint64_t i = 0; i < blockCount; i++) {
+        uint64_t count = (i == blockCount - 1) ? dataCount - i * blockSize_ : blockSize_;
+        Muls(dst[i * blockSize_], dst[i * blockSize_], scale.GetValue(i), count);
+    }
+    pipe_barrier(PIPE_V);
+}
+
+template <typename T, typename U>
+__aicore__ inline void ApplyAdamWQuant<T, U>::Quant(const LocalTensor<int8_t>& dst, const LocalTensor<float>& scale,
+    const LocalTensor<float>& src, bool isNonNegative, uint64_t blockOffset, uint64_t blockCount,
+    uint64_t dataCount) {
+    LocalTensor<float> tmpLocal = calcBuf_.Get<float>()[(FP32_CALC_BUF_NUM - 1) * numPerLoop_];
+    LocalTensor<float> workLocal = castBuf_.Get<float>();
+    LocalTensor<float> maxLocal = maxBuf_.Get<float>();
+    LocalTensor<float> absLocal = src;
+    if (!isNonNegative) {
+        Abs(tmpLocal, src, dataCount);
+        pipe_barrier(PIPE_V);
+        absLocal = tmpLocal;
+    }
+    for (uint64_t i = 0; i < blockCount; i++) {
+        uint64_t count = BlockDataCount(blockOffset + i);
+        ReduceMax<float>(maxLocal[i * BLOCK_SIZE_FOR_FLOAT32], absLocal[i * blockSize_], workLocal,
+                         static_cast<int32_t>(count), false);
+        pipe_barrier(PIPE_V);
+    }
+    event_t eventIdVToS = static_cast<event_t>(GetTPipePtr()->FetchEventID(HardEvent::V_S));
+    SetFlag<HardEvent::V_S>(eventIdVToS);
+    WaitFlag<HardEvent::V_S>(eventIdVToS);
+    for (uint64_t i = 0; i < blockCount; i++) {
+        uint64_t count = BlockDataCount(blockOffset + i);
+        float absMax = maxLocal.GetValue(i * BLOCK_SIZE_FOR_FLOAT32);
+        // 全零块的 scale 记为0, 反量化后仍为0
+        float quantScale = absMax > 0.0f ? INT8_MAX_VALUE / absMax : 0.0f;
+        scale.SetValue(i, absMax * INT8_MAX_RECIPROCAL);
+        Muls(tmpLocal[i * blockSize_], src[i * blockSize_], quantScale, count);
+    }
+    pipe_barrier(PIPE_V);
+    LocalTensor<int32_t> int32Local = castBuf_.Get<int32_t>();
+    Cast(int32Local, tmpLocal, RoundMode::CAST_RINT, dataCount);
+    pipe_barrier(PIPE_V);
+    LocalTensor<half> halfLocal = castBuf_.Get<half>();
+    SetDeqScale(static_cast<half>(1.0));
+    pipe_barrier(PIPE_V);
+    Cast(halfLocal, int32Local, RoundMode::CAST_ROUND, dataCount);
+    pipe_barrier(PIPE_V);
+    Cast(dst, halfLocal, RoundMode::CAST_TRUNC, dataCount);
+    pipe_barrier(PIPE_V);
+}
+
+template <typename T, typename U>
+__aicore__ inline void ApplyAdamWQuant<T, U>::Compute(uint64_t blockOffset, uint64_t blockCount,
+                                                      uint64_t dataCount) {
+    LocalTensor<uint8_t> dataLocal = inQueue_.DeQue<uint8_t>();
+    LocalTensor<float> scaleLocal = scaleInQueue_.DeQue<float>();
+    LocalTensor<uint8_t> dataOutLocal = outQueue_.AllocTensor<uint8_t>();
+    LocalTensor<float> scaleOutLocal = scaleOutQueue_.AllocTensor<float>();
+
+    LocalTensor<float> calcLocal = calcBuf_.Get<float>();
+    LocalTensor<float> varLocal = calcLocal;
+    LocalTensor<float> gradLocal = calcLocal[numPerLoop_];
+    LocalTensor<float> mLocal = calcLocal[numPerLoop_ * 2];
+    LocalTensor<float> vLocal = calcLocal[numPerLoop_ * 3];
+    LocalTensor<float> tmpLocal = calcLocal[numPerLoop_ * 4];
+
+    if constexpr (IsSameType<T, float>::value) {
+        Adds(varLocal, dataLocal.ReinterpretCast<float>(), 0.0f, dataCount);
+        Adds(gradLocal, dataLocal[gradInOffset_].ReinterpretCast<float>(), 0.0f, dataCount);
+    } else {
+        Cast(varLocal, dataLocal.ReinterpretCast<T>(), RoundMode::CAST_NONE, dataCount);
+        Cast(gradLocal, dataLocal[gradInOffset_].ReinterpretCast<T>(), RoundMode::CAST_NONE, dataCount);
+    }
+    pipe_barrier(PIPE_V);
+    Dequant(mLocal, dataLocal[mInOffset_].ReinterpretCast<int8_t>(), scaleLocal, blockCount, dataCount);
+    Dequant(vLocal, dataLocal[vInOffset_].ReinterpretCast<int8_t>(), scaleLocal[scaleNumAlign_], blockCount,
+            dataCount);
+    inQueue_.FreeTensor(dataLocal);
+    scaleInQueue_.FreeTensor(scaleLocal);
+
+    if (maximize_) {
+        // grad = -grad
+        Muls(gradLocal, gradLocal, -1.0f, dataCount);
+        pipe_barrier(PIPE_V);
+    }
+    // param.mul_(1 - lr * weight_decay)
+    Muls(varLocal, varLocal, realWeightDecay_, dataCount);
+    // exp_avg.lerp_(grad, 1 - beta1)
+    Sub(tmpLocal, gradLocal, mLocal, dataCount);
+    pipe_barrier(PIPE_V);
+    Axpy(mLocal, tmpLocal, oneSubBeta1_, dataCount);
+    // vLocal 中为 sqrt(v), 先还原为 v: exp_avg_sq.mul_(beta2).addcmul_(grad, grad, value=1 - beta2)
+    Mul(vLocal, vLocal, vLocal, dataCount);
+    Mul(gradLocal, gradLocal, gradLocal, dataCount);
+    pipe_barrier(PIPE_V);
+    Muls(vLocal, vLocal, beta2_, dataCount);
+    pipe_barrier(PIPE_V);
+    Axpy(vLocal, gradLocal, oneSubBeta2_, dataCount);
+    pipe_barrier(PIPE_V);
+    // sqrt(v) 既是新的v量化对象, 也用于计算 denom = sqrt(v) / bias_correction2_sqrt + eps
+    Sqrt(vLocal, vLocal, dataCount);
+    pipe_barrier(PIPE_V);
+    Muls(tmpLocal, vLocal, biasCorrection2Sqrt_, dataCount);
+    pipe_barrier(PIPE_V);
+    Adds(tmpLocal, tmpLocal, eps_, dataCount);
+    pipe_barrier(PIPE_V);
+    // param.addcdiv_(exp_avg, denom, value=-step_size)
+    Div(gradLocal, mLocal, tmpLocal, dataCount);
+    pipe_barrier(PIPE_V);
+    Axpy(varLocal, gradLocal, -stepSize_, dataCount);
+    pipe_barrier(PIPE_V);
+
+    if constexpr (IsSameType<T, float>::value) {
+        Adds(dataOutLocal.ReinterpretCast<float>(), varLocal, 0.0f, dataCount);
+    } else {
+        Cast(dataOutLocal.ReinterpretCast<T>(), varLocal, RoundMode::CAST_RINT, dataCount);
+    }
+    pipe_barrier(PIPE_V);
+    Quant(dataOutLocal[mOutOffset_].ReinterpretCast<int8_t>(), scaleOutLocal, mLocal, false, blockOffset, blockCount,
+          dataCount);
+    Quant(dataOutLocal[vOutOffset_].ReinterpretCast<int8_t>(), scaleOutLocal[scaleNumAlign_], vLocal, true,
+          blockOffset, blockCount, dataCount);
+
+    outQueue_.EnQue(dataOutLocal);
+    scaleOutQueue_.EnQue(scaleOutLocal);
+}
+
+template <typename T, typename U>
+__aicore__ inline void ApplyAdamWQuant<T, U>::CopyOut(uint64_t blockOffset, uint64_t blockCount,
+                                                      uint64_t dataCount) {
+    uint64_t offset = blockOffset * blockSize_;
+    LocalTensor<uint8_t> dataOutLocal = outQueue_.DeQue<uint8_t>();
+    LocalTensor<float> scaleOutLocal = scaleOutQueue_.DeQue<float>();
+
+    DataCopyExtParams copyParams{1, static_cast<uint32_t>(dataCount * sizeof(T)), 0, 0, 0};
+    DataCopyPad(gmVarRef_[offset], dataOutLocal.ReinterpretCast<T>(), copyParams);
+    DataCopyExtParams int8CopyParams{1, static_cast<uint32_t>(dataCount), 0, 0, 0};
+    DataCopyPad(gmMRef_[offset], dataOutLocal[mOutOffset_].ReinterpretCast<int8_t>(), int8CopyParams);
+    DataCopyPad(gmVRef_[offset], dataOutLocal[vOutOffset_].ReinterpretCast<int8_t>(), int8CopyParams);
+
+    // scale 由标量写入UB, 搬出前需等待标量写完成
+    event_t eventIdSToMte3 = static_cast<event_t>(GetTPipePtr()->FetchEventID(HardEvent::S_MTE3));
+    SetFlag<HardEvent::S_MTE3>(eventIdSToMte3);
+    WaitFlag<HardEvent::S_MTE3>(eventIdSToMte3);
+    DataCopyExtParams scaleCopyParams{1, static_cast<uint32_t>(blockCount * sizeof(float)), 0, 0, 0};
+    DataCopyPad(gmMScaleRef_[blockOffset], scaleOutLocal, scaleCopyParams);
+    DataCopyPad(gmVScaleRef_[blockOffset], scaleOutLocal[scaleNumAlign_], scaleCopyParams);
+
+    outQueue_.FreeTensor(dataOutLocal);
+    scaleOutQueue_.FreeTensor(scaleOutLocal);
+}
+
+template <typename T, typename U>
+__aicore__ inline void ApplyAdamWQuant<T, U>::Process() {
+    if (blockIdx_ >= usedCoreNum_) {
+        return;
+    }
+    uint64_t loopNum = (coreBlockNum_ + blocksPerLoop_ - 1) / blocksPerLoop_;
+    for (uint64_t loop = 0; loop < loopNum; loop++) {
+        uint64_t blockOffset = blockStart_ + loop * blocksPerLoop_;
+        uint64_t blockCount = (loop == loopNum - 1) ? coreBlockNum_ - loop * blocksPerLoop_ : blocksPerLoop_;
+        uint64_t dataCount = (blockCount - 1) * blockSize_ + BlockDataCount(blockOffset + blockCount - 1);
+        CopyIn(blockOffset, blockCount, dataCount);
+        Compute(blockOffset, blockCount, dataCount);
+        CopyOut(blockOffset, blockCount, dataCount);
+    }
+}
+
+}  // namespace ApplyAdamWQuantNs
+
+#endif  // APPLY_ADAM_W_QUANT_H
@@ -0,0 +1,64 @@
+#!/usr/bin/python3
+# -*- coding:utf-8 -*-
+# Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+# This file is a part of the CANN Open Software.
+# Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+# ==========================================================================================================
+
+import math
+import numpy as np
+np.random.seed(5)
+
+# 参数个数超过ForeachGlobalNorm单次下发上限50，用于覆盖aclnn内部分段串联
+TENSOR_NUM = 60
+TENSOR_SHAPE = [4, 16]
+LR, BETA1, BETA2, WEIGHT_DECAY, EPS = 0.01, 0.9, 0.99, 5e-3, 1e-6
+CLIP_MAX_NORM = 1.0
+# 与torch.nn.utils.clip_grad_norm_一致的防除零项
+CLIP_EPS = 1e-6
+
+
+def global_norm(grads):
+    return math.sqrt(sum(float(np.sum(g.astype(np.float64) ** 2)) for g in grads))
+
+
+def adam_w(var, m, v, grad, step):
+    # 与AclNNInvocationNaive中的torch参考实现一致，amsgrad、maximize均为false
+    step_t = step + 1
+    var = var * (1 - LR * WEIGHT_DECAY)
+    m = m + (grad - m) * (1 - BETA1)
+    v = v * BETA2 + grad * grad * (1 - BETA2)
+    bias_correction1 = 1 - BETA1 ** step_t
+    bias_correction2_sqrt = math.sqrt(1 - BETA2 ** step_t)
+    denom = np.sqrt(v) / bias_correction2_sqrt + EPS
+    var = var - (LR / bias_correction1) * (m / denom)
+    return var.astype(np.float32)
+
+
+def gen_golden_data_simple():
+    shape = [TENSOR_NUM] + TENSOR_SHAPE
+    var = np.random.uniform(0.1, 1, shape).astype(np.float32)
+    m = np.random.uniform(0.1, 1, shape).astype(np.float32)
+    v = np.random.uniform(0.1, 1, shape).astype(np.float32)
+    grad = np.random.uniform(-1, 1, shape).astype(np.float32)
+    step = np.array([3], dtype=np.float32)
+
+    norm = global_norm(grad)
+    clip_coef = min(1.0, CLIP_MAX_NORM / (norm + CLIP_EPS))
+    golden_var = np.stack([adam_w(var[i], m[i], v[i], grad[i] * clip_coef, step[0]) for i in range(TENSOR_NUM)])
+
+    var.tofile("./input/var.bin")
+    m.tofile("./input/m.bin")
+    v.tofile("./input/v.bin")
+    grad.tofile("./input/grad.bin")
+    step.tofile("./input/step.bin")
+    np.array([norm], dtype=np.float32).tofile("./output/golden_norm.bin")
+    golden_var.tofile("./output/golden_var.bin")
+
+
+if __name__ == "__main__":
+    gen_golden_data_simple()
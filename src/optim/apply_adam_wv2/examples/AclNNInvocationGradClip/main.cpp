@@ -0,0 +1,235 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file main.cpp
+ */
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "acl/acl.h"
+#include "aclnn_apply_adam_wv2.h"
+#include "aclnn_foreach_global_norm.h"
+
+#define SUCCESS 0
+#define FAILED 1
+
+#define INFO_LOG(fmt, args...) fprintf(stdout, "[INFO]  " fmt "\n", ##args)
+#define ERROR_LOG(fmt, args...) fprintf(stderr, "[ERROR]  " fmt "\n", ##args)
+
+#define CHECK_RET(cond, return_expr) \
+    do {                             \
+        if (!(cond)) {               \
+            return_expr;             \
+        }                            \
+    } while (0)
+
+namespace {
+// 参数个数超过ForeachGlobalNorm单次下发上限50，aclnn接口内部分段串联
+constexpr int64_t TENSOR_NUM = 60;
+constexpr float LR = 0.01f;
+constexpr float BETA1 = 0.9f;
+constexpr float BETA2 = 0.99f;
+constexpr float WEIGHT_DECAY = 5e-3f;
+constexpr float EPS = 1e-6f;
+constexpr float CLIP_MAX_NORM = 1.0f;
+constexpr float NORM_TYPE = 2.0f;
+
+int64_t GetShapeSize(const std::vector<int64_t> &shape)
+{
+    int64_t shapeSize = 1;
+    for (auto i : shape) {
+        shapeSize *= i;
+    }
+    return shapeSize;
+}
+
+bool ReadFile(const std::string &filePath, std::vector<float> &hostData)
+{
+    std::ifstream file(filePath, std::ios::binary);
+    if (!file.is_open()) {
+        ERROR_LOG("Open file failed. path = %s", filePath.c_str());
+        return false;
+    }
+    file.read(reinterpret_cast<char *>(hostData.data()), hostData.size() * sizeof(float));
+    return static_cast<size_t>(file.gcount()) == hostData.size() * sizeof(float);
+}
+
+int WriteOutput(const std::string &filePath, size_t size, const void *deviceAddr)
+{
+    std::vector<float> resultData(size, 0);
+    auto ret = aclrtMemcpy(resultData.data(), size * sizeof(float), deviceAddr, size * sizeof(float),
+                           ACL_MEMCPY_DEVICE_TO_HOST);
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("copy result from device to host failed. ERROR: %d", ret); return FAILED);
+    std::ofstream file(filePath, std::ios::binary);
+    CHECK_RET(file.is_open(), ERROR_LOG("Open file failed. path = %s", filePath.c_str()); return FAILED);
+    file.write(reinterpret_cast<const char *>(resultData.data()), size * sizeof(float));
+    return SUCCESS;
+}
+
+int Init(int32_t deviceId, aclrtStream *stream)
+{
+    // 固定写法，acl初始化
+    auto ret = aclInit(nullptr);
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("aclInit failed. ERROR: %d", ret); return FAILED);
+    ret = aclrtSetDevice(deviceId);
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("aclrtSetDevice failed. ERROR: %d", ret); return FAILED);
+    ret = aclrtCreateStream(stream);
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("aclrtCreateStream failed. ERROR: %d", ret); return FAILED);
+    return SUCCESS;
+}
+
+// hostData为空时仅申请device内存
+int CreateAclTensor(const float *hostData, const std::vector<int64_t> &shape, void **deviceAddr, aclTensor **tensor)
+{
+    auto size = GetShapeSize(shape) * sizeof(float);
+    auto ret = aclrtMalloc(deviceAddr, size, ACL_MEM_MALLOC_HUGE_FIRST);
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("aclrtMalloc failed. ERROR: %d", ret); return FAILED);
+    if (hostData != nullptr) {
+        ret = aclrtMemcpy(*deviceAddr, size, hostData, size, ACL_MEMCPY_HOST_TO_DEVICE);
+        CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("aclrtMemcpy failed. ERROR: %d", ret); return FAILED);
+    }
+    *tensor = aclCreateTensor(shape.data(), shape.size(), aclDataType::ACL_FLOAT, nullptr, 0, aclFormat::ACL_FORMAT_ND,
+                              shape.data(), shape.size(), *deviceAddr);
+    return SUCCESS;
+}
+
+// 多次调用共用一块workspace，不足时重新申请
+int PrepareWorkspace(uint64_t workspaceSize, void **workspaceAddr, uint64_t &workspaceCap)
+{
+    if (workspaceSize <= workspaceCap) {
+        return SUCCESS;
+    }
+    if (*workspaceAddr != nullptr) {
+        aclrtFree(*workspaceAddr);
+    }
+    auto ret = aclrtMalloc(workspaceAddr, workspaceSize, ACL_MEM_MALLOC_HUGE_FIRST);
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("allocate workspace failed. ERROR: %d", ret); return FAILED);
+    workspaceCap = workspaceSize;
+    return SUCCESS;
+}
+}  // namespace
+
+int main(int argc, char **argv)
+{
+    // 1. （固定写法）device/stream初始化, 参考acl对外接口列表
+    int32_t deviceId = 0;
+    aclrtStream stream;
+    auto ret = Init(deviceId, &stream);
+    CHECK_RET(ret == SUCCESS, ERROR_LOG("Init acl failed. ERROR: %d", ret); return FAILED);
+
+    // 2. 构造输入，var/m/v/grad按参数个数切成TENSOR_NUM个独立的tensor
+    std::vector<int64_t> paramShape = {4, 16};
+    std::vector<int64_t> scalarShape = {1};
+    int64_t paramSize = GetShapeSize(paramShape);
+    int64_t totalSize = TENSOR_NUM * paramSize;
+    std::vector<std::string> inFiles = {"var", "m", "v", "grad"};
+    std::vector<std::vector<float>> hostData(inFiles.size(), std::vector<float>(totalSize));
+    for (size_t i = 0; i < inFiles.size(); i++) {
+        CHECK_RET(ReadFile("../input/" + inFiles[i] + ".bin", hostData[i]), return FAILED);
+    }
+    std::vector<float> stepHostData(1);
+    CHECK_RET(ReadFile("../input/step.bin", stepHostData), return FAILED);
+
+    // tensors[k][i]为第i个参数的var/m/v/grad
+    std::vector<std::vector<void *>> deviceAddrs(inFiles.size(), std::vector<void *>(TENSOR_NUM, nullptr));
+    std::vector<std::vector<aclTensor *>> tensors(inFiles.size(), std::vector<aclTensor *>(TENSOR_NUM, nullptr));
+    for (size_t k = 0; k < inFiles.size(); k++) {
+        for (int64_t i = 0; i < TENSOR_NUM; i++) {
+            ret = CreateAclTensor(hostData[k].data() + i * paramSize, paramShape, &deviceAddrs[k][i], &tensors[k][i]);
+            CHECK_RET(ret == SUCCESS, return FAILED);
+        }
+    }
+    const size_t varIdx = 0;
+    const size_t mIdx = 1;
+    const size_t vIdx = 2;
+    const size_t gradIdx = 3;
+    void *stepDeviceAddr = nullptr;
+    aclTensor *step = nullptr;
+    ret = CreateAclTensor(stepHostData.data(), scalarShape, &stepDeviceAddr, &step);
+    CHECK_RET(ret == SUCCESS, return FAILED);
+    void *normDeviceAddr = nullptr;
+    aclTensor *globalNorm = nullptr;
+    ret = CreateAclTensor(nullptr, scalarShape, &normDeviceAddr, &globalNorm);
+    CHECK_RET(ret == SUCCESS, return FAILED);
+    aclTensorList *gradList = aclCreateTensorList(tensors[gradIdx].data(), TENSOR_NUM);
+    aclScalar *normType = aclCreateScalar(const_cast<float *>(&NORM_TYPE), aclDataType::ACL_FLOAT);
+
+    // 3. 先在Device侧计算全部梯度的全局2范数，再逐参数调用带裁剪的ApplyAdamWV2，范数不回传Host
+    void *workspaceAddr = nullptr;
+    uint64_t workspaceCap = 0;
+    uint64_t workspaceSize = 0;
+    aclOpExecutor *executor = nullptr;
+    ret = aclnnForeachGlobalNormGetWorkspaceSize(gradList, normType, globalNorm, &workspaceSize, &executor);
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("aclnnForeachGlobalNormGetWorkspaceSize failed. ERROR: %d", ret);
+              return FAILED);
+    CHECK_RET(PrepareWorkspace(workspaceSize, &workspaceAddr, workspaceCap) == SUCCESS, return FAILED);
+    ret = aclnnForeachGlobalNorm(workspaceAddr, workspaceSize, executor, stream);
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("aclnnForeachGlobalNorm failed. ERROR: %d", ret); return FAILED);
+
+    for (int64_t i = 0; i < TENSOR_NUM; i++) {
+        ret = aclnnApplyAdamWV2WithGradClipGetWorkspaceSize(tensors[varIdx][i], tensors[mIdx][i], tensors[vIdx][i],
+                                                            nullptr, tensors[gradIdx][i], step, globalNorm, LR, BETA1,
+                                                            BETA2, WEIGHT_DECAY, EPS, false, false, CLIP_MAX_NORM,
+                                                            &workspaceSize, &executor);
+        CHECK_RET(ret == ACL_SUCCESS,
+                  ERROR_LOG("aclnnApplyAdamWV2WithGradClipGetWorkspaceSize failed. ERROR: %d", ret); return FAILED);
+        CHECK_RET(PrepareWorkspace(workspaceSize, &workspaceAddr, workspaceCap) == SUCCESS, return FAILED);
+        ret = aclnnApplyAdamWV2WithGradClip(workspaceAddr, workspaceSize, executor, stream);
+        CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("aclnnApplyAdamWV2WithGradClip failed. ERROR: %d", ret);
+                  return FAILED);
+    }
+
+    // 4. （固定写法）同步等待任务执行结束
+    ret = aclrtSynchronizeStream(stream);
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("aclrtSynchronizeStream failed. ERROR: %d", ret); return FAILED);
+
+    // 5. 写出全局范数与更新后的var，由verify_result.py与golden比对
+    ret = WriteOutput("../output/output_norm.bin", 1, normDeviceAddr);
+    CHECK_RET(ret == SUCCESS, return FAILED);
+    std::vector<float> varResult(totalSize, 0);
+    for (int64_t i = 0; i < TENSOR_NUM; i++) {
+        ret = aclrtMemcpy(varResult.data() + i * paramSize, paramSize * sizeof(float), deviceAddrs[varIdx][i],
+                          paramSize * sizeof(float), ACL_MEMCPY_DEVICE_TO_HOST);
+        CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("copy var from device to host failed. ERROR: %d", ret); return FAILED);
+    }
+    std::ofstream varFile("../output/output_var.bin", std::ios::binary);
+    CHECK_RET(varFile.is_open(), ERROR_LOG("Open output_var.bin failed."); return FAILED);
+    varFile.write(reinterpret_cast<const char *>(varResult.data()), totalSize * sizeof(float));
+    varFile.close();
+    INFO_LOG("Write output success");
+
+    // 6. 释放aclTensor与device资源，gradList销毁时一并销毁其中的grad tensor
+    aclDestroyTensorList(gradList);
+    aclDestroyScalar(normType);
+    for (size_t k = 0; k < inFiles.size(); k++) {
+        for (int64_t i = 0; i < TENSOR_NUM; i++) {
+            if (k != gradIdx) {
+                aclDestroyTensor(tensors[k][i]);
+            }
+            aclrtFree(deviceAddrs[k][i]);
+        }
+    }
+    aclDestroyTensor(step);
+    aclDestroyTensor(globalNorm);
+    aclrtFree(stepDeviceAddr);
+    aclrtFree(normDeviceAddr);
+    if (workspaceAddr != nullptr) {
+        aclrtFree(workspaceAddr);
+    }
+    aclrtDestroyStream(stream);
+    aclrtResetDevice(deviceId);
+    aclFinalize();
+
+    return SUCCESS;
+}
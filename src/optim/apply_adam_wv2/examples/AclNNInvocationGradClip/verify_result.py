@@ -0,0 +1,42 @@
+#!/usr/bin/python3
+# -*- coding:utf-8 -*-
+# Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+# This file is a part of the CANN Open Software.
+# Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+# ==========================================================================================================
+
+import sys
+import numpy as np
+
+# 输入输出均为float32，范数在各核与各段间的累加顺序与golden不同，容差按float32累加误差放宽
+LOSS = 1e-4
+MINIMUM = 10e-10
+
+
+def verify_result(real_result, golden):
+    real_result = np.fromfile(real_result, dtype=np.float32) # 从bin文件读取实际运算结果
+    golden = np.fromfile(golden, dtype=np.float32) # 从bin文件读取预期运算结果
+    if real_result.size != golden.size:
+        print("[ERROR] result size %d not equal to golden size %d" % (real_result.size, golden.size))
+        return False
+    result = np.abs(real_result - golden) # 计算运算结果和预期结果偏差
+    deno = np.maximum(np.abs(real_result), np.abs(golden))  # 获取最大值并组成新数组
+    result_atol = np.less_equal(result, LOSS) # 计算绝对误差
+    result_rtol = np.less_equal(result / np.add(deno, MINIMUM), LOSS) # 计算相对误差
+    if not result_rtol.all() and not result_atol.all():
+        if np.sum(result_rtol == False) > real_result.size * LOSS and \
+           np.sum(result_atol == False) > real_result.size * LOSS: # 误差超出预期时返回打印错误，返回对比失败
+            print("[ERROR] result error")
+            return False
+    return True
+
+if __name__ == '__main__':
+    # 参数为若干组(实际结果, golden)文件，依次比对全局范数与更新后的var
+    files = sys.argv[1:]
+    passed = all(verify_result(files[i], files[i + 1]) for i in range(0, len(files) - 1, 2))
+    if passed:
+        print("test pass")
@@ -136,13 +136,35 @@ static inline aclTensor* CheckAndExecuteTypeCast(bool isNeedCast, const aclTenso
   return const_cast<aclTensor*>(input);
 }
 
-aclnnStatus aclnnApplyAdamWV2GetWorkspaceSize(aclTensor* varRef, aclTensor* mRef, aclTensor* vRef,
-                                              aclTensor* maxGradNormOptionalRef, const aclTensor* grad,
-                                              const aclTensor* step, float lr, float beta1, float beta2,
-                                              float weightDecay, float eps, bool amsgrad, bool maximize,
-                                              uint64_t* workspaceSize, aclOpExecutor** executor) {
-  L2_DFX_PHASE_1(aclnnApplyAdamWV2, DFX_IN(varRef, mRef, vRef, maxGradNormOptionalRef, grad, step, lr, beta1, beta2,
-                                           weightDecay, eps, amsgrad, maximize), DFX_OUT());
+static aclnnStatus CheckGlobalGradNorm(const aclTensor* globalGradNormOptional, float clipMaxNorm) {
+  // 负数与NaN均视为非法
+  if (!(clipMaxNorm >= 0.0f)) {
+    OP_LOGE(ACLNN_ERR_PARAM_INVALID, "clipMaxNorm should be greater than or equal to 0, but got %f.", clipMaxNorm);
+    return ACLNN_ERR_PARAM_INVALID;
+  }
+  if (globalGradNormOptional == nullptr) {
+    return ACLNN_SUCCESS;
+  }
+  // 传入了全局范数就要求裁剪，clipMaxNorm为0不能静默地关闭裁剪
+  if (clipMaxNorm == 0.0f) {
+    OP_LOGE(ACLNN_ERR_PARAM_INVALID, "clipMaxNorm should be greater than 0 when globalGradNormOptional is given.");
+    return ACLNN_ERR_PARAM_INVALID;
+  }
+  OP_CHECK_DTYPE_NOT_MATCH(globalGradNormOptional, op::DataType::DT_FLOAT, return ACLNN_ERR_PARAM_INVALID);
+  if (globalGradNormOptional->GetViewShape().GetShapeSize() != 1) {
+    OP_LOGE(ACLNN_ERR_PARAM_INVALID, "globalGradNormOptional should have only one element, but got shape %s.",
+            op::ToString(globalGradNormOptional->GetViewShape()).GetString());
+    return ACLNN_ERR_PARAM_INVALID;
+  }
+  return ACLNN_SUCCESS;
+}
+
+static aclnnStatus ApplyAdamWV2GetWorkspaceSizeImpl(aclTensor* varRef, aclTensor* mRef, aclTensor* vRef,
+                                                    aclTensor* maxGradNormOptionalRef, const aclTensor* grad,
+                                                    const aclTensor* step, float lr, float beta1, float beta2,
+                                                    float weightDecay, float eps, bool amsgrad, bool maximize,
+                                                    const aclTensor* globalGradNormOptional, float clipMaxNorm,
+                                                    uint64_t* workspaceSize, aclOpExecutor** executor) {
   // 固定写法，创建OpExecutor
   auto uniqueExecutor = CREATE_EXECUTOR();
   CHECK_RET(uniqueExecutor.get() != nullptr, ACLNN_ERR_INNER_CREATE_EXECUTOR);
@@ -150,6 +172,8 @@ aclnnStatus aclnnApplyAdamWV2GetWorkspaceSize(aclTensor* varRef, aclTensor* mRef
   // 固定写法，参数检查
   auto ret = CheckParams(varRef, mRef, vRef, maxGradNormOptionalRef, grad, step, amsgrad);
   CHECK_RET(ret == ACLNN_SUCCESS, ret);
+  ret = CheckGlobalGradNorm(globalGradNormOptional, clipMaxNorm);
+  CHECK_RET(ret == ACLNN_SUCCESS, ret);
 
   // 空tensor场景处理
   if (varRef->IsEmpty()) {
@@ -197,9 +221,14 @@ aclnnStatus aclnnApplyAdamWV2GetWorkspaceSize(aclTensor* varRef, aclTensor* mRef
   auto gradCast = isNeedCast ? l0op::Cast(gradContiguous, DataType::DT_FLOAT, uniqueExecutor.get()) : gradContiguous;
   CHECK_RET(gradCast != nullptr, ACLNN_ERR_INNER_NULLPTR);
 
+  // 全局梯度范数由ForeachGlobalNorm在Device侧产出，仅读取一个float32值，不参与dtype转换
+  auto globalGradNormContiguous = globalGradNormOptional == nullptr ? nullptr :
+    l0op::Contiguous(globalGradNormOptional, uniqueExecutor.get());
+  CHECK_RET(globalGradNormOptional == nullptr || globalGradNormContiguous != nullptr, ACLNN_ERR_INNER_NULLPTR);
+
   // 固定写法，调用ApplyAdamWV2算子完成计算
   l0op::ApplyAdamWV2(varCast, mCast, vCast, maxGradNormCast, gradCast, step, lr, beta1, beta2, weightDecay, eps,
-                     amsgrad, maximize, uniqueExecutor.get());
+                     amsgrad, maximize, uniqueExecutor.get(), globalGradNormContiguous, clipMaxNorm);
 
   // 固定写法，将计算结果转换成输出的数据类型
   auto varOut = isNeedCast ? l0op::Cast(varCast, varRef->GetDataType(), uniqueExecutor.get()) : varCast;
@@ -236,12 +265,46 @@ aclnnStatus aclnnApplyAdamWV2GetWorkspaceSize(aclTensor* varRef, aclTensor* mRef
   return ACLNN_SUCCESS;
 }
 
+aclnnStatus aclnnApplyAdamWV2GetWorkspaceSize(aclTensor* varRef, aclTensor* mRef, aclTensor* vRef,
+                                              aclTensor* maxGradNormOptionalRef, const aclTensor* grad,
+                                              const aclTensor* step, float lr, float beta1, float beta2,
+                                              float weightDecay, float eps, bool amsgrad, bool maximize,
+                                              uint64_t* workspaceSize, aclOpExecutor** executor) {
+  L2_DFX_PHASE_1(aclnnApplyAdamWV2, DFX_IN(varRef, mRef, vRef, maxGradNormOptionalRef, grad, step, lr, beta1, beta2,
+                                           weightDecay, eps, amsgrad, maximize), DFX_OUT());
+  return ApplyAdamWV2GetWorkspaceSizeImpl(varRef, mRef, vRef, maxGradNormOptionalRef, grad, step, lr, beta1, beta2,
+                                          weightDecay, eps, amsgrad, maximize, nullptr, 0.0f, workspaceSize,
+                                          executor);
+}
+
+aclnnStatus aclnnApplyAdamWV2WithGradClipGetWorkspaceSize(aclTensor* varRef, aclTensor* mRef, aclTensor* vRef,
+                                                          aclTensor* maxGradNormOptionalRef, const aclTensor* grad,
+                                                          const aclTensor* step,
+                                                          const aclTensor* globalGradNormOptional, float lr,
+                                                          float beta1, float beta2, float weightDecay, float eps,
+                                                          bool amsgrad, bool maximize, float clipMaxNorm,
+                                                          uint64_t* workspaceSize, aclOpExecutor** executor) {
+  L2_DFX_PHASE_1(aclnnApplyAdamWV2WithGradClip, DFX_IN(varRef, mRef, vRef, maxGradNormOptionalRef, grad, step,
+                                                       globalGradNormOptional, lr, beta1, beta2, weightDecay, eps,
+                                                       amsgrad, maximize, clipMaxNorm), DFX_OUT());
+  return ApplyAdamWV2GetWorkspaceSizeImpl(varRef, mRef, vRef, maxGradNormOptionalRef, grad, step, lr, beta1, beta2,
+                                          weightDecay, eps, amsgrad, maximize, globalGradNormOptional, clipMaxNorm,
+                                          workspaceSize, executor);
+}
+
 aclnnStatus aclnnApplyAdamWV2(void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, aclrtStream stream) {
   L2_DFX_PHASE_2(aclnnApplyAdamWV2);
   // 固定写法，调用框架能力，完成计算
   return CommonOpExecutorRun(workspace, workspaceSize, executor, stream);
 }
 
+aclnnStatus aclnnApplyAdamWV2WithGradClip(void* workspace, uint64_t workspaceSize, aclOpExecutor* executor,
+                                          aclrtStream stream) {
+  L2_DFX_PHASE_2(aclnnApplyAdamWV2WithGradClip);
+  // 固定写法，调用框架能力，完成计算
+  return CommonOpExecutorRun(workspace, workspaceSize, executor, stream);
+}
+
 #ifdef __cplusplus
 }
 #endif
\ No newline at end of file
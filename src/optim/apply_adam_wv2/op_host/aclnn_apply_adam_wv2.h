@@ -36,6 +36,24 @@ __attribute__((visibility("default"))) aclnnStatus
 aclnnApplyAdamWV2(void* workspace, uint64_t workspaceSize, aclOpExecutor* executor,
                   aclrtStream stream);
 
+/**
+ * @brief aclnnApplyAdamWV2WithGradClip的第一段接口，根据具体的计算流程，计算workspace大小。
+ * 在aclnnApplyAdamWV2基础上增加全局梯度范数裁剪：globalGradNormOptional存在且clipMaxNorm大于0时，
+ * grad先乘以min(1, clipMaxNorm / (globalGradNorm + 1e-6))再参与更新。
+ * @domain aclnn_ops_train
+ */
+__attribute__((visibility("default"))) aclnnStatus
+aclnnApplyAdamWV2WithGradClipGetWorkspaceSize(aclTensor* varRef, aclTensor* mRef, aclTensor* vRef,
+                                              aclTensor* maxGradNormOptionalRef, const aclTensor* grad,
+                                              const aclTensor* step, const aclTensor* globalGradNormOptional,
+                                              float lr, float beta1, float beta2, float weightDecay, float eps,
+                                              bool amsgrad, bool maximize, float clipMaxNorm,
+                                              uint64_t* workspaceSize, aclOpExecutor** executor);
+/* @brief aclnnApplyAdamWV2WithGradClip的第二段接口，用于执行计算。 */
+__attribute__((visibility("default"))) aclnnStatus
+aclnnApplyAdamWV2WithGradClip(void* workspace, uint64_t workspaceSize, aclOpExecutor* executor,
+                              aclrtStream stream);
+
 #ifdef __cplusplus
 }
 #endif
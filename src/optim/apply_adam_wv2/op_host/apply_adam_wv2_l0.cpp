@@ -28,12 +28,15 @@ OP_TYPE_REGISTER(ApplyAdamWV2);
 // AICORE算子kernel
 void ApplyAdamWV2(aclTensor* varRef, aclTensor* mRef, aclTensor* vRef, aclTensor* maxGradNormOptionalRef,
                   const aclTensor* grad, const aclTensor* step, float lr, float beta1, float beta2,
-                  float weightDecay, float eps, bool amsgrad, bool maximize, aclOpExecutor *executor) {
+                  float weightDecay, float eps, bool amsgrad, bool maximize, aclOpExecutor *executor,
+                  const aclTensor* globalGradNormOptional, float clipMaxNorm) {
     L0_DFX(ApplyAdamWV2, varRef, mRef, vRef, maxGradNormOptionalRef, grad, step, lr, beta1, beta2, weightDecay, eps,
-           amsgrad, maximize);
+           amsgrad, maximize, globalGradNormOptional, clipMaxNorm);
     auto retAicore = ADD_TO_LAUNCHER_LIST_AICORE(ApplyAdamWV2,
-                                                 OP_INPUT(varRef, mRef, vRef, grad, step, maxGradNormOptionalRef),
-                                                 OP_ATTR(lr, beta1, beta2, weightDecay, eps, amsgrad, maximize));
+                                                 OP_INPUT(varRef, mRef, vRef, grad, step, maxGradNormOptionalRef,
+                                                          globalGradNormOptional),
+                                                 OP_ATTR(lr, beta1, beta2, weightDecay, eps, amsgrad, maximize,
+                                                         clipMaxNorm));
     if (retAicore != ACLNN_SUCCESS) {
         OP_LOGE(ACLNN_ERR_INNER_NULLPTR, "ApplyAdamWV2 ADD_TO_LAUNCHER_LIST_AICORE failed.");
     }
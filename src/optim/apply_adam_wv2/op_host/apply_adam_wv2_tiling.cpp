@@ -54,6 +54,7 @@ static const size_t INDEX_IN_V = 2;
 static const size_t INDEX_IN_GRAD = 3;
 static const size_t INDEX_IN_STEP = 4;
 static const size_t INDEX_IN_MAX_GRAD_NORM = 5;
+static const size_t INDEX_IN_GLOBAL_GRAD_NORM = 6;
 static const size_t INDEX_ATTR_LR = 0;
 static const size_t INDEX_ATTR_BETA1 = 1;
 static const size_t INDEX_ATTR_BETA2 = 2;
@@ -61,6 +62,7 @@ static const size_t INDEX_ATTR_WEIGHT_DECAY = 3;
 static const size_t INDEX_ATTR_EPS = 4;
 static const size_t INDEX_ATTR_AMSGRAD = 5;
 static const size_t INDEX_ATTR_MAXIMIZE = 6;
+static const size_t INDEX_ATTR_CLIP_MAX_NORM = 7;
 
 inline static ge::graphStatus ApplyAdamWV2SetTilingData(gert::TilingContext* context,
                                                         ApplyAdamWV2TilingData& tilingData) {
@@ -88,6 +90,8 @@ static void PrintTilingData(ApplyAdamWV2TilingData& tilingData) {
   OP_LOGD("ApplyAdamWV2", "amsgrad: %ld", tilingData.get_amsgrad());
   OP_LOGD("ApplyAdamWV2", "maximize: %ld", tilingData.get_maximize());
   OP_LOGD("ApplyAdamWV2", "tilingKey: %ld", tilingData.get_tilingKey());
+  OP_LOGD("ApplyAdamWV2", "clipGradNorm: %ld", tilingData.get_clipGradNorm());
+  OP_LOGD("ApplyAdamWV2", "clipMaxNorm: %f", tilingData.get_clipMaxNorm());
 }
 
 static inline bool IsInvalidType(const DataType dtype) {
@@ -156,6 +160,17 @@ static ge::graphStatus CheckInputDtype(const gert::TilingContext* context, Apply
     tilingParam.dtypeLst.push_back(inputDesc->GetDataType());
   }
 
+  // global_grad_norm is a single fp32 value produced on device, it does not take part in the dtype key
+  auto globalGradNormDesc = context->GetOptionalInputDesc(INDEX_IN_GLOBAL_GRAD_NORM);
+  OP_TILING_CHECK(globalGradNormDesc != nullptr && globalGradNormDesc->GetDataType() != ge::DT_FLOAT,
+    VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(),
+    "input global_grad_norm dtype only support fp32 currently, please check."), return ge::GRAPH_FAILED);
+  OP_TILING_CHECK(globalGradNormDesc != nullptr && !(tilingParam.clipMaxNorm > 0.0f),
+    VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(),
+    "attr clip_max_norm must be greater than 0 when global_grad_norm is given, but got %f.", tilingParam.clipMaxNorm),
+    return ge::GRAPH_FAILED);
+  tilingParam.clipGradNorm = globalGradNormDesc != nullptr ? 1 : 0;
+
   return ge::GRAPH_SUCCESS;
 }
 
@@ -204,11 +219,16 @@ static ge::graphStatus CheckInputShape(const gert::TilingContext* context) {
   OP_TILING_CHECK(stepShape.GetDimNum() != 1 || stepShape.GetDim(0) != 1,
     VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(), "step should have only one element, please check."),
     return ge::GRAPH_FAILED);
+
+  auto globalGradNormShape = context->GetOptionalInputShape(INDEX_IN_GLOBAL_GRAD_NORM);
+  OP_TILING_CHECK(globalGradNormShape != nullptr && globalGradNormShape->GetStorageShape().GetShapeSize() != 1,
+    VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(),
+    "global_grad_norm should have only one element, please check."), return ge::GRAPH_FAILED);
   return ge::GRAPH_SUCCESS;
 }
 
 static ge::graphStatus GetTilingAttr(const gert::TilingContext* context, ApplyAdamWV2TilingParam& tilingParam) {
-  // get attrs of lr, beta1, beta2, weight_decay, eps, amsgrad and maximize
+  // get attrs of lr, beta1, beta2, weight_decay, eps, amsgrad, maximize and clip_max_norm
   auto* attrs = context->GetAttrs();
   OPS_CHECK_NULL_WITH_CONTEXT(context, attrs);
 
@@ -244,6 +264,9 @@ static ge::graphStatus GetTilingAttr(const gert::TilingContext* context, ApplyAd
   int64_t maximizeInt = maximize ? 1 : 0;
   tilingParam.maximize = maximizeInt;
 
+  auto* attrClipMaxNorm = attrs->GetAttrPointer<float>(INDEX_ATTR_CLIP_MAX_NORM);
+  tilingParam.clipMaxNorm = attrClipMaxNorm == nullptr ? 0.0f : static_cast<float>(*attrClipMaxNorm);
+
   return ge::GRAPH_SUCCESS;
 }
 
@@ -327,6 +350,8 @@ static void GetTilingData(ApplyAdamWV2TilingData& tilingData, const ApplyAdamWV2
   tilingData.set_amsgrad(tilingParam.amsgrad);
   tilingData.set_maximize(tilingParam.maximize);
   tilingData.set_tilingKey(tilingParam.tilingKey);
+  tilingData.set_clipGradNorm(tilingParam.clipGradNorm);
+  tilingData.set_clipMaxNorm(tilingParam.clipMaxNorm);
 }
 
 ge::graphStatus Tiling4ApplyAdamWV2(gert::TilingContext* context) {
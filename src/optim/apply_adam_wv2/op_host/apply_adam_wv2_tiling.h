@@ -45,7 +45,9 @@ BEGIN_TILING_DATA_DEF(ApplyAdamWV2TilingData)
     TILING_DATA_FIELD_DEF(float, eps);
     TILING_DATA_FIELD_DEF(int64_t, amsgrad);
     TILING_DATA_FIELD_DEF(int64_t, maximize);
-    TILING_DATA_FIELD_DEF(int64_t, tilingKey)
+    TILING_DATA_FIELD_DEF(int64_t, tilingKey);
+    TILING_DATA_FIELD_DEF(int64_t, clipGradNorm);            // 是否使用global_grad_norm做梯度裁剪
+    TILING_DATA_FIELD_DEF(float, clipMaxNorm);
 END_TILING_DATA_DEF;
 
 REGISTER_TILING_DATA_CLASS(ApplyAdamWV2, ApplyAdamWV2TilingData)
@@ -72,6 +74,8 @@ struct ApplyAdamWV2TilingParam {
   float eps;
   int64_t amsgrad;
   int64_t maximize;
+  int64_t clipGradNorm{0};
+  float clipMaxNorm{0};
   std::vector<ge::DataType> dtypeLst;
   int64_t tilingKey;
   bool isDiffDtype{false};
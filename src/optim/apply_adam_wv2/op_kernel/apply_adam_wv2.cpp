@@ -18,7 +18,7 @@
 
 using namespace ApplyAdamWV2;
 extern "C" __global__ __aicore__ void apply_adam_w_v2(GM_ADDR var, GM_ADDR expAvg, GM_ADDR expAvgSq,
-    GM_ADDR grad, GM_ADDR step, GM_ADDR maxGradNorm, GM_ADDR workspace, GM_ADDR tiling) {
+    GM_ADDR grad, GM_ADDR step, GM_ADDR maxGradNorm, GM_ADDR globalGradNorm, GM_ADDR workspace, GM_ADDR tiling) {
     GM_ADDR userWS = GetUserWorkspace(workspace);
     if (userWS == nullptr) {
         return;
@@ -27,43 +27,43 @@ extern "C" __global__ __aicore__ void apply_adam_w_v2(GM_ADDR var, GM_ADDR expAv
     GET_TILING_DATA(tilingData, tiling);
     if (TILING_KEY_IS(101)) {
         ApplyAdamWV2B16<bfloat16_t, float> op;
-        op.Init(var, expAvg, expAvgSq, grad, step, maxGradNorm, userWS, &tilingData);
+        op.Init(var, expAvg, expAvgSq, grad, step, maxGradNorm, globalGradNorm, userWS, &tilingData);
         op.Process();
     } else if (TILING_KEY_IS(102)) {
         ApplyAdamWV2B16<bfloat16_t, int64_t> op;
-        op.Init(var, expAvg, expAvgSq, grad, step, maxGradNorm, userWS, &tilingData);
+        op.Init(var, expAvg, expAvgSq, grad, step, maxGradNorm, globalGradNorm, userWS, &tilingData);
         op.Process();
     } else if (TILING_KEY_IS(103)) {
         ApplyAdamWV2B16<half, float> op;
-        op.Init(var, expAvg, expAvgSq, grad, step, maxGradNorm, userWS, &tilingData);
+        op.Init(var, expAvg, expAvgSq, grad, step, maxGradNorm, globalGradNorm, userWS, &tilingData);
         op.Process();
     }  else if (TILING_KEY_IS(104)) {
         ApplyAdamWV2B16<half, int64_t> op;
-        op.Init(var, expAvg, expAvgSq, grad, step, maxGradNorm, userWS, &tilingData);
+        op.Init(var, expAvg, expAvgSq, grad, step, maxGradNorm, globalGradNorm, userWS, &tilingData);
         op.Process();
     } else if (TILING_KEY_IS(105)) {
         ApplyAdamWV2Fp<float, float> op;
-        op.Init(var, expAvg, expAvgSq, grad, step, maxGradNorm, userWS, &tilingData);
+        op.Init(var, expAvg, expAvgSq, grad, step, maxGradNorm, globalGradNorm, userWS, &tilingData);
         op.Process();
     } else if (TILING_KEY_IS(106)) {
         ApplyAdamWV2Fp<float, int64_t> op;
-        op.Init(var, expAvg, expAvgSq, grad, step, maxGradNorm, userWS, &tilingData);
+        op.Init(var, expAvg, expAvgSq, grad, step, maxGradNorm, globalGradNorm, userWS, &tilingData);
         op.Process();
     }  else if (TILING_KEY_IS(107)) {
         ApplyAdamWV2MixType<float, half, float> op;
-        op.Init(var, expAvg, expAvgSq, grad, step, maxGradNorm, userWS, &tilingData);
+        op.Init(var, expAvg, expAvgSq, grad, step, maxGradNorm, globalGradNorm, userWS, &tilingData);
         op.Process();
     }  else if (TILING_KEY_IS(108)) {
         ApplyAdamWV2MixType<float, half, int64_t> op;
-        op.Init(var, expAvg, expAvgSq, grad, step, maxGradNorm, userWS, &tilingData);
+        op.Init(var, expAvg, expAvgSq, grad, step, maxGradNorm, globalGradNorm, userWS, &tilingData);
         op.Process();
     } else if (TILING_KEY_IS(109)) {
         ApplyAdamWV2MixType<float, bfloat16_t, float> op;
-        op.Init(var, expAvg, expAvgSq, grad, step, maxGradNorm, userWS, &tilingData);
+        op.Init(var, expAvg, expAvgSq, grad, step, maxGradNorm, globalGradNorm, userWS, &tilingData);
         op.Process();
     }  else if (TILING_KEY_IS(110)) {
         ApplyAdamWV2MixType<float, bfloat16_t, int64_t> op;
-        op.Init(var, expAvg, expAvgSq, grad, step, maxGradNorm, userWS, &tilingData);
+        op.Init(var, expAvg, expAvgSq, grad, step, maxGradNorm, globalGradNorm, userWS, &tilingData);
         op.Process();
     }
 }
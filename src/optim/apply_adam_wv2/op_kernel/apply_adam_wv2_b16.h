@@ -26,7 +26,7 @@ class ApplyAdamWV2B16 {
 public:
     __aicore__ inline ApplyAdamWV2B16(){};
     __aicore__ inline void Init(GM_ADDR var, GM_ADDR expAvg, GM_ADDR expAvgSq, GM_ADDR grad, GM_ADDR step,
-                                GM_ADDR maxGradNorm,  GM_ADDR workspace, const ApplyAdamWV2TilingData* tilingData);
+                                GM_ADDR maxGradNorm, GM_ADDR globalGradNorm, GM_ADDR workspace, const ApplyAdamWV2TilingData* tilingData);
     __aicore__ inline void Process();
 
 protected:
@@ -67,6 +67,9 @@ private:
     float weightDecay_ = 0;
     float eps_ = 0;
     bool maximize_ = false;
+    bool scaleGrad_ = false;
+    int64_t clipGradNorm_ = 0;
+    float clipMaxNorm_ = 0;
     bool isBfloat16_ = false;
 
     float realWeightDecay_ = 0;
@@ -75,7 +78,7 @@ private:
     float oneSubBeta1_ = 0;
     float oneSubBeta2_ = 0;
     float realBeta2_ = 0;
-    float negOne_ = -1;
+    float gradScale_ = 1;
     float realEps_ = 0;
 
     int64_t varOffset_ = 0;
@@ -89,9 +92,12 @@ private:
 
 template <typename T, typename U>
 __aicore__ inline void ApplyAdamWV2B16<T, U>::Init(GM_ADDR var, GM_ADDR expAvg, GM_ADDR expAvgSq, GM_ADDR grad,
-    GM_ADDR step, GM_ADDR maxGradNorm,  GM_ADDR workspace, const ApplyAdamWV2TilingData* tilingData) {
+    GM_ADDR step, GM_ADDR maxGradNorm, GM_ADDR globalGradNorm, GM_ADDR workspace, const ApplyAdamWV2TilingData* tilingData) {
 
     this->ParseTilingData(tilingData);
+    float gradScale = GetGradScale(globalGradNorm, clipGradNorm_, clipMaxNorm_, maximize_);
+    scaleGrad_ = gradScale != 1.0f;
+    gradScale_ = static_cast<float>(gradScale);
     gmStep_.SetGlobalBuffer((__gm__ U*)step, 1);
     step_ = static_cast<float>(gmStep_.GetValue(0));
     int64_t gmOffset = blockIdx_  * numPerLoop_;
@@ -154,6 +160,9 @@ __aicore__ inline void ApplyAdamWV2B16<T, U>::ParseTilingData(const ApplyAdamWV2
         maximize_ = true;
     }
 
+    clipGradNorm_ = tilingData->clipGradNorm;
+    clipMaxNorm_ = tilingData->clipMaxNorm;
+
     if (tilingData->isBfloat16 != 0){
         isBfloat16_ = true;
     }
@@ -206,9 +215,9 @@ __aicore__ inline void ApplyAdamWV2B16<T, U>::Compute(int32_t dataCount) {
     Cast(inCastLocal[expAvgOffset_], dataLocal[expAvgOffset_], RoundMode::CAST_NONE, dataCount);
     Cast(inCastLocal[expAvgSqOffset_], dataLocal[expAvgSqOffset_], RoundMode::CAST_NONE, dataCount);
     pipe_barrier(PIPE_V);
-    if (maximize_){
-        // grad = -grad
-        Muls(inCastLocal[gradOffset_], inCastLocal[gradOffset_], negOne_, dataCount);
+    if (scaleGrad_){
+        // grad = grad * clip_coef (global grad norm clipping), negated when maximize
+        Muls(inCastLocal[gradOffset_], inCastLocal[gradOffset_], gradScale_, dataCount);
     }
     // param.mul_(1 - lr * weight_decay)
     Muls(outCastLocal[varOffset_], inCastLocal[varOffset_], realWeightDecay_, dataCount);
@@ -31,6 +31,32 @@ constexpr int32_t EXP_AVG_SQ_ORDER_IN_LOCAL_TENSOR = 2;
 constexpr int32_t MAX_GRAD_NORM_ORDER_IN_LOCAL_TENSOR = 3;
 constexpr int32_t GRAD_NORM_ORDER_IN_LOCAL_TENSOR = 4;
 constexpr int32_t MAX_GRAD_NORM_ORDER_IN_OUT_LOCAL_TENSOR = 3;
+constexpr float CLIP_NORM_EPS = 1e-6f;
+
+/**
+ * Scale applied to grad before the update: -1 for maximize, times clip_coef = min(1, max_norm / (norm + 1e-6))
+ * when global_grad_norm is given. The norm is read straight from GM (e.g. the output of ForeachGlobalNorm).
+ * A NaN or Inf norm gives a NaN scale, so the step propagates it into var/m/v instead of applying the
+ * gradients unclipped; callers that want to skip overflowed steps check the norm before launching.
+ */
+__aicore__ inline float GetGradScale(GM_ADDR globalGradNorm, int64_t clipGradNorm, float clipMaxNorm, bool maximize) {
+    float gradScale = 1.0f;
+    if (clipGradNorm != 0) {
+        GlobalTensor<float> gmGlobalGradNorm;
+        gmGlobalGradNorm.SetGlobalBuffer((__gm__ float*)globalGradNorm, 1);
+        float globalNorm = gmGlobalGradNorm.GetValue(0);
+        // norm - norm is 0 for a finite norm and NaN for NaN or Inf
+        float normDiff = globalNorm - globalNorm;
+        if (normDiff != 0.0f) {
+            return normDiff;
+        }
+        float clipCoef = clipMaxNorm / (globalNorm + CLIP_NORM_EPS);
+        if (clipCoef < 1.0f) {
+            gradScale = clipCoef;
+        }
+    }
+    return maximize ? -gradScale : gradScale;
+}
 }  // namespace ApplyAdamWV2
 
 #endif  // APPLYADAM_W_V2_BASE_H
\ No newline at end of file
@@ -24,7 +24,7 @@ class ApplyAdamWV2Fp {
 public:
     __aicore__ inline ApplyAdamWV2Fp(){};
     __aicore__ inline void Init(GM_ADDR var, GM_ADDR expAvg, GM_ADDR expAvgSq, GM_ADDR grad, GM_ADDR step,
-                                GM_ADDR maxGradNorm,  GM_ADDR workspace, const ApplyAdamWV2TilingData* tilingData);
+                                GM_ADDR maxGradNorm, GM_ADDR globalGradNorm, GM_ADDR workspace, const ApplyAdamWV2TilingData* tilingData);
     __aicore__ inline void Process();
 
 protected:
@@ -63,6 +63,9 @@ private:
     float weightDecay_ = 0;
     float eps_ = 0;
     bool maximize_ = false;
+    bool scaleGrad_ = false;
+    int64_t clipGradNorm_ = 0;
+    float clipMaxNorm_ = 0;
 
     T realWeightDecay_ = 0;
     T stepSize_ = 0;
@@ -70,7 +73,7 @@ private:
     T oneSubBeta1_ = 0;
     T oneSubBeta2_ = 0;
     T realBeta2_ = 0;
-    T negOne_ = -1;
+    T gradScale_ = 1;
     T realEps_ = 0;
 
     int64_t varOffset_ = 0;
@@ -84,9 +87,12 @@ private:
 
 template <typename T, typename U>
 __aicore__ inline void ApplyAdamWV2Fp<T, U>::Init(GM_ADDR var, GM_ADDR expAvg, GM_ADDR expAvgSq, GM_ADDR grad,
-    GM_ADDR step, GM_ADDR maxGradNorm,  GM_ADDR workspace, const ApplyAdamWV2TilingData* tilingData) {
+    GM_ADDR step, GM_ADDR maxGradNorm, GM_ADDR globalGradNorm, GM_ADDR workspace, const ApplyAdamWV2TilingData* tilingData) {
 
     this->ParseTilingData(tilingData);
+    float gradScale = GetGradScale(globalGradNorm, clipGradNorm_, clipMaxNorm_, maximize_);
+    scaleGrad_ = gradScale != 1.0f;
+    gradScale_ = static_cast<T>(gradScale);
     gmStep_.SetGlobalBuffer((__gm__ U*)step, 1);
     step_ = static_cast<float>(gmStep_.GetValue(0));
     int64_t gmOffset = blockIdx_  * numPerLoop_;
@@ -147,6 +153,9 @@ __aicore__ inline void ApplyAdamWV2Fp<T, U>::ParseTilingData(
     if (tilingData->maximize != 0){
         maximize_ = true;
     }
+
+    clipGradNorm_ = tilingData->clipGradNorm;
+    clipMaxNorm_ = tilingData->clipMaxNorm;
 }
 
 template <typename T, typename U>
@@ -190,9 +199,9 @@ __aicore__ inline void ApplyAdamWV2Fp<T, U>::Compute(int32_t dataCount) {
     LocalTensor<T> dataLocal = inQueue_.DeQue<T>();
     LocalTensor<T> dataOutLocal = outQueue_.AllocTensor<T>();
     pipe_barrier(PIPE_V);
-    if (maximize_){
-        // grad = -grad
-        Muls(dataLocal[gradOffset_], dataLocal[gradOffset_], negOne_, dataCount);
+    if (scaleGrad_){
+        // grad = grad * clip_coef (global grad norm clipping), negated when maximize
+        Muls(dataLocal[gradOffset_], dataLocal[gradOffset_], gradScale_, dataCount);
     }
     pipe_barrier(PIPE_V);
     // param.mul_(1 - lr * weight_decay)
@@ -36,7 +36,7 @@ class ApplyAdamWV2MixType {
 public:
     __aicore__ inline ApplyAdamWV2MixType(){};
     __aicore__ inline void Init(GM_ADDR var, GM_ADDR expAvg, GM_ADDR expAvgSq, GM_ADDR grad, GM_ADDR step,
-                                GM_ADDR maxGradNorm, GM_ADDR workspace, const ApplyAdamWV2TilingData* tilingData);
+                                GM_ADDR maxGradNorm, GM_ADDR globalGradNorm, GM_ADDR workspace, const ApplyAdamWV2TilingData* tilingData);
     __aicore__ inline void Process();
 
 protected:
@@ -80,6 +80,9 @@ private:
     float weightDecay_ = 0;
     float eps_ = 0;
     bool maximize_ = false;
+    bool scaleGrad_ = false;
+    int64_t clipGradNorm_ = 0;
+    float clipMaxNorm_ = 0;
     bool isBfloat16_ = false;
 
     T realWeightDecay_ = 0;
@@ -88,7 +91,7 @@ private:
     T oneSubBeta1_ = 0;
     T oneSubBeta2_ = 0;
     T realBeta2_ = 0;
-    T negOne_ = -1;
+    T gradScale_ = 1;
 
     int64_t varOffset_ = 0;
     int64_t expAvgOffset_ = 0;
@@ -117,9 +120,12 @@ __aicore__ inline float ApplyAdamWV2MixType<T, U, Z>::ScalarPow(float x, float y
 
 template <typename T, typename U, typename Z>
 __aicore__ inline void ApplyAdamWV2MixType<T, U, Z>::Init(GM_ADDR var, GM_ADDR expAvg, GM_ADDR expAvgSq, GM_ADDR grad,
-    GM_ADDR step, GM_ADDR maxGradNorm, GM_ADDR workspace, const ApplyAdamWV2TilingData* tilingData) {
+    GM_ADDR step, GM_ADDR maxGradNorm, GM_ADDR globalGradNorm, GM_ADDR workspace, const ApplyAdamWV2TilingData* tilingData) {
 
     this->ParseTilingData(tilingData);
+    float gradScale = GetGradScale(globalGradNorm, clipGradNorm_, clipMaxNorm_, maximize_);
+    scaleGrad_ = gradScale != 1.0f;
+    gradScale_ = static_cast<T>(gradScale);
 
     gmStep_.SetGlobalBuffer((__gm__ Z*)step, 1);
     step_ = static_cast<float>(gmStep_.GetValue(0));
@@ -185,6 +191,9 @@ __aicore__ inline void ApplyAdamWV2MixType<T, U, Z>::ParseTilingData(const Apply
         maximize_ = true;
     }
 
+    clipGradNorm_ = tilingData->clipGradNorm;
+    clipMaxNorm_ = tilingData->clipMaxNorm;
+
     if (tilingData->isBfloat16 != 0){
         isBfloat16_ = true;
     }
@@ -223,9 +232,9 @@ __aicore__ inline void ApplyAdamWV2MixType<T, U, Z>::Compute(int32_t realProcCou
     pipe_barrier(PIPE_V);
     Cast(resultTempLocal1, dataLocalU[gradOffset_], RoundMode::CAST_NONE, realProcCount);
     pipe_barrier(PIPE_V);
-    if (maximize_){
-        // grad = -grad
-        Muls(resultTempLocal1, resultTempLocal1, negOne_, realProcCount);
+    if (scaleGrad_){
+        // grad = grad * clip_coef (global grad norm clipping), negated when maximize
+        Muls(resultTempLocal1, resultTempLocal1, gradScale_, realProcCount);
     }
     // param.mul_(1 - lr * weight_decay)
     pipe_barrier(PIPE_V);
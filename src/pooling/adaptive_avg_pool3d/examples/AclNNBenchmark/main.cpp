@@ -0,0 +1,249 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * \file main.cpp
+ * \brief
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "acl/acl.h"
+#include "aclnn_adaptive_avg_pool3d.h"
+#include "aclnn_avgpool3d.h"
+
+#define SUCCESS 0
+#define FAILED 1
+
+#define INFO_LOG(fmt, args...) fprintf(stdout, "[INFO]  " fmt "\n", ##args)
+#define ERROR_LOG(fmt, args...) fprintf(stderr, "[ERROR]  " fmt "\n", ##args)
+
+#define CHECK_RET(cond, return_expr) \
+    do {                             \
+        if (!(cond)) {               \
+            return_expr;             \
+        }                            \
+    } while (0)
+
+namespace {
+constexpr int32_t WARMUP_NUM = 5;
+constexpr int32_t DEFAULT_LOOP_NUM = 50;
+
+enum class PoolType {
+    ADAPTIVE_AVG,
+    AVG,
+};
+
+struct BenchCase {
+    const char *name;
+    PoolType type;
+    std::vector<int64_t> inShape;   // NCDHW
+    std::vector<int64_t> outDHW;    // AdaptiveAvgPool3d的outputSize，AvgPool3d由kernel/stride/pad推导
+    std::vector<int64_t> kernel;
+    std::vector<int64_t> stride;
+    std::vector<int64_t> pad;
+};
+
+int64_t GetShapeSize(const std::vector<int64_t> &shape)
+{
+    int64_t shapeSize = 1;
+    for (auto i : shape) {
+        shapeSize *= i;
+    }
+    return shapeSize;
+}
+
+std::vector<int64_t> GetOutShape(const BenchCase &benchCase)
+{
+    std::vector<int64_t> outShape = {benchCase.inShape[0], benchCase.inShape[1]};
+    for (size_t i = 0; i < 3; i++) {
+        if (benchCase.type == PoolType::ADAPTIVE_AVG) {
+            outShape.push_back(benchCase.outDHW[i]);
+        } else {
+            outShape.push_back(
+                (benchCase.inShape[i + 2] + 2 * benchCase.pad[i] - benchCase.kernel[i]) / benchCase.stride[i] + 1);
+        }
+    }
+    return outShape;
+}
+
+int CreateDeviceTensor(const std::vector<int64_t> &shape, aclDataType dataType, size_t dtypeSize, void **deviceAddr,
+                       aclTensor **tensor)
+{
+    size_t size = GetShapeSize(shape) * dtypeSize;
+    auto ret = aclrtMalloc(deviceAddr, size, ACL_MEM_MALLOC_HUGE_FIRST);
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("aclrtMalloc failed. ERROR: %d", ret); return FAILED);
+    // 耗时与数值无关，输入置0即可
+    ret = aclrtMemset(*deviceAddr, size, 0, size);
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("aclrtMemset failed. ERROR: %d", ret); return FAILED);
+    std::vector<int64_t> strides(shape.size(), 1);
+    for (int64_t i = static_cast<int64_t>(shape.size()) - 2; i >= 0; i--) {
+        strides[i] = shape[i + 1] * strides[i + 1];
+    }
+    *tensor = aclCreateTensor(shape.data(), shape.size(), dataType, strides.data(), 0, aclFormat::ACL_FORMAT_NCDHW,
+                              shape.data(), shape.size(), *deviceAddr);
+    return SUCCESS;
+}
+
+int RunOnce(const BenchCase &benchCase, aclTensor *input, aclTensor *out, aclrtStream stream, void **workspaceAddr,
+            uint64_t &workspaceCap)
+{
+    uint64_t workspaceSize = 0;
+    aclOpExecutor *executor = nullptr;
+    aclnnStatus ret;
+    if (benchCase.type == PoolType::ADAPTIVE_AVG) {
+        aclIntArray *outputSize = aclCreateIntArray(benchCase.outDHW.data(), benchCase.outDHW.size());
+        ret = aclnnAdaptiveAvgPool3dGetWorkspaceSize(input, outputSize, out, &workspaceSize, &executor);
+        aclDestroyIntArray(outputSize);
+    } else {
+        aclIntArray *kernel = aclCreateIntArray(benchCase.kernel.data(), benchCase.kernel.size());
+        aclIntArray *stride = aclCreateIntArray(benchCase.stride.data(), benchCase.stride.size());
+        aclIntArray *pad = aclCreateIntArray(benchCase.pad.data(), benchCase.pad.size());
+        ret = aclnnAvgPool3dGetWorkspaceSize(input, kernel, stride, pad, false, true, 0, out, &workspaceSize,
+                                             &executor);
+        aclDestroyIntArray(kernel);
+        aclDestroyIntArray(stride);
+        aclDestroyIntArray(pad);
+    }
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("%s GetWorkspaceSize failed. ERROR: %d", benchCase.name, ret);
+              return FAILED);
+    if (workspaceSize > workspaceCap) {
+        if (*workspaceAddr != nullptr) {
+            aclrtFree(*workspaceAddr);
+        }
+        ret = aclrtMalloc(workspaceAddr, workspaceSize, ACL_MEM_MALLOC_HUGE_FIRST);
+        CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("allocate workspace failed. ERROR: %d", ret); return FAILED);
+        workspaceCap = workspaceSize;
+    }
+    if (benchCase.type == PoolType::ADAPTIVE_AVG) {
+        ret = aclnnAdaptiveAvgPool3d(*workspaceAddr, workspaceSize, executor, stream);
+    } else {
+        ret = aclnnAvgPool3d(*workspaceAddr, workspaceSize, executor, stream);
+    }
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("%s launch failed. ERROR: %d", benchCase.name, ret); return FAILED);
+    return SUCCESS;
+}
+
+int RunCase(const BenchCase &benchCase, aclDataType dataType, size_t dtypeSize, int32_t loopNum, aclrtStream stream)
+{
+    std::vector<int64_t> outShape = GetOutShape(benchCase);
+    void *inputDeviceAddr = nullptr;
+    void *outDeviceAddr = nullptr;
+    aclTensor *input = nullptr;
+    aclTensor *out = nullptr;
+    auto ret = CreateDeviceTensor(benchCase.inShape, dataType, dtypeSize, &inputDeviceAddr, &input);
+    CHECK_RET(ret == SUCCESS, return FAILED);
+    ret = CreateDeviceTensor(outShape, dataType, dtypeSize, &outDeviceAddr, &out);
+    CHECK_RET(ret == SUCCESS, return FAILED);
+
+    void *workspaceAddr = nullptr;
+    uint64_t workspaceCap = 0;
+    for (int32_t i = 0; i < WARMUP_NUM && ret == SUCCESS; i++) {
+        ret = RunOnce(benchCase, input, out, stream, &workspaceAddr, workspaceCap);
+    }
+    aclrtEvent start = nullptr;
+    aclrtEvent end = nullptr;
+    aclrtCreateEvent(&start);
+    aclrtCreateEvent(&end);
+    aclrtSynchronizeStream(stream);
+    aclrtRecordEvent(start, stream);
+    for (int32_t i = 0; i < loopNum && ret == SUCCESS; i++) {
+        ret = RunOnce(benchCase, input, out, stream, &workspaceAddr, workspaceCap);
+    }
+    aclrtRecordEvent(end, stream);
+    aclrtSynchronizeStream(stream);
+
+    if (ret == SUCCESS) {
+        float costMs = 0.0f;
+        aclrtEventElapsedTime(&costMs, start, end);
+        double avgUs = costMs * 1000.0 / loopNum;
+        // 按读入输入和写出输出各一次估算带宽
+        double bytes = static_cast<double>(GetShapeSize(benchCase.inShape) + GetShapeSize(outShape)) * dtypeSize;
+        printf("%-24s %4ld %4ld %4ld %4ld %4ld -> %4ld %4ld %4ld %10.2f %8.2f\n", benchCase.name,
+               benchCase.inShape[0], benchCase.inShape[1], benchCase.inShape[2], benchCase.inShape[3],
+               benchCase.inShape[4], outShape[2], outShape[3], outShape[4], avgUs, bytes / avgUs / 1000.0);
+    }
+
+    aclrtDestroyEvent(start);
+    aclrtDestroyEvent(end);
+    aclDestroyTensor(input);
+    aclDestroyTensor(out);
+    aclrtFree(inputDeviceAddr);
+    aclrtFree(outDeviceAddr);
+    if (workspaceAddr != nullptr) {
+        aclrtFree(workspaceAddr);
+    }
+    return ret;
+}
+}  // namespace
+
+int main(int argc, char **argv)
+{
+    std::string dtype = argc > 1 ? argv[1] : "float16";
+    int32_t loopNum = argc > 2 ? atoi(argv[2]) : DEFAULT_LOOP_NUM;
+    CHECK_RET(loopNum > 0, ERROR_LOG("loop num should be positive, got %d", loopNum); return FAILED);
+    aclDataType dataType = ACL_FLOAT16;
+    size_t dtypeSize = 2;
+    if (dtype == "float32") {
+        dataType = ACL_FLOAT;
+        dtypeSize = 4;
+    } else if (dtype == "bfloat16") {
+        dataType = ACL_BF16;
+    } else if (dtype != "float16") {
+        ERROR_LOG("unsupported dtype %s", dtype.c_str());
+        return FAILED;
+    }
+
+    int32_t deviceId = 0;
+    aclrtStream stream;
+    auto ret = aclInit(nullptr);
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("aclInit failed. ERROR: %d", ret); return FAILED);
+    ret = aclrtSetDevice(deviceId);
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("aclrtSetDevice failed. ERROR: %d", ret); return FAILED);
+    ret = aclrtCreateStream(&stream);
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("aclrtCreateStream failed. ERROR: %d", ret); return FAILED);
+
+    // 视频类(小D、中等HW、通道较多)与体数据类(大DHW、通道较少)，各含一个全局平均场景
+    const std::vector<BenchCase> cases = {
+        {"video_adaptive_7x7", PoolType::ADAPTIVE_AVG, {8, 64, 16, 56, 56}, {8, 7, 7}, {}, {}, {}},
+        {"video_adaptive_global", PoolType::ADAPTIVE_AVG, {8, 512, 8, 14, 14}, {1, 1, 1}, {}, {}, {}},
+        {"video_adaptive_temporal", PoolType::ADAPTIVE_AVG, {4, 2048, 16, 7, 7}, {16, 1, 1}, {}, {}, {}},
+        {"volume_adaptive_half", PoolType::ADAPTIVE_AVG, {1, 32, 128, 128, 128}, {64, 64, 64}, {}, {}, {}},
+        {"volume_adaptive_global", PoolType::ADAPTIVE_AVG, {2, 256, 32, 32, 32}, {1, 1, 1}, {}, {}, {}},
+        {"video_avg_k3s2", PoolType::AVG, {8, 64, 16, 56, 56}, {}, {3, 3, 3}, {2, 2, 2}, {1, 1, 1}},
+        {"video_avg_global_hw", PoolType::AVG, {8, 512, 8, 14, 14}, {}, {2, 14, 14}, {2, 14, 14}, {0, 0, 0}},
+        {"volume_avg_k2s2", PoolType::AVG, {1, 32, 128, 128, 128}, {}, {2, 2, 2}, {2, 2, 2}, {0, 0, 0}},
+        {"volume_avg_k3s1_c1024", PoolType::AVG, {1, 1024, 16, 16, 16}, {}, {3, 3, 3}, {1, 1, 1}, {1, 1, 1}},
+    };
+
+    INFO_LOG("pooling benchmark, dtype %s, loop %d", dtype.c_str(), loopNum);
+    printf("%-24s %4s %4s %4s %4s %4s    %4s %4s %4s %10s %8s\n", "case", "N", "C", "D", "H", "W", "oD", "oH",
+           "oW", "time(us)", "GB/s");
+    int32_t failNum = 0;
+    for (const auto &benchCase : cases) {
+        if (RunCase(benchCase, dataType, dtypeSize, loopNum, stream) != SUCCESS) {
+            failNum++;
+        }
+    }
+
+    aclrtDestroyStream(stream);
+    aclrtResetDevice(deviceId);
+    aclFinalize();
+    if (failNum != 0) {
+        ERROR_LOG("%d cases failed", failNum);
+        return FAILED;
+    }
+    return SUCCESS;
+}
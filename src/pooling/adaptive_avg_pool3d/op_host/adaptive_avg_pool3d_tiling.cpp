@@ -89,6 +89,7 @@ struct TilingParams {
   uint64_t maxWindowWLength = 0;
   uint64_t inputTileNum = 0;
   uint64_t atomicAddNum = 0;
+  uint64_t runPointNum = 0;
 
   uint32_t ubSize = 0;
   uint32_t coreNum = 0;
@@ -120,6 +121,24 @@ static void ComputeCoreTilingStrategy(TilingParams& params, int32_t& usedCoreNum
   }
 }
 
+static void ComputeSplitCTiling(TilingParams& params, uint64_t alignC, uint64_t alignNum, int32_t dataTypeSize,
+                                int32_t needCast) {
+  // 输入块与输出双缓冲，fp32累加；非fp32时输入块另需一份fp32副本
+  uint64_t tileLen = params.ubSize / (4 * dataTypeSize + sizeof(float) * (1 + needCast)) / alignNum * alignNum;
+  params.cTileLength = alignC > tileLen ? tileLen : alignC;
+  uint64_t tileTailLen = params.dimC % params.cTileLength;
+  params.atomicAddNum = (tileTailLen < alignNum) && (tileTailLen != 0) ? 1 : 0;
+  if (params.dimC < alignNum) {
+    params.atomicAddNum = (alignC - 1) / params.dimC;
+  }
+
+  uint64_t fixedSize = params.cTileLength * (2 * dataTypeSize + sizeof(float));
+  uint64_t runSize = params.cTileLength * (2 * dataTypeSize + sizeof(float) * needCast);
+  uint64_t runPointNum = (params.ubSize - fixedSize) / runSize;
+  runPointNum = runPointNum < MAX_INPUT_TILE_NUM ? runPointNum : MAX_INPUT_TILE_NUM;
+  params.runPointNum = runPointNum > 1 ? runPointNum : 1;
+}
+
 static void ComputeUBTilingStrategy(TilingParams& params, int32_t& mode) {
   int32_t dataTypeSize = params.dataTypeKey == FP32_DTYPE_KEY ? 4 : 2;
   int32_t needCast = params.dataTypeKey == FP32_DTYPE_KEY ? 0 : 1;
@@ -130,12 +149,12 @@ static void ComputeUBTilingStrategy(TilingParams& params, int32_t& mode) {
   uint64_t tileLen = params.ubSize / (2 * dataTypeSize + sizeof(float) * (1 + needCast)) / alignNum * alignNum;
   uint64_t alignC = (params.dimC + alignNum - 1) / alignNum * alignNum;
   
+  // 输出HW为1时每个窗口在DHW上连续，split_c按整段搬运
+  bool globalHW = params.outH == 1 && params.outW == 1;
   uint64_t doubleC = 2 * alignC;
-  if (doubleC > tileLen) {
+  if (doubleC > tileLen || globalHW) {
     mode = MODE_SPLIT_C;
-    params.cTileLength = alignC > tileLen ? tileLen : alignC;
-    uint64_t tileTailLen = params.dimC % params.cTileLength;
-    params.atomicAddNum = (tileTailLen < alignNum) && (tileTailLen != 0) ? 1 : 0;
+    ComputeSplitCTiling(params, alignC, alignNum, dataTypeSize, needCast);
     return;
   }
 
@@ -161,7 +180,7 @@ static void ComputeUBTilingStrategy(TilingParams& params, int32_t& mode) {
 
   if (windowWNum == 0) {
     mode = MODE_SPLIT_C;
-    params.cTileLength = alignC > tileLen ? tileLen : alignC;
+    ComputeSplitCTiling(params, alignC, alignNum, dataTypeSize, needCast);
   }
 }
 
@@ -183,6 +202,7 @@ static void SetTiling(const TilingParams& params, AdaptiveAvgPool3dTilingData& t
   tiling.set_maxWindowWLength(params.maxWindowWLength);
   tiling.set_inputTileNum(params.inputTileNum);
   tiling.set_atomicAddNum(params.atomicAddNum);
+  tiling.set_runPointNum(params.runPointNum);
 }
 
 static void PrintTiling(const gert::TilingContext* context, AdaptiveAvgPool3dTilingData& tiling,
@@ -207,6 +227,7 @@ static void PrintTiling(const gert::TilingContext* context, AdaptiveAvgPool3dTil
   OP_LOGD(nodeName, "maxWindowWLength:   %ld.", tiling.get_maxWindowWLength());
   OP_LOGD(nodeName, "inputTileNum:       %ld.", tiling.get_inputTileNum());
   OP_LOGD(nodeName, "atomicAddNum:       %ld.", tiling.get_atomicAddNum());
+  OP_LOGD(nodeName, "runPointNum:        %ld.", tiling.get_runPointNum());
 }
 
 static bool GetDataTypeKey(ge::DataType dataType, int32_t& dataTypeKey) {
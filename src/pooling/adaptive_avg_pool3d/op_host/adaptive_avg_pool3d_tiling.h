@@ -37,6 +37,7 @@ BEGIN_TILING_DATA_DEF(AdaptiveAvgPool3dTilingData)
   TILING_DATA_FIELD_DEF(uint64_t, maxWindowWLength);
   TILING_DATA_FIELD_DEF(uint64_t, inputTileNum);
   TILING_DATA_FIELD_DEF(uint64_t, atomicAddNum);
+  TILING_DATA_FIELD_DEF(uint64_t, runPointNum);
 END_TILING_DATA_DEF;
 
 struct AdaptiveAvgPool3dCompileInfo {
@@ -16,6 +16,7 @@
 #include "kernel_operator.h"
 
 #include "adaptive_avg_pool3d_split_c.h"
+#include "adaptive_avg_pool3d_engine.h"
 #include "adaptive_avg_pool3d_multi_w.h"
 #include "adaptive_avg_pool3d_split_w.h"
 
@@ -31,14 +32,19 @@
 extern "C" __global__ __aicore__ void adaptive_avg_pool3d(
     GM_ADDR x, GM_ADDR y, GM_ADDR workspace, GM_ADDR tiling) {
   GET_TILING_DATA(tilingData, tiling);
-  if (TILING_KEY_IS(11)) {
-    DISPATCH_OP_IMPL(KernelAdaptiveAvgPool3dSplitC, half, 1);
 #if __CCE_AICORE__ >= 220
+  if (TILING_KEY_IS(11)) {
+    DISPATCH_OP_IMPL(KernelAdaptiveAvgPool3dEngine, half, 2);
   } else if (TILING_KEY_IS(10)) {
-    DISPATCH_OP_IMPL(KernelAdaptiveAvgPool3dSplitC, bfloat16_t, 1);
-#endif
+    DISPATCH_OP_IMPL(KernelAdaptiveAvgPool3dEngine, bfloat16_t, 2);
+  } else if (TILING_KEY_IS(12)) {
+    DISPATCH_OP_IMPL(KernelAdaptiveAvgPool3dEngine, float, 2);
+#else
+  if (TILING_KEY_IS(11)) {
+    DISPATCH_OP_IMPL(KernelAdaptiveAvgPool3dSplitC, half, 1);
   } else if (TILING_KEY_IS(12)) {
     DISPATCH_OP_IMPL(KernelAdaptiveAvgPool3dSplitC, float, 1);
+#endif
 #if __CCE_AICORE__ >= 220
   } else if (TILING_KEY_IS(20)) {
     DISPATCH_OP_IMPL(KernelAdaptiveAvgPool3dSplitW, bfloat16_t, 1);
@@ -0,0 +1,63 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * \file adaptive_avg_pool3d_engine.h
+ * \brief
+ */
+
+#ifndef ADAPTIVE_AVG_POOL3D_ENGINE_H_
+#define ADAPTIVE_AVG_POOL3D_ENGINE_H_
+
+#include "kernel_operator.h"
+#include "pool_engine_ndhwc.h"
+
+template <typename T, int32_t QUEUE_DEPTH>
+class KernelAdaptiveAvgPool3dEngine {
+public:
+  __aicore__ inline KernelAdaptiveAvgPool3dEngine() {}
+  __aicore__ inline void Init(GM_ADDR x, GM_ADDR y, GM_ADDR workspace,
+                              const AdaptiveAvgPool3dTilingData* tiling, TPipe* pipe);
+  __aicore__ inline void Process();
+
+private:
+  PoolEngine::KernelPoolNdhwcSplitC<T, PoolEngine::AdaptiveWindow, PoolEngine::AvgReducer, QUEUE_DEPTH> engine;
+};
+
+template <typename T, int32_t QUEUE_DEPTH>
+__aicore__ inline void KernelAdaptiveAvgPool3dEngine<T, QUEUE_DEPTH>::Init(
+    GM_ADDR x, GM_ADDR y, GM_ADDR workspace, const AdaptiveAvgPool3dTilingData* tiling, TPipe* pipe) {
+  PoolEngine::AdaptiveWindow window;
+  window.Init(tiling->inD, tiling->inH, tiling->inW, tiling->outD, tiling->outH, tiling->outW);
+
+  PoolEngine::PoolEngineParam param;
+  param.inD = tiling->inD;
+  param.inH = tiling->inH;
+  param.inW = tiling->inW;
+  param.outD = tiling->outD;
+  param.outH = tiling->outH;
+  param.outW = tiling->outW;
+  param.channels = tiling->dimC;
+  param.tileC = tiling->cTileLength;
+  param.runPointNum = tiling->runPointNum;
+  param.outputPointNum = GetBlockIdx() < tiling->formerNum ? tiling->formerLength : tiling->tailLength;
+  param.outputPointOffset = GetBlockIdx() < tiling->formerNum
+    ? tiling->formerLength * GetBlockIdx()
+    : tiling->formerNum * tiling->formerLength + tiling->tailLength * (GetBlockIdx() - tiling->formerNum);
+
+  engine.Init(x, y, param, window, pipe);
+}
+
+template <typename T, int32_t QUEUE_DEPTH>
+__aicore__ inline void KernelAdaptiveAvgPool3dEngine<T, QUEUE_DEPTH>::Process() {
+  engine.Process();
+}
+
+#endif // ADAPTIVE_AVG_POOL3D_ENGINE_H_
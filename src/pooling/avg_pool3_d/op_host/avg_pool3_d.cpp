@@ -94,6 +94,7 @@ struct TilingParams {
   uint64_t windowWNum = 0;
   uint64_t tileInput = 0;
   uint64_t tileHW = 0;
+  uint64_t runPointNum = 0;
 
   uint32_t ubSize = 0;
   uint32_t coreNum = 0;
@@ -156,6 +157,18 @@ static void ComputeCoreTilingStrategy(TilingParams& params, int32_t& usedCoreNum
   }
 }
 
+static void ComputeSplitCTiling(TilingParams& params, uint64_t alignC, uint64_t alignNum, uint64_t dataTypeSize) {
+  // 输入块与输出双缓冲，fp32累加；非fp32时输入块另需一份fp32副本
+  uint64_t castSize = dataTypeSize == sizeof(float) ? 0U : sizeof(float);
+  uint64_t tileLen = params.ubSize / (dataTypeSize * 4U + sizeof(float) + castSize) / alignNum * alignNum;
+  params.tileC = alignC > tileLen ? tileLen : alignC;
+
+  uint64_t fixedSize = params.tileC * (dataTypeSize * 2U + sizeof(float));
+  uint64_t runPointNum = (params.ubSize - fixedSize) / (params.tileC * (dataTypeSize * 2U + castSize));
+  runPointNum = runPointNum < MAX_TILE_NUM ? runPointNum : MAX_TILE_NUM;
+  params.runPointNum = runPointNum > 1U ? runPointNum : 1U;
+}
+
 static void ComputeUBTilingStrategy(TilingParams& params, int32_t& mode) {
   int32_t dataTypeSize = params.dataTypeKey == FP32_DTYPE_KEY ? 4 : 2;
 
@@ -171,10 +184,12 @@ static void ComputeUBTilingStrategy(TilingParams& params, int32_t& mode) {
 
   uint64_t alignC = (params.inC + alignNum - 1) / alignNum * alignNum;
   
+  // 窗口覆盖整个HW平面时，一个窗口在DHW上连续，split_c按整段搬运
+  bool globalHW = params.kH == params.inH && params.kW == params.inW && params.pH == 0U && params.pW == 0U;
   uint64_t doubleC = 2U * alignC;
-  if (doubleC > tileLen) {
+  if (doubleC > tileLen || globalHW) {
     mode = MODE_SPLIT_C;
-    params.tileC = alignC > tileLen ? tileLen : alignC;
+    ComputeSplitCTiling(params, alignC, alignNum, dataTypeSize);
     return;
   }
 
@@ -201,7 +216,7 @@ static void ComputeUBTilingStrategy(TilingParams& params, int32_t& mode) {
 
   if (windowWNum == 0) {
     mode = MODE_SPLIT_C;
-    params.tileC = alignC > tileLen ? tileLen : alignC;
+    ComputeSplitCTiling(params, alignC, alignNum, dataTypeSize);
   }
 }
 
@@ -235,6 +250,7 @@ static void SetTiling(const TilingParams& params, AvgPool3DTilingData& tiling) {
   tiling.set_windowWNum(params.windowWNum);
   tiling.set_tileInput(params.tileInput);
   tiling.set_tileHW(params.tileHW);
+  tiling.set_runPointNum(params.runPointNum);
 }
 
 static bool GetDataTypeKey(ge::DataType dataType, int32_t& dataTypeKey) {
@@ -48,6 +48,7 @@ BEGIN_TILING_DATA_DEF(AvgPool3DTilingData)
   TILING_DATA_FIELD_DEF(uint64_t, windowWNum);
   TILING_DATA_FIELD_DEF(uint64_t, tileInput);
   TILING_DATA_FIELD_DEF(uint64_t, tileHW);
+  TILING_DATA_FIELD_DEF(uint64_t, runPointNum);
 END_TILING_DATA_DEF;
 
 REGISTER_TILING_DATA_CLASS(AvgPool3D, AvgPool3DTilingData)
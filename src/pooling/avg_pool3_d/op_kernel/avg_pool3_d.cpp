@@ -18,6 +18,7 @@
 #include "kernel_operator.h"
 
 #include "avg_pool3d_ndhwc_split_c.h"
+#include "avg_pool3d_ndhwc_engine.h"
 #include "avg_pool3d_ndhwc_multi_w.h"
 #include "avg_pool3d_ndhwc_split_w.h"
 #include "avg_pool3d_ncdhw_reduce_d.h"
@@ -34,13 +35,18 @@
 extern "C" __global__ __aicore__ void avg_pool3_d(
     GM_ADDR x, GM_ADDR y, GM_ADDR workspace, GM_ADDR tiling) {
   GET_TILING_DATA(tilingData, tiling);
+#if __CCE_AICORE__ >= 220
+  if (TILING_KEY_IS(10)) {
+    DISPATCH_OP_IMPL(KernelAvgPool3dEngine, float, 2);
+  } else if (TILING_KEY_IS(11)) {
+    DISPATCH_OP_IMPL(KernelAvgPool3dEngine, half, 2);
+  } else if (TILING_KEY_IS(12)) {
+    DISPATCH_OP_IMPL(KernelAvgPool3dEngine, bfloat16_t, 2);
+#else
   if (TILING_KEY_IS(10)) {
     DISPATCH_OP_IMPL(KernelAvgPool3dSplitC, float, 1);
   } else if (TILING_KEY_IS(11)) {
     DISPATCH_OP_IMPL(KernelAvgPool3dSplitC, half, 1);
-#if __CCE_AICORE__ >= 220
-  } else if (TILING_KEY_IS(12)) {
-    DISPATCH_OP_IMPL(KernelAvgPool3dSplitC, bfloat16_t, 1);
 #endif
   } else if (TILING_KEY_IS(20)) {
     DISPATCH_OP_IMPL(KernelAvgPool3dSplitW, float, 1);
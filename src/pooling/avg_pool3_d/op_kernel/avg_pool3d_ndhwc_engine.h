@@ -0,0 +1,64 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * \file avg_pool3d_ndhwc_engine.h
+ * \brief
+ */
+
+#ifndef AVG_POOL3D_NDHWC_ENGINE_H_
+#define AVG_POOL3D_NDHWC_ENGINE_H_
+
+#include "kernel_operator.h"
+#include "pool_engine_ndhwc.h"
+
+template <typename T, int32_t QUEUE_DEPTH>
+class KernelAvgPool3dEngine {
+public:
+  __aicore__ inline KernelAvgPool3dEngine() {}
+  __aicore__ inline void Init(GM_ADDR x, GM_ADDR y, GM_ADDR workspace, const AvgPool3DTilingData* tiling, TPipe* pipe);
+  __aicore__ inline void Process();
+
+private:
+  PoolEngine::KernelPoolNdhwcSplitC<T, PoolEngine::SlidingWindow, PoolEngine::AvgReducer, QUEUE_DEPTH> engine;
+};
+
+template <typename T, int32_t QUEUE_DEPTH>
+__aicore__ inline void KernelAvgPool3dEngine<T, QUEUE_DEPTH>::Init(
+    GM_ADDR x, GM_ADDR y, GM_ADDR workspace, const AvgPool3DTilingData* tiling, TPipe* pipe) {
+  PoolEngine::SlidingWindow window;
+  window.Init(tiling->inD, tiling->inH, tiling->inW, tiling->kD, tiling->kH, tiling->kW,
+              tiling->dD, tiling->dH, tiling->dW, tiling->pD, tiling->pH, tiling->pW,
+              tiling->countIncludePad, tiling->divisorOverride);
+
+  PoolEngine::PoolEngineParam param;
+  param.inD = tiling->inD;
+  param.inH = tiling->inH;
+  param.inW = tiling->inW;
+  param.outD = tiling->outD;
+  param.outH = tiling->outH;
+  param.outW = tiling->outW;
+  param.channels = tiling->inC;
+  param.tileC = tiling->tileC;
+  param.runPointNum = tiling->runPointNum;
+  param.outputPointNum = GetBlockIdx() < tiling->formerNum ? tiling->formerLength : tiling->tailLength;
+  param.outputPointOffset = GetBlockIdx() < tiling->formerNum
+    ? tiling->formerLength * GetBlockIdx()
+    : tiling->formerNum * tiling->formerLength + tiling->tailLength * (GetBlockIdx() - tiling->formerNum);
+
+  engine.Init(x, y, param, window, pipe);
+}
+
+template <typename T, int32_t QUEUE_DEPTH>
+__aicore__ inline void KernelAvgPool3dEngine<T, QUEUE_DEPTH>::Process() {
+  engine.Process();
+}
+
+#endif // AVG_POOL3D_NDHWC_ENGINE_H_
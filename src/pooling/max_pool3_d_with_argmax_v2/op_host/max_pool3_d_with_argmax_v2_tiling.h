@@ -330,6 +330,36 @@ TILING_DATA_FIELD_DEF(uint64_t, indiceTempBufferSize);
 TILING_DATA_FIELD_DEF(uint64_t, maskBufferSize);
 END_TILING_DATA_DEF;
 
+BEGIN_TILING_DATA_DEF(MaxPool3DWithArgmaxV2NdhwcTilingData)
+    TILING_DATA_FIELD_DEF_ARR(uint64_t, DHW_DIMS, inputShapes);
+    TILING_DATA_FIELD_DEF_ARR(uint64_t, DHW_DIMS, outShapes);
+    TILING_DATA_FIELD_DEF(uint64_t, kD);
+    TILING_DATA_FIELD_DEF(uint64_t, kW);
+    TILING_DATA_FIELD_DEF(uint64_t, kH);
+    TILING_DATA_FIELD_DEF(uint64_t, sD);
+    TILING_DATA_FIELD_DEF(uint64_t, sW);
+    TILING_DATA_FIELD_DEF(uint64_t, sH);
+    TILING_DATA_FIELD_DEF(uint64_t, pD);
+    TILING_DATA_FIELD_DEF(uint64_t, pW);
+    TILING_DATA_FIELD_DEF(uint64_t, pH);
+    TILING_DATA_FIELD_DEF(uint64_t, dD);
+    TILING_DATA_FIELD_DEF(uint64_t, dW);
+    TILING_DATA_FIELD_DEF(uint64_t, dH);
+    TILING_DATA_FIELD_DEF(uint64_t, channels);
+    TILING_DATA_FIELD_DEF(uint64_t, cFactor);
+    TILING_DATA_FIELD_DEF(uint64_t, cTail);
+    TILING_DATA_FIELD_DEF(uint64_t, cOuter);
+    TILING_DATA_FIELD_DEF(uint64_t, woFactor);
+    TILING_DATA_FIELD_DEF(uint64_t, woTail);
+    TILING_DATA_FIELD_DEF(uint64_t, woOuter);
+    TILING_DATA_FIELD_DEF(uint64_t, blockFactor);
+    TILING_DATA_FIELD_DEF(uint64_t, blockTail);
+    TILING_DATA_FIELD_DEF(uint64_t, totalIdx);
+    TILING_DATA_FIELD_DEF(uint64_t, coreNums);
+    TILING_DATA_FIELD_DEF(uint64_t, bufferSize);
+    TILING_DATA_FIELD_DEF(float, minFloat);
+END_TILING_DATA_DEF;
+
 REGISTER_TILING_DATA_CLASS(MaxPool3DWithArgmaxV2, MaxPool3DWithArgmaxV2TilingData);
 
 //1, splitD=0, splitH=0, splitW=0, splitKernel = 0, dtype=float=0
@@ -375,8 +405,16 @@ REGISTER_TILING_DATA_CLASS(MaxPool3DWithArgmaxV2_311112, MaxPool3DWithArgmaxV2Bi
 REGISTER_TILING_DATA_CLASS(MaxPool3DWithArgmaxV2_300001, MaxPool3DWithArgmaxV2NoExpandIndicesTilingData);
 REGISTER_TILING_DATA_CLASS(MaxPool3DWithArgmaxV2_300002, MaxPool3DWithArgmaxV2NoExpandIndicesTilingData);
 
+//4, channel last, dtype=float=0
+//4, channel last, dtype=half=1
+//4, channel last, dtype=bfloat16=2
+REGISTER_TILING_DATA_CLASS(MaxPool3DWithArgmaxV2_400000, MaxPool3DWithArgmaxV2NdhwcTilingData);
+REGISTER_TILING_DATA_CLASS(MaxPool3DWithArgmaxV2_400001, MaxPool3DWithArgmaxV2NdhwcTilingData);
+REGISTER_TILING_DATA_CLASS(MaxPool3DWithArgmaxV2_400002, MaxPool3DWithArgmaxV2NdhwcTilingData);
+
 struct InputInfo {
     uint64_t batches;
+    uint64_t channels;
     array<uint64_t, DHW_DIMS> inputShape;
     array<uint64_t, DHW_DIMS> outShape;
     array<uint64_t, DHW_DIMS> kernelSize;
@@ -384,6 +422,7 @@ struct InputInfo {
     array<uint64_t, DHW_DIMS> pad;
     array<uint64_t, DHW_DIMS> dilation;
     bool ceilMode;
+    bool channelLast;
 };
 
 struct PadInputInfo {
@@ -748,6 +787,37 @@ class MaxPool3DWithArgmaxV2NoExpandIndicesTiling : public MaxPool3DWithArgmaxV2B
         BufferInfo bufferData;
 };
 
+class MaxPool3DWithArgmaxV2NdhwcTiling : public MaxPool3DWithArgmaxV2BaseTiling {
+    public:
+        explicit MaxPool3DWithArgmaxV2NdhwcTiling(gert::TilingContext* context) : MaxPool3DWithArgmaxV2BaseTiling(context) {
+        }
+
+        ~MaxPool3DWithArgmaxV2NdhwcTiling() override {
+        }
+
+    private:
+        ge::graphStatus DoUBTiling();
+        void DoBlockTiling();
+        void SetTilingData();
+        uint64_t GetTilingKey() const override;
+        bool IsCapable() override;
+        ge::graphStatus DoOpTiling() override;
+        ge::graphStatus PostTiling() override;
+
+        MaxPool3DWithArgmaxV2NdhwcTilingData tiling;
+        uint64_t cFactor = 1;
+        uint64_t cTail = 1;
+        uint64_t cOuter = 1;
+        uint64_t woFactor = 1;
+        uint64_t woTail = 1;
+        uint64_t woOuter = 1;
+        uint64_t blockFactor = 0;
+        uint64_t blockTail = 0;
+        uint64_t totalIdx = 0;
+        uint64_t coreNums = 1;
+        uint64_t bufferSize = 0;
+};
+
 }  // namespace optiling
 
 #endif
\ No newline at end of file
@@ -97,7 +97,8 @@ static int64_t PoolingOutShape(int64_t inputSize, int64_t kernelSize, int64_t st
 }
 
 static op::Shape GetOutputShape(const aclTensor* self, const aclIntArray* kernelSize, const aclIntArray* stride,
-                                const aclIntArray* padding, const aclIntArray* dilation, bool ceilMode) {
+                                const aclIntArray* padding, const aclIntArray* dilation, bool ceilMode,
+                                const std::string& dataFormat) {
     op::Shape input_shape = self->GetViewShape();
     int64_t dims = input_shape.GetDimNum();
     const aclIntArray& kernelRef = *kernelSize;
@@ -105,14 +106,17 @@ static op::Shape GetOutputShape(const aclTensor* self, const aclIntArray* kernel
     const aclIntArray& paddingRef = *padding;
     const aclIntArray& dilationRef = *dilation;
     op::Shape outputShape;
-    const uint32_t batchesDims = dims == NCDHW_DIMS ? NC : C;
+    const bool channelLast = (dataFormat == "NDHWC");
+    const uint32_t batchesDims = (dims == NCDHW_DIMS && !channelLast) ? NC : C;
     int64_t curDim[DHW_DIMS];
     
     curDim[0] = PoolingOutShape(input_shape.GetDim(batchesDims), kernelRef[0], strideRef[0], paddingRef[0], dilationRef[0], ceilMode);
     curDim[1] = PoolingOutShape(input_shape.GetDim(batchesDims + 1), kernelRef[1], strideRef[1], paddingRef[1], dilationRef[1], ceilMode);
     curDim[NC] = PoolingOutShape(input_shape.GetDim(batchesDims + NC), kernelRef[NC], strideRef[NC], paddingRef[NC], dilationRef[NC], ceilMode);
     
-    if (dims == NCDHW_DIMS) {
+    if (channelLast) {
+        outputShape = {input_shape.GetDim(0), curDim[0], curDim[1], curDim[NC], input_shape.GetDim(dims - 1)};
+    } else if (dims == NCDHW_DIMS) {
         outputShape = {input_shape.GetDim(0), input_shape.GetDim(1), curDim[0], curDim[1], curDim[NC]};
     } else {
         outputShape = {input_shape.GetDim(0), curDim[0], curDim[1], curDim[NC]};
@@ -154,7 +158,7 @@ const std::tuple<const aclTensor*, const aclTensor*> MaxPool3DWithArgmaxV2Ncdhw(
     aclIntArray* padding3 = executor->AllocIntArray(paddingSizeData.data(), DHW_DIMS);
     aclIntArray* dilation3 = executor->AllocIntArray(dilationSizeData.data(), DHW_DIMS);
 
-    op::Shape outShape = GetOutputShape(self, kernelSize3, stride3, padding3, dilation3, ceilMode);
+    op::Shape outShape = GetOutputShape(self, kernelSize3, stride3, padding3, dilation3, ceilMode, dataFormat);
     op::DataType outType = self->GetDataType();
     auto out = executor->AllocTensor(outShape, outType, self->GetViewFormat());
     auto indices = executor->AllocTensor(outShape, op::DataType::DT_INT32, self->GetViewFormat());
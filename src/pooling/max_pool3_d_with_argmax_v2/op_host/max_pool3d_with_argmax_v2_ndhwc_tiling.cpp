@@ -0,0 +1,172 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file max_pool3d_with_argmax_v2_ndhwc_tiling.cpp
+ * \brief
+ */
+
+#include <limits>
+#include "tiling/tiling_templates_registry.h"
+#include "max_pool3_d_with_argmax_v2_tiling.h"
+
+//4, channel last, dtype=float
+constexpr uint64_t TILING_KEY_NDHWC_FLOAT = 400000;
+//4, channel last, dtype=half
+constexpr uint64_t TILING_KEY_NDHWC_HALF = 400001;
+//4, channel last, dtype=bfloat16
+constexpr uint64_t TILING_KEY_NDHWC_BF16 = 400002;
+
+using namespace AscendC;
+
+namespace optiling {
+
+static const uint64_t NDHWC_BLOCK_SIZE = 32;
+static const uint64_t NDHWC_ELEM_ALIGN = 128;
+static const uint64_t NDHWC_RESERVED_UB = 8 * 1024;
+static const uint64_t NDHWC_MAX_BLOCK_COUNT = 4095;
+static const uint64_t NDHWC_MAX_KERNEL_NUM = 16777216;
+static const uint64_t NDHWC_FP32_SIZE = 4;
+static const uint64_t NDHWC_FP16_SIZE = 2;
+static const uint64_t NDHWC_INDICES_SIZE = 4;
+// 两个比较mask各占1/8字节，按4倍放大后计算避免小数
+static const uint64_t NDHWC_MASK_SCALE = 4;
+
+bool MaxPool3DWithArgmaxV2NdhwcTiling::IsCapable() {
+    return inputData.channelLast;
+}
+
+uint64_t MaxPool3DWithArgmaxV2NdhwcTiling::GetTilingKey() const {
+    if (dtype == ge::DataType::DT_FLOAT) {
+        return TILING_KEY_NDHWC_FLOAT;
+    } else if (dtype == ge::DataType::DT_FLOAT16) {
+        return TILING_KEY_NDHWC_HALF;
+    } else {
+        return TILING_KEY_NDHWC_BF16;
+    }
+}
+
+ge::graphStatus MaxPool3DWithArgmaxV2NdhwcTiling::DoUBTiling() {
+    uint64_t inBytes = (dtype == ge::DataType::DT_FLOAT) ? NDHWC_FP32_SIZE : NDHWC_FP16_SIZE;
+    uint64_t computeBytes = (dtype == ge::DataType::DT_FLOAT16) ? NDHWC_FP16_SIZE : NDHWC_FP32_SIZE;
+    uint64_t castBytes = (dtype == ge::DataType::DT_BF16) ? NDHWC_FP32_SIZE : 0;
+    // x双缓冲、y、max、argmax输出、argmax中间值、当前kernel偏移，bf16额外一份fp32的x
+    uint64_t elemBytes = inBytes * 3 + computeBytes + NDHWC_INDICES_SIZE * 3 + castBytes;
+    OP_TILING_CHECK(ubSize <= NDHWC_RESERVED_UB,
+                    VECTOR_INNER_ERR_REPORT_TILIING(context_->GetNodeName(), "ubSize %lu is too small", ubSize),
+                    return ge::GRAPH_FAILED);
+    uint64_t maxElems = (ubSize - NDHWC_RESERVED_UB) * NDHWC_MASK_SCALE / (elemBytes * NDHWC_MASK_SCALE + 1);
+    maxElems = maxElems / NDHWC_ELEM_ALIGN * NDHWC_ELEM_ALIGN;
+
+    uint64_t channels = inputData.channels;
+    uint64_t cAlignUnit = NDHWC_BLOCK_SIZE / inBytes;
+    if ((channels + cAlignUnit - 1) / cAlignUnit * cAlignUnit <= maxElems) {
+        cFactor = channels;
+    } else {
+        cFactor = maxElems / cAlignUnit * cAlignUnit;
+    }
+    cOuter = (channels + cFactor - 1) / cFactor;
+    cTail = channels - (cOuter - 1) * cFactor;
+    uint64_t cAlign = (cFactor + cAlignUnit - 1) / cAlignUnit * cAlignUnit;
+
+    uint64_t oW = inputData.outShape[W_DIM];
+    woFactor = maxElems / cAlign;
+    woFactor = woFactor < oW ? woFactor : oW;
+    woFactor = woFactor < NDHWC_MAX_BLOCK_COUNT ? woFactor : NDHWC_MAX_BLOCK_COUNT;
+    // 行数不足以占满所有核时沿W继续切分
+    uint64_t rows = inputData.batches * inputData.outShape[D_DIM] * inputData.outShape[H_DIM] * cOuter;
+    if (rows < coreNum) {
+        uint64_t woParts = (coreNum + rows - 1) / rows;
+        uint64_t woSplit = (oW + woParts - 1) / woParts;
+        woFactor = woSplit < woFactor ? woSplit : woFactor;
+    }
+    woOuter = (oW + woFactor - 1) / woFactor;
+    woTail = oW - (woOuter - 1) * woFactor;
+    bufferSize = (woFactor * cAlign + NDHWC_ELEM_ALIGN - 1) / NDHWC_ELEM_ALIGN * NDHWC_ELEM_ALIGN;
+    totalIdx = rows * woOuter;
+
+    return ge::GRAPH_SUCCESS;
+}
+
+void MaxPool3DWithArgmaxV2NdhwcTiling::DoBlockTiling() {
+    blockFactor = totalIdx / coreNum;
+    blockTail = totalIdx % coreNum;
+    if (blockFactor == 0) {
+        coreNums = totalIdx;
+    } else {
+        coreNums = coreNum;
+    }
+}
+
+void MaxPool3DWithArgmaxV2NdhwcTiling::SetTilingData() {
+    array<uint64_t, DHW_DIMS> tmpInputShape{inputData.inputShape[D_DIM], inputData.inputShape[H_DIM], inputData.inputShape[W_DIM]};
+    array<uint64_t, DHW_DIMS> tmpOutShape{inputData.outShape[D_DIM], inputData.outShape[H_DIM], inputData.outShape[W_DIM]};
+    tiling.set_inputShapes(&(tmpInputShape[0]));
+    tiling.set_outShapes(&(tmpOutShape[0]));
+    tiling.set_kD(inputData.kernelSize[D_DIM]);
+    tiling.set_kH(inputData.kernelSize[H_DIM]);
+    tiling.set_kW(inputData.kernelSize[W_DIM]);
+    tiling.set_sD(inputData.stride[D_DIM]);
+    tiling.set_sH(inputData.stride[H_DIM]);
+    tiling.set_sW(inputData.stride[W_DIM]);
+    tiling.set_pD(inputData.pad[D_DIM]);
+    tiling.set_pH(inputData.pad[H_DIM]);
+    tiling.set_pW(inputData.pad[W_DIM]);
+    tiling.set_dD(inputData.dilation[D_DIM]);
+    tiling.set_dH(inputData.dilation[H_DIM]);
+    tiling.set_dW(inputData.dilation[W_DIM]);
+    tiling.set_channels(inputData.channels);
+    tiling.set_cFactor(cFactor);
+    tiling.set_cTail(cTail);
+    tiling.set_cOuter(cOuter);
+    tiling.set_woFactor(woFactor);
+    tiling.set_woTail(woTail);
+    tiling.set_woOuter(woOuter);
+    tiling.set_blockFactor(blockFactor);
+    tiling.set_blockTail(blockTail);
+    tiling.set_totalIdx(totalIdx);
+    tiling.set_coreNums(coreNums);
+    tiling.set_bufferSize(bufferSize);
+    tiling.set_minFloat(-std::numeric_limits<float>::infinity());
+}
+
+ge::graphStatus MaxPool3DWithArgmaxV2NdhwcTiling::DoOpTiling() {
+    // 窗口内偏移以float参与反向比较，需保证可精确表示
+    uint64_t kernelNum = inputData.kernelSize[D_DIM] * inputData.kernelSize[H_DIM] * inputData.kernelSize[W_DIM];
+    OP_TILING_CHECK(kernelNum > NDHWC_MAX_KERNEL_NUM,
+                    VECTOR_INNER_ERR_REPORT_TILIING(context_->GetNodeName(),
+                                                    "MaxPool3DWithArgmaxV2: kernel size %lu is too large for NDHWC",
+                                                    kernelNum),
+                    return ge::GRAPH_FAILED);
+    OP_TILING_CHECK(inputData.channels == 0 || inputData.batches == 0,
+                    VECTOR_INNER_ERR_REPORT_TILIING(context_->GetNodeName(),
+                                                    "MaxPool3DWithArgmaxV2: empty NDHWC input is not supported"),
+                    return ge::GRAPH_FAILED);
+    auto ret = DoUBTiling();
+    if (ret != ge::GRAPH_SUCCESS) {
+        return ret;
+    }
+    DoBlockTiling();
+    SetTilingData();
+
+    return ge::GRAPH_SUCCESS;
+}
+
+ge::graphStatus MaxPool3DWithArgmaxV2NdhwcTiling::PostTiling() {
+    context_->SetBlockDim(coreNums);
+    tiling.SaveToBuffer(context_->GetRawTilingData()->GetData(), context_->GetRawTilingData()->GetCapacity());
+    context_->GetRawTilingData()->SetDataSize(tiling.GetDataSize());
+
+    return ge::GRAPH_SUCCESS;
+}
+
+REGISTER_TILING_TEMPLATE("MaxPool3DWithArgmaxV2", MaxPool3DWithArgmaxV2NdhwcTiling, 7);
+
+} // namespace optiling
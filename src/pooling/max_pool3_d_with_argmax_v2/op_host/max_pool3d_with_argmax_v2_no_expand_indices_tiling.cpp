@@ -109,6 +109,9 @@ uint64_t CeilAlign(uint64_t blockToAlign, uint64_t alignSize) {
 }
 
 bool MaxPool3DWithArgmaxV2NoExpandIndicesTiling::IsCapable() {
+  if (inputData.channelLast) {
+    return false;
+  }
   if (inputData.dilation[D_DIM] != 1 || inputData.dilation[H_DIM] != 1 || inputData.dilation[W_DIM] != 1) {
     return false;
   }
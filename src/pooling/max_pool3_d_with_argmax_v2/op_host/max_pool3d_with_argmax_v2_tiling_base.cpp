@@ -13,6 +13,7 @@
  * \brief
  */
 
+#include <cstring>
 #include "tiling/tiling_templates_registry.h"
 #include "platform/platform_info.h"
 #include "max_pool3_d_with_argmax_v2_tiling.h"
@@ -29,6 +30,7 @@ const int STRIDE_POS = 1;
 const int PADDING_POS = 2;
 const int DILATION_POS = 3;
 const int CEIL_POS = 4;
+const int DATA_FORMAT_POS = 5;
 const int WS_SYS_SIZE = 16 * 1024 * 1024;
 
 ge::graphStatus MaxPool3DWithArgmaxV2BaseTiling::GetPlatformInfo() {
@@ -85,12 +87,22 @@ ge::graphStatus MaxPool3DWithArgmaxV2BaseTiling::GetShapeAttrsInfo() {
         return ge::GRAPH_FAILED;
     }
 
+    auto runtimeAttrs = context_->GetAttrs();
+    OPS_CHECK_NULL_WITH_CONTEXT(context_, runtimeAttrs);
+
+    // NDHWC时C在最内轴，batches只含N，C单独记录
+    const char* dataFormat = runtimeAttrs->GetStr(DATA_FORMAT_POS);
+    inputData.channelLast = (dataFormat != nullptr) && (strcmp(dataFormat, "NDHWC") == 0);
+
     // Calculate number of batches
     int d_dim = 1;
     int h_dim = 2;
     int w_dim = 3;
     inputData.batches = inputShape.GetDim(0);
-    if (inputShape.GetDimNum() == NCDHW_DIMS) {
+    inputData.channels = 1;
+    if (inputData.channelLast) {
+        inputData.channels = inputShape.GetDim(NCDHW_DIMS - 1);
+    } else if (inputShape.GetDimNum() == NCDHW_DIMS) {
         inputData.batches *= inputShape.GetDim(1);
         d_dim++;
         h_dim++;
@@ -99,9 +111,6 @@ ge::graphStatus MaxPool3DWithArgmaxV2BaseTiling::GetShapeAttrsInfo() {
     inputData.inputShape = {uint64_t(inputShape.GetDim(d_dim)), uint64_t(inputShape.GetDim(h_dim)), uint64_t(inputShape.GetDim(w_dim))};
     inputData.outShape = {uint64_t(outShape.GetDim(d_dim)), uint64_t(outShape.GetDim(h_dim)), uint64_t(outShape.GetDim(w_dim))};
 
-    auto runtimeAttrs = context_->GetAttrs();
-    OPS_CHECK_NULL_WITH_CONTEXT(context_, runtimeAttrs);
-
     const gert::TypedContinuousVector<int64_t> *kernelSize = runtimeAttrs->GetListInt(KERNEL_POS);
     OPS_CHECK_NULL_WITH_CONTEXT(context_, kernelSize);
     inputData.kernelSize = {static_cast<uint64_t>(kernelSize->GetData()[D_DIM]),
@@ -29,6 +29,9 @@ namespace optiling {
 
 
 bool MaxPool3DWithArgmaxV2BigKernelTiling::IsCapable() {
+    if (inputData.channelLast) {
+        return false;
+    }
     if(inputData.dilation[D_DIM] == 1 && inputData.dilation[H_DIM] == 1 && inputData.dilation[W_DIM] == 1) {
         return true;
     }
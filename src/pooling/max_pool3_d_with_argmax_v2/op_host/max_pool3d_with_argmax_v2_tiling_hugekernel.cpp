@@ -28,6 +28,9 @@ using namespace AscendC;
 namespace optiling {
 
 bool MaxPool3DWithArgmaxV2HugeKernelTiling::IsCapable() {
+    if (inputData.channelLast) {
+        return false;
+    }
     array<uint64_t, DHW_DIMS> parts{inputData.kernelSize[D_DIM],
                                     inputData.kernelSize[H_DIM],
                                     inputData.kernelSize[W_DIM]};
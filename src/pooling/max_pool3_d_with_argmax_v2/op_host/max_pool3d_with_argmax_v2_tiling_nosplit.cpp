@@ -29,6 +29,9 @@ namespace optiling {
 
 
 bool MaxPool3DWithArgmaxV2NoSplitTiling::IsCapable() {
+    if (inputData.channelLast) {
+        return false;
+    }
     array<uint64_t, DHW_DIMS> tmpOutShape{inputData.outShape[D_DIM], inputData.outShape[H_DIM], inputData.outShape[W_DIM]};
     auto summaryMemory = CalcBufferSizes(padInputData.padInputShape, tmpOutShape,
                                          padInputData.padInputShape[W_DIM] * padInputData.padInputShape[H_DIM], bufSizes);
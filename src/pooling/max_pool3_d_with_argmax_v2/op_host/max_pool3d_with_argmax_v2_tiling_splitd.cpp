@@ -27,6 +27,9 @@ using namespace AscendC;
 namespace optiling {
 
 bool MaxPool3DWithArgmaxV2SplitDTiling::IsCapable() {
+    if (inputData.channelLast) {
+        return false;
+    }
     array<uint64_t, DHW_DIMS> parts{padInputData.padInputShape[D_DIM], padInputData.padInputShape[H_DIM], padInputData.padInputShape[W_DIM]};
     array<uint64_t, DHW_DIMS> partOuts{inputData.outShape[D_DIM], inputData.outShape[H_DIM], inputData.outShape[W_DIM]};
 
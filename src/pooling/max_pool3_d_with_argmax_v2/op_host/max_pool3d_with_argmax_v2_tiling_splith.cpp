@@ -28,6 +28,9 @@ using namespace AscendC;
 namespace optiling {
 
 bool MaxPool3DWithArgmaxV2SplitHTiling::IsCapable() {
+    if (inputData.channelLast) {
+        return false;
+    }
     splitData.partD = inputData.dilation[D_DIM] * (inputData.kernelSize[D_DIM] - 1) + 1;
     splitData.partOutD = 1;
     array<uint64_t, DHW_DIMS> parts{splitData.partD, padInputData.padInputShape[H_DIM], padInputData.padInputShape[W_DIM]};
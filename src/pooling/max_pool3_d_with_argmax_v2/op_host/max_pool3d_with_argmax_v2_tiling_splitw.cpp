@@ -28,6 +28,9 @@ using namespace AscendC;
 namespace optiling {
 
 bool MaxPool3DWithArgmaxV2SplitWTiling::IsCapable() {
+    if (inputData.channelLast) {
+        return false;
+    }
     splitData.partD = inputData.dilation[D_DIM] * (inputData.kernelSize[D_DIM] - 1) + 1;
     splitData.partOutD = 1;
     splitData.partH = inputData.dilation[H_DIM] * (inputData.kernelSize[H_DIM] - 1) + 1;
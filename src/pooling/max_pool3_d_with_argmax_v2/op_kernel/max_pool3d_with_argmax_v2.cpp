@@ -23,6 +23,7 @@
 #include "max_pool3d_with_argmax_v2_huge_kernel.h"
 #include "max_pool3d_with_argmax_v2_no_expand_indices.h"
 #include "max_pool3d_with_argmax_big_kernel.h"
+#include "max_pool3d_with_argmax_v2_ndhwc.h"
 
 constexpr uint32_t PAD_DISABLE = 0;
 constexpr uint32_t PAD_ENABLE = 1;
@@ -44,6 +45,9 @@ extern "C" __global__ __aicore__ void max_pool3d_with_argmax_v2(GM_ADDR x, GM_AD
     // 111110 = 1, splitD=1 splitH=1 splitW=1 splitKernel=1 type=float(0)
     // 111111 = 1, splitD=1 splitH=1 splitW=1 splitKernel=1 type=half(1)
     // 111112 = 1, splitD=1 splitH=1 splitW=1 splitKernel=1 type=bfloat(2)
+    // 400000 = 4, channel last type=float(0)
+    // 400001 = 4, channel last type=half(1)
+    // 400002 = 4, channel last type=bfloat(2)
     TPipe pipe;
     if (TILING_KEY_IS(100000)) {
         GET_TILING_DATA_WITH_STRUCT(MaxPool3DWithArgmaxV2NoSplitTilingData, tilingDataIn, tiling);
@@ -173,6 +177,24 @@ extern "C" __global__ __aicore__ void max_pool3d_with_argmax_v2(GM_ADDR x, GM_AD
         MaxPool3DWithArgmaxBigKernel<bfloat16_t, float, false> op;
         op.Init(x, y, indices, GetUserWorkspace(workspace), &pipe, tilingData, 2);
         op.Process();
+    } else if (TILING_KEY_IS(400000)) {
+        GET_TILING_DATA_WITH_STRUCT(MaxPool3DWithArgmaxV2NdhwcTilingData, tilingDataIn, tiling);
+        const MaxPool3DWithArgmaxV2NdhwcTilingData *__restrict tilingData = &tilingDataIn;
+        KernelMaxPool3DWithArgmaxV2Ndhwc<float, float> op(tilingData);
+        op.Init(x, y, indices, nullptr, &pipe);
+        op.Process();
+    } else if (TILING_KEY_IS(400001)) {
+        GET_TILING_DATA_WITH_STRUCT(MaxPool3DWithArgmaxV2NdhwcTilingData, tilingDataIn, tiling);
+        const MaxPool3DWithArgmaxV2NdhwcTilingData *__restrict tilingData = &tilingDataIn;
+        KernelMaxPool3DWithArgmaxV2Ndhwc<half, half> op(tilingData);
+        op.Init(x, y, indices, nullptr, &pipe);
+        op.Process();
+    } else if (TILING_KEY_IS(400002)) {
+        GET_TILING_DATA_WITH_STRUCT(MaxPool3DWithArgmaxV2NdhwcTilingData, tilingDataIn, tiling);
+        const MaxPool3DWithArgmaxV2NdhwcTilingData *__restrict tilingData = &tilingDataIn;
+        KernelMaxPool3DWithArgmaxV2Ndhwc<bfloat16_t, float> op(tilingData);
+        op.Init(x, y, indices, nullptr, &pipe);
+        op.Process();
     }
     
     return;
@@ -0,0 +1,340 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file max_pool3d_with_argmax_v2_ndhwc.h
+ * \brief NDHWC格式的MaxPool3D，沿C向量化，argmax输出窗口内偏移 (kd * kH + kh) * kW + kw
+ */
+
+#ifndef MAX_POOL3D_WITH_ARGMAX_V2_NDHWC_H_
+#define MAX_POOL3D_WITH_ARGMAX_V2_NDHWC_H_
+
+#include "kernel_operator.h"
+#include "kernel_tiling/kernel_tiling.h"
+
+using namespace AscendC;
+
+constexpr int32_t NDHWC_X_BUFFER_NUM = 2;
+constexpr uint64_t NDHWC_BLOCK_BYTES = 32;
+constexpr uint64_t NDHWC_REPEAT_BYTES = 256;
+constexpr uint64_t NDHWC_MASK_BITS = 8;
+
+// 一个任务处理一个(n, od, oh)下连续woLen个输出点、cLen个通道，UB内按[wo][cAlign]排布
+template <typename T1, typename T2>
+class KernelMaxPool3DWithArgmaxV2Ndhwc {
+public:
+    __aicore__ inline KernelMaxPool3DWithArgmaxV2Ndhwc(const MaxPool3DWithArgmaxV2NdhwcTilingData* __restrict tilingData_)
+        : tilingData(tilingData_) {}
+
+    __aicore__ inline void Init(GM_ADDR x, GM_ADDR y, GM_ADDR indices, GM_ADDR workspace, TPipe* pipe_in)
+    {
+        pipe = pipe_in;
+        xGm.SetGlobalBuffer((__gm__ T1*)x);
+        yGm.SetGlobalBuffer((__gm__ T1*)y);
+        indicesGm.SetGlobalBuffer((__gm__ int32_t*)indices);
+
+        iD = tilingData->inputShapes[0];
+        iH = tilingData->inputShapes[1];
+        iW = tilingData->inputShapes[2];
+        oD = tilingData->outShapes[0];
+        oH = tilingData->outShapes[1];
+        oW = tilingData->outShapes[2];
+        channels = tilingData->channels;
+        cAlignUnit = NDHWC_BLOCK_BYTES / sizeof(T1);
+        cmpAlignNum = NDHWC_REPEAT_BYTES / sizeof(T2);
+
+        uint64_t bufferSize = tilingData->bufferSize;
+        pipe->InitBuffer(xQue, NDHWC_X_BUFFER_NUM, bufferSize * sizeof(T1));
+        pipe->InitBuffer(yQue, 1, bufferSize * sizeof(T1));
+        pipe->InitBuffer(indicesQue, 1, bufferSize * sizeof(int32_t));
+        pipe->InitBuffer(maxBuf, bufferSize * sizeof(T2));
+        pipe->InitBuffer(indicesBuf, bufferSize * sizeof(int32_t));
+        pipe->InitBuffer(kernelIdxBuf, bufferSize * sizeof(int32_t));
+        uint64_t maskBytes = CeilAlign(bufferSize / NDHWC_MASK_BITS, NDHWC_BLOCK_BYTES);
+        pipe->InitBuffer(gtMaskBuf, maskBytes);
+        pipe->InitBuffer(nanMaskBuf, maskBytes);
+        if constexpr (!IsSameType<T1, T2>::value) {
+            pipe->InitBuffer(xCastBuf, bufferSize * sizeof(T2));
+        }
+
+        uint64_t blockIdx = GetBlockIdx();
+        if (blockIdx < tilingData->blockTail) {
+            taskNum = tilingData->blockFactor + 1;
+            taskStart = blockIdx * taskNum;
+        } else {
+            taskNum = tilingData->blockFactor;
+            taskStart = blockIdx * taskNum + tilingData->blockTail;
+        }
+    }
+
+    __aicore__ inline void Process()
+    {
+        if (GetBlockIdx() >= tilingData->coreNums) {
+            return;
+        }
+        for (uint64_t taskIdx = taskStart; taskIdx < taskStart + taskNum; taskIdx++) {
+            ParseTask(taskIdx);
+            InitMaxAndIndices();
+            ComputeWindow();
+            CopyOut();
+        }
+    }
+
+private:
+    __aicore__ inline uint64_t CeilDivNdhwc(uint64_t x, uint64_t y)
+    {
+        return y == 0 ? x : (x + y - 1) / y;
+    }
+
+    __aicore__ inline uint64_t CeilAlign(uint64_t x, uint64_t y)
+    {
+        return CeilDivNdhwc(x, y) * y;
+    }
+
+    __aicore__ inline void ParseTask(uint64_t taskIdx)
+    {
+        uint64_t cIdx = taskIdx % tilingData->cOuter;
+        uint64_t rest = taskIdx / tilingData->cOuter;
+        uint64_t woIdx = rest % tilingData->woOuter;
+        rest = rest / tilingData->woOuter;
+        curOh = rest % oH;
+        rest = rest / oH;
+        curOd = rest % oD;
+        curN = rest / oD;
+
+        cStart = cIdx * tilingData->cFactor;
+        cLen = (cIdx == tilingData->cOuter - 1) ? tilingData->cTail : tilingData->cFactor;
+        cAlign = CeilAlign(cLen, cAlignUnit);
+        woStart = woIdx * tilingData->woFactor;
+        woLen = (woIdx == tilingData->woOuter - 1) ? tilingData->woTail : tilingData->woFactor;
+        calCount = woLen * cAlign;
+        cmpCount = CeilAlign(calCount, cmpAlignNum);
+
+        // d/h方向窗口内首个有效位置，pad区域不参与比较
+        int64_t dStart = static_cast<int64_t>(curOd * tilingData->sD) - static_cast<int64_t>(tilingData->pD);
+        int64_t hStart = static_cast<int64_t>(curOh * tilingData->sH) - static_cast<int64_t>(tilingData->pH);
+        kdStart = FirstValidKernelIdx(dStart, tilingData->dD);
+        khStart = FirstValidKernelIdx(hStart, tilingData->dH);
+        kdEnd = LastValidKernelIdx(dStart, tilingData->dD, tilingData->kD, iD);
+        khEnd = LastValidKernelIdx(hStart, tilingData->dH, tilingData->kH, iH);
+        curDStart = dStart;
+        curHStart = hStart;
+    }
+
+    __aicore__ inline uint64_t FirstValidKernelIdx(int64_t start, uint64_t dilation)
+    {
+        if (start >= 0) {
+            return 0;
+        }
+        return CeilDivNdhwc(static_cast<uint64_t>(-start), dilation);
+    }
+
+    __aicore__ inline uint64_t LastValidKernelIdx(int64_t start, uint64_t dilation, uint64_t kSize, uint64_t inSize)
+    {
+        int64_t last = static_cast<int64_t>(inSize) - 1 - start;
+        uint64_t end = static_cast<uint64_t>(last) / dilation + 1;
+        return end < kSize ? end : kSize;
+    }
+
+    // 窗口全为-inf时argmax取窗口内首个有效位置，与NCDHW模板一致
+    __aicore__ inline void InitMaxAndIndices()
+    {
+        LocalTensor<T2> maxLocal = maxBuf.Get<T2>();
+        LocalTensor<int32_t> indicesLocal = indicesBuf.Get<int32_t>();
+        PipeBarrier<PIPE_V>();
+        Duplicate<T2>(maxLocal, static_cast<T2>(tilingData->minFloat), cmpCount);
+        int32_t baseIdx = static_cast<int32_t>((kdStart * tilingData->kH + khStart) * tilingData->kW);
+        Duplicate<int32_t>(indicesLocal, baseIdx, cmpCount);
+        uint64_t pW = tilingData->pW;
+        uint64_t sW = tilingData->sW;
+        for (uint64_t wo = woStart; wo < woStart + woLen && wo * sW < pW; wo++) {
+            int32_t kwStart = static_cast<int32_t>(CeilDivNdhwc(pW - wo * sW, tilingData->dW));
+            Duplicate<int32_t>(indicesLocal[(wo - woStart) * cAlign], baseIdx + kwStart, cAlign);
+        }
+        PipeBarrier<PIPE_V>();
+    }
+
+    __aicore__ inline void ComputeWindow()
+    {
+        for (uint64_t kd = kdStart; kd < kdEnd; kd++) {
+            uint64_t curD = static_cast<uint64_t>(curDStart + static_cast<int64_t>(kd * tilingData->dD));
+            for (uint64_t kh = khStart; kh < khEnd; kh++) {
+                uint64_t curH = static_cast<uint64_t>(curHStart + static_cast<int64_t>(kh * tilingData->dH));
+                for (uint64_t kw = 0; kw < tilingData->kW; kw++) {
+                    uint64_t woLo = 0;
+                    uint64_t woHi = 0;
+                    if (!ValidWoRange(kw, woLo, woHi)) {
+                        continue;
+                    }
+                    CopyIn(curD, curH, kw, woLo, woHi);
+                    int32_t kernelIdx = static_cast<int32_t>((kd * tilingData->kH + kh) * tilingData->kW + kw);
+                    Compute(kernelIdx, woLo, woHi);
+                }
+            }
+        }
+    }
+
+    // 当前kw下iw = wo * sW - pW + kw * dW落在输入内的wo区间[woLo, woHi)，与任务的wo区间求交
+    __aicore__ inline bool ValidWoRange(uint64_t kw, uint64_t& woLo, uint64_t& woHi)
+    {
+        int64_t offset = static_cast<int64_t>(kw * tilingData->dW) - static_cast<int64_t>(tilingData->pW);
+        int64_t sW = static_cast<int64_t>(tilingData->sW);
+        int64_t lo = offset >= 0 ? 0 : (-offset + sW - 1) / sW;
+        int64_t lastIw = static_cast<int64_t>(iW) - 1 - offset;
+        if (lastIw < 0) {
+            return false;
+        }
+        int64_t hi = lastIw / sW + 1;
+        int64_t taskLo = static_cast<int64_t>(woStart);
+        int64_t taskHi = static_cast<int64_t>(woStart + woLen);
+        lo = lo > taskLo ? lo : taskLo;
+        hi = hi < taskHi ? hi : taskHi;
+        if (lo >= hi) {
+            return false;
+        }
+        woLo = static_cast<uint64_t>(lo);
+        woHi = static_cast<uint64_t>(hi);
+        return true;
+    }
+
+    __aicore__ inline void CopyIn(uint64_t curD, uint64_t curH, uint64_t kw, uint64_t woLo, uint64_t woHi)
+    {
+        LocalTensor<T1> xLocal = xQue.AllocTensor<T1>();
+        uint64_t curW = woLo * tilingData->sW + kw * tilingData->dW - tilingData->pW;
+        uint64_t xGmOffset = (((curN * iD + curD) * iH + curH) * iW + curW) * channels + cStart;
+        DataCopyExtParams copyParams{static_cast<uint16_t>(woHi - woLo), static_cast<uint32_t>(cLen * sizeof(T1)),
+                                     static_cast<uint32_t>((tilingData->sW * channels - cLen) * sizeof(T1)), 0, 0};
+        DataCopyPadExtParams<T1> padParams{false, 0, 0, 0};
+        DataCopyPad(xLocal[(woLo - woStart) * cAlign], xGm[xGmOffset], copyParams, padParams);
+        xQue.EnQue(xLocal);
+    }
+
+    __aicore__ inline void Compute(int32_t kernelIdx, uint64_t woLo, uint64_t woHi)
+    {
+        LocalTensor<T1> xLocal = xQue.DeQue<T1>();
+        LocalTensor<T2> xCompute;
+        if constexpr (IsSameType<T1, T2>::value) {
+            xCompute = xLocal;
+        } else {
+            xCompute = xCastBuf.Get<T2>();
+            Cast(xCompute, xLocal, RoundMode::CAST_NONE, calCount);
+            PipeBarrier<PIPE_V>();
+        }
+        // 本次未搬入的wo填-inf，等价于跳过
+        if (woLo > woStart) {
+            Duplicate<T2>(xCompute, static_cast<T2>(tilingData->minFloat), (woLo - woStart) * cAlign);
+        }
+        if (woHi < woStart + woLen) {
+            Duplicate<T2>(xCompute[(woHi - woStart) * cAlign], static_cast<T2>(tilingData->minFloat),
+                          (woStart + woLen - woHi) * cAlign);
+        }
+        LocalTensor<T2> maxLocal = maxBuf.Get<T2>();
+        LocalTensor<int32_t> indicesLocal = indicesBuf.Get<int32_t>();
+        LocalTensor<int32_t> kernelIdxLocal = kernelIdxBuf.Get<int32_t>();
+        LocalTensor<uint16_t> gtMask = gtMaskBuf.Get<uint16_t>();
+        LocalTensor<uint16_t> nanMask = nanMaskBuf.Get<uint16_t>();
+        Duplicate<int32_t>(kernelIdxLocal, kernelIdx, calCount);
+        PipeBarrier<PIPE_V>();
+
+        // x > max或x为NaN时更新，与PyTorch的NaN传播一致
+        Compare(gtMask, xCompute, maxLocal, CMPMODE::GT, cmpCount);
+        Compare(nanMask, xCompute, xCompute, CMPMODE::NE, cmpCount);
+        PipeBarrier<PIPE_V>();
+        Or(gtMask, gtMask, nanMask, cmpCount / (sizeof(uint16_t) * NDHWC_MASK_BITS));
+        PipeBarrier<PIPE_V>();
+        Select(maxLocal, gtMask, xCompute, maxLocal, SELMODE::VSEL_TENSOR_TENSOR_MODE, calCount);
+        LocalTensor<float> indicesFloat = indicesLocal.ReinterpretCast<float>();
+        Select(indicesFloat, gtMask, kernelIdxLocal.ReinterpretCast<float>(), indicesFloat,
+               SELMODE::VSEL_TENSOR_TENSOR_MODE, calCount);
+        PipeBarrier<PIPE_V>();
+        xQue.FreeTensor(xLocal);
+    }
+
+    __aicore__ inline void CopyOut()
+    {
+        LocalTensor<T2> maxLocal = maxBuf.Get<T2>();
+        LocalTensor<int32_t> indicesLocal = indicesBuf.Get<int32_t>();
+        LocalTensor<T1> yLocal = yQue.AllocTensor<T1>();
+        LocalTensor<int32_t> indicesOutLocal = indicesQue.AllocTensor<int32_t>();
+        if constexpr (IsSameType<T1, T2>::value) {
+            DataCopy(yLocal, maxLocal, calCount);
+        } else {
+            Cast(yLocal, maxLocal, RoundMode::CAST_RINT, calCount);
+        }
+        DataCopy(indicesOutLocal, indicesLocal, calCount);
+        yQue.EnQue(yLocal);
+        indicesQue.EnQue(indicesOutLocal);
+
+        uint64_t outGmOffset = (((curN * oD + curOd) * oH + curOh) * oW + woStart) * channels + cStart;
+        yLocal = yQue.DeQue<T1>();
+        DataCopyExtParams yParams{static_cast<uint16_t>(woLen), static_cast<uint32_t>(cLen * sizeof(T1)),
+            static_cast<uint32_t>((cAlign * sizeof(T1) - CeilAlign(cLen * sizeof(T1), NDHWC_BLOCK_BYTES)) /
+                                  NDHWC_BLOCK_BYTES),
+            static_cast<uint32_t>((channels - cLen) * sizeof(T1)), 0};
+        DataCopyPad(yGm[outGmOffset], yLocal, yParams);
+        yQue.FreeTensor(yLocal);
+
+        indicesOutLocal = indicesQue.DeQue<int32_t>();
+        DataCopyExtParams indicesParams{static_cast<uint16_t>(woLen), static_cast<uint32_t>(cLen * sizeof(int32_t)),
+            static_cast<uint32_t>((cAlign * sizeof(int32_t) - CeilAlign(cLen * sizeof(int32_t), NDHWC_BLOCK_BYTES)) /
+                                  NDHWC_BLOCK_BYTES),
+            static_cast<uint32_t>((channels - cLen) * sizeof(int32_t)), 0};
+        DataCopyPad(indicesGm[outGmOffset], indicesOutLocal, indicesParams);
+        indicesQue.FreeTensor(indicesOutLocal);
+    }
+
+private:
+    TPipe* pipe;
+    const MaxPool3DWithArgmaxV2NdhwcTilingData* __restrict tilingData;
+    GlobalTensor<T1> xGm;
+    GlobalTensor<T1> yGm;
+    GlobalTensor<int32_t> indicesGm;
+
+    TQue<QuePosition::VECIN, NDHWC_X_BUFFER_NUM> xQue;
+    TQue<QuePosition::VECOUT, 1> yQue;
+    TQue<QuePosition::VECOUT, 1> indicesQue;
+    TBuf<TPosition::VECCALC> maxBuf;
+    TBuf<TPosition::VECCALC> indicesBuf;
+    TBuf<TPosition::VECCALC> kernelIdxBuf;
+    TBuf<TPosition::VECCALC> gtMaskBuf;
+    TBuf<TPosition::VECCALC> nanMaskBuf;
+    TBuf<TPosition::VECCALC> xCastBuf;
+
+    uint64_t iD;
+    uint64_t iH;
+    uint64_t iW;
+    uint64_t oD;
+    uint64_t oH;
+    uint64_t oW;
+    uint64_t channels;
+    uint64_t cAlignUnit;
+    uint64_t cmpAlignNum;
+    uint64_t taskStart;
+    uint64_t taskNum;
+
+    uint64_t curN;
+    uint64_t curOd;
+    uint64_t curOh;
+    int64_t curDStart;
+    int64_t curHStart;
+    uint64_t kdStart;
+    uint64_t kdEnd;
+    uint64_t khStart;
+    uint64_t khEnd;
+    uint64_t cStart;
+    uint64_t cLen;
+    uint64_t cAlign;
+    uint64_t woStart;
+    uint64_t woLen;
+    uint64_t calCount;
+    uint64_t cmpCount;
+};
+
+#endif  // MAX_POOL3D_WITH_ARGMAX_V2_NDHWC_H_
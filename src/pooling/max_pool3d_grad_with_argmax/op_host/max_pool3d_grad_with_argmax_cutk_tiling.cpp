@@ -38,6 +38,9 @@ ge::graphStatus MaxPool3DGradWithArgmaxCutKTiling::GetShapeAttrsInfo()
 
 bool MaxPool3DGradWithArgmaxCutKTiling::IsCapable()
 {
+    if (maxPoolGradParams.channelLast) {
+        return false;
+    }
     if ((maxPoolGradParams.dilationD != 1) ||
         (maxPoolGradParams.dilationH != 1) ||
         (maxPoolGradParams.dilationW != 1)) {
@@ -0,0 +1,191 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+
+/* !
+ * \file max_pool3d_grad_with_argmax_gather_tiling.cpp
+ * \brief
+ */
+#include <iostream>
+#include "register/op_def_registry.h"
+#include "tiling/tiling_api.h"
+#include "max_pool3d_grad_with_argmax_tiling.h"
+
+namespace optiling {
+//4, overlap gather, dtype=float
+constexpr uint64_t TILING_KEY_GATHER_FLOAT = 400000;
+//4, overlap gather, dtype=half
+constexpr uint64_t TILING_KEY_GATHER_HALF = 400001;
+//4, overlap gather, dtype=bfloat16
+constexpr uint64_t TILING_KEY_GATHER_BF16 = 400002;
+// 每个输入点最多收集的窗口数，超过时(如大kernel、stride为1)回退到原有模板
+constexpr uint64_t GATHER_MAX_COVER_NUM = 27;
+constexpr uint64_t GATHER_MASK_BITS = 8;
+// 段尾哨兵块，越界的gather偏移指向这里，grad为0
+constexpr uint64_t GATHER_SENTINEL_NUM = 8;
+// 每个输入位置的fp32/int32临时量：wi索引、目标索引、gather出的grad和argmax、差值、选择结果
+constexpr uint64_t GATHER_TMP_B32_NUM = 6;
+
+bool MaxPool3DGradWithArgmaxGatherTiling::IsCapable()
+{
+    if (maxPoolGradParams.channelLast || !maxPoolGradParams.isOverLap) {
+        return false;
+    }
+    CalCoverNum();
+    if (coverD * coverH * coverW > GATHER_MAX_COVER_NUM) {
+        return false;
+    }
+    uint64_t diHiWi = maxPoolGradParams.diDim * maxPoolGradParams.hiDim * maxPoolGradParams.wiDim;
+    if (diHiWi > MAX_INT32) {
+        return false;
+    }
+    uint64_t minWi = maxPoolGradParams.wiDim < NUM_PER_REP_B32 ? maxPoolGradParams.wiDim : NUM_PER_REP_B32;
+    return CalUBTotalSize(minWi, 1) <= maxPoolGradParams.maxUbSize - SELECT_RESERVED_UB_SIZE;
+}
+
+void MaxPool3DGradWithArgmaxGatherTiling::CalCoverNum()
+{
+    // 每个维度上覆盖同一输入点的输出窗口数上界
+    coverD = (maxPoolGradParams.kd - 1) * maxPoolGradParams.dilationD / maxPoolGradParams.sd + 1;
+    coverH = (maxPoolGradParams.kh - 1) * maxPoolGradParams.dilationH / maxPoolGradParams.sh + 1;
+    coverW = (maxPoolGradParams.kw - 1) * maxPoolGradParams.dilationW / maxPoolGradParams.sw + 1;
+}
+
+uint64_t MaxPool3DGradWithArgmaxGatherTiling::CalWoSpan(uint64_t wiLen) const
+{
+    // 长度为wiLen的wi区间最多被多少个wo覆盖
+    return (wiLen - 1) / maxPoolGradParams.sw + 1 + coverW;
+}
+
+uint64_t MaxPool3DGradWithArgmaxGatherTiling::CalUBTotalSize(uint64_t wiLen, uint64_t rowLen) const
+{
+    const uint64_t xDtypeSize = maxPoolGradParams.xDtypeSize;
+    const uint64_t wiAlign = vectorutil::CeilAlign(wiLen, NUM_PER_REP_B32);
+    const uint64_t segAlign = vectorutil::CeilAlign(CalWoSpan(wiLen), GATHER_SENTINEL_NUM) + GATHER_SENTINEL_NUM;
+    // 累加结果fp32 + 输出
+    uint64_t accSize = rowLen * wiAlign * (DTYPE_LEN_B32 + xDtypeSize);
+    // 每个wi的coverW个gather偏移、临时量和比较mask
+    uint64_t tmpSize = wiAlign * (coverW + GATHER_TMP_B32_NUM) * DTYPE_LEN_B32 +
+                       vectorutil::CeilAlign(wiAlign / GATHER_MASK_BITS, BLOCK_SIZE);
+    // 一行grad、argmax段及grad的fp32副本
+    uint64_t segSize = segAlign * (xDtypeSize + DTYPE_LEN_B32 + DTYPE_LEN_B32);
+    return accSize + tmpSize + segSize;
+}
+
+bool MaxPool3DGradWithArgmaxGatherTiling::SetGatherTilingParams()
+{
+    const uint64_t ubSize = maxPoolGradParams.maxUbSize - SELECT_RESERVED_UB_SIZE;
+    const uint64_t wiDim = maxPoolGradParams.wiDim;
+    const uint64_t rows = maxPoolGradParams.ncDim * maxPoolGradParams.diDim * maxPoolGradParams.hiDim;
+
+    // 优先整行W，放不下时按64对齐切W
+    wiFactor = wiDim;
+    if (CalUBTotalSize(wiFactor, 1) > ubSize) {
+        wiFactor = vectorutil::FloorAlign(wiDim, NUM_PER_REP_B32);
+        while (wiFactor > NUM_PER_REP_B32 && CalUBTotalSize(wiFactor, 1) > ubSize) {
+            wiFactor -= NUM_PER_REP_B32;
+        }
+    }
+    OP_TILING_CHECK(CalUBTotalSize(wiFactor, 1) > ubSize,
+                    OP_LOGE(context_->GetNodeName(), "Gather wi factor %lu can not fit ub.", wiFactor),
+                    return false);
+    wiOuter = vectorutil::CeilDiv(wiDim, wiFactor);
+    wiTail = wiDim - (wiOuter - 1) * wiFactor;
+    woSpan = CalWoSpan(wiFactor);
+
+    // 剩余UB用于一次处理多行输入，输出时合并为一次搬运
+    uint64_t base = CalUBTotalSize(wiFactor, 1);
+    uint64_t perRow = CalUBTotalSize(wiFactor, NUM_TWO) - base;
+    rowFactor = (perRow == 0 || base >= ubSize) ? 1 : (ubSize - base) / perRow + 1;
+    rowFactor = rowFactor < MAX_BLOCK_COUNT ? rowFactor : MAX_BLOCK_COUNT;
+    uint64_t rowPerCore = vectorutil::CeilDiv(rows, maxPoolGradParams.totalCoreNum);
+    rowFactor = rowFactor < rowPerCore ? rowFactor : rowPerCore;
+    rowOuter = vectorutil::CeilDiv(rows, rowFactor);
+    rowTail = rows - (rowOuter - 1) * rowFactor;
+
+    totalIdx = wiOuter * rowOuter;
+    blockFactor = totalIdx / maxPoolGradParams.totalCoreNum;
+    blockTail = totalIdx % maxPoolGradParams.totalCoreNum;
+    maxPoolGradParams.usedCoreNum = (blockFactor == 0) ? totalIdx : maxPoolGradParams.totalCoreNum;
+    maxPoolGradParams.workspaceSize = 0;
+    return true;
+}
+
+void MaxPool3DGradWithArgmaxGatherTiling::SetGatherTilingData()
+{
+    std::array<uint64_t, DHW_DIMS> inputShapes{maxPoolGradParams.diDim, maxPoolGradParams.hiDim,
+                                               maxPoolGradParams.wiDim};
+    std::array<uint64_t, DHW_DIMS> outShapes{maxPoolGradParams.doDim, maxPoolGradParams.hoDim,
+                                             maxPoolGradParams.woDim};
+    tiling.set_inputShapes(&(inputShapes[0]));
+    tiling.set_outShapes(&(outShapes[0]));
+    tiling.set_sD(maxPoolGradParams.sd);
+    tiling.set_sH(maxPoolGradParams.sh);
+    tiling.set_sW(maxPoolGradParams.sw);
+    tiling.set_pD(maxPoolGradParams.pDTop);
+    tiling.set_pH(maxPoolGradParams.pHTop);
+    tiling.set_pW(maxPoolGradParams.pWTop);
+    tiling.set_coverD(coverD);
+    tiling.set_coverH(coverH);
+    tiling.set_coverW(coverW);
+    tiling.set_wiFactor(wiFactor);
+    tiling.set_wiTail(wiTail);
+    tiling.set_wiOuter(wiOuter);
+    tiling.set_woSpan(woSpan);
+    tiling.set_rowFactor(rowFactor);
+    tiling.set_rowTail(rowTail);
+    tiling.set_rowOuter(rowOuter);
+    tiling.set_blockFactor(blockFactor);
+    tiling.set_blockTail(blockTail);
+    tiling.set_totalIdx(totalIdx);
+    tiling.set_coreNums(maxPoolGradParams.usedCoreNum);
+}
+
+ge::graphStatus MaxPool3DGradWithArgmaxGatherTiling::DoOpTiling()
+{
+    CalCoverNum();
+    bool res = SetGatherTilingParams();
+    OP_TILING_CHECK(!res, OP_LOGE(context_->GetNodeName(), "Gather cal tiling params failed."),
+        return ge::GRAPH_FAILED);
+    SetGatherTilingData();
+    OP_LOGI(context_->GetNodeName(),
+        "TilingData cover: %lu %lu %lu, wiFactor: %lu, wiOuter: %lu, woSpan: %lu, rowFactor: %lu, rowOuter: %lu, "
+        "totalIdx: %lu, usedCoreNum: %lu.",
+        coverD, coverH, coverW, wiFactor, wiOuter, woSpan, rowFactor, rowOuter, totalIdx,
+        maxPoolGradParams.usedCoreNum);
+    return ge::GRAPH_SUCCESS;
+}
+
+ge::graphStatus MaxPool3DGradWithArgmaxGatherTiling::GetWorkspaceSize()
+{
+    context_->SetBlockDim(maxPoolGradParams.usedCoreNum);
+    tiling.SaveToBuffer(context_->GetRawTilingData()->GetData(), context_->GetRawTilingData()->GetCapacity());
+    context_->GetRawTilingData()->SetDataSize(tiling.GetDataSize());
+
+    auto ascendcPlatform = platform_ascendc::PlatformAscendC(context_->GetPlatformInfo());
+    size_t sysWorkSpaceSize = ascendcPlatform.GetLibApiWorkSpaceSize();
+    size_t *currentWorkspace = context_->GetWorkspaceSizes(1);
+    currentWorkspace[0] = sysWorkSpaceSize;
+    return ge::GRAPH_SUCCESS;
+}
+
+uint64_t MaxPool3DGradWithArgmaxGatherTiling::GetTilingKey() const
+{
+    auto xDataType = context_->GetInputDesc(X_INDEX)->GetDataType();
+    if (xDataType == ge::DT_FLOAT) {
+        return TILING_KEY_GATHER_FLOAT;
+    } else if (xDataType == ge::DT_FLOAT16) {
+        return TILING_KEY_GATHER_HALF;
+    }
+    return TILING_KEY_GATHER_BF16;
+}
+
+REGISTER_TILING_TEMPLATE("MaxPool3DGradWithArgmax", MaxPool3DGradWithArgmaxGatherTiling, 1);
+} // namespace optiling
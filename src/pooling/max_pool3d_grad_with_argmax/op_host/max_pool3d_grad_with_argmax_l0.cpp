@@ -60,12 +60,12 @@ const inline aclTensor* MaxPool3DGradWithArgmaxAiCore(const aclTensor *gradOutpu
                                                       const aclTensor *indices, const aclIntArray *kernelSize,
                                                       const aclIntArray *stride, const aclIntArray *padding,
                                                       const aclIntArray *dilation, bool ceilMode,
-                                                      aclTensor *gradInput,
+                                                      const std::string &dataFormat, aclTensor *gradInput,
                                                       aclOpExecutor *executor) {
     L0_DFX(MaxPool3DGradWithArgmaxAiCore, gradOutput, self, indices, kernelSize, stride, padding, dilation, 
-           ceilMode, gradInput);
+           ceilMode, dataFormat, gradInput);
     ADD_TO_LAUNCHER_LIST_AICORE(MaxPool3DGradWithArgmax, OP_INPUT(self, gradOutput, indices), OP_OUTPUT(gradInput),
-  							                             OP_ATTR(kernelSize, stride, padding, dilation, ceilMode));
+  							                             OP_ATTR(kernelSize, stride, padding, dilation, ceilMode, dataFormat));
     return gradInput;
 }
 
@@ -73,7 +73,7 @@ const aclTensor* MaxPool3DGradWithArgmax(const aclTensor *gradOutput, const aclT
                                          const aclTensor *indices, const aclIntArray *kernelSize,
                                          const aclIntArray *stride, const aclIntArray *padding,
                                          const aclIntArray *dilation, bool ceilMode,
-                                         aclOpExecutor *executor) {
+                                         aclOpExecutor *executor, const std::string &dataFormat) {
     const aclIntArray& kernelRef = *kernelSize;
     const int64_t kernelD = kernelRef[0];
     const int64_t kernelH = (kernelRef.Size() == 1) ? kernelD : kernelRef[1];
@@ -105,12 +105,14 @@ const aclTensor* MaxPool3DGradWithArgmax(const aclTensor *gradOutput, const aclT
     aclIntArray* dilation3 = executor->AllocIntArray(dilationSizeData.data(), DHW_DIMS);
 
     op::DataType outType = self->GetDataType();
-    auto gradInput = executor->AllocTensor(self->GetViewShape(), self->GetDataType(), op::Format::FORMAT_NCDHW);
+    // NDHWC时argmax为窗口内偏移，必须走NDHWC原生反向
+    op::Format gradInputFormat = (dataFormat == "NDHWC") ? op::Format::FORMAT_NDHWC : op::Format::FORMAT_NCDHW;
+    auto gradInput = executor->AllocTensor(self->GetViewShape(), self->GetDataType(), gradInputFormat);
 
     if (IsAiCoreSupport(gradOutput)) {
         // 调用算子计算
         return MaxPool3DGradWithArgmaxAiCore(gradOutput, self, indices, kernelSize3, stride3, padding3, dilation3,
-                                             ceilMode, gradInput, executor);
+                                             ceilMode, dataFormat, gradInput, executor);
     } else {
         // 当前没有匹配的aicpu算子
     	  OP_LOGE(ACLNN_ERR_PARAM_INVALID, "no dtype support on AICPU");
@@ -11,6 +11,7 @@
 #ifndef OP_API_INC_LEVEL0_MAX_POOL3D_GRAD_WITH_ARGMAX_H_
 #define OP_API_INC_LEVEL0_MAX_POOL3D_GRAD_WITH_ARGMAX_H_
 
+#include <string>
 #include "opdev/op_executor.h"
 
 namespace l0op {
@@ -18,7 +19,7 @@ const aclTensor* MaxPool3DGradWithArgmax(const aclTensor *gradOutput, const aclT
                                          const aclTensor *indices, const aclIntArray *kernelSize,
                                          const aclIntArray *stride, const aclIntArray *padding,
                                          const aclIntArray *dilation, bool ceilMode,
-                                         aclOpExecutor *executor);
+                                         aclOpExecutor *executor, const std::string &dataFormat = "NCDHW");
 } // l0op
 
 #endif // OP_API_INC_LEVEL0_MAX_POOL3D_GRAD_WITH_ARGMAX_H_
@@ -0,0 +1,184 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+
+/* !
+ * \file max_pool3d_grad_with_argmax_ndhwc_tiling.cpp
+ * \brief
+ */
+#include <iostream>
+#include "register/op_def_registry.h"
+#include "tiling/tiling_api.h"
+#include "max_pool3d_grad_with_argmax_tiling.h"
+
+namespace optiling {
+//3, channel last, dtype=float
+constexpr uint64_t TILING_KEY_NDHWC_FLOAT = 300000;
+//3, channel last, dtype=half
+constexpr uint64_t TILING_KEY_NDHWC_HALF = 300001;
+//3, channel last, dtype=bfloat16
+constexpr uint64_t TILING_KEY_NDHWC_BF16 = 300002;
+// 窗口内偏移以float比较，kd * kh * kw不能超过float可精确表示的整数
+constexpr uint64_t NDHWC_MAX_KERNEL_NUM = 16777216;
+constexpr uint64_t NDHWC_MASK_BITS = 8;
+
+bool MaxPool3DGradWithArgmaxNdhwcTiling::IsCapable()
+{
+    return maxPoolGradParams.channelLast;
+}
+
+uint64_t MaxPool3DGradWithArgmaxNdhwcTiling::CalWoSpan(uint64_t wiLen) const
+{
+    // 长度为wiLen的wi区间最多被多少个wo覆盖
+    uint64_t kwSpan = (maxPoolGradParams.kw - 1) * maxPoolGradParams.dilationW;
+    return (wiLen - 1 + kwSpan) / maxPoolGradParams.sw + 1 + 1;
+}
+
+uint64_t MaxPool3DGradWithArgmaxNdhwcTiling::CalUBTotalSize(uint64_t cAlign, uint64_t wiLen) const
+{
+    const uint64_t xDtypeSize = maxPoolGradParams.xDtypeSize;
+    const uint64_t span = CalWoSpan(wiLen);
+    // 累加结果fp32 + 输出；grad、argmax输入及其fp32副本；一行临时结果和比较mask
+    uint64_t accSize = wiLen * cAlign * (DTYPE_LEN_B32 + xDtypeSize);
+    uint64_t gradCastSize = (xDtypeSize == DTYPE_LEN_B32) ? 0 : DTYPE_LEN_B32;
+    uint64_t inSize = span * cAlign * (xDtypeSize + DTYPE_LEN_B32 + DTYPE_LEN_B32 + gradCastSize);
+    uint64_t tmpSize = cAlign * DTYPE_LEN_B32 + vectorutil::CeilAlign(cAlign / NDHWC_MASK_BITS, BLOCK_SIZE);
+    return accSize + inSize + tmpSize;
+}
+
+bool MaxPool3DGradWithArgmaxNdhwcTiling::SetNdhwcTilingParams()
+{
+    const uint64_t ubSize = maxPoolGradParams.maxUbSize - SELECT_RESERVED_UB_SIZE;
+    const uint64_t channels = maxPoolGradParams.cDim;
+    const uint64_t wiDim = maxPoolGradParams.wiDim;
+
+    // C按64对齐，保证fp32比较、选择的计算量是256B整数倍
+    uint64_t cAlign = vectorutil::CeilAlign(channels, NUM_PER_REP_B32);
+    if (CalUBTotalSize(cAlign, 1) <= ubSize) {
+        cFactor = channels;
+    } else {
+        uint64_t perC = CalUBTotalSize(NUM_PER_REP_B32, 1) / NUM_PER_REP_B32;
+        cFactor = vectorutil::FloorAlign(ubSize / perC, NUM_PER_REP_B32);
+        OP_TILING_CHECK(cFactor == 0,
+                        OP_LOGE(context_->GetNodeName(), "NDHWC kernel w is too large to fit ub."),
+                        return false);
+        cAlign = cFactor;
+    }
+    cOuter = vectorutil::CeilDiv(channels, cFactor);
+    cTail = channels - (cOuter - 1) * cFactor;
+
+    uint64_t perWi = CalUBTotalSize(cAlign, NUM_TWO) - CalUBTotalSize(cAlign, 1);
+    uint64_t base = CalUBTotalSize(cAlign, 1);
+    wiFactor = (perWi == 0 || base >= ubSize) ? 1 : (ubSize - base) / perWi + 1;
+    while (wiFactor > 1 && CalUBTotalSize(cAlign, wiFactor) > ubSize) {
+        wiFactor--;
+    }
+    wiFactor = wiFactor < wiDim ? wiFactor : wiDim;
+    wiFactor = wiFactor < MAX_BLOCK_COUNT ? wiFactor : MAX_BLOCK_COUNT;
+    // 行数不足以占满所有核时沿W继续切分
+    uint64_t rows = maxPoolGradParams.ncDim * maxPoolGradParams.diDim * maxPoolGradParams.hiDim * cOuter;
+    if (rows < maxPoolGradParams.totalCoreNum) {
+        uint64_t wiParts = vectorutil::CeilDiv(maxPoolGradParams.totalCoreNum, rows);
+        uint64_t wiSplit = vectorutil::CeilDiv(wiDim, wiParts);
+        wiFactor = wiSplit < wiFactor ? wiSplit : wiFactor;
+    }
+    wiOuter = vectorutil::CeilDiv(wiDim, wiFactor);
+    wiTail = wiDim - (wiOuter - 1) * wiFactor;
+    woSpan = CalWoSpan(wiFactor);
+    OP_TILING_CHECK(woSpan > MAX_BLOCK_COUNT,
+                    OP_LOGE(context_->GetNodeName(), "NDHWC wo span %lu exceeds max block count.", woSpan),
+                    return false);
+
+    totalIdx = rows * wiOuter;
+    blockFactor = totalIdx / maxPoolGradParams.totalCoreNum;
+    blockTail = totalIdx % maxPoolGradParams.totalCoreNum;
+    maxPoolGradParams.usedCoreNum = (blockFactor == 0) ? totalIdx : maxPoolGradParams.totalCoreNum;
+    maxPoolGradParams.workspaceSize = 0;
+    return true;
+}
+
+void MaxPool3DGradWithArgmaxNdhwcTiling::SetNdhwcTilingData()
+{
+    std::array<uint64_t, DHW_DIMS> inputShapes{maxPoolGradParams.diDim, maxPoolGradParams.hiDim,
+                                               maxPoolGradParams.wiDim};
+    std::array<uint64_t, DHW_DIMS> outShapes{maxPoolGradParams.doDim, maxPoolGradParams.hoDim,
+                                             maxPoolGradParams.woDim};
+    tiling.set_inputShapes(&(inputShapes[0]));
+    tiling.set_outShapes(&(outShapes[0]));
+    tiling.set_kD(maxPoolGradParams.kd);
+    tiling.set_kH(maxPoolGradParams.kh);
+    tiling.set_kW(maxPoolGradParams.kw);
+    tiling.set_sD(maxPoolGradParams.sd);
+    tiling.set_sH(maxPoolGradParams.sh);
+    tiling.set_sW(maxPoolGradParams.sw);
+    tiling.set_pD(maxPoolGradParams.pDTop);
+    tiling.set_pH(maxPoolGradParams.pHTop);
+    tiling.set_pW(maxPoolGradParams.pWTop);
+    tiling.set_dD(maxPoolGradParams.dilationD);
+    tiling.set_dH(maxPoolGradParams.dilationH);
+    tiling.set_dW(maxPoolGradParams.dilationW);
+    tiling.set_channels(maxPoolGradParams.cDim);
+    tiling.set_cFactor(cFactor);
+    tiling.set_cTail(cTail);
+    tiling.set_cOuter(cOuter);
+    tiling.set_wiFactor(wiFactor);
+    tiling.set_wiTail(wiTail);
+    tiling.set_wiOuter(wiOuter);
+    tiling.set_woSpan(woSpan);
+    tiling.set_blockFactor(blockFactor);
+    tiling.set_blockTail(blockTail);
+    tiling.set_totalIdx(totalIdx);
+    tiling.set_coreNums(maxPoolGradParams.usedCoreNum);
+}
+
+ge::graphStatus MaxPool3DGradWithArgmaxNdhwcTiling::DoOpTiling()
+{
+    uint64_t kernelNum = maxPoolGradParams.kd * maxPoolGradParams.kh * maxPoolGradParams.kw;
+    OP_TILING_CHECK(kernelNum > NDHWC_MAX_KERNEL_NUM,
+                    OP_LOGE(context_->GetNodeName(), "NDHWC kernel size %lu is too large.", kernelNum),
+                    return ge::GRAPH_FAILED);
+    bool res = SetNdhwcTilingParams();
+    OP_TILING_CHECK(!res, OP_LOGE(context_->GetNodeName(), "NDHWC cal tiling params failed."),
+        return ge::GRAPH_FAILED);
+    SetNdhwcTilingData();
+    OP_LOGI(context_->GetNodeName(),
+        "TilingData n: %lu, c: %lu, cFactor: %lu, cOuter: %lu, wiFactor: %lu, wiOuter: %lu, woSpan: %lu, "
+        "totalIdx: %lu, usedCoreNum: %lu.",
+        maxPoolGradParams.ncDim, maxPoolGradParams.cDim, cFactor, cOuter, wiFactor, wiOuter, woSpan, totalIdx,
+        maxPoolGradParams.usedCoreNum);
+    return ge::GRAPH_SUCCESS;
+}
+
+ge::graphStatus MaxPool3DGradWithArgmaxNdhwcTiling::GetWorkspaceSize()
+{
+    context_->SetBlockDim(maxPoolGradParams.usedCoreNum);
+    tiling.SaveToBuffer(context_->GetRawTilingData()->GetData(), context_->GetRawTilingData()->GetCapacity());
+    context_->GetRawTilingData()->SetDataSize(tiling.GetDataSize());
+
+    auto ascendcPlatform = platform_ascendc::PlatformAscendC(context_->GetPlatformInfo());
+    size_t sysWorkSpaceSize = ascendcPlatform.GetLibApiWorkSpaceSize();
+    size_t *currentWorkspace = context_->GetWorkspaceSizes(1);
+    currentWorkspace[0] = sysWorkSpaceSize;
+    return ge::GRAPH_SUCCESS;
+}
+
+uint64_t MaxPool3DGradWithArgmaxNdhwcTiling::GetTilingKey() const
+{
+    auto xDataType = context_->GetInputDesc(X_INDEX)->GetDataType();
+    if (xDataType == ge::DT_FLOAT) {
+        return TILING_KEY_NDHWC_FLOAT;
+    } else if (xDataType == ge::DT_FLOAT16) {
+        return TILING_KEY_NDHWC_HALF;
+    }
+    return TILING_KEY_NDHWC_BF16;
+}
+
+REGISTER_TILING_TEMPLATE("MaxPool3DGradWithArgmax", MaxPool3DGradWithArgmaxNdhwcTiling, 8);
+} // namespace optiling
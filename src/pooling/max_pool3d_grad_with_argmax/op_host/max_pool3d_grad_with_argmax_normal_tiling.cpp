@@ -32,6 +32,9 @@ ge::graphStatus MaxPool3DGradWithArgmaxNormalTiling::GetShapeAttrsInfo()
 
 bool MaxPool3DGradWithArgmaxNormalTiling::IsCapable()
 {
+    if (maxPoolGradParams.channelLast) {
+        return false;
+    }
     if ((maxPoolGradParams.dilationD != 1) || (maxPoolGradParams.dilationH != 1) ||
         (maxPoolGradParams.dilationW != 1)) {
         return false;
@@ -331,5 +334,5 @@ ge::graphStatus MaxPool3DGradWithArgmaxNormalTiling::DoOpTiling()
     return ge::GRAPH_SUCCESS;
 }
 
-REGISTER_TILING_TEMPLATE("MaxPool3DGradWithArgmax", MaxPool3DGradWithArgmaxNormalTiling, 2);
+REGISTER_TILING_TEMPLATE("MaxPool3DGradWithArgmax", MaxPool3DGradWithArgmaxNormalTiling, 3);
 } // namespace optiling
@@ -30,6 +30,9 @@ ge::graphStatus MaxPool3DGradWithArgmaxScatterTiling::GetShapeAttrsInfo()
 
 bool MaxPool3DGradWithArgmaxScatterTiling::IsCapable()
 {
+    if (maxPoolGradParams.channelLast) {
+        return false;
+    }
     return true;
 }
 
@@ -150,5 +153,5 @@ ge::graphStatus MaxPool3DGradWithArgmaxScatterTiling::DoOpTiling()
     return ge::GRAPH_SUCCESS;
 }
 
-REGISTER_TILING_TEMPLATE("MaxPool3DGradWithArgmax", MaxPool3DGradWithArgmaxScatterTiling, 6);
+REGISTER_TILING_TEMPLATE("MaxPool3DGradWithArgmax", MaxPool3DGradWithArgmaxScatterTiling, 7);
 } // namespace optiling
@@ -263,6 +263,60 @@ BEGIN_TILING_DATA_DEF(MaxPool3DGradWithArgmaxSplitWTilingData)
     TILING_DATA_FIELD_DEF(uint64_t, sizeValues);
 END_TILING_DATA_DEF;
 
+BEGIN_TILING_DATA_DEF(MaxPool3DGradWithArgmaxNdhwcTilingData)
+    TILING_DATA_FIELD_DEF_ARR(uint64_t, DHW_DIMS, inputShapes);
+    TILING_DATA_FIELD_DEF_ARR(uint64_t, DHW_DIMS, outShapes);
+    TILING_DATA_FIELD_DEF(uint64_t, kD);
+    TILING_DATA_FIELD_DEF(uint64_t, kW);
+    TILING_DATA_FIELD_DEF(uint64_t, kH);
+    TILING_DATA_FIELD_DEF(uint64_t, sD);
+    TILING_DATA_FIELD_DEF(uint64_t, sW);
+    TILING_DATA_FIELD_DEF(uint64_t, sH);
+    TILING_DATA_FIELD_DEF(uint64_t, pD);
+    TILING_DATA_FIELD_DEF(uint64_t, pW);
+    TILING_DATA_FIELD_DEF(uint64_t, pH);
+    TILING_DATA_FIELD_DEF(uint64_t, dD);
+    TILING_DATA_FIELD_DEF(uint64_t, dW);
+    TILING_DATA_FIELD_DEF(uint64_t, dH);
+    TILING_DATA_FIELD_DEF(uint64_t, channels);
+    TILING_DATA_FIELD_DEF(uint64_t, cFactor);
+    TILING_DATA_FIELD_DEF(uint64_t, cTail);
+    TILING_DATA_FIELD_DEF(uint64_t, cOuter);
+    TILING_DATA_FIELD_DEF(uint64_t, wiFactor);
+    TILING_DATA_FIELD_DEF(uint64_t, wiTail);
+    TILING_DATA_FIELD_DEF(uint64_t, wiOuter);
+    TILING_DATA_FIELD_DEF(uint64_t, woSpan);
+    TILING_DATA_FIELD_DEF(uint64_t, blockFactor);
+    TILING_DATA_FIELD_DEF(uint64_t, blockTail);
+    TILING_DATA_FIELD_DEF(uint64_t, totalIdx);
+    TILING_DATA_FIELD_DEF(uint64_t, coreNums);
+END_TILING_DATA_DEF;
+
+BEGIN_TILING_DATA_DEF(MaxPool3DGradWithArgmaxGatherTilingData)
+    TILING_DATA_FIELD_DEF_ARR(uint64_t, DHW_DIMS, inputShapes);
+    TILING_DATA_FIELD_DEF_ARR(uint64_t, DHW_DIMS, outShapes);
+    TILING_DATA_FIELD_DEF(uint64_t, sD);
+    TILING_DATA_FIELD_DEF(uint64_t, sH);
+    TILING_DATA_FIELD_DEF(uint64_t, sW);
+    TILING_DATA_FIELD_DEF(uint64_t, pD);
+    TILING_DATA_FIELD_DEF(uint64_t, pH);
+    TILING_DATA_FIELD_DEF(uint64_t, pW);
+    TILING_DATA_FIELD_DEF(uint64_t, coverD);
+    TILING_DATA_FIELD_DEF(uint64_t, coverH);
+    TILING_DATA_FIELD_DEF(uint64_t, coverW);
+    TILING_DATA_FIELD_DEF(uint64_t, wiFactor);
+    TILING_DATA_FIELD_DEF(uint64_t, wiTail);
+    TILING_DATA_FIELD_DEF(uint64_t, wiOuter);
+    TILING_DATA_FIELD_DEF(uint64_t, woSpan);
+    TILING_DATA_FIELD_DEF(uint64_t, rowFactor);
+    TILING_DATA_FIELD_DEF(uint64_t, rowTail);
+    TILING_DATA_FIELD_DEF(uint64_t, rowOuter);
+    TILING_DATA_FIELD_DEF(uint64_t, blockFactor);
+    TILING_DATA_FIELD_DEF(uint64_t, blockTail);
+    TILING_DATA_FIELD_DEF(uint64_t, totalIdx);
+    TILING_DATA_FIELD_DEF(uint64_t, coreNums);
+END_TILING_DATA_DEF;
+
 REGISTER_TILING_DATA_CLASS(MaxPool3DGradWithArgmax, MaxPool3DGradWithArgmaxTilingData);
 
 //1, splitD=0, splitH=0, splitW=0, splitKernel = 0, dtype=float=0
@@ -301,6 +355,20 @@ REGISTER_TILING_DATA_CLASS(MaxPool3DGradWithArgmax_111101, MaxPool3DGradWithArgm
 REGISTER_TILING_DATA_CLASS(MaxPool3DGradWithArgmax_211101, MaxPool3DGradWithArgmaxSplitWTilingData);
 REGISTER_TILING_DATA_CLASS(MaxPool3DGradWithArgmax_111102, MaxPool3DGradWithArgmaxSplitWTilingData);
 
+//3, channel last, dtype=float=0
+//3, channel last, dtype=half=1
+//3, channel last, dtype=bfloat16=2
+REGISTER_TILING_DATA_CLASS(MaxPool3DGradWithArgmax_300000, MaxPool3DGradWithArgmaxNdhwcTilingData);
+REGISTER_TILING_DATA_CLASS(MaxPool3DGradWithArgmax_300001, MaxPool3DGradWithArgmaxNdhwcTilingData);
+REGISTER_TILING_DATA_CLASS(MaxPool3DGradWithArgmax_300002, MaxPool3DGradWithArgmaxNdhwcTilingData);
+
+//4, overlap gather, dtype=float=0
+//4, overlap gather, dtype=half=1
+//4, overlap gather, dtype=bfloat16=2
+REGISTER_TILING_DATA_CLASS(MaxPool3DGradWithArgmax_400000, MaxPool3DGradWithArgmaxGatherTilingData);
+REGISTER_TILING_DATA_CLASS(MaxPool3DGradWithArgmax_400001, MaxPool3DGradWithArgmaxGatherTilingData);
+REGISTER_TILING_DATA_CLASS(MaxPool3DGradWithArgmax_400002, MaxPool3DGradWithArgmaxGatherTilingData);
+
 struct InputInfo {
     uint64_t batches;
     std::array<uint64_t, DHW_DIMS> inputShape;
@@ -361,11 +429,13 @@ constexpr size_t STRIDES_ATTR_INDEX = 1U;
 constexpr size_t PADS_ATTR_INDEX = 2U;
 constexpr size_t DILATION_ATTR_INDEX = 3U;
 constexpr size_t CEIL_MODE_ATTR_INDEX = 4U;
+constexpr size_t DATA_FORMAT_ATTR_INDEX = 5U;
 // Params const
 constexpr uint64_t NUM_TWO = 2;
 constexpr size_t NC_DIM_NUM = 2;
 constexpr size_t DHW_DIM_NUM = 3;
 constexpr size_t NCDHW_DIM_NUM = 5;
+constexpr size_t NDHWC_C_INDEX = 4;
 constexpr uint32_t DTYPE_LEN_B8 = 1;
 constexpr uint32_t DTYPE_LEN_B16 = 2;
 constexpr uint32_t DTYPE_LEN_B32 = 4;
@@ -403,6 +473,7 @@ struct MaxPoolGradWithArgmaxTilingParams {
     uint64_t xDtypeSize{0};
     uint64_t indexDtypeSize{0};
     uint64_t ncDim{0};
+    uint64_t cDim{1};
     uint64_t diDim{0};
     uint64_t hiDim{0};
     uint64_t wiDim{0};
@@ -463,6 +534,8 @@ struct MaxPoolGradWithArgmaxTilingParams {
     uint32_t ubCutAxis{0};
     bool ceilMode{false};
     bool isOverLap{false};
+    // NDHWC时ncDim只含N，C记录在cDim
+    bool channelLast{false};
 };
 
 class MaxPool3DGradWithArgmaxTilingBase : public TilingBaseClass {
@@ -474,6 +547,7 @@ public:
     MaxPool3DGradWithArgmaxTilingData tilingData;
     MaxPoolGradWithArgmaxTilingParams maxPoolGradParams;
 
+    void SetDataFormat();
     bool CheckInputShape();
     ge::graphStatus CheckInputDtype();
     ge::graphStatus CheckAttrShape();
@@ -569,6 +643,74 @@ private:
     void PrintScatterTilingData();
 };
 
+class MaxPool3DGradWithArgmaxNdhwcTiling : public MaxPool3DGradWithArgmaxTilingBase {
+public:
+    explicit MaxPool3DGradWithArgmaxNdhwcTiling(gert::TilingContext *context_)
+        : MaxPool3DGradWithArgmaxTilingBase(context_)
+    {}
+    ~MaxPool3DGradWithArgmaxNdhwcTiling() override {}
+
+protected:
+    bool IsCapable() override;
+    ge::graphStatus DoOpTiling() override;
+    ge::graphStatus GetWorkspaceSize() override;
+    uint64_t GetTilingKey() const override;
+
+private:
+    uint64_t CalWoSpan(uint64_t wiLen) const;
+    uint64_t CalUBTotalSize(uint64_t cAlign, uint64_t wiLen) const;
+    bool SetNdhwcTilingParams();
+    void SetNdhwcTilingData();
+
+    MaxPool3DGradWithArgmaxNdhwcTilingData tiling;
+    uint64_t cFactor{1};
+    uint64_t cTail{1};
+    uint64_t cOuter{1};
+    uint64_t wiFactor{1};
+    uint64_t wiTail{1};
+    uint64_t wiOuter{1};
+    uint64_t woSpan{1};
+    uint64_t blockFactor{0};
+    uint64_t blockTail{0};
+    uint64_t totalIdx{0};
+};
+
+class MaxPool3DGradWithArgmaxGatherTiling : public MaxPool3DGradWithArgmaxTilingBase {
+public:
+    explicit MaxPool3DGradWithArgmaxGatherTiling(gert::TilingContext *context_)
+        : MaxPool3DGradWithArgmaxTilingBase(context_)
+    {}
+    ~MaxPool3DGradWithArgmaxGatherTiling() override {}
+
+protected:
+    bool IsCapable() override;
+    ge::graphStatus DoOpTiling() override;
+    ge::graphStatus GetWorkspaceSize() override;
+    uint64_t GetTilingKey() const override;
+
+private:
+    void CalCoverNum();
+    uint64_t CalWoSpan(uint64_t wiLen) const;
+    uint64_t CalUBTotalSize(uint64_t wiLen, uint64_t rowLen) const;
+    bool SetGatherTilingParams();
+    void SetGatherTilingData();
+
+    MaxPool3DGradWithArgmaxGatherTilingData tiling;
+    uint64_t coverD{1};
+    uint64_t coverH{1};
+    uint64_t coverW{1};
+    uint64_t wiFactor{1};
+    uint64_t wiTail{1};
+    uint64_t wiOuter{1};
+    uint64_t woSpan{1};
+    uint64_t rowFactor{1};
+    uint64_t rowTail{1};
+    uint64_t rowOuter{1};
+    uint64_t blockFactor{0};
+    uint64_t blockTail{0};
+    uint64_t totalIdx{0};
+};
+
 class MaxPool3DGradWithArgmaxBaseSplitTiling : public MaxPool3DGradWithArgmaxTilingBase {
 	public:
 		explicit MaxPool3DGradWithArgmaxBaseSplitTiling(gert::TilingContext* context) : MaxPool3DGradWithArgmaxTilingBase(context) {
@@ -15,6 +15,7 @@
  */
 
 //#include "vector_tiling_util.h"
+#include <cstring>
 #include "max_pool3d_grad_with_argmax_tiling.h"
 
 namespace optiling {
@@ -26,6 +27,14 @@ constexpr uint64_t D_ATTR_INDEX = 0;
 constexpr uint64_t H_ATTR_INDEX = 1;
 constexpr uint64_t W_ATTR_INDEX = 2;
 
+void MaxPool3DGradWithArgmaxTilingBase::SetDataFormat()
+{
+    // data_format缺省时按NCDHW处理，兼容未携带该属性的老图
+    auto attrs = context_->GetAttrs();
+    const char *dataFormat = (attrs == nullptr) ? nullptr : attrs->GetStr(DATA_FORMAT_ATTR_INDEX);
+    maxPoolGradParams.channelLast = (dataFormat != nullptr) && (strcmp(dataFormat, "NDHWC") == 0);
+}
+
 bool MaxPool3DGradWithArgmaxTilingBase::CheckInputShape()
 {
     const gert::StorageShape *xShape = context_->GetInputShape(X_INDEX);
@@ -62,7 +71,9 @@ bool MaxPool3DGradWithArgmaxTilingBase::CheckInputShape()
     }
 
     // Input NCDim should be equal
-    for (size_t i = 0; i < NC_DIM_NUM; i++) {
+    const size_t ncIndex[NC_DIM_NUM] = {0, maxPoolGradParams.channelLast ? NDHWC_C_INDEX : 1};
+    for (size_t j = 0; j < NC_DIM_NUM; j++) {
+        size_t i = ncIndex[j];
         uint64_t xDimValue = xShape->GetStorageShape().GetDim(i);
         uint64_t gradDimValue = gradShape->GetStorageShape().GetDim(i);
         OP_TILING_CHECK(
@@ -162,14 +173,21 @@ ge::graphStatus MaxPool3DGradWithArgmaxTilingBase::SetInputParams()
     const gert::Shape xShape = context_->GetInputShape(X_INDEX)->GetStorageShape();
     const gert::Shape gradShape = context_->GetInputShape(GRAD_INDEX)->GetStorageShape();
     uint64_t n = xShape.GetDim(0);
-    uint64_t c = xShape.GetDim(1);
-    maxPoolGradParams.ncDim = n * c;
-    maxPoolGradParams.diDim = xShape.GetDim(D_SHAPE_INDEX);
-    maxPoolGradParams.hiDim = xShape.GetDim(H_SHAPE_INDEX);
-    maxPoolGradParams.wiDim = xShape.GetDim(W_SHAPE_INDEX);
-    maxPoolGradParams.doDim = gradShape.GetDim(D_SHAPE_INDEX);
-    maxPoolGradParams.hoDim = gradShape.GetDim(H_SHAPE_INDEX);
-    maxPoolGradParams.woDim = gradShape.GetDim(W_SHAPE_INDEX);
+    // NDHWC的DHW位于1~3轴
+    uint64_t dhwOffset = maxPoolGradParams.channelLast ? 1 : 0;
+    if (maxPoolGradParams.channelLast) {
+        maxPoolGradParams.ncDim = n;
+        maxPoolGradParams.cDim = xShape.GetDim(NDHWC_C_INDEX);
+    } else {
+        maxPoolGradParams.ncDim = n * xShape.GetDim(1);
+        maxPoolGradParams.cDim = 1;
+    }
+    maxPoolGradParams.diDim = xShape.GetDim(D_SHAPE_INDEX - dhwOffset);
+    maxPoolGradParams.hiDim = xShape.GetDim(H_SHAPE_INDEX - dhwOffset);
+    maxPoolGradParams.wiDim = xShape.GetDim(W_SHAPE_INDEX - dhwOffset);
+    maxPoolGradParams.doDim = gradShape.GetDim(D_SHAPE_INDEX - dhwOffset);
+    maxPoolGradParams.hoDim = gradShape.GetDim(H_SHAPE_INDEX - dhwOffset);
+    maxPoolGradParams.woDim = gradShape.GetDim(W_SHAPE_INDEX - dhwOffset);
     maxPoolGradParams.vl = NUM_PER_REP_B32;
     return ge::GRAPH_SUCCESS;
 }
@@ -294,6 +312,7 @@ ge::graphStatus MaxPool3DGradWithArgmaxTilingBase::GetShapeAttrsInfo()
     OP_LOGD(context_->GetNodeName(), "Enter MaxPool3DGradWithArgmaxTilingBase GetShapeAttrsInfo.");
     OP_TILING_CHECK(ge::GRAPH_SUCCESS != CheckInputDtype(),
                     OP_LOGE(context_->GetNodeName(), "The input dtype is invalid."), return ge::GRAPH_FAILED);
+    SetDataFormat();
     OP_TILING_CHECK(!CheckInputShape(),
                     OP_LOGE(context_->GetNodeName(), "The input relationship is invalid."), return ge::GRAPH_FAILED);
     OP_TILING_CHECK(ge::GRAPH_SUCCESS != CheckAttrShape(),
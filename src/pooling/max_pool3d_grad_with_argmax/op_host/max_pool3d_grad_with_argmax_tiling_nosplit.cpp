@@ -36,6 +36,9 @@ constexpr uint64_t BATCHES = 1000;
 constexpr uint64_t BLOCK_KERNEL = 8;
 
 bool MaxPool3DGradWithArgmaxNoSplitTiling::IsCapable() {
+    if (maxPoolGradParams.channelLast) {
+        return false;
+    }
     auto summaryMemory = CalcBufferSizes(inputData.inputShape, padOutputData.padOutputShape,
                                          padOutputData.padOutputShape[W_DIM] * padOutputData.padOutputShape[H_DIM], bufSizes, 0);
     uint64_t dhwShape = inputData.outShape[D_DIM] * inputData.outShape[H_DIM] * inputData.outShape[W_DIM];
@@ -115,6 +118,6 @@ ge::graphStatus MaxPool3DGradWithArgmaxNoSplitTiling::PostTiling() {
     return ge::GRAPH_SUCCESS;
 }
 
-REGISTER_TILING_TEMPLATE("MaxPool3DGradWithArgmax", MaxPool3DGradWithArgmaxNoSplitTiling, 1);
+REGISTER_TILING_TEMPLATE("MaxPool3DGradWithArgmax", MaxPool3DGradWithArgmaxNoSplitTiling, 2);
 
 } // namespace optiling
\ No newline at end of file
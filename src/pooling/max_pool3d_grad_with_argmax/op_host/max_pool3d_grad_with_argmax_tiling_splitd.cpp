@@ -32,6 +32,9 @@ using namespace AscendC;
 namespace optiling {
 
 bool MaxPool3DGradWithArgmaxSplitDTiling::IsCapable() {
+    if (maxPoolGradParams.channelLast) {
+        return false;
+    }
     std::array<uint64_t, DHW_DIMS> parts{inputData.inputShape[D_DIM], inputData.inputShape[H_DIM], inputData.inputShape[W_DIM]};
     std::array<uint64_t, DHW_DIMS> partOuts{padOutputData.padOutputShape[D_DIM], padOutputData.padOutputShape[H_DIM], padOutputData.padOutputShape[W_DIM]};
 
@@ -113,6 +116,6 @@ ge::graphStatus MaxPool3DGradWithArgmaxSplitDTiling::PostTiling() {
     return ge::GRAPH_SUCCESS;
 }
 
-REGISTER_TILING_TEMPLATE("MaxPool3DGradWithArgmax", MaxPool3DGradWithArgmaxSplitDTiling, 3);
+REGISTER_TILING_TEMPLATE("MaxPool3DGradWithArgmax", MaxPool3DGradWithArgmaxSplitDTiling, 4);
 
 } // namespace optiling
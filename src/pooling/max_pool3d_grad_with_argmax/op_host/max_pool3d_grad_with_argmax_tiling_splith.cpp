@@ -31,6 +31,9 @@ using namespace AscendC;
 namespace optiling {
 
 bool MaxPool3DGradWithArgmaxSplitHTiling::IsCapable() {
+    if (maxPoolGradParams.channelLast) {
+        return false;
+    }
     splitData.partD = 1;
     splitData.partOutD = inputData.dilation[D_DIM] * (inputData.kernelSize[D_DIM] - 1) + 1;
     std::array<uint64_t, DHW_DIMS> parts{splitData.partD, inputData.inputShape[H_DIM], inputData.inputShape[W_DIM]};
@@ -114,6 +117,6 @@ ge::graphStatus MaxPool3DGradWithArgmaxSplitHTiling::PostTiling() {
     return ge::GRAPH_SUCCESS;
 }
 
-REGISTER_TILING_TEMPLATE("MaxPool3DGradWithArgmax", MaxPool3DGradWithArgmaxSplitHTiling, 4);
+REGISTER_TILING_TEMPLATE("MaxPool3DGradWithArgmax", MaxPool3DGradWithArgmaxSplitHTiling, 5);
 
 } // namespace optiling
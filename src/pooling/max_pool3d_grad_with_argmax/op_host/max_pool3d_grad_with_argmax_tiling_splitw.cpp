@@ -32,6 +32,9 @@ using namespace AscendC;
 namespace optiling {
 
 bool MaxPool3DGradWithArgmaxSplitWTiling::IsCapable() {
+    if (maxPoolGradParams.channelLast) {
+        return false;
+    }
     splitData.partD = 1;
     splitData.partOutD = inputData.dilation[D_DIM] * (inputData.kernelSize[D_DIM] - 1) + 1;
     splitData.partH = 1;
@@ -117,6 +120,6 @@ ge::graphStatus MaxPool3DGradWithArgmaxSplitWTiling::PostTiling() {
     return ge::GRAPH_SUCCESS;
 }
 
-REGISTER_TILING_TEMPLATE("MaxPool3DGradWithArgmax", MaxPool3DGradWithArgmaxSplitWTiling, 5);
+REGISTER_TILING_TEMPLATE("MaxPool3DGradWithArgmax", MaxPool3DGradWithArgmaxSplitWTiling, 6);
 
 } // namespace optiling
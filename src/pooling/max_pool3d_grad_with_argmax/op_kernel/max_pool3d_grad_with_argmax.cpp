@@ -22,6 +22,8 @@
 #include "max_pool3d_grad_with_argmax_cutk_d.h"
 #include "max_pool3d_grad_with_argmax_cutk_dh.h"
 #include "max_pool3d_grad_with_argmax_cutk_dhw.h"
+#include "max_pool3d_grad_with_argmax_ndhwc.h"
+#include "max_pool3d_grad_with_argmax_gather.h"
 
 using namespace MaxPool3DGradWithArgmax;
 
@@ -68,6 +70,12 @@ extern "C" __global__ __aicore__ void max_pool3d_grad_with_argmax(GM_ADDR x, GM_
     // 111100 = 1, splitD=1 splitH=1 splitW=1 splitKernel=0 type=float(0)
     // 111101 = 1, splitD=1 splitH=1 splitW=1 splitKernel=0 type=half(1)
     // 111102 = 1, splitD=1 splitH=1 splitW=1 splitKernel=0 type=bfloat(2)
+    // 300000 = 3, channel last type=float(0)
+    // 300001 = 3, channel last type=half(1)
+    // 300002 = 3, channel last type=bfloat(2)
+    // 400000 = 4, overlap gather type=float(0)
+    // 400001 = 4, overlap gather type=half(1)
+    // 400002 = 4, overlap gather type=bfloat(2)
 
     TPipe pipe;
     // The percentile determines if overlap occurs
@@ -204,6 +212,42 @@ extern "C" __global__ __aicore__ void max_pool3d_grad_with_argmax(GM_ADDR x, GM_
         KernelMaxPool3DGradWithArgmaxSplitW<float,bfloat16_t> op(tilingData);
         op.Init(grad, x, argmax, y, userWS);
         op.Process();
+    } else if (TILING_KEY_IS(300000)) {
+        GET_TILING_DATA_WITH_STRUCT(MaxPool3DGradWithArgmaxNdhwcTilingData, tilingDataIn, tiling);
+        const MaxPool3DGradWithArgmaxNdhwcTilingData *__restrict tilingData = &tilingDataIn;
+        KernelMaxPool3DGradWithArgmaxNdhwc<float> op(tilingData);
+        op.Init(x, grad, argmax, y, &pipe);
+        op.Process();
+    } else if (TILING_KEY_IS(300001)) {
+        GET_TILING_DATA_WITH_STRUCT(MaxPool3DGradWithArgmaxNdhwcTilingData, tilingDataIn, tiling);
+        const MaxPool3DGradWithArgmaxNdhwcTilingData *__restrict tilingData = &tilingDataIn;
+        KernelMaxPool3DGradWithArgmaxNdhwc<half> op(tilingData);
+        op.Init(x, grad, argmax, y, &pipe);
+        op.Process();
+    } else if (TILING_KEY_IS(300002)) {
+        GET_TILING_DATA_WITH_STRUCT(MaxPool3DGradWithArgmaxNdhwcTilingData, tilingDataIn, tiling);
+        const MaxPool3DGradWithArgmaxNdhwcTilingData *__restrict tilingData = &tilingDataIn;
+        KernelMaxPool3DGradWithArgmaxNdhwc<bfloat16_t> op(tilingData);
+        op.Init(x, grad, argmax, y, &pipe);
+        op.Process();
+    } else if (TILING_KEY_IS(400000)) {
+        GET_TILING_DATA_WITH_STRUCT(MaxPool3DGradWithArgmaxGatherTilingData, tilingDataIn, tiling);
+        const MaxPool3DGradWithArgmaxGatherTilingData *__restrict tilingData = &tilingDataIn;
+        KernelMaxPool3DGradWithArgmaxGather<float> op(tilingData);
+        op.Init(x, grad, argmax, y, &pipe);
+        op.Process();
+    } else if (TILING_KEY_IS(400001)) {
+        GET_TILING_DATA_WITH_STRUCT(MaxPool3DGradWithArgmaxGatherTilingData, tilingDataIn, tiling);
+        const MaxPool3DGradWithArgmaxGatherTilingData *__restrict tilingData = &tilingDataIn;
+        KernelMaxPool3DGradWithArgmaxGather<half> op(tilingData);
+        op.Init(x, grad, argmax, y, &pipe);
+        op.Process();
+    } else if (TILING_KEY_IS(400002)) {
+        GET_TILING_DATA_WITH_STRUCT(MaxPool3DGradWithArgmaxGatherTilingData, tilingDataIn, tiling);
+        const MaxPool3DGradWithArgmaxGatherTilingData *__restrict tilingData = &tilingDataIn;
+        KernelMaxPool3DGradWithArgmaxGather<bfloat16_t> op(tilingData);
+        op.Init(x, grad, argmax, y, &pipe);
+        op.Process();
     }
 
     return;
@@ -0,0 +1,300 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file max_pool3d_grad_with_argmax_gather.h
+ * \brief 窗口重叠时的NCDHW反向。每个任务负责若干行输入(nc, id, ih)的一段wi，
+ *        每个输入点从覆盖它的输出窗口中收集argmax命中自己的梯度，按固定顺序累加，
+ *        不需要原子累加和workspace，结果确定。沿W向量化，wo到wi的映射用Gather完成。
+ */
+
+#ifndef OPP_MAX_POOL3D_GRAD_WITH_ARGMAX_GATHER_H
+#define OPP_MAX_POOL3D_GRAD_WITH_ARGMAX_GATHER_H
+
+#include "kernel_operator.h"
+#include "kernel_tiling/kernel_tiling.h"
+
+using namespace AscendC;
+
+template <typename T>
+class KernelMaxPool3DGradWithArgmaxGather {
+public:
+    __aicore__ inline KernelMaxPool3DGradWithArgmaxGather(
+        const MaxPool3DGradWithArgmaxGatherTilingData* __restrict tilingData_) : tilingData(tilingData_) {}
+
+    __aicore__ inline void Init(GM_ADDR x, GM_ADDR grad, GM_ADDR argmax, GM_ADDR y, TPipe* pipeIn)
+    {
+        (void)x;
+        pipe = pipeIn;
+        gradGm.SetGlobalBuffer((__gm__ T*)grad);
+        argmaxGm.SetGlobalBuffer((__gm__ int32_t*)argmax);
+        yGm.SetGlobalBuffer((__gm__ T*)y);
+
+        iD = tilingData->inputShapes[0];
+        iH = tilingData->inputShapes[1];
+        iW = tilingData->inputShapes[2];
+        oD = tilingData->outShapes[0];
+        oH = tilingData->outShapes[1];
+        oW = tilingData->outShapes[2];
+
+        wiAlignMax = CeilAlignNum(tilingData->wiFactor, REPEAT_NUM);
+        sentinel = CeilAlignNum(tilingData->woSpan, SENTINEL_NUM);
+        uint64_t segSize = sentinel + SENTINEL_NUM;
+        uint64_t accSize = tilingData->rowFactor * wiAlignMax;
+        pipe->InitBuffer(gradQue, 1, segSize * sizeof(T));
+        pipe->InitBuffer(argmaxQue, 1, segSize * sizeof(int32_t));
+        pipe->InitBuffer(yQue, 1, accSize * sizeof(T));
+        pipe->InitBuffer(accBuf, accSize * sizeof(float));
+        pipe->InitBuffer(gradCastBuf, segSize * sizeof(float));
+        pipe->InitBuffer(offsetBuf, tilingData->coverW * wiAlignMax * sizeof(uint32_t));
+        pipe->InitBuffer(wiIdxBuf, wiAlignMax * sizeof(int32_t));
+        pipe->InitBuffer(targetBuf, wiAlignMax * sizeof(int32_t));
+        pipe->InitBuffer(gatherGradBuf, wiAlignMax * sizeof(float));
+        pipe->InitBuffer(gatherArgmaxBuf, wiAlignMax * sizeof(int32_t));
+        pipe->InitBuffer(diffBuf, wiAlignMax * sizeof(float));
+        pipe->InitBuffer(selBuf, wiAlignMax * sizeof(float));
+        pipe->InitBuffer(maskBuf, CeilAlignNum(wiAlignMax / MASK_BITS, BLOCK_BYTES));
+
+        uint64_t blockIdx = GetBlockIdx();
+        if (blockIdx < tilingData->blockTail) {
+            taskNum = tilingData->blockFactor + 1;
+            taskStart = blockIdx * taskNum;
+        } else {
+            taskNum = tilingData->blockFactor;
+            taskStart = blockIdx * taskNum + tilingData->blockTail;
+        }
+    }
+
+    __aicore__ inline void Process()
+    {
+        if (GetBlockIdx() >= tilingData->coreNums) {
+            return;
+        }
+        // 任务按wi段在外、行在内排列，同一wi段的gather偏移只需计算一次
+        uint64_t preWiIdx = tilingData->wiOuter;
+        for (uint64_t taskIdx = taskStart; taskIdx < taskStart + taskNum; taskIdx++) {
+            uint64_t wiIdx = taskIdx / tilingData->rowOuter;
+            uint64_t rowIdx = taskIdx % tilingData->rowOuter;
+            if (wiIdx != preWiIdx) {
+                PrepareWi(wiIdx);
+                preWiIdx = wiIdx;
+            }
+            rowStart = rowIdx * tilingData->rowFactor;
+            rowLen = (rowIdx == tilingData->rowOuter - 1) ? tilingData->rowTail : tilingData->rowFactor;
+            for (uint64_t row = 0; row < rowLen; row++) {
+                ComputeRow(row);
+            }
+            CopyOut();
+        }
+    }
+
+private:
+    static constexpr uint64_t BLOCK_BYTES = 32;
+    static constexpr uint64_t REPEAT_NUM = 64;
+    static constexpr uint64_t MASK_BITS = 8;
+    static constexpr uint64_t SENTINEL_NUM = 8;
+
+    __aicore__ inline uint64_t CeilAlignNum(uint64_t value, uint64_t align)
+    {
+        return (value + align - 1) / align * align;
+    }
+
+    // 覆盖坐标idx的输出范围[outLo, outHi)，多出的候选窗口不含idx，会被argmax比较过滤
+    __aicore__ inline bool CoverRange(uint64_t idx, uint64_t pad, uint64_t stride, uint64_t cover, uint64_t outLen,
+                                      uint64_t& outLo, uint64_t& outHi)
+    {
+        uint64_t last = (idx + pad) / stride;
+        outLo = last >= cover - 1 ? last - (cover - 1) : 0;
+        outHi = last + 1 < outLen ? last + 1 : outLen;
+        return outLo < outHi;
+    }
+
+    __aicore__ inline void PrepareWi(uint64_t wiIdx)
+    {
+        wiStart = wiIdx * tilingData->wiFactor;
+        wiLen = (wiIdx == tilingData->wiOuter - 1) ? tilingData->wiTail : tilingData->wiFactor;
+        wiAlign = CeilAlignNum(wiLen, REPEAT_NUM);
+        uint64_t sW = tilingData->sW;
+        uint64_t coverW = tilingData->coverW;
+        uint64_t firstLast = (wiStart + tilingData->pW) / sW;
+        woLo = firstLast >= coverW - 1 ? firstLast - (coverW - 1) : 0;
+        woHi = (wiStart + wiLen - 1 + tilingData->pW) / sW + 1;
+        woHi = woHi < oW ? woHi : oW;
+
+        LocalTensor<int32_t> wiIdxLocal = wiIdxBuf.Get<int32_t>();
+        CreateVecIndex(wiIdxLocal, static_cast<int32_t>(wiStart), wiAlign);
+
+        // 第j组偏移指向wo = (wi + pW) / sW - j，越界时指向段尾哨兵
+        event_t eventVS = static_cast<event_t>(GetTPipePtr()->FetchEventID(HardEvent::V_S));
+        SetFlag<HardEvent::V_S>(eventVS);
+        WaitFlag<HardEvent::V_S>(eventVS);
+        LocalTensor<uint32_t> offsetLocal = offsetBuf.Get<uint32_t>();
+        for (uint64_t j = 0; j < coverW; j++) {
+            for (uint64_t w = 0; w < wiAlign; w++) {
+                uint64_t last = (wiStart + w + tilingData->pW) / sW;
+                uint64_t pos = sentinel;
+                if (w < wiLen && last >= j && last - j >= woLo && last - j < woHi) {
+                    pos = last - j - woLo;
+                }
+                offsetLocal.SetValue(j * wiAlign + w, static_cast<uint32_t>(pos * sizeof(float)));
+            }
+        }
+        event_t eventSV = static_cast<event_t>(GetTPipePtr()->FetchEventID(HardEvent::S_V));
+        SetFlag<HardEvent::S_V>(eventSV);
+        WaitFlag<HardEvent::S_V>(eventSV);
+    }
+
+    __aicore__ inline void ComputeRow(uint64_t row)
+    {
+        uint64_t flatRow = rowStart + row;
+        uint64_t curIh = flatRow % iH;
+        uint64_t ncd = flatRow / iH;
+        uint64_t curId = ncd % iD;
+        uint64_t curNc = ncd / iD;
+
+        LocalTensor<float> accRow = accBuf.Get<float>()[row * wiAlign];
+        Duplicate<float>(accRow, 0.0f, wiAlign);
+        uint64_t odLo = 0;
+        uint64_t odHi = 0;
+        uint64_t ohLo = 0;
+        uint64_t ohHi = 0;
+        if (woLo >= woHi ||
+            !CoverRange(curId, tilingData->pD, tilingData->sD, tilingData->coverD, oD, odLo, odHi) ||
+            !CoverRange(curIh, tilingData->pH, tilingData->sH, tilingData->coverH, oH, ohLo, ohHi)) {
+            return;
+        }
+        // argmax为nc内展平的输入下标，当前行的目标下标为rowBase + wi
+        LocalTensor<int32_t> targetLocal = targetBuf.Get<int32_t>();
+        int32_t rowBase = static_cast<int32_t>((curId * iH + curIh) * iW);
+        Adds(targetLocal, wiIdxBuf.Get<int32_t>(), rowBase, wiAlign);
+        for (uint64_t od = odLo; od < odHi; od++) {
+            for (uint64_t oh = ohLo; oh < ohHi; oh++) {
+                CopyIn(((curNc * oD + od) * oH + oh) * oW + woLo);
+                Gather(accRow);
+            }
+        }
+    }
+
+    __aicore__ inline void CopyIn(uint64_t gmOffset)
+    {
+        uint32_t segLen = static_cast<uint32_t>(woHi - woLo);
+        LocalTensor<T> gradLocal = gradQue.AllocTensor<T>();
+        DataCopyExtParams gradParams{1, static_cast<uint32_t>(segLen * sizeof(T)), 0, 0, 0};
+        DataCopyPadExtParams<T> gradPadParams{false, 0, 0, 0};
+        DataCopyPad(gradLocal, gradGm[gmOffset], gradParams, gradPadParams);
+        gradQue.EnQue(gradLocal);
+
+        LocalTensor<int32_t> argmaxLocal = argmaxQue.AllocTensor<int32_t>();
+        DataCopyExtParams argmaxParams{1, static_cast<uint32_t>(segLen * sizeof(int32_t)), 0, 0, 0};
+        DataCopyPadExtParams<int32_t> argmaxPadParams{false, 0, 0, 0};
+        DataCopyPad(argmaxLocal, argmaxGm[gmOffset], argmaxParams, argmaxPadParams);
+        argmaxQue.EnQue(argmaxLocal);
+    }
+
+    __aicore__ inline void Gather(LocalTensor<float>& accRow)
+    {
+        uint32_t segLen = static_cast<uint32_t>(woHi - woLo);
+        LocalTensor<T> gradLocal = gradQue.DeQue<T>();
+        LocalTensor<int32_t> argmaxLocal = argmaxQue.DeQue<int32_t>();
+        LocalTensor<float> gradFloat = gradCastBuf.Get<float>();
+        if constexpr (IsSameType<T, float>::value) {
+            DataCopy(gradFloat, gradLocal, CeilAlignNum(segLen, SENTINEL_NUM));
+        } else {
+            Cast(gradFloat, gradLocal, RoundMode::CAST_NONE, segLen);
+        }
+        // 哨兵位置grad为0、argmax为-1，越界的候选窗口不贡献梯度
+        Duplicate<float>(gradFloat[sentinel], 0.0f, SENTINEL_NUM);
+        Duplicate<int32_t>(argmaxLocal[sentinel], -1, SENTINEL_NUM);
+
+        LocalTensor<uint32_t> offsetLocal = offsetBuf.Get<uint32_t>();
+        LocalTensor<int32_t> targetLocal = targetBuf.Get<int32_t>();
+        LocalTensor<float> gatherGrad = gatherGradBuf.Get<float>();
+        LocalTensor<int32_t> gatherArgmax = gatherArgmaxBuf.Get<int32_t>();
+        LocalTensor<float> diffLocal = diffBuf.Get<float>();
+        LocalTensor<float> selLocal = selBuf.Get<float>();
+        LocalTensor<uint8_t> maskLocal = maskBuf.Get<uint8_t>();
+        for (uint64_t j = 0; j < tilingData->coverW; j++) {
+            LocalTensor<uint32_t> offsetJ = offsetLocal[j * wiAlign];
+            AscendC::Gather(gatherGrad, gradFloat, offsetJ, 0, wiAlign);
+            AscendC::Gather(gatherArgmax, argmaxLocal, offsetJ, 0, wiAlign);
+            // argmax命中当前wi的窗口取grad，其余取0
+            Sub(gatherArgmax, gatherArgmax, targetLocal, wiAlign);
+            Cast(diffLocal, gatherArgmax, RoundMode::CAST_NONE, wiAlign);
+            CompareScalar(maskLocal, diffLocal, 0.0f, CMPMODE::EQ, wiAlign);
+            Select(selLocal, maskLocal, gatherGrad, 0.0f, SELMODE::VSEL_TENSOR_SCALAR_MODE, wiAlign);
+            Add(accRow, accRow, selLocal, wiAlign);
+        }
+        gradQue.FreeTensor(gradLocal);
+        argmaxQue.FreeTensor(argmaxLocal);
+    }
+
+    __aicore__ inline void CopyOut()
+    {
+        LocalTensor<float> accLocal = accBuf.Get<float>();
+        LocalTensor<T> yLocal = yQue.AllocTensor<T>();
+        if constexpr (IsSameType<T, float>::value) {
+            DataCopy(yLocal, accLocal, rowLen * wiAlign);
+        } else {
+            Cast(yLocal, accLocal, RoundMode::CAST_RINT, rowLen * wiAlign);
+        }
+        yQue.EnQue(yLocal);
+
+        yLocal = yQue.DeQue<T>();
+        // 连续的输入行在GM上间隔iW
+        uint64_t gmOffset = rowStart * iW + wiStart;
+        DataCopyExtParams yParams{static_cast<uint16_t>(rowLen), static_cast<uint32_t>(wiLen * sizeof(T)),
+            static_cast<uint32_t>((wiAlign * sizeof(T) - CeilAlignNum(wiLen * sizeof(T), BLOCK_BYTES)) / BLOCK_BYTES),
+            static_cast<uint32_t>((iW - wiLen) * sizeof(T)), 0};
+        DataCopyPad(yGm[gmOffset], yLocal, yParams);
+        yQue.FreeTensor(yLocal);
+    }
+
+private:
+    TPipe* pipe;
+    const MaxPool3DGradWithArgmaxGatherTilingData* __restrict tilingData;
+    GlobalTensor<T> gradGm;
+    GlobalTensor<int32_t> argmaxGm;
+    GlobalTensor<T> yGm;
+
+    TQue<QuePosition::VECIN, 1> gradQue;
+    TQue<QuePosition::VECIN, 1> argmaxQue;
+    TQue<QuePosition::VECOUT, 1> yQue;
+    TBuf<TPosition::VECCALC> accBuf;
+    TBuf<TPosition::VECCALC> gradCastBuf;
+    TBuf<TPosition::VECCALC> offsetBuf;
+    TBuf<TPosition::VECCALC> wiIdxBuf;
+    TBuf<TPosition::VECCALC> targetBuf;
+    TBuf<TPosition::VECCALC> gatherGradBuf;
+    TBuf<TPosition::VECCALC> gatherArgmaxBuf;
+    TBuf<TPosition::VECCALC> diffBuf;
+    TBuf<TPosition::VECCALC> selBuf;
+    TBuf<TPosition::VECCALC> maskBuf;
+
+    uint64_t iD;
+    uint64_t iH;
+    uint64_t iW;
+    uint64_t oD;
+    uint64_t oH;
+    uint64_t oW;
+    uint64_t wiAlignMax;
+    uint64_t sentinel;
+    uint64_t taskStart;
+    uint64_t taskNum;
+
+    uint64_t rowStart;
+    uint64_t rowLen;
+    uint64_t wiStart;
+    uint64_t wiLen;
+    uint64_t wiAlign;
+    uint64_t woLo;
+    uint64_t woHi;
+};
+
+#endif // OPP_MAX_POOL3D_GRAD_WITH_ARGMAX_GATHER_H
@@ -0,0 +1,286 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file max_pool3d_grad_with_argmax_ndhwc.h
+ * \brief NDHWC反向，argmax为窗口内偏移(kd * kH + kh) * kW + kw。
+ *        每个任务负责一段输入(n, id, ih, wi区间, c区间)，按输入位置收集覆盖它的所有窗口的梯度，
+ *        不需要原子累加和workspace，沿C向量化。
+ */
+
+#ifndef OPP_MAX_POOL3D_GRAD_WITH_ARGMAX_NDHWC_H
+#define OPP_MAX_POOL3D_GRAD_WITH_ARGMAX_NDHWC_H
+
+#include "kernel_operator.h"
+#include "kernel_tiling/kernel_tiling.h"
+
+using namespace AscendC;
+
+template <typename T>
+class KernelMaxPool3DGradWithArgmaxNdhwc {
+public:
+    __aicore__ inline KernelMaxPool3DGradWithArgmaxNdhwc(
+        const MaxPool3DGradWithArgmaxNdhwcTilingData* __restrict tilingData_) : tilingData(tilingData_) {}
+
+    __aicore__ inline void Init(GM_ADDR x, GM_ADDR grad, GM_ADDR argmax, GM_ADDR y, TPipe* pipeIn)
+    {
+        (void)x;
+        pipe = pipeIn;
+        gradGm.SetGlobalBuffer((__gm__ T*)grad);
+        argmaxGm.SetGlobalBuffer((__gm__ int32_t*)argmax);
+        yGm.SetGlobalBuffer((__gm__ T*)y);
+
+        iD = tilingData->inputShapes[0];
+        iH = tilingData->inputShapes[1];
+        iW = tilingData->inputShapes[2];
+        oD = tilingData->outShapes[0];
+        oH = tilingData->outShapes[1];
+        oW = tilingData->outShapes[2];
+        channels = tilingData->channels;
+
+        uint64_t cAlignMax = CeilAlignNum(tilingData->cFactor, REPEAT_NUM);
+        uint64_t accSize = tilingData->wiFactor * cAlignMax;
+        uint64_t inSize = tilingData->woSpan * cAlignMax;
+        pipe->InitBuffer(gradQue, 1, inSize * sizeof(T));
+        pipe->InitBuffer(argmaxQue, 1, inSize * sizeof(int32_t));
+        pipe->InitBuffer(yQue, 1, accSize * sizeof(T));
+        pipe->InitBuffer(accBuf, accSize * sizeof(float));
+        pipe->InitBuffer(argmaxCastBuf, inSize * sizeof(float));
+        if constexpr (!IsSameType<T, float>::value) {
+            pipe->InitBuffer(gradCastBuf, inSize * sizeof(float));
+        }
+        pipe->InitBuffer(selBuf, cAlignMax * sizeof(float));
+        pipe->InitBuffer(maskBuf, CeilAlignNum(cAlignMax / MASK_BITS, BLOCK_BYTES));
+
+        uint64_t blockIdx = GetBlockIdx();
+        if (blockIdx < tilingData->blockTail) {
+            taskNum = tilingData->blockFactor + 1;
+            taskStart = blockIdx * taskNum;
+        } else {
+            taskNum = tilingData->blockFactor;
+            taskStart = blockIdx * taskNum + tilingData->blockTail;
+        }
+    }
+
+    __aicore__ inline void Process()
+    {
+        if (GetBlockIdx() >= tilingData->coreNums) {
+            return;
+        }
+        for (uint64_t taskIdx = taskStart; taskIdx < taskStart + taskNum; taskIdx++) {
+            InitTask(taskIdx);
+            ComputeTask();
+            CopyOut();
+        }
+    }
+
+private:
+    static constexpr uint64_t BLOCK_BYTES = 32;
+    static constexpr uint64_t REPEAT_NUM = 64;
+    static constexpr uint64_t MASK_BITS = 8;
+
+    __aicore__ inline uint64_t CeilAlignNum(uint64_t value, uint64_t align)
+    {
+        return (value + align - 1) / align * align;
+    }
+
+    __aicore__ inline void InitTask(uint64_t taskIdx)
+    {
+        uint64_t cIdx = taskIdx % tilingData->cOuter;
+        uint64_t rest = taskIdx / tilingData->cOuter;
+        uint64_t wiIdx = rest % tilingData->wiOuter;
+        rest = rest / tilingData->wiOuter;
+        curIh = rest % iH;
+        rest = rest / iH;
+        curId = rest % iD;
+        curN = rest / iD;
+
+        cStart = cIdx * tilingData->cFactor;
+        cLen = (cIdx == tilingData->cOuter - 1) ? tilingData->cTail : tilingData->cFactor;
+        cAlign = CeilAlignNum(cLen, REPEAT_NUM);
+        wiStart = wiIdx * tilingData->wiFactor;
+        wiLen = (wiIdx == tilingData->wiOuter - 1) ? tilingData->wiTail : tilingData->wiFactor;
+    }
+
+    // 覆盖当前wi区间的wo范围[woLo, woHi)
+    __aicore__ inline bool CoverWoRange(uint64_t& woLo, uint64_t& woHi)
+    {
+        int64_t sW = static_cast<int64_t>(tilingData->sW);
+        int64_t first = static_cast<int64_t>(wiStart + tilingData->pW) -
+                        static_cast<int64_t>((tilingData->kW - 1) * tilingData->dW);
+        int64_t lo = first <= 0 ? 0 : (first + sW - 1) / sW;
+        int64_t hi = static_cast<int64_t>(wiStart + wiLen - 1 + tilingData->pW) / sW + 1;
+        hi = hi < static_cast<int64_t>(oW) ? hi : static_cast<int64_t>(oW);
+        if (lo >= hi) {
+            return false;
+        }
+        woLo = static_cast<uint64_t>(lo);
+        woHi = static_cast<uint64_t>(hi);
+        return true;
+    }
+
+    // 输入坐标idx在第k个核元素下对应的输出坐标，不能整除或越界时返回false
+    __aicore__ inline bool OutIdx(uint64_t idx, uint64_t k, uint64_t pad, uint64_t dilation, uint64_t stride,
+                                  uint64_t outLen, uint64_t& outIdx)
+    {
+        int64_t t = static_cast<int64_t>(idx + pad) - static_cast<int64_t>(k * dilation);
+        if (t < 0 || t % static_cast<int64_t>(stride) != 0) {
+            return false;
+        }
+        outIdx = static_cast<uint64_t>(t) / stride;
+        return outIdx < outLen;
+    }
+
+    __aicore__ inline void ComputeTask()
+    {
+        LocalTensor<float> accLocal = accBuf.Get<float>();
+        Duplicate<float>(accLocal, 0.0f, wiLen * cAlign);
+        uint64_t woLo = 0;
+        uint64_t woHi = 0;
+        if (!CoverWoRange(woLo, woHi)) {
+            return;
+        }
+        for (uint64_t kd = 0; kd < tilingData->kD; kd++) {
+            uint64_t od = 0;
+            if (!OutIdx(curId, kd, tilingData->pD, tilingData->dD, tilingData->sD, oD, od)) {
+                continue;
+            }
+            for (uint64_t kh = 0; kh < tilingData->kH; kh++) {
+                uint64_t oh = 0;
+                if (!OutIdx(curIh, kh, tilingData->pH, tilingData->dH, tilingData->sH, oH, oh)) {
+                    continue;
+                }
+                CopyIn(od, oh, woLo, woHi);
+                Gather(kd, kh, woLo, woHi);
+            }
+        }
+    }
+
+    __aicore__ inline void CopyIn(uint64_t od, uint64_t oh, uint64_t woLo, uint64_t woHi)
+    {
+        uint64_t gmOffset = (((curN * oD + od) * oH + oh) * oW + woLo) * channels + cStart;
+        LocalTensor<T> gradLocal = gradQue.AllocTensor<T>();
+        DataCopyExtParams gradParams{static_cast<uint16_t>(woHi - woLo), static_cast<uint32_t>(cLen * sizeof(T)),
+            static_cast<uint32_t>((channels - cLen) * sizeof(T)),
+            static_cast<uint32_t>((cAlign * sizeof(T) - CeilAlignNum(cLen * sizeof(T), BLOCK_BYTES)) / BLOCK_BYTES), 0};
+        DataCopyPadExtParams<T> gradPadParams{false, 0, 0, 0};
+        DataCopyPad(gradLocal, gradGm[gmOffset], gradParams, gradPadParams);
+        gradQue.EnQue(gradLocal);
+
+        LocalTensor<int32_t> argmaxLocal = argmaxQue.AllocTensor<int32_t>();
+        DataCopyExtParams argmaxParams{static_cast<uint16_t>(woHi - woLo),
+            static_cast<uint32_t>(cLen * sizeof(int32_t)), static_cast<uint32_t>((channels - cLen) * sizeof(int32_t)),
+            static_cast<uint32_t>((cAlign * sizeof(int32_t) - CeilAlignNum(cLen * sizeof(int32_t), BLOCK_BYTES)) /
+                                  BLOCK_BYTES), 0};
+        DataCopyPadExtParams<int32_t> argmaxPadParams{false, 0, 0, 0};
+        DataCopyPad(argmaxLocal, argmaxGm[gmOffset], argmaxParams, argmaxPadParams);
+        argmaxQue.EnQue(argmaxLocal);
+    }
+
+    __aicore__ inline void Gather(uint64_t kd, uint64_t kh, uint64_t woLo, uint64_t woHi)
+    {
+        uint64_t count = (woHi - woLo) * cAlign;
+        LocalTensor<T> gradLocal = gradQue.DeQue<T>();
+        LocalTensor<int32_t> argmaxLocal = argmaxQue.DeQue<int32_t>();
+        LocalTensor<float> gradFloat;
+        if constexpr (IsSameType<T, float>::value) {
+            gradFloat = gradLocal;
+        } else {
+            gradFloat = gradCastBuf.Get<float>();
+            Cast(gradFloat, gradLocal, RoundMode::CAST_NONE, count);
+        }
+        LocalTensor<float> argmaxFloat = argmaxCastBuf.Get<float>();
+        Cast(argmaxFloat, argmaxLocal, RoundMode::CAST_NONE, count);
+
+        LocalTensor<float> accLocal = accBuf.Get<float>();
+        LocalTensor<float> selLocal = selBuf.Get<float>();
+        LocalTensor<uint8_t> maskLocal = maskBuf.Get<uint8_t>();
+        int64_t wiBegin = static_cast<int64_t>(wiStart);
+        int64_t wiEnd = static_cast<int64_t>(wiStart + wiLen);
+        uint64_t kBase = (kd * tilingData->kH + kh) * tilingData->kW;
+        for (uint64_t wo = woLo; wo < woHi; wo++) {
+            uint64_t row = (wo - woLo) * cAlign;
+            int64_t wiFirst = static_cast<int64_t>(wo * tilingData->sW) - static_cast<int64_t>(tilingData->pW);
+            for (uint64_t kw = 0; kw < tilingData->kW; kw++) {
+                int64_t wi = wiFirst + static_cast<int64_t>(kw * tilingData->dW);
+                if (wi < wiBegin) {
+                    continue;
+                }
+                if (wi >= wiEnd) {
+                    break;
+                }
+                // argmax等于当前核偏移的通道取grad，其余取0
+                CompareScalar(maskLocal, argmaxFloat[row], static_cast<float>(kBase + kw), CMPMODE::EQ, cAlign);
+                Select(selLocal, maskLocal, gradFloat[row], 0.0f, SELMODE::VSEL_TENSOR_SCALAR_MODE, cAlign);
+                LocalTensor<float> accRow = accLocal[static_cast<uint64_t>(wi - wiBegin) * cAlign];
+                Add(accRow, accRow, selLocal, cAlign);
+            }
+        }
+        gradQue.FreeTensor(gradLocal);
+        argmaxQue.FreeTensor(argmaxLocal);
+    }
+
+    __aicore__ inline void CopyOut()
+    {
+        LocalTensor<float> accLocal = accBuf.Get<float>();
+        LocalTensor<T> yLocal = yQue.AllocTensor<T>();
+        if constexpr (IsSameType<T, float>::value) {
+            DataCopy(yLocal, accLocal, wiLen * cAlign);
+        } else {
+            Cast(yLocal, accLocal, RoundMode::CAST_RINT, wiLen * cAlign);
+        }
+        yQue.EnQue(yLocal);
+
+        yLocal = yQue.DeQue<T>();
+        uint64_t gmOffset = (((curN * iD + curId) * iH + curIh) * iW + wiStart) * channels + cStart;
+        DataCopyExtParams yParams{static_cast<uint16_t>(wiLen), static_cast<uint32_t>(cLen * sizeof(T)),
+            static_cast<uint32_t>((cAlign * sizeof(T) - CeilAlignNum(cLen * sizeof(T), BLOCK_BYTES)) / BLOCK_BYTES),
+            static_cast<uint32_t>((channels - cLen) * sizeof(T)), 0};
+        DataCopyPad(yGm[gmOffset], yLocal, yParams);
+        yQue.FreeTensor(yLocal);
+    }
+
+private:
+    TPipe* pipe;
+    const MaxPool3DGradWithArgmaxNdhwcTilingData* __restrict tilingData;
+    GlobalTensor<T> gradGm;
+    GlobalTensor<int32_t> argmaxGm;
+    GlobalTensor<T> yGm;
+
+    TQue<QuePosition::VECIN, 1> gradQue;
+    TQue<QuePosition::VECIN, 1> argmaxQue;
+    TQue<QuePosition::VECOUT, 1> yQue;
+    TBuf<TPosition::VECCALC> accBuf;
+    TBuf<TPosition::VECCALC> gradCastBuf;
+    TBuf<TPosition::VECCALC> argmaxCastBuf;
+    TBuf<TPosition::VECCALC> selBuf;
+    TBuf<TPosition::VECCALC> maskBuf;
+
+    uint64_t iD;
+    uint64_t iH;
+    uint64_t iW;
+    uint64_t oD;
+    uint64_t oH;
+    uint64_t oW;
+    uint64_t channels;
+    uint64_t taskStart;
+    uint64_t taskNum;
+
+    uint64_t curN;
+    uint64_t curId;
+    uint64_t curIh;
+    uint64_t cStart;
+    uint64_t cLen;
+    uint64_t cAlign;
+    uint64_t wiStart;
+    uint64_t wiLen;
+};
+
+#endif // OPP_MAX_POOL3D_GRAD_WITH_ARGMAX_NDHWC_H
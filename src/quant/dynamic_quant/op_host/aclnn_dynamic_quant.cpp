@@ -10,6 +10,7 @@
 
 #include "aclnn_dynamic_quant.h"
 #include "aclnn_dynamic_quant_v2.h"
+#include "aclnn_dynamic_quant_group.h"
 #include "dynamic_quant_l0.h"
 #include "dynamic_quant_v2_l0.h"
 #include "fault_injection.h"
@@ -41,6 +42,9 @@ extern "C" {
 #endif
 static constexpr int64_t INT4_NUMS_IN_INT32_SPACE = 8;
 static constexpr int64_t INT4_NUMS_IN_INT8_SPACE = 2;
+static constexpr int64_t GROUP_ALIGN_INT8 = 32;
+static constexpr int64_t GROUP_ALIGN_INT4 = 64;
+static constexpr int64_t MAX_GROUP_SIZE = 1024;
 using DtypeCheck = std::initializer_list<op::DataType>;
 
 static const std::initializer_list<DataType> EMPTY_LIST = {};
@@ -64,6 +68,8 @@ struct DynamicQuantParams {
   const aclTensor* y = nullptr;
   const aclTensor* scale = nullptr;
   const aclTensor* offset = nullptr;
+  int64_t groupSize = 0;
+  int64_t rowBlockSize = 1;
 };
 
 static inline const std::initializer_list<op::DataType>& GetDtypeSupportListBySocVersion() {
@@ -127,6 +133,42 @@ static aclnnStatus CheckInt32OutputShape(const op::Shape& shape1, const op::Shap
   return ACLNN_SUCCESS;
 }
 
+static aclnnStatus CheckGroupScaleShape(const DynamicQuantParams& dynamicQuantParams) {
+  auto xShape = dynamicQuantParams.x->GetViewShape();
+  auto xDimNum = xShape.GetDimNum();
+  int64_t groupSize = dynamicQuantParams.groupSize;
+  int64_t rowBlockSize = dynamicQuantParams.rowBlockSize;
+  int64_t groupAlign = dynamicQuantParams.y->GetDataType() == op::DataType::DT_INT8 ? GROUP_ALIGN_INT8
+                                                                                     : GROUP_ALIGN_INT4;
+  CHECK_COND(dynamicQuantParams.groupIndex == nullptr && dynamicQuantParams.offset == nullptr,
+             ACLNN_ERR_PARAM_INVALID, "group quant does not support group_index or offset.");
+  CHECK_COND(groupSize % groupAlign == 0 && groupSize <= MAX_GROUP_SIZE, ACLNN_ERR_PARAM_INVALID,
+             "groupSize(%ld) must be a multiple of %ld and not greater than %ld.", groupSize, groupAlign,
+             MAX_GROUP_SIZE);
+  CHECK_COND(rowBlockSize > 0, ACLNN_ERR_PARAM_INVALID, "rowBlockSize(%ld) must be positive.", rowBlockSize);
+  CHECK_COND(xShape.GetDim(xDimNum - 1) % groupSize == 0, ACLNN_ERR_PARAM_INVALID,
+             "x last dim(%ld) must be divisible by groupSize(%ld).", xShape.GetDim(xDimNum - 1), groupSize);
+
+  op::Shape expectShape;
+  int64_t groupNum = xShape.GetDim(xDimNum - 1) / groupSize;
+  if (rowBlockSize == 1) {
+    for (size_t i = 0; i < xDimNum - 1; i++) {
+      expectShape.AppendDim(xShape.GetDim(i));
+    }
+  } else {
+    int64_t rowNum = 1;
+    for (size_t i = 0; i < xDimNum - 1; i++) {
+      rowNum *= xShape.GetDim(i);
+    }
+    expectShape.AppendDim((rowNum + rowBlockSize - 1) / rowBlockSize);
+  }
+  expectShape.AppendDim(groupNum);
+  auto scaleShape = dynamicQuantParams.scale->GetViewShape();
+  CHECK_COND(CheckOpDim(expectShape, scaleShape, expectShape.GetDimNum(), scaleShape.GetDimNum()) == ACLNN_SUCCESS,
+             ACLNN_ERR_PARAM_INVALID, "scale shape is wrong, expect %s.", op::ToString(expectShape).GetString());
+  return ACLNN_SUCCESS;
+}
+
 static aclnnStatus CheckShape(const DynamicQuantParams& dynamicQuantParams) {
   auto xDimNum = dynamicQuantParams.x->GetViewShape().GetDimNum();
   int64_t xLastDimInput = dynamicQuantParams.x->GetViewShape().GetDim(xDimNum - 1);
@@ -168,6 +210,10 @@ static aclnnStatus CheckShape(const DynamicQuantParams& dynamicQuantParams) {
     }
   }
 
+  if (dynamicQuantParams.groupSize > 0) {
+    return CheckGroupScaleShape(dynamicQuantParams);
+  }
+
   auto scaleNum = dynamicQuantParams.scale->GetViewShape().GetDimNum();
   CHECK_COND(CheckOpDim(dynamicQuantParams.x->GetViewShape(), dynamicQuantParams.scale->GetViewShape(), xDimNum - 1,
                         scaleNum) == ACLNN_SUCCESS,
@@ -305,7 +351,8 @@ aclnnStatus GetDynamicQuantResultByL0Api(DynamicQuantParams& dynamicQuantParams,
 
   bool isSymmetrical = dynamicQuantParams.offset == nullptr ? true : false;
   if (isSymmetrical) {
-    auto dynamicQuantResult = l0op::DynamicQuant(x, smoothScales, groupIndex, yDtype, uniqueExecutor.get());
+    auto dynamicQuantResult = l0op::DynamicQuant(x, smoothScales, groupIndex, yDtype, uniqueExecutor.get(),
+                                                 dynamicQuantParams.groupSize, dynamicQuantParams.rowBlockSize);
     y = std::get<0>(dynamicQuantResult);
     outputTensor = std::get<0>(dynamicQuantResult);
     scale = std::get<1>(dynamicQuantResult);
@@ -381,6 +428,28 @@ aclnnStatus aclnnDynamicQuantV2(void* workspace, uint64_t workspaceSize, aclOpEx
   }
   return ACLNN_SUCCESS;
 }
+aclnnStatus aclnnDynamicQuantGroupGetWorkspaceSize(const aclTensor* x, const aclTensor* smoothScalesOptional,
+                                                   int64_t groupSize, int64_t rowBlockSize, int64_t dstType,
+                                                   const aclTensor* yOut, const aclTensor* scaleOut,
+                                                   uint64_t* workspaceSize, aclOpExecutor** executor) {
+  L2_DFX_PHASE_1(aclnnDynamicQuantGroup, DFX_IN(x, smoothScalesOptional, groupSize, rowBlockSize, dstType),
+                 DFX_OUT(yOut, scaleOut));
+  CHECK_COND(groupSize > 0, ACLNN_ERR_PARAM_INVALID, "groupSize(%ld) must be positive.", groupSize);
+  DynamicQuantParams dynamicQuantParams{x,       smoothScalesOptional, nullptr,  dstType,     yOut,
+                                        scaleOut, nullptr,             groupSize, rowBlockSize};
+  return GetDynamicQuantResultByL0Api(dynamicQuantParams, workspaceSize, executor);
+}
+
+aclnnStatus aclnnDynamicQuantGroup(void* workspace, uint64_t workspaceSize, aclOpExecutor* executor,
+                                   aclrtStream stream) {
+  L2_DFX_PHASE_2(aclnnDynamicQuantGroup);
+  auto ret = CommonOpExecutorRun(workspace, workspaceSize, executor, stream);
+  if (ret != ACLNN_SUCCESS) {
+    OP_LOGE(ACLNN_ERR_INNER, "This is an error in DynamicQuant launch aicore");
+    return ACLNN_ERR_INNER;
+  }
+  return ACLNN_SUCCESS;
+}
 #ifdef __cplusplus
 }
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,42 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef ACLNN_DYNAMIC_QUANT_GROUP_H_
+#define ACLNN_DYNAMIC_QUANT_GROUP_H_
+
+#include "aclnn/acl_meta.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief aclnnDynamicQuantGroupGetWorkspaceSize的第一段接口，根据具体的计算流程，计算workspace大小。
+ * 按groupSize分组对称动态量化，rowBlockSize为1时scale shape为[x.shape[:-1], K / groupSize]，
+ * rowBlockSize大于1时scale shape为[ceil(M / rowBlockSize), K / groupSize]。
+ * @domain aclnn_ops_infer
+ */
+__attribute__((visibility("default"))) aclnnStatus aclnnDynamicQuantGroupGetWorkspaceSize(
+    const aclTensor* x, const aclTensor* smoothScalesOptional, int64_t groupSize, int64_t rowBlockSize,
+    int64_t dstType, const aclTensor* yOut, const aclTensor* scaleOut, uint64_t* workspaceSize,
+    aclOpExecutor** executor);
+
+/**
+ * @brief aclnnDynamicQuantGroup的第二段接口，用于执行计算。
+ */
+__attribute__((visibility("default"))) aclnnStatus aclnnDynamicQuantGroup(void* workspace, uint64_t workspaceSize,
+                                                                            aclOpExecutor* executor,
+                                                                            aclrtStream stream);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // ACLNN_DYNAMIC_QUANT_GROUP_H_
@@ -57,6 +57,8 @@ constexpr uint32_t X_INDEX = 0;
 constexpr uint32_t SMOOTH_INDEX = 1;
 constexpr uint32_t GROUP_INDEX = 2;
 constexpr uint32_t DST_TYPE_ATTR_INDEX = 0;
+constexpr uint32_t GROUP_SIZE_ATTR_INDEX = 1;
+constexpr uint32_t ROW_BLOCK_SIZE_ATTR_INDEX = 2;
 constexpr uint32_t Y_INDEX = 0;
 constexpr uint32_t SCALE_INDEX = 1;
 constexpr uint32_t OFFSET_INDEX = 2;
@@ -94,7 +96,17 @@ constexpr int64_t TILING_KEY_DB_HALF = 3;
 constexpr int64_t TILING_KEY_LARGE_SHAPE = 6;
 constexpr int64_t TILING_KEY_MOE = 7;
 constexpr int64_t TILING_KEY_MOE_LARGE_SHAPE = 8;
+constexpr int64_t TILING_KEY_GROUP = 9;
 constexpr int64_t EVEN_FACTOR = 2;
+// group (per-block) quant
+constexpr int64_t GROUP_ALIGN_INT8 = 32;
+constexpr int64_t GROUP_ALIGN_INT4 = 64;
+constexpr int64_t MAX_GROUP_SIZE = 1024;
+constexpr uint32_t MAX_BLOCK_COL_LEN = 2040;   // 255 repeats * 8 fp32 per block
+constexpr uint32_t GROUP_UB_PER_ELEM = 11;     // x(b16) + y(int8) + 2 * fp32
+constexpr uint32_t GROUP_SMOOTH_UB_PER_ELEM = 4;
+constexpr uint32_t GROUP_UB_PER_GROUP = 40;    // max + brcb(8) + scale, fp32
+constexpr uint32_t GROUP_UB_ALIGN_RESERVED = 512;
 
 static std::map<const ge::DataType, const uint32_t> g_dTypeLen = {{ge::DT_INT32, 4}, {ge::DT_INT64, 8}};
 
@@ -127,6 +139,8 @@ class DynamicQuantTiling {
   void SetTilingData(gert::TilingContext* context, ge::DataType xDtype);
   void CalculateMaxUbSizePerRow(gert::TilingContext* context, ge::DataType xDtype);
   ge::graphStatus GetCompileInfo(gert::TilingContext* context);
+  ge::graphStatus CheckGroupShape(gert::TilingContext* context);
+  ge::graphStatus SetGroupTilingData(gert::TilingContext* context);
 
  private:
   uint32_t vectorCoreNum{0};
@@ -158,6 +172,8 @@ class DynamicQuantTiling {
   bool hasSmooth = false;
 
   int32_t yDtype;
+  int64_t groupSize = 0;
+  int64_t rowBlockSize = 1;
 };
 
 void DynamicQuantTiling::SetTilingKey(gert::TilingContext* context, ge::DataType dataType, bool useDb) {
@@ -283,7 +299,54 @@ ge::graphStatus DynamicQuantTiling::CheckOpOutputShape(gert::TilingContext* cont
   return ge::GRAPH_SUCCESS;
 }
 
+ge::graphStatus DynamicQuantTiling::CheckGroupShape(gert::TilingContext* context) {
+  OP_TILING_CHECK((context->GetComputeNodeOutputNum() != OUTPUT_NUM_DYNAMIC_QUANT || groupNum > 0),
+                  VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(),
+                                                  "group quant only supports symmetric quant without group_index."),
+                  return ge::GRAPH_FAILED);
+  int64_t groupAlign = (yDtype == ge::DT_INT4) ? GROUP_ALIGN_INT4 : GROUP_ALIGN_INT8;
+  OP_TILING_CHECK((groupSize % groupAlign != 0 || groupSize > MAX_GROUP_SIZE || rowBlockSize <= 0),
+                  VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(),
+                                                  "group_size(%ld) must be a multiple of %ld and no more than %ld, "
+                                                  "row_block_size(%ld) must be positive.",
+                                                  groupSize, groupAlign, MAX_GROUP_SIZE, rowBlockSize),
+                  return ge::GRAPH_FAILED);
+
+  auto xShape = context->GetInputShape(X_INDEX)->GetStorageShape();
+  size_t xDimNum = xShape.GetDimNum();
+  int64_t xDimLast = xShape.GetDim(xDimNum - 1);
+  OP_TILING_CHECK((xDimLast % groupSize != 0),
+                  VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(),
+                                                  "the last dim(%ld) of x must be divisible by group_size(%ld).",
+                                                  xDimLast, groupSize),
+                  return ge::GRAPH_FAILED);
+
+  auto yShape = context->GetOutputShape(Y_INDEX);
+  OPS_CHECK_NULL_WITH_CONTEXT(context, yShape);
+  OP_TILING_CHECK((CheckOpDim(context->GetInputShape(X_INDEX), yShape, xDimNum,
+                              yShape->GetStorageShape().GetDimNum()) != ge::GRAPH_SUCCESS),
+                  VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(), "x and y shape is inconsistency."),
+                  return ge::GRAPH_FAILED);
+
+  auto scaleShape = context->GetOutputShape(SCALE_INDEX);
+  OPS_CHECK_NULL_WITH_CONTEXT(context, scaleShape);
+  int64_t rows = xShape.GetShapeSize() / xDimLast;
+  int64_t expectScaleSize = (rows + rowBlockSize - 1) / rowBlockSize * (xDimLast / groupSize);
+  OP_TILING_CHECK((scaleShape->GetStorageShape().GetShapeSize() != expectScaleSize),
+                  VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(),
+                                                  "scale size must be ceil(M / row_block_size) * K / group_size(%ld).",
+                                                  expectScaleSize),
+                  return ge::GRAPH_FAILED);
+  return ge::GRAPH_SUCCESS;
+}
+
 ge::graphStatus DynamicQuantTiling::CheckOpShape(gert::TilingContext* context) {
+  if (groupSize > 0) {
+    OP_TILING_CHECK((CheckOpInpuShape(context) != ge::GRAPH_SUCCESS),
+                    VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(), "input shape check failed!"),
+                    return ge::GRAPH_FAILED);
+    return CheckGroupShape(context);
+  }
   OP_TILING_CHECK((CheckOpInpuShape(context) != ge::GRAPH_SUCCESS),
                   VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(), "input shape check failed!"),
                   return ge::GRAPH_FAILED);
@@ -367,6 +430,11 @@ ge::graphStatus DynamicQuantTiling::CheckAttrs(gert::TilingContext* context) {
       OP_LOGE(context->GetNodeName(), "dst type:%d not equal output dtype:%d", dstType, yDtype);
       return ge::GRAPH_FAILED;
     }
+    // DynamicQuantV2 has no group attrs, the pointers are null there
+    const int64_t* groupSizePtr = attrs->GetAttrPointer<int64_t>(GROUP_SIZE_ATTR_INDEX);
+    const int64_t* rowBlockSizePtr = attrs->GetAttrPointer<int64_t>(ROW_BLOCK_SIZE_ATTR_INDEX);
+    groupSize = (groupSizePtr == nullptr) ? 0 : *groupSizePtr;
+    rowBlockSize = (rowBlockSizePtr == nullptr) ? 1 : *rowBlockSizePtr;
   }
   return ge::GRAPH_SUCCESS;
 }
@@ -396,6 +464,69 @@ void DynamicQuantTiling::ResetLargeTilingParams() {
   innerLoopTail = 0;
   groupNum = 0;
   hasSmooth = false;
+  groupSize = 0;
+  rowBlockSize = 1;
+}
+
+/**
+ * Tiling of group quant. A task unit is one row (1 x group_size blocks) or one row block
+ * (row_block_size x group_size blocks). Each UB tile is [tileRows, colLen] with colLen a multiple of group_size.
+ */
+ge::graphStatus DynamicQuantTiling::SetGroupTilingData(gert::TilingContext* context) {
+  uint32_t group = static_cast<uint32_t>(groupSize);
+  uint32_t rowBlock = static_cast<uint32_t>(rowBlockSize);
+  uint32_t unitNum = (rowNum + rowBlock - 1) / rowBlock;
+  coreNum = std::max(std::min(vectorCoreNum, unitNum), ONE);
+  headCoreNum = unitNum % coreNum;
+  rowPerHeadCore = (unitNum + coreNum - 1) / coreNum;
+  rowPerTailCore = unitNum / coreNum;
+
+  uint64_t ubAvail = ubSize - RESERVED_LENGTH - GROUP_UB_ALIGN_RESERVED;
+  uint64_t perElem = GROUP_UB_PER_ELEM + (hasSmooth ? GROUP_SMOOTH_UB_PER_ELEM : 0);
+  uint32_t multiRow = 1;
+  if (rowBlock == 1) {
+    uint64_t rowBytes = rowLen * perElem + rowLen / group * GROUP_UB_PER_GROUP;
+    if (rowBytes <= ubAvail) {
+      multiRow = static_cast<uint32_t>(std::min(static_cast<uint64_t>(COMPARE_INT), ubAvail / rowBytes));
+    } else {
+      uint64_t groupFit = ubAvail / (group * perElem + GROUP_UB_PER_GROUP);
+      innerLoopEle = static_cast<uint32_t>(groupFit) * group;
+      OP_TILING_CHECK((innerLoopEle < group),
+                      VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(), "group_size(%u) exceeds ub.", group),
+                      return ge::GRAPH_FAILED);
+    }
+  } else {
+    uint64_t groupFit = ubAvail / (static_cast<uint64_t>(rowBlock) * group * perElem + GROUP_UB_PER_GROUP);
+    uint32_t colMax = std::min(rowLen, MAX_BLOCK_COL_LEN / group * group);
+    innerLoopEle = static_cast<uint32_t>(std::min(static_cast<uint64_t>(colMax), groupFit * group));
+    OP_TILING_CHECK((innerLoopEle < group),
+                    VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(),
+                                                    "row_block_size(%u) x group_size(%u) block exceeds ub.",
+                                                    rowBlock, group),
+                    return ge::GRAPH_FAILED);
+  }
+  if (innerLoopEle > 0) {
+    innerLoopTimes = rowLen / innerLoopEle;
+    innerLoopTail = rowLen % innerLoopEle;
+  }
+
+  context->SetTilingKey(TILING_KEY_GROUP);
+  tilingData.set_coreNum(coreNum);
+  tilingData.set_rowLen(rowLen);
+  tilingData.set_headCoreNum(headCoreNum);
+  tilingData.set_rowPerHeadCore(rowPerHeadCore);
+  tilingData.set_rowPerTailCore(rowPerTailCore);
+  tilingData.set_multiRowNumHeadCore(std::min(multiRow, std::max(rowPerHeadCore, ONE)));
+  tilingData.set_multiRowNumTailCore(std::min(multiRow, std::max(rowPerTailCore, ONE)));
+  tilingData.set_innerLoopEle(innerLoopEle);
+  tilingData.set_innerLoopTimes(innerLoopTimes);
+  tilingData.set_innerLoopTail(innerLoopTail);
+  tilingData.set_groupNum(0);
+  tilingData.set_hasSmooth(hasSmooth ? 1 : 0);
+  tilingData.set_groupSize(group);
+  tilingData.set_rowBlockSize(rowBlock);
+  tilingData.set_totalRowNum(rowNum);
+  return ge::GRAPH_SUCCESS;
 }
 
 void DynamicQuantTiling::SetTilingData(gert::TilingContext* context, ge::DataType xDtype) {
@@ -433,6 +564,9 @@ void DynamicQuantTiling::SetTilingData(gert::TilingContext* context, ge::DataTyp
   tilingData.set_innerLoopTail(innerLoopTail);
   tilingData.set_groupNum(groupNum);
   tilingData.set_hasSmooth(hasSmooth ? 1 : 0);
+  tilingData.set_groupSize(0);
+  tilingData.set_rowBlockSize(1);
+  tilingData.set_totalRowNum(rowNum);
 }
 
 /**
@@ -501,6 +635,17 @@ ge::graphStatus DynamicQuantTiling::RunFusionKernelTiling(gert::TilingContext* c
     tempHeadCoreNum *= xShape->GetStorageShape().GetDim(i);
   }
   rowNum = tempHeadCoreNum;
+  if (groupSize > 0) {
+    OP_TILING_CHECK((SetGroupTilingData(context) != ge::GRAPH_SUCCESS),
+                    VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(), "SetGroupTilingData failed."),
+                    return ge::GRAPH_FAILED);
+    size_t* groupWorkSpaces = context->GetWorkspaceSizes(1);
+    groupWorkSpaces[0] = SYS_WORKSPACE_SIZE;
+    tilingData.SaveToBuffer(context->GetRawTilingData()->GetData(), context->GetRawTilingData()->GetCapacity());
+    context->GetRawTilingData()->SetDataSize(tilingData.GetDataSize());
+    context->SetBlockDim(coreNum);
+    return ge::GRAPH_SUCCESS;
+  }
   // For 910B
   rowNumPerMinTask = 1;
   scaleNumPerMinTask = 1;
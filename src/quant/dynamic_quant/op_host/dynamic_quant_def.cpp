@@ -47,6 +47,8 @@ class DynamicQuant : public OpDef {
         .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND})
         .UnknownShapeFormat({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND});
     this->Attr("dst_type").AttrType(OPTIONAL).Int(ge::DT_INT8);
+    this->Attr("group_size").AttrType(OPTIONAL).Int(0);
+    this->Attr("row_block_size").AttrType(OPTIONAL).Int(1);
     this->AICore().AddConfig("ascend910b");
   }
 };
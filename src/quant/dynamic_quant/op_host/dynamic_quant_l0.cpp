@@ -28,16 +28,35 @@ static op::Shape GetOutPutShape(const aclTensor* x) {
   return outputShape;
 }
 
+static op::Shape GetGroupOutPutShape(const aclTensor* x, int64_t groupSize, int64_t rowBlockSize) {
+  op::Shape outputShape;
+  size_t dimNum = x->GetViewShape().GetDimNum();
+  int64_t groupNum = (x->GetViewShape().GetDim(dimNum - 1) + groupSize - 1) / groupSize;
+  if (rowBlockSize == 1) {
+    outputShape = GetOutPutShape(x);
+    outputShape.AppendDim(groupNum);
+    return outputShape;
+  }
+  int64_t rowNum = 1;
+  for (size_t i = 0; i < dimNum - 1; i++) {
+    rowNum *= x->GetViewShape().GetDim(i);
+  }
+  outputShape.AppendDim((rowNum + rowBlockSize - 1) / rowBlockSize);
+  outputShape.AppendDim(groupNum);
+  return outputShape;
+}
+
 std::tuple<aclTensor*, aclTensor*> DynamicQuant(const aclTensor* x, const aclTensor* smoothScalesOptional,
-                                                const aclTensor* groupIndexsOptional, int32_t dstType, aclOpExecutor* executor) {
+                                                const aclTensor* groupIndexsOptional, int32_t dstType, aclOpExecutor* executor,
+                                                int64_t groupSize, int64_t rowBlockSize) {
   L0_DFX(DynamicQuant, x, smoothScalesOptional, groupIndexsOptional);
   auto yOut = executor->AllocTensor(x->GetStorageShape(), x->GetViewShape(), op::DataType(dstType),
                                     x->GetStorageFormat(), x->GetOriginalFormat());
 
-  auto scaleShape = GetOutPutShape(x);
+  auto scaleShape = groupSize > 0 ? GetGroupOutPutShape(x, groupSize, rowBlockSize) : GetOutPutShape(x);
   auto scaleOut = executor->AllocTensor(scaleShape, op::DataType::DT_FLOAT);
   auto ret = ADD_TO_LAUNCHER_LIST_AICORE(DynamicQuant, OP_INPUT(x, smoothScalesOptional, groupIndexsOptional),
-                                         OP_OUTPUT(yOut, scaleOut), OP_ATTR(dstType));
+                                         OP_OUTPUT(yOut, scaleOut), OP_ATTR(dstType, groupSize, rowBlockSize));
   if (ret != ACLNN_SUCCESS) {
     OP_LOGE(ACLNN_ERR_PARAM_INVALID, "DynamicQuant launch kernel failed.");
     return std::tuple<aclTensor*, aclTensor*>(nullptr, nullptr);
@@ -15,7 +15,8 @@
 
 namespace l0op {
 std::tuple<aclTensor*, aclTensor*> DynamicQuant(const aclTensor* x, const aclTensor* smoothScalesOptional,
-                              const aclTensor* groupIndexsOptional, int32_t dstType, aclOpExecutor* executor);
+                              const aclTensor* groupIndexsOptional, int32_t dstType, aclOpExecutor* executor,
+                              int64_t groupSize = 0, int64_t rowBlockSize = 1);
 }
 
 #endif
\ No newline at end of file
@@ -32,6 +32,8 @@
 using namespace ge;
 namespace ops {
 static const size_t ATTR_INDEX_OF_DST_TYPE = 0;
+static const size_t ATTR_INDEX_OF_GROUP_SIZE = 1;
+static const size_t ATTR_INDEX_OF_ROW_BLOCK_SIZE = 2;
 static const int32_t DTYPE_INT8 = 2;
 static const int32_t DTYPE_INT4 = 29;
 static constexpr uint32_t OUTPUT_NUM_DYNAMIC_QUANT = 2;
@@ -67,10 +69,46 @@ static ge::graphStatus DynamicQuantInferShape(gert::InferShapeContext* context)
   gert::Shape* yShape = context->GetOutputShape(0);
   gert::Shape* scaleShape = context->GetOutputShape(1);
   *yShape = *xShape;
-  scaleShape->SetDimNum(xShape->GetDimNum() - 1);
-  for (uint32_t i = 0; i < xShape->GetDimNum() - 1; ++i) {
-    scaleShape->SetDim(i, xShape->GetDim(i));
+
+  int64_t groupSize = 0;
+  int64_t rowBlockSize = 1;
+  auto* attrs = context->GetAttrs();
+  if (attrs != nullptr) {
+    const int64_t* pGroupSize = attrs->GetAttrPointer<int64_t>(ATTR_INDEX_OF_GROUP_SIZE);
+    const int64_t* pRowBlockSize = attrs->GetAttrPointer<int64_t>(ATTR_INDEX_OF_ROW_BLOCK_SIZE);
+    groupSize = (pGroupSize == nullptr) ? 0 : *pGroupSize;
+    rowBlockSize = (pRowBlockSize == nullptr) ? 1 : *pRowBlockSize;
+  }
+  size_t xDimNum = xShape->GetDimNum();
+  if (groupSize <= 0) {
+    // per token: scale is x shape without the last dim
+    scaleShape->SetDimNum(xDimNum - 1);
+    for (uint32_t i = 0; i < xDimNum - 1; ++i) {
+      scaleShape->SetDim(i, xShape->GetDim(i));
+    }
+    return GRAPH_SUCCESS;
+  }
+  OP_CHECK(rowBlockSize <= 0,
+           VECTOR_INFER_SHAPE_INNER_ERR_REPORT("DynamicQuant", "attr row_block_size must be positive"),
+           return ge::GRAPH_FAILED);
+  int64_t groupNum = (xShape->GetDim(xDimNum - 1) + groupSize - 1) / groupSize;
+  if (rowBlockSize == 1) {
+    // 1 x group_size blocks: [..., K / group_size]
+    scaleShape->SetDimNum(xDimNum);
+    for (uint32_t i = 0; i < xDimNum - 1; ++i) {
+      scaleShape->SetDim(i, xShape->GetDim(i));
+    }
+    scaleShape->SetDim(xDimNum - 1, groupNum);
+    return GRAPH_SUCCESS;
+  }
+  // row_block_size x group_size blocks: [ceil(M / row_block_size), K / group_size]
+  int64_t rowNum = 1;
+  for (uint32_t i = 0; i < xDimNum - 1; ++i) {
+    rowNum *= xShape->GetDim(i);
   }
+  scaleShape->SetDimNum(2);
+  scaleShape->SetDim(0, (rowNum + rowBlockSize - 1) / rowBlockSize);
+  scaleShape->SetDim(1, groupNum);
   return GRAPH_SUCCESS;
 }
 
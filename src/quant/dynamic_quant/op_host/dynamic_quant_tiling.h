@@ -33,6 +33,10 @@ TILING_DATA_FIELD_DEF(uint32_t, groupNum);
 TILING_DATA_FIELD_DEF(uint32_t, alignGroupNum);
 TILING_DATA_FIELD_DEF(uint32_t, hasSmooth);
 TILING_DATA_FIELD_DEF(uint32_t, unused);
+TILING_DATA_FIELD_DEF(uint32_t, groupSize);
+TILING_DATA_FIELD_DEF(uint32_t, rowBlockSize);
+TILING_DATA_FIELD_DEF(uint32_t, totalRowNum);
+TILING_DATA_FIELD_DEF(uint32_t, unused1);
 END_TILING_DATA_DEF;
 
 REGISTER_TILING_DATA_CLASS(DynamicQuant, DynamicQuantTilingData)
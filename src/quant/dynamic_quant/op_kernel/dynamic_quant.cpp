@@ -15,6 +15,7 @@
 #include "kernel_operator.h"
 #include "dynamic_quant.h"
 #include "dynamic_quant_db.h"
+#include "dynamic_quant_group.h"
 #include "dynamic_quant_large_shape_opt.h"
 #include "dynamic_quant_moe.h"
 #include "dynamic_quant_moe_large_shape.h"
@@ -58,6 +59,10 @@ extern "C" __global__ __aicore__ void dynamic_quant(GM_ADDR x, GM_ADDR smooth_sc
     DynamicQuantMoeLargeShape<DTYPE_X, DTYPE_X, int32_t, DTYPE_Y> op(&pipe);
     op.Init(x, smooth_scales, group_index, y, scale, nullptr, workSpace, &tilingData);
     op.Process();
+  } else if (TILING_KEY_IS(9)) {
+    DynamicQuantGroup<DTYPE_X, DTYPE_Y> op(&pipe);
+    op.Init(x, smooth_scales, y, scale, nullptr, workSpace, &tilingData);
+    op.Process();
   } else {
   }
 }
\ No newline at end of file
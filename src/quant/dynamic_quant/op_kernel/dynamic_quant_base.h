@@ -63,6 +63,9 @@ class DynamicQuantBase {
     tilingData_.alignGroupNum = tilingData->alignGroupNum;
     tilingData_.groupNum = tilingData->groupNum;
     tilingData_.hasSmooth = tilingData->hasSmooth;
+    tilingData_.groupSize = tilingData->groupSize;
+    tilingData_.rowBlockSize = tilingData->rowBlockSize;
+    tilingData_.totalRowNum = tilingData->totalRowNum;
   }
 
   __aicore__ inline void InitBaseBuffer() {
@@ -0,0 +1,346 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file dynamic_quant_group.h
+ * \brief group (per-block) symmetric dynamic quant.
+ *        rowBlockSize == 1: one scale per 1 x groupSize block, scale shape [M, K / groupSize].
+ *        rowBlockSize > 1 : one scale per rowBlockSize x groupSize block, scale shape [ceil(M / rowBlockSize), K / groupSize].
+ */
+#ifndef DYNAMIC_QUANT_GROUP_H
+#define DYNAMIC_QUANT_GROUP_H
+
+#include "dynamic_quant_base.h"
+
+namespace DynamicQuantNDOpt {
+using namespace AscendC;
+
+constexpr uint32_t GROUP_MAX_REPEAT = 255;
+constexpr uint32_t GROUP_BRCB_MAX_NUM = GROUP_MAX_REPEAT * EIGHT;
+
+template <typename xDtype, typename yDtype>
+class DynamicQuantGroup : public DynamicQuantBase {
+ public:
+  __aicore__ inline DynamicQuantGroup(TPipe* pipe) {
+    pPipe = pipe;
+  }
+
+  __aicore__ inline void Init(GM_ADDR x, GM_ADDR smooth_scales, GM_ADDR y, GM_ADDR scale, GM_ADDR offset,
+                              GM_ADDR workSpace, const DynamicQuantTilingData* __restrict tilingData) {
+    ParseTilingData(tilingData);
+    blockIdx = GetBlockIdx();
+    rowLen = tilingData_.rowLen;
+    groupSize = tilingData_.groupSize;
+    rowBlockSize = tilingData_.rowBlockSize;
+    groupPerRow = rowLen / groupSize;
+    if (blockIdx < tilingData_.headCoreNum) {
+      unitNum = tilingData_.rowPerHeadCore;
+      unitStart = blockIdx * tilingData_.rowPerHeadCore;
+      multiRowNum = tilingData_.multiRowNumHeadCore;
+    } else {
+      unitNum = tilingData_.rowPerTailCore;
+      unitStart = tilingData_.headCoreNum * tilingData_.rowPerHeadCore +
+                  (blockIdx - tilingData_.headCoreNum) * tilingData_.rowPerTailCore;
+      multiRowNum = tilingData_.multiRowNumTailCore;
+    }
+
+    uint32_t tileRows = 1;
+    uint32_t tileCols = rowLen;
+    if (rowBlockSize > 1) {
+      tileRows = rowBlockSize;
+      tileCols = tilingData_.innerLoopEle;
+    } else if (tilingData_.innerLoopTimes > 0) {
+      tileCols = tilingData_.innerLoopEle;
+    } else {
+      tileRows = multiRowNum;
+    }
+    uint32_t maxElems = tileRows * tileCols;
+    uint32_t maxGroupsAlign = (maxElems / groupSize + SEVEN) / EIGHT * EIGHT;
+    quantMax = (ORIG_DTYPE_Y == DT_INT4) ? DYNAMIC_QUANT_INT4_SYM_SCALE : DYNAMIC_QUANT_INT8_SYM_SCALE;
+
+    inGm.SetGlobalBuffer((__gm__ xDtype*)x);
+    outGm.SetGlobalBuffer((__gm__ yDtype*)y);
+    scaleGm.SetGlobalBuffer((__gm__ float*)scale);
+    if (tilingData_.hasSmooth) {
+      smoothGm.SetGlobalBuffer((__gm__ xDtype*)smooth_scales, rowLen);
+      pPipe->InitBuffer(smoothBuf, tileCols * sizeof(float));
+    }
+    pPipe->InitBuffer(inQueue, BUFFER_NUM, maxElems * sizeof(xDtype));
+    pPipe->InitBuffer(outQueue, BUFFER_NUM, maxElems * sizeof(int8_t));
+    pPipe->InitBuffer(scaleQueue, BUFFER_NUM, maxGroupsAlign * sizeof(float));
+    pPipe->InitBuffer(dataBuf, maxElems * sizeof(float));
+    pPipe->InitBuffer(tmpBuf, maxElems * sizeof(float));
+    pPipe->InitBuffer(maxBuf, maxGroupsAlign * sizeof(float));
+    pPipe->InitBuffer(brcbBuf, maxGroupsAlign * EIGHT * sizeof(float));
+  }
+
+  __aicore__ inline void Process() {
+    if (rowBlockSize > 1) {
+      ProcessRowBlocks();
+    } else if (tilingData_.innerLoopTimes > 0) {
+      ProcessSplitCol();
+    } else {
+      if (tilingData_.hasSmooth) {
+        LoadSmooth(0, rowLen);
+      }
+      for (uint32_t i = 0; i < unitNum; i += multiRowNum) {
+        uint32_t rows = (unitNum - i) > multiRowNum ? multiRowNum : (unitNum - i);
+        uint32_t rowStart = unitStart + i;
+        ProcessTile(rowStart, rows, 0, rowLen, rowStart * groupPerRow, false);
+      }
+    }
+  }
+
+ private:
+  __aicore__ inline void ProcessSplitCol() {
+    for (uint32_t i = 0; i < unitNum; i++) {
+      uint32_t row = unitStart + i;
+      ProcessRowCols(row, 1, row * groupPerRow, false);
+    }
+  }
+
+  __aicore__ inline void ProcessRowBlocks() {
+    for (uint32_t i = 0; i < unitNum; i++) {
+      uint32_t blockId = unitStart + i;
+      uint32_t rowStart = blockId * rowBlockSize;
+      uint32_t rows = (tilingData_.totalRowNum - rowStart) > rowBlockSize ? rowBlockSize
+                                                                         : (tilingData_.totalRowNum - rowStart);
+      ProcessRowCols(rowStart, rows, blockId * groupPerRow, true);
+    }
+  }
+
+  __aicore__ inline void ProcessRowCols(uint32_t rowStart, uint32_t rows, uint32_t scaleStart, bool isRowBlock) {
+    uint32_t colStart = 0;
+    for (uint32_t j = 0; j < tilingData_.innerLoopTimes; j++) {
+      if (tilingData_.hasSmooth) {
+        LoadSmooth(colStart, tilingData_.innerLoopEle);
+      }
+      ProcessTile(rowStart, rows, colStart, tilingData_.innerLoopEle, scaleStart + colStart / groupSize, isRowBlock);
+      colStart += tilingData_.innerLoopEle;
+    }
+    if (tilingData_.innerLoopTail > 0) {
+      if (tilingData_.hasSmooth) {
+        LoadSmooth(colStart, tilingData_.innerLoopTail);
+      }
+      ProcessTile(rowStart, rows, colStart, tilingData_.innerLoopTail, scaleStart + colStart / groupSize, isRowBlock);
+    }
+  }
+
+  __aicore__ inline void LoadSmooth(uint32_t colStart, uint32_t cols) {
+    if (smoothLoadedCol == colStart && smoothLoadedLen == cols) {
+      return;
+    }
+    LocalTensor<float> smoothLocal = smoothBuf.Get<float>();
+    LocalTensor<xDtype> stage = tmpBuf.Get<xDtype>();
+    event_t eventVMte2 = static_cast<event_t>(GetTPipePtr()->FetchEventID(HardEvent::V_MTE2));
+    SetFlag<HardEvent::V_MTE2>(eventVMte2);
+    WaitFlag<HardEvent::V_MTE2>(eventVMte2);
+    DataCopyExtParams copyParams{1, static_cast<uint32_t>(cols * sizeof(xDtype)), 0, 0, 0};
+    DataCopyPadExtParams<xDtype> padParams{false, 0, 0, 0};
+    DataCopyPad(stage, smoothGm[colStart], copyParams, padParams);
+    event_t eventMte2V = static_cast<event_t>(GetTPipePtr()->FetchEventID(HardEvent::MTE2_V));
+    SetFlag<HardEvent::MTE2_V>(eventMte2V);
+    WaitFlag<HardEvent::MTE2_V>(eventMte2V);
+    Cast(smoothLocal, stage, RoundMode::CAST_NONE, cols);
+    PipeBarrier<PIPE_V>();
+    smoothLoadedCol = colStart;
+    smoothLoadedLen = cols;
+  }
+
+  __aicore__ inline void ProcessTile(uint32_t rowStart, uint32_t rows, uint32_t colStart, uint32_t cols,
+                                     uint32_t scaleStart, bool isRowBlock) {
+    CopyIn(rowStart, rows, colStart, cols);
+    Compute(rows, cols, isRowBlock);
+    CopyOut(rowStart, rows, colStart, cols, scaleStart, isRowBlock ? cols / groupSize : rows * cols / groupSize);
+  }
+
+  __aicore__ inline void CopyIn(uint32_t rowStart, uint32_t rows, uint32_t colStart, uint32_t cols) {
+    LocalTensor<xDtype> inLocal = inQueue.AllocTensor<xDtype>();
+    DataCopyExtParams copyParams{static_cast<uint16_t>(rows), static_cast<uint32_t>(cols * sizeof(xDtype)),
+                                 static_cast<uint32_t>((rowLen - cols) * sizeof(xDtype)), 0, 0};
+    DataCopyPadExtParams<xDtype> padParams{false, 0, 0, 0};
+    DataCopyPad(inLocal, inGm[static_cast<uint64_t>(rowStart) * rowLen + colStart], copyParams, padParams);
+    inQueue.EnQue(inLocal);
+  }
+
+  __aicore__ inline void Compute(uint32_t rows, uint32_t cols, bool isRowBlock) {
+    uint32_t count = rows * cols;
+    LocalTensor<float> dataLocal = dataBuf.Get<float>();
+    LocalTensor<float> tmpLocal = tmpBuf.Get<float>();
+    LocalTensor<float> maxLocal = maxBuf.Get<float>();
+    LocalTensor<xDtype> inLocal = inQueue.DeQue<xDtype>();
+    Cast(dataLocal, inLocal, RoundMode::CAST_NONE, count);
+    PipeBarrier<PIPE_V>();
+    inQueue.FreeTensor(inLocal);
+    if (tilingData_.hasSmooth) {
+      RowBroadcastMul(dataLocal, smoothBuf.Get<float>(), rows, cols);
+    }
+
+    Abs(tmpLocal, dataLocal, count);
+    PipeBarrier<PIPE_V>();
+    uint32_t groups = count / groupSize;
+    if (isRowBlock) {
+      // fold the rows of the block: tmp[0, :] <- max over rows
+      uint32_t remain = rows;
+      while (remain > 1) {
+        uint32_t half = remain / 2;
+        Max(tmpLocal, tmpLocal, tmpLocal[(remain - half) * cols], half * cols);
+        PipeBarrier<PIPE_V>();
+        remain -= half;
+      }
+      groups = cols / groupSize;
+    }
+    ReduceMaxGroups(maxLocal, tmpLocal, groups);
+
+    // scale = max / quantMax, data * (quantMax / max)
+    LocalTensor<float> scaleLocal = scaleQueue.AllocTensor<float>();
+    Muls(scaleLocal, maxLocal, 1.0f / quantMax, groups);
+    Duplicate(tmpLocal, quantMax, groups);
+    PipeBarrier<PIPE_V>();
+    Div(maxLocal, tmpLocal, maxLocal, groups);
+    PipeBarrier<PIPE_V>();
+    scaleQueue.EnQue(scaleLocal);
+
+    if (isRowBlock) {
+      Duplicate(tmpLocal, 1.0f, cols);
+      PipeBarrier<PIPE_V>();
+      GroupScalarMul(tmpLocal, maxLocal, groups);
+      RowBroadcastMul(dataLocal, tmpLocal, rows, cols);
+    } else {
+      GroupScalarMul(dataLocal, maxLocal, groups);
+    }
+
+    LocalTensor<yDtype> outLocal = outQueue.AllocTensor<yDtype>();
+    LocalTensor<int32_t> dataInt32 = dataBuf.Get<int32_t>();
+    LocalTensor<half> dataHalf = dataBuf.Get<half>();
+    Cast(dataInt32, dataLocal, RoundMode::CAST_RINT, count);
+    PipeBarrier<PIPE_V>();
+    SetDeqScale(static_cast<half>(1.0));
+    PipeBarrier<PIPE_V>();
+    Cast(dataHalf, dataInt32, RoundMode::CAST_ROUND, count);
+    PipeBarrier<PIPE_V>();
+    Cast(outLocal, dataHalf, RoundMode::CAST_TRUNC, count);
+    outQueue.EnQue<yDtype>(outLocal);
+  }
+
+  __aicore__ inline void CopyOut(uint32_t rowStart, uint32_t rows, uint32_t colStart, uint32_t cols,
+                                 uint32_t scaleStart, uint32_t groups) {
+    LocalTensor<yDtype> outLocal = outQueue.DeQue<yDtype>();
+    uint32_t colBytes = cols * sizeof(int8_t);
+    uint32_t gapBytes = (rowLen - cols) * sizeof(int8_t);
+    if constexpr (IsSameType<yDtype, int4b_t>::value) {
+      colBytes = colBytes >> 1;
+      gapBytes = gapBytes >> 1;
+    }
+    DataCopyExtParams copyParams{static_cast<uint16_t>(rows), colBytes, 0, gapBytes, 0};
+    DataCopyPad(outGm[static_cast<uint64_t>(rowStart) * rowLen + colStart], outLocal, copyParams);
+    outQueue.FreeTensor(outLocal);
+
+    LocalTensor<float> scaleLocal = scaleQueue.DeQue<float>();
+    DataCopyExtParams scaleParams{1, static_cast<uint32_t>(groups * sizeof(float)), 0, 0, 0};
+    DataCopyPad(scaleGm[scaleStart], scaleLocal, scaleParams);
+    scaleQueue.FreeTensor(scaleLocal);
+  }
+
+  /*
+   * dst[i] = max(src[i * groupSize : (i + 1) * groupSize]), src is folded in place.
+   */
+  __aicore__ inline void ReduceMaxGroups(const LocalTensor<float>& dst, const LocalTensor<float>& src,
+                                         uint32_t groups) {
+    uint8_t repStride = groupSize / EIGHT;
+    uint64_t headMask = groupSize > ELEM_PER_REP_FP32 ? ELEM_PER_REP_FP32 : groupSize;
+    for (uint32_t i = 0; i < groups; i += GROUP_MAX_REPEAT) {
+      uint8_t repeat = (groups - i) > GROUP_MAX_REPEAT ? GROUP_MAX_REPEAT : (groups - i);
+      uint32_t offset = i * groupSize;
+      for (uint32_t c = ELEM_PER_REP_FP32; c < groupSize; c += ELEM_PER_REP_FP32) {
+        uint64_t mask = (groupSize - c) > ELEM_PER_REP_FP32 ? ELEM_PER_REP_FP32 : (groupSize - c);
+        Max(src[offset], src[offset + c], src[offset], mask, repeat,
+            {1, 1, 1, repStride, repStride, repStride});
+        PipeBarrier<PIPE_V>();
+      }
+      WholeReduceMax(dst[i], src[offset], headMask, repeat, 1, 1, repStride, ReduceOrder::ORDER_ONLY_VALUE);
+    }
+    PipeBarrier<PIPE_V>();
+  }
+
+  /*
+   * data[i * groupSize + j] *= factor[i], the factor is spread to one block by Brcb and read with block stride 0.
+   */
+  __aicore__ inline void GroupScalarMul(const LocalTensor<float>& data, const LocalTensor<float>& factor,
+                                        uint32_t groups) {
+    LocalTensor<float> brcbLocal = brcbBuf.Get<float>();
+    for (uint32_t i = 0; i < groups; i += GROUP_BRCB_MAX_NUM) {
+      uint32_t num = (groups - i) > GROUP_BRCB_MAX_NUM ? GROUP_BRCB_MAX_NUM : (groups - i);
+      Brcb(brcbLocal[i * EIGHT], factor[i], (num + SEVEN) / EIGHT, {1, EIGHT});
+    }
+    PipeBarrier<PIPE_V>();
+    uint8_t repStride = groupSize / EIGHT;
+    for (uint32_t i = 0; i < groups; i += GROUP_MAX_REPEAT) {
+      uint8_t repeat = (groups - i) > GROUP_MAX_REPEAT ? GROUP_MAX_REPEAT : (groups - i);
+      for (uint32_t c = 0; c < groupSize; c += ELEM_PER_REP_FP32) {
+        uint64_t mask = (groupSize - c) > ELEM_PER_REP_FP32 ? ELEM_PER_REP_FP32 : (groupSize - c);
+        uint32_t offset = i * groupSize + c;
+        Mul(data[offset], data[offset], brcbLocal[i * EIGHT], mask, repeat, {1, 1, 0, repStride, repStride, 1});
+      }
+    }
+    PipeBarrier<PIPE_V>();
+  }
+
+  /*
+   * data[r, :] *= row[:] for a dense [rows, cols] tile.
+   */
+  __aicore__ inline void RowBroadcastMul(const LocalTensor<float>& data, const LocalTensor<float>& row, uint32_t rows,
+                                         uint32_t cols) {
+    if (cols / EIGHT > GROUP_MAX_REPEAT) {
+      for (uint32_t r = 0; r < rows; r++) {
+        Mul(data[r * cols], data[r * cols], row, cols);
+      }
+      PipeBarrier<PIPE_V>();
+      return;
+    }
+    uint8_t repStride = cols / EIGHT;
+    for (uint32_t r = 0; r < rows; r += GROUP_MAX_REPEAT) {
+      uint8_t repeat = (rows - r) > GROUP_MAX_REPEAT ? GROUP_MAX_REPEAT : (rows - r);
+      for (uint32_t c = 0; c < cols; c += ELEM_PER_REP_FP32) {
+        uint64_t mask = (cols - c) > ELEM_PER_REP_FP32 ? ELEM_PER_REP_FP32 : (cols - c);
+        uint32_t offset = r * cols + c;
+        Mul(data[offset], data[offset], row[c], mask, repeat, {1, 1, 1, repStride, repStride, 0});
+      }
+    }
+    PipeBarrier<PIPE_V>();
+  }
+
+ private:
+  TQue<QuePosition::VECIN, BUFFER_NUM> inQueue;
+  TQue<QuePosition::VECOUT, BUFFER_NUM> outQueue;
+  TQue<QuePosition::VECOUT, BUFFER_NUM> scaleQueue;
+  TBuf<TPosition::VECCALC> dataBuf;
+  TBuf<TPosition::VECCALC> tmpBuf;
+  TBuf<TPosition::VECCALC> maxBuf;
+  TBuf<TPosition::VECCALC> brcbBuf;
+  TBuf<TPosition::VECCALC> smoothBuf;
+
+  GlobalTensor<xDtype> inGm;
+  GlobalTensor<xDtype> smoothGm;
+  GlobalTensor<float> scaleGm;
+  GlobalTensor<yDtype> outGm;
+
+  uint32_t rowLen = 0;
+  uint32_t groupSize = 0;
+  uint32_t rowBlockSize = 1;
+  uint32_t groupPerRow = 0;
+  uint32_t unitNum = 0;
+  uint32_t unitStart = 0;
+  uint32_t smoothLoadedCol = 0xFFFFFFFF;
+  uint32_t smoothLoadedLen = 0;
+  float quantMax = DYNAMIC_QUANT_INT8_SYM_SCALE;
+};
+}  // namespace DynamicQuantNDOpt
+#endif  // DYNAMIC_QUANT_GROUP_H
@@ -155,11 +155,24 @@ namespace optiling
                     VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(), "get tiling key fail."),
                     return ge::GRAPH_FAILED);
 
+    if (rnnParams.isPersist)
+    {
+      OP_TILING_CHECK(
+          GetPersistMMTilingData(context, tilingData, rnnParams) != ge::GRAPH_SUCCESS,
+          VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(), "get persist matmul tiling data fail."),
+          return ge::GRAPH_FAILED);
+    }
+
     OP_TILING_CHECK(SetTilingData(context, tilingData, rnnParams) != ge::GRAPH_SUCCESS,
                     VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(), "set tiling data fail."),
                     return ge::GRAPH_FAILED);
 
     int64_t workspaceSize = rnnParams.timeStep * rnnParams.batch * 4 * rnnParams.hiddenSize * 4 + 20 * 1024 * 1024;
+    if (rnnParams.isPersist)
+    {
+      // per-core step flags behind the gate workspace
+      workspaceSize += rnnParams.usedCoreNum * PERSIST_FLAG_BYTES;
+    }
     auto launchCore = (rnnParams.usedCoreNum + DEFAULT_INDEX_TWO - 1) / DEFAULT_INDEX_TWO;
     context->SetBlockDim(launchCore); // 24上限
     context->SetTilingKey(rnnParams.tilingKey);
@@ -313,12 +326,84 @@ namespace optiling
     return ge::GRAPH_SUCCESS;
   }
 
+  bool LstmTilingRNN::CheckPersistMode(const DynamicRnnTiling &rnnParams)
+  {
+    // 小batch长序列时每步两次SyncAll和weight_hidden的重复搬运占主导，权重能放进L1时走常驻模式。
+    // 单核分片按16列取整，hidden_size=1024在20个AIC上每核需512KB，放不下时回退到普通模式
+    int64_t hiddenBlock = 4;
+    int64_t fp16Size = 2;
+    if (rnnParams.dataType != ge::DT_FLOAT16 || rnnParams.batch > PERSIST_MAX_BATCH ||
+        rnnParams.hiddenSize % PERSIST_UNIT_N != 0 || rnnParams.timeStep < CONST_TWO)
+    {
+      return false;
+    }
+    int64_t aicNum = rnnParams.usedCoreNum / CONST_TWO;
+    int64_t units = rnnParams.hiddenSize / PERSIST_UNIT_N;
+    int64_t maxAicN = (units + aicNum - 1) / aicNum * PERSIST_UNIT_N;
+    int64_t weightL1 = hiddenBlock * rnnParams.hiddenSize * maxAicN * fp16Size;
+    return weightL1 + PERSIST_L1_RESERVE <= static_cast<int64_t>(rnnParams.l1Size);
+  }
+
+  ge::graphStatus LstmTilingRNN::GetPersistMMTilingData(const gert::TilingContext *context,
+                                                        DynamicRNNTilingData &tilingData, DynamicRnnTiling &rnnParams)
+  {
+    // 单核matmul：A为h_{t-1}，B为L1上常驻的本核权重分片(NZ)，N取单个AIV上的最大列数
+    int64_t hiddenBlock = 4;
+    int64_t fp16Size = 2;
+    int64_t aicNum = rnnParams.usedCoreNum / CONST_TWO;
+    int64_t units = rnnParams.hiddenSize / PERSIST_UNIT_N;
+    int64_t maxAicUnits = (units + aicNum - 1) / aicNum;
+    int64_t maxCoreN = (maxAicUnits + CONST_TWO - 1) / CONST_TWO * PERSIST_UNIT_N;
+    int64_t weightL1 = hiddenBlock * rnnParams.hiddenSize * maxAicUnits * PERSIST_UNIT_N * fp16Size;
+    auto dataType = static_cast<matmul_tiling::DataType>(rnnParams.dataType);
+
+    matmul_tiling::MatmulApiTiling persistMatmul;
+    auto ret = persistMatmul.SetAType(matmul_tiling::TPosition::GM, matmul_tiling::CubeFormat::ND, dataType);
+    OP_TILING_CHECK(ret == -1, VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(), "persist mm SetAType fail."),
+                    return ge::GRAPH_FAILED);
+    ret = persistMatmul.SetBType(matmul_tiling::TPosition::TSCM, matmul_tiling::CubeFormat::NZ, dataType);
+    OP_TILING_CHECK(ret == -1, VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(), "persist mm SetBType fail."),
+                    return ge::GRAPH_FAILED);
+    ret = persistMatmul.SetCType(matmul_tiling::TPosition::GM, matmul_tiling::CubeFormat::ND,
+                                 matmul_tiling::DataType::DT_FLOAT);
+    OP_TILING_CHECK(ret == -1, VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(), "persist mm SetCType fail."),
+                    return ge::GRAPH_FAILED);
+    ret = persistMatmul.SetOrgShape(rnnParams.batch, maxCoreN, rnnParams.hiddenSize);
+    OP_TILING_CHECK(ret == -1,
+                    VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(), "persist mm SetOrgShape fail."),
+                    return ge::GRAPH_FAILED);
+    ret = persistMatmul.SetShape(rnnParams.batch, maxCoreN, rnnParams.hiddenSize);
+    OP_TILING_CHECK(ret == -1,
+                    VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(), "persist mm Set single shape fail."),
+                    return ge::GRAPH_FAILED);
+    ret = persistMatmul.SetBias(false);
+    OP_TILING_CHECK(ret == -1, VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(), "persist mm SetBias fail."),
+                    return ge::GRAPH_FAILED);
+    // 权重占用之外的L1由同一AIC上的两个AIV的A矩阵缓存平分
+    ret = persistMatmul.SetBufferSpace(
+        static_cast<int32_t>((static_cast<int64_t>(rnnParams.l1Size) - weightL1) / CONST_TWO), -1, -1);
+    OP_TILING_CHECK(ret == -1,
+                    VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(), "persist mm SetBufferSpace fail."),
+                    return ge::GRAPH_FAILED);
+
+    ret = persistMatmul.GetTiling(tilingData.hiddenMMParam);
+    OP_TILING_CHECK(ret == -1, VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(), "persist mm GetTiling fail."),
+                    return ge::GRAPH_FAILED);
+    return ge::GRAPH_SUCCESS;
+  }
+
   ge::graphStatus LstmTilingRNN::CalcTilingKey(DynamicRnnTiling &rnnParams)
   {
     // 判断是否需要切分L0c输出，分次搬入UB
     int64_t tilingKey = 0;
+    rnnParams.isPersist = false;
 
-    if (rnnParams.dataType == 1)
+    if (rnnParams.dataType == 1 && CheckPersistMode(rnnParams))
+    {
+      tilingKey = static_cast<int64_t>(RNNTilingKey::MM_FP16_PERSIST);
+      rnnParams.isPersist = true;
+    }
+    else if (rnnParams.dataType == 1)
     {
       tilingKey = static_cast<int64_t>(RNNTilingKey::MM_FP16_SPLIT);
     }
@@ -48,6 +48,11 @@ constexpr int64_t MIN_BASE_SHAPE = 2048;
 constexpr int32_t UNKNOW_DIM = -2;
 constexpr uint32_t SCHEDULE_MODE = 1; // batchmode
 constexpr int32_t CONST_TWO = 2;
+// persistent mode: weight_hidden resident in L1, timesteps chained by per-core step flags
+constexpr int64_t PERSIST_UNIT_N = 16;
+constexpr int64_t PERSIST_MAX_BATCH = 64;
+constexpr int64_t PERSIST_L1_RESERVE = 128 * 1024;
+constexpr int64_t PERSIST_FLAG_BYTES = 32;
 
 enum class GateOrder : int64_t {
   IJFO,
@@ -58,7 +63,8 @@ enum class RNNTilingKey : int64_t {
   MM_FP16_SPLIT = 10000001,
   MM_FP32_SPLIT,
   MM_HF32_SPLIT,
-  MM_BF16_SPLIT
+  MM_BF16_SPLIT,
+  MM_FP16_PERSIST = 10000011
 };
 
 struct DynamicRnnTiling {
@@ -106,6 +112,7 @@ struct DynamicRnnTiling {
   int32_t dataType;
   bool isUseMerged;
   bool isFullLoad;
+  bool isPersist;
 };
 
 BEGIN_TILING_DATA_DEF(DynamicRNNTilingData)
@@ -174,6 +181,9 @@ class LstmTilingRNN {
                                                 DynamicRnnTiling& rnnParams);
     ge::graphStatus GetMMTilingDataSplit(const gert::TilingContext* context, DynamicRNNTilingData& tilingData,
                                                      DynamicRnnTiling& rnnParams, matmul_tiling::DataType dataType);
+    bool CheckPersistMode(const DynamicRnnTiling& rnnParams);
+    ge::graphStatus GetPersistMMTilingData(const gert::TilingContext* context, DynamicRNNTilingData& tilingData,
+                                           DynamicRnnTiling& rnnParams);
     ge::graphStatus CalcTilingKey(DynamicRnnTiling& rnnParams);
     ge::graphStatus SetTilingData(gert::TilingContext* context, DynamicRNNTilingData& tilingData,
                                         DynamicRnnTiling& rnnParams);
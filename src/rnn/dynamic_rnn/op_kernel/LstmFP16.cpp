@@ -619,7 +619,12 @@ __aicore__ inline void LstmMmSplitNDNDFP16<T>::ProcessVectorOnce(int64_t tIdx, i
                                                                  GlobalTensor<float>& mixGm) {
   int64_t ijfoBaseOffset, initcOffset, offset = 0;
   CalcVecScaler(tIdx, mIdx, nIdx, ijfoBaseOffset, initcOffset, offset);
+  ProcessVectorCell(ijfoBaseOffset, initcOffset, offset, mixGm);
+}
 
+template <typename T>
+__aicore__ inline void LstmMmSplitNDNDFP16<T>::ProcessVectorCell(int64_t ijfoBaseOffset, int64_t initcOffset,
+                                                                 int64_t offset, GlobalTensor<float>& mixGm) {
   LocalTensor<T> initCVec;
   LocalTensor<float> fInput, jInput, iInput, oInput;
   auto fSigmoid = ubLocal1;
@@ -678,7 +683,12 @@ __aicore__ inline void LstmMmSplitNDNDFP16<T>::ProcessVectorInitHC(int64_t mIdx,
                                                                  GlobalTensor<float>& mixGm) {
   int64_t ijfoBaseOffset, initcOffset, offset = 0;
   CalcVecScaler(0, mIdx, nIdx, ijfoBaseOffset, initcOffset, offset);
+  ProcessVectorInitHCCell(ijfoBaseOffset, initcOffset, offset, mixGm);
+}
 
+template <typename T>
+__aicore__ inline void LstmMmSplitNDNDFP16<T>::ProcessVectorInitHCCell(int64_t ijfoBaseOffset, int64_t initcOffset,
+                                                                       int64_t offset, GlobalTensor<float>& mixGm) {
   LocalTensor<float> fInput, jInput, iInput, oInput;
   auto fSigmoid = ubLocal1;
   auto iSigmoid = ubLocal1;
@@ -70,6 +70,10 @@ class LstmMmSplitNDNDFP16 {
   __aicore__ inline void ProcessHiddenMM(int64_t tIdx);
   __aicore__ inline void ProcessVectorOnce(int64_t tIdx, int64_t mIdx, int64_t nIdx, AscendC::GlobalTensor<float>& mixGm);
   __aicore__ inline void ProcessVectorInitHC(int64_t mIdx, int64_t nIdx, AscendC::GlobalTensor<float>& mixGm);
+  __aicore__ inline void ProcessVectorCell(int64_t ijfoBaseOffset, int64_t initcOffset, int64_t offset,
+                                           AscendC::GlobalTensor<float>& mixGm);
+  __aicore__ inline void ProcessVectorInitHCCell(int64_t ijfoBaseOffset, int64_t initcOffset, int64_t offset,
+                                                 AscendC::GlobalTensor<float>& mixGm);
   __aicore__ inline void ProcessVector(int64_t tIdx);
   __aicore__ inline void ProcessInitalT();
   __aicore__ inline void CopyInHCSeq(AscendC::LocalTensor<float>& dstUb, AscendC::GlobalTensor<T>& mixGm, int64_t off);
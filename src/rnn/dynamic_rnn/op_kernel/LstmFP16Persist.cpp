@@ -0,0 +1,280 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file LstmFP16Persist.cpp
+ * \brief
+ */
+#include "LstmFP16Persist.h"
+
+using namespace AscendC;
+constexpr static const int64_t AIV_PER_AIC = 2;
+constexpr static const int64_t PERSIST_VEC_MAX_SIZE = 21504 / sizeof(float);  // same ub budget as InitVars
+
+template <typename T>
+__aicore__ inline void LstmMmPersistNDNDFP16<T>::Init(GM_ADDR inputX, GM_ADDR weight, GM_ADDR bias, GM_ADDR seqLength,
+                                                  GM_ADDR initH, GM_ADDR initC, GM_ADDR wCi, GM_ADDR wCf, GM_ADDR wCo,
+                                                  GM_ADDR mask, GM_ADDR outputY, GM_ADDR outputH, GM_ADDR outputC,
+                                                  GM_ADDR outputI, GM_ADDR outputJ, GM_ADDR outputF, GM_ADDR outputO,
+                                                  GM_ADDR outputTanhC, const DynamicRNNTilingData* __restrict rnnTiling,
+                                                  GM_ADDR workspace) {
+  this->tiling = rnnTiling;
+  this->inputMMTiling = this->tiling->inputMMParam;
+  this->hiddenMMTiling = this->tiling->hiddenMMParam;
+  this->InitBuffers(inputX, weight, bias, seqLength, initH, initC, wCi, wCf, wCo, mask, outputY, outputH, outputC,
+                    outputI, outputJ, outputF, outputO, outputTanhC, workspace);
+  this->InitVars();
+  InitPersistSlice();
+  InitPersistVars();
+  this->InitQue();
+  InitPersistBuffers(workspace);
+}
+
+template <typename T>
+__aicore__ inline void LstmMmPersistNDNDFP16<T>::InitPersistSlice() {
+  // 先按AIC均分16列单元，再在同一AIC的两个AIV之间二分，使每个AIC常驻的权重量尽量均衡
+  int64_t aicNum = this->tiling->usedCoreNum / AIV_PER_AIC;
+  int64_t units = this->tiling->hiddenSize / PERSIST_UNIT_N;
+  int64_t aicIdx = GetBlockIdx() / AIV_PER_AIC;
+  int64_t baseUnits = units / aicNum;
+  int64_t remUnits = units % aicNum;
+  int64_t aicUnits = baseUnits + (aicIdx < remUnits ? 1 : 0);
+  int64_t aicStart = aicIdx * baseUnits + (aicIdx < remUnits ? aicIdx : remUnits);
+  int64_t firstUnits = this->Ceil(aicUnits, AIV_PER_AIC);
+
+  kAlign = this->Ceil(this->tiling->hiddenSize, PERSIST_UNIT_N) * PERSIST_UNIT_N;
+  if (GetSubBlockIdx() == 0) {
+    colStart = aicStart * PERSIST_UNIT_N;
+    coreN = firstUnits * PERSIST_UNIT_N;
+    l1Offset = 0;
+  } else {
+    colStart = (aicStart + firstUnits) * PERSIST_UNIT_N;
+    coreN = (aicUnits - firstUnits) * PERSIST_UNIT_N;
+    l1Offset = LSTM_GATE_SIZE * kAlign * firstUnits * PERSIST_UNIT_N;
+  }
+  maxAicN = this->Ceil(units, aicNum) * PERSIST_UNIT_N;
+  maxCoreN = this->Ceil(this->Ceil(units, aicNum), AIV_PER_AIC) * PERSIST_UNIT_N;
+  flagCount = this->tiling->usedCoreNum * PERSIST_FLAG_STRIDE;
+}
+
+template <typename T>
+__aicore__ inline void LstmMmPersistNDNDFP16<T>::InitPersistVars() {
+  // 每个核处理全部batch行、自己负责的hidden列，N方向不再切分
+  this->vectorCoreM = this->tiling->batch;
+  this->vectorSplitN = 1;
+  this->vectorBaseN = maxCoreN;
+  this->vectorTailN = 0;
+  this->vectorBaseM = (PERSIST_VEC_MAX_SIZE / maxCoreN) > this->vectorCoreM ? this->vectorCoreM :
+                                                                                (PERSIST_VEC_MAX_SIZE / maxCoreN);
+  this->vectorSplitM = this->Ceil(this->vectorCoreM, this->vectorBaseM);
+  this->vectorBaseTailM = this->vectorCoreM % this->vectorBaseM;
+  this->baseVector = this->vectorBaseM * maxCoreN;
+}
+
+template <typename T>
+__aicore__ inline void LstmMmPersistNDNDFP16<T>::InitPersistBuffers(GM_ADDR workspace) {
+  // 两个AIV共享同一AIC的L1，按AIC上的总列数申请，子核1的分片紧跟在子核0之后
+  this->pipe.InitBuffer(scmQue, 1, LSTM_GATE_SIZE * kAlign * maxAicN * sizeof(T));
+  this->pipe.InitBuffer(flagBuf, flagCount * sizeof(int32_t));
+  flagLocal = flagBuf.Get<int32_t>();
+
+  // step标志位放在门控workspace之后
+  int64_t gateSize = this->tiling->timeStep * this->tiling->batch * LSTM_GATE_SIZE * this->tiling->hiddenSize;
+  stepFlagGm.SetGlobalBuffer(reinterpret_cast<__gm__ int32_t*>(workspace) + gateSize, flagCount);
+}
+
+template <typename T>
+__aicore__ inline void LstmMmPersistNDNDFP16<T>::LoadHiddenWeight() {
+  if (coreN == 0) {
+    return;
+  }
+  // weight_hidden[H, 4H]里本核的4个门各取[H, coreN]，ND转NZ后常驻L1，整个时间步循环不再重读
+  Nd2NzParams nd2nzParams;
+  nd2nzParams.ndNum = 1;
+  nd2nzParams.nValue = this->tiling->hiddenSize;
+  nd2nzParams.dValue = coreN;
+  nd2nzParams.srcNdMatrixStride = 0;
+  nd2nzParams.srcDValue = LSTM_GATE_SIZE * this->tiling->hiddenSize;
+  nd2nzParams.dstNzC0Stride = kAlign;
+  nd2nzParams.dstNzNStride = 1;
+  nd2nzParams.dstNzMatrixStride = 0;
+
+  weightL1 = scmQue.AllocTensor<T>();
+  for (int64_t gate = 0; gate < LSTM_GATE_SIZE; gate++) {
+    DataCopy(weightL1[l1Offset + gate * kAlign * coreN],
+             this->inputGm.weightHiddenGm[gate * this->tiling->hiddenSize + colStart], nd2nzParams);
+  }
+  scmQue.EnQue(weightL1);
+  weightL1 = scmQue.DeQue<T>();
+
+  // C按[batch, 4H]的行宽写回，与inputMM的结果原地累加
+  persistMM.SetOrgShape(this->tiling->batch, coreN, this->tiling->hiddenSize, kAlign,
+                        LSTM_GATE_SIZE * this->tiling->hiddenSize);
+}
+
+template <typename T>
+__aicore__ inline void LstmMmPersistNDNDFP16<T>::PublishStep(int32_t step) {
+  flagLocal.SetValue(0, step);
+  event_t eventSMte3 = static_cast<event_t>(GetTPipePtr()->FetchEventID(HardEvent::S_MTE3));
+  SetFlag<HardEvent::S_MTE3>(eventSMte3);
+  WaitFlag<HardEvent::S_MTE3>(eventSMte3);
+  // 与h_t的搬出同在MTE3队列，标志可见时本核的h_t已经落盘
+  DataCopy(stepFlagGm[GetBlockIdx() * PERSIST_FLAG_STRIDE], flagLocal, PERSIST_FLAG_STRIDE);
+  event_t eventMte3S = static_cast<event_t>(GetTPipePtr()->FetchEventID(HardEvent::MTE3_S));
+  SetFlag<HardEvent::MTE3_S>(eventMte3S);
+  WaitFlag<HardEvent::MTE3_S>(eventMte3S);
+}
+
+template <typename T>
+__aicore__ inline void LstmMmPersistNDNDFP16<T>::WaitStep(int32_t step) {
+  if (step == 0 || coreN == 0) {
+    return;
+  }
+  bool ready = false;
+  for (int64_t retry = 0; !ready; retry++) {
+    if (retry >= PERSIST_WAIT_MAX_RETRY) {
+      trap();
+    }
+    DataCopy(flagLocal, stepFlagGm, flagCount);
+    event_t eventMte2S = static_cast<event_t>(GetTPipePtr()->FetchEventID(HardEvent::MTE2_S));
+    SetFlag<HardEvent::MTE2_S>(eventMte2S);
+    WaitFlag<HardEvent::MTE2_S>(eventMte2S);
+    ready = true;
+    for (int64_t coreIdx = 0; coreIdx < this->tiling->usedCoreNum; coreIdx++) {
+      if (flagLocal.GetValue(coreIdx * PERSIST_FLAG_STRIDE) < step) {
+        ready = false;
+        break;
+      }
+    }
+    event_t eventSMte2 = static_cast<event_t>(GetTPipePtr()->FetchEventID(HardEvent::S_MTE2));
+    SetFlag<HardEvent::S_MTE2>(eventSMte2);
+    WaitFlag<HardEvent::S_MTE2>(eventSMte2);
+  }
+}
+
+template <typename T>
+__aicore__ inline void LstmMmPersistNDNDFP16<T>::ProcessPersistHiddenMM(int64_t tIdx) {
+  if (coreN == 0) {
+    return;
+  }
+  int64_t cellOffset;
+  if (this->tiling->direction == 1) {
+    cellOffset = (this->tiling->timeStep - 1 - tIdx) * this->allCellSize;
+  } else {
+    cellOffset = tIdx * this->allCellSize;
+  }
+  persistMM.SetTensorA(this->inputGm.initHGm);
+  for (int64_t gate = 0; gate < LSTM_GATE_SIZE; gate++) {
+    persistMM.SetTensorB(weightL1[l1Offset + gate * kAlign * coreN]);
+    persistMM.SetTail(this->tiling->batch, coreN, this->tiling->hiddenSize);
+    persistMM.IterateAll(this->outputGm.workspace[cellOffset + gate * this->tiling->hiddenSize + colStart], true);
+  }
+}
+
+template <typename T>
+__aicore__ inline void LstmMmPersistNDNDFP16<T>::CalcPersistScaler(int64_t tIdx, int64_t mIdx,
+                                                                   int64_t& ijfoBaseOffset, int64_t& initcOffset,
+                                                                   int64_t& offset) {
+  this->calcN = coreN;
+  this->calcM = this->vectorBaseM;
+  if ((this->vectorBaseTailM > 0) && (mIdx == this->vectorSplitM - 1)) {
+    this->calcM = this->vectorBaseTailM;
+  }
+  this->calcSizeAlign = this->calcM * this->Ceil(this->calcN, this->blockSize) * this->blockSize;
+
+  ijfoBaseOffset = mIdx * this->vectorBaseM * this->tiling->hiddenSize * LSTM_GATE_SIZE + colStart;
+  initcOffset = mIdx * this->vectorBaseM * this->tiling->hiddenSize + colStart;
+  if (this->tiling->direction == 1) {
+    offset = (this->tiling->timeStep - 1 - tIdx) * this->oneCellSize + initcOffset;
+  } else {
+    offset = tIdx * this->oneCellSize + initcOffset;
+  }
+}
+
+template <typename T>
+__aicore__ inline void LstmMmPersistNDNDFP16<T>::ProcessPersistVector(int64_t tIdx) {
+  if (coreN == 0) {
+    return;
+  }
+  int64_t cellOffset;
+  if (this->tiling->direction == 1) {
+    cellOffset = (this->tiling->timeStep - 1 - tIdx) * this->allCellSize;
+  } else {
+    cellOffset = tIdx * this->allCellSize;
+  }
+  auto mixGm = this->outputGm.workspace[cellOffset];
+  int64_t ijfoBaseOffset, initcOffset, offset = 0;
+  for (int64_t j = 0; j < this->vectorSplitM; ++j) {
+    CalcPersistScaler(tIdx, j, ijfoBaseOffset, initcOffset, offset);
+    this->ProcessVectorCell(ijfoBaseOffset, initcOffset, offset, mixGm);
+  }
+}
+
+template <typename T>
+__aicore__ inline void LstmMmPersistNDNDFP16<T>::ProcessPersistInitalT() {
+  if (coreN == 0) {
+    return;
+  }
+  int64_t cellOffset = 0;
+  if (this->tiling->direction == 1) {
+    cellOffset = (this->tiling->timeStep - 1) * this->allCellSize;
+  }
+  auto mixGm = this->outputGm.workspace[cellOffset];
+  int64_t ijfoBaseOffset, initcOffset, offset = 0;
+  for (int64_t j = 0; j < this->vectorSplitM; ++j) {
+    CalcPersistScaler(0, j, ijfoBaseOffset, initcOffset, offset);
+    this->ProcessVectorInitHCCell(ijfoBaseOffset, initcOffset, offset, mixGm);
+  }
+}
+
+template <typename T>
+__aicore__ inline void LstmMmPersistNDNDFP16<T>::UpdateInitHC(int64_t tIdx) {
+  if (this->tiling->direction == 1) {
+    this->inputGm.initCGm = this->outputGm.outCGm[(this->tiling->timeStep - 1 - tIdx) * this->oneCellSize];
+    this->inputGm.initHGm = this->outputGm.outHGm[(this->tiling->timeStep - 1 - tIdx) * this->oneCellSize];
+  } else {
+    this->inputGm.initCGm = this->outputGm.outCGm[tIdx * this->oneCellSize];
+    this->inputGm.initHGm = this->outputGm.outHGm[tIdx * this->oneCellSize];
+  }
+}
+
+template <typename T>
+__aicore__ inline void LstmMmPersistNDNDFP16<T>::Process() {
+  this->ProcessInputMM();
+  LoadHiddenWeight();
+  // 只在x*W_i之后做一次全核同步；空闲核直接标记为全部完成，不参与后续等待
+  PublishStep(coreN == 0 ? static_cast<int32_t>(this->tiling->timeStep) : 0);
+  SyncAll();
+
+  int64_t tStart = 0;
+  if (this->tiling->isInithc == 0) {
+    ProcessPersistInitalT();
+    UpdateInitHC(0);
+    if (coreN > 0) {
+      PublishStep(1);
+    }
+    tStart = 1;
+  }
+
+  // 第t步只依赖所有核的h_{t-1}：等待各核step标志>=t，替代原先每步两次SyncAll
+  for (int64_t tIdx = tStart; tIdx < this->tiling->timeStep; tIdx++) {
+    WaitStep(static_cast<int32_t>(tIdx));
+    ProcessPersistHiddenMM(tIdx);
+    ProcessPersistVector(tIdx);
+    UpdateInitHC(tIdx);
+    if (coreN > 0) {
+      PublishStep(static_cast<int32_t>(tIdx + 1));
+    }
+  }
+
+  if (coreN > 0) {
+    scmQue.FreeTensor(weightL1);
+  }
+}
@@ -0,0 +1,85 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file LstmFP16Persist.h
+ * \brief persistent-weight lstm: weight_hidden stays in L1, timesteps are chained by per-core step flags
+ */
+#ifndef _ASCENDC_LSTMFP16_PERSIST_H_
+#define _ASCENDC_LSTMFP16_PERSIST_H_
+
+#include "LstmFP16.h"
+
+// hidden列按16列(一个NZ分形)为单位切给各AIV核
+constexpr int64_t PERSIST_UNIT_N = 16;
+// 每个核的step标志独占一个32B block，避免相邻核写同一cacheline
+constexpr int64_t PERSIST_FLAG_STRIDE = 8;
+// 等待step标志的最大轮询次数，单次轮询为一次GM往返(us级)，上限对应十秒量级；
+// 超过说明有核未被调度或提前退出，直接trap报错而不是让整卡挂死
+constexpr int64_t PERSIST_WAIT_MAX_RETRY = 16 * 1024 * 1024;
+
+__aicore__ inline constexpr auto GetRnnPersistMmConfig()
+{
+  auto cfg = GetRnnMmConfig();
+  cfg.enableSetOrgShape = true;
+  return cfg;
+}
+constexpr auto RNN_PERSIST_MM_CFG = GetRnnPersistMmConfig();
+
+template <typename T>
+class LstmMmPersistNDNDFP16 : public LstmMmSplitNDNDFP16<T> {
+ public:
+  __aicore__ inline LstmMmPersistNDNDFP16() = default;
+  __aicore__ inline void Init(GM_ADDR inputX, GM_ADDR weight, GM_ADDR bias, GM_ADDR seqLength, GM_ADDR initH,
+                        GM_ADDR initC, GM_ADDR wCi, GM_ADDR wCf, GM_ADDR wCo, GM_ADDR mask,
+                        GM_ADDR outputY, GM_ADDR outputH, GM_ADDR outputC, GM_ADDR outputI,
+                        GM_ADDR outputJ, GM_ADDR outputF, GM_ADDR outputO, GM_ADDR outputTanhC,
+                        const DynamicRNNTilingData* __restrict rnnTiling, GM_ADDR workspace);
+  __aicore__ inline void Process();
+
+ protected:
+  __aicore__ inline void InitPersistSlice();
+  __aicore__ inline void InitPersistVars();
+  __aicore__ inline void InitPersistBuffers(GM_ADDR workspace);
+  __aicore__ inline void LoadHiddenWeight();
+  __aicore__ inline void PublishStep(int32_t step);
+  __aicore__ inline void WaitStep(int32_t step);
+  __aicore__ inline void ProcessPersistHiddenMM(int64_t tIdx);
+  __aicore__ inline void CalcPersistScaler(int64_t tIdx, int64_t mIdx, int64_t& ijfoBaseOffset,
+                                           int64_t& initcOffset, int64_t& offset);
+  __aicore__ inline void ProcessPersistVector(int64_t tIdx);
+  __aicore__ inline void ProcessPersistInitalT();
+  __aicore__ inline void UpdateInitHC(int64_t tIdx);
+
+ public:
+  // A: h_{t-1} from GM, B: resident weight_hidden slice in L1, C: accumulated onto x*W_i in workspace
+  matmul::Matmul<matmul::MatmulType<AscendC::TPosition::GM, CubeFormat::ND, T>,
+                 matmul::MatmulType<AscendC::TPosition::TSCM, CubeFormat::NZ, T>,
+                 matmul::MatmulType<AscendC::TPosition::GM, CubeFormat::ND, float>,
+                 matmul::MatmulType<AscendC::TPosition::GM, CubeFormat::ND, float>, RNN_PERSIST_MM_CFG>
+      persistMM;
+
+ protected:
+  AscendC::TQue<AscendC::TPosition::TSCM, 1> scmQue;
+  AscendC::TBuf<AscendC::TPosition::VECCALC> flagBuf;
+  AscendC::LocalTensor<T> weightL1;
+  AscendC::LocalTensor<int32_t> flagLocal;
+  AscendC::GlobalTensor<int32_t> stepFlagGm;
+
+  int64_t colStart;
+  int64_t coreN;
+  int64_t maxCoreN;
+  int64_t maxAicN;
+  int64_t l1Offset;
+  int64_t kAlign;
+  int64_t flagCount;
+};
+
+#endif
@@ -13,6 +13,7 @@
  * \brief
  */
 #include "LstmFP16.cpp"
+#include "LstmFP16Persist.cpp"
 #include "LstmFP32.cpp"
 
 extern "C" __global__ __aicore__ void dynamic_rnn(GM_ADDR inputX, GM_ADDR weight, GM_ADDR bias, GM_ADDR seqLength,
@@ -57,6 +58,14 @@ extern "C" __global__ __aicore__ void dynamic_rnn(GM_ADDR inputX, GM_ADDR weight
     LstmMmSplitNDNDFP32<float> lstmOp;
     REGIST_MATMUL_OBJ(&lstmOp.pipe, GetSysWorkSpacePtr(), lstmOp.inputMM, inputMMTiling, lstmOp.hiddenMM, hiddenMMTiling);
 
+    lstmOp.Init(inputX, weight, bias, seqLength, initH, initC, wCi, wCf, wCo, mask, outputY, outputH, outputC, outputI,
+                outputJ, outputF, outputO, outputTanhC, &tiling_data, workspace);
+    lstmOp.Process();
+  } else if (TILING_KEY_IS(10000011)) {
+    LstmMmPersistNDNDFP16<half> lstmOp;
+    REGIST_MATMUL_OBJ(&lstmOp.pipe, GetSysWorkSpacePtr(), lstmOp.inputMM, inputMMTiling, lstmOp.persistMM,
+                      hiddenMMTiling);
+
     lstmOp.Init(inputX, weight, bias, seqLength, initH, initC, wCi, wCf, wCo, mask, outputY, outputH, outputC, outputI,
                 outputJ, outputF, outputO, outputTanhC, &tiling_data, workspace);
     lstmOp.Process();
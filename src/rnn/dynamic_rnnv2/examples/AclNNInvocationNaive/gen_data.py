@@ -0,0 +1,73 @@
+#!/usr/bin/python3
+# -*- coding:utf-8 -*-
+# Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+# This file is a part of the CANN Open Software.
+# Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+# ======================================================================================================================
+
+import os
+import numpy as np
+
+TIME_STEP = 4
+BATCH = 8
+INPUT_SIZE = 16
+HIDDEN_SIZE = 16
+NUM_DIRECTION = 2
+
+
+def sigmoid(x):
+    return 1 / (1 + np.exp(-x))
+
+
+def gru_one_direction(x, w_i, w_h, b, h, reverse):
+    # linear-before-reset，gate_order为rzh：n = tanh(x·W_in + b_in + r * (h·W_hn + b_hn))
+    hidden = w_h.shape[0]
+    time_step = x.shape[0]
+    y = np.zeros((time_step, x.shape[1], hidden), dtype=np.float32)
+    steps = range(time_step - 1, -1, -1) if reverse else range(time_step)
+    for t in steps:
+        gi = x[t] @ w_i + b[:3 * hidden]
+        gh = h @ w_h + b[3 * hidden:]
+        r = sigmoid(gi[:, :hidden] + gh[:, :hidden])
+        z = sigmoid(gi[:, hidden:2 * hidden] + gh[:, hidden:2 * hidden])
+        n = np.tanh(gi[:, 2 * hidden:] + r * gh[:, 2 * hidden:])
+        h = n + z * (h - n)
+        y[t] = h
+    return y, h
+
+
+def gen_golden_data_simple():
+    x = np.random.uniform(-1, 1, [TIME_STEP, BATCH, INPUT_SIZE]).astype(np.float32)
+    # 双向时权重、bias与init_h的第0维为方向，0为正向，1为反向
+    weight_input = np.random.uniform(-0.5, 0.5, [NUM_DIRECTION, INPUT_SIZE, 3 * HIDDEN_SIZE]).astype(np.float32)
+    weight_hidden = np.random.uniform(-0.5, 0.5, [NUM_DIRECTION, HIDDEN_SIZE, 3 * HIDDEN_SIZE]).astype(np.float32)
+    bias = np.random.uniform(-0.5, 0.5, [NUM_DIRECTION, 6 * HIDDEN_SIZE]).astype(np.float32)
+    init_h = np.random.uniform(-1, 1, [NUM_DIRECTION, BATCH, HIDDEN_SIZE]).astype(np.float32)
+
+    ys = []
+    hs = []
+    for direction in range(NUM_DIRECTION):
+        y, h = gru_one_direction(x, weight_input[direction], weight_hidden[direction], bias[direction],
+                                 init_h[direction], direction == 1)
+        ys.append(y)
+        hs.append(h)
+    golden_y = np.concatenate(ys, axis=-1)
+    golden_h = np.stack(hs, axis=0)
+
+    os.system("mkdir -p input")
+    os.system("mkdir -p output")
+    x.tofile("./input/input_x.bin")
+    weight_input.tofile("./input/input_weight_input.bin")
+    weight_hidden.tofile("./input/input_weight_hidden.bin")
+    bias.tofile("./input/input_b.bin")
+    init_h.tofile("./input/input_init_h.bin")
+    golden_y.astype(np.float32).tofile("./output/golden_y.bin")
+    golden_h.astype(np.float32).tofile("./output/golden_output_h.bin")
+
+
+if __name__ == "__main__":
+    gen_golden_data_simple()
@@ -0,0 +1,213 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file main.cpp
+ */
+
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "acl/acl.h"
+#include "aclnn_dynamic_rnnv2.h"
+
+#define CHECK_RET(cond, return_expr) \
+  do {                               \
+    if (!(cond)) {                   \
+      return_expr;                   \
+    }                                \
+  } while (0)
+
+#define LOG_PRINT(message, ...)     \
+  do {                              \
+    printf(message, ##__VA_ARGS__); \
+  } while (0)
+
+int64_t GetShapeSize(const std::vector<int64_t>& shape) {
+  int64_t shapeSize = 1;
+  for (auto i : shape) {
+    shapeSize *= i;
+  }
+  return shapeSize;
+}
+
+bool ReadFile(const std::string& filePath, std::vector<float>& hostData) {
+  std::ifstream file(filePath, std::ios::binary);
+  if (!file.is_open()) {
+    LOG_PRINT("Open file failed. path = %s\n", filePath.c_str());
+    return false;
+  }
+  file.read(reinterpret_cast<char*>(hostData.data()), hostData.size() * sizeof(float));
+  return static_cast<size_t>(file.gcount()) == hostData.size() * sizeof(float);
+}
+
+int WriteOutput(const std::string& filePath, const std::vector<int64_t>& shape, void* deviceAddr) {
+  auto size = GetShapeSize(shape);
+  std::vector<float> resultData(size, 0);
+  auto ret = aclrtMemcpy(resultData.data(), resultData.size() * sizeof(resultData[0]), deviceAddr,
+                         size * sizeof(resultData[0]), ACL_MEMCPY_DEVICE_TO_HOST);
+  CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("copy result from device to host failed. ERROR: %d\n", ret); return ret);
+  std::ofstream file(filePath, std::ios::binary);
+  CHECK_RET(file.is_open(), LOG_PRINT("Open file failed. path = %s\n", filePath.c_str()); return 1);
+  file.write(reinterpret_cast<const char*>(resultData.data()), size * sizeof(float));
+  return 0;
+}
+
+int Init(int32_t deviceId, aclrtStream* stream) {
+  // 固定写法，AscendCL初始化
+  auto ret = aclInit(nullptr);
+  CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("aclInit failed. ERROR: %d\n", ret); return ret);
+  ret = aclrtSetDevice(deviceId);
+  CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("aclrtSetDevice failed. ERROR: %d\n", ret); return ret);
+  ret = aclrtCreateStream(stream);
+  CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("aclrtCreateStream failed. ERROR: %d\n", ret); return ret);
+  return 0;
+}
+
+int CreateAclTensor(const std::vector<float>& hostData, const std::vector<int64_t>& shape, void** deviceAddr,
+                    aclTensor** tensor) {
+  auto size = GetShapeSize(shape) * sizeof(float);
+  // 调用aclrtMalloc申请device侧内存
+  auto ret = aclrtMalloc(deviceAddr, size, ACL_MEM_MALLOC_HUGE_FIRST);
+  CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("aclrtMalloc failed. ERROR: %d\n", ret); return ret);
+  // 调用aclrtMemcpy将host侧数据复制到device侧内存上
+  ret = aclrtMemcpy(*deviceAddr, size, hostData.data(), size, ACL_MEMCPY_HOST_TO_DEVICE);
+  CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("aclrtMemcpy failed. ERROR: %d\n", ret); return ret);
+
+  // 计算连续tensor的strides
+  std::vector<int64_t> strides(shape.size(), 1);
+  for (int64_t i = shape.size() - 2; i >= 0; i--) {
+    strides[i] = shape[i + 1] * strides[i + 1];
+  }
+
+  // 调用aclCreateTensor接口创建aclTensor
+  *tensor = aclCreateTensor(shape.data(), shape.size(), aclDataType::ACL_FLOAT, strides.data(), 0,
+                            aclFormat::ACL_FORMAT_ND, shape.data(), shape.size(), *deviceAddr);
+  return 0;
+}
+
+int main() {
+  // 1. （固定写法）device/stream初始化，参考AscendCL对外接口列表
+  // 根据自己的实际device填写deviceId
+  int32_t deviceId = 0;
+  aclrtStream stream;
+  auto ret = Init(deviceId, &stream);
+  CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("Init acl failed. ERROR: %d\n", ret); return ret);
+
+  // 2. 构造输入与输出，双向GRU：权重、bias与init_h第0维为方向，y按最后一维拼接两个方向
+  int64_t timeStep = 4;
+  int64_t batch = 8;
+  int64_t inputSize = 16;
+  int64_t hiddenSize = 16;
+  int64_t numDirection = 2;
+
+  std::vector<int64_t> xShape = {timeStep, batch, inputSize};
+  std::vector<int64_t> weightInputShape = {numDirection, inputSize, 3 * hiddenSize};
+  std::vector<int64_t> weightHiddenShape = {numDirection, hiddenSize, 3 * hiddenSize};
+  std::vector<int64_t> biasShape = {numDirection, 6 * hiddenSize};
+  std::vector<int64_t> stateShape = {numDirection, batch, hiddenSize};
+  std::vector<int64_t> outShape = {timeStep, batch, numDirection * hiddenSize};
+
+  // 输入依次为x、weight_input、weight_hidden、b、init_h、init_c
+  // GRU不使用init_c，但init_h与init_c需同时传入才会按init_h初始化
+  std::vector<std::vector<int64_t>> inShapes = {xShape, weightInputShape, weightHiddenShape,
+                                                biasShape, stateShape, stateShape};
+  std::vector<std::string> inFiles = {"x", "weight_input", "weight_hidden", "b", "init_h", "init_h"};
+  // 输出依次为y、output_h、output_c、i、j、f、o、tanhc
+  std::vector<std::vector<int64_t>> outShapes = {outShape, stateShape, stateShape, outShape,
+                                                 outShape, outShape, outShape, outShape};
+
+  std::vector<void*> inDeviceAddrs(inShapes.size(), nullptr);
+  std::vector<aclTensor*> inTensors(inShapes.size(), nullptr);
+  for (size_t i = 0; i < inShapes.size(); i++) {
+    std::vector<float> hostData(GetShapeSize(inShapes[i]));
+    CHECK_RET(ReadFile("../input/input_" + inFiles[i] + ".bin", hostData), return 1);
+    ret = CreateAclTensor(hostData, inShapes[i], &inDeviceAddrs[i], &inTensors[i]);
+    CHECK_RET(ret == ACL_SUCCESS, return ret);
+  }
+  std::vector<void*> outDeviceAddrs(outShapes.size(), nullptr);
+  std::vector<aclTensor*> outTensors(outShapes.size(), nullptr);
+  for (size_t i = 0; i < outShapes.size(); i++) {
+    std::vector<float> hostData(GetShapeSize(outShapes[i]), 0);
+    ret = CreateAclTensor(hostData, outShapes[i], &outDeviceAddrs[i], &outTensors[i]);
+    CHECK_RET(ret == ACL_SUCCESS, return ret);
+  }
+
+  char cellType[] = "GRU";
+  char direction[] = "BIDIRECTIONAL";
+  char activation[] = "tanh";
+  char recurrentActivation[] = "sigmoid";
+  char gateOrder[] = "rzh";
+  char mergeMode[] = "concat";
+  int64_t cellDepth = 1;
+  bool usePeephole = false;
+  double keepProb = 1.0;
+  double cellClip = -1.0;
+  int64_t numProj = 0;
+  bool timeMajor = true;
+  double forgetBias = 0.0;
+  bool stateful = false;
+  bool isTraining = false;
+
+  // 3. 调用CANN算子库API
+  uint64_t workspaceSize = 0;
+  aclOpExecutor* executor;
+
+  // 调用aclnnDynamicRNNV2第一段接口，seq_length、wci、wcf、wco、mask不传
+  ret = aclnnDynamicRNNV2GetWorkspaceSize(inTensors[0], inTensors[1], inTensors[2], inTensors[3], nullptr,
+                                          inTensors[4], inTensors[5], nullptr, nullptr, nullptr, nullptr,
+                                          cellType, direction, cellDepth, usePeephole, keepProb, cellClip, numProj,
+                                          timeMajor, activation, recurrentActivation, forgetBias, gateOrder,
+                                          stateful, mergeMode, isTraining, outTensors[0], outTensors[1],
+                                          outTensors[2], outTensors[3], outTensors[4], outTensors[5], outTensors[6],
+                                          outTensors[7], &workspaceSize, &executor);
+  CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("aclnnDynamicRNNV2GetWorkspaceSize failed. ERROR: %d\n", ret);
+            return ret);
+
+  // 根据第一段接口计算出的workspaceSize申请device内存
+  void* workspaceAddr = nullptr;
+  if (workspaceSize > 0) {
+    ret = aclrtMalloc(&workspaceAddr, workspaceSize, ACL_MEM_MALLOC_HUGE_FIRST);
+    CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("allocate workspace failed. ERROR: %d\n", ret); return ret);
+  }
+
+  // 调用aclnnDynamicRNNV2第二段接口
+  ret = aclnnDynamicRNNV2(workspaceAddr, workspaceSize, executor, stream);
+  CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("aclnnDynamicRNNV2 failed. ERROR: %d\n", ret); return ret);
+
+  // 4. （固定写法）同步等待任务执行结束
+  ret = aclrtSynchronizeStream(stream);
+  CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("aclrtSynchronizeStream failed. ERROR: %d\n", ret); return ret);
+
+  // 5. 将y与output_h写回host侧，由verify_result.py与golden比对
+  ret = WriteOutput("../output/output_y.bin", outShapes[0], outDeviceAddrs[0]);
+  CHECK_RET(ret == ACL_SUCCESS, return ret);
+  ret = WriteOutput("../output/output_h.bin", outShapes[1], outDeviceAddrs[1]);
+  CHECK_RET(ret == ACL_SUCCESS, return ret);
+
+  // 6. 释放aclTensor与device资源
+  for (size_t i = 0; i < inTensors.size(); i++) {
+    aclDestroyTensor(inTensors[i]);
+    aclrtFree(inDeviceAddrs[i]);
+  }
+  for (size_t i = 0; i < outTensors.size(); i++) {
+    aclDestroyTensor(outTensors[i]);
+    aclrtFree(outDeviceAddrs[i]);
+  }
+  if (workspaceSize > 0) {
+    aclrtFree(workspaceAddr);
+  }
+  aclrtDestroyStream(stream);
+  aclrtResetDevice(deviceId);
+  aclFinalize();
+
+  return 0;
+}
@@ -0,0 +1,41 @@
+#!/usr/bin/python3
+# -*- coding:utf-8 -*-
+# Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+# This file is a part of the CANN Open Software.
+# Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+# ======================================================================================================================
+import sys
+import numpy as np
+
+LOSS = 1e-3 # 容忍偏差，fp32输入下门计算与matmul累加误差均在千分之一以内
+MINIMUM = 10e-10
+
+
+def verify_result(real_result, golden):
+    dtype = np.float32
+    real_result = np.fromfile(real_result, dtype=dtype) # 从bin文件读取实际运算结果
+    golden = np.fromfile(golden, dtype=dtype) # 从bin文件读取预期运算结果
+    if real_result.size != golden.size:
+        print("[ERROR] result size %d not equal golden size %d" % (real_result.size, golden.size))
+        return False
+    result = np.abs(real_result - golden) # 计算运算结果和预期结果偏差
+    deno = np.maximum(np.abs(real_result), np.abs(golden))  # 获取最大值并组成新数组
+    result_atol = np.less_equal(result, LOSS) # 计算绝对误差
+    result_rtol = np.less_equal(result / np.add(deno, MINIMUM), LOSS) # 计算相对误差
+    if not result_rtol.all() and not result_atol.all():
+        if np.sum(result_rtol == False) > real_result.size * LOSS and \
+           np.sum(result_atol == False) > real_result.size * LOSS: # 误差超出预期时返回打印错误，返回对比失败
+            print("[ERROR] result error")
+            return False
+    return True
+
+
+if __name__ == '__main__':
+    # 依次比对拼接后的y[T, B, 2H]与两个方向的最终状态output_h[2, B, H]
+    pairs = list(zip(sys.argv[1::2], sys.argv[2::2]))
+    if all(verify_result(real, golden) for real, golden in pairs):
+        print("test pass")
@@ -101,6 +101,20 @@ ge::graphStatus LstmTilingRNNV2::TilingWithAscendC(gert::TilingContext* context)
                   return ge::GRAPH_FAILED);
 
   int64_t workspaceSize = rnnParams.timeStep * rnnParams.batch * 4 * rnnParams.hiddenSize * 4 + 20 * 1024 * 1024;
+  if (rnnParams.cellType == static_cast<int64_t>(RNNCellType::GRU)) {
+    // gi[T, B, 3H] + gh[B, 3H] + zero init_h[B, H], all float
+    workspaceSize = ((rnnParams.timeStep + 1) * GRU_GATE_NUM + 1) * rnnParams.batch * rnnParams.hiddenSize * 4 +
+                    20 * 1024 * 1024;
+    if (rnnParams.direction == static_cast<int64_t>(RNNDirection::BIDIRECTIONAL)) {
+      // 双向时逐步的h[T, B, H]放在workspace，两个方向依次复用
+      workspaceSize += rnnParams.timeStep * rnnParams.batch * rnnParams.hiddenSize * 4;
+    }
+  }
+  if (rnnParams.isPacked == 1) {
+    // batchSizes[T] (int32) for packed execution, placed right after the gate workspace
+    workspaceSize += (rnnParams.timeStep * sizeof(int32_t) + PACKED_ALIGN_BYTES - 1) / PACKED_ALIGN_BYTES *
+                     PACKED_ALIGN_BYTES;
+  }
   auto launchCore = (rnnParams.usedCoreNum + DEFAULT_INDEX_TWO - 1) / DEFAULT_INDEX_TWO;
   context->SetBlockDim(launchCore);  // 24上限
   context->SetTilingKey(rnnParams.tilingKey);
@@ -176,7 +190,8 @@ ge::graphStatus LstmTilingRNNV2::GetMMTilingData(gert::TilingContext* context, D
 
 ge::graphStatus LstmTilingRNNV2::GetMMTilingDataSplit(const gert::TilingContext* context, DynamicRNNTilingData& tilingData,
                                                  DynamicRnnTiling& rnnParams, matmul_tiling::DataType dataType) {
-  int32_t hiddenBlock = 4;
+  bool isGru = rnnParams.cellType == static_cast<int64_t>(RNNCellType::GRU);
+  int64_t hiddenBlock = isGru ? GRU_GATE_NUM : LSTM_GATE_NUM;
   int64_t aivDouble = 2;
   matmul_tiling::MultiCoreMatmulTiling rnnMatmul1;
   rnnParams.usedCoreNum = context->GetPlatformInfo()->GetCoreNum() * aivDouble;
@@ -228,6 +243,13 @@ ge::graphStatus LstmTilingRNNV2::GetMMTilingDataSplit(const gert::TilingContext*
                             matmul_tiling::DataType::DT_FLOAT);
   OP_TILING_CHECK(ret == -1, VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(), "mm2 SetCType fail."),
                   return ge::GRAPH_FAILED);
+  // GRU的n门需要r * (h * W_hn + b_hn)，隐层bias不能并入输入投影，随hidden matmul一起加
+  if (isGru && rnnParams.isBias) {
+    rnnMatmul2.SetBiasType(matmul_tiling::TPosition::GM, matmul_tiling::CubeFormat::ND, dataType);
+    ret = rnnMatmul2.SetBias(true);
+    OP_TILING_CHECK(ret == -1, VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(), "mm2 SetBias fail."),
+                    return ge::GRAPH_FAILED);
+  }
   ret = rnnMatmul2.SetDim(rnnParams.sysAivCoreNum);
   OP_TILING_CHECK(ret == -1, VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(), "mm2 SetDim fail."),
                   return ge::GRAPH_FAILED);
@@ -252,7 +274,13 @@ ge::graphStatus LstmTilingRNNV2::CalcTilingKey(DynamicRnnTiling& rnnParams) {
   // 判断是否需要切分L0c输出，分次搬入UB
   int64_t tilingKey = 0;
 
-  if (rnnParams.dataType == 1) {
+  if (rnnParams.cellType == static_cast<int64_t>(RNNCellType::GRU)) {
+    if (rnnParams.dataType == 1) {
+      tilingKey = static_cast<int64_t>(RNNTilingKey::GRU_FP16_SPLIT);
+    } else if (rnnParams.dataType == 0) {
+      tilingKey = static_cast<int64_t>(RNNTilingKey::GRU_FP32_SPLIT);
+    }
+  } else if (rnnParams.dataType == 1) {
     tilingKey = static_cast<int64_t>(RNNTilingKey::MM_FP16_SPLIT);
   } else if (rnnParams.dataType == 0) {
     tilingKey = static_cast<int64_t>(RNNTilingKey::MM_FP32_SPLIT);
@@ -269,6 +297,8 @@ ge::graphStatus LstmTilingRNNV2::SetTilingData(gert::TilingContext* context, Dyn
   rnnParams.isHF32 = 0;
   rnnParams.isCached = 0;
   rnnParams.cacheLength = 0;
+  // 推理且带seq_length时按时间步收缩有效batch；训练需要完整的门输出，保持原有掩码计算
+  rnnParams.isPacked = (rnnParams.isSeqLength == 1 && rnnParams.isTraining == 0) ? 1 : 0;
 
   tilingData.set_tilingKey(rnnParams.tilingKey);
   tilingData.set_usedCoreNum(rnnParams.usedCoreNum);
@@ -279,6 +309,7 @@ ge::graphStatus LstmTilingRNNV2::SetTilingData(gert::TilingContext* context, Dyn
   tilingData.set_isBias(rnnParams.isBias);
   tilingData.set_isInithc(rnnParams.isInithc);
   tilingData.set_isSeqLength(rnnParams.isSeqLength);
+  tilingData.set_isPacked(rnnParams.isPacked);
   tilingData.set_isHF32(rnnParams.isHF32);
 
   tilingData.set_isCached(rnnParams.isCached);
@@ -326,7 +357,31 @@ bool DynamicRNNV2Tiling::CheckAttrOps(gert::TilingContext* context) {
   const bool* usePeephole = attrs->GetAttrPointer<bool>(3);
   const float* keepProb = attrs->GetAttrPointer<float>(4);
   const float* cellClip = attrs->GetAttrPointer<float>(5);
-  std::vector<std::string> supportDirection = {"UNIDIRECTIONAL", "REDIRECTIONAL"};
+  std::vector<std::string> supportCellType = {"LSTM", "GRU"};
+  const char* mergeMode = attrs->GetAttrPointer<char>(13);
+  std::vector<std::string> supportDirection = {"UNIDIRECTIONAL", "REDIRECTIONAL", "BIDIRECTIONAL"};
+  OP_TILING_CHECK(
+      std::find(supportCellType.begin(), supportCellType.end(), std::string(cellType)) == supportCellType.end(),
+      VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(), "cell_type only support LSTM and GRU, please check."),
+      return false);
+  OP_TILING_CHECK(
+      std::find(supportDirection.begin(), supportDirection.end(), std::string(direction)) == supportDirection.end(),
+      VECTOR_INNER_ERR_REPORT_TILIING(
+          context->GetNodeName(),
+          "direction only support UNIDIRECTIONAL, REDIRECTIONAL and BIDIRECTIONAL, please check."),
+      return false);
+  // 双向只在GRU kernel内实现，两个方向的y按最后一维拼接
+  bool isBidirection = strcmp(direction, "BIDIRECTIONAL") == 0;
+  OP_TILING_CHECK(
+      isBidirection && strcmp(cellType, "GRU") != 0,
+      VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(),
+                                      "BIDIRECTIONAL only support cell_type GRU, please check."),
+      return false);
+  OP_TILING_CHECK(
+      isBidirection && strcmp(mergeMode, "concat") != 0,
+      VECTOR_INNER_ERR_REPORT_TILIING(context->GetNodeName(),
+                                      "BIDIRECTIONAL only support merge_mode concat, please check."),
+      return false);
   return true;
 }
 
@@ -371,7 +426,8 @@ ge::graphStatus DynamicRNNV2Tiling::GetOpInfo(const gert::TilingContext* context
   rnnParams.timeStep = static_cast<int64_t>(xShape.GetDim(0));
   rnnParams.batch = static_cast<int64_t>(xShape.GetDim(1));
   rnnParams.inputSize = static_cast<int64_t>(xShape.GetDim(dim));
-  rnnParams.hiddenSize = static_cast<int64_t>(weightHiddenShape.GetDim(0));
+  // 双向时weight_hidden为[2, H, 3H]
+  rnnParams.hiddenSize = static_cast<int64_t>(weightHiddenShape.GetDim(weightHiddenShape.GetDimNum() - dim));
 
   return ge::GRAPH_SUCCESS;
 }
@@ -380,16 +436,34 @@ ge::graphStatus DynamicRNNV2Tiling::GetAttr(const gert::TilingContext* context,
   // get attr
   auto attrs = context->GetAttrs();
 
-  // get gate_order
+  // get cell_type
+  const char* cellType = attrs->GetAttrPointer<char>(0);
+  if (strcmp(cellType, "GRU") == 0) {
+    rnnParams.cellType = static_cast<int64_t>(RNNCellType::GRU);
+  } else {
+    rnnParams.cellType = static_cast<int64_t>(RNNCellType::LSTM);
+  }
+
+  // get gate_order, GRU: rzh(default) / zrh
   const char* gateOrder = attrs->GetAttrPointer<char>(11);
-  if (strcmp(gateOrder, "ijfo") == 0) {
+  if (rnnParams.cellType == static_cast<int64_t>(RNNCellType::GRU)) {
+    rnnParams.gateOrder = strcmp(gateOrder, "zrh") == 0 ? static_cast<int64_t>(GruGateOrder::ZRH) :
+                                                          static_cast<int64_t>(GruGateOrder::RZH);
+  } else if (strcmp(gateOrder, "ijfo") == 0) {
     rnnParams.gateOrder = static_cast<int64_t>(GateOrder::IJFO);
   } else {
     rnnParams.gateOrder = static_cast<int64_t>(GateOrder::IFJO);
   }
 
-  // set direction
-  rnnParams.direction = 0;
+  // get direction, REDIRECTIONAL runs the sequence from the last timestep, BIDIRECTIONAL runs both in one launch
+  const char* direction = attrs->GetAttrPointer<char>(1);
+  if (strcmp(direction, "BIDIRECTIONAL") == 0) {
+    rnnParams.direction = static_cast<int64_t>(RNNDirection::BIDIRECTIONAL);
+  } else if (strcmp(direction, "REDIRECTIONAL") == 0) {
+    rnnParams.direction = static_cast<int64_t>(RNNDirection::REDIRECTIONAL);
+  } else {
+    rnnParams.direction = static_cast<int64_t>(RNNDirection::UNIDIRECTIONAL);
+  }
 
   // get cell_clip
   const float* cellClip = attrs->GetAttrPointer<float>(5);
@@ -506,16 +580,21 @@ namespace ge {
 
     int64_t num_step = x_shape->GetDim(0);
     int64_t batch_size = x_shape->GetDim(1);
-    int64_t hidden_size = weight_hidden_shape->GetDim(0);
-
-    *y_shape = {num_step, batch_size, hidden_size};
-    *outputh_shape = {1, batch_size, hidden_size};
-    *outputc_shape = {1, batch_size, hidden_size};
-    *i_shape = {num_step, batch_size, hidden_size};
-    *j_shape = {num_step, batch_size, hidden_size};
-    *f_shape = {num_step, batch_size, hidden_size};
-    *o_shape = {num_step, batch_size, hidden_size};
-    *tanhc_shape = {num_step, batch_size, hidden_size};
+    int64_t hidden_size = weight_hidden_shape->GetDim(weight_hidden_shape->GetDimNum() - CONSTANT_TWO);
+
+    // 双向时y与门输出按[T, B, 2H]拼接，output_h/output_c为两个方向的最终状态[2, B, H]
+    const char* direction = context->GetAttrs()->GetAttrPointer<char>(1);
+    int64_t num_direction = strcmp(direction, "BIDIRECTIONAL") == 0 ? CONSTANT_TWO : CONSTANT_ONE;
+    int64_t out_size = num_direction * hidden_size;
+
+    *y_shape = {num_step, batch_size, out_size};
+    *outputh_shape = {num_direction, batch_size, hidden_size};
+    *outputc_shape = {num_direction, batch_size, hidden_size};
+    *i_shape = {num_step, batch_size, out_size};
+    *j_shape = {num_step, batch_size, out_size};
+    *f_shape = {num_step, batch_size, out_size};
+    *o_shape = {num_step, batch_size, out_size};
+    *tanhc_shape = {num_step, batch_size, out_size};
 
     return GRAPH_SUCCESS;
   }
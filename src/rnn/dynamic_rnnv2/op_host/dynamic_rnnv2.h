@@ -55,11 +55,33 @@ enum class GateOrder : int64_t {
   IFJO
 };
 
+enum class GruGateOrder : int64_t {
+  RZH,
+  ZRH
+};
+
+enum class RNNCellType : int64_t {
+  LSTM,
+  GRU
+};
+
+enum class RNNDirection : int64_t {
+  UNIDIRECTIONAL,
+  REDIRECTIONAL,
+  BIDIRECTIONAL
+};
+
+constexpr int64_t LSTM_GATE_NUM = 4;
+constexpr int64_t GRU_GATE_NUM = 3;
+constexpr int64_t PACKED_ALIGN_BYTES = 32;
+
 enum class RNNTilingKey : int64_t {
   MM_FP16_SPLIT = 10000001,
   MM_FP32_SPLIT,
   MM_HF32_SPLIT,
-  MM_BF16_SPLIT
+  MM_BF16_SPLIT,
+  GRU_FP16_SPLIT = 10000021,
+  GRU_FP32_SPLIT
 };
 
 struct DynamicRnnTiling {
@@ -79,6 +101,7 @@ struct DynamicRnnTiling {
   int64_t isBias;
   int64_t isInithc;
   int64_t isSeqLength;
+  int64_t isPacked;
   int64_t isHF32;
 
   // cache
@@ -86,6 +109,7 @@ struct DynamicRnnTiling {
   int64_t cacheLength;
 
   // rnn attr
+  int64_t cellType;
   int64_t gateOrder;
   int64_t direction;
   int64_t isTraining;
@@ -122,6 +146,7 @@ TILING_DATA_FIELD_DEF(int64_t, hiddenSize);
 TILING_DATA_FIELD_DEF(int64_t, isBias);
 TILING_DATA_FIELD_DEF(int64_t, isInithc);
 TILING_DATA_FIELD_DEF(int64_t, isSeqLength);
+TILING_DATA_FIELD_DEF(int64_t, isPacked);
 TILING_DATA_FIELD_DEF(int64_t, isHF32);
 
 // cache
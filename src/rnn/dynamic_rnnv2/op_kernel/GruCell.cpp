@@ -0,0 +1,615 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file GruCell.cpp
+ * \brief
+ */
+#include "GruCell.h"
+
+using namespace AscendC;
+
+template <typename T>
+__aicore__ inline int64_t GruMmSplitND<T>::Ceil(int64_t x, int64_t y) {
+  if (y == 0) {
+    return x;
+  }
+  return (x + y - 1) / y;
+}
+
+template <typename T>
+__aicore__ inline void GruMmSplitND<T>::Init(GM_ADDR inputX, GM_ADDR weightInput, GM_ADDR weightHidden, GM_ADDR bias,
+                                             GM_ADDR seqLength, GM_ADDR initH, GM_ADDR outputY, GM_ADDR outputH,
+                                             GM_ADDR outputUpdate, GM_ADDR outputReset, GM_ADDR outputNew,
+                                             GM_ADDR outputHiddenNew, const DynamicRNNTilingData* __restrict rnnTiling,
+                                             GM_ADDR workspace) {
+  tiling = rnnTiling;
+  inputMMTiling = tiling->inputMMParam;
+  hiddenMMTiling = tiling->hiddenMMParam;
+  InitBuffers(inputX, weightInput, weightHidden, bias, seqLength, initH, outputY, outputH, outputUpdate, outputReset,
+              outputNew, outputHiddenNew, workspace);
+  InitVars();
+  InitQue();
+  InitPacked(seqLength, workspace);
+}
+
+template <typename T>
+__aicore__ inline void GruMmSplitND<T>::InitQue() {
+  pipe.InitBuffer(qidHIn, 1, baseVector * sizeof(T));
+  pipe.InitBuffer(qidGiIn, 1, baseVector * sizeof(float));
+  pipe.InitBuffer(qidGhIn, 1, baseVector * sizeof(float));
+  pipe.InitBuffer(qidVecOut, 1, baseVector * sizeof(T));
+  pipe.InitBuffer(calcBuf, 4 * baseVector * sizeof(float));
+  ubLocal1 = calcBuf.Get<float>(4 * baseVector);
+  ubLocal2 = ubLocal1[baseVector];
+  ubLocal3 = ubLocal2[baseVector];
+  ubLocal4 = ubLocal3[baseVector];
+}
+
+template <typename T>
+__aicore__ inline void GruMmSplitND<T>::GetCoreIndex(TCubeTiling& param, tailSize& mmTail, int32_t kSize) {
+  auto temp0 = Ceil(param.M, param.singleCoreM);
+  auto temp2 = Ceil(kSize, param.singleCoreK);  // 不切K, 应该=1
+  if (temp0 == 0) {
+    temp0 = 1;
+  }
+  if (temp2 == 0) {
+    temp2 = 1;
+  }
+  auto divideKcoreNum = param.usedCoreNum / temp2;
+  mmTail.mCoreIndx = (GetBlockIdx() % divideKcoreNum) % temp0;
+  mmTail.nCoreIndx = (GetBlockIdx() % divideKcoreNum) / temp0;
+}
+
+template <typename T>
+__aicore__ inline void GruMmSplitND<T>::CalcGMOffset(TCubeTiling& param, TRnnOffsets& offset, tailSize& mmTail,
+                                                     int32_t kSize) {
+  GetCoreIndex(param, mmTail, kSize);
+  offset.AOffset = mmTail.mCoreIndx * kSize * param.singleCoreM;
+  offset.BOffset = mmTail.nCoreIndx * param.singleCoreN;
+  offset.BiasOffset = mmTail.nCoreIndx * param.singleCoreN;
+
+  mmTail.nCoreLoop = Ceil(param.N, param.singleCoreN);
+  mmTail.tailSingleCoreN = param.N - (mmTail.nCoreLoop - 1) * param.singleCoreN;
+  mmTail.notTailNCoreCount = mmTail.nCoreLoop - 1;
+  mmTail.mCoreLoop = Ceil(param.M, param.singleCoreM);
+  mmTail.tailSingleCoreM = param.M - (mmTail.mCoreLoop - 1) * param.singleCoreM;
+  mmTail.notTailMCoreCount = mmTail.mCoreLoop - 1;
+
+  offset.COffset = mmTail.mCoreIndx * param.N * param.singleCoreM + mmTail.nCoreIndx * param.singleCoreN;
+}
+
+template <typename T>
+__aicore__ inline void GruMmSplitND<T>::InitBuffers(GM_ADDR inputX, GM_ADDR weightInput, GM_ADDR weightHidden,
+                                                    GM_ADDR bias, GM_ADDR seqLength, GM_ADDR initH, GM_ADDR outputY,
+                                                    GM_ADDR outputH, GM_ADDR outputUpdate, GM_ADDR outputReset,
+                                                    GM_ADDR outputNew, GM_ADDR outputHiddenNew, GM_ADDR workspace) {
+  CalcGMOffset(hiddenMMTiling, hiddenOffsets, hiddenTail, static_cast<int32_t>(tiling->hiddenSize));
+  CalcGMOffset(inputMMTiling, inputOffsets, inputTail, static_cast<int32_t>(tiling->inputSize));
+  oneCellSize = tiling->batch * tiling->hiddenSize;
+  allCellSize = oneCellSize * GRU_GATE_SIZE;
+  // 双向时权重、bias、init_h按[2, ...]叠放，y与门输出按[T, B, 2H]拼接
+  dirNum = tiling->direction == GRU_BIDIRECTION ? GRU_BIDIRECTION : 1;
+  outRowLen = dirNum * tiling->hiddenSize;
+
+  inputGm.xGm.SetGlobalBuffer(reinterpret_cast<__gm__ T*>(inputX),
+                              tiling->timeStep * tiling->batch * tiling->inputSize);
+  inputGm.weightInputGm.SetGlobalBuffer(reinterpret_cast<__gm__ T*>(weightInput),
+                                        dirNum * tiling->inputSize * GRU_GATE_SIZE * tiling->hiddenSize);
+  inputGm.weightHiddenGm.SetGlobalBuffer(reinterpret_cast<__gm__ T*>(weightHidden),
+                                         dirNum * tiling->hiddenSize * GRU_GATE_SIZE * tiling->hiddenSize);
+  if (tiling->isBias == 1) {
+    // b = [b_input(3H), b_hidden(3H)]
+    inputGm.biasGm.SetGlobalBuffer(reinterpret_cast<__gm__ T*>(bias),
+                                   dirNum * 2 * GRU_GATE_SIZE * tiling->hiddenSize);
+  }
+  if (tiling->isSeqLength != 0) {
+    inputGm.seqLengthGm.SetGlobalBuffer(reinterpret_cast<__gm__ T*>(seqLength),
+                                        tiling->timeStep * tiling->batch * tiling->hiddenSize);
+  }
+  if (tiling->isInithc != 0) {
+    inputGm.initHInGm.SetGlobalBuffer(reinterpret_cast<__gm__ T*>(initH), dirNum * oneCellSize);
+  }
+  outputGm.outYGm.SetGlobalBuffer(reinterpret_cast<__gm__ T*>(outputY), tiling->timeStep * tiling->batch * outRowLen);
+  if (tiling->isTraining == 1) {
+    outputGm.outUpdateGm.SetGlobalBuffer(reinterpret_cast<__gm__ T*>(outputUpdate),
+                                         tiling->timeStep * tiling->batch * outRowLen);
+    outputGm.outResetGm.SetGlobalBuffer(reinterpret_cast<__gm__ T*>(outputReset),
+                                        tiling->timeStep * tiling->batch * outRowLen);
+    outputGm.outNewGm.SetGlobalBuffer(reinterpret_cast<__gm__ T*>(outputNew),
+                                      tiling->timeStep * tiling->batch * outRowLen);
+    outputGm.outHiddenNewGm.SetGlobalBuffer(reinterpret_cast<__gm__ T*>(outputHiddenNew),
+                                            tiling->timeStep * tiling->batch * outRowLen);
+  }
+
+  // workspace: gi[T, B, 3H] | gh[B, 3H] | zero init_h[B, H] | 双向时的逐步h[T, B, H]，两个方向依次复用
+  outputGm.giGm.SetGlobalBuffer(reinterpret_cast<__gm__ float*>(workspace), tiling->timeStep * allCellSize);
+  outputGm.ghGm.SetGlobalBuffer(reinterpret_cast<__gm__ float*>(workspace) + tiling->timeStep * allCellSize,
+                                allCellSize);
+  outputGm.zeroHGm.SetGlobalBuffer(
+      reinterpret_cast<__gm__ T*>(reinterpret_cast<__gm__ float*>(workspace) + (tiling->timeStep + 1) * allCellSize),
+      oneCellSize);
+  if (dirNum == GRU_BIDIRECTION) {
+    // hidden matmul要求h_{t-1}连续，逐步的h留在workspace，output_h只写两个方向的最终状态[2, B, H]
+    outputGm.outHGm.SetGlobalBuffer(
+        reinterpret_cast<__gm__ T*>(reinterpret_cast<__gm__ float*>(workspace) +
+                                    (tiling->timeStep + 1) * allCellSize + oneCellSize),
+        tiling->timeStep * oneCellSize);
+    outputGm.finalHGm.SetGlobalBuffer(reinterpret_cast<__gm__ T*>(outputH), dirNum * oneCellSize);
+  } else {
+    outputGm.outHGm.SetGlobalBuffer(reinterpret_cast<__gm__ T*>(outputH), tiling->timeStep * oneCellSize);
+  }
+}
+
+template <typename T>
+__aicore__ inline void GruMmSplitND<T>::InitVars() {
+  int64_t ubSize = 21504; // same node budget as LstmMmSplitNDNDFP16::InitVars
+  int64_t calcMaxSize = ubSize / sizeof(float);
+  int64_t blockN = tiling->usedCoreNum;
+  blockSize = 32 / sizeof(T);
+  calBlockSize = 32 / sizeof(float);
+  vectorCoreM = Ceil(tiling->batch, blockN);
+  vectorCoreNum = Ceil(tiling->batch, vectorCoreM);
+  vectorTailM = tiling->batch % vectorCoreM ? tiling->batch % vectorCoreM : vectorCoreM;
+
+  vectorSplitN = Ceil(tiling->hiddenSize, calcMaxSize);
+  if (vectorSplitN == 1) {
+    vectorBaseN = tiling->hiddenSize;
+    vectorTailN = 0;
+  } else {
+    vectorBaseN = Ceil(Ceil(tiling->hiddenSize, vectorSplitN), blockSize) * blockSize;
+    vectorTailN = tiling->hiddenSize - vectorBaseN * (vectorSplitN - 1);
+  }
+
+  int64_t alignBaseN = Ceil(vectorBaseN, blockSize) * blockSize;
+  vectorBaseM = ((calcMaxSize / alignBaseN) > vectorCoreM) ? vectorCoreM : (calcMaxSize / alignBaseN);
+
+  vectorBaseTailM = vectorCoreM % vectorBaseM;
+  vectorTailTailM = vectorTailM % vectorBaseM;
+
+  vectorSplitM = Ceil(vectorCoreM, vectorBaseM);
+  vectorTailSplitM = Ceil(vectorTailM, vectorBaseM);
+
+  baseVector = vectorBaseM * alignBaseN;
+
+  rOffset = tiling->gateOrder == 0 ? 0 : tiling->hiddenSize;
+  zOffset = tiling->gateOrder == 0 ? tiling->hiddenSize : 0;
+  nOffset = 2 * tiling->hiddenSize;
+  activeBatch = tiling->batch;
+  dirIdx = 0;
+  isReverse = tiling->direction == 1;
+}
+
+template <typename T>
+__aicore__ inline void GruMmSplitND<T>::ProcessInputMM() {
+  if (GetBlockIdx() < inputMMTiling.usedCoreNum) {
+    inputMM.SetTensorA(inputGm.xGm[inputOffsets.AOffset]);
+    inputMM.SetTensorB(
+        inputGm.weightInputGm[dirIdx * tiling->inputSize * GRU_GATE_SIZE * tiling->hiddenSize + inputOffsets.BOffset]);
+    if (tiling->isBias == 1) {
+      inputMM.SetBias(inputGm.biasGm[dirIdx * 2 * GRU_GATE_SIZE * tiling->hiddenSize + inputOffsets.BiasOffset]);
+    }
+    SetMMTail(inputTail, inputMMTiling, true);
+    inputMM.IterateAll(outputGm.giGm[inputOffsets.COffset], false);
+  }
+}
+
+template <typename T>
+__aicore__ inline void GruMmSplitND<T>::SetMMTail(tailSize& mmTail, TCubeTiling& param, bool isInput) {
+  int64_t tailM = param.singleCoreM;
+  int64_t tailN = param.singleCoreN;
+  if (mmTail.nCoreIndx == mmTail.notTailNCoreCount) {
+    tailN = mmTail.tailSingleCoreN;
+  }
+  if (mmTail.mCoreIndx == mmTail.notTailMCoreCount) {
+    tailM = mmTail.tailSingleCoreM;
+  }
+  if (tailM == param.singleCoreM && tailN == param.singleCoreN) {
+    return;
+  }
+  if (isInput) {
+    inputMM.SetTail(tailM, tailN);
+  } else {
+    hiddenMM.SetTail(tailM, tailN);
+  }
+}
+
+template <typename T>
+__aicore__ inline void GruMmSplitND<T>::ProcessHiddenMM() {
+  if (GetBlockIdx() < hiddenMMTiling.usedCoreNum) {
+    // gh每步整体覆盖，不与gi累加
+    if (tiling->isPacked == 1 && !SetPackedHiddenTail()) {
+      return;
+    }
+    hiddenMM.SetTensorA(inputGm.initHGm[hiddenOffsets.AOffset]);
+    hiddenMM.IterateAll(outputGm.ghGm[hiddenOffsets.COffset], false);
+  }
+}
+
+template <typename T>
+__aicore__ inline void GruMmSplitND<T>::CalcVecScaler(int64_t tIdx, int64_t mIdx, int64_t nIdx, int64_t& gateOffset,
+                                                      int64_t& hOffset, int64_t& offset, int64_t& yOffset) {
+  int64_t blockIdx = GetBlockIdx();
+  if ((vectorTailN > 0) && (nIdx == vectorSplitN - 1)) {
+    calcN = vectorTailN;
+  } else {
+    calcN = vectorBaseN;
+  }
+
+  calcM = vectorBaseM;
+  if ((blockIdx < vectorCoreNum - 1) && (vectorBaseTailM > 0) && (mIdx == vectorSplitM - 1)) {
+    calcM = vectorBaseTailM;
+  }
+  if ((blockIdx == vectorCoreNum - 1) && (vectorTailTailM > 0) && (mIdx == vectorTailSplitM - 1)) {
+    calcM = vectorTailTailM;
+  }
+  if (tiling->isPacked == 1) {
+    int64_t rowStart = blockIdx * vectorCoreM + mIdx * vectorBaseM;
+    calcM = activeBatch - rowStart < calcM ? activeBatch - rowStart : calcM;
+  }
+  calcSizeAlign = calcM * Ceil(calcN, blockSize) * blockSize;
+
+  int64_t rowIdx = blockIdx * vectorCoreM + mIdx * vectorBaseM;
+  gateOffset = rowIdx * tiling->hiddenSize * GRU_GATE_SIZE + nIdx * vectorBaseN;
+  hOffset = rowIdx * tiling->hiddenSize + nIdx * vectorBaseN;
+  int64_t slot = isReverse ? tiling->timeStep - 1 - tIdx : tIdx;
+  offset = slot * oneCellSize + hOffset;
+  yOffset = (slot * tiling->batch + rowIdx) * outRowLen + dirIdx * tiling->hiddenSize + nIdx * vectorBaseN;
+}
+
+template <typename T>
+__aicore__ inline void GruMmSplitND<T>::CopyInGate(TQue<QuePosition::VECIN, 1>& que, GlobalTensor<float>& mixGm,
+                                                   int64_t offset) {
+  int64_t alignN = Ceil(calcN, blockSize) * blockSize;
+  int64_t alignFloatN = Ceil(calcN, calBlockSize) * calBlockSize;
+  DataCopyExtParams dataCopyParams;
+  dataCopyParams.blockCount = calcM;
+  dataCopyParams.blockLen = calcN * sizeof(float);
+  dataCopyParams.srcStride = (GRU_GATE_SIZE * tiling->hiddenSize - calcN) * sizeof(float);
+  dataCopyParams.dstStride = (alignN - alignFloatN) / calBlockSize;
+
+  DataCopyPadExtParams<float> padParams{false, 0, static_cast<uint8_t>(alignFloatN - calcN), 0};
+
+  LocalTensor<float> dstUb = que.AllocTensor<float>();
+  DataCopyPad(dstUb, mixGm[offset], dataCopyParams, padParams);
+  que.EnQue(dstUb);
+}
+
+template <typename T>
+__aicore__ inline void GruMmSplitND<T>::CopyInH(LocalTensor<float>& dstUb, GlobalTensor<T>& mixGm, int64_t offset) {
+  DataCopyExtParams dataCopyParams;
+  dataCopyParams.blockCount = calcM;
+  dataCopyParams.blockLen = calcN * sizeof(T);
+  dataCopyParams.srcStride = (tiling->hiddenSize - calcN) * sizeof(T);
+  dataCopyParams.dstStride = 0;
+
+  DataCopyPadExtParams<T> padParams{false, 0, static_cast<uint8_t>(Ceil(calcN, blockSize) * blockSize - calcN), 0};
+
+  LocalTensor<T> ubLocalIn = qidHIn.AllocTensor<T>();
+  DataCopyPad(ubLocalIn, mixGm[offset], dataCopyParams, padParams);
+  qidHIn.EnQue(ubLocalIn);
+  ubLocalIn = qidHIn.DeQue<T>();
+  if constexpr (IsSameType<T, float>::value) {
+    DataCopy(dstUb, ubLocalIn, calcSizeAlign);
+  } else {
+    Cast(dstUb, ubLocalIn, RoundMode::CAST_NONE, calcSizeAlign);
+  }
+  qidHIn.FreeTensor(ubLocalIn);
+}
+
+template <typename T>
+__aicore__ inline void GruMmSplitND<T>::CopyOutput(GlobalTensor<T>& gm, LocalTensor<float>& ub, int64_t offset,
+                                                   int64_t rowLen) {
+  auto outLocal = qidVecOut.AllocTensor<T>();
+  PipeBarrier<PIPE_V>();
+  if constexpr (IsSameType<T, float>::value) {
+    DataCopy(outLocal, ub, calcSizeAlign);
+  } else {
+    Cast(outLocal, ub, RoundMode::CAST_ROUND, calcSizeAlign);
+  }
+  qidVecOut.EnQue(outLocal);
+  outLocal = qidVecOut.DeQue<T>();
+
+  DataCopyExtParams dataCopyParams;
+  dataCopyParams.blockCount = calcM;
+  dataCopyParams.blockLen = calcN * sizeof(T);
+  dataCopyParams.srcStride = 0;
+  dataCopyParams.dstStride = (rowLen - calcN) * sizeof(T);
+  DataCopyPad(gm[offset], outLocal, dataCopyParams);
+
+  qidVecOut.FreeTensor(outLocal);
+}
+
+template <typename T>
+__aicore__ inline void GruMmSplitND<T>::CalGateSigmoid(LocalTensor<float>& dst, GlobalTensor<T>& outGm,
+                                                       int64_t offset) {
+  // dst = sigmoid(gi + gh)
+  auto giLocal = qidGiIn.DeQue<float>();
+  auto ghLocal = qidGhIn.DeQue<float>();
+  Add(ubLocal4, giLocal, ghLocal, calcSizeAlign);
+  qidGiIn.FreeTensor(giLocal);
+  qidGhIn.FreeTensor(ghLocal);
+  PipeBarrier<PIPE_V>();
+  Sigmoid(dst, ubLocal4, calcSizeAlign);
+
+  if (tiling->isTraining == 1) {
+    CopyOutput(outGm, dst, offset, outRowLen);
+  }
+}
+
+template <typename T>
+__aicore__ inline void GruMmSplitND<T>::CalNewTanh(LocalTensor<float>& dst, LocalTensor<float>& rGate,
+                                                   int64_t offset) {
+  // dst = tanh(gi_n + r * gh_n)，gh_n即hidden_new
+  auto giLocal = qidGiIn.DeQue<float>();
+  auto ghLocal = qidGhIn.DeQue<float>();
+  if (tiling->isTraining == 1) {
+    CopyOutput(outputGm.outHiddenNewGm, ghLocal, offset, outRowLen);
+  }
+  PipeBarrier<PIPE_V>();
+  Mul(ubLocal4, rGate, ghLocal, calcSizeAlign);
+  PipeBarrier<PIPE_V>();
+  Add(ubLocal4, ubLocal4, giLocal, calcSizeAlign);
+  qidGiIn.FreeTensor(giLocal);
+  qidGhIn.FreeTensor(ghLocal);
+  PipeBarrier<PIPE_V>();
+  Tanh(dst, ubLocal4, calcSizeAlign);
+
+  if (tiling->isTraining == 1) {
+    CopyOutput(outputGm.outNewGm, dst, offset, outRowLen);
+  }
+}
+
+template <typename T>
+__aicore__ inline void GruMmSplitND<T>::CopyOutYH(LocalTensor<float>& updateH, int64_t offset, int64_t hOffset,
+                                                  int64_t yOffset) {
+  if (tiling->isSeqLength == 1) {
+    auto updateY = ubLocal4;
+    auto seqLength = ubLocal2;
+    auto initH = ubLocal3;
+    CopyInH(seqLength, inputGm.seqLengthGm, offset);
+    CopyInH(initH, inputGm.initHGm, hOffset);
+    PipeBarrier<PIPE_V>();
+    Mul(updateY, updateH, seqLength, calcSizeAlign);
+    Sub(updateH, updateH, initH, calcSizeAlign);
+    PipeBarrier<PIPE_V>();
+    Mul(updateH, updateH, seqLength, calcSizeAlign);
+    PipeBarrier<PIPE_V>();
+    Add(updateH, updateH, initH, calcSizeAlign);
+    CopyOutput(outputGm.outYGm, updateY, yOffset, outRowLen);
+    CopyOutput(outputGm.outHGm, updateH, offset, tiling->hiddenSize);
+  } else {
+    LocalTensor<T> outLocal = qidVecOut.AllocTensor<T>();
+    PipeBarrier<PIPE_V>();
+    if constexpr (IsSameType<T, float>::value) {
+      DataCopy(outLocal, updateH, calcSizeAlign);
+    } else {
+      Cast(outLocal, updateH, RoundMode::CAST_ROUND, calcSizeAlign);
+    }
+    qidVecOut.EnQue(outLocal);
+    outLocal = qidVecOut.DeQue<T>();
+
+    DataCopyExtParams dataCopyParams;
+    dataCopyParams.blockCount = calcM;
+    dataCopyParams.blockLen = calcN * sizeof(T);
+    dataCopyParams.srcStride = 0;
+    dataCopyParams.dstStride = (tiling->hiddenSize - calcN) * sizeof(T);
+    DataCopyPad(outputGm.outHGm[offset], outLocal, dataCopyParams);
+    dataCopyParams.dstStride = (outRowLen - calcN) * sizeof(T);
+    DataCopyPad(outputGm.outYGm[yOffset], outLocal, dataCopyParams);
+
+    qidVecOut.FreeTensor(outLocal);
+  }
+}
+
+template <typename T>
+__aicore__ inline void GruMmSplitND<T>::ProcessVectorOnce(int64_t tIdx, int64_t mIdx, int64_t nIdx) {
+  int64_t gateOffset, hOffset, offset = 0, yOffset = 0;
+  CalcVecScaler(tIdx, mIdx, nIdx, gateOffset, hOffset, offset, yOffset);
+
+  int64_t cellOffset = isReverse ? (tiling->timeStep - 1 - tIdx) * allCellSize : tIdx * allCellSize;
+  auto giGm = outputGm.giGm[cellOffset];
+  auto rGate = ubLocal1;
+  auto zGate = ubLocal2;
+  auto nGate = ubLocal3;
+  auto hPrev = ubLocal4;
+  auto updateH = ubLocal1;
+  /*
+      gi_r+gh_r      gi_z+gh_z      gi_n     gh_n        h
+          |              |            |        |          |
+      1.sigmoid      2.sigmoid        |   3.mul(r)        |
+          |              |            ----4.add---        |
+          r              z                 |              |
+                         |              5.tanh            |
+                         |                 n---6.sub------
+                         |                 |      |
+                         ------7.mul-------|------
+                                  |        |
+                                  --8.add--
+                                      |
+                                   h' = n + z * (h - n)
+  */
+  CopyInGate(qidGiIn, giGm, rOffset + gateOffset);
+  CopyInGate(qidGhIn, outputGm.ghGm, rOffset + gateOffset);
+  CalGateSigmoid(rGate, outputGm.outResetGm, yOffset);
+
+  CopyInGate(qidGiIn, giGm, zOffset + gateOffset);
+  CopyInGate(qidGhIn, outputGm.ghGm, zOffset + gateOffset);
+  CalGateSigmoid(zGate, outputGm.outUpdateGm, yOffset);
+
+  CopyInGate(qidGiIn, giGm, nOffset + gateOffset);
+  CopyInGate(qidGhIn, outputGm.ghGm, nOffset + gateOffset);
+  CalNewTanh(nGate, rGate, yOffset);
+
+  CopyInH(hPrev, inputGm.initHGm, hOffset);
+  PipeBarrier<PIPE_V>();
+  Sub(hPrev, hPrev, nGate, calcSizeAlign);
+  PipeBarrier<PIPE_V>();
+  Mul(hPrev, hPrev, zGate, calcSizeAlign);
+  PipeBarrier<PIPE_V>();
+  Add(updateH, nGate, hPrev, calcSizeAlign);
+
+  CopyOutYH(updateH, offset, hOffset, yOffset);
+}
+
+template <typename T>
+__aicore__ inline void GruMmSplitND<T>::ProcessVector(int64_t tIdx) {
+  auto mCoreIndex = GetBlockIdx();
+  if (mCoreIndex < vectorCoreNum) {
+    auto coreLoopM = vectorSplitM;
+    if (mCoreIndex == vectorCoreNum - 1) {
+      coreLoopM = vectorTailSplitM;
+    }
+    for (int64_t j = 0; j < coreLoopM; ++j) {
+      if (tiling->isPacked == 1 && mCoreIndex * vectorCoreM + j * vectorBaseM >= activeBatch) {
+        break;
+      }
+      for (int64_t k = 0; k < vectorSplitN; ++k) {
+        ProcessVectorOnce(tIdx, j, k);
+      }
+    }
+    if (tiling->isPacked == 1) {
+      ProcessFinishedRows(tIdx);
+    }
+  }
+}
+
+template <typename T>
+__aicore__ inline void GruMmSplitND<T>::InitPacked(GM_ADDR seqLength, GM_ADDR workspace) {
+  if (tiling->isPacked == 0) {
+    return;
+  }
+  // batchSizes[T]放在zero init_h（双向时为逐步h）之后
+  int64_t histSize = dirNum == GRU_BIDIRECTION ? tiling->timeStep * oneCellSize : 0;
+  batchSizesGm.SetGlobalBuffer(
+      reinterpret_cast<__gm__ int32_t*>(reinterpret_cast<__gm__ float*>(workspace) +
+                                        (tiling->timeStep + 1) * allCellSize + oneCellSize + histSize),
+      tiling->timeStep);
+  if (GetBlockIdx() == 0) {
+    CalcPackedBatchSizes<T>(seqLength, batchSizesGm, tiling->timeStep, tiling->batch, tiling->hiddenSize);
+  }
+}
+
+template <typename T>
+__aicore__ inline void GruMmSplitND<T>::UpdateActiveBatch(int64_t tIdx) {
+  if (tiling->isPacked == 0) {
+    return;
+  }
+  int64_t slot = isReverse ? tiling->timeStep - 1 - tIdx : tIdx;
+  DataCacheCleanAndInvalid<int32_t, CacheLine::SINGLE_CACHE_LINE>(batchSizesGm[slot]);
+  activeBatch = batchSizesGm.GetValue(slot);
+}
+
+template <typename T>
+__aicore__ inline bool GruMmSplitND<T>::SetPackedHiddenTail() {
+  int64_t mStart = hiddenTail.mCoreIndx * hiddenMMTiling.singleCoreM;
+  int64_t curM = hiddenTail.mCoreIndx == hiddenTail.notTailMCoreCount ? hiddenTail.tailSingleCoreM :
+                                                                        hiddenMMTiling.singleCoreM;
+  int64_t curN = hiddenTail.nCoreIndx == hiddenTail.notTailNCoreCount ? hiddenTail.tailSingleCoreN :
+                                                                        hiddenMMTiling.singleCoreN;
+  curM = activeBatch - mStart < curM ? activeBatch - mStart : curM;
+  if (curM <= 0) {
+    return false;
+  }
+  hiddenMM.SetTail(curM, curN);
+  return true;
+}
+
+template <typename T>
+__aicore__ inline void GruMmSplitND<T>::ProcessFinishedRows(int64_t tIdx) {
+  // 已结束行等价于seq_length=0：y置0，h沿用上一步
+  int64_t rowStart = GetBlockIdx() * vectorCoreM;
+  int64_t rowEnd = rowStart + (GetBlockIdx() == vectorCoreNum - 1 ? vectorTailM : vectorCoreM);
+  rowStart = rowStart > activeBatch ? rowStart : activeBatch;
+  if (rowStart >= rowEnd) {
+    return;
+  }
+  int64_t slot = isReverse ? tiling->timeStep - 1 - tIdx : tIdx;
+  int64_t offset = slot * oneCellSize + rowStart * tiling->hiddenSize;
+  int64_t count = (rowEnd - rowStart) * tiling->hiddenSize;
+  int64_t ubCount = 4 * baseVector * sizeof(float) / sizeof(T);
+  LocalTensor<T> ubLocal = ubLocal1.ReinterpretCast<T>();
+  if (dirNum == GRU_BIDIRECTION) {
+    // 拼接的y按行跨2H，只清本方向的H列
+    int64_t yOffset = (slot * tiling->batch + rowStart) * outRowLen + dirIdx * tiling->hiddenSize;
+    for (int64_t row = rowStart; row < rowEnd; ++row, yOffset += outRowLen) {
+      ZeroGmByUb(outputGm.outYGm[yOffset], ubLocal, tiling->hiddenSize, ubCount);
+    }
+  } else {
+    ZeroGmByUb(outputGm.outYGm[offset], ubLocal, count, ubCount);
+  }
+  CopyGmByUb(outputGm.outHGm[offset], inputGm.initHGm[rowStart * tiling->hiddenSize], ubLocal, count, ubCount);
+}
+
+template <typename T>
+__aicore__ inline void GruMmSplitND<T>::CopyOutFinalH() {
+  // 正向的最终状态在最后一个时间步，反向在第0步
+  int64_t slot = isReverse ? 0 : tiling->timeStep - 1;
+  int64_t rowStart = GetBlockIdx() * vectorCoreM;
+  int64_t rowNum = GetBlockIdx() == vectorCoreNum - 1 ? vectorTailM : vectorCoreM;
+  int64_t ubCount = 4 * baseVector * sizeof(float) / sizeof(T);
+  LocalTensor<T> ubLocal = ubLocal1.ReinterpretCast<T>();
+  CopyGmByUb(outputGm.finalHGm[dirIdx * oneCellSize + rowStart * tiling->hiddenSize],
+             outputGm.outHGm[slot * oneCellSize + rowStart * tiling->hiddenSize], ubLocal,
+             rowNum * tiling->hiddenSize, ubCount);
+}
+
+template <typename T>
+__aicore__ inline void GruMmSplitND<T>::ProcessDirection() {
+  ProcessInputMM();
+  if (tiling->isInithc == 0) {
+    // 无init_h时用全零的h_{-1}，第0步与其余时间步走同一路径，gh_0 = b_h
+    if (GetBlockIdx() == 0 && dirIdx == 0) {
+      InitGlobalMemory(outputGm.zeroHGm, static_cast<uint64_t>(oneCellSize), static_cast<T>(0));
+    }
+    inputGm.initHGm = outputGm.zeroHGm;
+  } else {
+    inputGm.initHGm = inputGm.initHInGm[dirIdx * oneCellSize];
+  }
+
+  hiddenMM.SetTensorB(
+      inputGm.weightHiddenGm[dirIdx * tiling->hiddenSize * GRU_GATE_SIZE * tiling->hiddenSize + hiddenOffsets.BOffset]);
+  if (tiling->isBias == 1) {
+    hiddenMM.SetBias(inputGm.biasGm[(dirIdx * 2 + 1) * GRU_GATE_SIZE * tiling->hiddenSize + hiddenOffsets.BiasOffset]);
+  }
+  SetMMTail(hiddenTail, hiddenMMTiling, false);
+  SyncAll();
+
+  for (int64_t tIdx = 0; tIdx < tiling->timeStep; tIdx++) {
+    UpdateActiveBatch(tIdx);
+
+    ProcessHiddenMM();
+
+    SyncAll();
+
+    ProcessVector(tIdx);
+
+    if (isReverse) {
+      inputGm.initHGm = outputGm.outHGm[(tiling->timeStep - 1 - tIdx) * oneCellSize];
+    } else {
+      inputGm.initHGm = outputGm.outHGm[tIdx * oneCellSize];
+    }
+    SyncAll();
+  }
+}
+
+template <typename T>
+__aicore__ inline void GruMmSplitND<T>::Process() {
+  for (dirIdx = 0; dirIdx < dirNum; dirIdx++) {
+    if (dirNum == GRU_BIDIRECTION) {
+      isReverse = dirIdx == 1;
+    }
+    // 双向时两个方向共用gi/gh/逐步h的workspace，上一方向的SyncAll之后才能被覆盖
+    ProcessDirection();
+    if (dirNum == GRU_BIDIRECTION && GetBlockIdx() < vectorCoreNum) {
+      CopyOutFinalH();
+    }
+  }
+}
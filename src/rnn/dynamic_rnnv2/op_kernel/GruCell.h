@@ -0,0 +1,174 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file GruCell.h
+ * \brief gru cell (linear-before-reset) for fp16/fp32
+ */
+#ifndef _ASCENDC_GRUCELL_H_
+#define _ASCENDC_GRUCELL_H_
+
+#include "LstmFP16.h"
+
+constexpr int64_t GRU_GATE_SIZE = 3;
+constexpr int64_t GRU_BIDIRECTION = 2;
+
+template <typename T>
+class GruMmSplitND {
+ public:
+  __aicore__ inline GruMmSplitND() = default;
+  __aicore__ inline void Init(GM_ADDR inputX, GM_ADDR weightInput, GM_ADDR weightHidden, GM_ADDR bias,
+                        GM_ADDR seqLength, GM_ADDR initH, GM_ADDR outputY, GM_ADDR outputH,
+                        GM_ADDR outputUpdate, GM_ADDR outputReset, GM_ADDR outputNew, GM_ADDR outputHiddenNew,
+                        const DynamicRNNTilingData* __restrict rnnTiling, GM_ADDR workspace);
+  __aicore__ inline void Process();
+
+ protected:
+  __aicore__ inline void ProcessDirection();
+  __aicore__ inline void CopyOutFinalH();
+  struct tailSize {
+    int64_t tailSingleCoreN;
+    int64_t tailSingleCoreM;
+    int64_t notTailNCoreCount;
+    int64_t notTailMCoreCount;
+    int32_t nCoreLoop;
+    int32_t mCoreLoop;
+    int64_t nCoreIndx;
+    int64_t mCoreIndx;
+  };
+
+  __aicore__ inline void InitBuffers(GM_ADDR inputX, GM_ADDR weightInput, GM_ADDR weightHidden, GM_ADDR bias,
+                                     GM_ADDR seqLength, GM_ADDR initH, GM_ADDR outputY, GM_ADDR outputH,
+                                     GM_ADDR outputUpdate, GM_ADDR outputReset, GM_ADDR outputNew,
+                                     GM_ADDR outputHiddenNew, GM_ADDR workspace);
+  __aicore__ inline void InitVars();
+  __aicore__ inline void InitQue();
+  __aicore__ inline void GetCoreIndex(TCubeTiling& param, tailSize& mmTail, int32_t kSize);
+  __aicore__ inline void CalcGMOffset(TCubeTiling& param, TRnnOffsets& offset, tailSize& mmTail, int32_t kSize);
+  __aicore__ inline void SetMMTail(tailSize& mmTail, TCubeTiling& param, bool isInput);
+  __aicore__ inline void ProcessInputMM();
+  __aicore__ inline void ProcessHiddenMM();
+  __aicore__ inline void ProcessVector(int64_t tIdx);
+  __aicore__ inline void ProcessVectorOnce(int64_t tIdx, int64_t mIdx, int64_t nIdx);
+  __aicore__ inline void CalcVecScaler(int64_t tIdx, int64_t mIdx, int64_t nIdx, int64_t& gateOffset,
+                                       int64_t& hOffset, int64_t& offset, int64_t& yOffset);
+  __aicore__ inline void CopyInGate(AscendC::TQue<AscendC::QuePosition::VECIN, 1>& que,
+                                    AscendC::GlobalTensor<float>& mixGm, int64_t offset);
+  __aicore__ inline void CopyInH(AscendC::LocalTensor<float>& dstUb, AscendC::GlobalTensor<T>& mixGm, int64_t offset);
+  __aicore__ inline void CopyOutput(AscendC::GlobalTensor<T>& gm, AscendC::LocalTensor<float>& ub, int64_t offset,
+                                    int64_t rowLen);
+  __aicore__ inline void CalGateSigmoid(AscendC::LocalTensor<float>& dst, AscendC::GlobalTensor<T>& outGm,
+                                        int64_t offset);
+  __aicore__ inline void CalNewTanh(AscendC::LocalTensor<float>& dst, AscendC::LocalTensor<float>& rGate,
+                                    int64_t offset);
+  __aicore__ inline void CopyOutYH(AscendC::LocalTensor<float>& updateH, int64_t offset, int64_t hOffset,
+                                   int64_t yOffset);
+  __aicore__ inline int64_t Ceil(int64_t x, int64_t y);
+  __aicore__ inline void InitPacked(GM_ADDR seqLength, GM_ADDR workspace);
+  __aicore__ inline void UpdateActiveBatch(int64_t tIdx);
+  __aicore__ inline bool SetPackedHiddenTail();
+  __aicore__ inline void ProcessFinishedRows(int64_t tIdx);
+
+ public:
+  AscendC::TPipe pipe;
+
+  // gi = x * W_i + b_i, all timesteps at once
+  matmul::Matmul<matmul::MatmulType<AscendC::TPosition::GM, CubeFormat::ND, T>,
+                 matmul::MatmulType<AscendC::TPosition::GM, CubeFormat::ND, T>,
+                 matmul::MatmulType<AscendC::TPosition::GM, CubeFormat::ND, float>,
+                 matmul::MatmulType<AscendC::TPosition::GM, CubeFormat::ND, T>, RNN_MM_CFG>
+      inputMM;
+
+  // gh = h * W_h + b_h, kept apart from gi because r only scales the hidden part of n
+  matmul::Matmul<matmul::MatmulType<AscendC::TPosition::GM, CubeFormat::ND, T>,
+                 matmul::MatmulType<AscendC::TPosition::GM, CubeFormat::ND, T>,
+                 matmul::MatmulType<AscendC::TPosition::GM, CubeFormat::ND, float>,
+                 matmul::MatmulType<AscendC::TPosition::GM, CubeFormat::ND, T>, RNN_MM_CFG>
+      hiddenMM;
+
+ protected:
+  struct GruInputGm {
+    AscendC::GlobalTensor<T> xGm;
+    AscendC::GlobalTensor<T> weightInputGm;
+    AscendC::GlobalTensor<T> weightHiddenGm;
+    AscendC::GlobalTensor<T> biasGm;
+    AscendC::GlobalTensor<T> seqLengthGm;
+    AscendC::GlobalTensor<T> initHInGm;
+    AscendC::GlobalTensor<T> initHGm;
+  };
+
+  struct GruOutputGm {
+    AscendC::GlobalTensor<T> outYGm;
+    AscendC::GlobalTensor<T> outHGm;
+    AscendC::GlobalTensor<T> outUpdateGm;
+    AscendC::GlobalTensor<T> outResetGm;
+    AscendC::GlobalTensor<T> outNewGm;
+    AscendC::GlobalTensor<T> outHiddenNewGm;
+    AscendC::GlobalTensor<float> giGm;
+    AscendC::GlobalTensor<float> ghGm;
+    AscendC::GlobalTensor<T> zeroHGm;
+    AscendC::GlobalTensor<T> finalHGm;
+  };
+
+  AscendC::TQue<AscendC::QuePosition::VECIN, 1> qidHIn;
+  AscendC::TQue<AscendC::QuePosition::VECIN, 1> qidGiIn;
+  AscendC::TQue<AscendC::QuePosition::VECIN, 1> qidGhIn;
+  AscendC::TQue<AscendC::QuePosition::VECOUT, 1> qidVecOut;
+  AscendC::TBuf<AscendC::TPosition::VECCALC> calcBuf;
+
+  AscendC::LocalTensor<float> ubLocal1, ubLocal2, ubLocal3, ubLocal4;
+
+  GruInputGm inputGm;
+  GruOutputGm outputGm;
+
+  const DynamicRNNTilingData* __restrict tiling;
+  TCubeTiling inputMMTiling;
+  TCubeTiling hiddenMMTiling;
+  TRnnOffsets inputOffsets;
+  TRnnOffsets hiddenOffsets;
+  tailSize inputTail;
+  tailSize hiddenTail;
+
+  int64_t rOffset;
+  int64_t zOffset;
+  int64_t nOffset;
+  int64_t oneCellSize;
+  int64_t allCellSize;
+
+  int64_t blockSize;
+  int64_t calBlockSize;
+  int64_t vectorCoreM;
+  int64_t vectorTailM;
+  int64_t vectorCoreNum;
+  int64_t vectorBaseM;
+  int64_t vectorBaseTailM;
+  int64_t vectorTailTailM;
+  int64_t vectorSplitM;
+  int64_t vectorTailSplitM;
+  int64_t vectorSplitN;
+  int64_t vectorBaseN;
+  int64_t vectorTailN;
+  int64_t baseVector;
+  int64_t calcM;
+  int64_t calcN;
+  int64_t calcSizeAlign;
+
+  // bidirectional: both directions run in one launch, y/gates are concatenated as [T, B, 2H]
+  int64_t dirNum;
+  int64_t dirIdx;
+  bool isReverse;
+  int64_t outRowLen;
+
+  // packed: rows [activeBatch, batch) have finished at the current timestep
+  AscendC::GlobalTensor<int32_t> batchSizesGm;
+  int64_t activeBatch;
+};
+
+#endif
@@ -57,6 +57,7 @@ __aicore__ inline void LstmMmSplitNDNDFP16<T>::InitV2(GM_ADDR inputX, GM_ADDR we
             wCi, wCf, wCo, mask, outputY, outputH, outputC, outputI, outputJ, outputF, outputO, outputTanhC, workspace);
   InitVars();
   InitQue();
+  InitPacked(seqLength, workspace);
 }
 
 template <typename T>
@@ -253,6 +254,7 @@ __aicore__ inline void LstmMmSplitNDNDFP16<T>::InitVars() {
   jOffset = tiling->gateOrder == 0 ? tiling->hiddenSize : 2 * tiling->hiddenSize;
   fOffset = tiling->gateOrder == 0 ? 2 * tiling->hiddenSize : tiling->hiddenSize;
   oOffset = 3 * tiling->hiddenSize;
+  activeBatch = tiling->batch;
 }
 
 template <typename T>
@@ -283,6 +285,9 @@ __aicore__ inline void LstmMmSplitNDNDFP16<T>::ProcessHiddenMM(int64_t tIdx) {
     } else {
       hiddenOffsets.COffset = oriHiddenOffsets.COffset + tIdx * allCellSize;
     }
+    if (tiling->isPacked == 1 && !SetPackedHiddenTail()) {
+      return;
+    }
     hiddenMM.SetTensorA(inputGm.initHGm[hiddenOffsets.AOffset]);
     hiddenMM.IterateAll(outputGm.workspace[hiddenOffsets.COffset], true);
   }
@@ -354,6 +359,10 @@ __aicore__ inline void LstmMmSplitNDNDFP16<T>::CalcVecScaler(int64_t tIdx, int64
     // Calc block's m_size in the last core last block.
     calcM = vectorTailTailM;
   }
+  if (tiling->isPacked == 1) {
+    int64_t rowStart = blockIdx * vectorCoreM + mIdx * vectorBaseM;
+    calcM = activeBatch - rowStart < calcM ? activeBatch - rowStart : calcM;
+  }
 
   // get calc once block size
   calcSizeAlign = calcM * Ceil(calcN, blockSize) * blockSize;
@@ -745,10 +754,16 @@ __aicore__ inline void LstmMmSplitNDNDFP16<T>::ProcessVector(int64_t tIdx) {
     }
     auto mixGm = outputGm.workspace[offset];
     for (int64_t j = 0; j < coreLoopM; ++j) {
+      if (tiling->isPacked == 1 && mCoreIndex * vectorCoreM + j * vectorBaseM >= activeBatch) {
+        break;
+      }
       for (int64_t k = 0; k < vectorSplitN; ++k) {
         ProcessVectorOnce(tIdx, j, k, mixGm);
       }
     }
+    if (tiling->isPacked == 1) {
+      ProcessFinishedRows(tIdx);
+    }
   }
 }
 
@@ -777,6 +792,65 @@ __aicore__ inline void LstmMmSplitNDNDFP16<T>::ProcessInitalT() {
   }
 }
 
+template <typename T>
+__aicore__ inline void LstmMmSplitNDNDFP16<T>::InitPacked(GM_ADDR seqLength, GM_ADDR workspace) {
+  if (tiling->isPacked == 0) {
+    return;
+  }
+  // batchSizes[T]紧跟门计算workspace之后，由0核生成，进入时间循环前的SyncAll保证其余核可见
+  batchSizesGm.SetGlobalBuffer(
+      reinterpret_cast<__gm__ int32_t*>(reinterpret_cast<__gm__ float*>(workspace) + tiling->timeStep * allCellSize),
+      tiling->timeStep);
+  if (GetBlockIdx() == 0) {
+    CalcPackedBatchSizes<T>(seqLength, batchSizesGm, tiling->timeStep, tiling->batch, tiling->hiddenSize);
+  }
+}
+
+template <typename T>
+__aicore__ inline void LstmMmSplitNDNDFP16<T>::UpdateActiveBatch(int64_t tIdx) {
+  if (tiling->isPacked == 0) {
+    return;
+  }
+  int64_t slot = tiling->direction == 1 ? tiling->timeStep - 1 - tIdx : tIdx;
+  DataCacheCleanAndInvalid<int32_t, CacheLine::SINGLE_CACHE_LINE>(batchSizesGm[slot]);
+  activeBatch = batchSizesGm.GetValue(slot);
+}
+
+template <typename T>
+__aicore__ inline bool LstmMmSplitNDNDFP16<T>::SetPackedHiddenTail() {
+  // 本核负责的M段只保留未结束的行，整段结束则跳过本步的hidden matmul
+  int64_t mStart = hiddenTail.mCoreIndx * hiddenMMTiling.singleCoreM;
+  int64_t curM = hiddenTail.mCoreIndx == hiddenTail.notTailMCoreCount ? hiddenTail.tailSingleCoreM :
+                                                                        hiddenMMTiling.singleCoreM;
+  int64_t curN = hiddenTail.nCoreIndx == hiddenTail.notTailNCoreCount ? hiddenTail.tailSingleCoreN :
+                                                                        hiddenMMTiling.singleCoreN;
+  curM = activeBatch - mStart < curM ? activeBatch - mStart : curM;
+  if (curM <= 0) {
+    return false;
+  }
+  hiddenMM.SetTail(curM, curN);
+  return true;
+}
+
+template <typename T>
+__aicore__ inline void LstmMmSplitNDNDFP16<T>::ProcessFinishedRows(int64_t tIdx) {
+  // 已结束行等价于seq_length=0：y置0，h/c沿用上一步
+  int64_t rowStart = GetBlockIdx() * vectorCoreM;
+  int64_t rowEnd = rowStart + (GetBlockIdx() == vectorCoreNum - 1 ? vectorTailM : vectorCoreM);
+  rowStart = rowStart > activeBatch ? rowStart : activeBatch;
+  if (rowStart >= rowEnd) {
+    return;
+  }
+  int64_t slot = tiling->direction == 1 ? tiling->timeStep - 1 - tIdx : tIdx;
+  int64_t offset = slot * tiling->batch * tiling->hiddenSize + rowStart * tiling->hiddenSize;
+  int64_t count = (rowEnd - rowStart) * tiling->hiddenSize;
+  int64_t ubCount = 4 * baseVector * sizeof(float) / sizeof(T);
+  LocalTensor<T> ubLocal = ubLocal1.ReinterpretCast<T>();
+  ZeroGmByUb(outputGm.outYGm[offset], ubLocal, count, ubCount);
+  CopyGmByUb(outputGm.outHGm[offset], inputGm.initHGm[rowStart * tiling->hiddenSize], ubLocal, count, ubCount);
+  CopyGmByUb(outputGm.outCGm[offset], inputGm.initCGm[rowStart * tiling->hiddenSize], ubLocal, count, ubCount);
+}
+
 template <typename T>
 __aicore__ inline void LstmMmSplitNDNDFP16<T>::Process() {
   ProcessInputMM();
@@ -804,6 +878,8 @@ __aicore__ inline void LstmMmSplitNDNDFP16<T>::Process() {
   }
   SyncAll();
   for (int64_t tIdx = tiling->isInithc == 0 ? 1 : 0; tIdx < tiling->timeStep; tIdx++) {
+    UpdateActiveBatch(tIdx);
+
     ProcessHiddenMM(tIdx);
 
     SyncAll();
@@ -93,6 +93,10 @@ class LstmMmSplitNDNDFP16 {
   __aicore__ inline void CopyOutYHt0(AscendC::LocalTensor<float>& src, int64_t off);
 
   __aicore__ inline int64_t Ceil(int64_t x, int64_t y);
+  __aicore__ inline void InitPacked(GM_ADDR seqLength, GM_ADDR workspace);
+  __aicore__ inline void UpdateActiveBatch(int64_t tIdx);
+  __aicore__ inline bool SetPackedHiddenTail();
+  __aicore__ inline void ProcessFinishedRows(int64_t tIdx);
 
  public:
   AscendC::TPipe pipe;
@@ -202,6 +206,10 @@ class LstmMmSplitNDNDFP16 {
   int64_t calcM;
   int64_t calcN;
   int64_t coreCalcM;
+
+  // packed: rows [activeBatch, batch) have finished at the current timestep
+  AscendC::GlobalTensor<int32_t> batchSizesGm;
+  int64_t activeBatch;
 };
 
 #endif
\ No newline at end of file
@@ -51,6 +51,7 @@ __aicore__ inline void LstmMmSplitNDNDFP32<T>::InitV2(GM_ADDR inputX, GM_ADDR we
                 outputY, outputH, outputC, outputI, outputJ, outputF, outputO, outputTanhC, workspace);
   InitVars();
   InitQue();
+  InitPacked(seqLength, workspace);
 }
 
 template <typename T>
@@ -246,6 +247,7 @@ __aicore__ inline void LstmMmSplitNDNDFP32<T>::InitVars() {
   jOffset = tiling->gateOrder == 0 ? tiling->hiddenSize : 2 * tiling->hiddenSize;
   fOffset = tiling->gateOrder == 0 ? 2 * tiling->hiddenSize : tiling->hiddenSize;
   oOffset = 3 * tiling->hiddenSize;
+  activeBatch = tiling->batch;
 }
 
 template <typename T>
@@ -278,7 +280,12 @@ __aicore__ inline void LstmMmSplitNDNDFP32<T>::ProcessHiddenMM(int64_t tIdx) {
     }
     hiddenMM.SetTensorA(inputGm.initHGm[hiddenOffsets.AOffset]);
     hiddenMM.SetTensorB(inputGm.weightHiddenGm[hiddenOffsets.BOffset]);
-    if (hiddenTail.nCoreIndx == hiddenTail.notTailNCoreCount && hiddenTail.mCoreIndx == hiddenTail.notTailMCoreCount) {
+    if (tiling->isPacked == 1) {
+      if (!SetPackedHiddenTail()) {
+        return;
+      }
+    } else if (hiddenTail.nCoreIndx == hiddenTail.notTailNCoreCount &&
+               hiddenTail.mCoreIndx == hiddenTail.notTailMCoreCount) {
       hiddenMM.SetTail(hiddenTail.tailSingleCoreM, hiddenTail.tailSingleCoreN);
     } else if (hiddenTail.nCoreIndx == hiddenTail.notTailNCoreCount) {
       hiddenMM.SetTail(hiddenMMTiling.singleCoreM, hiddenTail.tailSingleCoreN);
@@ -493,6 +500,10 @@ __aicore__ inline void LstmMmSplitNDNDFP32<T>::ProcessVectorOnce(int64_t tIdx, i
     // Calc block's m_size in the last core last block.
     calcM = vectorTailTailM;
   }
+  if (tiling->isPacked == 1) {
+    int64_t rowStart = blockIdx * vectorCoreM + mIdx * vectorBaseM;
+    calcM = activeBatch - rowStart < calcM ? activeBatch - rowStart : calcM;
+  }
 
   // get calc once block size
   calcSize = calcM * calcN;
@@ -727,11 +738,17 @@ __aicore__ inline void LstmMmSplitNDNDFP32<T>::ProcessVector(int64_t tIdx) {
       offset = tIdx * allCellSize;
     }
     for (int64_t j = 0; j < coreLoopM; ++j) {
+      if (tiling->isPacked == 1 && mCoreIndex * vectorCoreM + j * vectorBaseM >= activeBatch) {
+        break;
+      }
       for (int64_t k = 0; k < vectorSplitN; ++k) {
         auto mixGm = outputGm.workspace[offset];
         ProcessVectorOnce(tIdx, j, k, mixGm);
       }
     }
+    if (tiling->isPacked == 1) {
+      ProcessFinishedRows(tIdx);
+    }
   }
 }
 
@@ -760,6 +777,64 @@ __aicore__ inline void LstmMmSplitNDNDFP32<T>::ProcessInitalT() {
   }
 }
 
+template <typename T>
+__aicore__ inline void LstmMmSplitNDNDFP32<T>::InitPacked(GM_ADDR seqLength, GM_ADDR workspace) {
+  if (tiling->isPacked == 0) {
+    return;
+  }
+  // batchSizes[T]紧跟门计算workspace之后，由0核生成，时间循环开头的SyncAll保证其余核可见
+  batchSizesGm.SetGlobalBuffer(
+      reinterpret_cast<__gm__ int32_t*>(reinterpret_cast<__gm__ float*>(workspace) + tiling->timeStep * allCellSize),
+      tiling->timeStep);
+  if (GetBlockIdx() == 0) {
+    CalcPackedBatchSizes<T>(seqLength, batchSizesGm, tiling->timeStep, tiling->batch, tiling->hiddenSize);
+  }
+}
+
+template <typename T>
+__aicore__ inline void LstmMmSplitNDNDFP32<T>::UpdateActiveBatch(int64_t tIdx) {
+  if (tiling->isPacked == 0) {
+    return;
+  }
+  int64_t slot = tiling->direction == 1 ? tiling->timeStep - 1 - tIdx : tIdx;
+  DataCacheCleanAndInvalid<int32_t, CacheLine::SINGLE_CACHE_LINE>(batchSizesGm[slot]);
+  activeBatch = batchSizesGm.GetValue(slot);
+}
+
+template <typename T>
+__aicore__ inline bool LstmMmSplitNDNDFP32<T>::SetPackedHiddenTail() {
+  // 本核负责的M段只保留未结束的行，整段结束则跳过本步的hidden matmul
+  int64_t mStart = hiddenTail.mCoreIndx * hiddenMMTiling.singleCoreM;
+  int64_t curM = hiddenTail.mCoreIndx == hiddenTail.notTailMCoreCount ? hiddenTail.tailSingleCoreM :
+                                                                        hiddenMMTiling.singleCoreM;
+  int64_t curN = hiddenTail.nCoreIndx == hiddenTail.notTailNCoreCount ? hiddenTail.tailSingleCoreN :
+                                                                        hiddenMMTiling.singleCoreN;
+  curM = activeBatch - mStart < curM ? activeBatch - mStart : curM;
+  if (curM <= 0) {
+    return false;
+  }
+  hiddenMM.SetTail(curM, curN);
+  return true;
+}
+
+template <typename T>
+__aicore__ inline void LstmMmSplitNDNDFP32<T>::ProcessFinishedRows(int64_t tIdx) {
+  // 已结束行等价于seq_length=0：y置0，h/c沿用上一步
+  int64_t rowStart = GetBlockIdx() * vectorCoreM;
+  int64_t rowEnd = rowStart + (GetBlockIdx() == vectorCoreNum - 1 ? vectorTailM : vectorCoreM);
+  rowStart = rowStart > activeBatch ? rowStart : activeBatch;
+  if (rowStart >= rowEnd) {
+    return;
+  }
+  int64_t slot = tiling->direction == 1 ? tiling->timeStep - 1 - tIdx : tIdx;
+  int64_t offset = slot * tiling->batch * tiling->hiddenSize + rowStart * tiling->hiddenSize;
+  int64_t count = (rowEnd - rowStart) * tiling->hiddenSize;
+  int64_t ubCount = 4 * baseVector;
+  ZeroGmByUb(outputGm.outYGm[offset], ubLocal1, count, ubCount);
+  CopyGmByUb(outputGm.outHGm[offset], inputGm.initHGm[rowStart * tiling->hiddenSize], ubLocal1, count, ubCount);
+  CopyGmByUb(outputGm.outCGm[offset], inputGm.initCGm[rowStart * tiling->hiddenSize], ubLocal1, count, ubCount);
+}
+
 template <typename T>
 __aicore__ inline void LstmMmSplitNDNDFP32<T>::Process() {
   ProcessInputMM();
@@ -780,6 +855,8 @@ __aicore__ inline void LstmMmSplitNDNDFP32<T>::Process() {
   for (int64_t tIdx = tiling->isInithc == 0 ? 1 : 0; tIdx < tiling->timeStep; tIdx++) {
     SyncAll();
 
+    UpdateActiveBatch(tIdx);
+
     ProcessHiddenMM(tIdx);
 
     SyncAll();
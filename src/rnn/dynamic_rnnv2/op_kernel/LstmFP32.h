@@ -85,6 +85,10 @@ class LstmMmSplitNDNDFP32 {
                                     int64_t mIdx, int64_t nIdx);
   __aicore__ inline void GetCoreIndex(TCubeTiling& param, int32_t& subKIndx, tailSize& mmTail, int32_t kSize);
   __aicore__ inline int64_t Ceil(int64_t x, int64_t y);
+  __aicore__ inline void InitPacked(GM_ADDR seqLength, GM_ADDR workspace);
+  __aicore__ inline void UpdateActiveBatch(int64_t tIdx);
+  __aicore__ inline bool SetPackedHiddenTail();
+  __aicore__ inline void ProcessFinishedRows(int64_t tIdx);
 
  public:
   AscendC::TPipe pipe;
@@ -190,6 +194,10 @@ class LstmMmSplitNDNDFP32 {
   int64_t calcM;
   int64_t calcN;
   int64_t coreCalcM;
+
+  // packed: rows [activeBatch, batch) have finished at the current timestep
+  AscendC::GlobalTensor<int32_t> batchSizesGm;
+  int64_t activeBatch;
 };
 
 #endif
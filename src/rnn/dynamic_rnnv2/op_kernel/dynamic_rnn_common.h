@@ -27,6 +27,88 @@ __aicore__ inline int Ceil(int a, int b) {
   return (a + b - 1) / b;
 }
 
+// packed模式下seq_length为[T, B, H]的0/1掩码，约定每个batch行只有前len_b个时间步非零（同pack_padded_sequence）
+template <typename T>
+__aicore__ inline bool IsSeqValid(GM_ADDR seqLength, int64_t idx) {
+  if constexpr (sizeof(T) == sizeof(uint16_t)) {
+    return (reinterpret_cast<__gm__ uint16_t*>(seqLength)[idx] & 0x7FFF) != 0;
+  } else {
+    return (reinterpret_cast<__gm__ uint32_t*>(seqLength)[idx] & 0x7FFFFFFF) != 0;
+  }
+}
+
+// 生成每个时间步需要计算的行数 batchSizes[t] = max{b | len_b > t} + 1。
+// batch按长度降序排列时[batchSizes[t], B)行在t步均已结束；乱序输入结果不变，只是跳过的行变少。
+template <typename T>
+__aicore__ inline void CalcPackedBatchSizes(GM_ADDR seqLength, AscendC::GlobalTensor<int32_t>& batchSizesGm,
+                                            int64_t timeStep, int64_t batch, int64_t hiddenSize) {
+  int64_t maxLen = 0;
+  for (int64_t b = batch - 1; b >= 0; --b) {
+    // 掩码按时间前缀有效，二分得到该行长度
+    int64_t lo = 0;
+    int64_t hi = timeStep;
+    while (lo < hi) {
+      int64_t mid = (lo + hi) / 2;
+      if (IsSeqValid<T>(seqLength, (mid * batch + b) * hiddenSize)) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    for (int64_t t = maxLen; t < lo; ++t) {
+      batchSizesGm.SetValue(t, static_cast<int32_t>(b + 1));
+    }
+    maxLen = lo > maxLen ? lo : maxLen;
+  }
+  for (int64_t t = maxLen; t < timeStep; ++t) {
+    batchSizesGm.SetValue(t, 0);
+  }
+  AscendC::DataCacheCleanAndInvalid<int32_t, AscendC::CacheLine::ENTIRE_DATA_CACHE>(batchSizesGm);
+}
+
+// 已结束行不做计算，只经UB搬运延续上一步的h/c
+template <typename T>
+__aicore__ inline void CopyGmByUb(AscendC::GlobalTensor<T> dstGm, AscendC::GlobalTensor<T> srcGm,
+                                  AscendC::LocalTensor<T>& ub, int64_t count, int64_t ubCount) {
+  event_t eventVToMte2 = static_cast<event_t>(AscendC::GetTPipePtr()->FetchEventID(AscendC::HardEvent::V_MTE2));
+  event_t eventMte2ToMte3 = static_cast<event_t>(AscendC::GetTPipePtr()->FetchEventID(AscendC::HardEvent::MTE2_MTE3));
+  event_t eventMte3ToMte2 = static_cast<event_t>(AscendC::GetTPipePtr()->FetchEventID(AscendC::HardEvent::MTE3_MTE2));
+  event_t eventMte3ToV = static_cast<event_t>(AscendC::GetTPipePtr()->FetchEventID(AscendC::HardEvent::MTE3_V));
+  AscendC::SetFlag<AscendC::HardEvent::V_MTE2>(eventVToMte2);
+  AscendC::WaitFlag<AscendC::HardEvent::V_MTE2>(eventVToMte2);
+  AscendC::DataCopyPadExtParams<T> padParams{false, 0, 0, 0};
+  for (int64_t offset = 0; offset < count; offset += ubCount) {
+    int64_t len = count - offset < ubCount ? count - offset : ubCount;
+    AscendC::DataCopyExtParams copyParams{1, static_cast<uint32_t>(len * sizeof(T)), 0, 0, 0};
+    AscendC::DataCopyPad(ub, srcGm[offset], copyParams, padParams);
+    AscendC::SetFlag<AscendC::HardEvent::MTE2_MTE3>(eventMte2ToMte3);
+    AscendC::WaitFlag<AscendC::HardEvent::MTE2_MTE3>(eventMte2ToMte3);
+    AscendC::DataCopyPad(dstGm[offset], ub, copyParams);
+    AscendC::SetFlag<AscendC::HardEvent::MTE3_MTE2>(eventMte3ToMte2);
+    AscendC::WaitFlag<AscendC::HardEvent::MTE3_MTE2>(eventMte3ToMte2);
+  }
+  AscendC::SetFlag<AscendC::HardEvent::MTE3_V>(eventMte3ToV);
+  AscendC::WaitFlag<AscendC::HardEvent::MTE3_V>(eventMte3ToV);
+}
+
+template <typename T>
+__aicore__ inline void ZeroGmByUb(AscendC::GlobalTensor<T> dstGm, AscendC::LocalTensor<T>& ub, int64_t count,
+                                  int64_t ubCount) {
+  event_t eventVToMte3 = static_cast<event_t>(AscendC::GetTPipePtr()->FetchEventID(AscendC::HardEvent::V_MTE3));
+  event_t eventMte3ToV = static_cast<event_t>(AscendC::GetTPipePtr()->FetchEventID(AscendC::HardEvent::MTE3_V));
+  int64_t dupCount = count < ubCount ? count : ubCount;
+  AscendC::Duplicate(ub, static_cast<T>(0), static_cast<int32_t>(dupCount));
+  AscendC::SetFlag<AscendC::HardEvent::V_MTE3>(eventVToMte3);
+  AscendC::WaitFlag<AscendC::HardEvent::V_MTE3>(eventVToMte3);
+  for (int64_t offset = 0; offset < count; offset += ubCount) {
+    int64_t len = count - offset < ubCount ? count - offset : ubCount;
+    AscendC::DataCopyExtParams copyParams{1, static_cast<uint32_t>(len * sizeof(T)), 0, 0, 0};
+    AscendC::DataCopyPad(dstGm[offset], ub, copyParams);
+  }
+  AscendC::SetFlag<AscendC::HardEvent::MTE3_V>(eventMte3ToV);
+  AscendC::WaitFlag<AscendC::HardEvent::MTE3_V>(eventMte3ToV);
+}
+
 struct TRnnOffsets {
   int64_t AOffset;
   int64_t BOffset;
@@ -14,6 +14,7 @@
  */
 #include "LstmFP16.cpp"
 #include "LstmFP32.cpp"
+#include "GruCell.cpp"
 
 extern "C" __global__ __aicore__ void dynamic_rnnv2(GM_ADDR inputX, GM_ADDR weightInput, GM_ADDR weightHidden,
                                                   GM_ADDR bias, GM_ADDR seqLength,
@@ -43,5 +44,21 @@ extern "C" __global__ __aicore__ void dynamic_rnnv2(GM_ADDR inputX, GM_ADDR weig
     lstmOp.InitV2(inputX, weightInput, weightHidden, bias, seqLength, initH, initC, wCi, wCf, wCo, mask,
                   outputY, outputH, outputC, outputI, outputJ, outputF, outputO, outputTanhC, &tiling_data, workspace);
     lstmOp.Process();
+  } else if (TILING_KEY_IS(10000021)) {
+    GruMmSplitND<half> gruOp;
+    REGIST_MATMUL_OBJ(&gruOp.pipe, GetSysWorkSpacePtr(), gruOp.inputMM, inputMMTiling,
+                      gruOp.hiddenMM, hiddenMMTiling);
+
+    gruOp.Init(inputX, weightInput, weightHidden, bias, seqLength, initH, outputY, outputH,
+               outputI, outputJ, outputF, outputO, &tiling_data, workspace);
+    gruOp.Process();
+  } else if (TILING_KEY_IS(10000022)) {
+    GruMmSplitND<float> gruOp;
+    REGIST_MATMUL_OBJ(&gruOp.pipe, GetSysWorkSpacePtr(), gruOp.inputMM, inputMMTiling,
+                      gruOp.hiddenMM, hiddenMMTiling);
+
+    gruOp.Init(inputX, weightInput, weightHidden, bias, seqLength, initH, outputY, outputH,
+               outputI, outputJ, outputF, outputO, &tiling_data, workspace);
+    gruOp.Process();
   }
 }